@@ -312,20 +312,43 @@ Modification History:
 #ifndef ANSI                /* UNIX compatible */
 #include <sys/timeb.h>
 #include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <errno.h>
 #include <unistd.h>
-#define Sleep sleep
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#define Sleep(milliseconds) RsCoreInt_DelayMicroseconds((ViUInt64)(milliseconds) * 1000)
 #else                       /* ANSI compatible */
+#include <winsock2.h>
+#include <ws2tcpip.h>
 #include <windows.h>
+#if defined(_MSC_VER)
+#pragma comment(lib, "ws2_32.lib")
+#endif
 #endif
 
 #include "rscore.h"
 #include <visa.h>
 
+// The core functions lock the session without the driver function name
+#undef RsCore_LockSession
+
 #if defined (__linux__)
 #include <pthread.h>
 #include <ctype.h>
 #endif
 
+// SSE2 kernels of the multi-column results, available on all x64 compilers
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RSCORE_SSE2
+#include <emmintrin.h>
+#endif
+
 // Core version info
 #define RSCORE_ENGINE_REVISION                      "Rev 3.00, 10/2018"
 #define RSCORE_ENGINE_MAJOR_VERSION                 3L
@@ -369,12 +392,130 @@ const ViString gDataTypeStrings[] = {
 #elif defined(ANSI)
 #define MUTEX HANDLE
 #endif
+
+// Thread local storage class of the error info and session lookup caches.
+// Compilers without the thread local storage fall back to one process-wide instance
+#if defined (__GNUC__) || defined (__clang__)
+#define RS_THREAD_LOCAL __thread
+#elif defined (_MSC_VER)
+#define RS_THREAD_LOCAL __declspec(thread)
+#else
+#define RS_THREAD_LOCAL
+#endif
+
+// Error info of the calling thread, not bound to any session
+typedef struct RsCoreThreadErrorInfo
+{
+	ViStatus primaryError;
+	ViStatus secondaryError;
+	ViChar errorElaboration[RS_MAX_MESSAGE_BUF_SIZE];
+	RsCoreErrorContext context; // Not yet formatted part of the errorElaboration
+} RsCoreThreadErrorInfo;
+
+// Last session found by RsCore_GetRsSession in the calling thread
+typedef struct RsCoreThreadSessionCache
+{
+	ViSession io;
+	RsCoreSessionPtr rsSession;
+	ViUInt32 generation;
+} RsCoreThreadSessionCache;
+
+// One resource of RsCore_OpenSessionsParallel
+typedef struct RsCoreParallelOpenJob
+{
+	ViRsrc resourceName;
+	RsCoreOpenSessionCallback openSession;
+	void* context;
+	ViSession* instrSession;
+	ViStatus* status;
+	ViStatus secondaryError; // Error info of a failed open, the thread-local error info ends with the thread
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+} RsCoreParallelOpenJob;
+
+#if defined(ANSI)
+#define RS_SOCKET SOCKET
+#define RS_INVALID_SOCKET INVALID_SOCKET
+#define RS_SOCKET_TIMED_OUT() (WSAGetLastError() == WSAETIMEDOUT)
+#else
+#define RS_SOCKET int
+#define RS_INVALID_SOCKET (-1)
+#define RS_SOCKET_TIMED_OUT() (errno == EAGAIN || errno == EWOULDBLOCK)
+#define closesocket close
+#endif
+
+// Native socket transport settings
+#define RS_SOCKET_DEFAULT_PORT                  5025 // Raw SCPI port of R&S instruments
+#define RS_SOCKET_OS_BUFFER_SIZE                (4 * 1024 * 1024) // SO_SNDBUF and SO_RCVBUF size
+#define RS_SOCKET_RX_BUFFER_SIZE                (64 * 1024) // Receive buffer for termination character search
+#define RS_SOCKET_TX_STAGE_SIZE                 4096 // Writes without END up to this size are coalesced with the next write
+#define RS_SOCKET_MAX_SEGMENTS                  16 // Maximum number of segments sent in one system call
+
+// Native socket transport instance data
+typedef struct RsCoreSocketContext
+{
+	RS_SOCKET socket;
+	ViUInt32 timeoutMs; // VI_ATTR_TMO_VALUE
+	ViUInt8 termChar; // VI_ATTR_TERMCHAR
+	ViBoolean termCharEnabled; // VI_ATTR_TERMCHAR_EN
+	ViBoolean sendEndEnabled; // VI_ATTR_SEND_END_EN
+	ViByte* rxBuffer; // Received data not yet returned by read
+	ViUInt32 rxStart;
+	ViUInt32 rxEnd;
+	ViByte txStage[RS_SOCKET_TX_STAGE_SIZE]; // Data written without END, sent together with the next write
+	ViUInt32 txStagedCount;
+} RsCoreSocketContext, *RsCoreSocketContextPtr;
+
+// Record / replay transport log format
+// Header: "RSIOLOG" + format version byte, interface type (2 bytes), resource class length (1 byte) and resource class
+// Record: type (1 byte), status (4 bytes), IO duration in us (varint), data length (varint), data
+#define RS_IOLOG_MAGIC                          "RSIOLOG\x01"
+#define RS_IOLOG_MAGIC_LEN                      8
+#define RS_IOLOG_RECORD_WRITE                   'W'
+#define RS_IOLOG_RECORD_READ                    'R'
+#define RS_IOLOG_RECORD_READ_STB                'S'
+#define RS_IOLOG_RECORD_CLEAR                   'C'
+#define RS_IOLOG_FILE_BUFFER_SIZE               (1024 * 1024)
+
+// VISA transport instance data, used as the inner transport of the record transport
+typedef struct RsCoreVisaContext
+{
+	ViSession rmSession;
+	ViSession io;
+} RsCoreVisaContext, *RsCoreVisaContextPtr;
+
+// Record transport instance data
+typedef struct RsCoreRecordContext
+{
+	const RsCoreTransport* inner; // Transport performing the real IO
+	void* innerContext;
+	FILE* file; // Log file
+} RsCoreRecordContext, *RsCoreRecordContextPtr;
+
+// Replay transport instance data
+typedef struct RsCoreReplayContext
+{
+	ViByte* log; // Complete log file content
+	ViUInt64 size;
+	ViUInt64 position; // Position of the next record
+	ViBoolean timing; // If TRUE, each IO call lasts as long as the recorded one
+	ViUInt16 intfType; // Recorded VI_ATTR_INTF_TYPE
+	ViChar rsrcClass[RS_MAX_SHORT_MESSAGE_BUF_SIZE]; // Recorded VI_ATTR_RSRC_CLASS
+	ViUInt32 timeoutMs;
+	ViUInt8 termChar;
+	ViBoolean termCharEnabled;
+	ViBoolean sendEndEnabled;
+	ViByte* readData; // Rest of a read record not yet returned
+	ViUInt64 readRemaining;
+	ViStatus readStatus;
+} RsCoreReplayContext, *RsCoreReplayContextPtr;
 /*****************************************************************************************************/
 /*  Non-exported functions
 ******************************************************************************************************/
 
+MUTEX RsCoreInt_MutexCreate(void);
 MUTEX RsCoreInt_MutexLock(MUTEX mutex);
 void RsCoreInt_MutexUnlock(MUTEX mutex);
+void RsCoreInt_MutexDispose(MUTEX mutex);
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
@@ -388,6 +529,8 @@ ViBoolean RsCoreInt_SplitTokenToNameAndValue(ViConstString token, ViConstString
                                              ViInt32 buffersSize);
 void RsCoreInt_FormatBufferForStringMessage(ViByte* data, ViInt32 dataSize, ViInt32 truncLen);
 ViInt32 RsCoreInt_AppendDiscreteRangeTableList(RsCoreRangeTablePtr rangeTable, RsCoreDataType dataType, ViInt32 bufferSize, ViChar* buffer);
+ViReal64 RsCoreInt_GetTickCountMs(void);
+ViUInt64 RsCoreInt_GetTickCountNs(void);
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
@@ -395,7 +538,7 @@ ViInt32 RsCoreInt_AppendDiscreteRangeTableList(RsCoreRangeTablePtr rangeTable, R
 ------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
 ViInt32 RsCoreInt_SessionsListGetCount(void);
-ViStatus RsCoreInt_SessionsListAddSession(ViRsrc resourceName, RsCoreSessionPtr* rsSessionNew);
+ViStatus RsCoreInt_SessionsListAddSession(ViRsrc resourceName, const RsCoreAllocator* allocator, RsCoreSessionPtr* rsSessionNew);
 ViStatus RsCoreInt_SessionsListDeleteSession(ViSession instrSession);
 ViStatus RsCoreInt_SessionsListExists(ViRsrc resourceName, RsCoreSessionPtr* rsSession);
 ViStatus RsCoreInt_SessionsListGetUniqueHandle(ViPSession instrSession);
@@ -420,6 +563,18 @@ ViStatus RsCoreInt_SetErrorInfoAttr(ViSession instrSession,
                                     ViStatus secondaryError,
                                     ViConstString errorElab);
 
+ViStatus RsCoreInt_SetErrorRecord(ViSession instrSession,
+                                  ViBoolean overWrite,
+                                  ViStatus primaryError,
+                                  ViStatus secondaryError,
+                                  const RsCoreErrorContext* context,
+                                  ViConstString errorElab);
+
+void RsCoreInt_AddErrorAttribute(ViSession instrSession, RsCoreAttributePtr attr);
+void RsCoreInt_ResolveErrorContext(RsCoreSessionPtr rsSession);
+void RsCoreInt_FormatErrorContext(RsCoreSessionPtr rsSession, const RsCoreErrorContext* context, ViConstString text,
+                                  ViInt32 bufferSize, ViChar* elaboration);
+
 ViStatus RsCoreInt_CheckErrorElaboration(ViSession instrSession, ViConstString pattern, ViBoolean* patternFound);
 
 ViStatus RsCoreInt_StatusDescription(ViStatus statusCode,
@@ -433,9 +588,11 @@ ViStatus RsCoreInt_CheckStatusAfterOpcSync(ViSession instrSession, ViStatus erro
 ---- INTERNAL New Session creation -------------------------------------------------------------------*
 ------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
-ViStatus RsCoreInt_ParseOptionsBefore(ViConstString optionsString, ViPBoolean simulate, ViPBoolean reuseSession);
-ViStatus RsCoreInt_InitOrReuseSession(ViRsrc resourceName, RsCoreAttributePtr* attrList, ViBoolean simulate, ViBoolean reuseSession,
-                                      ViPSession instrSessionNew);
+ViStatus RsCoreInt_ParseOptionsBefore(ViConstString optionsString, ViPBoolean simulate, ViPBoolean reuseSession, ViPBoolean sessionPool,
+                                      const RsCoreTransport** transport, const RsCoreAllocator** allocator);
+ViStatus RsCoreInt_InitOrReuseSession(ViRsrc resourceName, ViConstString optionsString, RsCoreAttributePtr* attrList, ViBoolean simulate,
+                                      ViBoolean reuseSession, ViBoolean sessionPool, const RsCoreTransport* transport,
+                                      const RsCoreAllocator* allocator, ViPSession instrSessionNew);
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
@@ -445,6 +602,8 @@ ViStatus RsCoreInt_InitOrReuseSession(ViRsrc resourceName, RsCoreAttributePtr* a
 ViChar* RsCoreInt_GetAttrInfoString(RsCoreAttributePtr attr, ViInt32 bufferSize, ViChar* attributeInfo);
 ViStatus RsCoreInt_CastDataType(ViSession instrSession, RsCoreDataType sourceType, void* sourceValue, RsCoreDataType targetType, void* targetValue);
 ViStatus RsCoreInt_GetAttributePtr(ViSession instrSession, ViAttr attributeId, RsCoreAttributePtr* attrOut);
+ViStatus RsCoreInt_MaterializeAttribute(ViSession instrSession, RsCoreSessionPtr rsSession, RsCoreAttributePtr attr);
+void RsCoreInt_WriteAttributeDefault(RsCoreAttributePtr attr);
 ViStatus RsCoreInt_GetAttrP2Value(RsCoreAttributePtr attr, void* value, ViInt32 bufSize);
 ViStatus RsCoreInt_GetAttrViStringLen(RsCoreAttributePtr attr, ViInt32* stringLength, ViInt32* allocatedBufferSize);
 ViStatus RsCoreInt_SetAttribute(ViSession instrSession,
@@ -512,6 +671,121 @@ ViStatus RsCoreInt_FindDiscreteRangeTableCmdString(ViSession instrSession,
                                                    ViReal64 precision,
                                                    ViChar** p2cmdString);
 
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- INTERNAL IO Transport ---------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCoreInt_FindTransport(ViConstString transportName, const RsCoreTransport** transport);
+ViBoolean RsCoreInt_GetTransport(ViSession instrSession, const RsCoreTransport** transport, void** context);
+ViStatus RsCoreInt_IoWrite(ViSession instrSession, ViConstBuf buffer, ViUInt32 count, ViPUInt32 retCount);
+ViStatus RsCoreInt_IoWriteSegments(ViSession instrSession, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount);
+ViBoolean RsCoreInt_IsQueryOnly(ViConstBuf buffer, ViUInt32 count);
+void RsCoreInt_TraceCacheClear(RsCoreSessionPtr rsSession);
+ViStatus RsCoreInt_IoRead(ViSession instrSession, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount);
+ViStatus RsCoreInt_IoReadStb(ViSession instrSession, ViPUInt16 stb);
+ViStatus RsCoreInt_IoClear(ViSession instrSession);
+ViStatus RsCoreInt_IoSetAttribute(ViSession instrSession, ViAttr attributeName, ViAttrState attributeValue);
+ViStatus RsCoreInt_IoGetAttribute(ViSession instrSession, ViAttr attributeName, void* attributeValue);
+RsCoreSessionPtr RsCoreInt_GetIoSession(ViSession instrSession);
+ViUInt32 RsCoreInt_IoTraceBegin(RsCoreSessionPtr rsSession, ViInt32 operation, ViUInt32 requestedCount,
+                                const RsCoreIoSegment segments[], ViUInt32 segmentsCount);
+void RsCoreInt_IoTraceEnd(RsCoreSessionPtr rsSession, ViUInt32 sequence, ViStatus status, ViUInt32 transferredCount,
+                          ViConstBuf data, ViUInt32 dataCount);
+void RsCoreInt_IoTraceFormatData(const RsCoreIoTraceEntry* entry, ViInt32 bufferSize, ViChar* buffer);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- INTERNAL Driver function latency ----------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+void RsCoreInt_LatencyCallBegin(RsCoreSessionPtr rsSession, ViConstString functionName);
+void RsCoreInt_LatencyCallEnd(RsCoreSessionPtr rsSession);
+void RsCoreInt_LatencyOpcWaitBegin(RsCoreSessionPtr rsSession);
+void RsCoreInt_LatencyOpcWaitEnd(RsCoreSessionPtr rsSession);
+void RsCoreInt_LatencyHistogramAdd(RsCoreLatencyHistogram* histogram, ViUInt64 valueNs);
+ViUInt64 RsCoreInt_LatencyHistogramPercentile(const RsCoreLatencyHistogram* histogram, ViReal64 percentile);
+void RsCoreInt_LatencyHistogramStats(const RsCoreLatencyHistogram* histogram, RsCoreLatencyStats* stats);
+RsCoreFunctionLatencyPtr RsCoreInt_FindFunctionLatency(RsCoreSessionPtr rsSession, ViConstString functionName, ViBoolean create);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- INTERNAL Round-trip diagnostics -----------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+void RsCoreInt_RoundTripIo(RsCoreSessionPtr rsSession, ViInt32 operation, const RsCoreIoSegment segments[], ViUInt32 segmentsCount);
+void RsCoreInt_RoundTripFlag(RsCoreSessionPtr rsSession, ViInt32 pattern, ViConstBuf example, ViUInt32 exampleLength);
+void RsCoreInt_RoundTripCheckFormat(RsCoreSessionPtr rsSession, ViConstBuf data, ViUInt32 length);
+void RsCoreInt_RoundTripStatusCheck(RsCoreSessionPtr rsSession);
+void RsCoreInt_RoundTripOpcTimeout(RsCoreSessionPtr rsSession, RsCoreAttributePtr attr, ViInt32 newValue);
+void RsCoreInt_RoundTripCallEnd(RsCoreSessionPtr rsSession, RsCoreFunctionLatencyPtr latency);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- INTERNAL Memory allocation ----------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCoreInt_FindAllocator(ViConstString allocatorName, const RsCoreAllocator** allocator);
+const RsCoreAllocator* RsCoreInt_GetAllocator(ViSession instrSession);
+void* RsCoreInt_Malloc(const RsCoreAllocator* allocator, size_t size);
+void* RsCoreInt_Calloc(const RsCoreAllocator* allocator, size_t count, size_t size);
+void* RsCoreInt_Realloc(const RsCoreAllocator* allocator, void* ptr, size_t size);
+void RsCoreInt_Free(const RsCoreAllocator* allocator, void* ptr);
+
+ViStatus RsCoreInt_SocketOpen(ViRsrc resourceName, ViConstString optionsString, void** context);
+void RsCoreInt_SocketClose(void* context);
+ViStatus RsCoreInt_SocketSend(RsCoreSocketContextPtr ctx, const RsCoreIoSegment segments[], ViUInt32 segmentsCount);
+ViStatus RsCoreInt_SocketWrite(void* context, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount);
+ViStatus RsCoreInt_SocketRead(void* context, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount);
+ViStatus RsCoreInt_SocketReadStb(void* context, ViPUInt16 stb);
+ViStatus RsCoreInt_SocketClear(void* context);
+ViStatus RsCoreInt_SocketSetAttribute(void* context, ViAttr attributeName, ViAttrState attributeValue);
+ViStatus RsCoreInt_SocketGetAttribute(void* context, ViAttr attributeName, void* attributeValue);
+
+ViBoolean RsCoreInt_GetOptionsTokenValue(ViConstString optionsString, ViConstString tokenName, ViInt32 bufferSize, ViChar* tokenValue);
+ViStatus RsCoreInt_VisaWriteSegments(ViSession io, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount);
+void RsCoreInt_DelayMicroseconds(ViUInt64 delayUs);
+
+ViStatus RsCoreInt_VisaOpen(ViRsrc resourceName, ViConstString optionsString, void** context);
+void RsCoreInt_VisaClose(void* context);
+ViStatus RsCoreInt_VisaWrite(void* context, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount);
+ViStatus RsCoreInt_VisaRead(void* context, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount);
+ViStatus RsCoreInt_VisaReadStb(void* context, ViPUInt16 stb);
+ViStatus RsCoreInt_VisaClear(void* context);
+ViStatus RsCoreInt_VisaSetAttribute(void* context, ViAttr attributeName, ViAttrState attributeValue);
+ViStatus RsCoreInt_VisaGetAttribute(void* context, ViAttr attributeName, void* attributeValue);
+
+ViStatus RsCoreInt_IoLogWriteRecord(FILE* file, ViByte type, ViStatus status, ViReal64 durationMs,
+                                    const RsCoreIoSegment segments[], ViUInt32 segmentsCount);
+ViStatus RsCoreInt_IoLogReadRecord(RsCoreReplayContextPtr ctx, ViByte expectedType, ViStatus* status, ViByte** data, ViUInt64* length);
+
+ViStatus RsCoreInt_RecordOpen(ViRsrc resourceName, ViConstString optionsString, void** context);
+void RsCoreInt_RecordClose(void* context);
+ViStatus RsCoreInt_RecordWrite(void* context, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount);
+ViStatus RsCoreInt_RecordRead(void* context, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount);
+ViStatus RsCoreInt_RecordReadStb(void* context, ViPUInt16 stb);
+ViStatus RsCoreInt_RecordClear(void* context);
+ViStatus RsCoreInt_RecordSetAttribute(void* context, ViAttr attributeName, ViAttrState attributeValue);
+ViStatus RsCoreInt_RecordGetAttribute(void* context, ViAttr attributeName, void* attributeValue);
+
+ViStatus RsCoreInt_ReplayOpen(ViRsrc resourceName, ViConstString optionsString, void** context);
+void RsCoreInt_ReplayClose(void* context);
+ViStatus RsCoreInt_ReplayWrite(void* context, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount);
+ViStatus RsCoreInt_ReplayRead(void* context, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount);
+ViStatus RsCoreInt_ReplayReadStb(void* context, ViPUInt16 stb);
+ViStatus RsCoreInt_ReplayClear(void* context);
+ViStatus RsCoreInt_ReplaySetAttribute(void* context, ViAttr attributeName, ViAttrState attributeValue);
+ViStatus RsCoreInt_ReplayGetAttribute(void* context, ViAttr attributeName, void* attributeValue);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- INTERNAL Warm session pool and identity snapshot ------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+void RsCoreInt_SessionPoolTake(ViRsrc resourceName, ViBoolean simulate, RsCoreSessionPtr* rsSession);
+ViStatus RsCoreInt_LoadIdentitySnapshot(RsCoreSessionPtr rsSession);
+ViStatus RsCoreInt_SaveIdentitySnapshot(RsCoreSessionPtr rsSession);
+
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
 ---- INTERNAL VISA IO Helpers ------------------------------------------------------------------------*
@@ -556,6 +830,9 @@ ViStatus RsCoreInt_ReadBinaryDataBlock(ViSession instrSession,
 ---- INTERNAL VISA IO R/W with OPC sync --------------------------------------------------------------*
 ------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
+ViStatus RsCoreInt_BuildOpcCommand(ViSession instrSession, ViConstString command, ViChar* buffer, ViChar** dynBuffer,
+                                   ViChar** sendBuffer);
+
 ViStatus RsCoreInt_WriteWithOpc(ViSession instrSession, ViConstString command,
                                 ViBoolean allowCheckStatus, ViInt32 opcTimeoutMs);
 
@@ -570,6 +847,8 @@ ViStatus RsCoreInt_QueryBinaryDataBlockWithOpc(ViSession instrSession, ViConstSt
                                                ViBoolean allowCheckStatus,
                                                ViInt32 opcTimeoutMs, ViByte** outBinDataBlock, ViInt64* blockSize);
 
+ViStatus RsCoreInt_CompleteOpcHandle(RsCoreOpcHandlePtr handle, ViStatus opcStatus);
+
 /*****************************************************************************************************/
 /*  Resource managing
 ******************************************************************************************************/
@@ -579,11 +858,79 @@ ViStatus RsCoreInt_QueryBinaryDataBlockWithOpc(ViSession instrSession, ViConstSt
 static RsCoreSessionPtr gSessionsList[MAX_NUMBER_OF_SESSIONS];
 static ViInt32 gSessionsCount = -1; // Tracks the number of active sessions. -1 means not initialized yet
 
-// The last global error that occured. Used in RsCore_GetError in case the instrSession is invalid
-static ViStatus gPrimaryError;
-static ViStatus gSecondaryError;
-static ViChar* gErrorElaboration = NULL;
+// Changes with every add / remove of a session, invalidates the gThreadSessionCache of all threads
+static volatile ViUInt32 gSessionsGeneration = 1;
+static RS_THREAD_LOCAL RsCoreThreadSessionCache gThreadSessionCache;
+
+// The last error that occured in the calling thread. Used in RsCore_GetError in case the instrSession is invalid.
+// Each thread records its own errors without locking, so the parallel sessions do not overwrite each other's diagnostics
+static RS_THREAD_LOCAL RsCoreThreadErrorInfo gThreadError;
+#if defined (__linux__)
+// Linux: the global mutex is a static recursive mutex, initialized once by the first RsCoreInt_MutexLock()
+static pthread_mutex_t gMutexObject;
+static pthread_once_t gMutexOnce = PTHREAD_ONCE_INIT;
+static MUTEX gMutex = &gMutexObject;
+#else
 static MUTEX gMutex = NULL;
+#endif
+
+// Available IO transports, selected with the option string token 'Transport'
+static const RsCoreTransport gSocketTransport = {
+	"socket",
+	RsCoreInt_SocketOpen,
+	RsCoreInt_SocketClose,
+	RsCoreInt_SocketWrite,
+	RsCoreInt_SocketRead,
+	RsCoreInt_SocketReadStb,
+	RsCoreInt_SocketClear,
+	RsCoreInt_SocketSetAttribute,
+	RsCoreInt_SocketGetAttribute
+};
+
+static const RsCoreTransport gRecordTransport = {
+	"record",
+	RsCoreInt_RecordOpen,
+	RsCoreInt_RecordClose,
+	RsCoreInt_RecordWrite,
+	RsCoreInt_RecordRead,
+	RsCoreInt_RecordReadStb,
+	RsCoreInt_RecordClear,
+	RsCoreInt_RecordSetAttribute,
+	RsCoreInt_RecordGetAttribute
+};
+
+static const RsCoreTransport gReplayTransport = {
+	"replay",
+	RsCoreInt_ReplayOpen,
+	RsCoreInt_ReplayClose,
+	RsCoreInt_ReplayWrite,
+	RsCoreInt_ReplayRead,
+	RsCoreInt_ReplayReadStb,
+	RsCoreInt_ReplayClear,
+	RsCoreInt_ReplaySetAttribute,
+	RsCoreInt_ReplayGetAttribute
+};
+
+// Inner transport of the record transport only. 'Transport=VISA' sessions call VISA directly
+static const RsCoreTransport gVisaTransport = {
+	"visa",
+	RsCoreInt_VisaOpen,
+	RsCoreInt_VisaClose,
+	RsCoreInt_VisaWrite,
+	RsCoreInt_VisaRead,
+	RsCoreInt_VisaReadStb,
+	RsCoreInt_VisaClear,
+	RsCoreInt_VisaSetAttribute,
+	RsCoreInt_VisaGetAttribute
+};
+
+static const RsCoreTransport* gTransports[] = {&gSocketTransport, &gRecordTransport, &gReplayTransport, NULL};
+static ViInt32 gTransportSessionsCount = 0; // Number of open sessions with a transport. If 0, the IO goes directly to VISA
+
+// Memory allocators. Sessions use the process allocator, or a registered one selected with the option string token 'Allocator'
+static const RsCoreAllocator* gAllocator = NULL; // Process allocator set by RsCore_SetAllocator, NULL for the C runtime
+static const RsCoreAllocator* gAllocators[RS_MAX_ALLOCATORS + 1] = {NULL}; // Allocators registered by RsCore_RegisterAllocator
+static ViInt32 gAllocatorSessionsCount = 0; // Number of open sessions with other than the process allocator. If 0, no session lookup is needed
 
 /*****************************************************************************************************/
 /*  Internal MACROS
@@ -593,6 +940,33 @@ static MUTEX gMutex = NULL;
 
 #define attrHasNotFlag(flag) ((attr->flags & (flag)) == 0)
 
+// Lock-free primitives of the IO trace and the transport sessions count
+// RsCoreInt_AtomicIncrement returns the incremented value
+// RsCoreInt_AtomicDecrement decrements the value
+// RsCoreInt_AtomicLoad reads the value written by the atomic operations of other threads
+// RsCoreInt_WriteBarrier orders the preceding stores before the following stores
+// RsCoreInt_ReadBarrier orders the preceding loads before the following loads
+#if defined(_MSC_VER)
+#define RsCoreInt_AtomicIncrement(value) ((ViUInt32)InterlockedIncrement((volatile LONG*)(value)))
+#define RsCoreInt_AtomicDecrement(value) ((void)InterlockedDecrement((volatile LONG*)(value)))
+#define RsCoreInt_AtomicLoad(value) InterlockedCompareExchange((volatile LONG*)(value), 0, 0)
+#define RsCoreInt_WriteBarrier() MemoryBarrier()
+#define RsCoreInt_ReadBarrier() MemoryBarrier()
+#elif defined(__GNUC__) || defined(__clang__)
+#define RsCoreInt_AtomicIncrement(value) __atomic_add_fetch((value), 1U, __ATOMIC_RELAXED)
+#define RsCoreInt_AtomicDecrement(value) ((void)__atomic_sub_fetch((value), 1, __ATOMIC_RELAXED))
+#define RsCoreInt_AtomicLoad(value) __atomic_load_n((value), __ATOMIC_ACQUIRE)
+#define RsCoreInt_WriteBarrier() __atomic_thread_fence(__ATOMIC_RELEASE)
+#define RsCoreInt_ReadBarrier() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#else
+// No atomics available - correct only if the session IO is not used from more threads at the same time
+#define RsCoreInt_AtomicIncrement(value) (++(*(value)))
+#define RsCoreInt_AtomicDecrement(value) ((void)(--(*(value))))
+#define RsCoreInt_AtomicLoad(value) (*(value))
+#define RsCoreInt_WriteBarrier()
+#define RsCoreInt_ReadBarrier()
+#endif
+
 // viCheckErr(status)
 // Assign status to the error variable.
 // If status is negative, pass it to Rs_SetErrorInfo
@@ -606,6 +980,46 @@ static MUTEX gMutex = NULL;
 /*  Multi-thread locks
 *******************************************************************************************************/
 
+#if defined(__linux__)
+/*****************************************************************************************************/
+/*  RsCoreInt_MutexInitRecursive
+    Initializes the pthread mutex as recursive, to match the behaviour of the Windows mutex objects
+******************************************************************************************************/
+static void RsCoreInt_MutexInitRecursive(pthread_mutex_t* mutex)
+{
+	pthread_mutexattr_t attributes;
+
+	pthread_mutexattr_init(&attributes);
+	pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(mutex, &attributes);
+	pthread_mutexattr_destroy(&attributes);
+}
+
+static void RsCoreInt_MutexInitGlobal(void)
+{
+	RsCoreInt_MutexInitRecursive(&gMutexObject);
+}
+#endif
+
+/*****************************************************************************************************/
+/*  RsCoreInt_MutexCreate
+    Creates a new unlocked mutex. Returns NULL on failure
+******************************************************************************************************/
+MUTEX RsCoreInt_MutexCreate(void)
+{
+#if defined(ANSI)
+	return CreateMutex(NULL, FALSE, NULL);
+#endif
+#if defined(__linux__)
+	pthread_mutex_t* mutex = (pthread_mutex_t*)malloc(sizeof(pthread_mutex_t));
+
+	if (mutex != NULL)
+		RsCoreInt_MutexInitRecursive(mutex);
+
+	return mutex;
+#endif
+}
+
 /*****************************************************************************************************/
 /*  RsCoreInt_MutexLock
     Initializes and Locks the mutex
@@ -654,8 +1068,13 @@ MUTEX RsCoreInt_MutexLock(MUTEX mutex)
 	return mutex;
 #endif
 #if defined(__linux__)
-	pthread_mutex_lock(gMutex);
-	return gMutex;
+	if (mutex == &gMutexObject)
+		(void)pthread_once(&gMutexOnce, RsCoreInt_MutexInitGlobal);
+	else if (mutex == NULL && (mutex = RsCoreInt_MutexCreate()) == NULL)
+		return NULL;
+
+	pthread_mutex_lock(mutex);
+	return mutex;
 #endif
 }
 
@@ -679,7 +1098,27 @@ void RsCoreInt_MutexUnlock(MUTEX mutex)
 #endif
 
 #if defined(__linux__)
-    pthread_mutex_unlock(gMutex);
+	if (mutex != NULL)
+		pthread_mutex_unlock(mutex);
+#endif
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_MutexDispose
+	Destroys the mutex created by RsCoreInt_MutexCreate or RsCoreInt_MutexLock(NULL). The mutex must not be locked
+******************************************************************************************************/
+void RsCoreInt_MutexDispose(MUTEX mutex)
+{
+	if (mutex == NULL)
+		return;
+
+#if defined(ANSI)
+	(void)CloseHandle(mutex);
+#endif
+
+#if defined(__linux__)
+	pthread_mutex_destroy(mutex);
+	free(mutex);
 #endif
 }
 
@@ -897,6 +1336,51 @@ ViInt32 RsCoreInt_AppendDiscreteRangeTableList(RsCoreRangeTablePtr rangeTable, R
 	return i;
 }
 
+/*****************************************************************************************************/
+/*  RsCoreInt_GetTickCountMs
+    Returns monotonic wall-clock time in milliseconds. Only differences of two values are meaningful.
+    Unlike clock(), the time also advances while the thread sleeps.
+******************************************************************************************************/
+ViReal64 RsCoreInt_GetTickCountMs(void)
+{
+#if defined(ANSI)
+	LARGE_INTEGER frequency, counter;
+
+	(void)QueryPerformanceFrequency(&frequency);
+	(void)QueryPerformanceCounter(&counter);
+	return (ViReal64)counter.QuadPart * 1000.0 / (ViReal64)frequency.QuadPart;
+#else
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ViReal64)ts.tv_sec * 1000.0 + (ViReal64)ts.tv_nsec / 1000000.0;
+#endif
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_GetTickCountNs
+    Returns monotonic wall-clock time in nanoseconds. Only differences of two values are meaningful.
+******************************************************************************************************/
+ViUInt64 RsCoreInt_GetTickCountNs(void)
+{
+#if defined(ANSI)
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+
+	if (frequency.QuadPart == 0)
+		(void)QueryPerformanceFrequency(&frequency);
+
+	(void)QueryPerformanceCounter(&counter);
+	return (ViUInt64)(counter.QuadPart / frequency.QuadPart) * 1000000000ULL +
+	       (ViUInt64)(counter.QuadPart % frequency.QuadPart) * 1000000000ULL / (ViUInt64)frequency.QuadPart;
+#else
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ViUInt64)ts.tv_sec * 1000000000ULL + (ViUInt64)ts.tv_nsec;
+#endif
+}
+
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
@@ -916,9 +1400,9 @@ ViInt32 RsCoreInt_SessionsListGetCount(void)
 /*****************************************************************************************************/
 /*  RsCoreInt_SessionsListAddSession
     Internal function that initializes new RsCoreSession structure
-    and adds it into the gSessionsList
+    and adds it into the gSessionsList. The structure and all the session buffers come from the allocator
 ******************************************************************************************************/
-ViStatus RsCoreInt_SessionsListAddSession(ViRsrc resourceName, RsCoreSessionPtr* rsSessionNew)
+ViStatus RsCoreInt_SessionsListAddSession(ViRsrc resourceName, const RsCoreAllocator* allocator, RsCoreSessionPtr* rsSessionNew)
 {
 	ViStatus error = VI_SUCCESS;
 	ViInt32 idx;
@@ -965,13 +1449,18 @@ ViStatus RsCoreInt_SessionsListAddSession(ViRsrc resourceName, RsCoreSessionPtr*
 			"to enter 'ReuseSession = 1'");
 	}
 
-	if ((rsSession = (RsCoreSessionPtr)calloc(1, sizeof(RsCoreSession))) == NULL)
+	if ((rsSession = (RsCoreSessionPtr)RsCoreInt_Calloc(allocator, 1, sizeof(RsCoreSession))) == NULL)
 	{
 		checkErr(RS_ERROR_ALLOC);
 	}
 
 	gSessionsList[emptySlotIdx] = rsSession;
+	gSessionsGeneration++;
 	rsSession->sessionsListIndex = emptySlotIdx;
+	rsSession->allocator = allocator;
+	if (allocator != gAllocator)
+		gAllocatorSessionsCount++;
+
 	gSessionsCount++;
 
 	*rsSessionNew = rsSession;
@@ -992,7 +1481,11 @@ ViStatus RsCoreInt_SessionsListDeleteSession(ViSession instrSession)
 	{
 		if (gSessionsList[idx] != NULL && gSessionsList[idx]->io == instrSession)
 		{
-			free(gSessionsList[idx]);
+			if (gSessionsList[idx]->allocator != gAllocator && gAllocatorSessionsCount > 0)
+				gAllocatorSessionsCount--;
+
+			gSessionsGeneration++;
+			RsCoreInt_Free(gSessionsList[idx]->allocator, gSessionsList[idx]);
 			gSessionsList[idx] = NULL;
 
 			if (gSessionsCount > 0)
@@ -1071,39 +1564,34 @@ ViStatus RsCoreInt_SessionsListGetUniqueHandle(ViPSession instrSession)
 
 /*****************************************************************************************************/
 /*  RsCoreInt_SetGlobalErrorInfo
-    Sets the global error information
+    Sets the global error information of the calling thread. No locking, no allocation
 ******************************************************************************************************/
 ViStatus RsCoreInt_SetGlobalErrorInfo(ViStatus primaryError, ViStatus secondaryError, ViConstString errorElab)
 {
-	ViStatus error = VI_SUCCESS;
-
-	gPrimaryError = primaryError;
-	gSecondaryError = secondaryError;
-
-	if (gErrorElaboration == NULL)
-	checkAlloc(gErrorElaboration = (ViChar*)calloc(RS_MAX_MESSAGE_BUF_SIZE, 1));
+	gThreadError.primaryError = primaryError;
+	gThreadError.secondaryError = secondaryError;
+	gThreadError.context.pending = VI_FALSE;
+	RsCoreInt_StrcpyMaxLen(gThreadError.errorElaboration, RS_MAX_MESSAGE_BUF_SIZE, errorElab);
 
-	RsCoreInt_StrcpyMaxLen(gErrorElaboration, RS_MAX_MESSAGE_BUF_SIZE, errorElab);
-
-Error:
-	return error;
+	return VI_SUCCESS;
 }
 
 /*****************************************************************************************************/
 /*  RsCoreInt_GetGlobalErrorInfo
-    Gets the global error information. errorElab buffer needs maximum of RS_MAX_MESSAGE_BUF_SIZE
+    Gets the global error information of the calling thread. errorElab buffer needs maximum of RS_MAX_MESSAGE_BUF_SIZE
+    The pending error context is formatted here
 ******************************************************************************************************/
 ViStatus RsCoreInt_GetGlobalErrorInfo(ViStatus* primaryError, ViStatus* secondaryError, ViChar* errorElab)
 {
 	ViStatus error = VI_SUCCESS;
 
-	*primaryError = gPrimaryError;
-	*secondaryError = gSecondaryError;
+	*primaryError = gThreadError.primaryError;
+	*secondaryError = gThreadError.secondaryError;
 
-	if (gErrorElaboration != NULL)
-		RsCoreInt_StrcpyMaxLen(errorElab, RS_MAX_MESSAGE_BUF_SIZE, gErrorElaboration);
+	if (gThreadError.context.pending == VI_TRUE)
+		RsCoreInt_FormatErrorContext(NULL, &gThreadError.context, gThreadError.errorElaboration, RS_MAX_MESSAGE_BUF_SIZE, errorElab);
 	else
-		RsCoreInt_StrcpyMaxLen(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "");
+		RsCoreInt_StrcpyMaxLen(errorElab, RS_MAX_MESSAGE_BUF_SIZE, gThreadError.errorElaboration);
 
 	return error;
 }
@@ -1117,6 +1605,7 @@ ViStatus RsCoreInt_GetGlobalErrorInfo(ViStatus* primaryError, ViStatus* secondar
 /*****************************************************************************************************/
 /*  RsCoreInt_SetErrorInfoAttr
     Same as RsCore_SetErrorInfo, but adds the attribute info at the beginning
+    The attribute info is added only when the error info is read
 ******************************************************************************************************/
 ViStatus RsCoreInt_SetErrorInfoAttr(ViSession instrSession,
                                     RsCoreAttributePtr attr,
@@ -1124,18 +1613,164 @@ ViStatus RsCoreInt_SetErrorInfoAttr(ViSession instrSession,
                                     ViStatus primaryError,
                                     ViStatus secondaryError,
                                     ViConstString errorElab)
+{
+	RsCoreErrorContext context;
+
+	if (attr == NULL)
+		return RsCore_SetErrorInfo(instrSession, overWrite, primaryError, secondaryError, errorElab);
+
+	memset(&context, 0, sizeof(RsCoreErrorContext));
+	context.pending = VI_TRUE;
+	context.attributeId = attr->constant;
+
+	return RsCoreInt_SetErrorRecord(instrSession, overWrite, primaryError, secondaryError, &context, errorElab);
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_SetErrorRecord
+    Common part of RsCore_SetErrorInfo and RsCore_SetErrorContext
+    The context is NULL for the already formatted errorElab, otherwise the errorElab is the context text
+******************************************************************************************************/
+ViStatus RsCoreInt_SetErrorRecord(ViSession instrSession,
+                                  ViBoolean overWrite,
+                                  ViStatus primaryError,
+                                  ViStatus secondaryError,
+                                  const RsCoreErrorContext* context,
+                                  ViConstString errorElab)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar message[RS_MAX_MESSAGE_BUF_SIZE];
-	ViChar* ptr;
+	RsCoreSessionPtr rsSession = NULL;
+
+	(void)RsCore_GetRsSession(instrSession, &rsSession);
+
+	if (rsSession == NULL)
+	{
+		if (overWrite == VI_TRUE || ((gThreadError.primaryError >= VI_SUCCESS) && (primaryError < VI_SUCCESS)))
+		{
+			RsCoreInt_SetGlobalErrorInfo(primaryError, secondaryError, errorElab);
+			if (context != NULL)
+				gThreadError.context = *context;
+
+			return primaryError;
+		}
 
-	ptr = RsCoreInt_GetAttrInfoString(attr, RS_MAX_MESSAGE_BUF_SIZE, message);
-	snprintf(ptr, RS_MAX_MESSAGE_BUF_SIZE - (ptr - message) - 1, " - %s", errorElab);
-	error = RsCore_SetErrorInfo(instrSession, overWrite, primaryError, secondaryError, message);
+		return VI_ERROR_INV_OBJECT;
+	}
+
+	if (overWrite == VI_TRUE || (((rsSession->primaryError >= VI_SUCCESS) && (primaryError < VI_SUCCESS))))
+	{
+		// Set the values to the rsSession structure
+		rsSession->primaryError = primaryError;
+		rsSession->secondaryError = secondaryError;
+		RsCoreInt_StrcpyMaxLen(rsSession->errorElaboration, RS_MAX_MESSAGE_BUF_SIZE, errorElab);
+		rsSession->errorContext.pending = VI_FALSE;
+		if (context != NULL)
+			rsSession->errorContext = *context;
+
+		// Set the values to the attributes. The pending elaboration is set by RsCoreInt_ResolveErrorContext
+		(void)RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_PRIMARY_ERROR, 0, primaryError);
+		(void)RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_SECONDARY_ERROR, 0, secondaryError);
+		if (context == NULL)
+			(void)RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_ERROR_ELABORATION, 0, errorElab);
+
+		(void)RsCoreInt_SetGlobalErrorInfo(primaryError, secondaryError, errorElab);
+		if (context != NULL)
+			gThreadError.context = *context;
+	}
 
 	return error;
 }
 
+/*****************************************************************************************************/
+/*  RsCoreInt_AddErrorAttribute
+    Adds the attribute info at the beginning of the current session error elaboration, when it is read
+    If the current elaboration already waits for another attribute info (nested attribute calls),
+    that one is formatted first, so both are reported
+******************************************************************************************************/
+void RsCoreInt_AddErrorAttribute(ViSession instrSession, RsCoreAttributePtr attr)
+{
+	RsCoreSessionPtr rsSession = NULL;
+
+	(void)RsCore_GetRsSession(instrSession, &rsSession);
+	if (rsSession == NULL || attr == NULL || rsSession->primaryError == VI_SUCCESS)
+		return;
+
+	if (rsSession->errorContext.pending == VI_TRUE && rsSession->errorContext.attributeId != 0)
+		RsCoreInt_ResolveErrorContext(rsSession);
+
+	if (rsSession->errorContext.pending == VI_FALSE)
+	{
+		memset(&rsSession->errorContext, 0, sizeof(RsCoreErrorContext));
+		rsSession->errorContext.pending = VI_TRUE;
+	}
+
+	rsSession->errorContext.attributeId = attr->constant;
+
+	(void)RsCoreInt_SetGlobalErrorInfo(rsSession->primaryError, rsSession->secondaryError, rsSession->errorElaboration);
+	gThreadError.context = rsSession->errorContext;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_ResolveErrorContext
+    Formats the pending error context of the session to its errorElaboration
+******************************************************************************************************/
+void RsCoreInt_ResolveErrorContext(RsCoreSessionPtr rsSession)
+{
+	if (rsSession == NULL || rsSession->errorContext.pending == VI_FALSE)
+		return;
+
+	RsCoreInt_FormatErrorContext(rsSession, &rsSession->errorContext, rsSession->errorElaboration, RS_MAX_MESSAGE_BUF_SIZE,
+	                             rsSession->errorElaboration);
+	rsSession->errorContext.pending = VI_FALSE;
+	(void)RsCore_SetAttributeViString(rsSession->io, NULL, RS_ATTR_ERROR_ELABORATION, 0, rsSession->errorElaboration);
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_FormatErrorContext
+    Formats the error context to the elaboration string. The text is used if the context has no format.
+    The text and the elaboration can be the same buffer.
+    Without the rsSession (global error info), the attribute info is only the attribute ID
+******************************************************************************************************/
+void RsCoreInt_FormatErrorContext(RsCoreSessionPtr rsSession, const RsCoreErrorContext* context, ViConstString text,
+                                  ViInt32 bufferSize, ViChar* elaboration)
+{
+	ViChar message[RS_MAX_MESSAGE_BUF_SIZE] = "";
+	RsCoreAttributePtr attr = NULL;
+	ViChar* ptr = message;
+	ViInt32 idx;
+
+	if (context->attributeId != 0)
+	{
+		for (idx = 0; rsSession != NULL && idx < rsSession->attributesCount; idx++)
+		{
+			if ((ViAttr)rsSession->attributes[idx].constant == context->attributeId)
+			{
+				attr = &rsSession->attributes[idx];
+				break;
+			}
+		}
+
+		if (attr != NULL)
+			ptr = RsCoreInt_GetAttrInfoString(attr, RS_MAX_MESSAGE_BUF_SIZE, message);
+		else
+			ptr += snprintf(message, RS_MAX_MESSAGE_BUF_SIZE, "Attribute ID " _PERCU, (ViUInt32)context->attributeId);
+
+		RsCoreInt_StrcpyMaxLen(ptr, RS_MAX_MESSAGE_BUF_SIZE - (ViInt32)(ptr - message), " - ");
+		ptr += strlen(ptr);
+	}
+
+	if (context->format != NULL)
+	{
+		snprintf(ptr, RS_MAX_MESSAGE_BUF_SIZE - (ptr - message), context->format, context->args[0], context->args[1], context->args[2]);
+	}
+	else
+	{
+		RsCoreInt_StrcpyMaxLen(ptr, RS_MAX_MESSAGE_BUF_SIZE - (ViInt32)(ptr - message), text);
+	}
+
+	RsCoreInt_StrcpyMaxLen(elaboration, bufferSize, message);
+}
+
 /*****************************************************************************************************/
 /*  RsCoreInt_CheckErrorElaboration
     Check the current error elaboration for the entered pattern
@@ -1146,6 +1781,7 @@ ViStatus RsCoreInt_CheckErrorElaboration(ViSession instrSession, ViConstString p
 	RsCoreSessionPtr rsSession;
 
 	(void)RsCore_GetRsSession(instrSession, &rsSession);
+	RsCoreInt_ResolveErrorContext(rsSession);
 
 	*patternFound = (strstr(rsSession->errorElaboration, pattern) != NULL) ? VI_TRUE : VI_FALSE;
 
@@ -1398,8 +2034,12 @@ Error:
     Parses the option string only for specific tokens - the ones needed before opening a session
     - Simulate
     - ReuseSession
+    - SessionPool
+    - Transport
+    - Allocator
 ******************************************************************************************************/
-ViStatus RsCoreInt_ParseOptionsBefore(ViConstString optionsString, ViPBoolean simulate, ViPBoolean reuseSession)
+ViStatus RsCoreInt_ParseOptionsBefore(ViConstString optionsString, ViPBoolean simulate, ViPBoolean reuseSession, ViPBoolean sessionPool,
+                                      const RsCoreTransport** transport, const RsCoreAllocator** allocator)
 {
 	ViStatus error = VI_SUCCESS;
 	ViChar token[RS_MAX_MESSAGE_LEN];
@@ -1410,6 +2050,9 @@ ViStatus RsCoreInt_ParseOptionsBefore(ViConstString optionsString, ViPBoolean si
 
 	*simulate = VI_FALSE;
 	*reuseSession = VI_FALSE;
+	*sessionPool = VI_FALSE;
+	*transport = NULL;
+	*allocator = gAllocator;
 
 	if (isNullOrEmpty(optionsString))
 		return error;
@@ -1430,8 +2073,21 @@ ViStatus RsCoreInt_ParseOptionsBefore(ViConstString optionsString, ViPBoolean si
 		{
 			*reuseSession = RsCore_Convert_String_To_Boolean(tokenValue);
 		}
+		else if (strcmp(tokenName, "sessionpool") == 0)
+		{
+			*sessionPool = RsCore_Convert_String_To_Boolean(tokenValue);
+		}
+		else if (strcmp(tokenName, "transport") == 0)
+		{
+			checkErr(RsCoreInt_FindTransport(tokenValue, transport));
+		}
+		else if (strcmp(tokenName, "allocator") == 0)
+		{
+			checkErr(RsCoreInt_FindAllocator(tokenValue, allocator));
+		}
 	}
 
+Error:
 	return error;
 }
 
@@ -1440,20 +2096,39 @@ ViStatus RsCoreInt_ParseOptionsBefore(ViConstString optionsString, ViPBoolean si
     Initializes a new VISA session, or if reuseSession is TRUE, it potentially uses the existing one with the same resourceName
     In case of a successful reuse, the function just returns the existing instrSession.
     The reused session type overrides the entered parameter 'simulate'.
-******************************************************************************************************/
-ViStatus RsCoreInt_InitOrReuseSession(ViRsrc resourceName, RsCoreAttributePtr* attrList, ViBoolean simulate, ViBoolean reuseSession,
-                                      ViPSession instrSessionNew)
+    If the transport is not NULL, the session uses it for the IO instead of VISA.
+    The allocator is used for all the buffers of the new session, a reused session keeps its allocator.
+    If sessionPool is TRUE, a session with the same resourceName parked in the warm session pool is taken over first.
+    The gMutex is only held for the lookup of the existing sessions and for the handle reservation,
+    the opening of the IO session runs unlocked, so the inits of different resources run in parallel.
+******************************************************************************************************/
+ViStatus RsCoreInt_InitOrReuseSession(ViRsrc resourceName, ViConstString optionsString, RsCoreAttributePtr* attrList, ViBoolean simulate,
+                                      ViBoolean reuseSession, ViBoolean sessionPool, const RsCoreTransport* transport,
+                                      const RsCoreAllocator* allocator, ViPSession instrSessionNew)
 {
 	ViStatus error = VI_SUCCESS;
 	ViChar errorElab[RS_MAX_MESSAGE_LEN];
 	RsCoreAttributePtr attr;
 	ViSession instrSession, rmSession;
+	void* transportContext = NULL;
 	ViInt32 attributesCount;
-	ViInt32 dataSize;
 	ViInt32 idx;
+	ViBoolean locked;
 	RsCoreSessionPtr rsSession = NULL;
 
 	gMutex = RsCoreInt_MutexLock(gMutex);
+	locked = VI_TRUE;
+
+	if (sessionPool)
+	{
+		RsCoreInt_SessionPoolTake(resourceName, simulate, &rsSession);
+		if (rsSession != NULL)
+		{
+			// take over the warm session
+			*instrSessionNew = rsSession->io;
+			goto Error;
+		}
+	}
 
 	if (reuseSession)
 	{
@@ -1462,27 +2137,58 @@ ViStatus RsCoreInt_InitOrReuseSession(ViRsrc resourceName, RsCoreAttributePtr* a
 		{
 			// reuse the existing session
 			*instrSessionNew = rsSession->io;
+			if (rsSession->parked == VI_TRUE)
+			{
+				rsSession->parked = VI_FALSE;
+				rsSession->warmStart = VI_TRUE;
+			}
+
 			goto Error;
 		}
 	}
 
-	if (!simulate)
+	// Opening of the IO session can take seconds, it runs without the global lock
+	RsCoreInt_MutexUnlock(gMutex);
+	locked = VI_FALSE;
+
+	if (!simulate && transport != NULL)
 	{
 		instrSession = 0;
-		error = viOpenDefaultRM(&rmSession);
+		error = transport->open(resourceName, optionsString, &transportContext);
+		if (error == VI_ERROR_INV_RSRC_NAME)
+		{
+			// The transport already set the elaboration with the invalid part of the resource name
+			goto Error;
+		}
+
 		if (error < VI_SUCCESS)
 		{
 			snprintf(errorElab, RS_MAX_MESSAGE_LEN,
-			         "Opening VISA Resource Manager: Entered resource name: '%s'"
-			         " Make sure your VISA installation is correct.", resourceName);
+			         "Transport '%s' open error: The entered resource name '%s' is invalid or the instrument is not reachable.",
+			         transport->name, resourceName);
 			(void)RsCore_SetErrorInfo(instrSession, VI_TRUE, error, VI_SUCCESS, errorElab);
 			goto Error;
 		}
 
-		error = viOpen(rmSession, resourceName, 0, 0, &instrSession);
-		if (error == VI_ERROR_RSRC_NFOUND || error == VI_ERROR_INV_RSRC_NAME)
-		{
-			// Special handling of the most-common error from the viOpen
+		rmSession = 0;
+	}
+	else if (!simulate)
+	{
+		instrSession = 0;
+		error = viOpenDefaultRM(&rmSession);
+		if (error < VI_SUCCESS)
+		{
+			snprintf(errorElab, RS_MAX_MESSAGE_LEN,
+			         "Opening VISA Resource Manager: Entered resource name: '%s'"
+			         " Make sure your VISA installation is correct.", resourceName);
+			(void)RsCore_SetErrorInfo(instrSession, VI_TRUE, error, VI_SUCCESS, errorElab);
+			goto Error;
+		}
+
+		error = viOpen(rmSession, resourceName, 0, 0, &instrSession);
+		if (error == VI_ERROR_RSRC_NFOUND || error == VI_ERROR_INV_RSRC_NAME)
+		{
+			// Special handling of the most-common error from the viOpen
 			// Unify those two errors into one, because of the differences between RS VISA and NI VISA
 			error = VI_ERROR_RSRC_NFOUND;
 			snprintf(errorElab, RS_MAX_MESSAGE_LEN,
@@ -1495,17 +2201,49 @@ ViStatus RsCoreInt_InitOrReuseSession(ViRsrc resourceName, RsCoreAttributePtr* a
 		if (error < VI_SUCCESS)
 			goto Error;
 	}
-	else
+
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	locked = VI_TRUE;
+
+	if (reuseSession)
+	{
+		// Another thread may have opened the same resource in the meantime
+		checkErr(RsCoreInt_SessionsListExists(resourceName, &rsSession));
+		if (rsSession != NULL)
+		{
+			if (!simulate && transport == NULL)
+			{
+				(void)viClose(instrSession);
+				(void)viClose(rmSession);
+			}
+
+			*instrSessionNew = rsSession->io;
+			goto Error;
+		}
+	}
+
+	if (simulate || transport != NULL)
 	{
+		// The unique handle is reserved by adding the session to the list under the same lock
 		checkErr(RsCoreInt_SessionsListGetUniqueHandle(&instrSession));
-		rmSession = instrSession;
+		rmSession = simulate ? instrSession : 0;
 	}
 
-	checkErr(RsCoreInt_SessionsListAddSession(resourceName, &rsSession));
+	checkErr(RsCoreInt_SessionsListAddSession(resourceName, allocator, &rsSession));
 
 	*instrSessionNew = instrSession;
 	rsSession->io = instrSession;
+	gSessionsGeneration++;
 	rsSession->rmSession = rmSession;
+	rsSession->transport = NULL;
+	rsSession->transportContext = NULL;
+	if (transportContext != NULL)
+	{
+		rsSession->transport = transport;
+		rsSession->transportContext = transportContext;
+		transportContext = NULL;
+		(void)RsCoreInt_AtomicIncrement(&gTransportSessionsCount);
+	}
 	RsCoreInt_StrcpyMaxLen(rsSession->resourceName, RS_MAX_SHORT_MESSAGE_BUF_SIZE, resourceName);
 
 	// Clear the cached attributes table
@@ -1519,54 +2257,25 @@ ViStatus RsCoreInt_InitOrReuseSession(ViRsrc resourceName, RsCoreAttributePtr* a
 
 	rsSession->attributesCount = attributesCount;
 
-	viCheckAllocElab(rsSession->attributes = (RsCoreAttribute *)calloc(attributesCount, sizeof(RsCoreAttribute)),
+	viCheckAllocElab(rsSession->attributes = (RsCoreAttribute *)RsCore_Calloc(instrSession, attributesCount, sizeof(RsCoreAttribute)),
 		"Allocation of memory for Attributes list");
 
-	// Allocate memory for current (cached) value of each attribute and copy statically
-	// declared attribute properties into session-based allocated memory space.
+	// Copy statically declared attribute properties into session-based allocated memory space.
+	// The memory for the current (cached) values is allocated on the first access of each attribute.
 	for (idx = 0; idx < (ViInt32)attributesCount; idx++)
 	{
 		attr = &rsSession->attributes[idx];
 		memcpy(attr, attrList[idx], sizeof(RsCoreAttribute));
-		switch (attr->dataType)
-		{
-		case RS_VAL_INT32:
-			dataSize = sizeof(ViInt32);
-			break;
-		case RS_VAL_INT64:
-			dataSize = sizeof(ViInt64);
-			break;
-		case RS_VAL_REAL64:
-			dataSize = sizeof(ViReal64);
-			break;
-		case RS_VAL_STRING:
-			// For string attribute, allocate minimum of one byte and maximum of its default value + 1
-			dataSize = (attr->stringDefault != NULL) ? (ViInt32)strlen(attr->stringDefault) + 1 : 1;
-			attr->integerDefault = dataSize;
-			break;
-		case RS_VAL_ADDR:
-			dataSize = sizeof(ViAddr);
-			break;
-		case RS_VAL_SESSION:
-			dataSize = sizeof(ViSession);
-			break;
-		case RS_VAL_BOOLEAN:
-			dataSize = sizeof(ViInt32); // alloc 4 bytes instead of Boolean 2 bytes
-			break;
-		case RS_VAL_UNKNOWN_TYPE:
-		default:
-			dataSize = sizeof(void *);
-		}
-
-		attr->p2value = calloc(1, dataSize);
-		if (attr->p2value == NULL)
-		{
-			viCheckErrElab(RS_ERROR_ALLOC, "Allocation of memory for Attribute values");
-		}
+		attr->p2value = NULL;
 	}
 
 Error:
-	RsCoreInt_MutexUnlock(gMutex);
+	if (locked)
+		RsCoreInt_MutexUnlock(gMutex);
+
+	if (transportContext != NULL)
+		transport->close(transportContext);
+
 	if (rsSession == NULL)
 	{
 		*instrSessionNew = 0;
@@ -1620,8 +2329,8 @@ ViStatus RsCoreInt_GetAttributePtr(ViSession instrSession, ViAttr attributeId, R
 				if (cache->allocatedSize == 0)
 				{
 					// Allocate new cache
-					viCheckAlloc(cache->attrs = (RsCoreAttributePtr*)calloc(cacheSizeIncrease, sizeof(RsCoreAttributePtr)));
-					viCheckAlloc(cache->IDs = (ViAttr*)calloc(cacheSizeIncrease, sizeof(ViAttr)));
+					viCheckAlloc(cache->attrs = (RsCoreAttributePtr*)RsCore_Calloc(instrSession, cacheSizeIncrease, sizeof(RsCoreAttributePtr)));
+					viCheckAlloc(cache->IDs = (ViAttr*)RsCore_Calloc(instrSession, cacheSizeIncrease, sizeof(ViAttr)));
 					cache->allocatedSize = cacheSizeIncrease;
 				}
 
@@ -1630,11 +2339,11 @@ ViStatus RsCoreInt_GetAttributePtr(ViSession instrSession, ViAttr attributeId, R
 					// Reallocate cache size
 					cache->allocatedSize = cache->allocatedSize + cacheSizeIncrease;
 					viCheckReallocElab(cache->attrs,
-						(RsCoreAttributePtr*)realloc(cache->attrs, cache->allocatedSize * sizeof(RsCoreAttributePtr)),
+						(RsCoreAttributePtr*)RsCore_Realloc(instrSession, cache->attrs, cache->allocatedSize * sizeof(RsCoreAttributePtr)),
 						"Cache for used attributes cache->attrs");
 
 					viCheckReallocElab(cache->IDs,
-						(ViAttr*)realloc(cache->IDs, cache->allocatedSize * sizeof(ViAttr)),
+						(ViAttr*)RsCore_Realloc(instrSession, cache->IDs, cache->allocatedSize * sizeof(ViAttr)),
 						"Cache for used attributes cache->IDs");
 				}
 
@@ -1657,12 +2366,77 @@ ViStatus RsCoreInt_GetAttributePtr(ViSession instrSession, ViAttr attributeId, R
 		viCheckErrElab(RS_ERROR_ATTRIBUTE_NOT_SUPPORTED, "Attribute is not supported - the flag RS_VAL_NOT_SUPPORTED is set to TRUE");
 	}
 
+	if (attr->p2value == NULL)
+	{
+		checkErr(RsCoreInt_MaterializeAttribute(instrSession, rsSession, attr));
+	}
+
 	*attrOut = attr;
 
 Error:
 	return error;
 }
 
+/*****************************************************************************************************/
+/*  RsCoreInt_MaterializeAttribute
+    Allocates the memory for the current (cached) value of the attribute on its first access.
+    The value starts with the attribute's default if RsCore_ApplyAttributeDefaults was already called
+    for the attribute's group (specific / inherent), otherwise with zeros.
+******************************************************************************************************/
+ViStatus RsCoreInt_MaterializeAttribute(ViSession instrSession, RsCoreSessionPtr rsSession, RsCoreAttributePtr attr)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 dataSize;
+	ViBoolean applyDefault;
+
+	switch (attr->dataType)
+	{
+	case RS_VAL_INT32:
+		dataSize = sizeof(ViInt32);
+		break;
+	case RS_VAL_INT64:
+		dataSize = sizeof(ViInt64);
+		break;
+	case RS_VAL_REAL64:
+		dataSize = sizeof(ViReal64);
+		break;
+	case RS_VAL_STRING:
+		// For string attribute, allocate minimum of one byte and maximum of its default value + 1
+		dataSize = (attr->stringDefault != NULL) ? (ViInt32)strlen(attr->stringDefault) + 1 : 1;
+		attr->integerDefault = dataSize;
+		break;
+	case RS_VAL_ADDR:
+		dataSize = sizeof(ViAddr);
+		break;
+	case RS_VAL_SESSION:
+		dataSize = sizeof(ViSession);
+		break;
+	case RS_VAL_BOOLEAN:
+		dataSize = sizeof(ViInt32); // alloc 4 bytes instead of Boolean 2 bytes
+		break;
+	case RS_VAL_UNKNOWN_TYPE:
+	default:
+		dataSize = sizeof(void *);
+	}
+
+	attr->p2value = RsCore_Calloc(instrSession, 1, dataSize);
+	if (attr->p2value == NULL)
+	{
+		viCheckErrElab(RS_ERROR_ALLOC, "Allocation of memory for Attribute values");
+	}
+
+	if (attr->constant < RS_SPECIFIC_PRIVATE_ATTR_BASE)
+		applyDefault = rsSession->inherentDefaultsApplied;
+	else
+		applyDefault = rsSession->specificDefaultsApplied;
+
+	if (applyDefault == VI_TRUE)
+		RsCoreInt_WriteAttributeDefault(attr);
+
+Error:
+	return error;
+}
+
 #pragma warning ( disable : 4789 )
 /*****************************************************************************************************/
 /*  RsCoreInt_GetAttrP2Value
@@ -1978,11 +2752,16 @@ ViStatus RsCoreInt_SetAttribute(ViSession instrSession,
 		}
 
 		// Allocate a buffer for the casted value, maximum castable variable size is ViReal64
-		viCheckAllocElab(p2CastedValue = calloc(1, sizeof(ViReal64)), "RsCoreInt_SetAttribute: Allocation for casted input value");
+		viCheckAllocElab(p2CastedValue = RsCore_Calloc(instrSession, 1, sizeof(ViReal64)), "RsCoreInt_SetAttribute: Allocation for casted input value");
 		checkErr(RsCoreInt_CastDataType(instrSession, valueDataType, valueIn, attr->dataType, p2CastedValue));
 		p2Value = p2CastedValue;
 	}
 
+	if (attributeId == RS_ATTR_OPC_TIMEOUT && rsSession->roundTrip.enabled == VI_TRUE)
+	{
+		RsCoreInt_RoundTripOpcTimeout(rsSession, attr, *(ViInt32*)p2Value);
+	}
+
 	// User callback completely skips to the cache update
 	if (attr->userCallback)
 	{
@@ -2070,22 +2849,22 @@ UpdateCache:
 
 Error:
 	if (p2CastedValue)
-		free(p2CastedValue);
+		RsCore_Free(instrSession, p2CastedValue);
 	
-	if (error != VI_SUCCESS)
+	if (error == RS_ERROR_INVALID_TYPE)
 	{
+		// Special case for invalid data type, rewrite the message
 		(void)RsCore_GetErrorInfo(instrSession, &primaryError, &secondaryError, errElab);
-		if (error == RS_ERROR_INVALID_TYPE)
-		{
-			// Special case for invalid data type, rewrite the message
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "SetAttribute: The entered data value type '%s' does not match the attribute data type '%s'",
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "SetAttribute: The entered data value type '%s' does not match the attribute data type '%s'",
 				RsCoreInt_GetDataTypeString(valueDataType),
 				RsCoreInt_GetDataTypeString(attr->dataType));
-		}
-		
-		// Add the attribute info to the error message
 		(void)RsCoreInt_SetErrorInfoAttr(instrSession, attr, VI_TRUE, primaryError, secondaryError, errElab);
 	}
+	else if (error != VI_SUCCESS)
+	{
+		// Add the attribute info to the error message
+		RsCoreInt_AddErrorAttribute(instrSession, attr);
+	}
 
 	return error;
 }
@@ -2213,20 +2992,20 @@ SetUserBuffer:
 	}
 
 Error:
-	if (error != VI_SUCCESS)
+	if (error == RS_ERROR_INVALID_TYPE)
 	{
+		// Special case for invalid data type, rewrite the message
 		(void)RsCore_GetErrorInfo(instrSession, &primaryError, &secondaryError, errElab);
-		if (error == RS_ERROR_INVALID_TYPE)
-		{
-			// Special case for invalid data type, rewrite the message
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "GetAttribute: The return data value type '%s' does not match the attribute data type '%s'",
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "GetAttribute: The return data value type '%s' does not match the attribute data type '%s'",
 				RsCoreInt_GetDataTypeString(valueDataType),
 				RsCoreInt_GetDataTypeString(attr->dataType));
-		}
-
-		// Add the attribute info to the error message
 		(void)RsCoreInt_SetErrorInfoAttr(instrSession, attr, VI_TRUE, primaryError, secondaryError, errElab);
 	}
+	else if (error != VI_SUCCESS)
+	{
+		// Add the attribute info to the error message
+		RsCoreInt_AddErrorAttribute(instrSession, attr);
+	}
 
 	return error;
 }
@@ -2287,10 +3066,7 @@ Error:
 	if (error != VI_SUCCESS)
 	{
 		// Add the attribute info to the error message
-		ViChar errorElaboration[RS_MAX_MESSAGE_BUF_SIZE];
-		ViStatus primaryError, secondaryError;
-		(void)RsCore_GetErrorInfo(instrSession, &primaryError, &secondaryError, errorElaboration);
-		(void)RsCoreInt_SetErrorInfoAttr(instrSession, attr, VI_TRUE, primaryError, secondaryError, errorElaboration);
+		RsCoreInt_AddErrorAttribute(instrSession, attr);
 	}
 
 	return error;
@@ -2582,7 +3358,7 @@ ViStatus RsCoreInt_CheckAttrInstrModelAndOptions(ViSession instrSession, RsCoreA
 
 Error:
 	if (instrOptionsListDyn)
-		free(instrOptionsListDyn);
+		RsCore_Free(instrSession, instrOptionsListDyn);
 
 	return error;
 }
@@ -2654,7 +3430,7 @@ ViStatus RsCoreInt_QueryAttrCommandUni(ViSession instrSession, RsCoreAttributePt
 
 Error:
 	if (dynQuery)
-		free(dynQuery);
+		RsCore_Free(instrSession, dynQuery);
 
 	return error;
 }
@@ -2683,22 +3459,22 @@ ViStatus RsCoreInt_DisposeRepCapTable(ViSession instrSession)
 		{
 			if (rsSession->repCapTables[i].repCapNameId)
 			{
-				free(rsSession->repCapTables[i].repCapNameId);
+				RsCore_Free(instrSession, rsSession->repCapTables[i].repCapNameId);
 				rsSession->repCapTables[i].repCapNameId = NULL;
 			}
 			if (rsSession->repCapTables[i].cmdValues)
 			{
-				free(rsSession->repCapTables[i].cmdValues);
+				RsCore_Free(instrSession, rsSession->repCapTables[i].cmdValues);
 				rsSession->repCapTables[i].cmdValues = NULL;
 			}
 			if (rsSession->repCapTables[i].repCapNames)
 			{
-				free(rsSession->repCapTables[i].repCapNames);
+				RsCore_Free(instrSession, rsSession->repCapTables[i].repCapNames);
 				rsSession->repCapTables[i].repCapNames = NULL;
 			}
 		}
 
-		free(rsSession->repCapTables);
+		RsCore_Free(instrSession, rsSession->repCapTables);
 		rsSession->repCapTables = NULL;
 	}
 Error:
@@ -3021,2734 +3797,3217 @@ Error:
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
----- INTERNAL VISA IO Helpers ------------------------------------------------------------------------*
+---- INTERNAL IO Transport ---------------------------------------------------------------------------*
 ------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
 
 /*****************************************************************************************************/
-/*  RsCoreInt_PollingDelay
-    Generates progressive OPC polling delay depending on the selected mode
+/*  RsCoreInt_FindTransport
+    Returns the transport with the entered name (case-insensitive)
+    The name 'visa' returns NULL transport, which means the session uses VISA directly
 ******************************************************************************************************/
-void RsCoreInt_PollingDelay(ViReal64 elapsedTimeMs, ViInt32 opcWaitMode)
+ViStatus RsCoreInt_FindTransport(ViConstString transportName, const RsCoreTransport** transport)
 {
-	switch (opcWaitMode)
-	{
-	case RS_VAL_OPCWAIT_STBPOLLINGSLOW:
-		if (elapsedTimeMs < 10.0)
-			Sleep(1);
-		else if (elapsedTimeMs < 1000.0)
-			Sleep(20);
-		else if (elapsedTimeMs < 5000.0)
-			Sleep(100);
-		else if (elapsedTimeMs < 10000.0)
-			Sleep(200);
-		else if (elapsedTimeMs < 20000.0)
-			Sleep(500);
-		else
-			Sleep(1000);
-		break;
+	ViStatus error = VI_SUCCESS;
+	ViChar name[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 idx;
 
-	case RS_VAL_OPCWAIT_STBPOLLINGSUPERSLOW:
-		if (elapsedTimeMs < 1000.0)
-			Sleep(100);
-		else if (elapsedTimeMs < 10000.0)
-			Sleep(500);
-		else if (elapsedTimeMs < 20000.0)
-			Sleep(1000);
-		else
-			Sleep(2000);
-		break;
+	*transport = NULL;
+	RsCoreInt_StrcpyMaxLen(name, RS_MAX_SHORT_MESSAGE_BUF_SIZE, transportName);
+	RsCore_TrimString(name, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+	RsCoreInt_ToLowerCase(name);
+	if (strcmp(name, "visa") == 0)
+		return error;
 
-	default: // RS_VAL_OPCWAIT_STBPOLLING
-		if (elapsedTimeMs < 10.0);
-		else if (elapsedTimeMs < 100.0)
-			Sleep(5);
-		else if (elapsedTimeMs < 1000.0)
-			Sleep(20);
-		else if (elapsedTimeMs < 5000.0)
-			Sleep(50);
-		else if (elapsedTimeMs < 10000.0)
-			Sleep(100);
-		else if (elapsedTimeMs < 50000.0)
-			Sleep(500);
-		else
-			Sleep(1000);
-		break;
+	for (idx = 0; gTransports[idx] != NULL; idx++)
+	{
+		if (strcmp(name, gTransports[idx]->name) == 0)
+		{
+			*transport = gTransports[idx];
+			return error;
+		}
 	}
+
+	snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+	         "Option string token 'Transport', value '%s' is unrecognised. Defined values: 'VISA / Socket / Record / Replay'", transportName);
+	(void)RsCoreInt_SetGlobalErrorInfo(RS_ERROR_INVALID_VALUE, VI_SUCCESS, errorElab);
+	error = RS_ERROR_INVALID_VALUE;
+
+	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_GetVisaInfo
-    Returns used VISA info string
+/*  RsCoreInt_GetTransport
+    Returns VI_TRUE if the session uses a transport, and the transport with its instance data
+    Sessions without a transport (or unknown sessions) use VISA directly
 ******************************************************************************************************/
-ViStatus RsCoreInt_GetVisaInfo(ViSession instrSession, ViInt32 bufferSize, ViChar* visaInfo)
+ViBoolean RsCoreInt_GetTransport(ViSession instrSession, const RsCoreTransport** transport, void** context)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar manufacturer[RS_MAX_MESSAGE_BUF_SIZE];
-	ViInt32 version;
+	RsCoreSessionPtr rsSession = NULL;
 
-	if (RsCore_Simulating(instrSession) == VI_TRUE)
-	{
-		RsCoreInt_StrcpyMaxLen(visaInfo, bufferSize, "Rohde & Schwarz Visa 5.8.5");
-		return error;
-	}
+	*transport = NULL;
+	*context = NULL;
 
-	checkErr(viGetAttribute(instrSession, VI_ATTR_RSRC_MANF_NAME, manufacturer));
-	checkErr(viGetAttribute(instrSession, VI_ATTR_RSRC_IMPL_VERSION, &version));
-	snprintf(visaInfo, bufferSize, "%s VISA %0.2f", manufacturer,
-	         (ViReal64)(version >> 20) * 100 +
-	         (ViReal64)((version >> 8) & 0xFFF) * 10 +
-	         (ViReal64)(version & 0xFF) / 100.0);
+	// Fast path - no session with a transport is open. The count changes under the gMutex, read it atomically
+	if (RsCoreInt_AtomicLoad(&gTransportSessionsCount) == 0)
+		return VI_FALSE;
 
-Error:
-	return error;
+	if (RsCore_GetRsSession(instrSession, &rsSession) < VI_SUCCESS || rsSession->transport == NULL)
+		return VI_FALSE;
+
+	*transport = rsSession->transport;
+	*context = rsSession->transportContext;
+
+	return VI_TRUE;
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_GetSessionType
-    Returns the session type based on which the core makes different operations
+/*  RsCoreInt_GetIoSession
+    Returns the session for the IO wrappers, or NULL if the instrSession is not a known session
+    (e.g. the VISA session during the session creation). Such IO uses VISA directly and is not traced
 ******************************************************************************************************/
-ViStatus RsCoreInt_GetSessionType(ViSession instrSession, RsCoreSessionType* sessionType)
+RsCoreSessionPtr RsCoreInt_GetIoSession(ViSession instrSession)
 {
-	ViStatus error = VI_SUCCESS;
-	ViUInt16 intf;
-	ViChar rsrcClass[256] = "";
+	RsCoreSessionPtr rsSession = NULL;
 
-	checkErr(viGetAttribute(instrSession, VI_ATTR_INTF_TYPE, &intf));
-	switch (intf)
-	{
-	case VI_INTF_TCPIP:
-		checkErr(viGetAttribute(instrSession, VI_ATTR_RSRC_CLASS, rsrcClass));
-		if (strcmp(rsrcClass, "SOCKET") == 0)
-			*sessionType = RS_INTF_SOCKET;
-		else
-			*sessionType = RS_INTF_TCPIP;
+	(void)RsCore_GetRsSession(instrSession, &rsSession);
 
-		break;
+	return rsSession;
+}
 
-	case VI_INTF_GPIB:
-	case VI_INTF_GPIB_VXI:
-		*sessionType = RS_INTF_GPIB;
-		break;
+/*****************************************************************************************************/
+/*  RsCoreInt_IoTraceBegin
+    Claims a new entry in the session IO trace and records the start of the operation
+    For writes, the segments are the written data; for the other operations use NULL
+    Returns the sequence number of the entry for RsCoreInt_IoTraceEnd, 0 if the operation is not traced
+    The entry is visible in the trace already before the operation completes, with the endNs 0
+    With the round-trip diagnostics ON, the operation is also passed to RsCoreInt_RoundTripIo
+******************************************************************************************************/
+ViUInt32 RsCoreInt_IoTraceBegin(RsCoreSessionPtr rsSession, ViInt32 operation, ViUInt32 requestedCount,
+                                const RsCoreIoSegment segments[], ViUInt32 segmentsCount)
+{
+	RsCoreIoTraceEntryPtr entry;
+	ViUInt32 sequence;
+	ViUInt32 idx;
+	ViUInt32 length;
 
-	case VI_INTF_ASRL:
-		*sessionType = RS_INTF_ASRL;
-		break;
+	if (rsSession == NULL)
+		return 0;
 
-	case VI_INTF_USB:
-		*sessionType = RS_INTF_USB;
-		break;
-	default:
-		*sessionType = RS_INTF_UNKNOWN;
+	if (rsSession->roundTrip.enabled == VI_TRUE)
+		RsCoreInt_RoundTripIo(rsSession, operation, segments, segmentsCount);
+
+	sequence = RsCoreInt_AtomicIncrement(&rsSession->ioTrace.head);
+	entry = &rsSession->ioTrace.entries[(sequence - 1) & (RS_IO_TRACE_ENTRIES - 1)];
+
+	entry->sequence = 0;
+	RsCoreInt_WriteBarrier();
+
+	entry->operation = operation;
+	entry->status = VI_SUCCESS;
+	entry->requestedCount = requestedCount;
+	entry->transferredCount = 0;
+	entry->dataLength = 0;
+	entry->startNs = RsCoreInt_GetTickCountNs();
+	entry->endNs = 0;
+
+	for (idx = 0; idx < segmentsCount && entry->dataLength < RS_IO_TRACE_DATA_LEN; idx++)
+	{
+		length = RS_IO_TRACE_DATA_LEN - entry->dataLength;
+		if (segments[idx].count < length)
+			length = segments[idx].count;
+
+		memcpy(entry->data + entry->dataLength, segments[idx].data, length);
+		entry->dataLength += length;
 	}
 
-Error:
-	return error;
+	RsCoreInt_WriteBarrier();
+	entry->sequence = sequence;
+
+	return sequence;
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_SpecifyVisaError
-    Describes VISA error in more details
-******************************************************************************************************/
-ViStatus RsCoreInt_SpecifyVisaError(ViSession instrSession, ViStatus error, ViConstString context, ViConstString sentCmd)
+/*  RsCoreInt_IoTraceEnd
+    Records the result of the operation started with RsCoreInt_IoTraceBegin
+    For reads, the data is the read response; for the other operations use NULL
+    The IO duration is added to the latency of the driver function in progress
+    If the entry was meanwhile reused by newer operations, nothing is recorded
+******************************************************************************************************/
+void RsCoreInt_IoTraceEnd(RsCoreSessionPtr rsSession, ViUInt32 sequence, ViStatus status, ViUInt32 transferredCount,
+                          ViConstBuf data, ViUInt32 dataCount)
 {
-	ViUInt32 visaTimeoutMs = 10000;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	ViChar cmdString[RS_MAX_MESSAGE_BUF_SIZE] = "";
-	ViBoolean patternFound;
+	RsCoreIoTraceEntryPtr entry;
 
-	if (error == VI_SUCCESS)
-		return error;
+	if (sequence == 0)
+		return;
 
-	if (error == VI_ERROR_TMO)
-	{
-		// VISA timeout error, specify it more
-		// But only if it has not been more specified before
-		(void)RsCoreInt_CheckErrorElaboration(instrSession, "VISA Read resulted in timeout", &patternFound);
-		if (patternFound)
-			return error;
+	entry = &rsSession->ioTrace.entries[(sequence - 1) & (RS_IO_TRACE_ENTRIES - 1)];
+	if (entry->sequence != sequence)
+		return;
 
-		(void)RsCoreInt_CheckErrorElaboration(instrSession, "Waiting for OPC resulted in timeout", &patternFound);
-		if (patternFound)
-			return error;
+	entry->sequence = 0;
+	RsCoreInt_WriteBarrier();
 
-		(void)RsCore_GetVisaTimeout(instrSession, &visaTimeoutMs);
-		if (!isNullOrEmpty(sentCmd))
-		{
-			RsCoreInt_StrcpyMaxLen(cmdString, RS_MAX_MESSAGE_BUF_SIZE, sentCmd);
-			RsCore_TrimString(cmdString, RS_VAL_TRIM_WHITESPACES);
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, " Sent command: \"%s\". ", cmdString);
-			RsCoreInt_StrcpyMaxLen(cmdString, RS_MAX_MESSAGE_BUF_SIZE, errElab);
-		}
+	entry->status = status;
+	entry->transferredCount = transferredCount;
+	entry->endNs = RsCoreInt_GetTickCountNs();
 
-		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-		         "%s VISA Read resulted in timeout.%s"
-		         " This usually means the instrument is not responding to a query. "
-		         "Current VISA timeout is set to " _PERCU " ms. You can change it with the "
-		         "PREFIX_SetVisaTimeout.", isNullOrEmpty(context) ? "" : context, cmdString, visaTimeoutMs);
-		(void)RsCore_SetErrorInfo(instrSession, VI_TRUE, VI_ERROR_TMO, VI_SUCCESS, errElab);
+	// IO of the OPC waiting is accounted as the OPC wait
+	if (rsSession->latencyCall.opcWaitDepth == 0)
+		rsSession->latencyCall.ioNs += entry->endNs - entry->startNs;
+
+	if (data != NULL)
+	{
+		entry->dataLength = dataCount < RS_IO_TRACE_DATA_LEN ? dataCount : RS_IO_TRACE_DATA_LEN;
+		memcpy(entry->data, data, entry->dataLength);
 	}
 
-	return error;
+	RsCoreInt_WriteBarrier();
+	entry->sequence = sequence;
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_ClearBeforeRead
-    Puts the instrument's status subsystem and its IO buffer to a defined status
+/*  RsCoreInt_IoTraceFormatData
+    Formats the entry data as a printable string. Non-printable characters are escaped,
+    '...' at the end means the data was longer than the stored part
 ******************************************************************************************************/
-ViStatus RsCoreInt_ClearBeforeRead(ViSession instrSession)
+void RsCoreInt_IoTraceFormatData(const RsCoreIoTraceEntry* entry, ViInt32 bufferSize, ViChar* buffer)
 {
-	ViStatus error = VI_SUCCESS;
-	ViInt32 stb = 0, previous_stb;
-	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE];
-	RsCoreSessionPtr rsSession = NULL;
+	ViInt32 length = 0;
+	ViUInt32 idx;
+	ViByte c;
+
+	for (idx = 0; idx < entry->dataLength && length < bufferSize - 8; idx++)
+	{
+		c = entry->data[idx];
+		if (c == '\n')
+			length += snprintf(buffer + length, (size_t)(bufferSize - length), "\\n");
+		else if (c == '\r')
+			length += snprintf(buffer + length, (size_t)(bufferSize - length), "\\r");
+		else if (c == '\\' || c < 0x20 || c > 0x7E)
+			length += snprintf(buffer + length, (size_t)(bufferSize - length), "\\x%02X", c);
+		else
+			buffer[length++] = (ViChar)c;
+	}
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	buffer[length] = '\0';
 
-	// STB read is determined by the fastSweepInstrument
-	if (rsSession->vxiCapable == VI_TRUE)
+	if (entry->transferredCount > entry->dataLength && entry->operation != RS_VAL_IO_TRACE_READ_STB)
+		RsCore_StrcatMaxLen(buffer, bufferSize, "...", NULL, NULL);
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_IsQueryOnly
+    Returns VI_TRUE if all the commands of the written message are queries, e.g. '*STB?' or 'FREQ:CENT?;:SWE:TIME?'
+    Such a write does not change the instrument settings. Long messages (data transfers) are never query-only
+******************************************************************************************************/
+ViBoolean RsCoreInt_IsQueryOnly(ViConstBuf buffer, ViUInt32 count)
+{
+	ViUInt32 idx;
+	ViBoolean isQuery = VI_FALSE;
+	ViBoolean isEmpty = VI_TRUE;
+	ViBoolean quoted = VI_FALSE;
+
+	if (count > RS_MAX_MESSAGE_LEN)
+		return VI_FALSE;
+
+	for (idx = 0; idx <= count; idx++)
 	{
-		if (rsSession->fastSweepInstrument > 0)
-		{
-			checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
-		}
-		else
+		if (idx == count || (!quoted && (buffer[idx] == ';' || buffer[idx] == '\n')))
 		{
-			checkErr(RsCore_QueryViInt32(instrSession, "*STB?", &stb));
+			if (!isEmpty && !isQuery)
+				return VI_FALSE;
+
+			isQuery = VI_FALSE;
+			isEmpty = VI_TRUE;
+			continue;
 		}
+
+		if (buffer[idx] == '\'' || buffer[idx] == '"')
+			quoted = (ViBoolean)!quoted;
+		else if (buffer[idx] == '#' && !quoted)
+			return VI_FALSE;
+		else if (buffer[idx] == '?' && !quoted)
+			isQuery = VI_TRUE;
+
+		if (!isspace(buffer[idx]) && buffer[idx] != ':')
+			isEmpty = VI_FALSE;
 	}
+
+	return VI_TRUE;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_IoWrite
+    Writes data to the session IO - VISA viWrite() or the session transport
+    The operation is recorded in the session IO trace
+******************************************************************************************************/
+ViStatus RsCoreInt_IoWrite(ViSession instrSession, ViConstBuf buffer, ViUInt32 count, ViPUInt32 retCount)
+{
+	RsCoreSessionPtr rsSession = RsCoreInt_GetIoSession(instrSession);
+	RsCoreIoSegment segment;
+	ViUInt32 written = 0;
+	ViUInt32 sequence;
+	ViStatus status;
+
+	segment.data = buffer;
+	segment.count = count;
+
+	sequence = RsCoreInt_IoTraceBegin(rsSession, RS_VAL_IO_TRACE_WRITE, count, &segment, 1);
+	if (rsSession != NULL && !RsCoreInt_IsQueryOnly(buffer, count))
+		rsSession->settingsGeneration++;
+
+	if (rsSession == NULL || rsSession->transport == NULL)
+		status = viWrite(instrSession, buffer, count, &written);
 	else
-	{
-		// Non-VXI session must use *CLS in any case
-		checkErr(RsCore_Write(instrSession, "*CLS"));
-		checkErr(RsCore_QueryViInt32(instrSession, "*OPC?", NULL));
-		checkErr(RsCore_QueryViInt32(instrSession, "*STB?", &stb));
-	}
+		status = rsSession->transport->write(rsSession->transportContext, &segment, 1, &written);
 
-	// ErrorQueueNotEmpty or EventStatusByte or MessageAvailable
-	while (stb & 0x34)
-	{
-		if ((stb & IEEE_488_2_STB_ERR_QUEUE_MASK) > 0)
-		{
-			// ErrorQueueNotEmpty
-			checkErr(RsCore_Write(instrSession, "*CLS"));
-			checkErr(RsCore_ErrorQueryAll(instrSession, NULL, RS_MAX_MESSAGE_BUF_SIZE, buffer));
-		}
+	RsCoreInt_IoTraceEnd(rsSession, sequence, status, written, NULL, 0);
 
-		if ((stb & IEEE_488_2_STB_ESB_MASK) > 0)
-		{
-			// EventStatusByte
-			checkErr(RsCore_Write(instrSession, "*CLS"));
-			checkErr(RsCoreInt_QueryClearEsr(instrSession));
-		}
+	if (retCount != NULL)
+		*retCount = written;
 
-		if ((stb & IEEE_488_2_STB_MAV_MASK) > 0)
-		{
-			// Message available
-			checkErr(RsCoreInt_FlushData(instrSession, VI_TRUE));
-		}
+	return status;
+}
 
-		previous_stb = stb;
-		// STB read is determined by the fastSweepInstrument
-		if (rsSession->fastSweepInstrument > 0 && rsSession->vxiCapable > 0)
-		{
-			checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
-		}
-		else
-		{
-			checkErr(RsCore_QueryViInt32(instrSession, "*STB?", &stb));
-		}
+/*****************************************************************************************************/
+/*  RsCoreInt_IoWriteSegments
+    Writes all the segments as one message. The END is sent only with the last segment
+    Transports send the segments with one scatter/gather write, VISA sessions use one viWrite() per segment
+    The retCount is the sum of all the written segments counts
+    The operation is recorded in the session IO trace as one write
+******************************************************************************************************/
+ViStatus RsCoreInt_IoWriteSegments(ViSession instrSession, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount)
+{
+	RsCoreSessionPtr rsSession = RsCoreInt_GetIoSession(instrSession);
+	ViUInt32 written = 0;
+	ViUInt32 count = 0;
+	ViUInt32 sequence;
+	ViUInt32 idx;
+	ViStatus status;
+
+	for (idx = 0; idx < segmentsCount; idx++)
+		count += segments[idx].count;
+
+	sequence = RsCoreInt_IoTraceBegin(rsSession, RS_VAL_IO_TRACE_WRITE, count, segments, segmentsCount);
+	if (rsSession != NULL && (segmentsCount == 0 || !RsCoreInt_IsQueryOnly(segments[0].data, segments[0].count)))
+		rsSession->settingsGeneration++;
+
+	if (rsSession == NULL || rsSession->transport == NULL)
+		status = RsCoreInt_VisaWriteSegments(instrSession, segments, segmentsCount, &written);
+	else
+		status = rsSession->transport->write(rsSession->transportContext, segments, segmentsCount, &written);
 
-		if (stb == previous_stb)
-		{
-			// Cannot clear the StatusRegister
-			snprintf(buffer, RS_MAX_MESSAGE_BUF_SIZE, "Cannot clear the instrument status. Last STB value: " _PERCD, stb);
-			viCheckErrElab(RS_ERROR_CANNOT_RECOVER, buffer);
-			break;
-		}
-	}
+	RsCoreInt_IoTraceEnd(rsSession, sequence, status, written, NULL, 0);
 
-Error:
-	return error;
+	if (retCount != NULL)
+		*retCount = written;
+
+	return status;
 }
 
 /*****************************************************************************************************/
-/*  Queries and Clears the ESR register
+/*  RsCoreInt_IoRead
+    Reads data from the session IO - VISA viRead() or the session transport
+    The operation is recorded in the session IO trace
 ******************************************************************************************************/
-ViStatus RsCoreInt_QueryClearEsr(ViSession instrSession)
+ViStatus RsCoreInt_IoRead(ViSession instrSession, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount)
 {
-	return RsCore_QueryViStringShort(instrSession, "*ESR?", NULL);
+	RsCoreSessionPtr rsSession = RsCoreInt_GetIoSession(instrSession);
+	ViUInt32 readCount = 0;
+	ViUInt32 sequence;
+	ViStatus status;
+
+	sequence = RsCoreInt_IoTraceBegin(rsSession, RS_VAL_IO_TRACE_READ, count, NULL, 0);
+
+	if (rsSession == NULL || rsSession->transport == NULL)
+		status = viRead(instrSession, buffer, count, &readCount);
+	else
+		status = rsSession->transport->read(rsSession->transportContext, buffer, count, &readCount);
+
+	RsCoreInt_IoTraceEnd(rsSession, sequence, status, readCount, buffer, readCount);
+
+	if (retCount != NULL)
+		*retCount = readCount;
+
+	return status;
 }
 
 /*****************************************************************************************************/
-/*  If the input opcTimeoutMs is > 0, it is not changed
-    If the input opcTimeoutMs is <= 0, it is changed to the current value of RS_ATTR_OPC_TIMEOUT
+/*  RsCoreInt_IoReadStb
+    Reads the status byte from the session IO - VISA viReadSTB() or the session transport
+    The operation is recorded in the session IO trace, with the status byte as the transferred count
 ******************************************************************************************************/
-ViStatus RsCoreInt_ResolveOpcTimeout(ViSession instrSession, ViInt32* opcTimeoutMs)
+ViStatus RsCoreInt_IoReadStb(ViSession instrSession, ViPUInt16 stb)
 {
-	if (*opcTimeoutMs > 0)
-	{
-		return VI_SUCCESS;
-	}
+	RsCoreSessionPtr rsSession = RsCoreInt_GetIoSession(instrSession);
+	ViUInt32 sequence;
+	ViStatus status;
 
-	return RsCore_GetAttributeViInt32(instrSession, NULL, RS_ATTR_OPC_TIMEOUT, 0, opcTimeoutMs);
+	sequence = RsCoreInt_IoTraceBegin(rsSession, RS_VAL_IO_TRACE_READ_STB, 0, NULL, 0);
+
+	if (rsSession == NULL || rsSession->transport == NULL)
+		status = viReadSTB(instrSession, stb);
+	else
+		status = rsSession->transport->readStb(rsSession->transportContext, stb);
+
+	RsCoreInt_IoTraceEnd(rsSession, sequence, status, status < VI_SUCCESS ? 0 : *stb, NULL, 0);
+
+	return status;
 }
 
 /*****************************************************************************************************/
-/*  Return Status byte values.
-    For VXI11-capable sessions it uses viReadSTB(), for others it uses *STB? query
+/*  RsCoreInt_IoClear
+    Clears the session IO - VISA viClear() or the session transport
+    The operation is recorded in the session IO trace
 ******************************************************************************************************/
-ViStatus RsCoreInt_GetStatusByte(ViSession instrSession, ViInt32* stb, ViBoolean blockTmoSettings)
+ViStatus RsCoreInt_IoClear(ViSession instrSession)
+{
+	RsCoreSessionPtr rsSession = RsCoreInt_GetIoSession(instrSession);
+	ViUInt32 sequence;
+	ViStatus status;
+
+	sequence = RsCoreInt_IoTraceBegin(rsSession, RS_VAL_IO_TRACE_CLEAR, 0, NULL, 0);
+
+	if (rsSession == NULL || rsSession->transport == NULL)
+		status = viClear(instrSession);
+	else
+		status = rsSession->transport->clear(rsSession->transportContext);
+
+	RsCoreInt_IoTraceEnd(rsSession, sequence, status, 0, NULL, 0);
+
+	return status;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_IoSetAttribute
+    Sets the session IO attribute - VISA viSetAttribute() or the session transport
+******************************************************************************************************/
+ViStatus RsCoreInt_IoSetAttribute(ViSession instrSession, ViAttr attributeName, ViAttrState attributeValue)
+{
+	const RsCoreTransport* transport;
+	void* context;
+
+	if (!RsCoreInt_GetTransport(instrSession, &transport, &context))
+		return viSetAttribute(instrSession, attributeName, attributeValue);
+
+	return transport->setAttribute(context, attributeName, attributeValue);
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_IoGetAttribute
+    Returns the session IO attribute - VISA viGetAttribute() or the session transport
+******************************************************************************************************/
+ViStatus RsCoreInt_IoGetAttribute(ViSession instrSession, ViAttr attributeName, void* attributeValue)
+{
+	const RsCoreTransport* transport;
+	void* context;
+
+	if (!RsCoreInt_GetTransport(instrSession, &transport, &context))
+		return viGetAttribute(instrSession, attributeName, attributeValue);
+
+	return transport->getAttribute(context, attributeName, attributeValue);
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_SocketOpen
+    Native socket transport: connects to the instrument raw SCPI port
+    Supported resource names: 'TCPIP[board]::host::port::SOCKET' with a numeric port, and
+    'TCPIP[board]::host[::device][::INSTR]' with the VXI-11 device 'inst<n>' or the HiSLIP device 'hislip<n>'.
+    The INSTR resources connect to the raw SCPI port 5025 of the same host
+******************************************************************************************************/
+ViStatus RsCoreInt_SocketOpen(ViRsrc resourceName, ViConstString optionsString, void** context)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt32 oldVisaTout = 0;
-	ViUInt16 stbInt16;
-	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
-	RsCoreSessionPtr rsSession = NULL;
+	ViChar host[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar port[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar rsrcClass[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar device[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViConstString p2start;
+	ViConstString p2end;
+	struct addrinfo hints;
+	struct addrinfo *addresses = NULL, *address;
+	RsCoreSocketContextPtr ctx = NULL;
+	int option;
+#if defined(ANSI)
+	WSADATA wsaData;
+	ViBoolean wsaStarted = VI_FALSE;
+#endif
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	*context = NULL;
+	snprintf(port, RS_MAX_SHORT_MESSAGE_BUF_SIZE, "%d", RS_SOCKET_DEFAULT_PORT);
+	rsrcClass[0] = 0;
+	device[0] = 0;
 
-	if (rsSession->vxiCapable)
+	// Parse the resource name: TCPIP[board]::host[::device][::class]
+	if (resourceName == NULL || strncmp(resourceName, "TCPIP", 5) != 0 || (p2start = strstr(resourceName, "::")) == NULL)
 	{
-		if (rsSession->viReadStbVisaTimeoutMs > 0 && blockTmoSettings == VI_FALSE)
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "Socket transport: the resource name '%s' is not a TCPIP resource",
+		         resourceName ? resourceName : "");
+		(void)RsCoreInt_SetGlobalErrorInfo(VI_ERROR_INV_RSRC_NAME, VI_SUCCESS, errorElab);
+		return VI_ERROR_INV_RSRC_NAME;
+	}
+
+	p2start += 2;
+	p2end = strstr(p2start, "::");
+	RsCoreInt_StrcpyMaxLen(host, (p2end == NULL || p2end - p2start + 1 > RS_MAX_SHORT_MESSAGE_BUF_SIZE)
+		                             ? RS_MAX_SHORT_MESSAGE_BUF_SIZE
+		                             : (ViInt32)(p2end - p2start + 1), p2start);
+	if (p2end != NULL)
+	{
+		p2start = p2end + 2;
+		p2end = strstr(p2start, "::");
+		if (p2end == NULL)
 		{
-			checkErr(viGetAttribute(instrSession, VI_ATTR_TMO_VALUE, &oldVisaTout));
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TMO_VALUE, rsSession->viReadStbVisaTimeoutMs));
+			RsCoreInt_StrcpyMaxLen(rsrcClass, RS_MAX_SHORT_MESSAGE_BUF_SIZE, p2start);
+		}
+		else
+		{
+			RsCoreInt_StrcpyMaxLen(device, (p2end - p2start + 1 > RS_MAX_SHORT_MESSAGE_BUF_SIZE)
+				                               ? RS_MAX_SHORT_MESSAGE_BUF_SIZE
+				                               : (ViInt32)(p2end - p2start + 1), p2start);
+			RsCoreInt_StrcpyMaxLen(rsrcClass, RS_MAX_SHORT_MESSAGE_BUF_SIZE, p2end + 2);
 		}
-		error = viReadSTB(instrSession, &stbInt16);
-		*stb = (ViInt32)stbInt16;
 	}
-	else
+
+	// 'TCPIP::host::inst0' - the INSTR class is optional after the device
+	if (device[0] == 0 && (strncmp(rsrcClass, "inst", 4) == 0 || strncmp(rsrcClass, "hislip", 6) == 0))
 	{
-		*stb = 0;
-		checkErr(RsCore_QueryViStringShort(instrSession, "*STB?", response));
-		*stb = (ViInt32)atoi(response);
+		RsCoreInt_StrcpyMaxLen(device, RS_MAX_SHORT_MESSAGE_BUF_SIZE, rsrcClass);
+		RsCoreInt_StrcpyMaxLen(rsrcClass, RS_MAX_SHORT_MESSAGE_BUF_SIZE, "INSTR");
 	}
 
-Error:
-	if (oldVisaTout > 0)
+	errorElab[0] = 0;
+	if (strlen(host) == 0 || (rsrcClass[0] != 0 && strcmp(rsrcClass, "SOCKET") != 0 && strcmp(rsrcClass, "INSTR") != 0))
+	{
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "Socket transport: the resource name '%s' is not a TCPIP INSTR or SOCKET resource",
+		         resourceName);
+	}
+	else if (strcmp(rsrcClass, "SOCKET") == 0)
 	{
-		checkErr(viSetAttribute(instrSession, VI_ATTR_TMO_VALUE, oldVisaTout));
+		// The port is the decimal number 1 .. 65535
+		if (device[0] == 0 || strspn(device, "0123456789") != strlen(device) || atol(device) < 1 || atol(device) > 65535)
+			snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "Socket transport: the resource name '%s' has an invalid port '%s'",
+			         resourceName, device);
+		else
+			RsCoreInt_StrcpyMaxLen(port, RS_MAX_SHORT_MESSAGE_BUF_SIZE, device);
+	}
+	else if (device[0] != 0 && strncmp(device, "inst", 4) != 0 && strncmp(device, "hislip", 6) != 0)
+	{
+		// The VXI-11 and HiSLIP devices of the instrument also serve the raw SCPI port
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Socket transport: the resource name '%s' has the device '%s', supported are inst<n> and hislip<n>",
+		         resourceName, device);
 	}
 
-	return error;
-}
+	if (errorElab[0] != 0)
+	{
+		(void)RsCoreInt_SetGlobalErrorInfo(VI_ERROR_INV_RSRC_NAME, VI_SUCCESS, errorElab);
+		return VI_ERROR_INV_RSRC_NAME;
+	}
 
-/*****************************************************************************************************/
-/*  Rebuilds the entered instrument options string with the following steps:
-    - based on the optionsParsingMode it keeps parts before or after dash
-    - trims all elements for white spaces and paired quotation marks
-    - removes duplicates
-    - sorts the options in the ascending order - starting with K0, up to K9999 and then B0 up to B9999
-******************************************************************************************************/
-ViStatus RsCoreInt_ParseOptionsString(ViSession instrSession, ViChar* instrumentOptionsString, ViInt32 optionsParsingMode)
-{
-	ViStatus error = VI_SUCCESS;
-	ViChar* element;
-	ViInt32 len;
-	ViInt32 elementsCount, allocatedCount = 0;
-	ViChar** optionsArray = NULL;
-	ViInt32* optionsNumbersArray = NULL;
-	ViInt32 idx, tokenIdx;
-	ViInt32 i;
-	ViInt32 minIdx;
-	ViInt32 optionNumber;
-	ViBoolean result;
-	ViBoolean duplicate;
-	ViChar auxString[RS_MAX_MESSAGE_LEN];
-	ViChar before[RS_MAX_MESSAGE_LEN];
-	ViChar after[RS_MAX_MESSAGE_LEN];
-	ViChar token[RS_MAX_MESSAGE_LEN];
+#if defined(ANSI)
+	if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+		return VI_ERROR_SYSTEM_ERROR;
 
-	if (instrumentOptionsString == NULL)
+	wsaStarted = VI_TRUE;
+#endif
+
+	if ((ctx = (RsCoreSocketContextPtr)calloc(1, sizeof(RsCoreSocketContext))) == NULL)
 	{
-		checkErr(RS_ERROR_NULL_POINTER);
+		error = VI_ERROR_ALLOC;
+		goto Error;
 	}
 
-	RsCore_TrimString(instrumentOptionsString, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
-	len = (ViInt32)strlen(instrumentOptionsString);
-	if (len == 0)
+	ctx->socket = RS_INVALID_SOCKET;
+	ctx->termChar = '\n';
+	ctx->termCharEnabled = VI_TRUE;
+	ctx->sendEndEnabled = VI_TRUE;
+	if ((ctx->rxBuffer = (ViByte*)malloc(RS_SOCKET_RX_BUFFER_SIZE)) == NULL)
+	{
+		error = VI_ERROR_ALLOC;
 		goto Error;
+	}
 
-	elementsCount = RsCore_GetElementsCount(instrumentOptionsString, ',');
-
-	// Allocate optionsArray[] of ViChar* pointers;
-	checkAlloc(optionsArray = (ViChar **)calloc(elementsCount, sizeof(ViChar*)));
-	allocatedCount = elementsCount;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_protocol = IPPROTO_TCP;
+	if (getaddrinfo(host, port, &hints, &addresses) != 0)
+	{
+		error = VI_ERROR_RSRC_NFOUND;
+		goto Error;
+	}
 
-	// loop through the elements, fill the optionsArray[], remove duplicates
-	idx = 0;
-	for (tokenIdx = 0; tokenIdx < elementsCount; tokenIdx++)
+	error = VI_ERROR_RSRC_NFOUND;
+	for (address = addresses; address != NULL; address = address->ai_next)
 	{
-		checkErr(RsCore_GetTokenAtIndex(instrumentOptionsString, ',', tokenIdx, token, RS_MAX_MESSAGE_LEN, NULL));
-		element = token;
-		if (optionsParsingMode == RS_VAL_OPTIONS_PARSING_KEEP_ORIGINAL)
+		ctx->socket = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+		if (ctx->socket == RS_INVALID_SOCKET)
+			continue;
+
+		// Big OS buffers must be set before connecting, so that the TCP window scaling is negotiated
+		option = RS_SOCKET_OS_BUFFER_SIZE;
+		(void)setsockopt(ctx->socket, SOL_SOCKET, SO_SNDBUF, (const char*)&option, sizeof(option));
+		(void)setsockopt(ctx->socket, SOL_SOCKET, SO_RCVBUF, (const char*)&option, sizeof(option));
+
+		// Commands are short and answered immediately, do not delay them with the Nagle's algorithm
+		option = 1;
+		(void)setsockopt(ctx->socket, IPPROTO_TCP, TCP_NODELAY, (const char*)&option, sizeof(option));
+
+		if (connect(ctx->socket, address->ai_addr, (int)address->ai_addrlen) == 0)
 		{
-			RsCoreInt_SplitTokenToNameAndValue(token, ":", auxString, after, RS_MAX_MESSAGE_LEN);
-			element = auxString;
+			error = VI_SUCCESS;
+			break;
 		}
-		else if (optionsParsingMode == RS_VAL_OPTIONS_PARSING_KEEP_BEFORE_DASH)
-		{
-			RsCoreInt_SplitTokenToNameAndValue(token, "-", before, after, RS_MAX_MESSAGE_LEN); // take before in any case
 
-			// Remove the parts after ':'
-			RsCoreInt_SplitTokenToNameAndValue(before, ":", auxString, after, RS_MAX_MESSAGE_LEN);
-			element = auxString;
+		closesocket(ctx->socket);
+		ctx->socket = RS_INVALID_SOCKET;
+	}
+
+	if (error < VI_SUCCESS)
+		goto Error;
+
+	checkErr(RsCoreInt_SocketSetAttribute(ctx, VI_ATTR_TMO_VALUE, 2000));
+	*context = ctx;
+	ctx = NULL;
+
+Error:
+	if (addresses != NULL)
+		freeaddrinfo(addresses);
+
+	if (ctx != NULL)
+	{
+		RsCoreInt_SocketClose(ctx);
+	}
+#if defined(ANSI)
+	else if (error < VI_SUCCESS && wsaStarted)
+	{
+		WSACleanup();
+	}
+#endif
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_SocketClose
+    Native socket transport: closes the connection and frees the instance data
+******************************************************************************************************/
+void RsCoreInt_SocketClose(void* context)
+{
+	RsCoreSocketContextPtr ctx = (RsCoreSocketContextPtr)context;
+
+	if (ctx == NULL)
+		return;
+
+	if (ctx->socket != RS_INVALID_SOCKET)
+		closesocket(ctx->socket);
+
+	if (ctx->rxBuffer)
+		free(ctx->rxBuffer);
+
+	free(ctx);
+
+#if defined(ANSI)
+	WSACleanup();
+#endif
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_SocketSend
+    Native socket transport: sends the staged data followed by the segments with scatter/gather writes
+    Partially sent segments are continued until all the data is sent
+******************************************************************************************************/
+ViStatus RsCoreInt_SocketSend(RsCoreSocketContextPtr ctx, const RsCoreIoSegment segments[], ViUInt32 segmentsCount)
+{
+#if defined(ANSI)
+	WSABUF vectors[RS_SOCKET_MAX_SEGMENTS];
+	DWORD sent;
+#else
+	struct iovec vectors[RS_SOCKET_MAX_SEGMENTS];
+	struct msghdr message;
+	ssize_t sent;
+#endif
+	ViUInt32 vectorsCount = 0;
+	ViUInt32 idx = 0;
+	ViUInt32 first = 0;
+
+	if (ctx->txStagedCount > 0)
+	{
+#if defined(ANSI)
+		vectors[0].buf = (CHAR*)ctx->txStage;
+		vectors[0].len = ctx->txStagedCount;
+#else
+		vectors[0].iov_base = ctx->txStage;
+		vectors[0].iov_len = ctx->txStagedCount;
+#endif
+		vectorsCount = 1;
+		ctx->txStagedCount = 0;
+	}
+
+	while (vectorsCount > 0 || idx < segmentsCount)
+	{
+		// Fill the vectors with the next segments
+		for (; idx < segmentsCount && vectorsCount < RS_SOCKET_MAX_SEGMENTS; idx++)
+		{
+			if (segments[idx].count == 0)
+				continue;
+
+#if defined(ANSI)
+			vectors[vectorsCount].buf = (CHAR*)segments[idx].data;
+			vectors[vectorsCount].len = segments[idx].count;
+#else
+			vectors[vectorsCount].iov_base = (void*)segments[idx].data;
+			vectors[vectorsCount].iov_len = segments[idx].count;
+#endif
+			vectorsCount++;
 		}
-		else if (optionsParsingMode == RS_VAL_OPTIONS_PARSING_KEEP_AFTER_DASH)
+
+		if (vectorsCount == 0)
+			break;
+
+#if defined(ANSI)
+		if (WSASend(ctx->socket, vectors + first, vectorsCount - first, &sent, 0, NULL, NULL) != 0)
+			return RS_SOCKET_TIMED_OUT() ? VI_ERROR_TMO : VI_ERROR_IO;
+#else
+		memset(&message, 0, sizeof(message));
+		message.msg_iov = vectors + first;
+		message.msg_iovlen = vectorsCount - first;
+		sent = sendmsg(ctx->socket, &message, MSG_NOSIGNAL);
+		if (sent < 0)
 		{
-			result = RsCoreInt_SplitTokenToNameAndValue(token, "-", before, after, RS_MAX_MESSAGE_LEN);
-			if (result) // Dash found, take the part after
-			{
-				// Remove the parts after ':'
-				RsCoreInt_SplitTokenToNameAndValue(after, ":", auxString, before, RS_MAX_MESSAGE_LEN);
-				element = auxString;
-			}
-			else // Dash not found, take the whole string stored in before
-			{
-				// Remove the parts after ':'
-				RsCoreInt_SplitTokenToNameAndValue(before, ":", auxString, after, RS_MAX_MESSAGE_LEN);
-				element = auxString;
-			}
+			if (errno == EINTR)
+				continue;
+
+			return RS_SOCKET_TIMED_OUT() ? VI_ERROR_TMO : VI_ERROR_IO;
 		}
-		else if (optionsParsingMode == RS_VAL_OPTIONS_PARSING_AUTO)
+#endif
+
+		// Skip the completely sent vectors, shift the partially sent one
+		while (first < vectorsCount)
 		{
-			ViInt32 beforeScanned, afterScanned;
-			
-			// Remove the parts after ':'
-			result = RsCoreInt_SplitTokenToNameAndValue(token, ":", auxString, after, RS_MAX_MESSAGE_LEN);
-			if (result) // ':' found, take the part before
-			{
-				element = auxString;
-			}
-			else
-			{
-				element = token;
-			}
-			result = RsCoreInt_SplitTokenToNameAndValue(element, "-", before, after, RS_MAX_MESSAGE_LEN);
-			if (result) // Dash found, pick either before or after
+#if defined(ANSI)
+			if (sent < vectors[first].len)
 			{
-				beforeScanned = sscanf(before, "%[KB]" _PERCD, auxString, &optionNumber);
-				afterScanned = sscanf(after, "%[KB]" _PERCD, auxString, &optionNumber);
-				
-				// Prefer element after
-				element = after;
-				if (beforeScanned > afterScanned)
-				{
-					element = before;
-				}
+				vectors[first].buf += sent;
+				vectors[first].len -= sent;
+				break;
 			}
-		}
-
-		RsCore_TrimString(element, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
-		if (strlen(element) == 0)
-			continue;
 
-		// Detect duplicates, only add to the optionsArray if not already there
-		duplicate = VI_FALSE;
-		for (i = 0; i < idx; i++)
-		{
-			if (strcmp(element, optionsArray[i]) == 0)
+			sent -= vectors[first].len;
+#else
+			if ((size_t)sent < vectors[first].iov_len)
 			{
-				duplicate = VI_TRUE;
+				vectors[first].iov_base = (ViByte*)vectors[first].iov_base + sent;
+				vectors[first].iov_len -= (size_t)sent;
 				break;
 			}
+
+			sent -= (ssize_t)vectors[first].iov_len;
+#endif
+			first++;
 		}
 
-		if (!duplicate)
+		if (first == vectorsCount)
 		{
-			checkAlloc(optionsArray[idx] = (ViChar*)calloc(strlen(element) + 1, sizeof(ViChar)));
-			RsCoreInt_StrcpyMaxLen(optionsArray[idx], (ViInt32)strlen(element) + 1, element);
-			idx++;
+			first = 0;
+			vectorsCount = 0;
 		}
 	}
 
-	// New elements count after removing duplicates
-	elementsCount = idx;
+	return VI_SUCCESS;
+}
 
-	// Allocate optionsNumbersArray[] of ViInt32 values used for sorting
-	checkAlloc(optionsNumbersArray = (ViInt32*)calloc(elementsCount, sizeof(ViInt32)));
-	for (idx = 0; idx < elementsCount; idx++)
-	{
-		optionNumber = 0;
-		i = sscanf(optionsArray[idx], "%[KB]" _PERCD, auxString, &optionNumber);
-		if (i == 0) // Scanned incorrectly
-			// Put to the very end
-			optionNumber += 2000000;
-		else if (i > 0) // K/B scanned correctly
-			// Offset to put B-options behind K-options
-			if (strcmp(auxString, "B") == 0) optionNumber += 1000000;
+/*****************************************************************************************************/
+/*  RsCoreInt_SocketWrite
+    Native socket transport: writes the segments
+    With VI_ATTR_SEND_END_EN = FALSE, short data is staged and sent together with the next write.
+    This way a binary data header and its data block go out in one TCP segment.
+******************************************************************************************************/
+ViStatus RsCoreInt_SocketWrite(void* context, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSocketContextPtr ctx = (RsCoreSocketContextPtr)context;
+	ViUInt32 totalCount = 0;
+	ViUInt32 idx;
 
-		optionsNumbersArray[idx] = optionNumber;
-	}
+	for (idx = 0; idx < segmentsCount; idx++)
+		totalCount += segments[idx].count;
 
-	// Pick one by one starting from the smallest optionNumber, rebuild the instrumentOptionsString
-	memset(instrumentOptionsString, 0, len + 1);
-	for (idx = 0; idx < elementsCount; idx++)
+	if (!ctx->sendEndEnabled && ctx->txStagedCount + totalCount <= RS_SOCKET_TX_STAGE_SIZE)
 	{
-		// Find the minimum
-		optionNumber = 10000000;
-		minIdx = 1;
-		for (i = 0; i < elementsCount; i++)
+		for (idx = 0; idx < segmentsCount; idx++)
 		{
-			if (optionNumber > optionsNumbersArray[i])
-			{
-				optionNumber = optionsNumbersArray[i];
-				minIdx = i;
-			}
+			memcpy(ctx->txStage + ctx->txStagedCount, segments[idx].data, segments[idx].count);
+			ctx->txStagedCount += segments[idx].count;
 		}
-
-		optionsNumbersArray[minIdx] = 10000000; // Invalidate the value
-		RsCore_AppendToCsvString(instrumentOptionsString, (ViChar*)",", len + 1, optionsArray[minIdx]);
+	}
+	else
+	{
+		error = RsCoreInt_SocketSend(ctx, segments, segmentsCount);
 	}
 
-Error:
-	// Free allocated resources
-	if (optionsArray)
-		for (idx = 0; idx < allocatedCount; idx++)
-			if (optionsArray[idx])
-				free(optionsArray[idx]);
-
-	if (optionsArray)
-		free(optionsArray);
-
-	if (optionsNumbersArray)
-		free(optionsNumbersArray);
+	if (retCount)
+		*retCount = (error < VI_SUCCESS) ? 0 : totalCount;
 
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  Waits for OPC by STB polling
+/*  RsCoreInt_SocketRead
+    Native socket transport: reads up to count bytes
+    Returns VI_SUCCESS_TERM_CHAR if the read ended with the enabled termination character,
+    VI_SUCCESS_MAX_CNT if count bytes were read, VI_ERROR_TMO if no data arrived within the timeout
 ******************************************************************************************************/
-ViStatus RsCoreInt_WaitForOpcSTBpoll(ViSession instrSession, ViInt32 timeoutMs)
+ViStatus RsCoreInt_SocketRead(void* context, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount)
 {
-	ViStatus error = VI_SUCCESS;
-	ViInt32 stb = 0;
-	ViReal64 opcTimeoutMs;
-	ViInt32 oldVisaTout = 0;
-	ViReal64 elapsedTimeMs;
-	ViReal64 ms_divider = (ViReal64)CLOCKS_PER_SEC / (ViReal64)1000.0;
-	clock_t start_time = clock();
-	RsCoreSessionPtr rsSession = NULL;
-
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
-
-	if (RsCore_Simulating(instrSession) == VI_TRUE)
-		goto Error;
-
-	opcTimeoutMs = (ViReal64)timeoutMs;
+	ViStatus error = VI_SUCCESS_MAX_CNT;
+	RsCoreSocketContextPtr ctx = (RsCoreSocketContextPtr)context;
+	ViUInt32 total = 0;
+	ViUInt32 chunk;
+	ViByte* p2termChar;
+	int received;
 
-	if (rsSession->vxiCapable && rsSession->viReadStbVisaTimeoutMs > 0)
+	// Data staged without END must reach the instrument before waiting for its response
+	if (ctx->txStagedCount > 0)
 	{
-		// Will use the viReadSTB, set the VISA timeout here
-		checkErr(viGetAttribute(instrSession, VI_ATTR_TMO_VALUE, &oldVisaTout));
-		checkErr(viSetAttribute(instrSession, VI_ATTR_TMO_VALUE, rsSession->viReadStbVisaTimeoutMs));
+		error = RsCoreInt_SocketSend(ctx, NULL, 0);
+		if (error < VI_SUCCESS)
+			goto Error;
+
+		error = VI_SUCCESS_MAX_CNT;
 	}
 
-	do
+	while (total < count)
 	{
-		checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_TRUE));
-		if ((stb & IEEE_488_2_STB_ESB_MASK) != 0)
-			break;
-
-		if ((stb & IEEE_488_2_STB_ERR_QUEUE_MASK) > 0)
+		if (ctx->rxStart == ctx->rxEnd)
 		{
-			error = RS_ERROR_INSTRUMENT_STATUS;
-			goto Error;
+			ctx->rxStart = 0;
+			ctx->rxEnd = 0;
+			if (!ctx->termCharEnabled && count - total >= RS_SOCKET_RX_BUFFER_SIZE)
+			{
+				// Big blocks go directly to the caller's buffer
+				chunk = (count - total > 0x40000000) ? 0x40000000 : count - total;
+				received = recv(ctx->socket, (char*)buffer + total, (int)chunk, 0);
+			}
+			else
+			{
+				received = recv(ctx->socket, (char*)ctx->rxBuffer, RS_SOCKET_RX_BUFFER_SIZE, 0);
+			}
+
+			if (received == 0)
+			{
+				error = VI_ERROR_CONN_LOST;
+				goto Error;
+			}
+
+			if (received < 0)
+			{
+#if !defined(ANSI)
+				if (errno == EINTR)
+					continue;
+#endif
+				error = RS_SOCKET_TIMED_OUT() ? VI_ERROR_TMO : VI_ERROR_IO;
+				goto Error;
+			}
+
+			if (ctx->rxEnd == 0 && !ctx->termCharEnabled && count - total >= RS_SOCKET_RX_BUFFER_SIZE)
+			{
+				total += (ViUInt32)received;
+				continue;
+			}
+
+			ctx->rxEnd = (ViUInt32)received;
 		}
 
-		elapsedTimeMs = (ViReal64)(clock() - start_time) / ms_divider;
-		if (elapsedTimeMs > opcTimeoutMs)
+		chunk = ctx->rxEnd - ctx->rxStart;
+		if (chunk > count - total)
+			chunk = count - total;
+
+		p2termChar = NULL;
+		if (ctx->termCharEnabled)
 		{
-			error = VI_ERROR_TMO;
-			goto Error;
+			p2termChar = (ViByte*)memchr(ctx->rxBuffer + ctx->rxStart, ctx->termChar, chunk);
+			if (p2termChar != NULL)
+				chunk = (ViUInt32)(p2termChar - (ctx->rxBuffer + ctx->rxStart)) + 1;
 		}
 
-		RsCoreInt_PollingDelay(elapsedTimeMs, rsSession->opcWaitMode);
+		memcpy(buffer + total, ctx->rxBuffer + ctx->rxStart, chunk);
+		ctx->rxStart += chunk;
+		total += chunk;
+		if (p2termChar != NULL)
+		{
+			error = VI_SUCCESS_TERM_CHAR;
+			break;
+		}
 	}
-	while ((stb & IEEE_488_2_STB_ESB_MASK) == 0);
 
 Error:
-	if (oldVisaTout > 0)
-	{
-		(void)(RsCore_SetVisaTimeout(instrSession, oldVisaTout));
-	}
+	if (retCount)
+		*retCount = total;
 
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  Waiting for OPC with Wait for Service Request
+/*  RsCoreInt_SocketReadStb
+    Native socket transport: the raw socket has no serial poll, the status byte is queried with *STB?
 ******************************************************************************************************/
-ViStatus RsCoreInt_WaitForOpcSRQ(ViSession instrSession, ViInt32 timeoutMs)
+ViStatus RsCoreInt_SocketReadStb(void* context, ViPUInt16 stb)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt32 stb = 0;
+	RsCoreSocketContextPtr ctx = (RsCoreSocketContextPtr)context;
+	RsCoreIoSegment segment;
+	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViUInt32 retCnt = 0;
+	ViBoolean termCharEnabled = ctx->termCharEnabled;
 
-	if (RsCore_Simulating(instrSession) == VI_TRUE)
-		return error;
+	segment.data = (ViConstBuf)"*STB?\n";
+	segment.count = 6;
+	checkErr(RsCoreInt_SocketSend(ctx, &segment, 1));
 
-	error = viWaitOnEvent(instrSession, VI_EVENT_SERVICE_REQ, timeoutMs, VI_NULL, VI_NULL);
-	if (error == VI_SUCCESS)
-	{
-		checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
-	}
-	else if (error == VI_ERROR_TMO)
-	{
-		checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
-		error = VI_ERROR_TMO;
-	}
+	ctx->termCharEnabled = VI_TRUE;
+	error = RsCoreInt_SocketRead(ctx, (ViPBuf)response, RS_MAX_SHORT_MESSAGE_BUF_SIZE - 1, &retCnt);
+	ctx->termCharEnabled = termCharEnabled;
+	if (error < VI_SUCCESS)
+		goto Error;
 
-Error:
-	(void)viDisableEvent(instrSession, VI_EVENT_SERVICE_REQ, VI_QUEUE); // No error handling
-	if ((stb & IEEE_488_2_STB_ERR_QUEUE_MASK) > 0)
-	{
-		error = RS_ERROR_INSTRUMENT_STATUS;
-	}
+	response[retCnt] = 0;
+	*stb = (ViUInt16)atoi(response);
+	error = VI_SUCCESS;
 
+Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  Reads and discards all the data from the instrument input buffer.
-    If totalFlush is TRUE, the method tries to completely flush the data.
-    If totalFlush is FALSE, after several reads returns an error.
+/*  RsCoreInt_SocketClear
+    Native socket transport: the raw socket has no device clear,
+    the function discards the staged data and all the received data not read yet
 ******************************************************************************************************/
-ViStatus RsCoreInt_FlushData(ViSession instrSession, ViBoolean totalFlush)
+ViStatus RsCoreInt_SocketClear(void* context)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE];
-	ViUInt32 retCnt, len;
-	ViBoolean moreDataAvailable;
-	ViInt32 i; RsCoreSessionPtr rsSession = NULL;
-
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	RsCoreSocketContextPtr ctx = (RsCoreSocketContextPtr)context;
+	struct timeval timeout;
+	fd_set readSet;
 
-	if (rsSession->readDelay)
-		Sleep(rsSession->readDelay);
+	ctx->txStagedCount = 0;
+	ctx->rxStart = 0;
+	ctx->rxEnd = 0;
 
-	len = 8;
-	i = 0;
-	moreDataAvailable = VI_TRUE;
-	while (moreDataAvailable == VI_TRUE)
+	do
 	{
-		checkErr(viRead(instrSession, (ViBuf)buffer, len, &retCnt));
-		len *= 2;
-		if (len > RS_MAX_MESSAGE_BUF_SIZE)
-			len = RS_MAX_MESSAGE_BUF_SIZE;
-
-		moreDataAvailable = (error == VI_SUCCESS_MAX_CNT);
-		if (!moreDataAvailable && retCnt == len)
-		{
-			if (buffer[len - 1] != '\n')
-				moreDataAvailable = VI_TRUE;
-		}
-
-		i++;
-		if (totalFlush == VI_FALSE && i > 100)
+		FD_ZERO(&readSet);
+		FD_SET(ctx->socket, &readSet);
+		timeout.tv_sec = 0;
+		timeout.tv_usec = 0;
+		if (select((int)ctx->socket + 1, &readSet, NULL, NULL, &timeout) <= 0)
 			break;
-	}
+	} while (recv(ctx->socket, (char*)ctx->rxBuffer, RS_SOCKET_RX_BUFFER_SIZE, 0) > 0);
 
-	if (moreDataAvailable == VI_TRUE)
-	{
-		snprintf(buffer, RS_MAX_MESSAGE_BUF_SIZE, "FlushJunkData: data length is too big to be completely read from the instrument.");
-		viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, buffer);
-	}
-
-Error:
-	return error;
+	return VI_SUCCESS;
 }
 
 /*****************************************************************************************************/
-/*  Parses binary data block header and returns length of the following binary data block.
-    If you provide dataPartRead buffer, in case of non-binary data
-    the function returns the null-terminated sting already read out, so you can concatenate
-    it for further reading. The dataPartRead buffer must be at least 30 bytes long
+/*  RsCoreInt_SocketSetAttribute
+    Native socket transport: sets the VISA-equivalent attribute
+    Buffering and interface-specific attributes without meaning for the raw socket are accepted and ignored
 ******************************************************************************************************/
-ViStatus RsCoreInt_ParseBinaryDataHeader(ViSession instrSession, ViBoolean errorIfNotBinDataBlock,
-                                         ViBoolean* isBinDataBlock, ViInt64* length, ViChar* dataPartRead)
+ViStatus RsCoreInt_SocketSetAttribute(void* context, ViAttr attributeName, ViAttrState attributeValue)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar header[100];
-	ViUInt32 retCnt;
-	ViBoolean binDataBlockDetected = VI_FALSE;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	RsCoreSessionPtr rsSession = NULL;
+	RsCoreSocketContextPtr ctx = (RsCoreSocketContextPtr)context;
+#if defined(ANSI)
+	DWORD timeout;
+#else
+	struct timeval timeout;
+#endif
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	switch (attributeName)
+	{
+	case VI_ATTR_TMO_VALUE:
+		ctx->timeoutMs = (ViUInt32)attributeValue;
+#if defined(ANSI)
+		timeout = (ctx->timeoutMs == VI_TMO_INFINITE) ? 0 : (DWORD)ctx->timeoutMs;
+#else
+		timeout.tv_sec = (ctx->timeoutMs == VI_TMO_INFINITE) ? 0 : ctx->timeoutMs / 1000;
+		timeout.tv_usec = (ctx->timeoutMs == VI_TMO_INFINITE) ? 0 : (ctx->timeoutMs % 1000) * 1000;
+#endif
+		(void)setsockopt(ctx->socket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeout, sizeof(timeout));
+		(void)setsockopt(ctx->socket, SOL_SOCKET, SO_SNDTIMEO, (const char*)&timeout, sizeof(timeout));
+		break;
 
-	// Only apply the read delay once at the beginning
-	if (rsSession->readDelay)
-		Sleep(rsSession->readDelay);
+	case VI_ATTR_TERMCHAR:
+		ctx->termChar = (ViUInt8)attributeValue;
+		break;
 
-	checkErr(viRead(instrSession, (ViBuf)header, 1, &retCnt));
-	if (header[0] == '#')
-	{
-		if (dataPartRead)
-			dataPartRead[0] = 0;
+	case VI_ATTR_TERMCHAR_EN:
+		ctx->termCharEnabled = (ViBoolean)attributeValue;
+		break;
 
-		// Binary data confirmed
-		binDataBlockDetected = VI_TRUE;
-		checkErr(viRead(instrSession, (ViBuf)header, 1, &retCnt));
-		if (header[0] == '(')
-		{
-			// format for > 1E9 bytes: '#(1234567890123)<data>'
-			ViInt32 count;
-			checkErr(RsCore_ReadUpToCharacter(instrSession, ')', 100, (ViBuf)header, &count));
-			header[count] = 0;
-			sscanf(header,  _PERCLD, length);
-		}
-		else if (header[0] == '0')
-		{
-			*length = -1; // long response, unknown length
-		}
-		else
-		{
-			// classic format for < 1E9 bytes: '#9123456789...'
-			ViInt32 lenOfLen;
-			header[1] = '\0';
-			lenOfLen = (ViInt32)atoi(header);
-			checkErr(viRead(instrSession, (ViBuf)header, lenOfLen, &retCnt));
-			header[retCnt] = '\0';
-			sscanf(header,  _PERCLD, length);
-		}
-	}
-	else
-	{
-		// Non-binary data
-		binDataBlockDetected = VI_FALSE;
-		*length = -2; //unrecognized binary header, treat it like an ASCII transfer
-		if (errorIfNotBinDataBlock)
-		{
-			// Read more bytes to compose an error message
-			checkErr(viRead(instrSession, (ViBuf)(header + 1), 24, &retCnt));
-			if (dataPartRead)
-			{
-				header[25] = 0;
-				RsCoreInt_StrcpyMaxLen(dataPartRead, 25, header);
-			}
+	case VI_ATTR_SEND_END_EN:
+		ctx->sendEndEnabled = (ViBoolean)attributeValue;
+		break;
 
-			RsCore_TrimString(header, RS_VAL_TRIM_WHITESPACES);
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Expected Binary data header starting with #(hash),"
-			         " received data '%s'", header);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-		}
-		else
-		{
-			// return null-terminated string of the already read data
-			RsCoreInt_StrcpyMaxLen(dataPartRead, 2, header);
-		}
-	}
+	case VI_ATTR_USER_DATA:
+	case VI_ATTR_WR_BUF_OPER_MODE:
+	case VI_ATTR_RD_BUF_OPER_MODE:
+	case VI_ATTR_SUPPRESS_END_EN:
+		break;
 
-	if (isBinDataBlock)
-		*isBinDataBlock = binDataBlockDetected;
+	default:
+		return VI_ERROR_NSUP_ATTR;
+	}
 
-Error:
-	return error;
+	return VI_SUCCESS;
 }
 
 /*****************************************************************************************************/
-/*  Sends binary data header based on the entered dataSize. The function expects that you continue
-    sending the corresponding binary data block, therefore it also sets VI_ATTR_SEND_END_EN to FALSE
-    !!!Important!!! - send the VI_ATTR_SEND_END_EN back to TRUE after sending the binary data block
+/*  RsCoreInt_SocketGetAttribute
+    Native socket transport: returns the VISA-equivalent attribute
+    The session reports itself as a TCPIP SOCKET resource
 ******************************************************************************************************/
-ViStatus RsCoreInt_SendBinDataHeader(ViSession instrSession, ViConstString command, ViInt64 dataSize)
+ViStatus RsCoreInt_SocketGetAttribute(void* context, ViAttr attributeName, void* attributeValue)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar header[RS_MAX_MESSAGE_LEN];
-	ViInt32 lenOfLen;
-	RsCoreSessionPtr rsSession = NULL;
+	RsCoreSocketContextPtr ctx = (RsCoreSocketContextPtr)context;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	switch (attributeName)
+	{
+	case VI_ATTR_TMO_VALUE:
+		*(ViUInt32*)attributeValue = ctx->timeoutMs;
+		break;
 
+	case VI_ATTR_TERMCHAR:
+		*(ViUInt8*)attributeValue = ctx->termChar;
+		break;
 
-	lenOfLen = snprintf(header, RS_MAX_MESSAGE_LEN,  _PERCLD, dataSize);
-	snprintf(header, RS_MAX_MESSAGE_LEN, "%s" _PERCLD, command, dataSize);
-	if (lenOfLen < 10)
-	{
-		// #512345
-		snprintf(header, RS_MAX_MESSAGE_LEN, "%s#" _PERCU _PERCLD, command, lenOfLen, dataSize);
-	}
-	else
-	{
-		// #(3000000000)
-		snprintf(header, RS_MAX_MESSAGE_LEN, "%s#(" _PERCLD ")", command, dataSize);
-	}
+	case VI_ATTR_TERMCHAR_EN:
+		*(ViBoolean*)attributeValue = ctx->termCharEnabled;
+		break;
 
-	// send header
-	if (rsSession->writeDelay)
-		Sleep(rsSession->writeDelay);
+	case VI_ATTR_SEND_END_EN:
+		*(ViBoolean*)attributeValue = ctx->sendEndEnabled;
+		break;
 
-	(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_FALSE);
-	checkErr(viWrite(instrSession, (ViBuf)header, (ViInt32)strlen(header), NULL));
+	case VI_ATTR_INTF_TYPE:
+		*(ViUInt16*)attributeValue = VI_INTF_TCPIP;
+		break;
 
-Error:
-	return error;
+	case VI_ATTR_RSRC_CLASS:
+		RsCoreInt_StrcpyMaxLen((ViChar*)attributeValue, 256, "SOCKET");
+		break;
+
+	default:
+		return VI_ERROR_NSUP_ATTR;
+	}
+
+	return VI_SUCCESS;
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_GenerateOpcTimeoutError
-    Internal function that generates OPC timeout error if the error == VI_ERROR_TMO
+/*  RsCoreInt_GetOptionsTokenValue
+    Returns VI_TRUE if the option string contains the token (case-insensitive), and the token value
+    Used by transports to read their own option string tokens
 ******************************************************************************************************/
-ViStatus RsCoreInt_GenerateOpcTimeoutError(ViSession instrSession, ViStatus error, ViInt32 opcTimeoutMs)
+ViBoolean RsCoreInt_GetOptionsTokenValue(ViConstString optionsString, ViConstString tokenName, ViInt32 bufferSize, ViChar* tokenValue)
 {
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	RsCoreSessionPtr rsSession;
-	ViUInt32 visaTimeout = 10000;
-	ViInt32 sessionOpcTimeoutMs;
-	ViInt32 len;
+	ViChar token[RS_MAX_MESSAGE_LEN];
+	ViChar name[RS_MAX_MESSAGE_LEN];
+	ViChar value[RS_MAX_MESSAGE_LEN];
+	ViInt32 elementsCount;
+	ViInt32 idx;
 
-	if (error == VI_ERROR_TMO)
-	{
-		(void)RsCore_GetRsSession(instrSession, &rsSession);
-		(void)RsCore_GetVisaTimeout(instrSession, &visaTimeout);
-		(void)RsCore_GetAttributeViInt32(instrSession, NULL, RS_ATTR_OPC_TIMEOUT, 0, &sessionOpcTimeoutMs);
+	if (isNullOrEmpty(optionsString))
+		return VI_FALSE;
 
-		(void)RsCoreInt_ResolveOpcTimeout(instrSession, &opcTimeoutMs);
-		if (opcTimeoutMs == sessionOpcTimeoutMs)
-		{
-			// Entered OPC timeout is equal to the session's OPC timeout
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Waiting for OPC resulted in timeout. OPC timeout is set to " _PERCD " ms. "
-			         "Change it with %s_SetTimeout / %s_SetOpcTimeout. "
-			         "Note, that the OPC Timeout is not the same as VISA Timeout.",
-			         opcTimeoutMs, rsSession->specificPrefix, rsSession->specificPrefix);
-		}
-		else
-		{
-			// Custom OPC timeout
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Waiting for OPC resulted in timeout. Entered timeout: " _PERCD " ms. "
-			         "Note, that the OPC Timeout is not the same as VISA Timeout.", opcTimeoutMs);
-		}
+	elementsCount = RsCore_GetElementsCount(optionsString, ',');
+	for (idx = 0; idx < elementsCount; idx++)
+	{
+		RsCore_GetTokenAtIndex(optionsString, ',', idx, token, RS_MAX_MESSAGE_LEN, NULL);
+		if (!RsCoreInt_SplitTokenToNameAndValue(token, "=", name, value, RS_MAX_MESSAGE_LEN))
+			continue;
 
-		if (rsSession->vxiCapable == VI_TRUE && rsSession->opcWaitMode != RS_VAL_OPCWAIT_OPCQUERY)
+		RsCoreInt_ToLowerCase(name);
+		if (strcmp(name, tokenName) == 0)
 		{
-			// Add VISA timeout value info
-			len = (ViInt32)strlen(errElab);
-			snprintf(errElab + len, RS_MAX_MESSAGE_BUF_SIZE - len, " VISA timeout current value: " _PERCD " ms.", visaTimeout);
+			RsCore_TrimString(value, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+			RsCoreInt_StrcpyMaxLen(tokenValue, bufferSize, value);
+			return VI_TRUE;
 		}
-
-		(void)RsCore_SetErrorInfo(instrSession, VI_TRUE, VI_ERROR_TMO, VI_FALSE, errElab);
 	}
 
-	return error;
+	return VI_FALSE;
 }
 
-/******************************************************************************************************
-------------------------------------------------------------------------------------------------------*
----- INTERNAL VISA IO R/W ----------------------------------------------------------------------------*
-------------------------------------------------------------------------------------------------------*
-******************************************************************************************************/
-
-/******************************************************************************************************
-* Function: RsCoreInt_Read
-* Purpose:  Reads data from the instrument using VISA viRead()
+/*****************************************************************************************************/
+/*  RsCoreInt_VisaWriteSegments
+    Writes all the segments as one VISA message. The END is sent only with the last segment
 ******************************************************************************************************/
-ViStatus RsCoreInt_Read(ViSession instrSession, ViInt32 bufferSize, ViByte* readBuffer, ViInt32* bytesRead)
+ViStatus RsCoreInt_VisaWriteSegments(ViSession io, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount)
 {
 	ViStatus error = VI_SUCCESS;
-	ViUInt32 retCnt = 0;
-	RsCoreSessionPtr rsSession = NULL;
+	ViUInt32 idx;
+	ViUInt32 written, totalWritten = 0;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (segmentsCount == 1)
+		return viWrite(io, segments[0].data, segments[0].count, retCount);
 
-	if (RsCore_Simulating(instrSession))
+	for (idx = 0; idx < segmentsCount; idx++)
 	{
-		*bytesRead = 0;
-		if (bufferSize > 0)
-			readBuffer[0] = 0;
-
-		return error;
+		checkErr(viSetAttribute(io, VI_ATTR_SEND_END_EN, (idx == segmentsCount - 1) ? VI_TRUE : VI_FALSE));
+		checkErr(viWrite(io, segments[idx].data, segments[idx].count, &written));
+		totalWritten += written;
 	}
 
-	if (rsSession->readDelay)
-		Sleep(rsSession->readDelay);
-
-	error = viRead(instrSession, (ViBuf)readBuffer, bufferSize, &retCnt);
-
-	if (error == VI_SUCCESS_TERM_CHAR)
-		error = VI_SUCCESS;
-
-	if (error == VI_ERROR_TMO)
-		(void)RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_Read", NULL);
+Error:
+	if (error < VI_SUCCESS)
+		(void)viSetAttribute(io, VI_ATTR_SEND_END_EN, VI_TRUE);
 
-	if (bytesRead)
-		*bytesRead = retCnt;
+	if (retCount)
+		*retCount = totalWritten;
 
-Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_ReadDataKnownLength
-    Reads data of the entered length to the provided allocated buffer
-    Reading is done in chunks with maximum of rsSession->ioSegmentSize
-    This function is used to read binary data blocks
+/*  RsCoreInt_DelayMicroseconds
+    Suspends the calling thread for the entered time. On Windows, the resolution is 1 ms
 ******************************************************************************************************/
-ViStatus RsCoreInt_ReadDataKnownLength(ViSession instrSession, ViInt64 length, ViByte* buffer)
+void RsCoreInt_DelayMicroseconds(ViUInt64 delayUs)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	ViInt32 chunkSize;
-	ViByte* p2buffer;
-	ViUInt32 retCnt;
-	ViInt32 stb;
-	RsCoreSessionPtr rsSession = NULL;
+#if defined(ANSI)
+	if (delayUs >= 1000)
+		Sleep((DWORD)(delayUs / 1000));
+#else
+	struct timespec delay;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	delay.tv_sec = (time_t)(delayUs / 1000000);
+	delay.tv_nsec = (long)(delayUs % 1000000) * 1000;
+	while (nanosleep(&delay, &delay) != 0 && errno == EINTR);
+#endif
+}
 
-	if (RsCore_Simulating(instrSession))
-	{
-		*buffer = 0;
-		return error;
-	}
+/*****************************************************************************************************/
+/*  RsCoreInt_VisaOpen
+    VISA transport: opens the VISA session. The VISA transport serves as the inner transport of the record transport.
+    Sessions with the default 'Transport=VISA' do not use it, they call VISA directly
+******************************************************************************************************/
+ViStatus RsCoreInt_VisaOpen(ViRsrc resourceName, ViConstString optionsString, void** context)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreVisaContextPtr ctx = NULL;
 
-	chunkSize = rsSession->ioSegmentSize;
+	*context = NULL;
+	if ((ctx = (RsCoreVisaContextPtr)calloc(1, sizeof(RsCoreVisaContext))) == NULL)
+		return VI_ERROR_ALLOC;
 
-	// If data size is 0
-	if (length == 0)
-	{
-		// Just flushing of the data
-		if (rsSession->vxiCapable)
-		{
-			checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
-			if ((stb & IEEE_488_2_STB_MAV_MASK) > 0)
-			{
-				checkErr(RsCoreInt_FlushData(instrSession, VI_FALSE));
-			}
-		}
-		else
-		{
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
-			checkErr(RsCoreInt_FlushData(instrSession, VI_FALSE));
-		}
-	}
-	else if (length < chunkSize)
-	{
-		// All data can be read in one segment
-		checkErr(viRead(instrSession, (ViPBuf)buffer, (ViUInt32)length, &retCnt));
-		if (length != retCnt)
-		{
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Unexpected number of bytes read. Expected " _PERCLD " bytes, read " _PERCU " bytes", length, retCnt);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-		}
-	}
-	else
-	{
-		// Segmented reading loop
-		ViInt64 remaining = length;
-		p2buffer = buffer;
-		do
-		{
-			if (remaining > chunkSize)
-			{
-				checkErr(viRead(instrSession, (ViPBuf)p2buffer, chunkSize, &retCnt));
-				remaining -= retCnt;
-				p2buffer += retCnt;
-			}
-			else
-			{
-				checkErr(viRead(instrSession, (ViPBuf)p2buffer, (ViUInt32)remaining, &retCnt));
-				remaining -= retCnt;
-				break;
-			}
-		} while (1);
-		if (remaining != 0)
-		{
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Unexpected number of bytes read. Expected " _PERCLD " bytes, read " _PERCLD " bytes", length, length - remaining);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-		}
-	}
+	checkErr(viOpenDefaultRM(&ctx->rmSession));
+	checkErr(viOpen(ctx->rmSession, resourceName, 0, 0, &ctx->io));
 
-	if (error == VI_SUCCESS_MAX_CNT) // Flush remaining data
-	{
-		error = VI_SUCCESS;
-		if (!rsSession->vxiCapable)
-		{
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
-		}
+	/* Configure VISA Formatted I/O */
+	checkErr(viSetBuf(ctx->io, (ViUInt16)(VI_READ_BUF | VI_WRITE_BUF), 4000));
+	checkErr(viSetAttribute(ctx->io, VI_ATTR_WR_BUF_OPER_MODE, VI_FLUSH_ON_ACCESS));
+	checkErr(viSetAttribute(ctx->io, VI_ATTR_RD_BUF_OPER_MODE, VI_FLUSH_ON_ACCESS));
 
-		checkErr(RsCoreInt_FlushData(instrSession, VI_TRUE));
-	}
+	*context = ctx;
+	ctx = NULL;
 
 Error:
-	if (error == VI_SUCCESS_TERM_CHAR)
-		error = VI_SUCCESS;
-
-	if (error == VI_ERROR_TMO)
-		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_ReadDataKnownLength", NULL);
+	if (ctx != NULL)
+		RsCoreInt_VisaClose(ctx);
 
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_ReadDataUnknownLength
-    Reads data from the instrument and returns the allocated buffer with the read data
-    The outputBuffer is always at least +1 byte bigger than the returned byteCount, and the empty place is padded with nulls.
-    Therefore, you can treat the buffer as a null-terminated string.
-    WARNING!!! - Deallocate the outputBuffer after use.
-    Note! Do not use for reading binary data, for that purpose use the RsCore_ReadBinaryDataBlock... functions
+/*  RsCoreInt_VisaClose
+    VISA transport: closes the VISA session and the resource manager
 ******************************************************************************************************/
-ViStatus RsCoreInt_ReadDataUnknownLength(ViSession instrSession, ViByte** outputBuffer, ViInt64* byteCount)
+void RsCoreInt_VisaClose(void* context)
 {
-	ViStatus error = VI_SUCCESS;
-	ViUInt32 retCnt = 0;
-	ViUInt32 chunkSize;
-	ViByte *buffer = NULL, *p2buffer;
-	ViInt64 actualSize;
-	ViBoolean moreDataAvailable;
-	RsCoreSessionPtr rsSession = NULL;
+	RsCoreVisaContextPtr ctx = (RsCoreVisaContextPtr)context;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (ctx == NULL)
+		return;
 
-	if (RsCore_Simulating(instrSession))
-	{
-		*byteCount = 0;
-		viCheckAllocElab(buffer = (ViByte *)calloc((size_t)(*byteCount + 1), sizeof(ViByte)),
-			"RsCore_ReadViStringUnknownLength simulation buffer allocation");
-		buffer[0] = '\0';
-		*outputBuffer = buffer;
-		return error;
-	}
+	if (ctx->io)
+		(void)viClose(ctx->io);
 
-	*outputBuffer = NULL;
+	if (ctx->rmSession)
+		(void)viClose(ctx->rmSession);
 
-	if (byteCount)
-		*byteCount = 0;
+	free(ctx);
+}
 
-	// Start reading with a small chunk (1024 bytes), then increase it up to rsSession->ioSegmentSize
-    chunkSize = rsSession->ioSegmentSize < 1024 ? rsSession->ioSegmentSize < 1024 : 1024;
-    chunkSize = chunkSize < RS_MAX_MESSAGE_BUF_SIZE ? chunkSize : RS_MAX_MESSAGE_BUF_SIZE;
+/*****************************************************************************************************/
+/*  RsCoreInt_Visa... IO functions
+    VISA transport: direct calls of the VISA functions
+******************************************************************************************************/
+ViStatus RsCoreInt_VisaWrite(void* context, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount)
+{
+	return RsCoreInt_VisaWriteSegments(((RsCoreVisaContextPtr)context)->io, segments, segmentsCount, retCount);
+}
 
-	// Allocate Buffer
-	viCheckAllocElab(buffer = (ViByte *)calloc(chunkSize, sizeof(ViByte)), "RsCore_ReadViStringUnknownLength buffer allocation");
+ViStatus RsCoreInt_VisaRead(void* context, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount)
+{
+	return viRead(((RsCoreVisaContextPtr)context)->io, buffer, count, retCount);
+}
 
-	// Only apply the read delay once at the beginning
-	if (rsSession->readDelay)
-		Sleep(rsSession->readDelay);
+ViStatus RsCoreInt_VisaReadStb(void* context, ViPUInt16 stb)
+{
+	return viReadSTB(((RsCoreVisaContextPtr)context)->io, stb);
+}
 
-	actualSize = 0;
-	p2buffer = buffer;
+ViStatus RsCoreInt_VisaClear(void* context)
+{
+	return viClear(((RsCoreVisaContextPtr)context)->io);
+}
+
+ViStatus RsCoreInt_VisaSetAttribute(void* context, ViAttr attributeName, ViAttrState attributeValue)
+{
+	return viSetAttribute(((RsCoreVisaContextPtr)context)->io, attributeName, attributeValue);
+}
+
+ViStatus RsCoreInt_VisaGetAttribute(void* context, ViAttr attributeName, void* attributeValue)
+{
+	return viGetAttribute(((RsCoreVisaContextPtr)context)->io, attributeName, attributeValue);
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_IoLogWriteRecord
+    Appends one record to the record transport log. The data is the concatenation of the segments
+******************************************************************************************************/
+ViStatus RsCoreInt_IoLogWriteRecord(FILE* file, ViByte type, ViStatus status, ViReal64 durationMs,
+                                    const RsCoreIoSegment segments[], ViUInt32 segmentsCount)
+{
+	ViByte header[32];
+	ViInt32 headerLen = 0;
+	ViUInt64 value;
+	ViUInt64 length = 0;
+	ViUInt32 idx;
+
+	for (idx = 0; idx < segmentsCount; idx++)
+		length += segments[idx].count;
+
+	header[headerLen++] = type;
+	header[headerLen++] = (ViByte)((ViUInt32)status & 0xFF);
+	header[headerLen++] = (ViByte)(((ViUInt32)status >> 8) & 0xFF);
+	header[headerLen++] = (ViByte)(((ViUInt32)status >> 16) & 0xFF);
+	header[headerLen++] = (ViByte)(((ViUInt32)status >> 24) & 0xFF);
+
+	// Duration and length as LEB128 varints
+	value = (durationMs > 0.0) ? (ViUInt64)(durationMs * 1000.0 + 0.5) : 0;
 	do
 	{
-		moreDataAvailable = VI_FALSE;
-		checkErr(viRead(instrSession, (ViPBuf)p2buffer, chunkSize, &retCnt));
-		actualSize += retCnt;
-		if (error == VI_SUCCESS_MAX_CNT)
-		{
-			// VISA reports more data is available, read further
-			moreDataAvailable = VI_TRUE;
-		}
-		else
-		{
-			// VISA reports no more data available. To be sure, check the returned count
-			if (retCnt == (ViUInt32)chunkSize)
-			{
-				// Check the last read character. If it is not LF, more data is available
-				if (p2buffer[retCnt - 1] != '\n')
-					moreDataAvailable = VI_TRUE;
-			}
-		}
+		header[headerLen++] = (ViByte)((value & 0x7F) | (value > 0x7F ? 0x80 : 0));
+		value >>= 7;
+	} while (value > 0);
 
-		if (!moreDataAvailable)
-			break; // stop the reading, the data was all read
+	value = length;
+	do
+	{
+		header[headerLen++] = (ViByte)((value & 0x7F) | (value > 0x7F ? 0x80 : 0));
+		value >>= 7;
+	} while (value > 0);
 
-		// Increase the chunk size gradually
-		chunkSize *= 4;
-		if (chunkSize > (ViUInt32)rsSession->ioSegmentSize)
-            chunkSize = rsSession->ioSegmentSize;
+	if (fwrite(header, 1, (size_t)headerLen, file) != (size_t)headerLen)
+		return VI_ERROR_FILE_ACCESS;
 
-		// Reallocate the buffer, the old content stays untouched. + 1 byte to have space for a null-terminator
-		viCheckAllocElab(buffer = (ViByte *)realloc(buffer, (size_t)(actualSize + chunkSize + 1)),
-			"RsCore_ReadViStringUnknownLength buffer re-allocation");
-		p2buffer = buffer + actualSize; /* Set pointer to end of data in reallocated buffer */
-		memset(p2buffer, 0, chunkSize + 1); // fill the added part with nulls
-	} while (1);
+	for (idx = 0; idx < segmentsCount; idx++)
+	{
+		if (segments[idx].count > 0 && fwrite(segments[idx].data, 1, segments[idx].count, file) != segments[idx].count)
+			return VI_ERROR_FILE_ACCESS;
+	}
 
-	*outputBuffer = buffer;
-	if (byteCount != NULL)
-		*byteCount = actualSize;
+	return VI_SUCCESS;
+}
 
-Error:
-	if (error < 0)
+/*****************************************************************************************************/
+/*  RsCoreInt_IoLogReadRecord
+    Returns the next record of the replay transport log. The data points into the loaded log.
+    If the replay timing is ON, waits for the recorded IO duration.
+    Returns VI_ERROR_CONN_LOST at the end of the log, and VI_ERROR_IO if the record type differs from the expected one
+******************************************************************************************************/
+ViStatus RsCoreInt_IoLogReadRecord(RsCoreReplayContextPtr ctx, ViByte expectedType, ViStatus* status, ViByte** data, ViUInt64* length)
+{
+	ViByte* p2record = ctx->log + ctx->position;
+	ViByte* p2end = ctx->log + ctx->size;
+	ViUInt64 durationUs = 0;
+	ViInt32 shift;
+
+	if (p2record + 5 > p2end)
+		return VI_ERROR_CONN_LOST;
+
+	if (p2record[0] != expectedType)
+		return VI_ERROR_IO;
+
+	*status = (ViStatus)((ViUInt32)p2record[1] | ((ViUInt32)p2record[2] << 8) | ((ViUInt32)p2record[3] << 16) | ((ViUInt32)p2record[4] << 24));
+	p2record += 5;
+
+	for (shift = 0; p2record < p2end; shift += 7)
 	{
-		if (buffer)
-			free(buffer);
+		durationUs |= (ViUInt64)(*p2record & 0x7F) << shift;
+		if ((*p2record++ & 0x80) == 0)
+			break;
+	}
 
-		*outputBuffer = NULL;
+	*length = 0;
+	for (shift = 0; p2record < p2end; shift += 7)
+	{
+		*length |= (ViUInt64)(*p2record & 0x7F) << shift;
+		if ((*p2record++ & 0x80) == 0)
+			break;
 	}
 
-	if (error == VI_SUCCESS_TERM_CHAR)
-		error = VI_SUCCESS;
+	if (*length > (ViUInt64)(p2end - p2record))
+		return VI_ERROR_IO;
 
-	if (error == VI_ERROR_TMO)
-		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCore_ReadViStringUnknownLength", NULL);
+	*data = p2record;
+	ctx->position = (ViUInt64)(p2record - ctx->log) + *length;
 
-	return error;
+	if (ctx->timing)
+		RsCoreInt_DelayMicroseconds(durationUs);
+
+	return VI_SUCCESS;
 }
 
 /*****************************************************************************************************/
-/*  Reads data of the entered length into the provided file
-    Reading is done in chunks with maximum of rsSession->ioSegmentSize
-    If you do not need the return value bytesWritten, set it to NULL
-    This function is used to read binary data blocks
+/*  RsCoreInt_RecordOpen
+    Record transport: opens the inner transport and creates the log file
+    Option string tokens:
+    - RecordFile: log file path, mandatory
+    - RecordTransport: inner transport 'VISA' (default) or 'Socket'
 ******************************************************************************************************/
-ViStatus RsCoreInt_ReadDataKnownLengthToFile(ViSession instrSession, ViInt64 length, FILE* file, ViInt64* bytesWritten)
+ViStatus RsCoreInt_RecordOpen(ViRsrc resourceName, ViConstString optionsString, void** context)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	ViInt32 chunkSize;
-	ViChar* buffer = NULL;
-	ViUInt32 retCnt;
-	ViInt64 written;
-	ViInt32 stb;
-	RsCoreSessionPtr rsSession = NULL;
+	ViChar fileName[RS_MAX_MESSAGE_LEN];
+	ViChar innerName[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar rsrcClass[256] = "";
+	ViByte header[RS_IOLOG_MAGIC_LEN + 3];
+	ViUInt16 intfType = VI_INTF_TCPIP;
+	ViByte classLen;
+	RsCoreRecordContextPtr ctx = NULL;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	*context = NULL;
+	if (!RsCoreInt_GetOptionsTokenValue(optionsString, "recordfile", RS_MAX_MESSAGE_LEN, fileName))
+		return VI_ERROR_INV_SETUP;
 
-	if (RsCore_Simulating(instrSession))
-	{
-		if (bytesWritten)
-			*bytesWritten = length;
+	if ((ctx = (RsCoreRecordContextPtr)calloc(1, sizeof(RsCoreRecordContext))) == NULL)
+		return VI_ERROR_ALLOC;
 
-		return error;
+	ctx->inner = &gVisaTransport;
+	if (RsCoreInt_GetOptionsTokenValue(optionsString, "recordtransport", RS_MAX_SHORT_MESSAGE_BUF_SIZE, innerName))
+	{
+		RsCoreInt_ToLowerCase(innerName);
+		if (strcmp(innerName, gSocketTransport.name) == 0)
+			ctx->inner = &gSocketTransport;
+		else if (strcmp(innerName, gVisaTransport.name) != 0)
+		{
+			error = VI_ERROR_INV_SETUP;
+			goto Error;
+		}
 	}
 
-	chunkSize = rsSession->ioSegmentSize;
+	checkErr(ctx->inner->open(resourceName, optionsString, &ctx->innerContext));
+	(void)ctx->inner->getAttribute(ctx->innerContext, VI_ATTR_INTF_TYPE, &intfType);
+	(void)ctx->inner->getAttribute(ctx->innerContext, VI_ATTR_RSRC_CLASS, rsrcClass);
 
-	// If data size is 0
-	if (length == 0)
+	if ((ctx->file = fopen(fileName, "wb")) == NULL)
 	{
-		// Just flushing of the data
-		if (rsSession->vxiCapable)
-		{
-			checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
-			if ((stb & IEEE_488_2_STB_MAV_MASK) > 0)
-			{
-				checkErr(RsCoreInt_FlushData(instrSession, VI_FALSE));
-			}
-		}
-		else
-		{
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
-			checkErr(RsCoreInt_FlushData(instrSession, VI_FALSE));
-		}
+		error = VI_ERROR_FILE_ACCESS;
+		goto Error;
 	}
-	else if (length < chunkSize)
+
+	(void)setvbuf(ctx->file, NULL, _IOFBF, RS_IOLOG_FILE_BUFFER_SIZE);
+
+	classLen = (ViByte)strlen(rsrcClass);
+	memcpy(header, RS_IOLOG_MAGIC, RS_IOLOG_MAGIC_LEN);
+	header[RS_IOLOG_MAGIC_LEN] = (ViByte)(intfType & 0xFF);
+	header[RS_IOLOG_MAGIC_LEN + 1] = (ViByte)(intfType >> 8);
+	header[RS_IOLOG_MAGIC_LEN + 2] = classLen;
+	if (fwrite(header, 1, sizeof(header), ctx->file) != sizeof(header) || fwrite(rsrcClass, 1, classLen, ctx->file) != classLen)
 	{
-		// All data can be read in one segment
-		viCheckAllocElab(buffer = (ViChar *)malloc((ViInt32)length), "ReadDataKnownLengthToFile: Allocation of a buffer for reading to file");
-		checkErr(viRead(instrSession, (ViPBuf)buffer, (ViUInt32)length, &retCnt));
+		error = VI_ERROR_FILE_ACCESS;
+		goto Error;
+	}
 
-		if (length != retCnt)
-		{
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Unexpected number of bytes read. Expected " _PERCLD " bytes, read " _PERCU " bytes", length, retCnt);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-		}
+	*context = ctx;
+	ctx = NULL;
 
-		written = (ViInt32)fwrite(buffer, sizeof(ViByte), (size_t)retCnt, file);
-		if (length != written)
-		{
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Unexpected number of bytes written to file. Expected " _PERCLD " bytes, written " _PERCLD " bytes", length, written);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-		}
+Error:
+	if (ctx != NULL)
+		RsCoreInt_RecordClose(ctx);
 
-		if (bytesWritten)
-			*bytesWritten = length;
-	}
-	else
-	{
-		// Segmented reading loop
-		viCheckAllocElab(buffer = (ViChar *)malloc(chunkSize), "ReadDataKnownLengthToFile: Allocation of a chunk-size buffer for reading to file");
-		ViInt64 remaining = length;
-		do
-		{
-			if (remaining > chunkSize)
-			{
-				checkErr(viRead(instrSession, (ViPBuf)buffer, chunkSize, &retCnt));
-				written = (ViInt32)fwrite(buffer, sizeof(ViByte), (size_t)retCnt, file);
-				remaining -= written;
-			}
-			else
-			{
-				checkErr(viRead(instrSession, (ViPBuf)buffer, (ViUInt32)remaining, &retCnt));
-				written = (ViInt32)fwrite(buffer, sizeof(ViByte), (size_t)retCnt, file);
-				remaining -= written;
-				break;
-			}
-		} while (1);
+	return error;
+}
 
-		if (bytesWritten)
-			*bytesWritten = length - remaining;
+/*****************************************************************************************************/
+/*  RsCoreInt_RecordClose
+    Record transport: flushes and closes the log file, closes the inner transport
+******************************************************************************************************/
+void RsCoreInt_RecordClose(void* context)
+{
+	RsCoreRecordContextPtr ctx = (RsCoreRecordContextPtr)context;
 
-		if (remaining != 0)
-		{
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Unexpected number of bytes written to file. Expected " _PERCLD " bytes, written " _PERCLD " bytes", length, length - remaining);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-		}
-	}
+	if (ctx == NULL)
+		return;
 
-	if (error == VI_SUCCESS_MAX_CNT) // flush remaining data
-	{
-		error = VI_SUCCESS;
-		if (!rsSession->vxiCapable)
-		{
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
-		}
-		checkErr(RsCoreInt_FlushData(instrSession, VI_FALSE));
-	}
+	if (ctx->file != NULL)
+		fclose(ctx->file);
 
-Error:
-	if (buffer != NULL)
-		free(buffer);
+	if (ctx->innerContext != NULL)
+		ctx->inner->close(ctx->innerContext);
 
-	if (error == VI_SUCCESS_TERM_CHAR)
-		error = VI_SUCCESS;
+	free(ctx);
+}
 
-	if (error == VI_ERROR_TMO)
-		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_ReadDataKnownLengthToFile", NULL);
+/*****************************************************************************************************/
+/*  RsCoreInt_RecordWrite
+    Record transport: writes with the inner transport and logs the written data
+******************************************************************************************************/
+ViStatus RsCoreInt_RecordWrite(void* context, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount)
+{
+	RsCoreRecordContextPtr ctx = (RsCoreRecordContextPtr)context;
+	ViReal64 startMs = RsCoreInt_GetTickCountMs();
+	ViStatus error;
+
+	error = ctx->inner->write(ctx->innerContext, segments, segmentsCount, retCount);
+	(void)RsCoreInt_IoLogWriteRecord(ctx->file, RS_IOLOG_RECORD_WRITE, error, RsCoreInt_GetTickCountMs() - startMs, segments, segmentsCount);
 
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_ReadBinaryDataBlock
-    Reads binary data of unknown size from the instrument.
-    If errorIfNotBinDataBlock == TRUE, the function generates error in case the
-    data is not binary block (not starting with '#')
-    If errorIfNotBinDataBlock == FALSE, the function returns read data and indicates isBinDataBlock = FALSE.
-    If you do not need the isBinDataBlock info, set the pointer to NULL
-    WARNING!!! Deallocate the outputBuffer after use
+/*  RsCoreInt_RecordRead
+    Record transport: reads with the inner transport and logs the returned data and status
 ******************************************************************************************************/
-ViStatus RsCoreInt_ReadBinaryDataBlock(ViSession instrSession,
-                                       ViBoolean errorIfNotBinDataBlock, ViBoolean* isBinDataBlock,
-                                       ViByte** outputBuffer, ViInt64* byteCount)
+ViStatus RsCoreInt_RecordRead(void* context, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount)
+{
+	RsCoreRecordContextPtr ctx = (RsCoreRecordContextPtr)context;
+	ViReal64 startMs = RsCoreInt_GetTickCountMs();
+	ViUInt32 readCount = 0;
+	RsCoreIoSegment segment;
+	ViStatus error;
+
+	error = ctx->inner->read(ctx->innerContext, buffer, count, &readCount);
+	segment.data = buffer;
+	segment.count = readCount;
+	(void)RsCoreInt_IoLogWriteRecord(ctx->file, RS_IOLOG_RECORD_READ, error, RsCoreInt_GetTickCountMs() - startMs, &segment, 1);
+
+	if (retCount)
+		*retCount = readCount;
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_RecordReadStb
+    Record transport: reads the status byte with the inner transport and logs it
+******************************************************************************************************/
+ViStatus RsCoreInt_RecordReadStb(void* context, ViPUInt16 stb)
+{
+	RsCoreRecordContextPtr ctx = (RsCoreRecordContextPtr)context;
+	ViReal64 startMs = RsCoreInt_GetTickCountMs();
+	ViByte stbBytes[2];
+	RsCoreIoSegment segment;
+	ViStatus error;
+
+	*stb = 0;
+	error = ctx->inner->readStb(ctx->innerContext, stb);
+	stbBytes[0] = (ViByte)(*stb & 0xFF);
+	stbBytes[1] = (ViByte)(*stb >> 8);
+	segment.data = stbBytes;
+	segment.count = 2;
+	(void)RsCoreInt_IoLogWriteRecord(ctx->file, RS_IOLOG_RECORD_READ_STB, error, RsCoreInt_GetTickCountMs() - startMs, &segment, 1);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_RecordClear
+    Record transport: clears with the inner transport and logs it
+******************************************************************************************************/
+ViStatus RsCoreInt_RecordClear(void* context)
+{
+	RsCoreRecordContextPtr ctx = (RsCoreRecordContextPtr)context;
+	ViReal64 startMs = RsCoreInt_GetTickCountMs();
+	ViStatus error;
+
+	error = ctx->inner->clear(ctx->innerContext);
+	(void)RsCoreInt_IoLogWriteRecord(ctx->file, RS_IOLOG_RECORD_CLEAR, error, RsCoreInt_GetTickCountMs() - startMs, NULL, 0);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_Record...Attribute
+    Record transport: attributes are not logged, they are passed to the inner transport
+******************************************************************************************************/
+ViStatus RsCoreInt_RecordSetAttribute(void* context, ViAttr attributeName, ViAttrState attributeValue)
+{
+	RsCoreRecordContextPtr ctx = (RsCoreRecordContextPtr)context;
+
+	return ctx->inner->setAttribute(ctx->innerContext, attributeName, attributeValue);
+}
+
+ViStatus RsCoreInt_RecordGetAttribute(void* context, ViAttr attributeName, void* attributeValue)
+{
+	RsCoreRecordContextPtr ctx = (RsCoreRecordContextPtr)context;
+
+	return ctx->inner->getAttribute(ctx->innerContext, attributeName, attributeValue);
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_ReplayOpen
+    Replay transport: loads the log recorded by the record transport. The resource name is not used.
+    Option string tokens:
+    - RecordFile: log file path, mandatory
+    - ReplayTiming: if TRUE, each IO call lasts as long as the recorded one. Default: FALSE
+******************************************************************************************************/
+ViStatus RsCoreInt_ReplayOpen(ViRsrc resourceName, ViConstString optionsString, void** context)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt64 length = 0;
-	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE];
-	ViChar *stringBuffer = NULL, *completeStringBuffer = NULL;
-	ViBoolean binDataBlockDetected = VI_FALSE;
-	RsCoreSessionPtr rsSession = NULL;
-	
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
-	*outputBuffer = NULL;
-	*byteCount = 0;
-	checkErr(RsCoreInt_ParseBinaryDataHeader(instrSession, errorIfNotBinDataBlock, &binDataBlockDetected, &length, buffer));
-	if (length > 2147483646)
+	ViChar fileName[RS_MAX_MESSAGE_LEN];
+	ViChar tokenValue[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	RsCoreReplayContextPtr ctx = NULL;
+	FILE* file = NULL;
+	long fileSize;
+	ViByte classLen;
+
+	*context = NULL;
+	if (!RsCoreInt_GetOptionsTokenValue(optionsString, "recordfile", RS_MAX_MESSAGE_LEN, fileName))
+		return VI_ERROR_INV_SETUP;
+
+	if ((ctx = (RsCoreReplayContextPtr)calloc(1, sizeof(RsCoreReplayContext))) == NULL)
+		return VI_ERROR_ALLOC;
+
+	if (RsCoreInt_GetOptionsTokenValue(optionsString, "replaytiming", RS_MAX_SHORT_MESSAGE_BUF_SIZE, tokenValue))
+		ctx->timing = RsCore_Convert_String_To_Boolean(tokenValue);
+
+	ctx->timeoutMs = 2000;
+	ctx->termChar = '\n';
+	ctx->sendEndEnabled = VI_TRUE;
+
+	// Load the complete log
+	if ((file = fopen(fileName, "rb")) == NULL || fseek(file, 0, SEEK_END) != 0 || (fileSize = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0)
 	{
-		snprintf(buffer, RS_MAX_MESSAGE_BUF_SIZE,
-		         "ReadBinaryDataBlock: parsed length " _PERCLD " is bigger than maximum supported length of Int32 Max 2147483646 bytes", length);
-		viCheckErrElab(RS_ERROR_DATA_TOO_LONG, buffer);
+		error = VI_ERROR_FILE_ACCESS;
+		goto Error;
 	}
 
-	if (binDataBlockDetected == VI_FALSE)
+	ctx->size = (ViUInt64)fileSize;
+	if ((ctx->log = (ViByte*)malloc((size_t)ctx->size + 1)) == NULL)
 	{
-		// Unrecognized binary header, treat it like an ASCII transfer
-		checkErr(RsCore_ReadViStringUnknownLength(instrSession, &stringBuffer));
-		checkErr(RsCore_StrCatDynamicString(instrSession, &completeStringBuffer, buffer, stringBuffer, NULL));
-		*outputBuffer = (ViByte*)completeStringBuffer;
-		*byteCount = (ViInt64)strlen(completeStringBuffer);
+		error = VI_ERROR_ALLOC;
 		goto Error;
 	}
 
-	if (rsSession->vxiCapable != VI_TRUE)
+	if (fread(ctx->log, 1, (size_t)ctx->size, file) != (size_t)ctx->size)
 	{
-		// Confirmed binary transfer, switch the read termination character OFF
-		checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_FALSE));
+		error = VI_ERROR_FILE_ACCESS;
+		goto Error;
 	}
 
-	if (length == 0) // Indicated null data size, read and discard all that is available
+	if (ctx->size < RS_IOLOG_MAGIC_LEN + 3 || memcmp(ctx->log, RS_IOLOG_MAGIC, RS_IOLOG_MAGIC_LEN) != 0)
 	{
-		viCheckAllocElab(*outputBuffer = (ViByte*)malloc(1), "ReadBinaryDataBlock: Allocation of buffer for empty binary data.");
-		*byteCount = 1;
-		checkErr(RsCoreInt_ReadDataKnownLength(instrSession, 1, *outputBuffer));
+		error = VI_ERROR_INV_SETUP;
+		goto Error;
 	}
-	else if (length > 0) // Binary known length
+
+	ctx->intfType = (ViUInt16)(ctx->log[RS_IOLOG_MAGIC_LEN] | (ctx->log[RS_IOLOG_MAGIC_LEN + 1] << 8));
+	classLen = ctx->log[RS_IOLOG_MAGIC_LEN + 2];
+	ctx->position = RS_IOLOG_MAGIC_LEN + 3 + classLen;
+	if (ctx->position > ctx->size)
 	{
-		viCheckAllocElab(*outputBuffer = (ViByte*)malloc((size_t)(length + 1)), "ReadBinaryDataBlock: Allocation of buffer for binary data of known size.");
-		checkErr(RsCoreInt_ReadDataKnownLength(instrSession, length, *outputBuffer));
-		*byteCount = length;
+		error = VI_ERROR_INV_SETUP;
+		goto Error;
 	}
-	else if (length == -1) // Long data of unknown size, treat it like data unknown size
-	{
-		if (rsSession->vxiCapable == VI_FALSE)
-		{
-			viCheckErrElab(RS_ERROR_SESSION_TYPE_NOT_SUPPORTED,
-				"ReadBinaryDataBlock: Binary data block with unknown length is not supported on non-VXI11 interfaces");
-		}
 
-		checkErr(RsCoreInt_ReadDataUnknownLength(instrSession, outputBuffer, byteCount));
-	}
+	memcpy(ctx->rsrcClass, ctx->log + RS_IOLOG_MAGIC_LEN + 3, classLen);
+	ctx->rsrcClass[classLen] = 0;
 
-Error:
-	if (stringBuffer)
-		free(stringBuffer);
+	// The TCPIP SOCKET and ASRL sessions read with the termination character
+	ctx->termCharEnabled = (strcmp(ctx->rsrcClass, "SOCKET") == 0) ? VI_TRUE : VI_FALSE;
 
-	if (isBinDataBlock)
-		*isBinDataBlock = binDataBlockDetected;
+	*context = ctx;
+	ctx = NULL;
 
-	if (rsSession->vxiCapable != VI_TRUE)
-	{
-		viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE);
-	}
+Error:
+	if (file != NULL)
+		fclose(file);
+
+	if (ctx != NULL)
+		RsCoreInt_ReplayClose(ctx);
 
 	return error;
 }
 
 /*****************************************************************************************************/
-/*---------------------------------------------------------------------------------------------------*/
-/*---- INTERNAL VISA IO R/W with OPC sync -----------------------------------------------------------*/
-/*---------------------------------------------------------------------------------------------------*/
-/*****************************************************************************************************/
+/*  RsCoreInt_ReplayClose
+    Replay transport: frees the loaded log
+******************************************************************************************************/
+void RsCoreInt_ReplayClose(void* context)
+{
+	RsCoreReplayContextPtr ctx = (RsCoreReplayContextPtr)context;
+
+	if (ctx == NULL)
+		return;
+
+	if (ctx->log)
+		free(ctx->log);
+
+	free(ctx);
+}
 
 /*****************************************************************************************************/
-/*  RsCoreInt_WriteWithOpc
-    Internal function to write a command with OPC. The command length is unlimited
-    Set the parameter 'timeoutMs' to 0 in order to use the current session's OPC timeout.
-    You can not use this function to send a query for non-VXI11 sessions or WaitOpcMode=OpcQuery
+/*  RsCoreInt_ReplayWrite
+    Replay transport: the written data must be identical to the recorded write, otherwise it returns VI_ERROR_IO
 ******************************************************************************************************/
-ViStatus RsCoreInt_WriteWithOpc(ViSession instrSession, ViConstString command,
-                                ViBoolean allowCheckStatus, ViInt32 opcTimeoutMs)
+ViStatus RsCoreInt_ReplayWrite(void* context, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE] = "";
-	ViChar* dynBuffer = NULL;
-	ViChar* p2SendBuffer;
-	ViBoolean hasLF, tooLong;
-	ViInt32 cmdLen, bufferSize;
-	RsCoreOpcAttrCallback p2opcFunction;
-	void* value;
-	ViUInt32 oldVisaTimeoutMs = 0;
-	ViBoolean clearEsr = VI_TRUE;
-	RsCoreSessionPtr rsSession = NULL;
+	RsCoreReplayContextPtr ctx = (RsCoreReplayContextPtr)context;
+	ViStatus recordedStatus;
+	ViByte* data;
+	ViUInt64 length;
+	ViUInt64 offset = 0;
+	ViUInt32 idx;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (retCount)
+		*retCount = 0;
 
-	if (command == NULL)
+	checkErr(RsCoreInt_IoLogReadRecord(ctx, RS_IOLOG_RECORD_WRITE, &recordedStatus, &data, &length));
+	for (idx = 0; idx < segmentsCount; idx++)
 	{
-		viCheckErrElab(RS_ERROR_INVALID_VALUE, "RsCoreInt_WriteWithOpc: input parameter command is NULL");
-	}
+		if (offset + segments[idx].count > length || memcmp(data + offset, segments[idx].data, segments[idx].count) != 0)
+			return VI_ERROR_IO;
 
-	cmdLen = (ViInt32)strlen(command);
-	if (cmdLen == 0)
-	{
-		viCheckErrElab(RS_ERROR_INVALID_VALUE, "RsCoreInt_WriteWithOpc: input parameter command string is empty");
+		offset += segments[idx].count;
 	}
 
-	checkErr(RsCoreInt_ResolveOpcTimeout(instrSession, &opcTimeoutMs));
-	hasLF = (command[cmdLen - 1] == '\n');
+	if (offset != length)
+		return VI_ERROR_IO;
 
-	// We need a longer buffer to append '*OPC'
-	bufferSize = cmdLen + 10;
+	if (retCount)
+		*retCount = (ViUInt32)length;
 
-	tooLong = (bufferSize > RS_MAX_MESSAGE_BUF_SIZE);
-	if (rsSession->opcWaitMode != RS_VAL_OPCWAIT_OPCQUERY)
-	{
-		// For commands (not queries), all OPC modes except the OPCquery can use the same procedure
-		if (tooLong)
-		{
-			// Command is too long, we need to allocate the buffer dynamically
-			viCheckAllocElab(dynBuffer = (ViChar *)malloc(bufferSize), "RsCoreInt_WriteWithOpc: Allocation of a dynamic buffer for long command");
-			p2SendBuffer = dynBuffer;
-		}
-		else
-		{
-			p2SendBuffer = buffer;
-			bufferSize = RS_MAX_MESSAGE_BUF_SIZE;
-		}
+	error = recordedStatus;
 
-		RsCoreInt_StrcpyMaxLen(p2SendBuffer, bufferSize, command);
-		if (hasLF)
-		{
-			RsCore_TrimString(p2SendBuffer, RS_VAL_TRIM_WHITESPACES);
-		}
+Error:
+	return error;
+}
 
-		if (rsSession->assureWriteWithLF == VI_TRUE)
-			RsCore_StrcatMaxLen(p2SendBuffer, bufferSize, ";*OPC\n", NULL, NULL);
-		else
-			RsCore_StrcatMaxLen(p2SendBuffer, bufferSize, ";*OPC", NULL, NULL);
+/*****************************************************************************************************/
+/*  RsCoreInt_ReplayRead
+    Replay transport: returns the recorded read data and status
+    If the recorded read returned more data than the requested count, the rest is returned by the next read
+******************************************************************************************************/
+ViStatus RsCoreInt_ReplayRead(void* context, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreReplayContextPtr ctx = (RsCoreReplayContextPtr)context;
+	ViUInt32 chunk;
 
-		checkErr(RsCoreInt_ClearBeforeRead(instrSession));
+	if (retCount)
+		*retCount = 0;
 
-		// For Service request, clear and allow the SRQ event
-		if (rsSession->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST)
+	if (ctx->readRemaining == 0)
+	{
+		checkErr(RsCoreInt_IoLogReadRecord(ctx, RS_IOLOG_RECORD_READ, &ctx->readStatus, &ctx->readData, &ctx->readRemaining));
+		if (ctx->readRemaining == 0 || ctx->readStatus < VI_SUCCESS)
 		{
-			checkErr(viDiscardEvents(instrSession, VI_EVENT_SERVICE_REQ, VI_QUEUE | VI_SUSPEND_HNDLR));
-			checkErr(viEnableEvent(instrSession, VI_EVENT_SERVICE_REQ, VI_QUEUE, VI_NULL));
-		}
+			error = ctx->readStatus;
+			if (retCount)
+				*retCount = (ViUInt32)ctx->readRemaining;
 
-		checkErr(RsCore_Write(instrSession, p2SendBuffer));
-		checkErr(RsCoreInt_GetAttrP2Value(rsSession->attrOpcCallbackPtr, &value, 0));
-		if (value == NULL)
-		{
-			checkStatusOnErr(RsCore_WaitForOpcCallback(instrSession, opcTimeoutMs));
-		}
-		else
-		{
-			p2opcFunction = (RsCoreOpcAttrCallback)(ViAddr *)value;
-			checkStatusOnErr(p2opcFunction(instrSession, opcTimeoutMs));
+			memcpy(buffer, ctx->readData, (size_t)ctx->readRemaining);
+			ctx->readRemaining = 0;
+			goto Error;
 		}
 	}
-	else
-	{
-		// OPC query mode
-		clearEsr = VI_FALSE;
-		checkErr(RsCoreInt_ClearBeforeRead(instrSession));
-		checkErr(RsCore_Write(instrSession, command));
-		checkErr(RsCore_GetVisaTimeout(instrSession, &oldVisaTimeoutMs));
-		checkErr(RsCore_SetVisaTimeout(instrSession, opcTimeoutMs));
 
-		error = RsCore_QueryViStringShort(instrSession, "*OPC?", NULL);
-		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+	chunk = (ctx->readRemaining > count) ? count : (ViUInt32)ctx->readRemaining;
+	memcpy(buffer, ctx->readData, chunk);
+	ctx->readData += chunk;
+	ctx->readRemaining -= chunk;
+	if (retCount)
+		*retCount = chunk;
 
-		checkErr(RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs));
-		oldVisaTimeoutMs = 0;
-	}
+	error = (ctx->readRemaining > 0) ? VI_SUCCESS_MAX_CNT : ctx->readStatus;
 
-CheckStatus:
-	// Check Status if allowed
-	if (allowCheckStatus == VI_FALSE)
-		goto Error;
+Error:
+	return error;
+}
 
-	if (RsCore_QueryInstrStatus(instrSession) == VI_TRUE)
-	{
-		checkErr(RsCoreInt_CheckStatusAfterOpcSync(instrSession, error));
-	}
+/*****************************************************************************************************/
+/*  RsCoreInt_ReplayReadStb
+    Replay transport: returns the recorded status byte
+******************************************************************************************************/
+ViStatus RsCoreInt_ReplayReadStb(void* context, ViPUInt16 stb)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreReplayContextPtr ctx = (RsCoreReplayContextPtr)context;
+	ViStatus recordedStatus;
+	ViByte* data;
+	ViUInt64 length;
 
-	if (clearEsr)
-	{
-		if (error == VI_ERROR_TMO)
-		{
-			(void)RsCoreInt_QueryClearEsr(instrSession);
-		}
-		else
-		{
-			checkErr(RsCoreInt_QueryClearEsr(instrSession));
-		}
-	}
-
-Error:
-	if (dynBuffer)
-		free(dynBuffer);
+	*stb = 0;
+	checkErr(RsCoreInt_IoLogReadRecord(ctx, RS_IOLOG_RECORD_READ_STB, &recordedStatus, &data, &length));
+	if (length != 2)
+		return VI_ERROR_IO;
 
-	if (oldVisaTimeoutMs > 0)
-	{
-		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
-	}
+	*stb = (ViUInt16)(data[0] | (data[1] << 8));
+	error = recordedStatus;
 
+Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_QueryViStringWithOpc
-    Queries instrument for a string response with OPC. The response length is limited by the bufferSize
-    The response is trimmed for LF and terminated with '\0'
-    Set the parameter 'timeoutMs' to 0 in order to use the current session's OPC timeout.
+/*  RsCoreInt_ReplayClear
+    Replay transport: consumes the recorded clear, discards the rest of a partially returned read
 ******************************************************************************************************/
-ViStatus RsCoreInt_QueryViStringWithOpc(ViSession instrSession, ViConstString query, ViBoolean allowCheckStatus,
-                                        ViInt32 opcTimeoutMs, ViInt32 bufferSize, ViChar* responseString)
+ViStatus RsCoreInt_ReplayClear(void* context)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt32 returnedCount;
-	ViUInt32 oldVisaTimeoutMs = 0;
-	ViBoolean clearEsr = VI_TRUE;
-	RsCoreSessionPtr rsSession = NULL;
+	RsCoreReplayContextPtr ctx = (RsCoreReplayContextPtr)context;
+	ViStatus recordedStatus;
+	ViByte* data;
+	ViUInt64 length;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	ctx->readRemaining = 0;
+	checkErr(RsCoreInt_IoLogReadRecord(ctx, RS_IOLOG_RECORD_CLEAR, &recordedStatus, &data, &length));
+	error = recordedStatus;
 
-	checkErr(RsCoreInt_ResolveOpcTimeout(instrSession, &opcTimeoutMs));
+Error:
+	return error;
+}
 
-	if (rsSession->vxiCapable && rsSession->opcWaitMode != RS_VAL_OPCWAIT_OPCQUERY)
-	{
-		// For VXI-capable session, use the viReadSTB poll or SRQ wait and then read the response
-		checkStatusOnErr(RsCoreInt_WriteWithOpc(instrSession, query, VI_FALSE, opcTimeoutMs));
-		checkStatusOnErr(RsCoreInt_Read(instrSession, bufferSize, (ViByte*)responseString, &returnedCount));
-	}
-	else
+/*****************************************************************************************************/
+/*  RsCoreInt_ReplaySetAttribute
+    Replay transport: keeps the attributes the driver reads back, accepts and ignores the others
+******************************************************************************************************/
+ViStatus RsCoreInt_ReplaySetAttribute(void* context, ViAttr attributeName, ViAttrState attributeValue)
+{
+	RsCoreReplayContextPtr ctx = (RsCoreReplayContextPtr)context;
+
+	switch (attributeName)
 	{
-		// For Non-VXI-capable sessions or OpcWaitMode OpcQuery we use standard query with VISA timeout = OPC timeout
-		clearEsr = VI_FALSE;
-		checkErr(RsCoreInt_ClearBeforeRead(instrSession));
-		checkErr(RsCore_Write(instrSession, query));
-		checkErr(RsCore_GetVisaTimeout(instrSession, &oldVisaTimeoutMs));
-		checkErr(RsCore_SetVisaTimeout(instrSession, opcTimeoutMs));
+	case VI_ATTR_TMO_VALUE:
+		ctx->timeoutMs = (ViUInt32)attributeValue;
+		break;
 
-		error = RsCoreInt_Read(instrSession, bufferSize, (ViByte*)responseString, &returnedCount);
-		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+	case VI_ATTR_TERMCHAR:
+		ctx->termChar = (ViUInt8)attributeValue;
+		break;
 
-		error = RsCore_QueryViStringShort(instrSession, "*OPC?", NULL);
-		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+	case VI_ATTR_TERMCHAR_EN:
+		ctx->termCharEnabled = (ViBoolean)attributeValue;
+		break;
 
-		checkErr(RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs));
-		oldVisaTimeoutMs = 0;
+	case VI_ATTR_SEND_END_EN:
+		ctx->sendEndEnabled = (ViBoolean)attributeValue;
+		break;
+
+	default:
+		break;
 	}
 
-	responseString[returnedCount - 1] = 0;
-	RsCore_TrimString(responseString, RS_VAL_TRIM_WHITESPACES);
+	return VI_SUCCESS;
+}
 
-CheckStatus:
-	// Check Status if allowed
-	if (allowCheckStatus == VI_FALSE)
-		goto Error;
+/*****************************************************************************************************/
+/*  RsCoreInt_ReplayGetAttribute
+    Replay transport: the session reports the recorded interface type and resource class
+******************************************************************************************************/
+ViStatus RsCoreInt_ReplayGetAttribute(void* context, ViAttr attributeName, void* attributeValue)
+{
+	RsCoreReplayContextPtr ctx = (RsCoreReplayContextPtr)context;
 
-	if (RsCore_QueryInstrStatus(instrSession) == VI_TRUE)
+	switch (attributeName)
 	{
-		checkErr(RsCoreInt_CheckStatusAfterOpcSync(instrSession, error));
-	}
+	case VI_ATTR_TMO_VALUE:
+		*(ViUInt32*)attributeValue = ctx->timeoutMs;
+		break;
 
-	if (clearEsr)
-	{
-		if (error == VI_ERROR_TMO)
-		{
-			(void)RsCoreInt_QueryClearEsr(instrSession);
-		}
-		else
-		{
-			checkErr(RsCoreInt_QueryClearEsr(instrSession));
-		}
-	}
+	case VI_ATTR_TERMCHAR:
+		*(ViUInt8*)attributeValue = ctx->termChar;
+		break;
 
-Error:
-	if (oldVisaTimeoutMs > 0)
-	{
-		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
+	case VI_ATTR_TERMCHAR_EN:
+		*(ViBoolean*)attributeValue = ctx->termCharEnabled;
+		break;
+
+	case VI_ATTR_SEND_END_EN:
+		*(ViBoolean*)attributeValue = ctx->sendEndEnabled;
+		break;
+
+	case VI_ATTR_INTF_TYPE:
+		*(ViUInt16*)attributeValue = ctx->intfType;
+		break;
+
+	case VI_ATTR_RSRC_CLASS:
+		RsCoreInt_StrcpyMaxLen((ViChar*)attributeValue, 256, ctx->rsrcClass);
+		break;
+
+	default:
+		return VI_ERROR_NSUP_ATTR;
 	}
 
-	if (error < 0)
-		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_QueryViStringWithOpc", query);
+	return VI_SUCCESS;
+}
 
-	return error;
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- INTERNAL Driver function latency ----------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  RsCoreInt_LatencyCallBegin
+    Starts the latency accounting of a driver function. Nested driver functions only increase the depth,
+    their time is accounted to the outermost function
+******************************************************************************************************/
+void RsCoreInt_LatencyCallBegin(RsCoreSessionPtr rsSession, ViConstString functionName)
+{
+	RsCoreLatencyCall* call = &rsSession->latencyCall;
+
+	if (call->depth++ > 0)
+		return;
+
+	call->functionName = functionName;
+	call->opcWaitDepth = 0;
+	call->ioNs = 0;
+	call->opcWaitNs = 0;
+	memset(&rsSession->roundTrip.call, 0, sizeof(RsCoreRoundTripStats));
+	call->startNs = RsCoreInt_GetTickCountNs();
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_QueryUnknownLengthWithOpc
-    Query instrument with OPC sync for a general response. The response length is unlimited.
-    Returned allocated 'response' buffer is always at least 1 byte bigger than 'byteCount',
-    and the response can be treated as properly null-terminated string.
-    However, the end is not trimmed for LF. For reading the response, the function uses RsCore_ReadUnknownLength.
-    Set the parameter 'timeoutMs' to 0 in order to use the current session's OPC timeout.
-    If you do not need the returned 'byteCount', set it to NULL.
-    If 'allowCheckStatus' is FALSE, CheckStatus call and ESR clear are skipped.
-    Important!!! - Free the response buffer after use !!!
+/*  RsCoreInt_LatencyCallEnd
+    Ends the latency accounting of a driver function. The outermost function adds its total,
+    host CPU, IO wait and OPC wait times to its histograms
 ******************************************************************************************************/
-ViStatus RsCoreInt_QueryUnknownLengthWithOpc(ViSession instrSession, ViConstString query, ViBoolean allowCheckStatus,
-                                             ViInt32 opcTimeoutMs, ViByte** response, ViInt64* byteCount)
+void RsCoreInt_LatencyCallEnd(RsCoreSessionPtr rsSession)
 {
-	ViStatus error = VI_SUCCESS;
-	ViInt64 returnedCount;
-	ViUInt32 oldVisaTimeoutMs = 0;
-	ViBoolean clearEsr = VI_TRUE;
-	RsCoreSessionPtr rsSession = NULL;
+	RsCoreLatencyCall* call = &rsSession->latencyCall;
+	RsCoreFunctionLatencyPtr latency;
+	ViUInt64 totalNs;
+	ViUInt64 waitNs;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	// Unlock without the matching lock, e.g. after a failed check before the locking
+	if (call->depth <= 0)
+		return;
 
-	checkErr(RsCoreInt_ResolveOpcTimeout(instrSession, &opcTimeoutMs));
+	if (--call->depth > 0 || call->functionName == NULL)
+		return;
 
-	if (RsCore_Simulating(instrSession))
-	{
-		if (byteCount)
-			*byteCount = 1;
+	totalNs = RsCoreInt_GetTickCountNs() - call->startNs;
+	waitNs = call->ioNs + call->opcWaitNs;
 
-		*response = (ViByte*)malloc(1);
-		return error;
-	}
+	latency = RsCoreInt_FindFunctionLatency(rsSession, call->functionName, VI_TRUE);
+	if (latency == NULL)
+		return;
 
-	if (rsSession->vxiCapable && rsSession->opcWaitMode != RS_VAL_OPCWAIT_OPCQUERY)
-	{
-		// For VXI-capable session, use the viReadSTB poll or SRQ wait and then read the response
-		checkStatusOnErr(RsCoreInt_WriteWithOpc(instrSession, query, VI_FALSE, opcTimeoutMs));
-		checkStatusOnErr(RsCoreInt_ReadDataUnknownLength(instrSession, response, &returnedCount));
-	}
-	else
-	{
-		// For Non-VXI-capable sessions or OpcWaitMode OpcQuery we use standard query with VISA timeout = OPC timeout
-		clearEsr = VI_FALSE;
-		checkErr(RsCoreInt_ClearBeforeRead(instrSession));
-		checkErr(RsCore_Write(instrSession, query));
-		checkErr(RsCore_GetVisaTimeout(instrSession, &oldVisaTimeoutMs));
-		checkErr(RsCore_SetVisaTimeout(instrSession, opcTimeoutMs));
+	RsCoreInt_LatencyHistogramAdd(&latency->histograms[RS_VAL_LATENCY_TOTAL], totalNs);
+	RsCoreInt_LatencyHistogramAdd(&latency->histograms[RS_VAL_LATENCY_HOST_CPU], totalNs > waitNs ? totalNs - waitNs : 0);
+	RsCoreInt_LatencyHistogramAdd(&latency->histograms[RS_VAL_LATENCY_IO_WAIT], call->ioNs);
+	RsCoreInt_LatencyHistogramAdd(&latency->histograms[RS_VAL_LATENCY_OPC_WAIT], call->opcWaitNs);
 
-		error = RsCoreInt_ReadDataUnknownLength(instrSession, response, &returnedCount);
-		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+	if (rsSession->roundTrip.enabled == VI_TRUE)
+		RsCoreInt_RoundTripCallEnd(rsSession, latency);
+}
 
-		error = RsCore_QueryViStringShort(instrSession, "*OPC?", NULL);
-		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+/*****************************************************************************************************/
+/*  RsCoreInt_LatencyOpcWaitBegin
+    Starts the OPC waiting. The IO performed until RsCoreInt_LatencyOpcWaitEnd is accounted as the OPC wait
+    The OPC-synchronized operation also uses the current OPC timeout, see RsCoreInt_RoundTripOpcTimeout
+******************************************************************************************************/
+void RsCoreInt_LatencyOpcWaitBegin(RsCoreSessionPtr rsSession)
+{
+	if (rsSession->latencyCall.opcWaitDepth++ == 0)
+		rsSession->latencyCall.opcWaitStartNs = RsCoreInt_GetTickCountNs();
 
-		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
-		oldVisaTimeoutMs = 0;
-	}
+	rsSession->roundTrip.opcTimeoutUnused = VI_FALSE;
+}
 
-	// Read the response unknown length
+/*****************************************************************************************************/
+/*  RsCoreInt_LatencyOpcWaitEnd
+    Ends the OPC waiting started with RsCoreInt_LatencyOpcWaitBegin
+******************************************************************************************************/
+void RsCoreInt_LatencyOpcWaitEnd(RsCoreSessionPtr rsSession)
+{
+	if (rsSession->latencyCall.opcWaitDepth > 0 && --rsSession->latencyCall.opcWaitDepth == 0)
+		rsSession->latencyCall.opcWaitNs += RsCoreInt_GetTickCountNs() - rsSession->latencyCall.opcWaitStartNs;
+}
 
-	if (byteCount)
-		*byteCount = returnedCount;
+/*****************************************************************************************************/
+/*  RsCoreInt_LatencyHistogramAdd
+    Adds the value to the histogram. Values below 2*RS_LATENCY_SUB_BUCKETS have their own buckets,
+    each next power of 2 is divided into RS_LATENCY_SUB_BUCKETS buckets of equal width
+******************************************************************************************************/
+void RsCoreInt_LatencyHistogramAdd(RsCoreLatencyHistogram* histogram, ViUInt64 valueNs)
+{
+	ViUInt32 shift = 0;
+	ViUInt32 idx;
 
-CheckStatus:
-	// Check Status if allowed
-	if (allowCheckStatus == VI_FALSE)
-		goto Error;
+	while ((valueNs >> shift) >= 2 * RS_LATENCY_SUB_BUCKETS)
+		shift++;
 
-	if (RsCore_QueryInstrStatus(instrSession) == VI_TRUE)
-	{
-		checkErr(RsCoreInt_CheckStatusAfterOpcSync(instrSession, error));
-	}
+	idx = shift * RS_LATENCY_SUB_BUCKETS + (ViUInt32)(valueNs >> shift);
+	if (idx >= RS_LATENCY_BUCKETS)
+		idx = RS_LATENCY_BUCKETS - 1;
 
-	if (clearEsr)
-	{
-		if (error == VI_ERROR_TMO)
-		{
-			(void)RsCoreInt_QueryClearEsr(instrSession);
-		}
-		else
-		{
-			checkErr(RsCoreInt_QueryClearEsr(instrSession));
-		}
-	}
+	histogram->buckets[idx]++;
 
-Error:
-	if (oldVisaTimeoutMs > 0)
-	{
-		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
-	}
+	if (histogram->count == 0 || valueNs < histogram->minNs)
+		histogram->minNs = valueNs;
 
-	if (error < 0)
-		(void)RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_QueryUnknownLengthWithOpc", query);
+	if (valueNs > histogram->maxNs)
+		histogram->maxNs = valueNs;
 
-	return error;
+	histogram->count++;
+	histogram->sumNs += valueNs;
 }
 
 /*****************************************************************************************************/
-/*  RsCoreInt_QueryBinaryDataBlockWithOpc
-    Queries binary data of unknown size from the instrument.
-    If errorIfNotBinDataBlock == TRUE, the function generates error in case the data is not a binary block (not starting with '#')
-    If errorIfNotBinDataBlock == FALSE, the function returns read data and indicates isBinDataBlock = FALSE.
-    If you do not need the isBinDataBlock info, set the pointer to NULL
-    Set the parameter 'timeoutMs' to 0 in order to use the current session's OPC timeout.
-    WARNING!!! - Free the outBinDataBlock after use
+/*  RsCoreInt_LatencyHistogramPercentile
+    Returns the value below or at which the percentile (0 ... 100) of the histogram values lies
+    The result is the highest value of the bucket, limited to the histogram min and max
 ******************************************************************************************************/
-ViStatus RsCoreInt_QueryBinaryDataBlockWithOpc(ViSession instrSession, ViConstString query,
-                                               ViBoolean errorIfNotBinDataBlock, ViBoolean* isBinDataBlock,
-                                               ViBoolean allowCheckStatus,
-                                               ViInt32 opcTimeoutMs, ViByte** outBinDataBlock, ViInt64* blockSize)
+ViUInt64 RsCoreInt_LatencyHistogramPercentile(const RsCoreLatencyHistogram* histogram, ViReal64 percentile)
 {
-	ViStatus error = VI_SUCCESS;
-	ViInt64 returnedCount = 0;
-	ViUInt32 oldVisaTimeoutMs = 0;
-	ViBoolean clearEsr = VI_TRUE;
-	RsCoreSessionPtr rsSession = NULL;
+	ViUInt64 rank;
+	ViUInt64 cumulative = 0;
+	ViUInt64 value;
+	ViUInt32 idx;
+	ViUInt32 shift;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (histogram->count == 0)
+		return 0;
 
-	checkErr(RsCoreInt_ResolveOpcTimeout(instrSession, &opcTimeoutMs));
+	rank = (ViUInt64)ceil(percentile / 100.0 * (ViReal64)histogram->count);
+	if (rank < 1)
+		rank = 1;
 
-	if (RsCore_Simulating(instrSession))
+	for (idx = 0; idx < RS_LATENCY_BUCKETS - 1; idx++)
 	{
-		returnedCount = 1;
-		*outBinDataBlock = (ViByte*)malloc(1);
-		goto Error;
+		cumulative += histogram->buckets[idx];
+		if (cumulative >= rank)
+			break;
 	}
 
-	if (rsSession->vxiCapable && rsSession->opcWaitMode != RS_VAL_OPCWAIT_OPCQUERY)
+	if (idx < 2 * RS_LATENCY_SUB_BUCKETS)
 	{
-		// For VXI-capable session, use the viReadSTB poll or SRQ wait and then read the response
-		checkStatusOnErr(RsCoreInt_WriteWithOpc(instrSession, query, VI_FALSE, opcTimeoutMs));
-		checkStatusOnErr(RsCoreInt_ReadBinaryDataBlock(instrSession, errorIfNotBinDataBlock, isBinDataBlock, outBinDataBlock, &returnedCount));
+		value = idx;
 	}
 	else
 	{
-		// For Non-VXI-capable sessions or OpcWaitMode OpcQuery we use standard query with VISA timeout = OPC timeout
-		clearEsr = VI_FALSE;
-		checkErr(RsCoreInt_ClearBeforeRead(instrSession));
-		checkErr(RsCore_Write(instrSession, query));
-		checkErr(RsCore_GetVisaTimeout(instrSession, &oldVisaTimeoutMs));
-		checkErr(RsCore_SetVisaTimeout(instrSession, opcTimeoutMs));
+		shift = idx / RS_LATENCY_SUB_BUCKETS - 1;
+		value = ((ViUInt64)(idx - shift * RS_LATENCY_SUB_BUCKETS + 1) << shift) - 1;
+	}
 
-		error = RsCoreInt_ReadBinaryDataBlock(instrSession, errorIfNotBinDataBlock, isBinDataBlock, outBinDataBlock, &returnedCount);
-		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+	if (value > histogram->maxNs)
+		value = histogram->maxNs;
 
-		error = RsCore_QueryViStringShort(instrSession, "*OPC?", NULL);
-		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+	if (value < histogram->minNs)
+		value = histogram->minNs;
 
-		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
-		oldVisaTimeoutMs = 0;
-	}
+	return value;
+}
 
-CheckStatus:
-	// Check Status if allowed
-	if (allowCheckStatus == VI_FALSE)
-		goto Error;
+/*****************************************************************************************************/
+/*  RsCoreInt_LatencyHistogramStats
+    Summarizes the histogram in microseconds
+******************************************************************************************************/
+void RsCoreInt_LatencyHistogramStats(const RsCoreLatencyHistogram* histogram, RsCoreLatencyStats* stats)
+{
+	memset(stats, 0, sizeof(RsCoreLatencyStats));
+	if (histogram->count == 0)
+		return;
 
-	if (RsCore_QueryInstrStatus(instrSession) == VI_TRUE)
+	stats->count = histogram->count;
+	stats->minUs = (ViReal64)histogram->minNs / 1000.0;
+	stats->meanUs = (ViReal64)histogram->sumNs / (ViReal64)histogram->count / 1000.0;
+	stats->p50Us = (ViReal64)RsCoreInt_LatencyHistogramPercentile(histogram, 50.0) / 1000.0;
+	stats->p90Us = (ViReal64)RsCoreInt_LatencyHistogramPercentile(histogram, 90.0) / 1000.0;
+	stats->p99Us = (ViReal64)RsCoreInt_LatencyHistogramPercentile(histogram, 99.0) / 1000.0;
+	stats->p999Us = (ViReal64)RsCoreInt_LatencyHistogramPercentile(histogram, 99.9) / 1000.0;
+	stats->maxUs = (ViReal64)histogram->maxNs / 1000.0;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_FindFunctionLatency
+    Returns the latency histograms of the function, NULL if the function was not called yet
+    If create is VI_TRUE, the histograms are created for the function called the first time
+    The functions list changes under the global mutex, the histograms are updated without locking
+******************************************************************************************************/
+RsCoreFunctionLatencyPtr RsCoreInt_FindFunctionLatency(RsCoreSessionPtr rsSession, ViConstString functionName, ViBoolean create)
+{
+	RsCoreFunctionLatencyPtr latency = NULL;
+	RsCoreFunctionLatencyPtr newList;
+	ViInt32 newAllocated;
+	ViInt32 idx;
+
+	// The function names are static strings, the same function has the same pointer
+	for (idx = 0; idx < rsSession->functionLatenciesCount; idx++)
 	{
-		checkErr(RsCoreInt_CheckStatusAfterOpcSync(instrSession, error));
+		if (rsSession->functionLatencies[idx].functionName == functionName)
+			return &rsSession->functionLatencies[idx];
 	}
 
-	if (clearEsr)
+	gMutex = RsCoreInt_MutexLock(gMutex);
+
+	for (idx = 0; idx < rsSession->functionLatenciesCount; idx++)
 	{
-		if (error == VI_ERROR_TMO)
-		{
-			(void)RsCoreInt_QueryClearEsr(instrSession);
-		}
-		else
+		if (strcmp(rsSession->functionLatencies[idx].functionName, functionName) == 0)
 		{
-			checkErr(RsCoreInt_QueryClearEsr(instrSession));
+			latency = &rsSession->functionLatencies[idx];
+			goto Error;
 		}
 	}
 
-Error:
-	if (blockSize)
-		*blockSize = returnedCount;
+	if (create == VI_FALSE)
+		goto Error;
 
-	if (oldVisaTimeoutMs > 0)
+	if (rsSession->functionLatenciesCount == rsSession->functionLatenciesAllocated)
 	{
-		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
+		newAllocated = rsSession->functionLatenciesAllocated > 0 ? rsSession->functionLatenciesAllocated * 2 : 16;
+		newList = (RsCoreFunctionLatencyPtr)RsCoreInt_Realloc(rsSession->allocator, rsSession->functionLatencies, newAllocated * sizeof(RsCoreFunctionLatency));
+		if (newList == NULL)
+			goto Error;
+
+		rsSession->functionLatencies = newList;
+		rsSession->functionLatenciesAllocated = newAllocated;
 	}
 
-	if (error < 0)
-		(void)RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_QueryUnknownLengthWithOpc", query);
+	latency = &rsSession->functionLatencies[rsSession->functionLatenciesCount];
+	memset(latency, 0, sizeof(RsCoreFunctionLatency));
+	latency->functionName = functionName;
+	rsSession->functionLatenciesCount++;
 
-	return error;
+Error:
+	RsCoreInt_MutexUnlock(gMutex);
+	return latency;
 }
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
----- EXPORTED FUNCTIONS ------------------------------------------------------------------------------*
-------------------------------------------------------------------------------------------------------*
-******************************************************************************************************/
-
-/******************************************************************************************************
-------------------------------------------------------------------------------------------------------*
----- Session - related functions ---------------------------------------------------------------------*
+---- INTERNAL Round-trip diagnostics -----------------------------------------------------------------*
 ------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
 
 /*****************************************************************************************************/
-/*  RsCore_NewSpecificDriver
-    Initiates/reuses VISA IO session, + adds the session structure to the global sessions list.
-    This is the first function that the instrument driver calls.
+/*  RsCoreInt_RoundTripIo
+    Counts the IO operation of the driver function in progress and checks the written data
+    for the identical consecutive writes and the repeated FORM commands
 ******************************************************************************************************/
-ViStatus RsCore_NewSpecificDriver(
-	ViRsrc resourceName,
-	ViConstString specificPrefix,
-	ViConstString optionsString,
-	RsCoreAttributePtr* attrList,
-	ViInt32 writeDelay,
-	ViInt32 readDelay,
-	ViInt32 ioSegmentSize,
-	ViInt32 opcWaitMode,
-	ViInt32 opcTimeout,
-	ViInt32 visaTimeout,
-	ViInt32 selfTestTimeout,
-	ViInt32 binaryFloatNumbersFormat,
-	ViInt32 binaryIntegerNumbersFormat,
-	ViPSession newSession)
+void RsCoreInt_RoundTripIo(RsCoreSessionPtr rsSession, ViInt32 operation, const RsCoreIoSegment segments[], ViUInt32 segmentsCount)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
-	RsCoreSessionPtr rsSession;
-	ViSession instrSession;
-	ViInt32 flag = 0;
-	ViBoolean simulate = VI_TRUE;
-	ViBoolean reuseSession = VI_FALSE;
+	RsCoreRoundTripState* state = &rsSession->roundTrip;
+	ViByte data[RS_ROUND_TRIP_COMPARE_LEN];
+	ViUInt32 length = 0;
+	ViUInt32 total = 0;
+	ViUInt32 part;
+	ViUInt32 idx;
+
+	switch (operation)
+	{
+	case RS_VAL_IO_TRACE_WRITE:
+		state->call.writes++;
+		for (idx = 0; idx < segmentsCount; idx++)
+		{
+			total += segments[idx].count;
+			part = RS_ROUND_TRIP_COMPARE_LEN - length;
+			if (segments[idx].count < part)
+				part = segments[idx].count;
 
-	/* --- Set "C" locale --- */
-	{
-		char* locale;
-		locale = setlocale(LC_ALL, "C");
+			memcpy(data + length, segments[idx].data, part);
+			length += part;
+		}
+
+		if (state->lastOperation == RS_VAL_IO_TRACE_WRITE && total == state->lastWriteLength && total <= RS_ROUND_TRIP_COMPARE_LEN &&
+			memcmp(data, state->lastWrite, total) == 0)
+		{
+			RsCoreInt_RoundTripFlag(rsSession, RS_VAL_REDUNDANT_IDENTICAL_WRITE, data, length);
+		}
+
+		RsCoreInt_RoundTripCheckFormat(rsSession, data, length);
+
+		memcpy(state->lastWrite, data, length);
+		state->lastWriteLength = total;
+		state->statusChecked = VI_FALSE;
+		break;
+	case RS_VAL_IO_TRACE_READ:
+		state->call.reads++;
+		break;
+	case RS_VAL_IO_TRACE_READ_STB:
+		state->call.statusByteReads++;
+		break;
+	case RS_VAL_IO_TRACE_CLEAR:
+		state->call.clears++;
+		break;
+	default:
+		break;
 	}
 
-	checkErr(RsCoreInt_ParseOptionsBefore(optionsString, &simulate, &reuseSession));
-	checkErr(RsCoreInt_InitOrReuseSession(resourceName, attrList, simulate, reuseSession, &instrSession));
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
-	*newSession = instrSession;
+	state->lastOperation = operation;
+}
 
-	// Default values for the rsSession
-	RsCoreInt_StrcpyMaxLen(rsSession->specificPrefix, RS_MAX_SHORT_MESSAGE_BUF_SIZE, specificPrefix);
-	rsSession->reuseSession = reuseSession;
-	rsSession->mutex = NULL;
-	rsSession->multiThreadLocking = VI_FALSE;
-	rsSession->sessionType = RS_INTF_TCPIP;
-	rsSession->allowViClear = VI_TRUE;
-	rsSession->optionChecking = VI_TRUE; // OptionCheck has no attribute, only the rsSession field
-	rsSession->fastSweepInstrument = 0;
-	rsSession->writeDelay = writeDelay;
-	rsSession->readDelay = readDelay;
-	rsSession->ioSegmentSize = ioSegmentSize;
-	rsSession->opcWaitMode = opcWaitMode;
-	rsSession->selfTestTimeout = selfTestTimeout;
-	rsSession->viReadStbVisaTimeoutMs = 0;
-	rsSession->autoSystErrQuery = VI_FALSE;
-	rsSession->sendOpcInCheckStatus = VI_FALSE;
-	rsSession->recogniseLongResponses = VI_FALSE;
-	rsSession->reportAttrDataTypeMismatch = VI_FALSE;
-	rsSession->binaryFloatNumbersFormat = binaryFloatNumbersFormat;
-	rsSession->binaryIntegerNumbersFormat = binaryIntegerNumbersFormat;
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_OPTIONS_LIST, &rsSession->attrOptionsListPtr));
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_INSTRUMENT_MODEL, &rsSession->attrInstrModelPtr));
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_OPC_CALLBACK, &rsSession->attrOpcCallbackPtr));
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_QUERY_INSTRUMENT_STATUS, &rsSession->attrQueryInstrStatusPtr));
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_RANGE_CHECK, &rsSession->attrRangeCheckPtr));
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_CHECK_STATUS_CALLBACK, &rsSession->attrCheckStatusCallbackPtr));
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_SIMULATE, &rsSession->attrSimulatePtr));
-	checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_SIMULATE, 0, simulate));
-	checkErr(RsCore_ClearErrorInfo(instrSession)); // Clears primaryError, secondaryError, errorElaboration
+/*****************************************************************************************************/
+/*  RsCoreInt_RoundTripFlag
+    Counts one occurrence of the redundant pattern in the driver function in progress
+    The first occurrence in the call is kept as the example, non-printable characters replaced with '.'
+******************************************************************************************************/
+void RsCoreInt_RoundTripFlag(RsCoreSessionPtr rsSession, ViInt32 pattern, ViConstBuf example, ViUInt32 exampleLength)
+{
+	RsCoreRoundTripStats* call = &rsSession->roundTrip.call;
+	ViUInt32 idx;
 
+	call->redundant[pattern]++;
+	if (call->examples[pattern][0] != '\0')
+		return;
 
-	checkErr(RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_ENGINE_MAJOR_VERSION, 0, RSCORE_ENGINE_MAJOR_VERSION));
-	checkErr(RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_ENGINE_MINOR_VERSION, 0, RSCORE_ENGINE_MINOR_VERSION));
-	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_ENGINE_REVISION, 0, RSCORE_ENGINE_REVISION));
+	for (idx = 0; idx < exampleLength && idx < RS_ROUND_TRIP_EXAMPLE_LEN - 1; idx++)
+		call->examples[pattern][idx] = (example[idx] < 0x20 || example[idx] > 0x7E) ? '.' : (ViChar)example[idx];
 
-	// InterfaceType determination
-	if (!simulate)
-	{
-		checkErr(viSetAttribute(instrSession, VI_ATTR_USER_DATA, (ViAttrState)rsSession));
-		checkErr(viSetAttribute(instrSession, VI_ATTR_TMO_VALUE, visaTimeout));
-		checkErr(RsCoreInt_GetSessionType(instrSession, &rsSession->sessionType));
+	call->examples[pattern][idx] = '\0';
+}
 
-		/* Configure VISA Formatted I/O */
-		checkErr(viSetBuf(instrSession, (ViUInt16)(VI_READ_BUF | VI_WRITE_BUF), 4000));
-		checkErr(viSetAttribute(instrSession, VI_ATTR_WR_BUF_OPER_MODE, VI_FLUSH_ON_ACCESS));
-		checkErr(viSetAttribute(instrSession, VI_ATTR_RD_BUF_OPER_MODE, VI_FLUSH_ON_ACCESS));
+/*****************************************************************************************************/
+/*  RsCoreInt_RoundTripCheckFormat
+    Checks the FORM program units of the written data against the last sent ones
+    Each program unit is normalized to the 4-letter mnemonics and the value without spaces,
+    e.g. ':FORMat:DATA REAL, 32' -> 'FORM:DATA REAL,32'. *RST forgets the sent formats
+******************************************************************************************************/
+void RsCoreInt_RoundTripCheckFormat(RsCoreSessionPtr rsSession, ViConstBuf data, ViUInt32 length)
+{
+	RsCoreRoundTripState* state = &rsSession->roundTrip;
+	ViChar unit[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar header[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViInt32 unitLength;
+	ViInt32 headerLength;
+	ViInt32 mnemonicLength;
+	ViInt32 slot;
+	ViUInt32 idx = 0;
+	ViUInt32 start;
+	ViUInt32 i;
+	ViChar c;
+
+	while (idx < length && data[idx] != '#')
+	{
+		// Normalize one program unit
+		start = idx;
+		unitLength = 0;
+		headerLength = 0;
+		mnemonicLength = 0;
+		while (idx < length && (data[idx] == ':' || data[idx] == ' ') && headerLength == 0)
+			idx++;
 
-		// Settings for different interfaces
-		if (rsSession->sessionType == RS_INTF_ASRL)
-		{
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR, 10));
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
-			checkErr(viSetAttribute(instrSession, VI_ATTR_ASRL_END_IN, 0));
-			// In viRead the read end is controlled by ReadTermCharacterEnabled property
-			checkErr(viSetAttribute(instrSession, VI_ATTR_ASRL_END_OUT, 0)); // In viWrite nothing is added to the sent data
-			rsSession->vxiCapable = VI_FALSE;
-			rsSession->addTermCharToWriteBinBlock = VI_TRUE;
-			rsSession->assureWriteWithLF = VI_TRUE;
-		}
-		else if (rsSession->sessionType == RS_INTF_SOCKET)
+		for (; idx < length && data[idx] != ';' && data[idx] != '#'; idx++)
 		{
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR, 10));
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
-			rsSession->vxiCapable = VI_FALSE;
-			rsSession->addTermCharToWriteBinBlock = VI_TRUE;
-			rsSession->assureWriteWithLF = VI_TRUE;
+			c = (ViChar)data[idx];
+			if (c >= 'a' && c <= 'z')
+				c = (ViChar)(c - 'a' + 'A');
+
+			if (c == '\n' || c == '\r' || (c == ' ' && headerLength > 0))
+				continue;
+
+			if (headerLength == 0 && c == ':')
+				mnemonicLength = 0;
+			else if (headerLength == 0 && c == ' ')
+				headerLength = unitLength;
+			else if (headerLength == 0 && ++mnemonicLength > 4)
+				continue;
+
+			if (unitLength < RS_MAX_SHORT_MESSAGE_BUF_SIZE - 1)
+				unit[unitLength++] = c;
 		}
-		else if (rsSession->sessionType == RS_INTF_GPIB)
+
+		unit[unitLength] = '\0';
+		if (idx < length && data[idx] == ';')
+			idx++;
+
+		if (strncmp(unit, "*RST", 4) == 0)
 		{
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_FALSE));
-			rsSession->vxiCapable = VI_TRUE;
-			rsSession->addTermCharToWriteBinBlock = VI_FALSE;
-			rsSession->assureWriteWithLF = VI_FALSE;
+			memset(state->formats, 0, sizeof(state->formats));
+			continue;
 		}
-		else if (rsSession->sessionType == RS_INTF_TCPIP)
+
+		if (strncmp(unit, "FORM", 4) != 0 || headerLength == 0 || strchr(unit, '?') != NULL || idx == start)
+			continue;
+
+		memcpy(header, unit, headerLength);
+		header[headerLength] = '\0';
+		if (strcmp(header, "FORM") == 0)
 		{
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_FALSE));
-			rsSession->vxiCapable = VI_TRUE;
-			rsSession->addTermCharToWriteBinBlock = VI_FALSE;
-			rsSession->assureWriteWithLF = VI_FALSE;
+			// FORMat is the same as FORMat:DATA
+			snprintf(header, RS_MAX_SHORT_MESSAGE_BUF_SIZE, "FORM:DATA%s", unit + headerLength);
+			RsCoreInt_StrcpyMaxLen(unit, RS_MAX_SHORT_MESSAGE_BUF_SIZE, header);
+			headerLength = 9;
 		}
-		else if (rsSession->sessionType == RS_INTF_USB)
+
+		slot = -1;
+		for (i = 0; i < RS_ROUND_TRIP_FORMATS; i++)
 		{
-			checkErr(viSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_FALSE));
-			rsSession->vxiCapable = VI_TRUE;
-			rsSession->addTermCharToWriteBinBlock = VI_FALSE;
-			rsSession->assureWriteWithLF = VI_FALSE;
+			if (strncmp(state->formats[i], unit, headerLength + 1) == 0 || (slot < 0 && state->formats[i][0] == '\0'))
+				slot = (ViInt32)i;
 		}
+
+		if (slot < 0)
+			slot = 0;
+
+		if (strcmp(state->formats[slot], unit) == 0)
+			RsCoreInt_RoundTripFlag(rsSession, RS_VAL_REDUNDANT_FORMAT, (ViConstBuf)unit, (ViUInt32)strlen(unit));
 		else
-		{
-			rsSession->sessionType = RS_INTF_UNKNOWN;
-			snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "Unrecognized interface type no. " _PERCD, rsSession->sessionType);
-			viCheckErrElab(RS_ERROR_INVALID_TYPE, errorElab);
-		}
+			RsCoreInt_StrcpyMaxLen(state->formats[slot], RS_MAX_SHORT_MESSAGE_BUF_SIZE, unit);
+	}
+}
 
-		// Coerce the opcWaitMode for non-VXI session
-		if ((rsSession->vxiCapable == VI_FALSE) && (rsSession->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST))
-		{
-			rsSession->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLINGSLOW;
-		}
+/*****************************************************************************************************/
+/*  RsCoreInt_RoundTripStatusCheck
+    Called by RsCore_CheckStatus before the check. Flags the check if nothing was written since the previous one
+******************************************************************************************************/
+void RsCoreInt_RoundTripStatusCheck(RsCoreSessionPtr rsSession)
+{
+	static const ViChar example[] = "status check";
+
+	if (rsSession->roundTrip.statusChecked == VI_TRUE)
+		RsCoreInt_RoundTripFlag(rsSession, RS_VAL_REDUNDANT_STATUS_CHECK, (ViConstBuf)example, (ViUInt32)strlen(example));
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_RoundTripOpcTimeout
+    Called before setting the RS_ATTR_OPC_TIMEOUT. Flags setting the current value,
+    and setting back the previous value when no OPC-synchronized operation used the changed one
+******************************************************************************************************/
+void RsCoreInt_RoundTripOpcTimeout(RsCoreSessionPtr rsSession, RsCoreAttributePtr attr, ViInt32 newValue)
+{
+	RsCoreRoundTripState* state = &rsSession->roundTrip;
+	ViChar example[RS_ROUND_TRIP_EXAMPLE_LEN];
+	ViInt32 currentValue = 0;
+
+	(void)RsCoreInt_GetAttrP2Value(attr, &currentValue, 0);
+	snprintf(example, RS_ROUND_TRIP_EXAMPLE_LEN, "OPC timeout " _PERCD " -> " _PERCD " ms", currentValue, newValue);
+
+	if (newValue == currentValue)
+	{
+		RsCoreInt_RoundTripFlag(rsSession, RS_VAL_REDUNDANT_OPC_TIMEOUT, (ViConstBuf)example, (ViUInt32)strlen(example));
+	}
+	else if (state->opcTimeoutUnused == VI_TRUE && newValue == state->opcTimeoutPrevious)
+	{
+		RsCoreInt_RoundTripFlag(rsSession, RS_VAL_REDUNDANT_OPC_TIMEOUT, (ViConstBuf)example, (ViUInt32)strlen(example));
+		state->opcTimeoutUnused = VI_FALSE;
+	}
+	else
+	{
+		state->opcTimeoutPrevious = currentValue;
+		state->opcTimeoutUnused = VI_TRUE;
+	}
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_RoundTripCallEnd
+    Adds the counters of the finished driver function call to the function statistics
+******************************************************************************************************/
+void RsCoreInt_RoundTripCallEnd(RsCoreSessionPtr rsSession, RsCoreFunctionLatencyPtr latency)
+{
+	RsCoreRoundTripStats* call = &rsSession->roundTrip.call;
+	RsCoreRoundTripStats* stats = &latency->roundTrips;
+	ViUInt64 roundTrips = call->writes + call->reads + call->statusByteReads + call->clears;
+	ViInt32 pattern;
+
+	stats->calls++;
+	stats->writes += call->writes;
+	stats->reads += call->reads;
+	stats->statusByteReads += call->statusByteReads;
+	stats->clears += call->clears;
+	if (roundTrips > stats->maxRoundTrips)
+		stats->maxRoundTrips = (ViUInt32)roundTrips;
+
+	for (pattern = 0; pattern < RS_REDUNDANT_PATTERNS; pattern++)
+	{
+		stats->redundant[pattern] += call->redundant[pattern];
+		if (stats->examples[pattern][0] == '\0')
+			memcpy(stats->examples[pattern], call->examples[pattern], RS_ROUND_TRIP_EXAMPLE_LEN);
 	}
+}
 
-	// Pass value to RS_ATTR_SPECIFIC_DRIVER_PREFIX
-	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_SPECIFIC_DRIVER_PREFIX, 0, specificPrefix));
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- INTERNAL Memory allocation ----------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
 
-	// Set RangeCheck and InstrumentStatusCheck to true.
-	checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_RANGE_CHECK, 0, VI_TRUE));
-	checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_QUERY_INSTRUMENT_STATUS, 0, VI_TRUE));
+/*****************************************************************************************************/
+/*  RsCoreInt_FindAllocator
+    Returns the allocator for the option string token 'Allocator' value
+    'Default' selects the process allocator, other values the allocators registered by RsCore_RegisterAllocator
+******************************************************************************************************/
+ViStatus RsCoreInt_FindAllocator(ViConstString allocatorName, const RsCoreAllocator** allocator)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar name[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar registeredName[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 idx;
 
+	*allocator = gAllocator;
+	RsCoreInt_StrcpyMaxLen(name, RS_MAX_SHORT_MESSAGE_BUF_SIZE, allocatorName);
+	RsCore_TrimString(name, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+	RsCoreInt_ToLowerCase(name);
+	if (strcmp(name, "default") == 0)
+		return error;
 
-	// Additional attributes setting
-	checkErr(RsCore_SetAttributeViSession(instrSession, NULL, RS_ATTR_VISA_RM_SESSION, 0, rsSession->rmSession));
-	checkErr(RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_OPC_TIMEOUT, 0, opcTimeout));
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	for (idx = 0; gAllocators[idx] != NULL; idx++)
+	{
+		RsCoreInt_StrcpyMaxLen(registeredName, RS_MAX_SHORT_MESSAGE_BUF_SIZE, gAllocators[idx]->name);
+		RsCoreInt_ToLowerCase(registeredName);
+		if (strcmp(name, registeredName) == 0)
+		{
+			*allocator = gAllocators[idx];
+			RsCoreInt_MutexUnlock(gMutex);
+			return error;
+		}
+	}
 
-	checkErr(RsCore_GetAttributeFlags(instrSession, RS_ATTR_IO_RESOURCE_DESCRIPTOR, &flag));
-	checkErr(RsCore_SetAttributeFlags(instrSession, RS_ATTR_IO_RESOURCE_DESCRIPTOR, flag & 0xfffb | 0x0010));
-	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_IO_RESOURCE_DESCRIPTOR, 0, resourceName));
+	RsCoreInt_MutexUnlock(gMutex);
+
+	snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+	         "Option string token 'Allocator', value '%s' is unrecognised. Use 'Default' or a name registered with RsCore_RegisterAllocator",
+	         allocatorName);
+	(void)RsCoreInt_SetGlobalErrorInfo(RS_ERROR_INVALID_VALUE, VI_SUCCESS, errorElab);
+	error = RS_ERROR_INVALID_VALUE;
 
-Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_ApplyOptionString
-    Parses the init_with_options option string and sets the session properties and attributes
+/*  RsCoreInt_GetAllocator
+    Returns the allocator of the session, NULL for the C runtime
+    Unknown sessions (e.g. VI_NULL) use the process allocator
 ******************************************************************************************************/
-ViStatus RsCore_ApplyOptionString(ViSession instrSession, ViConstString optionsString)
+const RsCoreAllocator* RsCoreInt_GetAllocator(ViSession instrSession)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar* driverSetup = NULL;
-	ViChar token[RS_MAX_MESSAGE_LEN];
-	ViChar tokenName[RS_MAX_MESSAGE_LEN];
-	ViChar tokenValue[RS_MAX_MESSAGE_LEN];
-	ViChar elab[RS_MAX_MESSAGE_LEN];
-	ViInt32 elementsCount, idx;
 	RsCoreSessionPtr rsSession = NULL;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	// Fast path - all the open sessions use the process allocator
+	if (gAllocatorSessionsCount == 0 || instrSession == VI_NULL)
+		return gAllocator;
 
-	ViInt32 bufferSize = (ViInt32)strlen(optionsString) + 1;
+	if (RsCore_GetRsSession(instrSession, &rsSession) < VI_SUCCESS)
+		return gAllocator;
 
-	if (!optionsString || bufferSize <= 1)
-		goto Error;
+	return rsSession->allocator;
+}
 
-	viCheckAllocElab(driverSetup = (ViChar*)calloc(1, bufferSize), "Driver setup string in parsing rsxxx_InitWithOptions option string");
+/*****************************************************************************************************/
+/*  RsCoreInt_Malloc
+    Allocates the memory with the allocator, NULL allocator is the C runtime
+******************************************************************************************************/
+void* RsCoreInt_Malloc(const RsCoreAllocator* allocator, size_t size)
+{
+	if (allocator == NULL)
+		return malloc(size);
 
-	elementsCount = RsCore_GetElementsCount(optionsString, ',');
-	for (idx = 0; idx < elementsCount; idx++)
-	{
-		RsCore_GetTokenAtIndex(optionsString, ',', idx, token, RS_MAX_MESSAGE_LEN, NULL);
-		if (!RsCoreInt_SplitTokenToNameAndValue(token, "=", tokenName, tokenValue, RS_MAX_MESSAGE_LEN))
-			goto Unresolved;
+	return allocator->allocate(allocator->context, size);
+}
 
-		RsCoreInt_ToLowerCase(tokenName);
-		if (strcmp(tokenName, "simulate") == 0)
-		{
-			// already parsed and set in the RsCore_SpecificDriverNew, here only mentioned not to be considered unresolved
-		}
-		else if (strcmp(tokenName, "reusesession") == 0)
-		{
-			// Already parsed and set in the RsCore_SpecificDriverNew, here only mentioned not to be considered unresolved
-		}
-		else if (strcmp(tokenName, "multithreadlocking") == 0)
-		{
-			rsSession->multiThreadLocking = RsCore_Convert_String_To_Boolean(tokenValue);
-		}
-		else if (strcmp(tokenName, "rangecheck") == 0)
-		{
-			checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_RANGE_CHECK, 0, RsCore_Convert_String_To_Boolean(tokenValue)));
-		}
-		else if (strcmp(tokenName, "queryinstrstatus") == 0)
-		{
-			checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_QUERY_INSTRUMENT_STATUS, 0, RsCore_Convert_String_To_Boolean(tokenValue))
-			);
-		}
-		else if (strcmp(tokenName, "fastsweep") == 0)
-		{
-			rsSession->fastSweepInstrument = atoi(tokenValue);
-		}
-		else if (strcmp(tokenName, "readdelay") == 0)
-		{
-			rsSession->readDelay = (ViInt32)atof(tokenValue);
-		}
-		else if (strcmp(tokenName, "writedelay") == 0)
-		{
-			rsSession->writeDelay = (ViInt32)atof(tokenValue);
-		}
-		else if (strcmp(tokenName, "cache") == 0)
-		{
-			checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_CACHE, 0, RsCore_Convert_String_To_Boolean(tokenValue)));
-		}
-		else if (strcmp(tokenName, "visatimeout") == 0)
-		{
-			if (!RsCore_Simulating(instrSession))
-			{
-				checkErr(viSetAttribute(instrSession, VI_ATTR_TMO_VALUE, atol(tokenValue)));
-			}
-		}
-		else if (strcmp(tokenName, "opctimeout") == 0)
-		{
-			checkErr(RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_OPC_TIMEOUT, 0, (ViInt32)atof(tokenValue)));
-		}
-		else if (strcmp(tokenName, "sendopcqueryincheckstatus") == 0)
-		{
-			rsSession->sendOpcInCheckStatus = RsCore_Convert_String_To_Boolean(tokenValue);
-		}
-		else if (strcmp(tokenName, "recogniselongresponses") == 0)
-		{
-			rsSession->recogniseLongResponses = RsCore_Convert_String_To_Boolean(tokenValue);
-		}
-		else if (strcmp(tokenName, "reportattrdatatypemismatch") == 0)
-		{
-			rsSession->reportAttrDataTypeMismatch = RsCore_Convert_String_To_Boolean(tokenValue);
-		}
-		else if (strcmp(tokenName, "vireadstbvisatimeout") == 0)
-		{
-			rsSession->viReadStbVisaTimeoutMs = (ViInt32)atof(tokenValue);
-		}
-		else if (strcmp(tokenName, "iosegmentsize") == 0)
-		{
-			rsSession->ioSegmentSize = (ViInt32)atof(tokenValue);
-		}
-		else if (strcmp(tokenName, "assurewritewithlf") == 0)
-		{
-			rsSession->assureWriteWithLF = RsCore_Convert_String_To_Boolean(tokenValue);
-		}
-		else if (strcmp(tokenName, "addtermchartowritebinblock") == 0)
-		{
-			rsSession->addTermCharToWriteBinBlock = RsCore_Convert_String_To_Boolean(tokenValue);
-		}
-		else if (strcmp(tokenName, "autosystemerrorquery") == 0)
-		{
-			rsSession->autoSystErrQuery = RsCore_Convert_String_To_Boolean(tokenValue);
-		}
-		else if (strcmp(tokenName, "selftesttimeout") == 0)
-		{
-			rsSession->selfTestTimeout = (ViInt32)atof(tokenValue);
-		}
-		else if (strcmp(tokenName, "opcwaitmode") == 0)
-		{
-			RsCoreInt_ToLowerCase(tokenValue);
-			if (strcmp(tokenValue, "stbpolling") == 0) rsSession->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLING;
-			else if (strcmp(tokenValue, "stbpollingslow") == 0) rsSession->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLINGSLOW;
-			else if (strcmp(tokenValue, "stbpollingsuperslow") == 0) rsSession->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLINGSUPERSLOW;
-			else if (strcmp(tokenValue, "servicerequest") == 0) rsSession->opcWaitMode = RS_VAL_OPCWAIT_SERVICEREQUEST;
-			else if (strcmp(tokenValue, "opcquery") == 0) rsSession->opcWaitMode = RS_VAL_OPCWAIT_OPCQUERY;
-			else
-			{
-				snprintf(elab, RS_MAX_MESSAGE_LEN,
-				         "Option string token 'OpcWaitMode', value '%s' is unrecognised."
-				         "Defined values: 'StbPolling / StbPollingSlow / StbPollingSuperSlow / ServiceRequest'", tokenValue);
-				viCheckErrElab(RS_ERROR_INVALID_VALUE, elab);
-			}
-		}
-		else
-		{
-		Unresolved:
-			// Store unresolved option string for RS_ATTR_DRIVER_SETUP
-			RsCore_TrimString(token, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
-			RsCore_AppendToCsvString(driverSetup, ",", bufferSize, token);
-		}
-	}
+/*****************************************************************************************************/
+/*  RsCoreInt_Calloc
+    Allocates the zero-initialized memory for count elements with the allocator
+******************************************************************************************************/
+void* RsCoreInt_Calloc(const RsCoreAllocator* allocator, size_t count, size_t size)
+{
+	void* ptr;
 
-	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_DRIVER_SETUP, 0, driverSetup));
+	if (allocator == NULL)
+		return calloc(count, size);
 
-Error:
-	if (driverSetup)
-		free(driverSetup);
+	if (size > 0 && count > ((size_t)-1) / size)
+		return NULL;
 
-	return error;
+	ptr = allocator->allocate(allocator->context, count * size);
+	if (ptr != NULL)
+		memset(ptr, 0, count * size);
+
+	return ptr;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_GetRsSession
-    Returns core session properties related to the VISA instrSession
+/*  RsCoreInt_Realloc
+    Reallocates the memory with the allocator. On failure, the ptr stays allocated
 ******************************************************************************************************/
-ViStatus RsCore_GetRsSession(ViSession instrSession, RsCoreSessionPtr* rsSession)
+void* RsCoreInt_Realloc(const RsCoreAllocator* allocator, void* ptr, size_t size)
+{
+	if (allocator == NULL)
+		return realloc(ptr, size);
+
+	return allocator->reallocate(allocator->context, ptr, size);
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_Free
+    Frees the memory allocated with the allocator. NULL ptr is ignored
+******************************************************************************************************/
+void RsCoreInt_Free(const RsCoreAllocator* allocator, void* ptr)
+{
+	if (ptr == NULL)
+		return;
+
+	if (allocator == NULL)
+		free(ptr);
+	else
+		allocator->deallocate(allocator->context, ptr);
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- INTERNAL Warm session pool and identity snapshot ------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  RsCoreInt_SessionPoolTake
+    Takes over the session of the resourceName parked in the warm session pool. The rsSession is NULL if there is none.
+    The session keeps its IO session, attributes and repCaps, the init only refreshes its settings.
+    Call with the gMutex locked
+******************************************************************************************************/
+void RsCoreInt_SessionPoolTake(ViRsrc resourceName, ViBoolean simulate, RsCoreSessionPtr* rsSession)
 {
-	ViStatus error = VI_SUCCESS;
 	ViInt32 idx;
+	RsCoreSessionPtr session;
 
 	*rsSession = NULL;
 
-	if (instrSession == 0)
+	for (idx = 0; idx < MAX_NUMBER_OF_SESSIONS; idx++)
 	{
-		checkErr(RS_ERROR_INVALID_SESSION_HANDLE);
-	}
+		session = gSessionsList[idx];
+		if (session == NULL || session->parked == VI_FALSE || strcmp(session->resourceName, resourceName) != 0)
+			continue;
 
-	gMutex = RsCoreInt_MutexLock(gMutex);
+		if (RsCore_Simulating(session->io) != simulate)
+			continue;
 
-	for (idx = 0; idx < MAX_NUMBER_OF_SESSIONS; idx++)
-		if (gSessionsList[idx] != NULL && gSessionsList[idx]->io == instrSession)
-		{
-			*rsSession = gSessionsList[idx];
-			goto Error;
-		}
+		session->parked = VI_FALSE;
+		session->warmStart = VI_TRUE;
 
-	checkErr(RS_ERROR_INVALID_SESSION_HANDLE);
+		// The init creates a new session mutex
+		RsCoreInt_MutexDispose((MUTEX)session->mutex);
+		session->mutex = NULL;
 
-Error:
-	RsCoreInt_MutexUnlock(gMutex);
-	return error;
+		*rsSession = session;
+		return;
+	}
 }
 
 /*****************************************************************************************************/
-/*  RsCore_ViClose
-    Closes the VISA I/O session
-    After calling RsCore_ViClose, call the RsCore_Dispose to close all the session resources used by the driver.
-******************************************************************************************************/
-ViStatus RsCore_ViClose(ViSession instrSession)
+/*  RsCoreInt_LoadIdentitySnapshot
+    Loads the identity snapshot of the session resource from the rsSession->identity.fileName
+    The file has one line per resource: <resourceName> TAB <*IDN? response> TAB <*OPT? response>
+    Not existing file or resource is not an error, the snapshot is then not valid
+    The *OPT? is not queried as long as the *IDN? response is unchanged. Options installed without a firmware change
+    are therefore not seen until the resource line or the whole snapshot file is deleted
+******************************************************************************************************/
+ViStatus RsCoreInt_LoadIdentitySnapshot(RsCoreSessionPtr rsSession)
 {
 	ViStatus error = VI_SUCCESS;
-	RsCoreSessionPtr rsSession = NULL;
+	RsCoreIdentitySnapshot* identity = &rsSession->identity;
+	FILE* file = NULL;
+	ViChar* content = NULL;
+	ViChar* line;
+	ViChar* next;
+	ViChar* idn;
+	ViChar* options;
+	long fileSize;
 
-	(void)RsCore_GetRsSession(instrSession, &rsSession);
+	identity->valid = VI_FALSE;
+	identity->validated = VI_FALSE;
 
-	if (rsSession == NULL)
+	if ((file = fopen(identity->fileName, "rb")) == NULL)
+		goto Error;
+
+	if (fseek(file, 0, SEEK_END) != 0 || (fileSize = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0)
+		goto Error;
+
+	checkAlloc(content = (ViChar*)RsCoreInt_Malloc(rsSession->allocator, (size_t)fileSize + 1));
+	content[fread(content, 1, (size_t)fileSize, file)] = '\0';
+
+	for (line = content; line != NULL && *line != '\0'; line = next)
 	{
-		// no other info is available, close the session without reporting an error
-		(void)viClose(instrSession);
-		return error;
+		if ((next = strchr(line, '\n')) != NULL)
+			*next++ = '\0';
+
+		if ((idn = strchr(line, '\t')) == NULL || (options = strchr(idn + 1, '\t')) == NULL)
+			continue;
+
+		*idn++ = '\0';
+		*options++ = '\0';
+		if (strcmp(line, rsSession->resourceName) != 0)
+			continue;
+
+		RsCoreInt_StrcpyMaxLen(identity->idn, RS_MAX_MESSAGE_BUF_SIZE, idn);
+		RsCoreInt_StrcpyMaxLen(identity->options, RS_MAX_MESSAGE_BUF_SIZE, options);
+		identity->valid = VI_TRUE;
 	}
 
-	if (RsCore_Simulating(instrSession) == VI_TRUE)
-		return error;
+Error:
+	if (file)
+		fclose(file);
 
-	(void)viClose(instrSession);
-	(void)viClose(rsSession->rmSession);
-	rsSession->rmSession = 0;
+	RsCoreInt_Free(rsSession->allocator, content);
 
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_Dispose
-    Destroys the RS session, all of its attributes, and the memory resources it uses.
-    Close the VISA I/O session before by calling RsCore_ViClose()
+/*  RsCoreInt_SaveIdentitySnapshot
+    Writes the identity snapshot of the session resource to the rsSession->identity.fileName
+    Snapshots of the other resources in the file stay unchanged
+    The new content is written to '<fileName>.tmp' and renamed over the file under the gMutex,
+    parallel inits do not lose each other's lines and a reader never sees a partially written file
 ******************************************************************************************************/
-ViStatus RsCore_Dispose(ViSession instrSession)
+ViStatus RsCoreInt_SaveIdentitySnapshot(RsCoreSessionPtr rsSession)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt32 idx = 0;
-	void* p2value;
-	RsCoreSessionPtr rsSession = NULL;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar tempFileName[RS_MAX_MESSAGE_LEN + 8];
+	RsCoreIdentitySnapshot* identity = &rsSession->identity;
+	FILE* file = NULL;
+	ViChar* content = NULL;
+	ViChar* line;
+	ViChar* next;
+	ViChar* tab;
+	long fileSize = 0;
+	ViBoolean locked = VI_FALSE;
+	ViBoolean written;
+
+	if (identity->valid == VI_FALSE || strlen(identity->fileName) == 0)
+		goto Error;
+
+	snprintf(tempFileName, sizeof(tempFileName), "%s.tmp", identity->fileName);
 
-	(void)RsCore_GetRsSession(instrSession, &rsSession);
-	
 	gMutex = RsCoreInt_MutexLock(gMutex);
-	if (rsSession != NULL)
+	locked = VI_TRUE;
+
+	// Keep the lines of the other resources
+	if ((file = fopen(identity->fileName, "rb")) != NULL)
 	{
-		(void)RsCoreInt_DisposeRepCapTable(instrSession);
+		if (fseek(file, 0, SEEK_END) != 0 || (fileSize = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0)
+			fileSize = 0;
 
-		/* Deallocate memory for attribute properties list */
-		if (rsSession->attributes != NULL)
-		{
-			for (idx = 0; idx < rsSession->attributesCount; idx++)
-			{
-				p2value = rsSession->attributes[idx].p2value;
-				if (p2value != NULL)
-				{
-					free(p2value);
-					p2value = NULL;
-				}
-			}
-			free(rsSession->attributes);
-			rsSession->attributes = NULL;
-		}
+		checkAlloc(content = (ViChar*)RsCoreInt_Malloc(rsSession->allocator, (size_t)fileSize + 1));
+		content[fread(content, 1, (size_t)fileSize, file)] = '\0';
+		fclose(file);
+		file = NULL;
+	}
 
-		if (rsSession->usedAttributesCache.attrs)
-		{
-			free(rsSession->usedAttributesCache.attrs);
-			rsSession->usedAttributesCache.attrs = NULL;
-		}
+	if ((file = fopen(tempFileName, "wb")) == NULL)
+	{
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Identity snapshot file '%s' can not be written", tempFileName);
+		(void)RsCore_SetErrorInfo(rsSession->io, VI_TRUE, VI_ERROR_FILE_ACCESS, VI_SUCCESS, errElab);
+		checkErr(VI_ERROR_FILE_ACCESS);
+	}
 
-		if (rsSession->usedAttributesCache.IDs)
+	for (line = content; line != NULL && *line != '\0'; line = next)
+	{
+		if ((next = strchr(line, '\n')) != NULL)
+			*next++ = '\0';
+
+		if ((tab = strchr(line, '\t')) == NULL || (size_t)(tab - line) != strlen(rsSession->resourceName) ||
+			strncmp(line, rsSession->resourceName, tab - line) != 0)
 		{
-			free(rsSession->usedAttributesCache.IDs);
-			rsSession->usedAttributesCache.IDs = NULL;
+			fprintf(file, "%s\n", line);
 		}
+	}
 
-		(void)RsCoreInt_SessionsListDeleteSession(instrSession);
+	fprintf(file, "%s\t%s\t%s\n", rsSession->resourceName, identity->idn, identity->options);
+
+	written = (ferror(file) == 0) ? VI_TRUE : VI_FALSE;
+	if (fclose(file) != 0)
+		written = VI_FALSE;
+
+	file = NULL;
+
+#if defined(ANSI)
+	if (written == VI_TRUE && MoveFileExA(tempFileName, identity->fileName, MOVEFILE_REPLACE_EXISTING) == 0)
+		written = VI_FALSE;
+#else
+	if (written == VI_TRUE && rename(tempFileName, identity->fileName) != 0)
+		written = VI_FALSE;
+#endif
+
+	if (written == VI_FALSE)
+	{
+		(void)remove(tempFileName);
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Identity snapshot file '%s' can not be written", identity->fileName);
+		(void)RsCore_SetErrorInfo(rsSession->io, VI_TRUE, VI_ERROR_FILE_ACCESS, VI_SUCCESS, errElab);
+		checkErr(VI_ERROR_FILE_ACCESS);
 	}
-	RsCoreInt_MutexUnlock(gMutex);
+
+Error:
+	if (file)
+	{
+		fclose(file);
+		(void)remove(tempFileName);
+	}
+
+	if (locked == VI_TRUE)
+		RsCoreInt_MutexUnlock(gMutex);
+
+	RsCoreInt_Free(rsSession->allocator, content);
 
 	return error;
 }
 
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- INTERNAL VISA IO Helpers ------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
 /*****************************************************************************************************/
-/*  RsCore_SetSpecificDriverRevision
-    Sets summary information string usually to the RS_ATTR_SPECIFIC_DRIVER_REVISION
-    Use it in the driver's PREFIX_InitAttributes function
+/*  RsCoreInt_PollingDelay
+    Generates progressive OPC polling delay depending on the selected mode
 ******************************************************************************************************/
-ViStatus RsCore_SetSpecificDriverRevision(ViSession instrSession, ViAttr specificDriverRevisionAttrId)
+void RsCoreInt_PollingDelay(ViReal64 elapsedTimeMs, ViInt32 opcWaitMode)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar prefix[RS_MAX_MESSAGE_LEN];
-	ViChar buffer[RS_MAX_MESSAGE_LEN];
-	ViChar revision[RS_MAX_MESSAGE_BUF_SIZE];
-	ViInt32 majorVer, minorVer, minorminorVer;
-
-	checkErr(RsCore_GetAttributeViString(instrSession, NULL, RS_ATTR_SPECIFIC_DRIVER_PREFIX, 0, RS_MAX_MESSAGE_LEN, prefix));
-	checkErr(RsCore_GetAttributeViInt32(instrSession, NULL, RS_ATTR_SPECIFIC_DRIVER_MAJOR_VERSION, 0, &majorVer));
-	checkErr(RsCore_GetAttributeViInt32(instrSession, NULL, RS_ATTR_SPECIFIC_DRIVER_MINOR_VERSION, 0, &minorVer));
-	checkErr(RsCore_GetAttributeViInt32(instrSession, NULL, RS_ATTR_SPECIFIC_DRIVER_MINOR_MINOR_VERSION, 0, &minorminorVer));
-
-	checkErr(RsCoreInt_GetVisaInfo(instrSession, RS_MAX_MESSAGE_BUF_SIZE, revision));
-
-	sprintf(buffer,
-	        "Driver: %s " _PERCD "." _PERCD "." _PERCD ", Compiler: %s %3.2f, "
-	        "Components: RsCore Component %.2f, VISA-Spec %s",
-	        prefix, majorVer, minorVer, minorminorVer,
-	        RS_COMPILER_NAME, RS_COMPILER_VER_NUM,
-	        RSCORE_ENGINE_MAJOR_VERSION + RSCORE_ENGINE_MINOR_VERSION / 10.0,
-	        revision);
+	switch (opcWaitMode)
+	{
+	case RS_VAL_OPCWAIT_STBPOLLINGSLOW:
+		if (elapsedTimeMs < 10.0)
+			Sleep(1);
+		else if (elapsedTimeMs < 1000.0)
+			Sleep(20);
+		else if (elapsedTimeMs < 5000.0)
+			Sleep(100);
+		else if (elapsedTimeMs < 10000.0)
+			Sleep(200);
+		else if (elapsedTimeMs < 20000.0)
+			Sleep(500);
+		else
+			Sleep(1000);
+		break;
 
-	checkErr(RsCore_SetAttributeViString(instrSession, NULL, specificDriverRevisionAttrId, 0, buffer));
+	case RS_VAL_OPCWAIT_STBPOLLINGSUPERSLOW:
+		if (elapsedTimeMs < 1000.0)
+			Sleep(100);
+		else if (elapsedTimeMs < 10000.0)
+			Sleep(500);
+		else if (elapsedTimeMs < 20000.0)
+			Sleep(1000);
+		else
+			Sleep(2000);
+		break;
 
-Error:
-	return error;
+	default: // RS_VAL_OPCWAIT_STBPOLLING
+		if (elapsedTimeMs < 10.0);
+		else if (elapsedTimeMs < 100.0)
+			Sleep(5);
+		else if (elapsedTimeMs < 1000.0)
+			Sleep(20);
+		else if (elapsedTimeMs < 5000.0)
+			Sleep(50);
+		else if (elapsedTimeMs < 10000.0)
+			Sleep(100);
+		else if (elapsedTimeMs < 50000.0)
+			Sleep(500);
+		else
+			Sleep(1000);
+		break;
+	}
 }
 
 /*****************************************************************************************************/
-/*  RsCore_ViClear
-    Sends VISA viClear command to the instrument
+/*  RsCoreInt_GetVisaInfo
+    Returns used VISA info string
 ******************************************************************************************************/
-ViStatus RsCore_ViClear(ViSession instrSession)
+ViStatus RsCoreInt_GetVisaInfo(ViSession instrSession, ViInt32 bufferSize, ViChar* visaInfo)
 {
 	ViStatus error = VI_SUCCESS;
-	RsCoreSessionPtr rsSession = NULL;
+	ViChar manufacturer[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 version;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	const RsCoreTransport* transport;
+	void* context;
 
 	if (RsCore_Simulating(instrSession) == VI_TRUE)
-		goto Error;
+	{
+		RsCoreInt_StrcpyMaxLen(visaInfo, bufferSize, "Rohde & Schwarz Visa 5.8.5");
+		return error;
+	}
 
-	if (rsSession->allowViClear == VI_FALSE)
-		goto Error;
+	if (RsCoreInt_GetTransport(instrSession, &transport, &context))
+	{
+		snprintf(visaInfo, bufferSize, "IO transport '%s'", transport->name);
+		return error;
+	}
 
-	checkErr(viClear(instrSession));
+	checkErr(RsCoreInt_IoGetAttribute(instrSession, VI_ATTR_RSRC_MANF_NAME, manufacturer));
+	checkErr(RsCoreInt_IoGetAttribute(instrSession, VI_ATTR_RSRC_IMPL_VERSION, &version));
+	snprintf(visaInfo, bufferSize, "%s VISA %0.2f", manufacturer,
+	         (ViReal64)(version >> 20) * 100 +
+	         (ViReal64)((version >> 8) & 0xFFF) * 10 +
+	         (ViReal64)(version & 0xFF) / 100.0);
 
 Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_ViClear
-    Performs standard instrument ClearStatus procedure
+/*  RsCoreInt_GetSessionType
+    Returns the session type based on which the core makes different operations
 ******************************************************************************************************/
-ViStatus RsCore_ClearStatus(ViSession instrSession)
+ViStatus RsCoreInt_GetSessionType(ViSession instrSession, RsCoreSessionType* sessionType)
 {
 	ViStatus error = VI_SUCCESS;
+	ViUInt16 intf;
+	ViChar rsrcClass[256] = "";
 
-	checkErr(RsCore_ViClear(instrSession));
-	checkErr(RsCoreInt_ClearBeforeRead(instrSession));
+	checkErr(RsCoreInt_IoGetAttribute(instrSession, VI_ATTR_INTF_TYPE, &intf));
+	switch (intf)
+	{
+	case VI_INTF_TCPIP:
+		checkErr(RsCoreInt_IoGetAttribute(instrSession, VI_ATTR_RSRC_CLASS, rsrcClass));
+		if (strcmp(rsrcClass, "SOCKET") == 0)
+			*sessionType = RS_INTF_SOCKET;
+		else
+			*sessionType = RS_INTF_TCPIP;
+
+		break;
+
+	case VI_INTF_GPIB:
+	case VI_INTF_GPIB_VXI:
+		*sessionType = RS_INTF_GPIB;
+		break;
+
+	case VI_INTF_ASRL:
+		*sessionType = RS_INTF_ASRL;
+		break;
+
+	case VI_INTF_USB:
+		*sessionType = RS_INTF_USB;
+		break;
+	default:
+		*sessionType = RS_INTF_UNKNOWN;
+	}
 
 Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_LockSession
-    Obtains a lock on the specified resource.
-    Obtains a multi-thread lock on the instrument session. Before it does so, it waits until all other execution threads
-    have released their locks on the instrument session.
+/*  RsCoreInt_SpecifyVisaError
+    Describes VISA error in more details
 ******************************************************************************************************/
-ViStatus RsCore_LockSession(ViSession instrSession)
+ViStatus RsCoreInt_SpecifyVisaError(ViSession instrSession, ViStatus error, ViConstString context, ViConstString sentCmd)
 {
-	ViStatus error = VI_SUCCESS;
-	RsCoreSessionPtr rsSession = NULL;
+	ViUInt32 visaTimeoutMs = 10000;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar cmdString[RS_MAX_MESSAGE_BUF_SIZE] = "";
+	ViBoolean patternFound;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (error == VI_SUCCESS)
+		return error;
 
-	if (rsSession->multiThreadLocking == VI_TRUE)
+	if (error == VI_ERROR_TMO)
 	{
-		rsSession->mutex = RsCoreInt_MutexLock(rsSession->mutex);
+		// VISA timeout error, specify it more
+		// But only if it has not been more specified before
+		(void)RsCoreInt_CheckErrorElaboration(instrSession, "VISA Read resulted in timeout", &patternFound);
+		if (patternFound)
+			return error;
+
+		(void)RsCoreInt_CheckErrorElaboration(instrSession, "Waiting for OPC resulted in timeout", &patternFound);
+		if (patternFound)
+			return error;
+
+		(void)RsCore_GetVisaTimeout(instrSession, &visaTimeoutMs);
+		if (!isNullOrEmpty(sentCmd))
+		{
+			RsCoreInt_StrcpyMaxLen(cmdString, RS_MAX_MESSAGE_BUF_SIZE, sentCmd);
+			RsCore_TrimString(cmdString, RS_VAL_TRIM_WHITESPACES);
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, " Sent command: \"%s\". ", cmdString);
+			RsCoreInt_StrcpyMaxLen(cmdString, RS_MAX_MESSAGE_BUF_SIZE, errElab);
+		}
+
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "%s VISA Read resulted in timeout.%s"
+		         " This usually means the instrument is not responding to a query. "
+		         "Current VISA timeout is set to " _PERCU " ms. You can change it with the "
+		         "PREFIX_SetVisaTimeout.", isNullOrEmpty(context) ? "" : context, cmdString, visaTimeoutMs);
+		(void)RsCore_SetErrorInfo(instrSession, VI_TRUE, VI_ERROR_TMO, VI_SUCCESS, errElab);
 	}
 
-Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_UnlockSession
-    Releases a lock that you acquired on an instrument session using RsCore_LockSession.
+/*  RsCoreInt_ClearBeforeRead
+    Puts the instrument's status subsystem and its IO buffer to a defined status
 ******************************************************************************************************/
-ViStatus RsCore_UnlockSession(ViSession instrSession)
+ViStatus RsCoreInt_ClearBeforeRead(ViSession instrSession)
 {
 	ViStatus error = VI_SUCCESS;
+	ViInt32 stb = 0, previous_stb;
+	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE];
 	RsCoreSessionPtr rsSession = NULL;
 
 	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	if (rsSession->multiThreadLocking == VI_TRUE)
+	// STB read is determined by the fastSweepInstrument
+	if (rsSession->vxiCapable == VI_TRUE)
 	{
-		RsCoreInt_MutexUnlock(rsSession->mutex);
+		if (rsSession->fastSweepInstrument > 0)
+		{
+			checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
+		}
+		else
+		{
+			checkErr(RsCore_QueryViInt32(instrSession, "*STB?", &stb));
+		}
+	}
+	else
+	{
+		// Non-VXI session must use *CLS in any case
+		checkErr(RsCore_Write(instrSession, "*CLS"));
+		checkErr(RsCore_QueryViInt32(instrSession, "*OPC?", NULL));
+		checkErr(RsCore_QueryViInt32(instrSession, "*STB?", &stb));
 	}
 
-Error:
-	return error;
-}
+	// ErrorQueueNotEmpty or EventStatusByte or MessageAvailable
+	while (stb & 0x34)
+	{
+		if ((stb & IEEE_488_2_STB_ERR_QUEUE_MASK) > 0)
+		{
+			// ErrorQueueNotEmpty
+			checkErr(RsCore_Write(instrSession, "*CLS"));
+			checkErr(RsCore_ErrorQueryAll(instrSession, NULL, RS_MAX_MESSAGE_BUF_SIZE, buffer));
+		}
 
-/*****************************************************************************************************/
-/*  RsCore_Simulating
-    Returns the current value of the RS_ATTR_SIMULATE attribute
-******************************************************************************************************/
-ViBoolean RsCore_Simulating(ViSession instrSession)
-{
-	ViBoolean value = VI_FALSE;
-	RsCoreSessionPtr rsSession = NULL;
+		if ((stb & IEEE_488_2_STB_ESB_MASK) > 0)
+		{
+			// EventStatusByte
+			checkErr(RsCore_Write(instrSession, "*CLS"));
+			checkErr(RsCoreInt_QueryClearEsr(instrSession));
+		}
 
-	(void)RsCore_GetRsSession(instrSession, &rsSession);
+		if ((stb & IEEE_488_2_STB_MAV_MASK) > 0)
+		{
+			// Message available
+			checkErr(RsCoreInt_FlushData(instrSession, VI_TRUE));
+		}
 
-	if (rsSession == 0)
-		return value;
+		previous_stb = stb;
+		// STB read is determined by the fastSweepInstrument
+		if (rsSession->fastSweepInstrument > 0 && rsSession->vxiCapable > 0)
+		{
+			checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
+		}
+		else
+		{
+			checkErr(RsCore_QueryViInt32(instrSession, "*STB?", &stb));
+		}
 
-	(void)(RsCoreInt_GetAttrP2Value(rsSession->attrSimulatePtr, &value, 0));
+		if (stb == previous_stb)
+		{
+			// Cannot clear the StatusRegister
+			snprintf(buffer, RS_MAX_MESSAGE_BUF_SIZE, "Cannot clear the instrument status. Last STB value: " _PERCD, stb);
+			viCheckErrElab(RS_ERROR_CANNOT_RECOVER, buffer);
+			break;
+		}
+	}
 
-	return value;
+Error:
+	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_RangeChecking
-    Returns the current value of the RS_ATTR_RANGE_CHECK attribute
+/*  Queries and Clears the ESR register
 ******************************************************************************************************/
-ViBoolean RsCore_RangeChecking(ViSession instrSession)
+ViStatus RsCoreInt_QueryClearEsr(ViSession instrSession)
 {
-	ViBoolean value = VI_TRUE;
-	RsCoreSessionPtr rsSession = NULL;
-
-	(void)RsCore_GetRsSession(instrSession, &rsSession);
-
-	if (rsSession == 0)
-		return value;
-
-	(void)(RsCoreInt_GetAttrP2Value(rsSession->attrRangeCheckPtr, &value, 0));
-
-	return value;
-}
-
-/*****************************************************************************************************/
-/*   RsCore_QueryInstrStatus
-     Returns the current value of the RS_ATTR_QUERY_INSTR_STATUS attribute
-******************************************************************************************************/
-ViBoolean RsCore_QueryInstrStatus(ViSession instrSession)
-{
-	ViBoolean value = VI_TRUE;
-	RsCoreSessionPtr rsSession = NULL;
-
-	(void)RsCore_GetRsSession(instrSession, &rsSession);
-
-	if (rsSession == 0)
-		return value;
-
-	(void)(RsCoreInt_GetAttrP2Value(rsSession->attrQueryInstrStatusPtr, &value, 0));
-
-	return value;
-}
-
-/*****************************************************************************************************/
-/*  RsCore_SetVisaTimeout
-    Sets VISA timeout in milliseconds
-******************************************************************************************************/
-ViStatus RsCore_SetVisaTimeout(ViSession instrSession, ViUInt32 timeoutMs)
-{
-	if (RsCore_Simulating(instrSession) == VI_TRUE)
-		return VI_SUCCESS;
-
-	return viSetAttribute(instrSession, VI_ATTR_TMO_VALUE, timeoutMs);
+	return RsCore_QueryViStringShort(instrSession, "*ESR?", NULL);
 }
 
 /*****************************************************************************************************/
-/*  Returns VISA timeout in milliseconds
+/*  If the input opcTimeoutMs is > 0, it is not changed
+    If the input opcTimeoutMs is <= 0, it is changed to the current value of RS_ATTR_OPC_TIMEOUT
 ******************************************************************************************************/
-ViStatus RsCore_GetVisaTimeout(ViSession instrSession, ViPUInt32 timeoutMs)
+ViStatus RsCoreInt_ResolveOpcTimeout(ViSession instrSession, ViInt32* opcTimeoutMs)
 {
-	if (RsCore_Simulating(instrSession) == VI_TRUE)
+	if (*opcTimeoutMs > 0)
+	{
 		return VI_SUCCESS;
+	}
 
-	return viGetAttribute(instrSession, VI_ATTR_TMO_VALUE, timeoutMs);
+	return RsCore_GetAttributeViInt32(instrSession, NULL, RS_ATTR_OPC_TIMEOUT, 0, opcTimeoutMs);
 }
 
-/******************************************************************************************************
-------------------------------------------------------------------------------------------------------*
----- Set / Get / Clear Error info --------------------------------------------------------------------*
-------------------------------------------------------------------------------------------------------*
-******************************************************************************************************/
-
 /*****************************************************************************************************/
-/*  RsCore_SetErrorInfo
-    Sets error info for the session. The viCheckErr, viCheckErrElab, viCheckParm, viCheckAlloc,
-    and viCheckWarn macros use RsCore_SetErrorInfo
+/*  Return Status byte values.
+    For VXI11-capable sessions it uses viReadSTB(), for others it uses *STB? query
 ******************************************************************************************************/
-ViStatus RsCore_SetErrorInfo(ViSession instrSession,
-                             ViBoolean overWrite,
-                             ViStatus primaryError,
-                             ViStatus secondaryError,
-                             ViConstString errorElab)
+ViStatus RsCoreInt_GetStatusByte(ViSession instrSession, ViInt32* stb, ViBoolean blockTmoSettings)
 {
 	ViStatus error = VI_SUCCESS;
+	ViInt32 oldVisaTout = 0;
+	ViUInt16 stbInt16;
+	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
 	RsCoreSessionPtr rsSession = NULL;
 
-	(void)RsCore_GetRsSession(instrSession, &rsSession);
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	if (rsSession == NULL)
+	if (rsSession->vxiCapable)
 	{
-		if (overWrite == VI_TRUE || ((gPrimaryError >= VI_SUCCESS) && (primaryError < VI_SUCCESS)))
+		if (rsSession->viReadStbVisaTimeoutMs > 0 && blockTmoSettings == VI_FALSE)
 		{
-			RsCoreInt_SetGlobalErrorInfo(primaryError, secondaryError, errorElab);
-			return primaryError;
+			checkErr(RsCoreInt_IoGetAttribute(instrSession, VI_ATTR_TMO_VALUE, &oldVisaTout));
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TMO_VALUE, rsSession->viReadStbVisaTimeoutMs));
 		}
-
-		return VI_ERROR_INV_OBJECT;
+		error = RsCoreInt_IoReadStb(instrSession, &stbInt16);
+		*stb = (ViInt32)stbInt16;
 	}
-
-	if (overWrite == VI_TRUE || (((rsSession->primaryError >= VI_SUCCESS) && (primaryError < VI_SUCCESS))))
+	else
 	{
-		// Set the values to the rsSession structure
-		rsSession->primaryError = primaryError;
-		rsSession->secondaryError = secondaryError;
-		RsCoreInt_StrcpyMaxLen(rsSession->errorElaboration, RS_MAX_MESSAGE_BUF_SIZE, errorElab);
-
-		// Set the values to the attributes
-		(void)RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_PRIMARY_ERROR, 0, primaryError);
-		(void)RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_SECONDARY_ERROR, 0, secondaryError);
-		(void)RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_ERROR_ELABORATION, 0, errorElab);
+		*stb = 0;
+		checkErr(RsCore_QueryViStringShort(instrSession, "*STB?", response));
+		*stb = (ViInt32)atoi(response);
+	}
 
-		(void)RsCoreInt_SetGlobalErrorInfo(primaryError, secondaryError, errorElab);
+Error:
+	if (oldVisaTout > 0)
+	{
+		checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TMO_VALUE, oldVisaTout));
 	}
 
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_GetErrorInfo
-    Retrieves and then clears the error information for the entered session.
-    Used attributes:
-    - RS_ATTR_PRIMARY_ERROR or PREFIX_ATTR_PRIMARY_ERROR
-    - RS_ATTR_SECONDARY_ERROR or PREFIX_ATTR_SECONDARY_ERROR
-    - RS_ATTR_ERROR_ELABORATION or PREFIX_ATTR_ERROR_ELABORATION
-        For errorElaboration string you need to pass the buffer with the size at least RS_MAX_MESSAGE_BUF_SIZE
+/*  Rebuilds the entered instrument options string with the following steps:
+    - based on the optionsParsingMode it keeps parts before or after dash
+    - trims all elements for white spaces and paired quotation marks
+    - removes duplicates
+    - sorts the options in the ascending order - starting with K0, up to K9999 and then B0 up to B9999
 ******************************************************************************************************/
-ViStatus RsCore_GetErrorInfo(ViSession instrSession, ViStatus* primaryError, ViStatus* secondaryError, ViChar* errorElaboration)
+ViStatus RsCoreInt_ParseOptionsString(ViSession instrSession, ViChar* instrumentOptionsString, ViInt32 optionsParsingMode)
 {
 	ViStatus error = VI_SUCCESS;
-	RsCoreSessionPtr rsSession = NULL;
-
-	(void)RsCore_GetRsSession(instrSession, &rsSession);
+	ViChar* element;
+	ViInt32 len;
+	ViInt32 elementsCount, allocatedCount = 0;
+	ViChar** optionsArray = NULL;
+	ViInt32* optionsNumbersArray = NULL;
+	ViInt32 idx, tokenIdx;
+	ViInt32 i;
+	ViInt32 minIdx;
+	ViInt32 optionNumber;
+	ViBoolean result;
+	ViBoolean duplicate;
+	ViChar auxString[RS_MAX_MESSAGE_LEN];
+	ViChar before[RS_MAX_MESSAGE_LEN];
+	ViChar after[RS_MAX_MESSAGE_LEN];
+	ViChar token[RS_MAX_MESSAGE_LEN];
 
-	if (rsSession == NULL)
-	{
-		// in this case return the global last error entry
-		RsCoreInt_GetGlobalErrorInfo(primaryError, secondaryError, errorElaboration);
-		RsCoreInt_SetGlobalErrorInfo(VI_SUCCESS, VI_SUCCESS, "");
-	}
-	else
+	if (instrumentOptionsString == NULL)
 	{
-		*primaryError = rsSession->primaryError;
-		*secondaryError = rsSession->secondaryError;
-		RsCoreInt_StrcpyMaxLen(errorElaboration, RS_MAX_MESSAGE_BUF_SIZE, rsSession->errorElaboration);
-		(void)RsCore_ClearErrorInfo(instrSession);
+		checkErr(RS_ERROR_NULL_POINTER);
 	}
 
-	return error;
-}
+	RsCore_TrimString(instrumentOptionsString, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+	len = (ViInt32)strlen(instrumentOptionsString);
+	if (len == 0)
+		goto Error;
 
-/*****************************************************************************************************/
-/*  RsCore_AppendSecondaryError
-    If primaryError is < 0, the function adds the secondary error and errorElab
-    If the entered primaryError does not equal the existing primaryError, the entered primaryError takes priority.
-    The function does not overwrite the existing error elaboration, rather it appends the new one to the end.
-    For special secondary error codes e.g. RS_ERROR_INVALID_PARAMETER, VI_ERROR_PARAMETER1 .. VI_ERROR_PARAMETER8
-    the new error elaboration is added in a special way to make the elaboration more comprehensive
-******************************************************************************************************/
-ViStatus RsCore_AppendSecondaryError(ViSession instrSession,
-                                     ViStatus primaryError,
-                                     ViStatus secondaryError,
-                                     ViConstString errorElab)
-{
-	ViStatus error = VI_SUCCESS;
-	ViInt32 parameterIdx = 1;
-	ViChar existingErrElab[RS_MAX_MESSAGE_BUF_SIZE];
-	ViChar composedErrElab[RS_MAX_MESSAGE_BUF_SIZE];
-	ViStatus existingPrimaryErr, existingSecondaryErr;
+	elementsCount = RsCore_GetElementsCount(instrumentOptionsString, ',');
 
-	if (primaryError == VI_SUCCESS)
-		return error;
+	// Allocate optionsArray[] of ViChar* pointers;
+	checkAlloc(optionsArray = (ViChar **)RsCore_Calloc(instrSession, elementsCount, sizeof(ViChar*)));
+	allocatedCount = elementsCount;
 
-	switch (secondaryError)
+	// loop through the elements, fill the optionsArray[], remove duplicates
+	idx = 0;
+	for (tokenIdx = 0; tokenIdx < elementsCount; tokenIdx++)
 	{
-	case RS_ERROR_INVALID_PARAMETER: parameterIdx = 0;
-		break;
-	case VI_ERROR_PARAMETER1: parameterIdx = 1;
-		break;
-	case VI_ERROR_PARAMETER2: parameterIdx = 2;
-		break;
-	case VI_ERROR_PARAMETER3: parameterIdx = 3;
-		break;
-	case VI_ERROR_PARAMETER4: parameterIdx = 4;
-		break;
-	case VI_ERROR_PARAMETER5: parameterIdx = 5;
-		break;
-	case VI_ERROR_PARAMETER6: parameterIdx = 6;
-		break;
-	case VI_ERROR_PARAMETER7: parameterIdx = 7;
-		break;
-	case VI_ERROR_PARAMETER8: parameterIdx = 8;
-		break;
-	default: parameterIdx = -1;
-		break;
-	}
-
-	(void)RsCore_GetErrorInfo(instrSession, &existingPrimaryErr, &existingSecondaryErr, existingErrElab);
+		checkErr(RsCore_GetTokenAtIndex(instrumentOptionsString, ',', tokenIdx, token, RS_MAX_MESSAGE_LEN, NULL));
+		element = token;
+		if (optionsParsingMode == RS_VAL_OPTIONS_PARSING_KEEP_ORIGINAL)
+		{
+			RsCoreInt_SplitTokenToNameAndValue(token, ":", auxString, after, RS_MAX_MESSAGE_LEN);
+			element = auxString;
+		}
+		else if (optionsParsingMode == RS_VAL_OPTIONS_PARSING_KEEP_BEFORE_DASH)
+		{
+			RsCoreInt_SplitTokenToNameAndValue(token, "-", before, after, RS_MAX_MESSAGE_LEN); // take before in any case
 
-	if (parameterIdx == -1)
-	{
-		// Error code other than Parameter error
-		snprintf(composedErrElab, RS_MAX_MESSAGE_BUF_SIZE, "%s\n%s", existingErrElab, errorElab);
-	}
-	else
-	{
-		if (isNullOrEmpty(errorElab))
+			// Remove the parts after ':'
+			RsCoreInt_SplitTokenToNameAndValue(before, ":", auxString, after, RS_MAX_MESSAGE_LEN);
+			element = auxString;
+		}
+		else if (optionsParsingMode == RS_VAL_OPTIONS_PARSING_KEEP_AFTER_DASH)
 		{
-			if (parameterIdx == 0)
+			result = RsCoreInt_SplitTokenToNameAndValue(token, "-", before, after, RS_MAX_MESSAGE_LEN);
+			if (result) // Dash found, take the part after
 			{
-				// Parameter error, unknown Idx, no name provided
-				snprintf(composedErrElab, RS_MAX_MESSAGE_BUF_SIZE,
-				         "Error related to unknown function parameter.\n%s", existingErrElab);
+				// Remove the parts after ':'
+				RsCoreInt_SplitTokenToNameAndValue(after, ":", auxString, before, RS_MAX_MESSAGE_LEN);
+				element = auxString;
 			}
-			else
+			else // Dash not found, take the whole string stored in before
 			{
-				// Parameter error, known Idx, no name provided
-				snprintf(composedErrElab, RS_MAX_MESSAGE_BUF_SIZE,
-				         "Error related to function parameter no. " _PERCD ".\n%s", parameterIdx, existingErrElab);
+				// Remove the parts after ':'
+				RsCoreInt_SplitTokenToNameAndValue(before, ":", auxString, after, RS_MAX_MESSAGE_LEN);
+				element = auxString;
 			}
 		}
-		else
+		else if (optionsParsingMode == RS_VAL_OPTIONS_PARSING_AUTO)
 		{
-			if (parameterIdx == 0)
+			ViInt32 beforeScanned, afterScanned;
+			
+			// Remove the parts after ':'
+			result = RsCoreInt_SplitTokenToNameAndValue(token, ":", auxString, after, RS_MAX_MESSAGE_LEN);
+			if (result) // ':' found, take the part before
 			{
-				// Parameter error, unknown Idx, name is provided
-				snprintf(composedErrElab, RS_MAX_MESSAGE_BUF_SIZE,
-				         "Error related to function parameter '%s'.\n%s", errorElab, existingErrElab);
+				element = auxString;
 			}
 			else
 			{
-				// Parameter error, known Idx, name is provided
-				snprintf(composedErrElab, RS_MAX_MESSAGE_BUF_SIZE,
-				         "Error related to function parameter no. " _PERCD " - '%s'.\n%s", parameterIdx, errorElab, existingErrElab);
+				element = token;
+			}
+			result = RsCoreInt_SplitTokenToNameAndValue(element, "-", before, after, RS_MAX_MESSAGE_LEN);
+			if (result) // Dash found, pick either before or after
+			{
+				beforeScanned = sscanf(before, "%[KB]" _PERCD, auxString, &optionNumber);
+				afterScanned = sscanf(after, "%[KB]" _PERCD, auxString, &optionNumber);
+				
+				// Prefer element after
+				element = after;
+				if (beforeScanned > afterScanned)
+				{
+					element = before;
+				}
+			}
+		}
+
+		RsCore_TrimString(element, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+		if (strlen(element) == 0)
+			continue;
+
+		// Detect duplicates, only add to the optionsArray if not already there
+		duplicate = VI_FALSE;
+		for (i = 0; i < idx; i++)
+		{
+			if (strcmp(element, optionsArray[i]) == 0)
+			{
+				duplicate = VI_TRUE;
+				break;
 			}
 		}
+
+		if (!duplicate)
+		{
+			checkAlloc(optionsArray[idx] = (ViChar*)RsCore_Calloc(instrSession, strlen(element) + 1, sizeof(ViChar)));
+			RsCoreInt_StrcpyMaxLen(optionsArray[idx], (ViInt32)strlen(element) + 1, element);
+			idx++;
+		}
 	}
 
-	RsCore_TrimString(composedErrElab, RS_VAL_TRIM_WHITESPACES);
-	RsCore_SetErrorInfo(instrSession, VI_TRUE, primaryError, secondaryError, composedErrElab);
+	// New elements count after removing duplicates
+	elementsCount = idx;
 
-	return error;
-}
+	// Allocate optionsNumbersArray[] of ViInt32 values used for sorting
+	checkAlloc(optionsNumbersArray = (ViInt32*)RsCore_Calloc(instrSession, elementsCount, sizeof(ViInt32)));
+	for (idx = 0; idx < elementsCount; idx++)
+	{
+		optionNumber = 0;
+		i = sscanf(optionsArray[idx], "%[KB]" _PERCD, auxString, &optionNumber);
+		if (i == 0) // Scanned incorrectly
+			// Put to the very end
+			optionNumber += 2000000;
+		else if (i > 0) // K/B scanned correctly
+			// Offset to put B-options behind K-options
+			if (strcmp(auxString, "B") == 0) optionNumber += 1000000;
 
-/*****************************************************************************************************/
-/*  RsCore_ClearErrorInfo
-    Clears error information for the current session and the global error info.
-    Affected attributes:
-    - RS_ATTR_PRIMARY_ERROR or PREFIX_ATTR_PRIMARY_ERROR
-    - RS_ATTR_SECONDARY_ERROR or PREFIX_ATTR_SECONDARY_ERROR
-    - RS_ATTR_ERROR_ELABORATION or PREFIX_ATTR_ERROR_ELABORATION
-******************************************************************************************************/
-ViStatus RsCore_ClearErrorInfo(ViSession instrSession)
-{
-	ViStatus error = VI_SUCCESS;
-	RsCoreSessionPtr rsSession = NULL;
+		optionsNumbersArray[idx] = optionNumber;
+	}
 
-	(void)RsCore_GetRsSession(instrSession, &rsSession);
+	// Pick one by one starting from the smallest optionNumber, rebuild the instrumentOptionsString
+	memset(instrumentOptionsString, 0, len + 1);
+	for (idx = 0; idx < elementsCount; idx++)
+	{
+		// Find the minimum
+		optionNumber = 10000000;
+		minIdx = 1;
+		for (i = 0; i < elementsCount; i++)
+		{
+			if (optionNumber > optionsNumbersArray[i])
+			{
+				optionNumber = optionsNumbersArray[i];
+				minIdx = i;
+			}
+		}
 
-	RsCoreInt_SetGlobalErrorInfo(VI_SUCCESS, VI_SUCCESS, "");
+		optionsNumbersArray[minIdx] = 10000000; // Invalidate the value
+		RsCore_AppendToCsvString(instrumentOptionsString, (ViChar*)",", len + 1, optionsArray[minIdx]);
+	}
 
-	if (rsSession == NULL)
-		return error;
+Error:
+	// Free allocated resources
+	if (optionsArray)
+		for (idx = 0; idx < allocatedCount; idx++)
+			if (optionsArray[idx])
+				RsCore_Free(instrSession, optionsArray[idx]);
 
-	rsSession->primaryError = VI_SUCCESS;
-	rsSession->secondaryError = VI_SUCCESS;
-	memset(rsSession->errorElaboration, 0, RS_MAX_MESSAGE_BUF_SIZE);
+	if (optionsArray)
+		RsCore_Free(instrSession, optionsArray);
 
-	(void)RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_PRIMARY_ERROR, 0, VI_SUCCESS);
-	(void)RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_SECONDARY_ERROR, 0, VI_SUCCESS);
-	(void)RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_ERROR_ELABORATION, 0, "");
+	if (optionsNumbersArray)
+		RsCore_Free(instrSession, optionsNumbersArray);
 
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_ParamPositionError
-    Returns one of the VI_ERROR_PARAMETER1 ... VI_ERROR_PARAMETER8, RS_ERROR_INVALID_PARAMETER.
+/*  Waits for OPC by STB polling
 ******************************************************************************************************/
-ViStatus RsCore_ParamPositionError(ViInt32 parameterPosition)
+ViStatus RsCoreInt_WaitForOpcSTBpoll(ViSession instrSession, ViInt32 timeoutMs)
 {
-	ViInt32 error[] = {
-		RS_ERROR_INVALID_PARAMETER,
-		VI_ERROR_PARAMETER1, VI_ERROR_PARAMETER2,
-		VI_ERROR_PARAMETER3, VI_ERROR_PARAMETER4,
-		VI_ERROR_PARAMETER5, VI_ERROR_PARAMETER6,
-		VI_ERROR_PARAMETER7, VI_ERROR_PARAMETER8
-	};
+	ViStatus error = VI_SUCCESS;
+	ViInt32 stb = 0;
+	ViReal64 opcTimeoutMs;
+	ViInt32 oldVisaTout = 0;
+	ViReal64 elapsedTimeMs;
+	ViReal64 startTimeMs = RsCoreInt_GetTickCountMs();
+	RsCoreSessionPtr rsSession = NULL;
 
-	return ((0 < parameterPosition) && (parameterPosition < 9)) ? error[parameterPosition] : RS_ERROR_INVALID_PARAMETER;
-}
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-/*****************************************************************************************************/
-/*  RsCore_GetErrorCompleteDescription
-    Calls RsCore_GetErrorInfo and composes a comprehensive string description of the current error.
-    For errorMessageFnc pass the pointer to the driver's PREFIX_error_message() function
-******************************************************************************************************/
-ViStatus RsCore_GetErrorCompleteDescription(ViSession instrSession, RsCoreErrorMessage errorMessageFnc,
-                                            ViStatus* errorCode, ViInt32 bufferSize, ViChar* description)
-{
-	ViStatus error = VI_SUCCESS;
-	ViStatus primaryError = VI_SUCCESS;
-	ViStatus secondaryError = VI_SUCCESS;
-	ViChar elaboration[RS_MAX_MESSAGE_BUF_SIZE] = "";
-	ViChar elabNew[RS_MAX_MESSAGE_BUF_SIZE] = "";
-	ViChar errorMessage[RS_MAX_MESSAGE_BUF_SIZE + 1];
-	ViInt32 offset = 0;
+	if (RsCore_Simulating(instrSession) == VI_TRUE)
+		goto Error;
 
-	checkErr(RsCore_GetErrorInfo(instrSession, &primaryError, &secondaryError, elaboration));
-	RsCoreInt_StrcpyMaxLen(elabNew, RS_MAX_MESSAGE_BUF_SIZE, "");
-	if (primaryError != VI_SUCCESS)
+	opcTimeoutMs = (ViReal64)timeoutMs;
+
+	if (rsSession->vxiCapable && rsSession->viReadStbVisaTimeoutMs > 0)
 	{
-		checkErr((*errorMessageFnc)(instrSession, primaryError, errorMessage));
-		offset += snprintf(elabNew + offset, RS_MAX_MESSAGE_BUF_SIZE - offset, "Primary Error: (Hex 0x%08X) %s\n", (unsigned int)primaryError,
-		                   errorMessage);
+		// Will use the viReadSTB, set the VISA timeout here
+		checkErr(RsCoreInt_IoGetAttribute(instrSession, VI_ATTR_TMO_VALUE, &oldVisaTout));
+		checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TMO_VALUE, rsSession->viReadStbVisaTimeoutMs));
 	}
 
-	if (secondaryError != VI_SUCCESS)
+	do
 	{
-		checkErr((*errorMessageFnc)(instrSession, secondaryError, errorMessage));
-		offset += snprintf(elabNew + offset, RS_MAX_MESSAGE_BUF_SIZE - offset, "Secondary Error: (Hex 0x%08X) %s\n", (unsigned int)secondaryError,
-		                   errorMessage);
-	}
+		checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_TRUE));
+		if ((stb & IEEE_488_2_STB_ESB_MASK) != 0)
+			break;
 
-	if (strlen(elaboration) > 0)
-		snprintf(elabNew + offset, RS_MAX_MESSAGE_BUF_SIZE - offset, "Elaboration: %s", elaboration);
+		if ((stb & IEEE_488_2_STB_ERR_QUEUE_MASK) > 0)
+		{
+			error = RS_ERROR_INSTRUMENT_STATUS;
+			goto Error;
+		}
 
-	if (errorCode)
-		*errorCode = primaryError;
+		elapsedTimeMs = RsCoreInt_GetTickCountMs() - startTimeMs;
+		if (elapsedTimeMs > opcTimeoutMs)
+		{
+			error = VI_ERROR_TMO;
+			goto Error;
+		}
 
-	if (bufferSize > 0)
-		RsCoreInt_StrcpyMaxLen(description, bufferSize, elabNew);
+		RsCoreInt_PollingDelay(elapsedTimeMs, rsSession->opcWaitMode);
+	}
+	while ((stb & IEEE_488_2_STB_ESB_MASK) == 0);
 
 Error:
+	if (oldVisaTout > 0)
+	{
+		(void)(RsCore_SetVisaTimeout(instrSession, oldVisaTout));
+	}
+
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_GetSpecificDriverStatusDesc
-    Same as RsCoreInt_GetErrorMessage, but includes additional error codes in the additionalTableToSearch
-    Use this function to implement the PREFIX_error_message function in the instrument driver.
-    The function works even with invalid instrSession
+/*  Waiting for OPC with Wait for Service Request
 ******************************************************************************************************/
-ViStatus RsCore_GetSpecificDriverStatusDesc(ViSession instrSession,
-                                            ViStatus statusCode,
-                                            ViChar* messageBuf, ViInt32 bufferSize,
-                                            RsCoreStringValueTable additionalTableToSearch)
+ViStatus RsCoreInt_WaitForOpcSRQ(ViSession instrSession, ViInt32 timeoutMs)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt16 cnt;
+	ViInt32 stb = 0;
 
-	error = RsCoreInt_StatusDescription(statusCode, bufferSize, messageBuf);
+	if (RsCore_Simulating(instrSession) == VI_TRUE)
+		return error;
 
-	if (error == VI_WARN_UNKNOWN_STATUS)
+	error = viWaitOnEvent(instrSession, VI_EVENT_SERVICE_REQ, timeoutMs, VI_NULL, VI_NULL);
+	if (error == VI_SUCCESS)
 	{
-		for (cnt = 0; additionalTableToSearch[cnt].string; cnt++)
-		{
-			if (additionalTableToSearch[cnt].value == statusCode)
-			{
-				snprintf(messageBuf, bufferSize, "%s", additionalTableToSearch[cnt].string);
-				return error;
-			}
-		}
+		checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
+	}
+	else if (error == VI_ERROR_TMO)
+	{
+		checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
+		error = VI_ERROR_TMO;
+	}
 
-		RsCoreInt_StrcpyMaxLen(messageBuf, bufferSize, "The status code passed to the operation could not be interpreted.");
-		return VI_WARN_UNKNOWN_STATUS;
+Error:
+	(void)viDisableEvent(instrSession, VI_EVENT_SERVICE_REQ, VI_QUEUE); // No error handling
+	if ((stb & IEEE_488_2_STB_ERR_QUEUE_MASK) > 0)
+	{
+		error = RS_ERROR_INSTRUMENT_STATUS;
 	}
 
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_GenerateInvalidDataTypeError
-	Generates error RS_ERROR_INVALID_TYPE with comprehensive message
-	context can be set to NULL
-	context is added to the end of the message as a new sentence
+/*  Reads and discards all the data from the instrument input buffer.
+    If totalFlush is TRUE, the method tries to completely flush the data.
+    If totalFlush is FALSE, after several reads returns an error.
 ******************************************************************************************************/
-ViStatus RsCore_GenerateInvalidDataTypeError(ViSession instrSession, RsCoreDataType dataType, ViConstString context)
+ViStatus RsCoreInt_FlushData(ViSession instrSession, ViBoolean totalFlush)
 {
-	ViStatus error = RS_ERROR_INVALID_TYPE;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-
-	if (isNullOrEmpty(context))
-	{
-		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Invalid data type - %s", RsCoreInt_GetDataTypeString(dataType));
-	}
-	else
-	{
-		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Invalid data type - %s. %s", RsCoreInt_GetDataTypeString(dataType), context);
-	}
+	ViStatus error = VI_SUCCESS;
+	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE];
+	ViUInt32 retCnt, len;
+	ViBoolean moreDataAvailable;
+	ViInt32 i; RsCoreSessionPtr rsSession = NULL;
 
-	(void)RsCore_SetErrorInfo(instrSession, VI_TRUE, error, VI_SUCCESS, errElab);
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	return error;
-}
+	if (rsSession->readDelay)
+		Sleep(rsSession->readDelay);
 
-/******************************************************************************************************
-------------------------------------------------------------------------------------------------------*
----- Instrument Model and Instrument Options ---------------------------------------------------------*
-------------------------------------------------------------------------------------------------------*
-******************************************************************************************************/
-
-/*****************************************************************************************************/
-/*  Queries and parses the instrument *IDN? string
-    In simulation, it uses the provided simulationIDNstring as a source for parsing
-    Sets the attributes:
-    - PREFIX_ATTR_ID_QUERY_RESPONSE
-    - RS_ATTR_INSTRUMENT_MANUFACTURER
-    - RS_ATTR_INSTRUMENT_MODEL - based on the idnModelFullName true: "FSW-26", false: "FSW"
-    - RS_ATTR_INSTRUMENT_FIRMWARE_REVISION
-******************************************************************************************************/
-ViStatus RsCore_QueryAndParseIDNstring(ViSession instrSession, ViAttr idnStringAttributeId, ViString simulationIDNstring,
-                                       ViBoolean idnModelFullName, ViString customScanString)
-{
-	ViStatus error = VI_SUCCESS;
-	ViChar revision[RS_MAX_MESSAGE_LEN];
-	ViChar manufacturer[RS_MAX_MESSAGE_LEN];
-	ViChar modelFull[RS_MAX_MESSAGE_LEN];
-	ViChar model[RS_MAX_MESSAGE_LEN];
-	ViChar idnString[RS_MAX_MESSAGE_BUF_SIZE];
-
-	RsCoreInt_StrcpyMaxLen(manufacturer, RS_MAX_MESSAGE_LEN, "Rohde&Schwarz");
-	RsCoreInt_StrcpyMaxLen(modelFull, RS_MAX_MESSAGE_LEN, "DummyModel-Full");
-	RsCoreInt_StrcpyMaxLen(revision, RS_MAX_MESSAGE_LEN, "1.0.0");
-
-	// Query the *IDN?, parse it and store it into the PREFIX_ATTR_ID_QUERY_RESPONSE
-	if (!RsCore_Simulating(instrSession))
-	{
-		// Read the real *IDN? response
-		checkErr(RsCore_QueryViString(instrSession, "*IDN?", idnString));
-	}
-	else
-	{
-		// use the simulationIDNstring value
-		RsCoreInt_StrcpyMaxLen(idnString, RS_MAX_MESSAGE_LEN, simulationIDNstring);
-	}
-
-	if (customScanString != NULL && strlen(customScanString) > 0)
-	{
-		sscanf(idnString, customScanString, manufacturer, modelFull, revision);
-	}
-	else
+	len = 8;
+	i = 0;
+	moreDataAvailable = VI_TRUE;
+	while (moreDataAvailable == VI_TRUE)
 	{
-		sscanf(idnString, "%[^,],%[^,],%*[^,],%256[^\n]", manufacturer, modelFull, revision);
-	}
-
-	checkErr(RsCore_SetAttributeViString(instrSession, NULL, idnStringAttributeId, 0, idnString));
-	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_INSTRUMENT_MANUFACTURER, 0, manufacturer));
-	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_INSTRUMENT_FIRMWARE_REVISION, 0, revision));
+		checkErr(RsCoreInt_IoRead(instrSession, (ViBuf)buffer, len, &retCnt));
+		len *= 2;
+		if (len > RS_MAX_MESSAGE_BUF_SIZE)
+			len = RS_MAX_MESSAGE_BUF_SIZE;
 
-	// For model, decide between the model and modelFull - this value is used for option checking
-	RsCoreInt_StrcpyMaxLen(model, RS_MAX_MESSAGE_LEN, "");
-	sscanf(modelFull, "%[^-0-9]", model);
-	if (strlen(model) == 0)
-		idnModelFullName = VI_TRUE;
+		moreDataAvailable = (error == VI_SUCCESS_MAX_CNT);
+		if (!moreDataAvailable && retCnt == len)
+		{
+			if (buffer[len - 1] != '\n')
+				moreDataAvailable = VI_TRUE;
+		}
 
-	if (idnModelFullName)
-	{
-		checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_INSTRUMENT_MODEL, 0, modelFull));
+		i++;
+		if (totalFlush == VI_FALSE && i > 100)
+			break;
 	}
-	else
+
+	if (moreDataAvailable == VI_TRUE)
 	{
-		checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_INSTRUMENT_MODEL, 0, model));
+		snprintf(buffer, RS_MAX_MESSAGE_BUF_SIZE, "FlushJunkData: data length is too big to be completely read from the instrument.");
+		viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, buffer);
 	}
 
 Error:
@@ -5756,562 +7015,5468 @@ Error:
 }
 
 /*****************************************************************************************************/
-/*  Evaluates if the IDN string matches case insensitive the expected pattern 'requiredIdnPattern1' or 'requiredIdnPattern2'
-    Returns VI_ERROR_FAIL_ID_QUERY if neither of 'requiredIdnPattern1' or 'requiredIdnPattern2' is found in the IDN string
-    requiredIdnPattern2 can be optionally set to NULL
+/*  Parses binary data block header and returns length of the following binary data block.
+    If you provide dataPartRead buffer, in case of non-binary data
+    the function returns the null-terminated sting already read out, so you can concatenate
+    it for further reading. The dataPartRead buffer must be at least 30 bytes long
 ******************************************************************************************************/
-ViStatus RsCore_FitsIDNpattern(ViSession instrSession, ViAttr idnStringAttributeId, ViConstString requiredIdnPattern1,
-                               ViConstString requiredIdnPattern2)
+ViStatus RsCoreInt_ParseBinaryDataHeader(ViSession instrSession, ViBoolean errorIfNotBinDataBlock,
+                                         ViBoolean* isBinDataBlock, ViInt64* length, ViChar* dataPartRead)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar idnString[RS_MAX_MESSAGE_BUF_SIZE];
-	ViChar validPatternLowCase[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar header[100];
+	ViUInt32 retCnt;
+	ViBoolean binDataBlockDetected = VI_FALSE;
 	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	RsCoreSessionPtr rsSession = NULL;
 
-	checkErr(RsCore_GetAttributeViString(instrSession, NULL, idnStringAttributeId, 0, RS_MAX_MESSAGE_LEN, idnString));
-	RsCoreInt_ToLowerCase(idnString);
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	RsCoreInt_StrcpyMaxLen(validPatternLowCase, RS_MAX_MESSAGE_LEN, requiredIdnPattern1);
-	RsCoreInt_ToLowerCase(validPatternLowCase);
-	if (strstr(idnString, validPatternLowCase) != NULL)
-		goto Error;
+	// Only apply the read delay once at the beginning
+	if (rsSession->readDelay)
+		Sleep(rsSession->readDelay);
 
-	if (requiredIdnPattern2 != NULL)
+	checkErr(RsCoreInt_IoRead(instrSession, (ViBuf)header, 1, &retCnt));
+	if (header[0] == '#')
 	{
-		RsCoreInt_StrcpyMaxLen(validPatternLowCase, RS_MAX_MESSAGE_LEN, requiredIdnPattern2);
-		if (strstr(idnString, RsCoreInt_ToLowerCase(validPatternLowCase)) != NULL)
-			goto Error;
+		if (dataPartRead)
+			dataPartRead[0] = 0;
 
-		checkErr(RsCore_GetAttributeViString(instrSession, NULL, idnStringAttributeId, 0, RS_MAX_MESSAGE_LEN, idnString));
-		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "*IDN? string '%s' does not fit either of the required patterns '%s' or '%s'",
-		         idnString, requiredIdnPattern1, requiredIdnPattern2);
-		viCheckErrElab(VI_ERROR_FAIL_ID_QUERY, errElab);
+		// Binary data confirmed
+		binDataBlockDetected = VI_TRUE;
+		checkErr(RsCoreInt_IoRead(instrSession, (ViBuf)header, 1, &retCnt));
+		if (header[0] == '(')
+		{
+			// format for > 1E9 bytes: '#(1234567890123)<data>'
+			ViInt32 count;
+			checkErr(RsCore_ReadUpToCharacter(instrSession, ')', 100, (ViBuf)header, &count));
+			header[count] = 0;
+			sscanf(header,  _PERCLD, length);
+		}
+		else if (header[0] == '0')
+		{
+			*length = -1; // long response, unknown length
+		}
+		else
+		{
+			// classic format for < 1E9 bytes: '#9123456789...'
+			ViInt32 lenOfLen;
+			header[1] = '\0';
+			lenOfLen = (ViInt32)atoi(header);
+			checkErr(RsCoreInt_IoRead(instrSession, (ViBuf)header, lenOfLen, &retCnt));
+			header[retCnt] = '\0';
+			sscanf(header,  _PERCLD, length);
+		}
 	}
+	else
+	{
+		// Non-binary data
+		binDataBlockDetected = VI_FALSE;
+		*length = -2; //unrecognized binary header, treat it like an ASCII transfer
+		if (errorIfNotBinDataBlock)
+		{
+			// Read more bytes to compose an error message
+			checkErr(RsCoreInt_IoRead(instrSession, (ViBuf)(header + 1), 24, &retCnt));
+			if (dataPartRead)
+			{
+				header[25] = 0;
+				RsCoreInt_StrcpyMaxLen(dataPartRead, 25, header);
+			}
 
-	checkErr(RsCore_GetAttributeViString(instrSession, NULL, idnStringAttributeId, 0, RS_MAX_MESSAGE_LEN, idnString));
-	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "*IDN? string '%s' does not fit the required pattern '%s'", idnString, requiredIdnPattern1);
-	viCheckErrElab(VI_ERROR_FAIL_ID_QUERY, errElab);
+			RsCore_TrimString(header, RS_VAL_TRIM_WHITESPACES);
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Expected Binary data header starting with #(hash),"
+			         " received data '%s'", header);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+		else
+		{
+			// return null-terminated string of the already read data
+			RsCoreInt_StrcpyMaxLen(dataPartRead, 2, header);
+		}
+	}
+
+	if (isBinDataBlock)
+		*isBinDataBlock = binDataBlockDetected;
 
 Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  Queries and parses the instrument options *OPT?
-    In simulation, it uses the provided simulationOPTstring as a source for parsing
-    Sets the attribute RS_ATTR_OPTIONS_LIST
+/*  Sends binary data header based on the entered dataSize. The function expects that you continue
+    sending the corresponding binary data block, therefore it also sets VI_ATTR_SEND_END_EN to FALSE
+    !!!Important!!! - send the VI_ATTR_SEND_END_EN back to TRUE after sending the binary data block
 ******************************************************************************************************/
-ViStatus RsCore_QueryAndParseOPTstring(ViSession instrSession, ViString simulationOPTstring, ViInt32 optionsParseMode)
+ViStatus RsCoreInt_SendBinDataHeader(ViSession instrSession, ViConstString command, ViInt64 dataSize)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar* optionsList;
+	ViChar header[RS_MAX_MESSAGE_LEN];
+	ViInt32 lenOfLen;
+	RsCoreSessionPtr rsSession = NULL;
 
-	// Query the *OPT?, parse it and store it into the RS_ATTR_OPTIONS_LIST
-	if (!RsCore_Simulating(instrSession))
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+
+	lenOfLen = snprintf(header, RS_MAX_MESSAGE_LEN,  _PERCLD, dataSize);
+	snprintf(header, RS_MAX_MESSAGE_LEN, "%s" _PERCLD, command, dataSize);
+	if (lenOfLen < 10)
 	{
-		// Read the real *OPT? response
-		checkErr(RsCore_QueryViStringUnknownLength(instrSession, "*OPT?", &optionsList));
+		// #512345
+		snprintf(header, RS_MAX_MESSAGE_LEN, "%s#" _PERCU _PERCLD, command, lenOfLen, dataSize);
 	}
 	else
 	{
-		// Use the simulationOPTstring value
-		checkAlloc(optionsList = (ViChar *)calloc(strlen(simulationOPTstring) + 1, 1));
-		RsCoreInt_StrcpyMaxLen(optionsList, (ViInt32)strlen(simulationOPTstring) + 1, simulationOPTstring);
+		// #(3000000000)
+		snprintf(header, RS_MAX_MESSAGE_LEN, "%s#(" _PERCLD ")", command, dataSize);
 	}
 
-	checkErr(RsCoreInt_ParseOptionsString(instrSession, optionsList, optionsParseMode));
-	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_OPTIONS_LIST, 0, optionsList));
+	// send header
+	if (rsSession->writeDelay)
+		Sleep(rsSession->writeDelay);
 
-Error:
-	if (optionsList)
-		free(optionsList);
+	(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_FALSE);
+	checkErr(RsCoreInt_IoWrite(instrSession, (ViBuf)header, (ViInt32)strlen(header), NULL));
 
+Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_CheckInstrumentModel
-	Generates RS_ERROR_INSTRUMENT_MODEL error, if the current instrument does not fulfill the modelsList requirement.
-	If session's optionChecking is OFF, the function always returns VI_SUCCESS
-	- Example of a positive requirement: modelsList = 'FSW|FSWP': for VI_SUCCESS, the current instrument must be either FSW or FSWP
-	- Example of a negative requirement: modelsList = '!FSW|FSWP': for VI_SUCCESS, the current instrument must be neither FSW nor FSWP
+/*  RsCoreInt_GenerateOpcTimeoutError
+    Internal function that generates OPC timeout error if the error == VI_ERROR_TMO
 ******************************************************************************************************/
-ViStatus RsCore_CheckInstrumentModel(ViSession instrSession, ViConstString modelsList)
+ViStatus RsCoreInt_GenerateOpcTimeoutError(ViSession instrSession, ViStatus error, ViInt32 opcTimeoutMs)
 {
-	ViStatus error = VI_SUCCESS;
-	RsCoreSessionPtr rsSession = NULL;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	RsCoreSessionPtr rsSession;
+	ViUInt32 visaTimeout = 10000;
+	ViInt32 sessionOpcTimeoutMs;
+	ViInt32 len;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
-	if (rsSession->optionChecking == VI_TRUE)
+	if (error == VI_ERROR_TMO)
 	{
-		checkErr(RsCoreInt_CheckInstrumentModel(instrSession, modelsList, NULL, VI_TRUE));
-	}
+		(void)RsCore_GetRsSession(instrSession, &rsSession);
+		(void)RsCore_GetVisaTimeout(instrSession, &visaTimeout);
+		(void)RsCore_GetAttributeViInt32(instrSession, NULL, RS_ATTR_OPC_TIMEOUT, 0, &sessionOpcTimeoutMs);
 
-Error:
-	return error;
-}
+		(void)RsCoreInt_ResolveOpcTimeout(instrSession, &opcTimeoutMs);
+		if (opcTimeoutMs == sessionOpcTimeoutMs)
+		{
+			// Entered OPC timeout is equal to the session's OPC timeout
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Waiting for OPC resulted in timeout. OPC timeout is set to " _PERCD " ms. "
+			         "Change it with %s_SetTimeout / %s_SetOpcTimeout. "
+			         "Note, that the OPC Timeout is not the same as VISA Timeout.",
+			         opcTimeoutMs, rsSession->specificPrefix, rsSession->specificPrefix);
+		}
+		else
+		{
+			// Custom OPC timeout
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Waiting for OPC resulted in timeout. Entered timeout: " _PERCD " ms. "
+			         "Note, that the OPC Timeout is not the same as VISA Timeout.", opcTimeoutMs);
+		}
 
-/*****************************************************************************************************/
-/*  RsCore_IsInstrumentModel
-	Returns TRUE, if the current model fulfills the modelsList requirement.
-	The session's optionChecking status has no effect on this function
-	- Example of a positive requirement: modelsList = 'FSW|FSWP': for result TRUE, the current instrument must be either FSW or FSWP
-	- Example of a negative requirement: modelsList = '!FSW|FSWP': for result TRUE, the current instrument must be neither FSW nor FSWP
-******************************************************************************************************/
-ViBoolean RsCore_IsInstrumentModel(ViSession instrSession, ViConstString modelsList)
-{
-	ViBoolean pass;
-	
-	(void)RsCoreInt_CheckInstrumentModel(instrSession, modelsList, &pass, VI_FALSE);
+		if (rsSession->vxiCapable == VI_TRUE && rsSession->opcWaitMode != RS_VAL_OPCWAIT_OPCQUERY)
+		{
+			// Add VISA timeout value info
+			len = (ViInt32)strlen(errElab);
+			snprintf(errElab + len, RS_MAX_MESSAGE_BUF_SIZE - len, " VISA timeout current value: " _PERCD " ms.", visaTimeout);
+		}
 
-	return pass;
+		(void)RsCore_SetErrorInfo(instrSession, VI_TRUE, VI_ERROR_TMO, VI_FALSE, errElab);
+	}
+
+	return error;
 }
 
-/*****************************************************************************************************/
-/*  RsCore_CheckInstrumentOptions
-	Generates RS_ERROR_INSTRUMENT_OPTION error, if the current instrument does not have the required option(s) installed.
-	The optionsExpression is the same one as used in attributes.
-	If session's optionChecking is OFF, the function always returns VI_SUCCESS
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- INTERNAL VISA IO R/W ----------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
-ViStatus RsCore_CheckInstrumentOptions(ViSession instrSession, ViConstString optionsExpression)
+
+/******************************************************************************************************
+* Function: RsCoreInt_Read
+* Purpose:  Reads data from the instrument using the session IO (VISA viRead() or the transport)
+******************************************************************************************************/
+ViStatus RsCoreInt_Read(ViSession instrSession, ViInt32 bufferSize, ViByte* readBuffer, ViInt32* bytesRead)
 {
 	ViStatus error = VI_SUCCESS;
+	ViUInt32 retCnt = 0;
 	RsCoreSessionPtr rsSession = NULL;
 
 	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
-	if (rsSession->optionChecking == VI_TRUE)
+
+	if (RsCore_Simulating(instrSession))
 	{
-		checkErr(RsCoreInt_CheckInstrumentOptions(instrSession, optionsExpression, NULL, VI_TRUE));
+		*bytesRead = 0;
+		if (bufferSize > 0)
+			readBuffer[0] = 0;
+
+		return error;
 	}
 
+	if (rsSession->readDelay)
+		Sleep(rsSession->readDelay);
+
+	error = RsCoreInt_IoRead(instrSession, (ViBuf)readBuffer, bufferSize, &retCnt);
+
+	if (error == VI_SUCCESS_TERM_CHAR)
+		error = VI_SUCCESS;
+
+	if (error == VI_ERROR_TMO)
+		(void)RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_Read", NULL);
+
+	if (bytesRead)
+		*bytesRead = retCnt;
+
 Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_HasInstrumentOptions
-	Returns TRUE, if the current instrument has the required option(s) installed.
-	The session's optionChecking status has no effect on this function
-	The optionsExpression is the same one as used in attributes.
+/*  RsCoreInt_ReadDataKnownLength
+    Reads data of the entered length to the provided allocated buffer
+    Reading is done in chunks with maximum of rsSession->ioSegmentSize
+    This function is used to read binary data blocks
 ******************************************************************************************************/
-ViBoolean RsCore_HasInstrumentOptions(ViSession instrSession, ViConstString optionsExpression)
+ViStatus RsCoreInt_ReadDataKnownLength(ViSession instrSession, ViInt64 length, ViByte* buffer)
 {
-	ViBoolean pass;
+	ViStatus error = VI_SUCCESS;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 chunkSize;
+	ViByte* p2buffer;
+	ViUInt32 retCnt;
+	ViInt32 stb;
+	RsCoreSessionPtr rsSession = NULL;
 
-	(void)RsCoreInt_CheckInstrumentOptions(instrSession, optionsExpression, &pass, VI_FALSE);
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	return pass;
-}
+	if (RsCore_Simulating(instrSession))
+	{
+		*buffer = 0;
+		return error;
+	}
 
-/******************************************************************************************************
-------------------------------------------------------------------------------------------------------*
----- Attributes - related functions ------------------------------------------------------------------*
-------------------------------------------------------------------------------------------------------*
-******************************************************************************************************/
+	chunkSize = rsSession->ioSegmentSize;
 
-/*****************************************************************************************************/
-/*  RsCore_SetAttributeViReal64
-    Exported type-safe function for setting an attribute ViReal64 value
-******************************************************************************************************/
-ViStatus RsCore_SetAttributeViReal64(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViReal64 value)
-{
-	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_REAL64, &value);
-}
+	// If data size is 0
+	if (length == 0)
+	{
+		// Just flushing of the data
+		if (rsSession->vxiCapable)
+		{
+			checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
+			if ((stb & IEEE_488_2_STB_MAV_MASK) > 0)
+			{
+				checkErr(RsCoreInt_FlushData(instrSession, VI_FALSE));
+			}
+		}
+		else
+		{
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
+			checkErr(RsCoreInt_FlushData(instrSession, VI_FALSE));
+		}
+	}
+	else if (length < chunkSize)
+	{
+		// All data can be read in one segment
+		checkErr(RsCoreInt_IoRead(instrSession, (ViPBuf)buffer, (ViUInt32)length, &retCnt));
+		if (length != retCnt)
+		{
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Unexpected number of bytes read. Expected " _PERCLD " bytes, read " _PERCU " bytes", length, retCnt);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+	}
+	else
+	{
+		// Segmented reading loop
+		ViInt64 remaining = length;
+		p2buffer = buffer;
+		do
+		{
+			if (remaining > chunkSize)
+			{
+				checkErr(RsCoreInt_IoRead(instrSession, (ViPBuf)p2buffer, chunkSize, &retCnt));
+				remaining -= retCnt;
+				p2buffer += retCnt;
+			}
+			else
+			{
+				checkErr(RsCoreInt_IoRead(instrSession, (ViPBuf)p2buffer, (ViUInt32)remaining, &retCnt));
+				remaining -= retCnt;
+				break;
+			}
+		} while (1);
+		if (remaining != 0)
+		{
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Unexpected number of bytes read. Expected " _PERCLD " bytes, read " _PERCLD " bytes", length, length - remaining);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+	}
 
-/*****************************************************************************************************/
-/*  RsCore_SetAttributeViInt32
-    Exported type-safe function for setting an attribute ViInt32 value
-******************************************************************************************************/
-ViStatus RsCore_SetAttributeViInt32(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViInt32 value)
-{
-	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_INT32, &value);
-}
+	if (error == VI_SUCCESS_MAX_CNT) // Flush remaining data
+	{
+		error = VI_SUCCESS;
+		if (!rsSession->vxiCapable)
+		{
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
+		}
 
-/*****************************************************************************************************/
-/*  RsCore_SetAttributeViInt64
-    Exported type-safe function for setting an attribute ViInt64 value
-******************************************************************************************************/
-ViStatus RsCore_SetAttributeViInt64(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViInt64 value)
-{
-	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_INT64, &value);
-}
+		checkErr(RsCoreInt_FlushData(instrSession, VI_TRUE));
+	}
 
-/*****************************************************************************************************/
-/*  RsCore_SetAttributeViString
-    Exported type-safe function for setting an attribute ViString value
-******************************************************************************************************/
-#pragma warning( disable : 4090 )
-ViStatus RsCore_SetAttributeViString(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViConstString value)
-{
-	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_STRING, (void*)value);
-}
-#pragma warning( default : 4090 )
+Error:
+	if (error == VI_SUCCESS_TERM_CHAR)
+		error = VI_SUCCESS;
 
-/*****************************************************************************************************/
-/*  RsCore_SetAttributeViBoolean
-    Exported type-safe function for setting an attribute ViBoolean value
-******************************************************************************************************/
-ViStatus RsCore_SetAttributeViBoolean(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViBoolean value)
-{
-	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_BOOLEAN, &value);
-}
+	if (error == VI_ERROR_TMO)
+		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_ReadDataKnownLength", NULL);
 
-/*****************************************************************************************************/
-/*  RsCore_SetAttributeViSession
-    Exported type-safe function for setting an attribute ViSession value
-******************************************************************************************************/
-ViStatus RsCore_SetAttributeViSession(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViSession value)
-{
-	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_SESSION, &value);
+	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_SetAttributeViAddress
-    Exported type-safe function for setting an attribute ViAddr value
+/*  RsCoreInt_ReadDataUnknownLength
+    Reads data from the instrument and returns the allocated buffer with the read data
+    The outputBuffer is always at least +1 byte bigger than the returned byteCount, and the empty place is padded with nulls.
+    Therefore, you can treat the buffer as a null-terminated string.
+    WARNING!!! - Deallocate the outputBuffer after use.
+    Note! Do not use for reading binary data, for that purpose use the RsCore_ReadBinaryDataBlock... functions
 ******************************************************************************************************/
-ViStatus RsCore_SetAttributeViAddress(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViAddr value)
+ViStatus RsCoreInt_ReadDataUnknownLength(ViSession instrSession, ViByte** outputBuffer, ViInt64* byteCount)
 {
-	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_ADDR, &value);
-}
+	ViStatus error = VI_SUCCESS;
+	ViUInt32 retCnt = 0;
+	ViUInt32 chunkSize;
+	ViByte *buffer = NULL, *p2buffer;
+	ViInt64 actualSize;
+	ViBoolean moreDataAvailable;
+	RsCoreSessionPtr rsSession = NULL;
 
-/*****************************************************************************************************/
-/*  RsCore_GetAttributeViReal64
-    Exported type-safe function for reading an attribute ViReal64 value
-******************************************************************************************************/
-ViStatus RsCore_GetAttributeViReal64(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViReal64* value)
-{
-	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_REAL64, (ViInt32)sizeof(ViReal64), value);
-}
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-/*****************************************************************************************************/
-/*  RsCore_GetAttributeViInt32
-    Exported type-safe function for reading an attribute ViInt32 value
-******************************************************************************************************/
-ViStatus RsCore_GetAttributeViInt32(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViInt32* value)
-{
-	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_INT32, (ViInt32)sizeof(ViInt32), value);
-}
+	if (RsCore_Simulating(instrSession))
+	{
+		*byteCount = 0;
+		viCheckAllocElab(buffer = (ViByte *)RsCore_Calloc(instrSession, (size_t)(*byteCount + 1), sizeof(ViByte)),
+			"RsCore_ReadViStringUnknownLength simulation buffer allocation");
+		buffer[0] = '\0';
+		*outputBuffer = buffer;
+		return error;
+	}
 
-/*****************************************************************************************************/
-/*  RsCore_GetAttributeViInt64
-    Exported type-safe function for reading an attribute ViInt64 value
-******************************************************************************************************/
-ViStatus RsCore_GetAttributeViInt64(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViInt64* value)
-{
-	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_INT64, (ViInt32)sizeof(ViInt32), value);
-}
+	*outputBuffer = NULL;
+
+	if (byteCount)
+		*byteCount = 0;
+
+	// Start reading with a small chunk (1024 bytes), then increase it up to rsSession->ioSegmentSize
+    chunkSize = rsSession->ioSegmentSize < 1024 ? rsSession->ioSegmentSize < 1024 : 1024;
+    chunkSize = chunkSize < RS_MAX_MESSAGE_BUF_SIZE ? chunkSize : RS_MAX_MESSAGE_BUF_SIZE;
+
+	// Allocate Buffer
+	viCheckAllocElab(buffer = (ViByte *)RsCore_Calloc(instrSession, chunkSize, sizeof(ViByte)), "RsCore_ReadViStringUnknownLength buffer allocation");
+
+	// Only apply the read delay once at the beginning
+	if (rsSession->readDelay)
+		Sleep(rsSession->readDelay);
+
+	actualSize = 0;
+	p2buffer = buffer;
+	do
+	{
+		moreDataAvailable = VI_FALSE;
+		checkErr(RsCoreInt_IoRead(instrSession, (ViPBuf)p2buffer, chunkSize, &retCnt));
+		actualSize += retCnt;
+		if (error == VI_SUCCESS_MAX_CNT)
+		{
+			// VISA reports more data is available, read further
+			moreDataAvailable = VI_TRUE;
+		}
+		else
+		{
+			// VISA reports no more data available. To be sure, check the returned count
+			if (retCnt == (ViUInt32)chunkSize)
+			{
+				// Check the last read character. If it is not LF, more data is available
+				if (p2buffer[retCnt - 1] != '\n')
+					moreDataAvailable = VI_TRUE;
+			}
+		}
+
+		if (!moreDataAvailable)
+			break; // stop the reading, the data was all read
+
+		// Increase the chunk size gradually
+		chunkSize *= 4;
+		if (chunkSize > (ViUInt32)rsSession->ioSegmentSize)
+            chunkSize = rsSession->ioSegmentSize;
+
+		// Reallocate the buffer, the old content stays untouched. + 1 byte to have space for a null-terminator
+		viCheckAllocElab(buffer = (ViByte *)RsCore_Realloc(instrSession, buffer, (size_t)(actualSize + chunkSize + 1)),
+			"RsCore_ReadViStringUnknownLength buffer re-allocation");
+		p2buffer = buffer + actualSize; /* Set pointer to end of data in reallocated buffer */
+		memset(p2buffer, 0, chunkSize + 1); // fill the added part with nulls
+	} while (1);
+
+	*outputBuffer = buffer;
+	if (byteCount != NULL)
+		*byteCount = actualSize;
+
+Error:
+	if (error < 0)
+	{
+		if (buffer)
+			RsCore_Free(instrSession, buffer);
+
+		*outputBuffer = NULL;
+	}
+
+	if (error == VI_SUCCESS_TERM_CHAR)
+		error = VI_SUCCESS;
+
+	if (error == VI_ERROR_TMO)
+		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCore_ReadViStringUnknownLength", NULL);
+
+	return error;
+}
 
 /*****************************************************************************************************/
-/*  RsCore_GetAttributeViInt64
-    Exported type-safe function for reading an attribute ViInt64 value
+/*  Reads data of the entered length into the provided file
+    Reading is done in chunks with maximum of rsSession->ioSegmentSize
+    If you do not need the return value bytesWritten, set it to NULL
+    This function is used to read binary data blocks
 ******************************************************************************************************/
-ViStatus RsCore_GetAttributeViString(ViSession instrSession, ViString repCap,
-                                     ViUInt32 attributeId, ViInt32 optionFlag, ViInt32 bufferSize, ViChar* value)
+ViStatus RsCoreInt_ReadDataKnownLengthToFile(ViSession instrSession, ViInt64 length, FILE* file, ViInt64* bytesWritten)
 {
-	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_STRING, bufferSize, value);
+	ViStatus error = VI_SUCCESS;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 chunkSize;
+	ViChar* buffer = NULL;
+	ViUInt32 retCnt;
+	ViInt64 written;
+	ViInt32 stb;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (RsCore_Simulating(instrSession))
+	{
+		if (bytesWritten)
+			*bytesWritten = length;
+
+		return error;
+	}
+
+	chunkSize = rsSession->ioSegmentSize;
+
+	// If data size is 0
+	if (length == 0)
+	{
+		// Just flushing of the data
+		if (rsSession->vxiCapable)
+		{
+			checkErr(RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE));
+			if ((stb & IEEE_488_2_STB_MAV_MASK) > 0)
+			{
+				checkErr(RsCoreInt_FlushData(instrSession, VI_FALSE));
+			}
+		}
+		else
+		{
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
+			checkErr(RsCoreInt_FlushData(instrSession, VI_FALSE));
+		}
+	}
+	else if (length < chunkSize)
+	{
+		// All data can be read in one segment
+		viCheckAllocElab(buffer = (ViChar *)RsCore_Malloc(instrSession, (ViInt32)length), "ReadDataKnownLengthToFile: Allocation of a buffer for reading to file");
+		checkErr(RsCoreInt_IoRead(instrSession, (ViPBuf)buffer, (ViUInt32)length, &retCnt));
+
+		if (length != retCnt)
+		{
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Unexpected number of bytes read. Expected " _PERCLD " bytes, read " _PERCU " bytes", length, retCnt);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+
+		written = (ViInt32)fwrite(buffer, sizeof(ViByte), (size_t)retCnt, file);
+		if (length != written)
+		{
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Unexpected number of bytes written to file. Expected " _PERCLD " bytes, written " _PERCLD " bytes", length, written);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+
+		if (bytesWritten)
+			*bytesWritten = length;
+	}
+	else
+	{
+		// Segmented reading loop
+		viCheckAllocElab(buffer = (ViChar *)RsCore_Malloc(instrSession, chunkSize), "ReadDataKnownLengthToFile: Allocation of a chunk-size buffer for reading to file");
+		ViInt64 remaining = length;
+		do
+		{
+			if (remaining > chunkSize)
+			{
+				checkErr(RsCoreInt_IoRead(instrSession, (ViPBuf)buffer, chunkSize, &retCnt));
+				written = (ViInt32)fwrite(buffer, sizeof(ViByte), (size_t)retCnt, file);
+				remaining -= written;
+			}
+			else
+			{
+				checkErr(RsCoreInt_IoRead(instrSession, (ViPBuf)buffer, (ViUInt32)remaining, &retCnt));
+				written = (ViInt32)fwrite(buffer, sizeof(ViByte), (size_t)retCnt, file);
+				remaining -= written;
+				break;
+			}
+		} while (1);
+
+		if (bytesWritten)
+			*bytesWritten = length - remaining;
+
+		if (remaining != 0)
+		{
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Unexpected number of bytes written to file. Expected " _PERCLD " bytes, written " _PERCLD " bytes", length, length - remaining);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+	}
+
+	if (error == VI_SUCCESS_MAX_CNT) // flush remaining data
+	{
+		error = VI_SUCCESS;
+		if (!rsSession->vxiCapable)
+		{
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
+		}
+		checkErr(RsCoreInt_FlushData(instrSession, VI_FALSE));
+	}
+
+Error:
+	if (buffer != NULL)
+		RsCore_Free(instrSession, buffer);
+
+	if (error == VI_SUCCESS_TERM_CHAR)
+		error = VI_SUCCESS;
+
+	if (error == VI_ERROR_TMO)
+		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_ReadDataKnownLengthToFile", NULL);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_ReadBinaryDataBlock
+    Reads binary data of unknown size from the instrument.
+    If errorIfNotBinDataBlock == TRUE, the function generates error in case the
+    data is not binary block (not starting with '#')
+    If errorIfNotBinDataBlock == FALSE, the function returns read data and indicates isBinDataBlock = FALSE.
+    If you do not need the isBinDataBlock info, set the pointer to NULL
+    WARNING!!! Deallocate the outputBuffer after use
+******************************************************************************************************/
+ViStatus RsCoreInt_ReadBinaryDataBlock(ViSession instrSession,
+                                       ViBoolean errorIfNotBinDataBlock, ViBoolean* isBinDataBlock,
+                                       ViByte** outputBuffer, ViInt64* byteCount)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt64 length = 0;
+	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar *stringBuffer = NULL, *completeStringBuffer = NULL;
+	ViBoolean binDataBlockDetected = VI_FALSE;
+	RsCoreSessionPtr rsSession = NULL;
+	
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	*outputBuffer = NULL;
+	*byteCount = 0;
+	checkErr(RsCoreInt_ParseBinaryDataHeader(instrSession, errorIfNotBinDataBlock, &binDataBlockDetected, &length, buffer));
+	if (length > 2147483646)
+	{
+		snprintf(buffer, RS_MAX_MESSAGE_BUF_SIZE,
+		         "ReadBinaryDataBlock: parsed length " _PERCLD " is bigger than maximum supported length of Int32 Max 2147483646 bytes", length);
+		viCheckErrElab(RS_ERROR_DATA_TOO_LONG, buffer);
+	}
+
+	if (binDataBlockDetected == VI_FALSE)
+	{
+		// Unrecognized binary header, treat it like an ASCII transfer
+		checkErr(RsCore_ReadViStringUnknownLength(instrSession, &stringBuffer));
+		checkErr(RsCore_StrCatDynamicString(instrSession, &completeStringBuffer, buffer, stringBuffer, NULL));
+		*outputBuffer = (ViByte*)completeStringBuffer;
+		*byteCount = (ViInt64)strlen(completeStringBuffer);
+		goto Error;
+	}
+
+	if (rsSession->vxiCapable != VI_TRUE)
+	{
+		// Confirmed binary transfer, switch the read termination character OFF
+		checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_FALSE));
+	}
+
+	if (length == 0) // Indicated null data size, read and discard all that is available
+	{
+		viCheckAllocElab(*outputBuffer = (ViByte*)RsCore_Malloc(instrSession, 1), "ReadBinaryDataBlock: Allocation of buffer for empty binary data.");
+		*byteCount = 1;
+		checkErr(RsCoreInt_ReadDataKnownLength(instrSession, 1, *outputBuffer));
+	}
+	else if (length > 0) // Binary known length
+	{
+		viCheckAllocElab(*outputBuffer = (ViByte*)RsCore_Malloc(instrSession, (size_t)(length + 1)), "ReadBinaryDataBlock: Allocation of buffer for binary data of known size.");
+		checkErr(RsCoreInt_ReadDataKnownLength(instrSession, length, *outputBuffer));
+		*byteCount = length;
+	}
+	else if (length == -1) // Long data of unknown size, treat it like data unknown size
+	{
+		if (rsSession->vxiCapable == VI_FALSE)
+		{
+			viCheckErrElab(RS_ERROR_SESSION_TYPE_NOT_SUPPORTED,
+				"ReadBinaryDataBlock: Binary data block with unknown length is not supported on non-VXI11 interfaces");
+		}
+
+		checkErr(RsCoreInt_ReadDataUnknownLength(instrSession, outputBuffer, byteCount));
+	}
+
+Error:
+	if (stringBuffer)
+		RsCore_Free(instrSession, stringBuffer);
+
+	if (isBinDataBlock)
+		*isBinDataBlock = binDataBlockDetected;
+
+	if (rsSession->vxiCapable != VI_TRUE)
+	{
+		RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE);
+	}
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*---------------------------------------------------------------------------------------------------*/
+/*---- INTERNAL VISA IO R/W with OPC sync -----------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------*/
+/*****************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  RsCoreInt_BuildOpcCommand
+    Composes the command with the appended ';*OPC' to send for the OPC-synchronized write.
+    The buffer must have RS_MAX_MESSAGE_BUF_SIZE bytes. Longer commands are composed in a dynamically allocated buffer
+    returned in dynBuffer, the caller deallocates it with RsCore_Free. The sendBuffer points to the composed command
+******************************************************************************************************/
+ViStatus RsCoreInt_BuildOpcCommand(ViSession instrSession, ViConstString command, ViChar* buffer, ViChar** dynBuffer,
+                                   ViChar** sendBuffer)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 cmdLen, bufferSize;
+	RsCoreSessionPtr rsSession = NULL;
+
+	*dynBuffer = NULL;
+	*sendBuffer = buffer;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	// We need a longer buffer to append '*OPC'
+	cmdLen = (ViInt32)strlen(command);
+	bufferSize = cmdLen + 10;
+	if (bufferSize > RS_MAX_MESSAGE_BUF_SIZE)
+	{
+		// Command is too long, we need to allocate the buffer dynamically
+		viCheckAllocElab(*dynBuffer = (ViChar *)RsCore_Malloc(instrSession, bufferSize), "RsCoreInt_BuildOpcCommand: Allocation of a dynamic buffer for long command");
+		*sendBuffer = *dynBuffer;
+	}
+	else
+	{
+		bufferSize = RS_MAX_MESSAGE_BUF_SIZE;
+	}
+
+	RsCoreInt_StrcpyMaxLen(*sendBuffer, bufferSize, command);
+	if (cmdLen > 0 && command[cmdLen - 1] == '\n')
+	{
+		RsCore_TrimString(*sendBuffer, RS_VAL_TRIM_WHITESPACES);
+	}
+
+	if (rsSession->assureWriteWithLF == VI_TRUE)
+		RsCore_StrcatMaxLen(*sendBuffer, bufferSize, ";*OPC\n", NULL, NULL);
+	else
+		RsCore_StrcatMaxLen(*sendBuffer, bufferSize, ";*OPC", NULL, NULL);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_WriteWithOpc
+    Internal function to write a command with OPC. The command length is unlimited
+    Set the parameter 'timeoutMs' to 0 in order to use the current session's OPC timeout.
+    You can not use this function to send a query for non-VXI11 sessions or WaitOpcMode=OpcQuery
+******************************************************************************************************/
+ViStatus RsCoreInt_WriteWithOpc(ViSession instrSession, ViConstString command,
+                                ViBoolean allowCheckStatus, ViInt32 opcTimeoutMs)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE] = "";
+	ViChar* dynBuffer = NULL;
+	ViChar* p2SendBuffer;
+	RsCoreOpcAttrCallback p2opcFunction;
+	void* value;
+	ViUInt32 oldVisaTimeoutMs = 0;
+	ViBoolean clearEsr = VI_TRUE;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (command == NULL)
+	{
+		viCheckErrElab(RS_ERROR_INVALID_VALUE, "RsCoreInt_WriteWithOpc: input parameter command is NULL");
+	}
+
+	if (strlen(command) == 0)
+	{
+		viCheckErrElab(RS_ERROR_INVALID_VALUE, "RsCoreInt_WriteWithOpc: input parameter command string is empty");
+	}
+
+	checkErr(RsCoreInt_ResolveOpcTimeout(instrSession, &opcTimeoutMs));
+
+	if (rsSession->opcWaitMode != RS_VAL_OPCWAIT_OPCQUERY)
+	{
+		// For commands (not queries), all OPC modes except the OPCquery can use the same procedure
+		checkErr(RsCoreInt_BuildOpcCommand(instrSession, command, buffer, &dynBuffer, &p2SendBuffer));
+		checkErr(RsCoreInt_ClearBeforeRead(instrSession));
+
+		// For Service request, clear and allow the SRQ event
+		if (rsSession->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST)
+		{
+			checkErr(viDiscardEvents(instrSession, VI_EVENT_SERVICE_REQ, VI_QUEUE | VI_SUSPEND_HNDLR));
+			checkErr(viEnableEvent(instrSession, VI_EVENT_SERVICE_REQ, VI_QUEUE, VI_NULL));
+		}
+
+		checkErr(RsCore_Write(instrSession, p2SendBuffer));
+		checkErr(RsCoreInt_GetAttrP2Value(rsSession->attrOpcCallbackPtr, &value, 0));
+		RsCoreInt_LatencyOpcWaitBegin(rsSession);
+		if (value == NULL)
+		{
+			error = RsCore_WaitForOpcCallback(instrSession, opcTimeoutMs);
+		}
+		else
+		{
+			p2opcFunction = (RsCoreOpcAttrCallback)(ViAddr *)value;
+			error = p2opcFunction(instrSession, opcTimeoutMs);
+		}
+
+		RsCoreInt_LatencyOpcWaitEnd(rsSession);
+		checkStatusOnErr(error);
+	}
+	else
+	{
+		// OPC query mode
+		clearEsr = VI_FALSE;
+		checkErr(RsCoreInt_ClearBeforeRead(instrSession));
+		checkErr(RsCore_Write(instrSession, command));
+		checkErr(RsCore_GetVisaTimeout(instrSession, &oldVisaTimeoutMs));
+		checkErr(RsCore_SetVisaTimeout(instrSession, opcTimeoutMs));
+
+		RsCoreInt_LatencyOpcWaitBegin(rsSession);
+		error = RsCore_QueryViStringShort(instrSession, "*OPC?", NULL);
+		RsCoreInt_LatencyOpcWaitEnd(rsSession);
+		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+
+		checkErr(RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs));
+		oldVisaTimeoutMs = 0;
+	}
+
+CheckStatus:
+	// Check Status if allowed
+	if (allowCheckStatus == VI_FALSE)
+		goto Error;
+
+	if (RsCore_QueryInstrStatus(instrSession) == VI_TRUE)
+	{
+		checkErr(RsCoreInt_CheckStatusAfterOpcSync(instrSession, error));
+	}
+
+	if (clearEsr)
+	{
+		if (error == VI_ERROR_TMO)
+		{
+			(void)RsCoreInt_QueryClearEsr(instrSession);
+		}
+		else
+		{
+			checkErr(RsCoreInt_QueryClearEsr(instrSession));
+		}
+	}
+
+Error:
+	if (dynBuffer)
+		RsCore_Free(instrSession, dynBuffer);
+
+	if (oldVisaTimeoutMs > 0)
+	{
+		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
+	}
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_QueryViStringWithOpc
+    Queries instrument for a string response with OPC. The response length is limited by the bufferSize
+    The response is trimmed for LF and terminated with '\0'
+    Set the parameter 'timeoutMs' to 0 in order to use the current session's OPC timeout.
+******************************************************************************************************/
+ViStatus RsCoreInt_QueryViStringWithOpc(ViSession instrSession, ViConstString query, ViBoolean allowCheckStatus,
+                                        ViInt32 opcTimeoutMs, ViInt32 bufferSize, ViChar* responseString)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 returnedCount;
+	ViUInt32 oldVisaTimeoutMs = 0;
+	ViBoolean clearEsr = VI_TRUE;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	checkErr(RsCoreInt_ResolveOpcTimeout(instrSession, &opcTimeoutMs));
+
+	if (rsSession->vxiCapable && rsSession->opcWaitMode != RS_VAL_OPCWAIT_OPCQUERY)
+	{
+		// For VXI-capable session, use the viReadSTB poll or SRQ wait and then read the response
+		checkStatusOnErr(RsCoreInt_WriteWithOpc(instrSession, query, VI_FALSE, opcTimeoutMs));
+		checkStatusOnErr(RsCoreInt_Read(instrSession, bufferSize, (ViByte*)responseString, &returnedCount));
+	}
+	else
+	{
+		// For Non-VXI-capable sessions or OpcWaitMode OpcQuery we use standard query with VISA timeout = OPC timeout
+		clearEsr = VI_FALSE;
+		checkErr(RsCoreInt_ClearBeforeRead(instrSession));
+		checkErr(RsCore_Write(instrSession, query));
+		checkErr(RsCore_GetVisaTimeout(instrSession, &oldVisaTimeoutMs));
+		checkErr(RsCore_SetVisaTimeout(instrSession, opcTimeoutMs));
+
+		error = RsCoreInt_Read(instrSession, bufferSize, (ViByte*)responseString, &returnedCount);
+		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+
+		RsCoreInt_LatencyOpcWaitBegin(rsSession);
+		error = RsCore_QueryViStringShort(instrSession, "*OPC?", NULL);
+		RsCoreInt_LatencyOpcWaitEnd(rsSession);
+		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+
+		checkErr(RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs));
+		oldVisaTimeoutMs = 0;
+	}
+
+	responseString[returnedCount - 1] = 0;
+	RsCore_TrimString(responseString, RS_VAL_TRIM_WHITESPACES);
+
+CheckStatus:
+	// Check Status if allowed
+	if (allowCheckStatus == VI_FALSE)
+		goto Error;
+
+	if (RsCore_QueryInstrStatus(instrSession) == VI_TRUE)
+	{
+		checkErr(RsCoreInt_CheckStatusAfterOpcSync(instrSession, error));
+	}
+
+	if (clearEsr)
+	{
+		if (error == VI_ERROR_TMO)
+		{
+			(void)RsCoreInt_QueryClearEsr(instrSession);
+		}
+		else
+		{
+			checkErr(RsCoreInt_QueryClearEsr(instrSession));
+		}
+	}
+
+Error:
+	if (oldVisaTimeoutMs > 0)
+	{
+		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
+	}
+
+	if (error < 0)
+		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_QueryViStringWithOpc", query);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_QueryUnknownLengthWithOpc
+    Query instrument with OPC sync for a general response. The response length is unlimited.
+    Returned allocated 'response' buffer is always at least 1 byte bigger than 'byteCount',
+    and the response can be treated as properly null-terminated string.
+    However, the end is not trimmed for LF. For reading the response, the function uses RsCore_ReadUnknownLength.
+    Set the parameter 'timeoutMs' to 0 in order to use the current session's OPC timeout.
+    If you do not need the returned 'byteCount', set it to NULL.
+    If 'allowCheckStatus' is FALSE, CheckStatus call and ESR clear are skipped.
+    Important!!! - Free the response buffer after use !!!
+******************************************************************************************************/
+ViStatus RsCoreInt_QueryUnknownLengthWithOpc(ViSession instrSession, ViConstString query, ViBoolean allowCheckStatus,
+                                             ViInt32 opcTimeoutMs, ViByte** response, ViInt64* byteCount)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt64 returnedCount;
+	ViUInt32 oldVisaTimeoutMs = 0;
+	ViBoolean clearEsr = VI_TRUE;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	checkErr(RsCoreInt_ResolveOpcTimeout(instrSession, &opcTimeoutMs));
+
+	if (RsCore_Simulating(instrSession))
+	{
+		if (byteCount)
+			*byteCount = 1;
+
+		*response = (ViByte*)RsCore_Malloc(instrSession, 1);
+		return error;
+	}
+
+	if (rsSession->vxiCapable && rsSession->opcWaitMode != RS_VAL_OPCWAIT_OPCQUERY)
+	{
+		// For VXI-capable session, use the viReadSTB poll or SRQ wait and then read the response
+		checkStatusOnErr(RsCoreInt_WriteWithOpc(instrSession, query, VI_FALSE, opcTimeoutMs));
+		checkStatusOnErr(RsCoreInt_ReadDataUnknownLength(instrSession, response, &returnedCount));
+	}
+	else
+	{
+		// For Non-VXI-capable sessions or OpcWaitMode OpcQuery we use standard query with VISA timeout = OPC timeout
+		clearEsr = VI_FALSE;
+		checkErr(RsCoreInt_ClearBeforeRead(instrSession));
+		checkErr(RsCore_Write(instrSession, query));
+		checkErr(RsCore_GetVisaTimeout(instrSession, &oldVisaTimeoutMs));
+		checkErr(RsCore_SetVisaTimeout(instrSession, opcTimeoutMs));
+
+		error = RsCoreInt_ReadDataUnknownLength(instrSession, response, &returnedCount);
+		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+
+		RsCoreInt_LatencyOpcWaitBegin(rsSession);
+		error = RsCore_QueryViStringShort(instrSession, "*OPC?", NULL);
+		RsCoreInt_LatencyOpcWaitEnd(rsSession);
+		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+
+		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
+		oldVisaTimeoutMs = 0;
+	}
+
+	// Read the response unknown length
+
+	if (byteCount)
+		*byteCount = returnedCount;
+
+CheckStatus:
+	// Check Status if allowed
+	if (allowCheckStatus == VI_FALSE)
+		goto Error;
+
+	if (RsCore_QueryInstrStatus(instrSession) == VI_TRUE)
+	{
+		checkErr(RsCoreInt_CheckStatusAfterOpcSync(instrSession, error));
+	}
+
+	if (clearEsr)
+	{
+		if (error == VI_ERROR_TMO)
+		{
+			(void)RsCoreInt_QueryClearEsr(instrSession);
+		}
+		else
+		{
+			checkErr(RsCoreInt_QueryClearEsr(instrSession));
+		}
+	}
+
+Error:
+	if (oldVisaTimeoutMs > 0)
+	{
+		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
+	}
+
+	if (error < 0)
+		(void)RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_QueryUnknownLengthWithOpc", query);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_QueryBinaryDataBlockWithOpc
+    Queries binary data of unknown size from the instrument.
+    If errorIfNotBinDataBlock == TRUE, the function generates error in case the data is not a binary block (not starting with '#')
+    If errorIfNotBinDataBlock == FALSE, the function returns read data and indicates isBinDataBlock = FALSE.
+    If you do not need the isBinDataBlock info, set the pointer to NULL
+    Set the parameter 'timeoutMs' to 0 in order to use the current session's OPC timeout.
+    WARNING!!! - Free the outBinDataBlock after use
+******************************************************************************************************/
+ViStatus RsCoreInt_QueryBinaryDataBlockWithOpc(ViSession instrSession, ViConstString query,
+                                               ViBoolean errorIfNotBinDataBlock, ViBoolean* isBinDataBlock,
+                                               ViBoolean allowCheckStatus,
+                                               ViInt32 opcTimeoutMs, ViByte** outBinDataBlock, ViInt64* blockSize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt64 returnedCount = 0;
+	ViUInt32 oldVisaTimeoutMs = 0;
+	ViBoolean clearEsr = VI_TRUE;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	checkErr(RsCoreInt_ResolveOpcTimeout(instrSession, &opcTimeoutMs));
+
+	if (RsCore_Simulating(instrSession))
+	{
+		returnedCount = 1;
+		*outBinDataBlock = (ViByte*)RsCore_Malloc(instrSession, 1);
+		goto Error;
+	}
+
+	if (rsSession->vxiCapable && rsSession->opcWaitMode != RS_VAL_OPCWAIT_OPCQUERY)
+	{
+		// For VXI-capable session, use the viReadSTB poll or SRQ wait and then read the response
+		checkStatusOnErr(RsCoreInt_WriteWithOpc(instrSession, query, VI_FALSE, opcTimeoutMs));
+		checkStatusOnErr(RsCoreInt_ReadBinaryDataBlock(instrSession, errorIfNotBinDataBlock, isBinDataBlock, outBinDataBlock, &returnedCount));
+	}
+	else
+	{
+		// For Non-VXI-capable sessions or OpcWaitMode OpcQuery we use standard query with VISA timeout = OPC timeout
+		clearEsr = VI_FALSE;
+		checkErr(RsCoreInt_ClearBeforeRead(instrSession));
+		checkErr(RsCore_Write(instrSession, query));
+		checkErr(RsCore_GetVisaTimeout(instrSession, &oldVisaTimeoutMs));
+		checkErr(RsCore_SetVisaTimeout(instrSession, opcTimeoutMs));
+
+		error = RsCoreInt_ReadBinaryDataBlock(instrSession, errorIfNotBinDataBlock, isBinDataBlock, outBinDataBlock, &returnedCount);
+		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+
+		RsCoreInt_LatencyOpcWaitBegin(rsSession);
+		error = RsCore_QueryViStringShort(instrSession, "*OPC?", NULL);
+		RsCoreInt_LatencyOpcWaitEnd(rsSession);
+		checkStatusOnErr(RsCoreInt_GenerateOpcTimeoutError(instrSession, error, opcTimeoutMs));
+
+		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
+		oldVisaTimeoutMs = 0;
+	}
+
+CheckStatus:
+	// Check Status if allowed
+	if (allowCheckStatus == VI_FALSE)
+		goto Error;
+
+	if (RsCore_QueryInstrStatus(instrSession) == VI_TRUE)
+	{
+		checkErr(RsCoreInt_CheckStatusAfterOpcSync(instrSession, error));
+	}
+
+	if (clearEsr)
+	{
+		if (error == VI_ERROR_TMO)
+		{
+			(void)RsCoreInt_QueryClearEsr(instrSession);
+		}
+		else
+		{
+			checkErr(RsCoreInt_QueryClearEsr(instrSession));
+		}
+	}
+
+Error:
+	if (blockSize)
+		*blockSize = returnedCount;
+
+	if (oldVisaTimeoutMs > 0)
+	{
+		(void)RsCore_SetVisaTimeout(instrSession, oldVisaTimeoutMs);
+	}
+
+	if (error < 0)
+		(void)RsCoreInt_SpecifyVisaError(instrSession, error, "RsCoreInt_QueryUnknownLengthWithOpc", query);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_CompleteOpcHandle
+    Finishes the asynchronous OPC operation started with RsCore_WriteWithOpcAsync.
+    Performs the same steps as the RsCoreInt_WriteWithOpc after the OPC wait:
+    OPC timeout error elaboration, CheckStatus if allowed, and the ESR clearing.
+    The resulting status is stored in the handle and also returned.
+******************************************************************************************************/
+ViStatus RsCoreInt_CompleteOpcHandle(RsCoreOpcHandlePtr handle, ViStatus opcStatus)
+{
+	ViStatus error = opcStatus;
+	ViSession instrSession = handle->instrSession;
+
+	handle->pending = VI_FALSE;
+
+	if (handle->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST)
+	{
+		(void)viDisableEvent(instrSession, VI_EVENT_SERVICE_REQ, VI_QUEUE); // No error handling
+	}
+
+	if (error != VI_SUCCESS && error != VI_ERROR_TMO && error != RS_ERROR_INSTRUMENT_STATUS)
+	{
+		// IO error during the polling, the instrument status can not be checked
+		goto Error;
+	}
+
+	error = RsCoreInt_GenerateOpcTimeoutError(instrSession, error, handle->opcTimeoutMs);
+
+	if (RsCore_QueryInstrStatus(instrSession) == VI_TRUE)
+	{
+		checkErr(RsCoreInt_CheckStatusAfterOpcSync(instrSession, error));
+	}
+
+	if (error == VI_ERROR_TMO)
+	{
+		(void)RsCoreInt_QueryClearEsr(instrSession);
+	}
+	else
+	{
+		checkErr(RsCoreInt_QueryClearEsr(instrSession));
+	}
+
+Error:
+	handle->status = error;
+
+	return error;
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- EXPORTED FUNCTIONS ------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Session - related functions ---------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  RsCore_NewSpecificDriver
+    Initiates/reuses VISA IO session, + adds the session structure to the global sessions list.
+    This is the first function that the instrument driver calls.
+******************************************************************************************************/
+ViStatus RsCore_NewSpecificDriver(
+	ViRsrc resourceName,
+	ViConstString specificPrefix,
+	ViConstString optionsString,
+	RsCoreAttributePtr* attrList,
+	ViInt32 writeDelay,
+	ViInt32 readDelay,
+	ViInt32 ioSegmentSize,
+	ViInt32 opcWaitMode,
+	ViInt32 opcTimeout,
+	ViInt32 visaTimeout,
+	ViInt32 selfTestTimeout,
+	ViInt32 binaryFloatNumbersFormat,
+	ViInt32 binaryIntegerNumbersFormat,
+	ViPSession newSession)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	RsCoreSessionPtr rsSession;
+	ViSession instrSession;
+	ViInt32 flag = 0;
+	ViBoolean simulate = VI_TRUE;
+	ViBoolean reuseSession = VI_FALSE;
+	ViBoolean sessionPool = VI_FALSE;
+	const RsCoreTransport* transport = NULL;
+	const RsCoreAllocator* allocator = NULL;
+	RsCoreAttributeSetting engineSettings[5] = {{0, 0, NULL}};
+
+	/* --- Set "C" locale --- */
+	{
+		char* locale;
+		locale = setlocale(LC_ALL, "C");
+	}
+
+	checkErr(RsCoreInt_ParseOptionsBefore(optionsString, &simulate, &reuseSession, &sessionPool, &transport, &allocator));
+	checkErr(RsCoreInt_InitOrReuseSession(resourceName, optionsString, attrList, simulate, reuseSession, sessionPool, transport,
+	                                      allocator, &instrSession));
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	*newSession = instrSession;
+
+	// Default values for the rsSession
+	RsCoreInt_StrcpyMaxLen(rsSession->specificPrefix, RS_MAX_SHORT_MESSAGE_BUF_SIZE, specificPrefix);
+	rsSession->reuseSession = reuseSession;
+	rsSession->sessionPool = sessionPool;
+	rsSession->mutex = NULL;
+	rsSession->multiThreadLocking = VI_FALSE;
+	rsSession->sessionType = RS_INTF_TCPIP;
+	rsSession->allowViClear = VI_TRUE;
+	rsSession->optionChecking = VI_TRUE; // OptionCheck has no attribute, only the rsSession field
+	rsSession->fastSweepInstrument = 0;
+	rsSession->writeDelay = writeDelay;
+	rsSession->readDelay = readDelay;
+	rsSession->ioSegmentSize = ioSegmentSize;
+	rsSession->opcWaitMode = opcWaitMode;
+	rsSession->selfTestTimeout = selfTestTimeout;
+	rsSession->viReadStbVisaTimeoutMs = 0;
+	rsSession->autoSystErrQuery = VI_FALSE;
+	rsSession->sendOpcInCheckStatus = VI_FALSE;
+	rsSession->recogniseLongResponses = VI_FALSE;
+	rsSession->reportAttrDataTypeMismatch = VI_FALSE;
+	rsSession->binaryFloatNumbersFormat = binaryFloatNumbersFormat;
+	rsSession->binaryIntegerNumbersFormat = binaryIntegerNumbersFormat;
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_OPTIONS_LIST, &rsSession->attrOptionsListPtr));
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_INSTRUMENT_MODEL, &rsSession->attrInstrModelPtr));
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_OPC_CALLBACK, &rsSession->attrOpcCallbackPtr));
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_QUERY_INSTRUMENT_STATUS, &rsSession->attrQueryInstrStatusPtr));
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_RANGE_CHECK, &rsSession->attrRangeCheckPtr));
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_CHECK_STATUS_CALLBACK, &rsSession->attrCheckStatusCallbackPtr));
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_SIMULATE, &rsSession->attrSimulatePtr));
+	checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_SIMULATE, 0, simulate));
+	checkErr(RsCore_ClearErrorInfo(instrSession)); // Clears primaryError, secondaryError, errorElaboration
+
+
+	// InterfaceType determination
+	if (!simulate)
+	{
+		checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_USER_DATA, (ViAttrState)rsSession));
+		checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TMO_VALUE, visaTimeout));
+		checkErr(RsCoreInt_GetSessionType(instrSession, &rsSession->sessionType));
+
+		/* Configure VISA Formatted I/O */
+		if (rsSession->transport == NULL)
+		{
+			checkErr(viSetBuf(instrSession, (ViUInt16)(VI_READ_BUF | VI_WRITE_BUF), 4000));
+			checkErr(viSetAttribute(instrSession, VI_ATTR_WR_BUF_OPER_MODE, VI_FLUSH_ON_ACCESS));
+			checkErr(viSetAttribute(instrSession, VI_ATTR_RD_BUF_OPER_MODE, VI_FLUSH_ON_ACCESS));
+		}
+
+		// Settings for different interfaces
+		if (rsSession->sessionType == RS_INTF_ASRL)
+		{
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR, 10));
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_ASRL_END_IN, 0));
+			// In viRead the read end is controlled by ReadTermCharacterEnabled property
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_ASRL_END_OUT, 0)); // In viWrite nothing is added to the sent data
+			rsSession->vxiCapable = VI_FALSE;
+			rsSession->addTermCharToWriteBinBlock = VI_TRUE;
+			rsSession->assureWriteWithLF = VI_TRUE;
+		}
+		else if (rsSession->sessionType == RS_INTF_SOCKET)
+		{
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR, 10));
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE));
+			rsSession->vxiCapable = VI_FALSE;
+			rsSession->addTermCharToWriteBinBlock = VI_TRUE;
+			rsSession->assureWriteWithLF = VI_TRUE;
+		}
+		else if (rsSession->sessionType == RS_INTF_GPIB)
+		{
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_FALSE));
+			rsSession->vxiCapable = VI_TRUE;
+			rsSession->addTermCharToWriteBinBlock = VI_FALSE;
+			rsSession->assureWriteWithLF = VI_FALSE;
+		}
+		else if (rsSession->sessionType == RS_INTF_TCPIP)
+		{
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_FALSE));
+			rsSession->vxiCapable = VI_TRUE;
+			rsSession->addTermCharToWriteBinBlock = VI_FALSE;
+			rsSession->assureWriteWithLF = VI_FALSE;
+		}
+		else if (rsSession->sessionType == RS_INTF_USB)
+		{
+			checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_FALSE));
+			rsSession->vxiCapable = VI_TRUE;
+			rsSession->addTermCharToWriteBinBlock = VI_FALSE;
+			rsSession->assureWriteWithLF = VI_FALSE;
+		}
+		else
+		{
+			rsSession->sessionType = RS_INTF_UNKNOWN;
+			snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "Unrecognized interface type no. " _PERCD, rsSession->sessionType);
+			viCheckErrElab(RS_ERROR_INVALID_TYPE, errorElab);
+		}
+
+		// Coerce the opcWaitMode for non-VXI session. Service request events also need a VISA session
+		if ((rsSession->vxiCapable == VI_FALSE || rsSession->transport != NULL) && (rsSession->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST))
+		{
+			rsSession->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLINGSLOW;
+		}
+	}
+
+	// Engine version and RS_ATTR_SPECIFIC_DRIVER_PREFIX in one step
+	engineSettings[0].attributeId = RS_ATTR_ENGINE_MAJOR_VERSION;
+	engineSettings[0].integerValue = RSCORE_ENGINE_MAJOR_VERSION;
+	engineSettings[1].attributeId = RS_ATTR_ENGINE_MINOR_VERSION;
+	engineSettings[1].integerValue = RSCORE_ENGINE_MINOR_VERSION;
+	engineSettings[2].attributeId = RS_ATTR_ENGINE_REVISION;
+	engineSettings[2].stringValue = RSCORE_ENGINE_REVISION;
+	engineSettings[3].attributeId = RS_ATTR_SPECIFIC_DRIVER_PREFIX;
+	engineSettings[3].stringValue = specificPrefix;
+	checkErr(RsCore_ApplyAttributeSettings(instrSession, engineSettings));
+
+	// Set RangeCheck and InstrumentStatusCheck to true.
+	checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_RANGE_CHECK, 0, VI_TRUE));
+	checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_QUERY_INSTRUMENT_STATUS, 0, VI_TRUE));
+
+
+	// Additional attributes setting
+	checkErr(RsCore_SetAttributeViSession(instrSession, NULL, RS_ATTR_VISA_RM_SESSION, 0, rsSession->rmSession));
+	checkErr(RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_OPC_TIMEOUT, 0, opcTimeout));
+
+	checkErr(RsCore_GetAttributeFlags(instrSession, RS_ATTR_IO_RESOURCE_DESCRIPTOR, &flag));
+	checkErr(RsCore_SetAttributeFlags(instrSession, RS_ATTR_IO_RESOURCE_DESCRIPTOR, flag & 0xfffb | 0x0010));
+	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_IO_RESOURCE_DESCRIPTOR, 0, resourceName));
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ApplyOptionString
+    Parses the init_with_options option string and sets the session properties and attributes
+******************************************************************************************************/
+ViStatus RsCore_ApplyOptionString(ViSession instrSession, ViConstString optionsString)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar* driverSetup = NULL;
+	ViChar token[RS_MAX_MESSAGE_LEN];
+	ViChar tokenName[RS_MAX_MESSAGE_LEN];
+	ViChar tokenValue[RS_MAX_MESSAGE_LEN];
+	ViChar elab[RS_MAX_MESSAGE_LEN];
+	ViInt32 elementsCount, idx;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	ViInt32 bufferSize = (ViInt32)strlen(optionsString) + 1;
+
+	if (!optionsString || bufferSize <= 1)
+		goto Error;
+
+	viCheckAllocElab(driverSetup = (ViChar*)RsCore_Calloc(instrSession, 1, bufferSize), "Driver setup string in parsing rsxxx_InitWithOptions option string");
+
+	elementsCount = RsCore_GetElementsCount(optionsString, ',');
+	for (idx = 0; idx < elementsCount; idx++)
+	{
+		RsCore_GetTokenAtIndex(optionsString, ',', idx, token, RS_MAX_MESSAGE_LEN, NULL);
+		if (!RsCoreInt_SplitTokenToNameAndValue(token, "=", tokenName, tokenValue, RS_MAX_MESSAGE_LEN))
+			goto Unresolved;
+
+		RsCoreInt_ToLowerCase(tokenName);
+		if (strcmp(tokenName, "simulate") == 0)
+		{
+			// already parsed and set in the RsCore_SpecificDriverNew, here only mentioned not to be considered unresolved
+		}
+		else if (strcmp(tokenName, "reusesession") == 0 || strcmp(tokenName, "sessionpool") == 0)
+		{
+			// Already parsed and set in the RsCore_SpecificDriverNew, here only mentioned not to be considered unresolved
+		}
+		else if (strcmp(tokenName, "identitysnapshot") == 0)
+		{
+			RsCoreInt_StrcpyMaxLen(rsSession->identity.fileName, RS_MAX_MESSAGE_LEN, tokenValue);
+			checkErr(RsCoreInt_LoadIdentitySnapshot(rsSession));
+		}
+		else if (strcmp(tokenName, "transport") == 0 || strcmp(tokenName, "recordfile") == 0 ||
+			strcmp(tokenName, "recordtransport") == 0 || strcmp(tokenName, "replaytiming") == 0)
+		{
+			// Already parsed and used when opening the session transport, here only mentioned not to be considered unresolved
+		}
+		else if (strcmp(tokenName, "allocator") == 0)
+		{
+			// Already parsed and used when creating the session, here only mentioned not to be considered unresolved
+		}
+		else if (strcmp(tokenName, "multithreadlocking") == 0)
+		{
+			rsSession->multiThreadLocking = RsCore_Convert_String_To_Boolean(tokenValue);
+		}
+		else if (strcmp(tokenName, "roundtripdiagnostics") == 0)
+		{
+			rsSession->roundTrip.enabled = RsCore_Convert_String_To_Boolean(tokenValue);
+		}
+		else if (strcmp(tokenName, "tracecache") == 0)
+		{
+			checkErr(RsCore_SetTraceCacheEnabled(instrSession, RsCore_Convert_String_To_Boolean(tokenValue)));
+		}
+		else if (strcmp(tokenName, "rangecheck") == 0)
+		{
+			checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_RANGE_CHECK, 0, RsCore_Convert_String_To_Boolean(tokenValue)));
+		}
+		else if (strcmp(tokenName, "queryinstrstatus") == 0)
+		{
+			checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_QUERY_INSTRUMENT_STATUS, 0, RsCore_Convert_String_To_Boolean(tokenValue))
+			);
+		}
+		else if (strcmp(tokenName, "fastsweep") == 0)
+		{
+			rsSession->fastSweepInstrument = atoi(tokenValue);
+		}
+		else if (strcmp(tokenName, "readdelay") == 0)
+		{
+			rsSession->readDelay = (ViInt32)atof(tokenValue);
+		}
+		else if (strcmp(tokenName, "writedelay") == 0)
+		{
+			rsSession->writeDelay = (ViInt32)atof(tokenValue);
+		}
+		else if (strcmp(tokenName, "cache") == 0)
+		{
+			checkErr(RsCore_SetAttributeViBoolean(instrSession, NULL, RS_ATTR_CACHE, 0, RsCore_Convert_String_To_Boolean(tokenValue)));
+		}
+		else if (strcmp(tokenName, "visatimeout") == 0)
+		{
+			if (!RsCore_Simulating(instrSession))
+			{
+				checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TMO_VALUE, atol(tokenValue)));
+			}
+		}
+		else if (strcmp(tokenName, "opctimeout") == 0)
+		{
+			checkErr(RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_OPC_TIMEOUT, 0, (ViInt32)atof(tokenValue)));
+		}
+		else if (strcmp(tokenName, "sendopcqueryincheckstatus") == 0)
+		{
+			rsSession->sendOpcInCheckStatus = RsCore_Convert_String_To_Boolean(tokenValue);
+		}
+		else if (strcmp(tokenName, "recogniselongresponses") == 0)
+		{
+			rsSession->recogniseLongResponses = RsCore_Convert_String_To_Boolean(tokenValue);
+		}
+		else if (strcmp(tokenName, "reportattrdatatypemismatch") == 0)
+		{
+			rsSession->reportAttrDataTypeMismatch = RsCore_Convert_String_To_Boolean(tokenValue);
+		}
+		else if (strcmp(tokenName, "vireadstbvisatimeout") == 0)
+		{
+			rsSession->viReadStbVisaTimeoutMs = (ViInt32)atof(tokenValue);
+		}
+		else if (strcmp(tokenName, "iosegmentsize") == 0)
+		{
+			rsSession->ioSegmentSize = (ViInt32)atof(tokenValue);
+		}
+		else if (strcmp(tokenName, "assurewritewithlf") == 0)
+		{
+			rsSession->assureWriteWithLF = RsCore_Convert_String_To_Boolean(tokenValue);
+		}
+		else if (strcmp(tokenName, "addtermchartowritebinblock") == 0)
+		{
+			rsSession->addTermCharToWriteBinBlock = RsCore_Convert_String_To_Boolean(tokenValue);
+		}
+		else if (strcmp(tokenName, "autosystemerrorquery") == 0)
+		{
+			rsSession->autoSystErrQuery = RsCore_Convert_String_To_Boolean(tokenValue);
+		}
+		else if (strcmp(tokenName, "selftesttimeout") == 0)
+		{
+			rsSession->selfTestTimeout = (ViInt32)atof(tokenValue);
+		}
+		else if (strcmp(tokenName, "opcwaitmode") == 0)
+		{
+			RsCoreInt_ToLowerCase(tokenValue);
+			if (strcmp(tokenValue, "stbpolling") == 0) rsSession->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLING;
+			else if (strcmp(tokenValue, "stbpollingslow") == 0) rsSession->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLINGSLOW;
+			else if (strcmp(tokenValue, "stbpollingsuperslow") == 0) rsSession->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLINGSUPERSLOW;
+			else if (strcmp(tokenValue, "servicerequest") == 0) rsSession->opcWaitMode = RS_VAL_OPCWAIT_SERVICEREQUEST;
+			else if (strcmp(tokenValue, "opcquery") == 0) rsSession->opcWaitMode = RS_VAL_OPCWAIT_OPCQUERY;
+			else
+			{
+				snprintf(elab, RS_MAX_MESSAGE_LEN,
+				         "Option string token 'OpcWaitMode', value '%s' is unrecognised."
+				         "Defined values: 'StbPolling / StbPollingSlow / StbPollingSuperSlow / ServiceRequest'", tokenValue);
+				viCheckErrElab(RS_ERROR_INVALID_VALUE, elab);
+			}
+		}
+		else
+		{
+		Unresolved:
+			// Store unresolved option string for RS_ATTR_DRIVER_SETUP
+			RsCore_TrimString(token, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+			RsCore_AppendToCsvString(driverSetup, ",", bufferSize, token);
+		}
+	}
+
+	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_DRIVER_SETUP, 0, driverSetup));
+
+Error:
+	if (driverSetup)
+		RsCore_Free(instrSession, driverSetup);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetRsSession
+    Returns core session properties related to the VISA instrSession
+    The last found session is cached per thread, repeated calls with the same session do not take the global lock
+******************************************************************************************************/
+ViStatus RsCore_GetRsSession(ViSession instrSession, RsCoreSessionPtr* rsSession)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 idx;
+	ViUInt32 generation;
+
+	*rsSession = NULL;
+
+	if (instrSession == 0)
+	{
+		return RS_ERROR_INVALID_SESSION_HANDLE;
+	}
+
+	generation = gSessionsGeneration;
+	if (gThreadSessionCache.io == instrSession && gThreadSessionCache.generation == generation)
+	{
+		*rsSession = gThreadSessionCache.rsSession;
+		return VI_SUCCESS;
+	}
+
+	gMutex = RsCoreInt_MutexLock(gMutex);
+
+	for (idx = 0; idx < MAX_NUMBER_OF_SESSIONS; idx++)
+		if (gSessionsList[idx] != NULL && gSessionsList[idx]->io == instrSession)
+		{
+			*rsSession = gSessionsList[idx];
+			gThreadSessionCache.io = instrSession;
+			gThreadSessionCache.rsSession = *rsSession;
+			gThreadSessionCache.generation = gSessionsGeneration;
+			goto Error;
+		}
+
+	checkErr(RS_ERROR_INVALID_SESSION_HANDLE);
+
+Error:
+	RsCoreInt_MutexUnlock(gMutex);
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ViClose
+    Closes the VISA I/O session
+    After calling RsCore_ViClose, call the RsCore_Dispose to close all the session resources used by the driver.
+******************************************************************************************************/
+ViStatus RsCore_ViClose(ViSession instrSession)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	(void)RsCore_GetRsSession(instrSession, &rsSession);
+
+	if (rsSession == NULL)
+	{
+		// no other info is available, close the session without reporting an error
+		(void)viClose(instrSession);
+		return error;
+	}
+
+	if (rsSession->transport != NULL)
+	{
+		gMutex = RsCoreInt_MutexLock(gMutex);
+		rsSession->transport->close(rsSession->transportContext);
+		rsSession->transport = NULL;
+		rsSession->transportContext = NULL;
+		RsCoreInt_AtomicDecrement(&gTransportSessionsCount);
+		RsCoreInt_MutexUnlock(gMutex);
+		return error;
+	}
+
+	if (RsCore_Simulating(instrSession) == VI_TRUE)
+		return error;
+
+	(void)viClose(instrSession);
+	(void)viClose(rsSession->rmSession);
+	rsSession->rmSession = 0;
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_Dispose
+    Destroys the RS session, all of its attributes, and the memory resources it uses.
+    Close the VISA I/O session before by calling RsCore_ViClose()
+******************************************************************************************************/
+ViStatus RsCore_Dispose(ViSession instrSession)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 idx = 0;
+	void* p2value;
+	RsCoreSessionPtr rsSession = NULL;
+
+	(void)RsCore_GetRsSession(instrSession, &rsSession);
+	
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	if (rsSession != NULL)
+	{
+		(void)RsCoreInt_DisposeRepCapTable(instrSession);
+
+		/* Deallocate memory for attribute properties list */
+		if (rsSession->attributes != NULL)
+		{
+			for (idx = 0; idx < rsSession->attributesCount; idx++)
+			{
+				p2value = rsSession->attributes[idx].p2value;
+				if (p2value != NULL)
+				{
+					RsCore_Free(instrSession, p2value);
+					p2value = NULL;
+				}
+			}
+			RsCore_Free(instrSession, rsSession->attributes);
+			rsSession->attributes = NULL;
+		}
+
+		if (rsSession->usedAttributesCache.attrs)
+		{
+			RsCore_Free(instrSession, rsSession->usedAttributesCache.attrs);
+			rsSession->usedAttributesCache.attrs = NULL;
+		}
+
+		if (rsSession->usedAttributesCache.IDs)
+		{
+			RsCore_Free(instrSession, rsSession->usedAttributesCache.IDs);
+			rsSession->usedAttributesCache.IDs = NULL;
+		}
+
+		if (rsSession->functionLatencies)
+		{
+			RsCore_Free(instrSession, rsSession->functionLatencies);
+			rsSession->functionLatencies = NULL;
+		}
+
+		RsCoreInt_TraceCacheClear(rsSession);
+
+		RsCoreInt_MutexDispose(rsSession->mutex);
+		rsSession->mutex = NULL;
+
+		(void)RsCoreInt_SessionsListDeleteSession(instrSession);
+	}
+	RsCoreInt_MutexUnlock(gMutex);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetSpecificDriverRevision
+    Sets summary information string usually to the RS_ATTR_SPECIFIC_DRIVER_REVISION
+    Use it in the driver's PREFIX_InitAttributes function
+******************************************************************************************************/
+ViStatus RsCore_SetSpecificDriverRevision(ViSession instrSession, ViAttr specificDriverRevisionAttrId)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar prefix[RS_MAX_MESSAGE_LEN];
+	ViChar buffer[RS_MAX_MESSAGE_LEN];
+	ViChar revision[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 majorVer, minorVer, minorminorVer;
+
+	checkErr(RsCore_GetAttributeViString(instrSession, NULL, RS_ATTR_SPECIFIC_DRIVER_PREFIX, 0, RS_MAX_MESSAGE_LEN, prefix));
+	checkErr(RsCore_GetAttributeViInt32(instrSession, NULL, RS_ATTR_SPECIFIC_DRIVER_MAJOR_VERSION, 0, &majorVer));
+	checkErr(RsCore_GetAttributeViInt32(instrSession, NULL, RS_ATTR_SPECIFIC_DRIVER_MINOR_VERSION, 0, &minorVer));
+	checkErr(RsCore_GetAttributeViInt32(instrSession, NULL, RS_ATTR_SPECIFIC_DRIVER_MINOR_MINOR_VERSION, 0, &minorminorVer));
+
+	checkErr(RsCoreInt_GetVisaInfo(instrSession, RS_MAX_MESSAGE_BUF_SIZE, revision));
+
+	sprintf(buffer,
+	        "Driver: %s " _PERCD "." _PERCD "." _PERCD ", Compiler: %s %3.2f, "
+	        "Components: RsCore Component %.2f, VISA-Spec %s",
+	        prefix, majorVer, minorVer, minorminorVer,
+	        RS_COMPILER_NAME, RS_COMPILER_VER_NUM,
+	        RSCORE_ENGINE_MAJOR_VERSION + RSCORE_ENGINE_MINOR_VERSION / 10.0,
+	        revision);
+
+	checkErr(RsCore_SetAttributeViString(instrSession, NULL, specificDriverRevisionAttrId, 0, buffer));
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ViClear
+    Sends VISA viClear command to the instrument
+******************************************************************************************************/
+ViStatus RsCore_ViClear(ViSession instrSession)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (RsCore_Simulating(instrSession) == VI_TRUE)
+		goto Error;
+
+	if (rsSession->allowViClear == VI_FALSE)
+		goto Error;
+
+	checkErr(RsCoreInt_IoClear(instrSession));
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ViClear
+    Performs standard instrument ClearStatus procedure
+******************************************************************************************************/
+ViStatus RsCore_ClearStatus(ViSession instrSession)
+{
+	ViStatus error = VI_SUCCESS;
+
+	checkErr(RsCore_ViClear(instrSession));
+	checkErr(RsCoreInt_ClearBeforeRead(instrSession));
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_LockSession
+    Obtains a lock on the specified resource.
+    Obtains a multi-thread lock on the instrument session. Before it does so, it waits until all other execution threads
+    have released their locks on the instrument session.
+******************************************************************************************************/
+ViStatus RsCore_LockSession(ViSession instrSession)
+{
+	return RsCore_LockSessionForFunction(instrSession, NULL);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_LockSessionForFunction
+    Same as RsCore_LockSession, the functionName is the static name of the driver function locking the session.
+    The driver functions use it through the RsCore_LockSession macro.
+    The outermost locking function starts the latency accounting of the function, RsCore_UnlockSession ends it.
+******************************************************************************************************/
+ViStatus RsCore_LockSessionForFunction(ViSession instrSession, ViConstString functionName)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (rsSession->multiThreadLocking == VI_TRUE)
+	{
+		if (rsSession->mutex == NULL)
+		{
+			// Threads locking the session for the first time at once must share one mutex
+			gMutex = RsCoreInt_MutexLock(gMutex);
+			if (rsSession->mutex == NULL)
+				rsSession->mutex = RsCoreInt_MutexCreate();
+
+			RsCoreInt_MutexUnlock(gMutex);
+		}
+
+		rsSession->mutex = RsCoreInt_MutexLock(rsSession->mutex);
+	}
+
+	RsCoreInt_LatencyCallBegin(rsSession, functionName);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_UnlockSession
+    Releases a lock that you acquired on an instrument session using RsCore_LockSession.
+******************************************************************************************************/
+ViStatus RsCore_UnlockSession(ViSession instrSession)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	RsCoreInt_LatencyCallEnd(rsSession);
+
+	if (rsSession->multiThreadLocking == VI_TRUE)
+	{
+		RsCoreInt_MutexUnlock(rsSession->mutex);
+	}
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_Simulating
+    Returns the current value of the RS_ATTR_SIMULATE attribute
+******************************************************************************************************/
+ViBoolean RsCore_Simulating(ViSession instrSession)
+{
+	ViBoolean value = VI_FALSE;
+	RsCoreSessionPtr rsSession = NULL;
+
+	(void)RsCore_GetRsSession(instrSession, &rsSession);
+
+	if (rsSession == 0)
+		return value;
+
+	(void)(RsCoreInt_GetAttrP2Value(rsSession->attrSimulatePtr, &value, 0));
+
+	return value;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_RangeChecking
+    Returns the current value of the RS_ATTR_RANGE_CHECK attribute
+******************************************************************************************************/
+ViBoolean RsCore_RangeChecking(ViSession instrSession)
+{
+	ViBoolean value = VI_TRUE;
+	RsCoreSessionPtr rsSession = NULL;
+
+	(void)RsCore_GetRsSession(instrSession, &rsSession);
+
+	if (rsSession == 0)
+		return value;
+
+	(void)(RsCoreInt_GetAttrP2Value(rsSession->attrRangeCheckPtr, &value, 0));
+
+	return value;
+}
+
+/*****************************************************************************************************/
+/*   RsCore_QueryInstrStatus
+     Returns the current value of the RS_ATTR_QUERY_INSTR_STATUS attribute
+******************************************************************************************************/
+ViBoolean RsCore_QueryInstrStatus(ViSession instrSession)
+{
+	ViBoolean value = VI_TRUE;
+	RsCoreSessionPtr rsSession = NULL;
+
+	(void)RsCore_GetRsSession(instrSession, &rsSession);
+
+	if (rsSession == 0)
+		return value;
+
+	(void)(RsCoreInt_GetAttrP2Value(rsSession->attrQueryInstrStatusPtr, &value, 0));
+
+	return value;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetVisaTimeout
+    Sets VISA timeout in milliseconds
+******************************************************************************************************/
+ViStatus RsCore_SetVisaTimeout(ViSession instrSession, ViUInt32 timeoutMs)
+{
+	if (RsCore_Simulating(instrSession) == VI_TRUE)
+		return VI_SUCCESS;
+
+	return RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TMO_VALUE, timeoutMs);
+}
+
+/*****************************************************************************************************/
+/*  Returns VISA timeout in milliseconds
+******************************************************************************************************/
+ViStatus RsCore_GetVisaTimeout(ViSession instrSession, ViPUInt32 timeoutMs)
+{
+	if (RsCore_Simulating(instrSession) == VI_TRUE)
+		return VI_SUCCESS;
+
+	return RsCoreInt_IoGetAttribute(instrSession, VI_ATTR_TMO_VALUE, timeoutMs);
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Set / Get / Clear Error info --------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  RsCore_SetErrorInfo
+    Sets error info for the session. The viCheckErr, viCheckErrElab, viCheckParm, viCheckAlloc,
+    and viCheckWarn macros use RsCore_SetErrorInfo
+******************************************************************************************************/
+ViStatus RsCore_SetErrorInfo(ViSession instrSession,
+                             ViBoolean overWrite,
+                             ViStatus primaryError,
+                             ViStatus secondaryError,
+                             ViConstString errorElab)
+{
+	return RsCoreInt_SetErrorRecord(instrSession, overWrite, primaryError, secondaryError, NULL, errorElab);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetErrorContext
+    Same as RsCore_SetErrorInfo, but the elaboration is captured as the static format text
+    with up to three ViInt32 arguments (_PERCD / _PERCU conversions) and the related attribute ID (0 if none).
+    The elaboration string is formatted only when the error info is read, e.g. by RsCore_GetErrorInfo.
+    The format must be a static string, only its pointer is stored. The viCheckErrCtx and viCheckAllocCtx macros use this function
+******************************************************************************************************/
+ViStatus RsCore_SetErrorContext(ViSession instrSession,
+                                ViBoolean overWrite,
+                                ViStatus primaryError,
+                                ViStatus secondaryError,
+                                ViAttr attributeId,
+                                ViConstString format,
+                                ViInt32 arg1,
+                                ViInt32 arg2,
+                                ViInt32 arg3)
+{
+	RsCoreErrorContext context;
+
+	context.pending = VI_TRUE;
+	context.format = format;
+	context.attributeId = attributeId;
+	context.args[0] = arg1;
+	context.args[1] = arg2;
+	context.args[2] = arg3;
+
+	return RsCoreInt_SetErrorRecord(instrSession, overWrite, primaryError, secondaryError, &context, "");
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetErrorInfo
+    Retrieves and then clears the error information for the entered session.
+    Used attributes:
+    - RS_ATTR_PRIMARY_ERROR or PREFIX_ATTR_PRIMARY_ERROR
+    - RS_ATTR_SECONDARY_ERROR or PREFIX_ATTR_SECONDARY_ERROR
+    - RS_ATTR_ERROR_ELABORATION or PREFIX_ATTR_ERROR_ELABORATION
+        For errorElaboration string you need to pass the buffer with the size at least RS_MAX_MESSAGE_BUF_SIZE
+    The pending error context (see RsCore_SetErrorContext) is formatted here
+******************************************************************************************************/
+ViStatus RsCore_GetErrorInfo(ViSession instrSession, ViStatus* primaryError, ViStatus* secondaryError, ViChar* errorElaboration)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	(void)RsCore_GetRsSession(instrSession, &rsSession);
+
+	if (rsSession == NULL)
+	{
+		// in this case return the global last error entry
+		RsCoreInt_GetGlobalErrorInfo(primaryError, secondaryError, errorElaboration);
+		RsCoreInt_SetGlobalErrorInfo(VI_SUCCESS, VI_SUCCESS, "");
+	}
+	else
+	{
+		RsCoreInt_ResolveErrorContext(rsSession);
+		*primaryError = rsSession->primaryError;
+		*secondaryError = rsSession->secondaryError;
+		RsCoreInt_StrcpyMaxLen(errorElaboration, RS_MAX_MESSAGE_BUF_SIZE, rsSession->errorElaboration);
+		(void)RsCore_ClearErrorInfo(instrSession);
+	}
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_AppendSecondaryError
+    If primaryError is < 0, the function adds the secondary error and errorElab
+    If the entered primaryError does not equal the existing primaryError, the entered primaryError takes priority.
+    The function does not overwrite the existing error elaboration, rather it appends the new one to the end.
+    For special secondary error codes e.g. RS_ERROR_INVALID_PARAMETER, VI_ERROR_PARAMETER1 .. VI_ERROR_PARAMETER8
+    the new error elaboration is added in a special way to make the elaboration more comprehensive
+******************************************************************************************************/
+ViStatus RsCore_AppendSecondaryError(ViSession instrSession,
+                                     ViStatus primaryError,
+                                     ViStatus secondaryError,
+                                     ViConstString errorElab)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 parameterIdx = 1;
+	ViChar existingErrElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar composedErrElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViStatus existingPrimaryErr, existingSecondaryErr;
+
+	if (primaryError == VI_SUCCESS)
+		return error;
+
+	switch (secondaryError)
+	{
+	case RS_ERROR_INVALID_PARAMETER: parameterIdx = 0;
+		break;
+	case VI_ERROR_PARAMETER1: parameterIdx = 1;
+		break;
+	case VI_ERROR_PARAMETER2: parameterIdx = 2;
+		break;
+	case VI_ERROR_PARAMETER3: parameterIdx = 3;
+		break;
+	case VI_ERROR_PARAMETER4: parameterIdx = 4;
+		break;
+	case VI_ERROR_PARAMETER5: parameterIdx = 5;
+		break;
+	case VI_ERROR_PARAMETER6: parameterIdx = 6;
+		break;
+	case VI_ERROR_PARAMETER7: parameterIdx = 7;
+		break;
+	case VI_ERROR_PARAMETER8: parameterIdx = 8;
+		break;
+	default: parameterIdx = -1;
+		break;
+	}
+
+	(void)RsCore_GetErrorInfo(instrSession, &existingPrimaryErr, &existingSecondaryErr, existingErrElab);
+
+	if (parameterIdx == -1)
+	{
+		// Error code other than Parameter error
+		snprintf(composedErrElab, RS_MAX_MESSAGE_BUF_SIZE, "%s\n%s", existingErrElab, errorElab);
+	}
+	else
+	{
+		if (isNullOrEmpty(errorElab))
+		{
+			if (parameterIdx == 0)
+			{
+				// Parameter error, unknown Idx, no name provided
+				snprintf(composedErrElab, RS_MAX_MESSAGE_BUF_SIZE,
+				         "Error related to unknown function parameter.\n%s", existingErrElab);
+			}
+			else
+			{
+				// Parameter error, known Idx, no name provided
+				snprintf(composedErrElab, RS_MAX_MESSAGE_BUF_SIZE,
+				         "Error related to function parameter no. " _PERCD ".\n%s", parameterIdx, existingErrElab);
+			}
+		}
+		else
+		{
+			if (parameterIdx == 0)
+			{
+				// Parameter error, unknown Idx, name is provided
+				snprintf(composedErrElab, RS_MAX_MESSAGE_BUF_SIZE,
+				         "Error related to function parameter '%s'.\n%s", errorElab, existingErrElab);
+			}
+			else
+			{
+				// Parameter error, known Idx, name is provided
+				snprintf(composedErrElab, RS_MAX_MESSAGE_BUF_SIZE,
+				         "Error related to function parameter no. " _PERCD " - '%s'.\n%s", parameterIdx, errorElab, existingErrElab);
+			}
+		}
+	}
+
+	RsCore_TrimString(composedErrElab, RS_VAL_TRIM_WHITESPACES);
+	RsCore_SetErrorInfo(instrSession, VI_TRUE, primaryError, secondaryError, composedErrElab);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ClearErrorInfo
+    Clears error information for the current session and the global error info.
+    Affected attributes:
+    - RS_ATTR_PRIMARY_ERROR or PREFIX_ATTR_PRIMARY_ERROR
+    - RS_ATTR_SECONDARY_ERROR or PREFIX_ATTR_SECONDARY_ERROR
+    - RS_ATTR_ERROR_ELABORATION or PREFIX_ATTR_ERROR_ELABORATION
+******************************************************************************************************/
+ViStatus RsCore_ClearErrorInfo(ViSession instrSession)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	(void)RsCore_GetRsSession(instrSession, &rsSession);
+
+	RsCoreInt_SetGlobalErrorInfo(VI_SUCCESS, VI_SUCCESS, "");
+
+	if (rsSession == NULL)
+		return error;
+
+	rsSession->primaryError = VI_SUCCESS;
+	rsSession->secondaryError = VI_SUCCESS;
+	memset(rsSession->errorElaboration, 0, RS_MAX_MESSAGE_BUF_SIZE);
+	rsSession->errorContext.pending = VI_FALSE;
+
+	(void)RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_PRIMARY_ERROR, 0, VI_SUCCESS);
+	(void)RsCore_SetAttributeViInt32(instrSession, NULL, RS_ATTR_SECONDARY_ERROR, 0, VI_SUCCESS);
+	(void)RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_ERROR_ELABORATION, 0, "");
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ParamPositionError
+    Returns one of the VI_ERROR_PARAMETER1 ... VI_ERROR_PARAMETER8, RS_ERROR_INVALID_PARAMETER.
+******************************************************************************************************/
+ViStatus RsCore_ParamPositionError(ViInt32 parameterPosition)
+{
+	ViInt32 error[] = {
+		RS_ERROR_INVALID_PARAMETER,
+		VI_ERROR_PARAMETER1, VI_ERROR_PARAMETER2,
+		VI_ERROR_PARAMETER3, VI_ERROR_PARAMETER4,
+		VI_ERROR_PARAMETER5, VI_ERROR_PARAMETER6,
+		VI_ERROR_PARAMETER7, VI_ERROR_PARAMETER8
+	};
+
+	return ((0 < parameterPosition) && (parameterPosition < 9)) ? error[parameterPosition] : RS_ERROR_INVALID_PARAMETER;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetErrorCompleteDescription
+    Calls RsCore_GetErrorInfo and composes a comprehensive string description of the current error.
+    For errorMessageFnc pass the pointer to the driver's PREFIX_error_message() function
+******************************************************************************************************/
+ViStatus RsCore_GetErrorCompleteDescription(ViSession instrSession, RsCoreErrorMessage errorMessageFnc,
+                                            ViStatus* errorCode, ViInt32 bufferSize, ViChar* description)
+{
+	ViStatus error = VI_SUCCESS;
+	ViStatus primaryError = VI_SUCCESS;
+	ViStatus secondaryError = VI_SUCCESS;
+	ViChar elaboration[RS_MAX_MESSAGE_BUF_SIZE] = "";
+	ViChar elabNew[RS_MAX_MESSAGE_BUF_SIZE] = "";
+	ViChar errorMessage[RS_MAX_MESSAGE_BUF_SIZE + 1];
+	ViInt32 offset = 0;
+
+	checkErr(RsCore_GetErrorInfo(instrSession, &primaryError, &secondaryError, elaboration));
+	RsCoreInt_StrcpyMaxLen(elabNew, RS_MAX_MESSAGE_BUF_SIZE, "");
+	if (primaryError != VI_SUCCESS)
+	{
+		checkErr((*errorMessageFnc)(instrSession, primaryError, errorMessage));
+		offset += snprintf(elabNew + offset, RS_MAX_MESSAGE_BUF_SIZE - offset, "Primary Error: (Hex 0x%08X) %s\n", (unsigned int)primaryError,
+		                   errorMessage);
+	}
+
+	if (secondaryError != VI_SUCCESS)
+	{
+		checkErr((*errorMessageFnc)(instrSession, secondaryError, errorMessage));
+		offset += snprintf(elabNew + offset, RS_MAX_MESSAGE_BUF_SIZE - offset, "Secondary Error: (Hex 0x%08X) %s\n", (unsigned int)secondaryError,
+		                   errorMessage);
+	}
+
+	if (strlen(elaboration) > 0)
+		snprintf(elabNew + offset, RS_MAX_MESSAGE_BUF_SIZE - offset, "Elaboration: %s", elaboration);
+
+	if (errorCode)
+		*errorCode = primaryError;
+
+	if (bufferSize > 0)
+		RsCoreInt_StrcpyMaxLen(description, bufferSize, elabNew);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetSpecificDriverStatusDesc
+    Same as RsCoreInt_GetErrorMessage, but includes additional error codes in the additionalTableToSearch
+    Use this function to implement the PREFIX_error_message function in the instrument driver.
+    The function works even with invalid instrSession
+******************************************************************************************************/
+ViStatus RsCore_GetSpecificDriverStatusDesc(ViSession instrSession,
+                                            ViStatus statusCode,
+                                            ViChar* messageBuf, ViInt32 bufferSize,
+                                            RsCoreStringValueTable additionalTableToSearch)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt16 cnt;
+
+	error = RsCoreInt_StatusDescription(statusCode, bufferSize, messageBuf);
+
+	if (error == VI_WARN_UNKNOWN_STATUS)
+	{
+		for (cnt = 0; additionalTableToSearch[cnt].string; cnt++)
+		{
+			if (additionalTableToSearch[cnt].value == statusCode)
+			{
+				snprintf(messageBuf, bufferSize, "%s", additionalTableToSearch[cnt].string);
+				return error;
+			}
+		}
+
+		RsCoreInt_StrcpyMaxLen(messageBuf, bufferSize, "The status code passed to the operation could not be interpreted.");
+		return VI_WARN_UNKNOWN_STATUS;
+	}
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GenerateInvalidDataTypeError
+	Generates error RS_ERROR_INVALID_TYPE with comprehensive message
+	context can be set to NULL
+	context is added to the end of the message as a new sentence
+******************************************************************************************************/
+ViStatus RsCore_GenerateInvalidDataTypeError(ViSession instrSession, RsCoreDataType dataType, ViConstString context)
+{
+	ViStatus error = RS_ERROR_INVALID_TYPE;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+
+	if (isNullOrEmpty(context))
+	{
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Invalid data type - %s", RsCoreInt_GetDataTypeString(dataType));
+	}
+	else
+	{
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Invalid data type - %s. %s", RsCoreInt_GetDataTypeString(dataType), context);
+	}
+
+	(void)RsCore_SetErrorInfo(instrSession, VI_TRUE, error, VI_SUCCESS, errElab);
+
+	return error;
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Instrument Model and Instrument Options ---------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  Queries and parses the instrument *IDN? string
+    In simulation, it uses the provided simulationIDNstring as a source for parsing
+    Sets the attributes:
+    - PREFIX_ATTR_ID_QUERY_RESPONSE
+    - RS_ATTR_INSTRUMENT_MANUFACTURER
+    - RS_ATTR_INSTRUMENT_MODEL - based on the idnModelFullName true: "FSW-26", false: "FSW"
+    - RS_ATTR_INSTRUMENT_FIRMWARE_REVISION
+******************************************************************************************************/
+ViStatus RsCore_QueryAndParseIDNstring(ViSession instrSession, ViAttr idnStringAttributeId, ViString simulationIDNstring,
+                                       ViBoolean idnModelFullName, ViString customScanString)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar revision[RS_MAX_MESSAGE_LEN];
+	ViChar manufacturer[RS_MAX_MESSAGE_LEN];
+	ViChar modelFull[RS_MAX_MESSAGE_LEN];
+	ViChar model[RS_MAX_MESSAGE_LEN];
+	ViChar idnString[RS_MAX_MESSAGE_BUF_SIZE];
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	RsCoreInt_StrcpyMaxLen(manufacturer, RS_MAX_MESSAGE_LEN, "Rohde&Schwarz");
+	RsCoreInt_StrcpyMaxLen(modelFull, RS_MAX_MESSAGE_LEN, "DummyModel-Full");
+	RsCoreInt_StrcpyMaxLen(revision, RS_MAX_MESSAGE_LEN, "1.0.0");
+
+	// Query the *IDN?, parse it and store it into the PREFIX_ATTR_ID_QUERY_RESPONSE
+	if (!RsCore_Simulating(instrSession))
+	{
+		// Read the real *IDN? response
+		checkErr(RsCore_QueryViString(instrSession, "*IDN?", idnString));
+
+		// Same instrument as in the identity snapshot: the RsCore_QueryAndParseOPTstring takes the snapshot options
+		rsSession->identity.validated = (rsSession->identity.valid == VI_TRUE && strcmp(rsSession->identity.idn, idnString) == 0) ? VI_TRUE : VI_FALSE;
+		if (rsSession->identity.validated == VI_FALSE)
+		{
+			rsSession->identity.valid = VI_FALSE;
+			RsCoreInt_StrcpyMaxLen(rsSession->identity.idn, RS_MAX_MESSAGE_BUF_SIZE, idnString);
+		}
+	}
+	else
+	{
+		// use the simulationIDNstring value
+		RsCoreInt_StrcpyMaxLen(idnString, RS_MAX_MESSAGE_LEN, simulationIDNstring);
+		rsSession->identity.validated = VI_FALSE;
+	}
+
+	if (customScanString != NULL && strlen(customScanString) > 0)
+	{
+		sscanf(idnString, customScanString, manufacturer, modelFull, revision);
+	}
+	else
+	{
+		sscanf(idnString, "%[^,],%[^,],%*[^,],%256[^\n]", manufacturer, modelFull, revision);
+	}
+
+	checkErr(RsCore_SetAttributeViString(instrSession, NULL, idnStringAttributeId, 0, idnString));
+	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_INSTRUMENT_MANUFACTURER, 0, manufacturer));
+	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_INSTRUMENT_FIRMWARE_REVISION, 0, revision));
+
+	// For model, decide between the model and modelFull - this value is used for option checking
+	RsCoreInt_StrcpyMaxLen(model, RS_MAX_MESSAGE_LEN, "");
+	sscanf(modelFull, "%[^-0-9]", model);
+	if (strlen(model) == 0)
+		idnModelFullName = VI_TRUE;
+
+	if (idnModelFullName)
+	{
+		checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_INSTRUMENT_MODEL, 0, modelFull));
+	}
+	else
+	{
+		checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_INSTRUMENT_MODEL, 0, model));
+	}
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  Evaluates if the IDN string matches case insensitive the expected pattern 'requiredIdnPattern1' or 'requiredIdnPattern2'
+    Returns VI_ERROR_FAIL_ID_QUERY if neither of 'requiredIdnPattern1' or 'requiredIdnPattern2' is found in the IDN string
+    requiredIdnPattern2 can be optionally set to NULL
+******************************************************************************************************/
+ViStatus RsCore_FitsIDNpattern(ViSession instrSession, ViAttr idnStringAttributeId, ViConstString requiredIdnPattern1,
+                               ViConstString requiredIdnPattern2)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar idnString[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar validPatternLowCase[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+
+	checkErr(RsCore_GetAttributeViString(instrSession, NULL, idnStringAttributeId, 0, RS_MAX_MESSAGE_LEN, idnString));
+	RsCoreInt_ToLowerCase(idnString);
+
+	RsCoreInt_StrcpyMaxLen(validPatternLowCase, RS_MAX_MESSAGE_LEN, requiredIdnPattern1);
+	RsCoreInt_ToLowerCase(validPatternLowCase);
+	if (strstr(idnString, validPatternLowCase) != NULL)
+		goto Error;
+
+	if (requiredIdnPattern2 != NULL)
+	{
+		RsCoreInt_StrcpyMaxLen(validPatternLowCase, RS_MAX_MESSAGE_LEN, requiredIdnPattern2);
+		if (strstr(idnString, RsCoreInt_ToLowerCase(validPatternLowCase)) != NULL)
+			goto Error;
+
+		checkErr(RsCore_GetAttributeViString(instrSession, NULL, idnStringAttributeId, 0, RS_MAX_MESSAGE_LEN, idnString));
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "*IDN? string '%s' does not fit either of the required patterns '%s' or '%s'",
+		         idnString, requiredIdnPattern1, requiredIdnPattern2);
+		viCheckErrElab(VI_ERROR_FAIL_ID_QUERY, errElab);
+	}
+
+	checkErr(RsCore_GetAttributeViString(instrSession, NULL, idnStringAttributeId, 0, RS_MAX_MESSAGE_LEN, idnString));
+	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "*IDN? string '%s' does not fit the required pattern '%s'", idnString, requiredIdnPattern1);
+	viCheckErrElab(VI_ERROR_FAIL_ID_QUERY, errElab);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  Queries and parses the instrument options *OPT?
+    In simulation, it uses the provided simulationOPTstring as a source for parsing
+    If the RsCore_QueryAndParseIDNstring validated the identity snapshot, the snapshot options are used without the query
+    Sets the attribute RS_ATTR_OPTIONS_LIST
+******************************************************************************************************/
+ViStatus RsCore_QueryAndParseOPTstring(ViSession instrSession, ViString simulationOPTstring, ViInt32 optionsParseMode)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar* optionsList = NULL;
+	ViInt32 length;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	// Query the *OPT?, parse it and store it into the RS_ATTR_OPTIONS_LIST
+	if (!RsCore_Simulating(instrSession) && rsSession->identity.validated == VI_TRUE)
+	{
+		// Known instrument, use the snapshot options
+		length = (ViInt32)strlen(rsSession->identity.options) + 1;
+		checkAlloc(optionsList = (ViChar *)RsCore_Malloc(instrSession, length));
+		memcpy(optionsList, rsSession->identity.options, length);
+	}
+	else if (!RsCore_Simulating(instrSession))
+	{
+		// Read the real *OPT? response
+		checkErr(RsCore_QueryViStringUnknownLength(instrSession, "*OPT?", &optionsList));
+
+		// Update the identity snapshot, the *IDN? response is already in it
+		if (strlen(optionsList) < RS_MAX_MESSAGE_BUF_SIZE)
+		{
+			RsCoreInt_StrcpyMaxLen(rsSession->identity.options, RS_MAX_MESSAGE_BUF_SIZE, optionsList);
+			rsSession->identity.valid = VI_TRUE;
+			checkErr(RsCoreInt_SaveIdentitySnapshot(rsSession));
+		}
+	}
+	else
+	{
+		// Use the simulationOPTstring value
+		checkAlloc(optionsList = (ViChar *)RsCore_Calloc(instrSession, strlen(simulationOPTstring) + 1, 1));
+		RsCoreInt_StrcpyMaxLen(optionsList, (ViInt32)strlen(simulationOPTstring) + 1, simulationOPTstring);
+	}
+
+	checkErr(RsCoreInt_ParseOptionsString(instrSession, optionsList, optionsParseMode));
+	checkErr(RsCore_SetAttributeViString(instrSession, NULL, RS_ATTR_OPTIONS_LIST, 0, optionsList));
+
+Error:
+	if (optionsList)
+		RsCore_Free(instrSession, optionsList);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_CheckInstrumentModel
+	Generates RS_ERROR_INSTRUMENT_MODEL error, if the current instrument does not fulfill the modelsList requirement.
+	If session's optionChecking is OFF, the function always returns VI_SUCCESS
+	- Example of a positive requirement: modelsList = 'FSW|FSWP': for VI_SUCCESS, the current instrument must be either FSW or FSWP
+	- Example of a negative requirement: modelsList = '!FSW|FSWP': for VI_SUCCESS, the current instrument must be neither FSW nor FSWP
+******************************************************************************************************/
+ViStatus RsCore_CheckInstrumentModel(ViSession instrSession, ViConstString modelsList)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (rsSession->optionChecking == VI_TRUE)
+	{
+		checkErr(RsCoreInt_CheckInstrumentModel(instrSession, modelsList, NULL, VI_TRUE));
+	}
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_IsInstrumentModel
+	Returns TRUE, if the current model fulfills the modelsList requirement.
+	The session's optionChecking status has no effect on this function
+	- Example of a positive requirement: modelsList = 'FSW|FSWP': for result TRUE, the current instrument must be either FSW or FSWP
+	- Example of a negative requirement: modelsList = '!FSW|FSWP': for result TRUE, the current instrument must be neither FSW nor FSWP
+******************************************************************************************************/
+ViBoolean RsCore_IsInstrumentModel(ViSession instrSession, ViConstString modelsList)
+{
+	ViBoolean pass;
+	
+	(void)RsCoreInt_CheckInstrumentModel(instrSession, modelsList, &pass, VI_FALSE);
+
+	return pass;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_CheckInstrumentOptions
+	Generates RS_ERROR_INSTRUMENT_OPTION error, if the current instrument does not have the required option(s) installed.
+	The optionsExpression is the same one as used in attributes.
+	If session's optionChecking is OFF, the function always returns VI_SUCCESS
+******************************************************************************************************/
+ViStatus RsCore_CheckInstrumentOptions(ViSession instrSession, ViConstString optionsExpression)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (rsSession->optionChecking == VI_TRUE)
+	{
+		checkErr(RsCoreInt_CheckInstrumentOptions(instrSession, optionsExpression, NULL, VI_TRUE));
+	}
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_HasInstrumentOptions
+	Returns TRUE, if the current instrument has the required option(s) installed.
+	The session's optionChecking status has no effect on this function
+	The optionsExpression is the same one as used in attributes.
+******************************************************************************************************/
+ViBoolean RsCore_HasInstrumentOptions(ViSession instrSession, ViConstString optionsExpression)
+{
+	ViBoolean pass;
+
+	(void)RsCoreInt_CheckInstrumentOptions(instrSession, optionsExpression, &pass, VI_FALSE);
+
+	return pass;
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Attributes - related functions ------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  RsCore_SetAttributeViReal64
+    Exported type-safe function for setting an attribute ViReal64 value
+******************************************************************************************************/
+ViStatus RsCore_SetAttributeViReal64(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViReal64 value)
+{
+	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_REAL64, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetAttributeViInt32
+    Exported type-safe function for setting an attribute ViInt32 value
+******************************************************************************************************/
+ViStatus RsCore_SetAttributeViInt32(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViInt32 value)
+{
+	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_INT32, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetAttributeViInt64
+    Exported type-safe function for setting an attribute ViInt64 value
+******************************************************************************************************/
+ViStatus RsCore_SetAttributeViInt64(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViInt64 value)
+{
+	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_INT64, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetAttributeViString
+    Exported type-safe function for setting an attribute ViString value
+******************************************************************************************************/
+#pragma warning( disable : 4090 )
+ViStatus RsCore_SetAttributeViString(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViConstString value)
+{
+	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_STRING, (void*)value);
+}
+#pragma warning( default : 4090 )
+
+/*****************************************************************************************************/
+/*  RsCore_SetAttributeViBoolean
+    Exported type-safe function for setting an attribute ViBoolean value
+******************************************************************************************************/
+ViStatus RsCore_SetAttributeViBoolean(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViBoolean value)
+{
+	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_BOOLEAN, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetAttributeViSession
+    Exported type-safe function for setting an attribute ViSession value
+******************************************************************************************************/
+ViStatus RsCore_SetAttributeViSession(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViSession value)
+{
+	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_SESSION, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetAttributeViAddress
+    Exported type-safe function for setting an attribute ViAddr value
+******************************************************************************************************/
+ViStatus RsCore_SetAttributeViAddress(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViAddr value)
+{
+	return RsCoreInt_SetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_ADDR, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeViReal64
+    Exported type-safe function for reading an attribute ViReal64 value
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeViReal64(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViReal64* value)
+{
+	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_REAL64, (ViInt32)sizeof(ViReal64), value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeViInt32
+    Exported type-safe function for reading an attribute ViInt32 value
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeViInt32(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViInt32* value)
+{
+	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_INT32, (ViInt32)sizeof(ViInt32), value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeViInt64
+    Exported type-safe function for reading an attribute ViInt64 value
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeViInt64(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViInt64* value)
+{
+	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_INT64, (ViInt32)sizeof(ViInt32), value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeViInt64
+    Exported type-safe function for reading an attribute ViInt64 value
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeViString(ViSession instrSession, ViString repCap,
+                                     ViUInt32 attributeId, ViInt32 optionFlag, ViInt32 bufferSize, ViChar* value)
+{
+	RsCoreSessionPtr rsSession = NULL;
+
+	if (attributeId == RS_ATTR_ERROR_ELABORATION && RsCore_GetRsSession(instrSession, &rsSession) == VI_SUCCESS)
+	{
+		// The attribute value is set when the pending error context is formatted
+		RsCoreInt_ResolveErrorContext(rsSession);
+	}
+
+	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_STRING, bufferSize, value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeViBoolean
+    Exported type-safe function for reading an attribute ViBoolean value
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeViBoolean(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViBoolean* value)
+{
+	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_BOOLEAN, (ViInt32)sizeof(ViBoolean), value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeViSession
+    Exported type-safe function for reading an attribute ViSession value
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeViSession(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViSession* value)
+{
+	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_SESSION, (ViInt32)sizeof(ViSession), value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeViAddress
+    Exported type-safe function for reading an attribute ViAddr value
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeViAddress(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViAddr* value)
+{
+	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_ADDR, (ViInt32)sizeof(ViAddr), value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_CheckAttributeViReal64
+    Exported type-safe function for checking a ViReal64 attribute
+******************************************************************************************************/
+ViStatus RsCore_CheckAttributeViReal64(ViSession instrSession,
+                                       ViString repCap,
+                                       ViUInt32 attributeId,
+                                       ViInt32 optionFlag,
+                                       ViReal64 value)
+{
+	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_CheckAttributeViInt32
+    Exported type-safe function for checking a ViInt32 attribute
+******************************************************************************************************/
+ViStatus RsCore_CheckAttributeViInt32(ViSession instrSession,
+                                      ViString repCap,
+                                      ViUInt32 attributeId,
+                                      ViInt32 optionFlag,
+                                      ViInt32 value)
+{
+	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_CheckAttributeViInt64
+    Exported type-safe function for checking a ViInt64 attribute
+******************************************************************************************************/
+ViStatus RsCore_CheckAttributeViInt64(ViSession instrSession,
+                                      ViString repCap,
+                                      ViUInt32 attributeId,
+                                      ViInt32 optionFlag,
+                                      ViInt64 value)
+{
+	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_CheckAttributeViString
+    Exported type-safe function for checking a ViString attribute
+******************************************************************************************************/
+#pragma warning( disable : 4090 )
+ViStatus RsCore_CheckAttributeViString(ViSession instrSession,
+                                       ViString repCap,
+                                       ViUInt32 attributeId,
+                                       ViInt32 optionFlag,
+                                       ViConstString value)
+{
+	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, (void*)value);
+}
+#pragma warning( default : 4090 )
+
+/*****************************************************************************************************/
+/*  RsCore_CheckAttributeViBoolean
+    Exported type-safe function for checking a ViBoolean attribute
+******************************************************************************************************/
+ViStatus RsCore_CheckAttributeViBoolean(ViSession instrSession,
+                                        ViString repCap,
+                                        ViUInt32 attributeId,
+                                        ViInt32 optionFlag,
+                                        ViBoolean value)
+{
+	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_CheckAttributeViSession
+    Exported type-safe function for checking a ViSession attribute
+******************************************************************************************************/
+ViStatus RsCore_CheckAttributeViSession(ViSession instrSession,
+                                        ViString repCap,
+                                        ViUInt32 attributeId,
+                                        ViInt32 optionFlag,
+                                        ViSession value)
+{
+	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_CheckAttributeViAddress
+    Exported type-safe function for checking a ViAddress attribute
+******************************************************************************************************/
+ViStatus RsCore_CheckAttributeViAddress(ViSession instrSession,
+                                        ViString repCap,
+                                        ViUInt32 attributeId,
+                                        ViInt32 optionFlag,
+                                        ViAddr value)
+{
+	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeFlags
+    Obtains the current values of the flags for the attribute you specify.
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeFlags(ViSession instrSession,
+                                  ViAttr attributeId,
+                                  RsCoreAttrFlags* flags)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreAttributePtr attr;
+
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, attributeId, &attr));
+
+	*flags = attr->flags;
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetAttributeFlags
+    Sets the flags of an attribute to new values. It always sets all of the flags.
+    If you want to change one flag, use RsCore_GetAttributeFlags to obtain the current values of all
+    the flags, modify the bit for the flag you want to change, and then call RsCore_SetAttributeFlags.
+    You cannot modify the value of the RS_VAL_MULTI_CHANNEL flag.
+******************************************************************************************************/
+ViStatus RsCore_SetAttributeFlags(ViSession instrSession,
+                                  ViAttr attributeId,
+                                  RsCoreAttrFlags flags)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreAttributePtr attr;
+
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, attributeId, &attr));
+
+	attr->flags &= RS_VAL_MULTI_CHANNEL;
+	attr->flags |= (flags & (~RS_VAL_MULTI_CHANNEL));
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetAttributeP2Value
+    Internal function that sets the cache value of the entered attribute
+******************************************************************************************************/
+ViStatus RsCore_SetAttributeP2Value(ViSession instrSession, RsCoreAttributePtr attr, void* value)
+{
+	ViStatus error = VI_SUCCESS;
+
+	switch (attr->dataType)
+	{
+	case RS_VAL_INT32:
+		*(ViInt32 *)attr->p2value = (value) ? *(ViInt32 *)value : 0;
+		break;
+	case RS_VAL_INT64:
+		*(ViInt64 *)attr->p2value = (value) ? *(ViInt64 *)value : 0;
+		break;
+	case RS_VAL_REAL64:
+		*(ViReal64 *)attr->p2value = (value) ? *(ViReal64 *)value : 0;
+		break;
+	case RS_VAL_STRING:
+		{
+			ViChar* newString = (ViString)value;
+			ViInt32 reqBuffer = (ViInt32)strlen(newString) + 1;
+			// If the currently allocated buffer is too small, reallocate it
+			if (reqBuffer > attr->integerDefault)
+			{
+				ViChar* oldP2value = (ViChar *)attr->p2value;
+				if ((attr->p2value = RsCore_Realloc(instrSession, attr->p2value, reqBuffer)) == NULL)
+				{
+					RsCore_Free(instrSession, oldP2value);
+					return RS_ERROR_ALLOC;
+				}
+
+				attr->integerDefault = reqBuffer;
+			}
+
+			RsCoreInt_StrcpyMaxLen((ViChar *)attr->p2value, attr->integerDefault, newString);
+			break;
+		}
+	case RS_VAL_ADDR:
+		*(ViAddr *)attr->p2value = (value) ? *(ViAddr *)value : 0;
+		break;
+	case RS_VAL_SESSION:
+		*(ViSession *)attr->p2value = (value) ? *(ViSession *)value : 0;
+		break;
+	case RS_VAL_BOOLEAN:
+		*(ViBoolean *)attr->p2value = (value) ? *(ViBoolean *)value : 0;
+		break;
+	case RS_VAL_EVENT:
+		break;
+	case RS_VAL_UNKNOWN_TYPE:
+	default:
+		error = RsCore_GenerateInvalidDataTypeError(instrSession, attr->dataType, "RsCore_SetAttributeP2Value");
+	}
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_WriteAttributeDefault
+    Writes the default value to the already allocated current value of the attribute
+******************************************************************************************************/
+void RsCoreInt_WriteAttributeDefault(RsCoreAttributePtr attr)
+{
+	size_t offset = 0;
+	size_t dataSize = 0;
+	void *p2value, *p2default;
+
+	p2value = attr->p2value;
+	switch (attr->dataType)
+	{
+	case RS_VAL_INT32:
+		dataSize = sizeof(ViInt32);
+		p2default = &attr->integerDefault;
+		break;
+	case RS_VAL_INT64:
+		dataSize = sizeof(ViInt32);
+		p2default = &attr->integerDefault;
+		offset = sizeof(ViInt64) - dataSize;
+		break;
+	case RS_VAL_REAL64:
+		dataSize = sizeof(ViReal64);
+		p2default = &attr->doubleDefault;
+		break;
+	case RS_VAL_STRING:
+		if (attr->stringDefault)
+			dataSize = strlen(attr->stringDefault);
+		else
+			dataSize = 0;
+		p2default = attr->stringDefault;
+		break;
+	case RS_VAL_ADDR:
+		dataSize = sizeof(ViAddr);
+		p2default = &attr->integerDefault;
+		break;
+	case RS_VAL_SESSION:
+		dataSize = sizeof(ViSession);
+		p2default = &attr->sessionDefault;
+		break;
+	case RS_VAL_BOOLEAN:
+		dataSize = sizeof(ViBoolean);
+		p2default = &attr->booleanDefault;
+		break;
+	default:
+		dataSize = sizeof(void *);
+		p2default = &attr->p2value;
+	}
+
+	if (attr->dataType == RS_VAL_STRING)
+	{
+		if (p2default)
+			RsCoreInt_StrcpyMaxLen((ViChar*)p2value, attr->integerDefault, (ViConstString)p2default);
+		else
+			RsCoreInt_StrcpyMaxLen((ViChar*)p2value, attr->integerDefault, "");
+	}
+	else
+	{
+		memset(p2value, 0, dataSize + offset);
+		memcpy(((char*)p2value) + offset, p2default, dataSize);
+	}
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ApplyAttributeDefaults
+    Applies default attribute values. Optionally exclude inherent attributes from update.
+    Only the attributes accessed so far are written, the others get their default values on the first access.
+******************************************************************************************************/
+ViStatus RsCore_ApplyAttributeDefaults(ViSession instrSession, ViBoolean updateInherentAttr)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 idx = 0;
+	RsCoreAttributePtr attr;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	for (idx = 0; idx < rsSession->attributesCount; idx++)
+	{
+		attr = &rsSession->attributes[idx];
+
+		/* Update inherent attributes? */
+		if ((updateInherentAttr == VI_FALSE) && (attr->constant < RS_SPECIFIC_PRIVATE_ATTR_BASE))
+		{
+			/* Inherent attributes are not updated */
+		}
+		else if (attr->p2value != NULL)
+		{
+			RsCoreInt_WriteAttributeDefault(attr);
+		}
+	}
+
+	rsSession->specificDefaultsApplied = VI_TRUE;
+	if (updateInherentAttr == VI_TRUE)
+		rsSession->inherentDefaultsApplied = VI_TRUE;
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ApplyAttributeSettings
+    Stores the session-level attribute values in one step, e.g. the driver identification.
+    The values are written directly to the attribute cache, without callbacks, range checks or instrument IO.
+    The settings array ends with the attributeId 0. Only INT32, INT64, BOOLEAN and STRING attributes are supported.
+******************************************************************************************************/
+ViStatus RsCore_ApplyAttributeSettings(ViSession instrSession, const RsCoreAttributeSetting settings[])
+{
+	ViStatus error = VI_SUCCESS;
+	const RsCoreAttributeSetting* setting;
+	RsCoreAttributePtr attr;
+	ViInt64 int64Value;
+	ViBoolean booleanValue;
+
+	for (setting = settings; setting->attributeId != 0; setting++)
+	{
+		checkErr(RsCoreInt_GetAttributePtr(instrSession, setting->attributeId, &attr));
+		switch (attr->dataType)
+		{
+		case RS_VAL_INT32:
+			checkErr(RsCore_SetAttributeP2Value(instrSession, attr, (void*)&setting->integerValue));
+			break;
+		case RS_VAL_INT64:
+			int64Value = (ViInt64)setting->integerValue;
+			checkErr(RsCore_SetAttributeP2Value(instrSession, attr, &int64Value));
+			break;
+		case RS_VAL_BOOLEAN:
+			booleanValue = (setting->integerValue != 0) ? VI_TRUE : VI_FALSE;
+			checkErr(RsCore_SetAttributeP2Value(instrSession, attr, &booleanValue));
+			break;
+		case RS_VAL_STRING:
+			checkErr(RsCore_SetAttributeP2Value(instrSession, attr, (void*)setting->stringValue));
+			break;
+		default:
+			checkErr(RsCore_GenerateInvalidDataTypeError(instrSession, attr->dataType, "Applying the attribute settings"));
+		}
+	}
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_BuildAttrCommandString
+    Build the attribute's command - replaces its RepCapID parts with the corresponding command values
+	The cmd is always at least RS_MAX_MESSAGE_BUF_SIZE big
+    WARNING!!!: cmd is allocated dynamically in the function. Deallocate it afterwards!
+******************************************************************************************************/
+ViStatus RsCore_BuildAttrCommandString(ViSession instrSession, RsCoreAttributePtr attr, ViConstString repCapsInputString, ViChar** cmd)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar repCapCmd[RS_MAX_MESSAGE_LEN];
+	ViChar singleInputRepCap[RS_MAX_MESSAGE_LEN];
+	ViChar singleRepCapNameId[RS_MAX_MESSAGE_BUF_SIZE] = "";
+	ViInt32 index, i, inputRepCapsCount;
+	ViInt32 foundIdx = 0;
+	ViInt32 cmdActualLen = (ViInt32)strlen(attr->command);
+	ViInt32 cmdBufferSize;
+	ViInt32 restLen, repCapIdLen, cmdValueLen, startOffset, resizeOffset;
+	ViChar *p2SearchStart, *p2LeftBracket, *p2RightBracket, *target, *source;
+	RsCoreRepCapPtr repCap;
+
+	if (isNullOrEmpty(repCapsInputString))
+	{
+		inputRepCapsCount = 0;
+	}
+	else
+	{
+		inputRepCapsCount = RsCore_GetElementsCount(repCapsInputString, ',');
+	}
+
+	cmdBufferSize = cmdActualLen + 1;
+	if (cmdBufferSize < RS_MAX_SHORT_MESSAGE_BUF_SIZE)
+		cmdBufferSize = RS_MAX_SHORT_MESSAGE_BUF_SIZE;
+
+	viCheckAllocElab(*cmd = (ViChar*)RsCore_Malloc(instrSession, cmdBufferSize), "Rs_BuildAttrCommandString command malloc");
+
+	RsCoreInt_StrcpyMaxLen(*cmd, cmdBufferSize, attr->command);
+	cmdActualLen = (ViInt32)strlen(*cmd);
+	if (attr->usercaps == VI_TRUE)
+	{
+		/* Repeated Capabilities */
+		for (index = 0; index < RSCORE_MAX_ATTR_RCAPS; index++)
+		{
+			// Scan repCap from command e.g. 'CAL{Channel}:ZERO{Sensor}:AUTO',
+			// we need the 'Channel' part, in the second iteration then 'Sensor' part
+			p2SearchStart = *cmd;
+			restLen = cmdActualLen;
+			if ((p2LeftBracket = (ViChar *)memchr(p2SearchStart, '{', restLen)) == NULL) break;
+			startOffset = (ViInt32)(p2LeftBracket - p2SearchStart);
+			restLen -= startOffset;
+			if ((p2RightBracket = (ViChar *)memchr(p2LeftBracket, '}', restLen)) == NULL) break;
+			repCapIdLen = (ViInt32)(p2RightBracket - p2LeftBracket) - 1;
+			restLen -= repCapIdLen + 2;
+			memcpy(singleRepCapNameId, p2LeftBracket + 1, repCapIdLen);
+			singleRepCapNameId[repCapIdLen] = 0;
+
+			// singleRepCapNameId now contains 'Channel', repCapNames is a string 'CH0,CH1,CH2,CH3,CH4'
+			checkErr(RsCoreInt_FindRepCap(instrSession, NULL, singleRepCapNameId, &repCap));
+
+			// Go through the repCapNames string items and search them in the entered repCapsInputString
+			if (inputRepCapsCount == 0)
+			{
+				// If the repCapsInputString is empty, take the 1st one
+				checkErr(RsCoreInt_GetRepCapCmdAtIndex(instrSession, repCap, 0, RS_MAX_MESSAGE_LEN, repCapCmd, NULL));
+			}
+			else
+			{
+				// inputRepCapsCount are not empty, go through its tokens
+				for (i = 0; i < inputRepCapsCount; i++)
+				{
+					checkErr(RsCore_GetTokenAtIndex(repCapsInputString, ',', i, singleInputRepCap, RS_MAX_MESSAGE_LEN, NULL));
+					checkErr(RsCoreInt_FindRepCapName(instrSession, repCap, singleInputRepCap, VI_FALSE, &foundIdx, NULL));
+					if (foundIdx >= 0)
+					{
+						break;
+					}
+				}
+
+				if (foundIdx < 0)
+					foundIdx = 0; // If none of the repCapsInputString tokens contains the singleInputRepCap, take the 1st one
+
+				checkErr(RsCoreInt_GetRepCapCmdAtIndex(instrSession, repCap, foundIdx, RS_MAX_MESSAGE_LEN, repCapCmd, NULL));
+			}
+
+			// Here, we have the valid command value in repCapCmd
+			cmdValueLen = (ViInt32)strlen(repCapCmd);
+			resizeOffset = cmdValueLen - (repCapIdLen + 2); // negative resizeOffset means the *cmd length shrinks
+
+			if (resizeOffset > 0)
+			{
+				if ((cmdActualLen + resizeOffset) >= cmdBufferSize)
+				{
+					// need to reallocate the *cmd to a bigger buffer
+					cmdBufferSize += resizeOffset + 10;
+					viCheckReallocElab(*cmd, (ViChar*)RsCore_Realloc(instrSession, *cmd, cmdBufferSize), "Memory reallocation for attribute command");
+				}
+			}
+
+			if (restLen > 0)
+			{
+				// Part after the right bracket is non-empty, move it
+				target = p2LeftBracket + cmdValueLen;
+				source = p2RightBracket + 1;
+				memmove(target, source, restLen + 1); // including '\0'
+				memcpy(p2LeftBracket, repCapCmd, cmdValueLen);
+			}
+			else
+			{
+				// No other characters in the command
+				// Copy the command value, terminate the string and break
+				memcpy(p2LeftBracket, repCapCmd, cmdValueLen + 1); // including '\0'
+				break;
+			}
+
+			cmdActualLen = (ViInt32)strlen(*cmd);
+		} /* EOF RepCaps for loop */
+	}
+	else
+	{
+		RsCoreInt_StrcpyMaxLen(*cmd, cmdActualLen + 1, attr->command);
+	}
+
+Error:
+	return error;
+}
+
+/****************************************************************************/
+/*  RsCore_WriteAttributeCommand
+    Writes attribute command to instrument. Takes into account the following attribute flags:
+    RS_VAL_WAIT_FOR_OPC_AFTER_WRITES
+    RS_VAL_WAIT_TO_CONTINUE
+  *****************************************************************************/
+ViStatus RsCore_WriteAttributeCommand(ViSession instrSession, RsCoreAttributePtr attr, ViConstString command)
+{
+	ViStatus error = VI_SUCCESS;
+
+	if (attrHasFlag(RS_VAL_WAIT_FOR_OPC_AFTER_WRITES))
+	{
+		return RsCoreInt_WriteWithOpc(instrSession, command, VI_FALSE, 0);
+	}
+	else if (attrHasFlag(RS_VAL_WAIT_TO_CONTINUE))
+	{
+		checkErr(RsCore_Write(instrSession, command));
+		checkErr(RsCore_Write(instrSession, "*WAI"));
+	}
+	else
+	{
+		// Standard write
+		return RsCore_Write(instrSession, command);
+	}
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryAttributeCommand
+    Queries attribute command from the instrument.
+    The response length is limited to RS_MAX_MESSAGE_BUF_SIZE
+    The response is trimmed for the trailing LF
+    The function takes into account RS_VAL_WAIT_FOR_OPC_AFTER_WRITES and adds the question-mark "?" to the query
+    if not already present. For unlimited response lengths use the RsCore_QueryAttributeCommandUnknownLength()
+ *****************************************************************************/
+ViStatus RsCore_QueryAttributeCommand(ViSession instrSession, RsCoreAttributePtr attr, ViConstString query, ViChar* response)
+{
+	return RsCoreInt_QueryAttrCommandUni(instrSession, attr, query, VI_FALSE, &response, NULL);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryAttributeCommandUnknownLength
+    Queries attribute command from the instrument.
+    The response length is unlimited.
+    The response is trimmed for the trailing LF
+    The function takes into account RS_VAL_WAIT_FOR_OPC_AFTER_WRITES and adds the question-mark "?" to the query
+    if not already present.
+    WARNING!!! De-allocated the response buffer afterwards
+******************************************************************************************************/
+
+ViStatus RsCore_QueryAttributeCommandUnknownLength(ViSession instrSession, RsCoreAttributePtr attr,
+                                                   ViConstString query, ViChar** response, ViInt32* byteCount)
+{
+	return RsCoreInt_QueryAttrCommandUni(instrSession, attr, query, VI_TRUE, response, byteCount);
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Repeated Capabilities ---------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+
+/*****************************************************************************************************/
+/*  RsCore_BuildRepCapTable
+    Creates a unique repeated capability table for the session. A repeated capability table
+    consists of a name that identifies the repeated capability, the identifier strings and command
+    values that are valid for the instrument session.Calling  this function more than once
+    for the same repeated capability will return the RS_ERROR_REPEATED_CAPABILITY_ALREADY_EXISTS error.
+    The RS Library maintains the repeated capability table for the session.
+******************************************************************************************************/
+ViStatus RsCore_BuildRepCapTable(ViSession instrSession, RsCoreRepCapPtr repCapTable)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 numberOfRepCaps = 0;
+	size_t table_size = 0;
+	ViInt32 i = 0;
+	ViInt32 bufferSize;
+	RsCoreAttributePtr attr;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (rsSession->repCapTables)
+	{
+		/* If the session is not being reused (new session created regardless if the same one already exists),
+		the rsSession->repCapTable field shall not be initialized */
+		if (rsSession->reuseSession == VI_FALSE)
+		{
+			viCheckErr(RS_ERROR_REPEATED_CAPABILITY_ALREADY_EXISTS);
+		}
+
+		/* If the session is not being duplicated (already existing session is being reused)
+		the rsSession->repCapTable field may already be initialized
+		In that case, dispose of it in order to reset the RepCap Table */
+		checkErr(RsCoreInt_DisposeRepCapTable(instrSession));
+	}
+
+	/* Determine number of repeated capabilities */
+	for (numberOfRepCaps = 0; repCapTable[numberOfRepCaps].repCapNameId; numberOfRepCaps++);
+
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_CHANNEL_COUNT, &attr));
+	rsSession->repCapsCount = numberOfRepCaps;
+	*(ViInt32*)attr->p2value = numberOfRepCaps;
+
+	/* Allocate memory for session based repeated capabilities */
+	table_size = (size_t)(numberOfRepCaps * sizeof(repCapTable[0]));
+	checkAlloc(rsSession->repCapTables = (RsCoreRepCapPtr)RsCore_Malloc(instrSession, table_size));
+	for (i = 0; i < numberOfRepCaps; i++)
+	{
+		bufferSize = (ViInt32)strlen(repCapTable[i].repCapNameId) + 1;
+		checkAlloc(rsSession->repCapTables[i].repCapNameId = (ViChar*)RsCore_Malloc(instrSession, bufferSize));
+		RsCoreInt_StrcpyMaxLen(rsSession->repCapTables[i].repCapNameId, bufferSize, repCapTable[i].repCapNameId);
+
+		bufferSize = (ViInt32)strlen(repCapTable[i].repCapNames) + 1;
+		checkAlloc(rsSession->repCapTables[i].repCapNames = (ViChar*)RsCore_Malloc(instrSession, bufferSize));
+		RsCoreInt_StrcpyMaxLen(rsSession->repCapTables[i].repCapNames, bufferSize, repCapTable[i].repCapNames);
+
+		bufferSize = (ViInt32)strlen(repCapTable[i].cmdValues) + 1;
+		checkAlloc(rsSession->repCapTables[i].cmdValues = (ViChar*)RsCore_Malloc(instrSession, bufferSize));
+		RsCoreInt_StrcpyMaxLen(rsSession->repCapTables[i].cmdValues, bufferSize, repCapTable[i].cmdValues);
+	}
+
+Error:
+	return error;
+}
+
+/******************************************************************************************************
+* Function: RsCore_ResetRepCapTable
+* Purpose:  This function removes all existing repeated capabilities and
+*           creates the table again with default values
+*
+******************************************************************************************************/
+ViStatus RsCore_ResetRepCapTable(ViSession instrSession, RsCoreRepCapPtr repCapTable)
+{
+	ViStatus error = VI_SUCCESS;
+
+	checkErr(RsCoreInt_DisposeRepCapTable(instrSession));
+	checkErr(RsCore_BuildRepCapTable(instrSession, repCapTable));
+
+Error:
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeRepCapName
+    Function used by Hi-level functions to obtain a repCap name from:
+    - attributeID
+    - repCapNameID
+    - 0-based index in the repCapNames
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeRepCapName(ViSession instrSession,
+                                       ViUInt32 attributeId,
+                                       ViString repCapNameId,
+                                       ViInt32 index,
+                                       ViInt32 bufferSize,
+                                       ViChar* repCapName)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreAttributePtr attr;
+	RsCoreRepCapPtr repCap;
+
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, attributeId, &attr));
+	checkErr(RsCoreInt_FindRepCap(instrSession, NULL, repCapNameId, &repCap));
+	checkErr(RsCoreInt_ValidateAttrForRepCap(instrSession, repCap, attr));
+	checkErr(RsCoreInt_GetRepCapNameAtIndex(instrSession, repCap, index, bufferSize, repCapName, NULL));
+
+Error:
+	switch (error)
+	{
+	case RS_ERROR_INVALID_ATTRIBUTE:
+		(void)RsCore_SetErrorContext(instrSession, VI_FALSE, error, VI_FALSE, attributeId, "The attribute is invalid", 0, 0, 0);
+		break;
+	case RS_ERROR_ATTRIBUTE_NOT_SUPPORTED:
+		(void)RsCore_SetErrorContext(instrSession, VI_FALSE, error, VI_FALSE, attributeId, "The attribute is not supported", 0, 0, 0);
+		break;
+	default:
+		break;
+	}
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeRepCapNameIds
+	Returns the repeated capability IDs that belongs to the attribute you specify.
+	More then one id is listed in comma separated string.
+	Example: Attr command: 'SENS{Channel}:TGAT{Timegate}:TIME'
+	Returned repCapNameIds:  'Channel,Timegate'
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeRepCapNameIds(ViSession instrSession, ViUInt32 attributeId, ViInt32 bufferSize, ViChar* repCapNameIds)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreAttributePtr attr = NULL;
+
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, attributeId, &attr));
+	checkErr(RsCoreInt_GetAttrRepCapNameIds(instrSession, attr, bufferSize, repCapNameIds));
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_GetAttributeRepCapNamesAll
+	Returns all the repCapNames defined for the entered repCapNameId
+	More then one name is listed in comma separated string.
+	Example: Attr command: 'SENS{Channel}:TGAT{Timegate}:TIME'
+	Entered repCapNameId = 'Channel'
+	Returned repCapNames:  'CH0,CH1,CH2,CH3,CH4'
+******************************************************************************************************/
+ViStatus RsCore_GetAttributeRepCapNamesAll(ViSession instrSession, ViUInt32 attributeId, ViConstString repCapNameId, ViInt32 bufferSize,
+                                           ViChar* repCapNames)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreAttributePtr attr = NULL;
+	RsCoreRepCapPtr repCap;
+
+	checkErr(RsCoreInt_GetAttributePtr(instrSession, attributeId, &attr));
+	checkErr(RsCoreInt_FindRepCap(instrSession, NULL, repCapNameId, &repCap));
+	checkErr(RsCoreInt_ValidateAttrForRepCap(instrSession, repCap, attr));
+	RsCoreInt_StrcpyMaxLen(repCapNames, bufferSize, repCap->repCapNames);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_AddRepCap
+    Adds a new dynamic repCapName to the specified repCapNameId.
+    If the repCapName already exists, the function ends with no changes and no error
+******************************************************************************************************/
+ViStatus RsCore_AddRepCap(ViSession instrSession,
+                          ViString repCapNameId,
+                          ViString repCapName,
+                          ViString cmdValue)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 namesBufferSize, cmdsBufferSize;
+	RsCoreRepCapPtr repCap;
+	ViInt32 foundIdx;
+
+	if (isNullOrEmpty(repCapName))
+	{
+		viCheckErrElab(RS_ERROR_NULL_POINTER, "Rs_AddRepCap: repCapName is NULL or empty");
+	}
+
+	if (cmdValue == NULL)
+	{
+		viCheckErrElab(RS_ERROR_NULL_POINTER, "Rs_AddRepCap: cmdValue is NULL");
+	}
+
+	checkErr(RsCoreInt_FindRepCap(instrSession, NULL, repCapNameId, &repCap));
+	checkErr(RsCoreInt_FindRepCapName(instrSession, repCap, repCapName, VI_FALSE, &foundIdx, NULL));
+
+	if (foundIdx >= 0)
+	{
+		// RepCapName already exists, end the function
+		goto Error;
+	}
+
+	// RepCapNames expansion
+	namesBufferSize = (ViInt32)strlen(repCap->repCapNames) + (ViInt32)strlen(repCapName) + 2;
+	viCheckReallocElab(repCap->repCapNames, (ViChar*)RsCore_Realloc(instrSession, repCap->repCapNames, namesBufferSize), "Rs_AddRepCap: allocated space for repCapName");
+
+	// RepCapCmdValues expansion
+	cmdsBufferSize = (ViInt32)strlen(repCap->cmdValues) + (ViInt32)strlen(cmdValue) + 2;
+	viCheckReallocElab(repCap->cmdValues, (ViChar*)RsCore_Realloc(instrSession, repCap->cmdValues, cmdsBufferSize), "Rs_AddRepCap: allocated space for cmdValues");
+
+	RsCore_AppendToCsvString(repCap->repCapNames, ",", namesBufferSize, repCapName);
+	RsCore_AppendToCsvString(repCap->cmdValues, ",", cmdsBufferSize, cmdValue);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_RemoveRepCap
+    Removes existing dynamic repeated capability.
+******************************************************************************************************/
+ViStatus RsCore_RemoveRepCap(ViSession instrSession,
+                             ViString repCapNameId,
+                             ViString repCapName)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 repCapNameLen, repCapCmdLen;
+	ViInt32 foundIdx;
+	ViInt32 startOffsetName, startOffsetCmd;
+	ViChar *target = NULL, *source = NULL;
+	ViInt32 rcCount;
+	ViChar cmdValue[RS_MAX_MESSAGE_LEN] = "";
+	RsCoreRepCapPtr repCap;
+
+	if (isNullOrEmpty(repCapName))
+	{
+		viCheckErrElab(RS_ERROR_NULL_POINTER, "RemoveRepCap: repCapName is NULL or empty");
+	}
+
+	checkErr(RsCoreInt_FindRepCap(instrSession, NULL, repCapNameId, &repCap));
+	checkErr(RsCoreInt_FindRepCapName(instrSession, repCap, repCapName, VI_TRUE, &foundIdx, &startOffsetName));
+	checkErr(RsCoreInt_GetRepCapCmdAtIndex(instrSession, repCap, foundIdx, RS_MAX_MESSAGE_LEN, cmdValue, &startOffsetCmd));
+	checkErr(RsCoreInt_GetRepCapCount(instrSession, repCap, &rcCount));
+
+	repCapNameLen = (ViInt32)strlen(repCapName);
+	repCapCmdLen = (ViInt32)strlen(cmdValue);
+
+	if (rcCount == 1)
+	{
+		// Remove the last remaining repCap
+		repCap->repCapNames[0] = 0;
+		repCap->cmdValues[0] = 0;
+	}
+	else if (foundIdx == (ViInt32)rcCount - 1)
+	{
+		// RepCapName is at the last position, fill startOffset with zeroes
+		memset(repCap->repCapNames + startOffsetName - 1, 0, (size_t)(repCapNameLen + 2));
+		memset(repCap->cmdValues + startOffsetCmd - 1, 0, (size_t)(repCapCmdLen + 2));
+	}
+	else
+	{
+		// Somewhere 0..n-1, but not the last one. Move the rest after it to its place.
+		target = repCap->repCapNames + startOffsetName;
+		source = target + repCapNameLen + 1;
+		memmove(target, source, strlen(source) + 1);
+
+		target = repCap->cmdValues + startOffsetCmd;
+		source = target + repCapCmdLen + 1;
+		memmove(target, source, strlen(source) + 1);
+	}
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ResetRepCapID
+    Sets selected repeated capability to it default value
+    You have to provide the complete list of the default Repeated Capabilities Table
+******************************************************************************************************/
+ViStatus RsCore_ResetRepCapID(ViSession instrSession,
+                              ViString repCapNameId, RsCoreRepCapPtr repCapTable)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreRepCapPtr defaultRepCap = NULL;
+	RsCoreRepCapPtr repCap = NULL;
+	ViInt32 bufferSize;
+
+	checkErr(RsCoreInt_FindRepCap(instrSession, repCapTable, repCapNameId, &defaultRepCap));
+	checkErr(RsCoreInt_FindRepCap(instrSession, NULL, repCapNameId, &repCap));
+
+	if (repCap->repCapNames)
+		RsCore_Free(instrSession, repCap->repCapNames);
+
+	if (repCap->cmdValues)
+		RsCore_Free(instrSession, repCap->cmdValues);
+
+	bufferSize = (ViInt32)strlen(defaultRepCap->repCapNames) + 1;
+	viCheckAllocElab(repCap->repCapNames = (ViChar*)RsCore_Malloc(instrSession, bufferSize), "Allocation of buffer for default RepCapNames");
+	RsCoreInt_StrcpyMaxLen(repCap->repCapNames, bufferSize, defaultRepCap->repCapNames);
+
+	bufferSize = (ViInt32)strlen(defaultRepCap->cmdValues) + 1;
+	viCheckAllocElab(repCap->cmdValues = (ViChar*)RsCore_Malloc(instrSession, bufferSize), "Allocation of buffer for default RepCapCmdValues");
+	RsCoreInt_StrcpyMaxLen(repCap->cmdValues, bufferSize, defaultRepCap->cmdValues);
+
+Error:
+	return error;
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Range Tables ------------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  RsCore_FindDiscreteRangeTableNumericValue
+    Finds the entered cmdString in the discrete range table and returns the corresponding numericValue
+    If the cmdString is not found, the function returns RS_ERROR_INVALID_VALUE
+    Based on if rsSession->recogniseLongResponses:
+    If FALSE, the cmdString must be exactly equal to the rangeTable value, e.g. cmdString = 'ENABLED', rangeTable.cmdString = 'ENABLED'
+    If TRUE, the cmdString can be a longer version of the rangeTable value, e.g. cmdString = 'ENABLED', rangeTable.cmdString = 'ENAB'
+******************************************************************************************************/
+ViStatus RsCore_FindDiscreteRangeTableNumericValue(ViSession instrSession, RsCoreRangeTablePtr rangeTable,
+                                                   ViConstString cmdString, ViReal64* numericValue)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 i = 0;
+	ViInt32 foundIdx = -1;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	// Go over range table values and check if the command string is present
+	while (rangeTable->rangeValues[i].cmdValue != RS_RANGE_TABLE_END_VALUE && i < 99999)
+	{
+		if (rsSession->recogniseLongResponses)
+		{
+			if (strncmp(rangeTable->rangeValues[i].cmdString, cmdString, strlen(rangeTable->rangeValues[i].cmdString)) == 0)
+			{
+				foundIdx = i;
+				break;
+			}
+		}
+		else
+		{
+			if (strcmp(rangeTable->rangeValues[i].cmdString, cmdString) == 0)
+			{
+				foundIdx = i;
+				break;
+			}
+		}
+
+		i++;
+	}
+	if (i >= 99999)
+	{
+		viCheckErrElab(RS_ERROR_INVALID_RANGE_TABLE, "RsCore_FindDiscreteRangeTableNumericValue: The Range table has improper ending");
+	}
+
+	if (foundIdx == -1)
+	{
+		*numericValue = INFINITY;
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Cannot find the instrument response '%s' in the list of recognized values: ", cmdString);
+		// Compose list of the range table cmd Values
+		RsCoreInt_AppendDiscreteRangeTableList(rangeTable, RS_VAL_STRING, RS_MAX_MESSAGE_BUF_SIZE, errElab);
+		viCheckErrElab(RS_ERROR_INVALID_VALUE, errElab);
+	}
+	else
+	{
+		*numericValue = rangeTable->rangeValues[foundIdx].discreteOrMinValue;
+	}
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_FindRangeTableCmdStringViReal64
+	Finds the numericValue in the range table and returns the corresponding command string
+	If the value is not found, the function returns RS_ERROR_INVALID_VALUE
+	Precision for dataType RS_VAL_INT32 is coerced to DBL_MIN
+	Warning!!! The function returns the pointer to the actual cmd value in the range table,
+	do not modify the value
+******************************************************************************************************/
+ViStatus RsCore_FindRangeTableCmdStringViReal64(ViSession instrSession, RsCoreRangeTablePtr rangeTable, ViReal64 rangeTableValue,
+                                                ViReal64 precision, ViChar** p2cmdString)
+{
+	return RsCoreInt_FindDiscreteRangeTableCmdString(instrSession, rangeTable, RS_VAL_REAL64, rangeTableValue, precision, p2cmdString);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_FindRangeTableCmdString
+	Finds the numericValue in the range table and returns the corresponding command string
+	If the value is not found, the function returns RS_ERROR_INVALID_VALUE
+	Warning!!! The function returns the pointer to the actual cmd value in the range table,
+	do not modify the value
+******************************************************************************************************/
+ViStatus RsCore_FindRangeTableCmdString(ViSession instrSession, RsCoreRangeTablePtr rangeTable, ViInt32 rangeTableValue, ViChar** p2cmdString)
+{
+	return RsCoreInt_FindDiscreteRangeTableCmdString(instrSession, rangeTable, RS_VAL_INT32, rangeTableValue, DBL_MIN, p2cmdString);
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Instrument ASCII IO -----------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  RsCore_Write
+    Writes command string to the instrument. The command length is unlimited.
+    For non-VXI-11 sessions, it assures that the command is terminated with LF (rsSession->assureWriteWithLF)
+    Note! Do not use for writing binary data blocks. For that purpose use RsCore_WriteBinaryDataBlock... functions
+******************************************************************************************************/
+ViStatus RsCore_Write(ViSession instrSession, ViConstString writeBuffer)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 cmdLen;
+	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE];
+	const ViInt32 cmdMaxLen = RS_MAX_SHORT_MESSAGE_BUF_SIZE - 4;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (RsCore_Simulating(instrSession))
+		goto Error;
+
+	if (writeBuffer == NULL)
+		return RS_ERROR_INVALID_VALUE;
+
+	cmdLen = (ViInt32)strlen(writeBuffer);
+	if (cmdLen == 0)
+		return RS_ERROR_INVALID_VALUE;
+
+	if (rsSession->writeDelay)
+		Sleep(rsSession->writeDelay);
+
+	if (rsSession->assureWriteWithLF && writeBuffer[cmdLen - 1] != '\n')
+	{
+		// For commands, up to 4092 bytes - RS_MAX_SHORT_MESSAGE_BUF_SIZE
+		if (cmdLen < cmdMaxLen)
+		{
+			RsCoreInt_StrcpyMaxLen(buffer, cmdMaxLen, writeBuffer);
+			buffer[cmdLen] = '\n';
+			buffer[cmdLen + 1] = 0;
+			return RsCoreInt_IoWrite(instrSession, (ViBuf)buffer, cmdLen + 1, NULL);
+		}
+		else
+		{
+			// Long commands, send the LF as the 2nd segment
+			RsCoreIoSegment segments[2];
+			segments[0].data = (ViConstBuf)writeBuffer;
+			segments[0].count = (ViUInt32)cmdLen;
+			segments[1].data = (ViConstBuf)"\n";
+			segments[1].count = 1;
+			checkErr(RsCoreInt_IoWriteSegments(instrSession, segments, 2, NULL));
+		}
+	}
+	else
+	{
+		// Write the string as is
+		return RsCoreInt_IoWrite(instrSession, (ViBuf)writeBuffer, cmdLen, NULL);
+	}
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_WriteWithOpc
+    Writes an OPC-synchronized command to the instrument.
+    Set the parameter timeoutMs to 0 in order to use the session's OPC timeout.
+    Because of the order of commands, this function also calls the driver's CheckStatus callback.
+    If you use this function, do not call the CheckStatus function anymore
+    Note! Do not use for writing binary data blocks. For that purpose use RsCore_WriteBinaryDataBlock...WithOpc functions
+******************************************************************************************************/
+ViStatus RsCore_WriteWithOpc(ViSession instrSession, ViConstString writeBuffer, ViInt32 timeoutMs)
+{
+	return RsCoreInt_WriteWithOpc(instrSession, writeBuffer, VI_TRUE, timeoutMs);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_WriteAsciiViInt32Array
+    Writes to the instrument command string followed by ViInt32 array formatted as comma-separated values
+******************************************************************************************************/
+ViStatus RsCore_WriteAsciiViInt32Array(ViSession instrSession, ViConstString command, ViInt32* intArray, ViInt32 arraySize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar* completeCmd = NULL;
+
+	checkErr(RsCore_Convert_ViInt32array_To_String(instrSession, intArray, arraySize, command, &completeCmd));
+	checkErr(RsCore_Write(instrSession, completeCmd));
+
+Error:
+	if (completeCmd)
+		RsCore_Free(instrSession, completeCmd);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_WriteAsciiViReal64Array
+    Writes to the instrument command string followed by ViReal64 array formatted as comma-separated values
+    Used formatting string: %.12lG
+******************************************************************************************************/
+ViStatus RsCore_WriteAsciiViReal64Array(ViSession instrSession, ViConstString command, ViReal64* dblArray, ViInt32 arraySize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar* completeCmd = NULL;
+
+	checkErr(RsCore_Convert_ViReal64array_To_String(instrSession, dblArray, arraySize, command, &completeCmd));
+	checkErr(RsCore_Write(instrSession, completeCmd));
+
+Error:
+	if (completeCmd)
+		RsCore_Free(instrSession, completeCmd);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_WriteAsciiViBooleanArray
+    Writes to the instrument command string followed by ViBoolean array formatted as comma-separated values
+    Boolean representation to string: VI_TRUE = 'ON', VI_FALSE = 'OFF'
+******************************************************************************************************/
+ViStatus RsCore_WriteAsciiViBooleanArray(ViSession instrSession, ViConstString command, ViBoolean* boolArray, ViInt32 arraySize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar* completeCmd = NULL;
+
+	checkErr(RsCore_Convert_ViBooleanArray_To_String(instrSession, boolArray, arraySize, command, &completeCmd));
+	checkErr(RsCore_Write(instrSession, completeCmd));
+
+Error:
+	if (completeCmd)
+		RsCore_Free(instrSession, completeCmd);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ReadViStringUnknownLength
+    Reads data from the instrument and returns the allocated buffer with the read data
+    The response is trimmed for trailing LF-characters and always null-terminated.
+    WARNING!!! - Deallocate the outputBuffer after use.
+    Note! Do not use for reading binary data, for that purpose use the RsCore_ReadBinaryDataBlock... functions
+******************************************************************************************************/
+ViStatus RsCore_ReadViStringUnknownLength(ViSession instrSession, ViChar** responseString)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt64 byteCount;
+
+	checkErr(RsCoreInt_ReadDataUnknownLength(instrSession, (ViByte**)responseString, &byteCount));
+	// Cut one LF at the end if present
+	if (byteCount > 0 && (*responseString)[byteCount - 1] == '\n')
+	{
+		(*responseString)[byteCount - 1] = 0;
+	}
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ReadUpToCharacter
+	Reads data byte-by-byte until it encounters the stopChar, or the bufferSize limit, or the MSG_END
+	If the required stop character is not successfully read,  the function generates RS_ERROR_UNEXPECTED_RESPONSE
+	Returns the buffer including the stopChar, retCnt includes the stopChar. The rest of the buffer is filled with zeroes
+******************************************************************************************************/
+ViStatus RsCore_ReadUpToCharacter(ViSession instrSession, ViChar stopChar, ViInt32 bufferSize, ViBuf buffer, ViInt32* retCnt)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+	ViInt32 i;
+	ViBoolean success = VI_FALSE;
+	ViUInt32 readCount;
+
+	*retCnt = 0;
+	buffer[0] = 0;
+	
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	// Only apply the read delay once at the beginning
+	if (rsSession->readDelay)
+		Sleep(rsSession->readDelay);
+
+	for (i = 0; i < bufferSize; i++)
+	{
+		checkErr(RsCoreInt_IoRead(instrSession, buffer + i, 1, &readCount));
+		if (buffer[i] == stopChar)
+		{
+			error = VI_SUCCESS;
+			success = VI_TRUE;
+			break;
+		}
+		if (error != VI_SUCCESS_MAX_CNT)
+			break;
+	}
+
+	if (!success)
+	{
+		viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, "RsCore_ReadUpToCharacter: The required stop character was not read");
+	}
+
+	if (i < bufferSize - 1)
+	{
+		// Fill up with nulls
+		memset(buffer + i + 1, 0, bufferSize - i - 1);
+	}
+	
+	*retCnt = i + 1;
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViString
+    Queries string from the instrument. The response length is limited.
+    The response is trimmed for trailing LF-characters and always null-terminated.
+    You have to provide a response buffer with minimum size of RS_MAX_MESSAGE_BUF_SIZE (4096 bytes)
+    You can set the responseString to NULL if you do not need the response
+    Note! Do not use for reading binary data blocks. For that purpose use RsCore_QueryBinaryDataBlock... functions
+******************************************************************************************************/
+ViStatus RsCore_QueryViString(ViSession instrSession, ViConstString query, ViChar* responseString)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 returnedCount = 0;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar auxResponse[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar* p2response = (responseString == NULL ? auxResponse : responseString);
+
+	if (RsCore_Simulating(instrSession))
+	{
+		if (responseString != VI_NULL)
+			responseString[0] = 0;
+
+		goto Error;
+	}
+
+	checkErr(RsCore_Write(instrSession, query));
+	checkErr(RsCoreInt_Read(instrSession, RS_MAX_MESSAGE_BUF_SIZE, (ViByte *)p2response, &returnedCount));
+	if (returnedCount >= RS_MAX_MESSAGE_BUF_SIZE)
+	{
+		// Truncate the message, it is too long
+		p2response[RS_MAX_MESSAGE_BUF_SIZE - 1] = '\0';
+		if (p2response[RS_MAX_MESSAGE_BUF_SIZE - 2] != '\n')
+		{
+			// Report an error, the response is not complete
+			p2response[64] = 0;
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Unexpected response on query '%s', longer than maximum %d bytes: '%64s...' "
+			         "The response probably comes from a previous not completely read-out response",
+			         query, RS_MAX_MESSAGE_BUF_SIZE, p2response);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+	}
+	else
+	{
+		p2response[returnedCount] = '\0';
+	}
+
+	RsCore_TrimString(p2response, RS_VAL_TRIM_WHITESPACES);
+
+Error:
+	if (error < 0)
+		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCore_QueryViString", query);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViStringShort
+    Queries string from the instrument. The response length is limited to RS_MAX_SHORT_MESSAGE_BUF_SIZE (64 bytes)
+    The response is trimmed for trailing LF-characters and always null-terminated.
+    You have to provide a response buffer with minimum size of RS_MAX_SHORT_MESSAGE_BUF_SIZE
+    You can set the response buffer to NULL if you do not need the response
+    The function returns
+    Note! Use this function instead of RsCore_QueryViString when you expect a short response e.g. an integer number
+******************************************************************************************************/
+ViStatus RsCore_QueryViStringShort(ViSession instrSession, ViConstString query, ViChar* responseString)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 returnedCount = 0;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar auxResponse[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar* p2response = (responseString == NULL ? auxResponse : responseString);
+
+	if (RsCore_Simulating(instrSession))
+	{
+		if (responseString != VI_NULL)
+			responseString[0] = 0;
+
+		goto Error;
+	}
+
+	checkErr(RsCore_Write(instrSession, query));
+	checkErr(RsCoreInt_Read(instrSession, RS_MAX_SHORT_MESSAGE_BUF_SIZE, (ViByte *)p2response, &returnedCount));
+	if (returnedCount >= RS_MAX_SHORT_MESSAGE_BUF_SIZE)
+	{
+		// Truncate the message, it is too long
+		p2response[RS_MAX_SHORT_MESSAGE_BUF_SIZE - 1] = '\0';
+		if (p2response[RS_MAX_SHORT_MESSAGE_BUF_SIZE - 2] != '\n')
+		{
+			// Report an error, the response is not complete
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Unexpected response on query '%s', longer than maximum %d bytes: '%32s...' "
+			         "The response probably comes from a previous not completely read-out response",
+			         query, RS_MAX_SHORT_MESSAGE_BUF_SIZE, p2response);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+	}
+	else
+	{
+		p2response[returnedCount] = '\0';
+	}
+
+	RsCore_TrimString(p2response, RS_VAL_TRIM_WHITESPACES);
+
+Error:
+	if (error < 0)
+		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCore_QueryViStringShort", query);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViStringUnknownLength
+    Queries string response from the instrument. The response length is unlimited.
+    The response is trimmed for trailing LF-characters and always null-terminated.
+    WARNING!!! - Deallocate the outputBuffer after use.
+    Note! Do not use for querying binary data, for that purpose use the RsCore_QueryBinaryDataBlock... functions
+******************************************************************************************************/
+ViStatus RsCore_QueryViStringUnknownLength(ViSession instrSession, ViConstString query, ViChar** responseString)
+{
+	ViStatus error = VI_SUCCESS;
+
+	checkErr(RsCore_Write(instrSession, query));
+	checkErr(RsCore_ReadViStringUnknownLength(instrSession, responseString));
+
+Error:
+
+	if (error == VI_ERROR_TMO)
+		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCore_QueryViStringUnknownLength", query);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryCatalog
+	Queries string response in a form of catalog from the instrument. The response length is unlimited.
+	The function uses RsCore_ParseCatalog to return a catalog to the user buffer.
+	- elementsCount can be set to NULL. If not it returns comma-separated number of elements
+******************************************************************************************************/
+ViStatus RsCore_QueryCatalog(ViSession instrSession, ViConstString query, ViInt32 bufferSize, ViChar* catalogOut, ViInt32* elementsCount)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar *data = NULL;
+	ViInt32* count;
+
+	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &data));
+	checkErr(RsCore_ParseCatalog(data, bufferSize, catalogOut, &count));
+
+	if (elementsCount)
+		*elementsCount = count;
+
+Error:
+	if (data) RsCore_Free(instrSession, data);
+	return error;
+}
+
+
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViStringUnknownLengthToUserBuffer
+	Queries string response from the instrument. The response length is unlimited,
+	but maximum of bufferSize length is copied to the provided responseString.
+	The response is trimmed for trailing LF-characters and always null-terminated.
+	- responseLength returns the true length of the response and can be set to NULL
+	Note! Do not use for querying binary data, for that purpose use the RsCore_QueryBinaryDataBlock... functions
+******************************************************************************************************/
+ViStatus RsCore_QueryViStringUnknownLengthToUserBuffer(ViSession instrSession, ViConstString query, ViInt32 bufferSize, ViChar* responseString, ViInt32 *responseLength)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar *data = NULL;
+
+	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &data));
+	checkErr(RsCore_CopyToUserBufferAsciiData(instrSession, responseString, bufferSize, data));
+
+	if (responseLength)
+		*responseLength = (ViInt32)strlen(data);
+
+Error:
+	if (data) RsCore_Free(instrSession, data);
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViStringWithOpc
+	Sends an OPC-synchronized query to the instrument. The response length is limited.
+	The response is trimmed for any leading LF characters and terminated with null-character
+	Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
+	Because of the order of commands, this function also calls the driver's CheckStatus callback.
+	If you use this function, do not call the CheckStatus anymore
+	Note! Do not use for querying binary data, for that purpose use the RsCore_QueryBinaryDataBlock...withOpc functions
+******************************************************************************************************/
+ViStatus RsCore_QueryViStringWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs, ViInt32 bufferSize, ViChar* responseString)
+{
+	return RsCoreInt_QueryViStringWithOpc(instrSession, query, VI_TRUE, timeoutMs, bufferSize, responseString);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViStringUnknownLengthWithOpc
+    Sends an OPC-synchronized query to the instrument. The response length is unlimited.
+    The returned string is trimmed for LF and allocated buffer always at least one byte bigger than the returned byteCount, and has always
+    minimum of one null at the end. This allows you to use the outputBuffer as a properly null-terminated string.
+    Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
+    Because of the order of commands, this function also calls the driver's CheckStatus callback.
+    If you use this function, do not call the CheckStatus anymore
+    WARNING!!! - Deallocate the responseString after use.
+    Note! Do not use for querying binary data, for that purpose use the RsCore_QueryBinaryDataBlock...WithOpc functions
+******************************************************************************************************/
+ViStatus RsCore_QueryViStringUnknownLengthWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs, ViChar** responseString)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt64 byteCount;
+
+	checkErr(RsCoreInt_QueryUnknownLengthWithOpc(instrSession, query, VI_TRUE, timeoutMs, (ViByte **)responseString, &byteCount));
+	RsCore_TrimString(*responseString, RS_VAL_TRIM_WHITESPACES);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViStringUnknownLengthToUserBufferWithOpc
+	Sends an OPC-synchronized query to the instrument. The response length is limited.
+	The response is trimmed for any leading LF characters and terminated with null-character
+	Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
+	Because of the order of commands, this function also calls the driver's CheckStatus callback.
+	If you use this function, do not call the CheckStatus anymore
+	- responseLength returns the true length of the response and can be set to NULL
+	- Do not use for querying binary data, for that purpose use the RsCore_QueryBinaryDataBlock...withOpc functions
+******************************************************************************************************/
+ViStatus RsCore_QueryViStringUnknownLengthToUserBufferWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs,
+	ViInt32 bufferSize, ViChar* responseString, ViInt32 *responseLength)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar *data = NULL;
+
+	checkErr(RsCore_QueryViStringUnknownLengthWithOpc(instrSession, query, timeoutMs, &data));
+	checkErr(RsCore_CopyToUserBufferAsciiData(instrSession, responseString, bufferSize, data));
+
+	if (responseLength)
+		*responseLength = (ViInt32)strlen(data);
+
+Error:
+	if (data) RsCore_Free(instrSession, data);
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViInt32
+    Uses RsCore_QueryInstrShortString to query the instrument data and returns it as ViInt32 value
+    If you do not need the response, set the value to NULL
+******************************************************************************************************/
+ViStatus RsCore_QueryViInt32(ViSession instrSession, ViConstString query, ViPInt32 value)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "0";
+
+	if (RsCore_Simulating(instrSession))
+	{
+		if (value)
+			*value = 1;
+
+		goto Error;
+	}
+
+	checkErr(RsCore_QueryViStringShort(instrSession, query, response));
+
+	if (value)
+		*value = RsCore_Convert_String_To_ViInt32(response);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViInt32WithOpc
+	Sends an OPC-synchronized query to the instrument and returns it as ViInt32 value
+	The response read is limited to RS_MAX_SHORT_MESSAGE_BUF_SIZE (64 bytes)
+	Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
+	Because of the order of commands, this function also calls the driver's CheckStatus callback.
+	If you use this function, do not call the CheckStatus anymore
+	If you do not need the response, set the value to NULL
+******************************************************************************************************/
+ViStatus RsCore_QueryViInt32WithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs, ViPInt32 value)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "0";
+
+	if (RsCore_Simulating(instrSession))
+	{
+		if (value)
+			*value = 1;
+
+		goto Error;
+	}
+
+	checkErr(RsCoreInt_QueryViStringWithOpc(instrSession, query, VI_TRUE, timeoutMs, RS_MAX_SHORT_MESSAGE_BUF_SIZE, response));
+
+	if (value)
+		*value = RsCore_Convert_String_To_ViInt32(response);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViReal64
+    Uses RsCore_QueryInstrShortString to query the instrument data and returns it as ViReal64 value
+    If you do not need the response, set the value to NULL
+******************************************************************************************************/
+ViStatus RsCore_QueryViReal64(ViSession instrSession, ViConstString query, ViPReal64 value)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "0.0";
+
+	if (RsCore_Simulating(instrSession))
+	{
+		if (value)
+			*value = 1.0;
+
+		goto Error;
+	}
+
+	checkErr(RsCore_QueryViStringShort(instrSession, query, response));
+
+	if (value)
+		*value = RsCore_Convert_String_To_ViReal64(response);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViReal64WithOpc
+	Sends an OPC-synchronized query to the instrument and returns it as ViReal64 value
+	The response read is limited to RS_MAX_SHORT_MESSAGE_BUF_SIZE (64 bytes)
+	Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
+	Because of the order of commands, this function also calls the driver's CheckStatus callback.
+	If you use this function, do not call the CheckStatus anymore
+	If you do not need the response, set the value to NULL
+******************************************************************************************************/
+ViStatus RsCore_QueryViReal64WithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs, ViPReal64 value)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "0.0";
+
+	if (RsCore_Simulating(instrSession))
+	{
+		if (value)
+			*value = 1.0;
+
+		goto Error;
+	}
+
+	checkErr(RsCoreInt_QueryViStringWithOpc(instrSession, query, VI_TRUE, timeoutMs, RS_MAX_SHORT_MESSAGE_BUF_SIZE, response));
+
+	if (value)
+		*value = RsCore_Convert_String_To_ViReal64(response);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViBoolean
+    Uses RsCore_QueryInstrShortString to query the instrument data and returns it as ViBoolean value
+    If you do not need the response, set the value to NULL
+******************************************************************************************************/
+ViStatus RsCore_QueryViBoolean(ViSession instrSession, ViConstString query, ViPBoolean value)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "OFF";
+
+	if (RsCore_Simulating(instrSession))
+	{
+		if (value)
+			*value = VI_FALSE;
+
+		goto Error;
+	}
+
+	checkErr(RsCore_QueryViStringShort(instrSession, query, response));
+
+	if (value)
+		*value = RsCore_Convert_String_To_Boolean(response);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViBooleanWithOpc
+	Sends an OPC-synchronized query to the instrument and returns it as ViBoolean value
+	The response read is limited to RS_MAX_SHORT_MESSAGE_BUF_SIZE (64 bytes)
+	Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
+	Because of the order of commands, this function also calls the driver's CheckStatus callback.
+	If you use this function, do not call the CheckStatus anymore
+	If you do not need the response, set the value to NULL
+******************************************************************************************************/
+ViStatus RsCore_QueryViBooleanWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs, ViPBoolean value)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "OFF";
+
+	if (RsCore_Simulating(instrSession))
+	{
+		if (value)
+			*value = VI_FALSE;
+
+		goto Error;
+	}
+
+	checkErr(RsCoreInt_QueryViStringWithOpc(instrSession, query, VI_TRUE, timeoutMs, RS_MAX_SHORT_MESSAGE_BUF_SIZE, response));
+
+	if (value)
+		*value = RsCore_Convert_String_To_Boolean(response);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryStringIndex
+	Queries string response from the instrument, trims it for LF, and searches for it in the provided patternsArray.
+	The last element of the patternsArray must be NULL
+	Returned patternIdx is the index of the response in the patternsArray
+	If the response is not found, the patternIdx = -1
+	The response length is limited to the maximum of RS_MAX_MESSAGE_BUF_SIZE (4096 bytes)
+******************************************************************************************************/
+ViStatus RsCore_QueryStringIndex(ViSession instrSession, ViConstString query, ViString patternsArray[], ViInt32* patternIdx)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar response[RS_MAX_MESSAGE_BUF_SIZE];
+
+	*patternIdx = -1;
+
+	if (RsCore_Simulating(instrSession))
+	{
+		*patternIdx = 0;
+		goto Error;
+	}
+
+	checkErr(RsCore_QueryViString(instrSession, query, response));
+	*patternIdx = RsCore_FindStringIndex(patternsArray, response);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryAsciiViReal64Array
+    Queries the instrument for an ASCII-format comma-separated float values
+    and returns them as ViReal64 array
+    WARNING!!! - Deallocate the dblArray after use.
+******************************************************************************************************/
+ViStatus RsCore_QueryAsciiViReal64Array(ViSession instrSession, ViConstString query, ViReal64** dblArray, ViInt32* arraySize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar* auxString = NULL;
+
+	if (RsCore_Simulating(instrSession))
+	{
+		*arraySize = 1;
+		checkAlloc(*dblArray = (ViReal64 *)RsCore_Calloc(instrSession, 1, sizeof(ViReal64)));
+		(*dblArray)[0] = 0.0;
+
+		goto Error;
+	}
+
+	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &auxString));
+	checkErr(RsCore_Convert_String_To_ViReal64Array(instrSession, auxString, dblArray, arraySize));
+
+Error:
+	if (auxString)
+		RsCore_Free(instrSession, auxString);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryViReal64Multiple
+    Queries several numbers in one transaction. The query joins the single queries with ';',
+    e.g. 'CALC1:MARK1:X?;Y?'. The responses separated with ';' (or ',' for the queries returning lists)
+    are converted to the valuesCount numbers. A different number of the responses is an error
+******************************************************************************************************/
+ViStatus RsCore_QueryViReal64Multiple(ViSession instrSession, ViConstString query, ViInt32 valuesCount, ViReal64 values[])
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar* response = NULL;
+	ViChar* token;
+	ViChar* separator;
+	ViInt32 count = 0;
+
+	if (RsCore_Simulating(instrSession))
+	{
+		memset(values, 0, (size_t)valuesCount * sizeof(ViReal64));
+		goto Error;
+	}
+
+	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &response));
+	RsCore_TrimString(response, RS_VAL_TRIM_WHITESPACES);
+
+	token = *response != '\0' ? response : NULL;
+	while (token != NULL)
+	{
+		separator = strpbrk(token, ";,");
+		if (separator != NULL)
+			*separator = '\0';
+
+		if (count < valuesCount)
+			values[count] = RsCore_Convert_String_To_ViReal64(token);
+
+		count++;
+		token = separator != NULL ? separator + 1 : NULL;
+	}
+
+	if (count != valuesCount)
+	{
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "RsCore_QueryViReal64Multiple: Expected " _PERCD " values, received " _PERCD " values for the query '%s'", valuesCount, count, query);
+		viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+	}
+
+Error:
+	if (response)
+		RsCore_Free(instrSession, response);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryAsciiViInt32Array
+    Queries the instrument for an ASCII-format comma-separated integer values
+    and returns them as ViInt32 array
+    WARNING!!! - Deallocate the intArray after use.
+******************************************************************************************************/
+ViStatus RsCore_QueryAsciiViInt32Array(ViSession instrSession, ViConstString query, ViInt32** intArray, ViInt32* arraySize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar* auxString = NULL;
+
+	if (RsCore_Simulating(instrSession))
+	{
+		*arraySize = 1;
+		checkAlloc(*intArray = (ViInt32 *)RsCore_Calloc(instrSession, 1, sizeof(ViInt32)));
+		(*intArray)[0] = 0;
+
+		goto Error;
+	}
+
+	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &auxString));
+	checkErr(RsCore_Convert_String_To_ViInt32Array(instrSession, auxString, intArray, arraySize));
+
+Error:
+	if (auxString)
+		RsCore_Free(instrSession, auxString);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryAsciiViBooleanArray
+    Queries the instrument for an ASCII-format comma-separated boolean values
+    and returns them as ViBoolean array
+    WARNING!!! - Deallocate the boolArray after use.
+******************************************************************************************************/
+ViStatus RsCore_QueryAsciiViBooleanArray(ViSession instrSession, ViConstString query, ViBoolean** boolArray, ViInt32* arraySize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar* auxString = NULL;
+
+	if (RsCore_Simulating(instrSession))
+	{
+		*arraySize = 1;
+		checkAlloc(*boolArray = (ViBoolean *)RsCore_Calloc(instrSession, 1, sizeof(ViBoolean)));
+		(*boolArray)[0] = VI_FALSE;
+
+		goto Error;
+	}
+
+	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &auxString));
+	checkErr(RsCore_Convert_String_To_ViBooleanArray(instrSession, auxString, boolArray, arraySize));
+
+Error:
+	if (auxString)
+		RsCore_Free(instrSession, auxString);
+
+	return error;
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Instrument Binary Data IO -----------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  RsCore_WriteBinaryDataBlock
+    Writes binary data block to the instrument including binary data header.
+    You just need to provide the command, payload data and the payload length
+******************************************************************************************************/
+ViStatus RsCore_WriteBinaryDataBlock(ViSession instrSession, ViConstString command, ViByte* data, ViInt64 dataSize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViByte* p2data = data;
+	ViInt64 remainingBytes;
+	ViInt32 chunkSize;
+	ViUInt32 retCnt;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	chunkSize = rsSession->ioSegmentSize;
+	if (dataSize < chunkSize)
+	{
+		// Can be written in one segment
+		checkErr(RsCoreInt_SendBinDataHeader(instrSession, command, dataSize));
+		if (rsSession->addTermCharToWriteBinBlock)
+		{
+			checkErr(RsCoreInt_IoWrite(instrSession, data, (ViUInt32)dataSize, &retCnt));
+			errElab[0] = '\n';
+			(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+			checkErr(RsCoreInt_IoWrite(instrSession, (ViBuf)errElab, 1, NULL));
+		}
+		else
+		{
+			(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+			checkErr(RsCoreInt_IoWrite(instrSession, data, (ViUInt32)dataSize, &retCnt));
+		}
+
+		if (dataSize != (ViInt64)retCnt)
+		{
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Rs_WriteBinaryData: Written data length " _PERCU " bytes is different than the indicated dataSize size " _PERCLD " bytes",
+			         retCnt, dataSize);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+	}
+	else
+	{
+		// Write in more segments
+		remainingBytes = dataSize;
+		checkErr(RsCoreInt_SendBinDataHeader(instrSession, command, dataSize));
+		while (remainingBytes > 0)
+		{
+			if (remainingBytes > chunkSize)
+			{
+				checkErr(RsCoreInt_IoWrite(instrSession, p2data, chunkSize, &retCnt));
+				remainingBytes -= retCnt;
+				p2data += retCnt;
+
+				if (chunkSize != (ViInt32)retCnt)
+				{
+					snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+					         "Rs_WriteBinaryData: Written data chunk " _PERCU " bytes is different than the indicated written data size " _PERCU " bytes",
+					         chunkSize, retCnt);
+					viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+				}
+			}
+			else
+			{
+				// Last chunk write
+				if (rsSession->addTermCharToWriteBinBlock)
+				{
+					checkErr(RsCoreInt_IoWrite(instrSession, p2data, (ViUInt32)remainingBytes, &retCnt));
+					errElab[0] = '\n';
+					(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+					checkErr(RsCoreInt_IoWrite(instrSession, (ViBuf)errElab, 1, NULL));
+				}
+				else
+				{
+					(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+					checkErr(RsCoreInt_IoWrite(instrSession, p2data, (ViUInt32)remainingBytes, &retCnt));
+				}
+
+				if (remainingBytes != retCnt)
+				{
+					snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+					         "Rs_WriteBinaryData: Written data last chunk " _PERCLD " bytes is different than the indicated written data size " _PERCU
+					         " bytes",
+					         remainingBytes, retCnt);
+					viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+				}
+				remainingBytes -= retCnt;
+				break;
+			}
+		}
+
+		if (remainingBytes != 0)
+		{
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "RsCore_WriteBinaryDataBlock: Written data length " _PERCLD " bytes is different than the indicated data size " _PERCLD " bytes",
+			         dataSize - remainingBytes, dataSize);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+	}
+
+Error:
+	(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryBinaryDataBlock
+    Queries binary data of from the instrument.
+    If errorIfNotBinDataBlock == TRUE, the function generates error in case the
+    data is not binary block (not starting with '#')
+    If errorIfNotBinDataBlock == FALSE, the function returns read data and indicates isBinDataBlock = FALSE.
+    If you do not need the isBinDataBlock info, set the pointer to NULL
+    WARNING!!! Deallocate the buffer after use
+******************************************************************************************************/
+ViStatus RsCore_QueryBinaryDataBlock(ViSession instrSession,
+                                     ViConstString query,
+                                     ViBoolean errorIfNotBinDataBlock,
+                                     ViBoolean* isBinDataBlock,
+                                     ViByte** outputBuffer,
+                                     ViInt64* byteCount)
+{
+	ViStatus error = VI_SUCCESS;
+
+	checkErr(RsCore_Write(instrSession, query));
+	checkErr(RsCoreInt_ReadBinaryDataBlock(instrSession, errorIfNotBinDataBlock, isBinDataBlock, outputBuffer, byteCount));
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryBinaryDataBlockWithOpc
+    Queries binary data from the instrument with OPC-synchronization
+    If errorIfNotBinDataBlock == TRUE, the function generates error in case the
+    data is not binary block (not starting with '#')
+    If errorIfNotBinDataBlock == FALSE, the function returns read data and indicates isBinDataBlock = FALSE.
+    If you do not need the isBinDataBlock info, set the pointer to NULL
+    Because of the order of commands, this function also calls the driver's CheckStatus callback.
+    If you use this function, do not call the CheckStatus anymore
+    WARNING!!! Deallocate the buffer after use
+******************************************************************************************************/
+ViStatus RsCore_QueryBinaryDataBlockWithOpc(ViSession instrSession,
+                                            ViConstString query,
+                                            ViBoolean errorIfNotBinDataBlock,
+                                            ViInt32 timeoutMs,
+                                            ViBoolean* isBinDataBlock,
+                                            ViByte** outputBuffer,
+                                            ViInt64* byteCount)
+{
+	return RsCoreInt_QueryBinaryDataBlockWithOpc(instrSession, query, errorIfNotBinDataBlock, isBinDataBlock, VI_TRUE, timeoutMs, outputBuffer,
+	                                             byteCount);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryBinaryDataBlockToFile
+    This function queries instrument for binary data and writes the response to the provided file.
+    The file is opened in binary mode.
+******************************************************************************************************/
+ViStatus RsCore_QueryBinaryDataBlockToFile(ViSession instrSession,
+                                           ViConstString query,
+                                           ViConstString filename,
+                                           ViInt32 fileAction)
+{
+	ViStatus error = VI_SUCCESS;
+	FILE* file = NULL;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt64 length = 0;
+
+	if ((file = fopen(filename, (fileAction == RS_VAL_APPEND) ? "ab" : "wb")) == NULL)
+	{
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Rs_QueryBinaryDataBlockToFile: File '%s' cannot be opened for writing", filename);
+		viCheckErrElab(RS_ERROR_CANNOT_OPEN_FILE, errElab);
+	}
+
+	checkErr(RsCore_Write(instrSession, query));
+	checkErr(RsCoreInt_ParseBinaryDataHeader(instrSession, VI_TRUE, NULL, &length, NULL));
+	checkErr(RsCoreInt_ReadDataKnownLengthToFile(instrSession, length, file, NULL));
+
+Error:
+	if (file)
+		(void)fclose(file);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_WriteBinaryDataFromFile
+Writes binary data from a file you specify and writes it to instrument using VISA I/O.
+This function composes and sends the required binary data header.
+******************************************************************************************************/
+ViStatus RsCore_WriteBinaryDataFromFile(ViSession instrSession, ViConstString command, ViConstString sourceFile)
+{
+	ViStatus error = VI_SUCCESS;
+	ViByte* buffer = NULL;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	FILE* file = NULL;
+	ViInt64 fileSize = 0, remainingBytes;
+	ViInt32 chunkSize;
+	ViInt64 bytesRead;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if ((file = fopen(sourceFile, "rb")) == NULL)
+	{
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "RsCore_WriteBinaryDataFromFile: File '%s' cannot be opened for reading", sourceFile);
+		viCheckErrElab(RS_ERROR_CANNOT_OPEN_FILE, errElab);
+	}
+
+#if defined (_CVI_)
+
+    ViUInt32 fileSize32;
+    (void)fseek(file, 0, SEEK_END);
+    fileSize32 = ftell(file);
+    (void)fseek(file, 0, SEEK_SET);
+    fileSize = (ViInt64)fileSize32;
+
+#elif defined(_MSC_VER)
+
+	(void)fseek(file, 0, SEEK_END);
+	fileSize = (ViInt64)_ftelli64(file);
+	(void)fseek(file, 0, SEEK_SET);
+
+#else
+
+	(void)fseek(file, 0, SEEK_END);
+	fileSize = (ViInt64)ftell(file);
+	(void)fseek(file, 0, SEEK_SET);
+
+#endif
+
+	if (fileSize < 1)
+		fileSize = 1;
+
+	chunkSize = rsSession->ioSegmentSize;
+	if (fileSize < chunkSize)
+	{
+		// Can be written in one segment
+		viCheckAllocElab(buffer = (ViByte*)RsCore_Calloc(instrSession, sizeof(ViByte*), (size_t)fileSize),
+			"RsCore_WriteBinaryDataFromFile: Allocation of the fileSize memory");
+		bytesRead = (ViInt64)fread(buffer, sizeof(ViByte), (size_t)fileSize, file);
+		checkErr(RsCoreInt_SendBinDataHeader(instrSession, command, fileSize));
+		if (rsSession->addTermCharToWriteBinBlock)
+		{
+			checkErr(RsCoreInt_IoWrite(instrSession, buffer, (ViInt32)fileSize, NULL));
+			buffer[0] = '\n';
+			(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+			checkErr(RsCoreInt_IoWrite(instrSession, buffer, 1, NULL));
+		}
+		else
+		{
+			(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+			checkErr(RsCoreInt_IoWrite(instrSession, buffer, (ViUInt32)fileSize, NULL));
+		}
+
+		if (bytesRead != fileSize)
+		{
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "RsCore_WriteBinaryDataFromFile: Length of data read from the file " _PERCLD " bytes does not match the file length " _PERCLD " bytes",
+			         bytesRead, fileSize);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+	}
+	else
+	{
+		// Write in more segments
+		remainingBytes = fileSize;
+		viCheckAllocElab(buffer = (ViByte*)RsCore_Calloc(instrSession, sizeof(ViByte*), chunkSize), "RsCore_WriteBinaryDataFromFile: Allocation of the chunkSize memory");
+		checkErr(RsCoreInt_SendBinDataHeader(instrSession, command, fileSize));
+		while (feof(file) == 0)
+		{
+			if (remainingBytes > chunkSize)
+			{
+				bytesRead = (ViUInt32)fread(buffer, sizeof(ViByte), chunkSize, file);
+				checkErr(RsCoreInt_IoWrite(instrSession, buffer, (ViUInt32)bytesRead, NULL));
+				remainingBytes -= bytesRead;
+
+				if (bytesRead != chunkSize)
+				{
+					snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+					         "RsCore_WriteBinaryDataFromFile: Length of data read from the file " _PERCLD " bytes does not match the chunk size " _PERCU
+					         " bytes",
+					         bytesRead, chunkSize);
+					viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+				}
+			}
+			else
+			{
+				// Last chunk write
+				bytesRead = (ViInt64)fread(buffer, sizeof(ViByte), (ViUInt32)remainingBytes, file);
+				if (rsSession->addTermCharToWriteBinBlock)
+				{
+					checkErr(RsCoreInt_IoWrite(instrSession, buffer, (ViUInt32)bytesRead, NULL));
+					buffer[0] = '\n';
+					(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+					checkErr(RsCoreInt_IoWrite(instrSession, buffer, 1, NULL));
+				}
+				else
+				{
+					(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+					checkErr(RsCoreInt_IoWrite(instrSession, buffer, (ViUInt32)bytesRead, NULL));
+				}
+				remainingBytes -= bytesRead;
+				break;
+			}
+		}
+
+		if (remainingBytes != 0)
+		{
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "RsCore_WriteBinaryDataFromFile: Written data length " _PERCLD " bytes is smaller than the indicated file size " _PERCLD " bytes",
+			         fileSize - remainingBytes, fileSize);
+			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+		}
+	}
+
+Error:
+	(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+
+	if (file)
+		(void)fclose(file);
+
+	if (buffer)
+		RsCore_Free(instrSession, buffer);
+
+	return error;
+}
+
+/******************************************************************************************************/
+/*  RsCoreInt_ReadFloatArray
+    Reads the response of an already sent query as an array of floating-point numbers in ASCII format or in binary format.
+    - For ASCII format, the array numbers are decoded as comma-separated values.
+    - For Binary Format, the numbers are decoded based on the property binaryFloatNumbersFormat, usually float 32-bit (FORM REAL,32)
+    WARNING!!! - Deallocate the outDblArray after use. */
+/******************************************************************************************************/
+static ViStatus RsCoreInt_ReadFloatArray(ViSession instrSession, ViReal64** outDblArray, ViInt32* outArraySize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViByte* data = NULL;
+	ViBoolean isBinDataBlock;
+	ViInt64 byteCount64;
+	ViInt32 byteCount;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	checkErr(RsCoreInt_ReadBinaryDataBlock(instrSession, VI_FALSE, &isBinDataBlock, &data, &byteCount64));
+	byteCount = (ViInt32)byteCount64;
+	if (isBinDataBlock)
+	{
+		switch (rsSession->binaryFloatNumbersFormat)
+		{
+		case RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES:
+			checkErr(RsCore_Convert_BinaryDataBlock_To_Float32Array(instrSession, data, byteCount, outDblArray, outArraySize, VI_FALSE));
+			break;
+		case RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES_SWAPPED:
+			checkErr(RsCore_Convert_BinaryDataBlock_To_Float32Array(instrSession, data, byteCount, outDblArray, outArraySize, VI_TRUE));
+			break;
+		case RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES:
+			*outArraySize = byteCount / 8;
+			*outDblArray = (ViReal64 *)data; // Same data, do not free the data buffer
+			break;
+		case RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES_SWAPPED:
+			*outArraySize = byteCount / 8;
+			RsCore_SwapEndianness(data, *outArraySize, 8);
+			*outDblArray = (ViReal64 *)data; // Same data, do not free the data buffer
+			break;
+		default:
+			viCheckErrElab(VI_ERROR_NSUP_MODE,
+				"RsCore_QueryFloatArray: Unsupported mode of conversion BinDataBlock -> FloatArray[]");
+			break;
+		}
+	}
+	else
+	{
+		RsCore_TrimString((ViChar*)data, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+		checkErr(RsCore_Convert_String_To_ViReal64Array(instrSession, (ViChar*)data, outDblArray, outArraySize));
+	}
+
+Error:
+	// Same data buffer, do not free it, it goes to the user
+	if (data && (ViReal64 *)data != *outDblArray)
+		RsCore_Free(instrSession, data);
+
+	return error;
+}
+
+/******************************************************************************************************/
+/*  RsCore_QueryFloatArray
+    Queries an array of floating-point numbers that can be returned in ASCII format or in binary format.
+    The array is always returned as the most-universal ViReal64 array.
+    - For ASCII format, the array numbers are decoded as comma-separated values.
+    - For Binary Format, the numbers are decoded based on the property binaryFloatNumbersFormat, usually float 32-bit (FORM REAL,32)
+    WARNING!!! - Deallocate the outDblArray after use. */
+/******************************************************************************************************/
+ViStatus RsCore_QueryFloatArray(ViSession instrSession, ViConstString query, ViReal64** outDblArray, ViInt32* outArraySize)
+{
+	ViStatus error = VI_SUCCESS;
+
+	if (RsCore_Simulating(instrSession))
+	{
+		*outArraySize = 1;
+		checkAlloc(*outDblArray = (ViReal64 *)RsCore_Calloc(instrSession, 1, sizeof(ViReal64)));
+		(*outDblArray)[0] = 0.0;
+
+		goto Error;
+	}
+
+	checkErr(RsCore_Write(instrSession, query));
+	checkErr(RsCoreInt_ReadFloatArray(instrSession, outDblArray, outArraySize));
+
+Error:
+	return error;
+}
+
+/******************************************************************************************************/
+/*  RsCore_QueryFloatArrayWithOpc
+    Queries with OPC an array of floating-point numbers that can be returned in ASCII format or in binary format.
+    Set the parameter timeoutMs to 0 in order to use the session's OPC timeout.
+    Because of the order of commands, this function also calls the driver's CheckStatus callback.
+    If you use this function, do not call the CheckStatus anymore
+    The array is always returned as the most-universal ViReal64 array.
+    - For ASCII format, the array numbers are decoded as comma-separated values.
+    - For Binary Format, the numbers are decoded based on the property binaryFloatNumbersFormat, usually float 32-bit (FORM REAL,32)
+    WARNING!!! - Deallocate the outDblArray after use. */
+/******************************************************************************************************/
+ViStatus RsCore_QueryFloatArrayWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs,
+                                                    ViReal64** outDblArray, ViInt32* outArraySize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViByte* data = NULL;
+	ViBoolean isBinDataBlock;
+	ViInt32 byteCount;
+	ViInt64 byteCount64;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (RsCore_Simulating(instrSession))
+	{
+		*outArraySize = 1;
+		checkAlloc(*outDblArray = (ViReal64 *)RsCore_Calloc(instrSession, 1, sizeof(ViReal64)));
+		(*outDblArray)[0] = 0.0;
+
+		goto Error;
+	}
+
+	checkErr(RsCoreInt_QueryBinaryDataBlockWithOpc(instrSession, query, VI_FALSE, &isBinDataBlock, VI_TRUE, timeoutMs, &data, &byteCount64));
+	byteCount = (ViInt32)byteCount64;
+	if (isBinDataBlock)
+	{
+		switch (rsSession->binaryFloatNumbersFormat)
+		{
+		case RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES:
+			checkErr(RsCore_Convert_BinaryDataBlock_To_Float32Array(instrSession, data, byteCount, outDblArray, outArraySize, VI_FALSE));
+			break;
+		case RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES_SWAPPED:
+			checkErr(RsCore_Convert_BinaryDataBlock_To_Float32Array(instrSession, data, byteCount, outDblArray, outArraySize, VI_TRUE));
+			break;
+		case RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES:
+			*outArraySize = byteCount / 8;
+			*outDblArray = (ViReal64 *)data; // Same data, do not free the data buffer
+			break;
+		case RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES_SWAPPED:
+			*outArraySize = byteCount / 8;
+			RsCore_SwapEndianness(data, *outArraySize, 8);
+			*outDblArray = (ViReal64 *)data; // Same data, do not free the data buffer
+			break;
+		default:
+			viCheckErrElab(VI_ERROR_NSUP_MODE,
+				"RsCore_QueryFloatArrayWithOpc: Unsupported mode of conversion BinDataBlock -> FloatArray[]");
+			break;
+		}
+	}
+	else
+	{
+		RsCore_TrimString((ViChar*)data, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+		checkErr(RsCore_Convert_String_To_ViReal64Array(instrSession, (ViChar*)data, outDblArray, outArraySize));
+	}
+
+Error:
+	// Same data buffer, do not free it, it goes to the user
+	if (data && (ViReal64 *)data != *outDblArray)
+		RsCore_Free(instrSession, data);
+
+	return error;
+}
+
+/******************************************************************************************************/
+/*  RsCore_QueryIntegerArray
+    Queries an array of integer numbers that can be returned in ASCII format or in binary format.
+    The array is always returned as the most-universal ViInt32 array.
+    - For ASCII format, the array numbers are decoded as comma-separated values.
+    - For Binary Format, the numbers are decoded based on the property binaryIntegerNumbersFormat, usually integer 32-bit (FORM INT,32)
+    WARNING!!! - Deallocate the outInt32Array after use. */
+/******************************************************************************************************/
+ViStatus RsCore_QueryIntegerArray(ViSession instrSession, ViConstString query, ViInt32** outInt32Array, ViInt32* outArraySize)
+{
+	ViStatus error = VI_SUCCESS;
+	ViByte* data = NULL;
+	ViBoolean isBinDataBlock = VI_FALSE;
+	ViInt32 byteCount;
+	ViInt64 byteCount64;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (RsCore_Simulating(instrSession))
+	{
+		*outArraySize = 1;
+		checkAlloc(*outInt32Array = (ViInt32 *)RsCore_Calloc(instrSession, 1, sizeof(ViInt32)));
+		(*outInt32Array)[0] = 0;
+
+		goto Error;
+	}
+
+	checkErr(RsCore_Write(instrSession, query));
+	checkErr(RsCoreInt_ReadBinaryDataBlock(instrSession, VI_FALSE, &isBinDataBlock, &data, &byteCount64));
+	byteCount = (ViInt32)byteCount64;
+	if (isBinDataBlock)
+	{
+		switch (rsSession->binaryIntegerNumbersFormat)
+		{
+		case RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES:
+			*outArraySize = byteCount / 4;
+			*outInt32Array = (ViInt32 *)data; // Same data, do not free the data buffer
+			break;
+		case RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES_SWAPPED:
+			*outArraySize = byteCount / 4;
+			RsCore_SwapEndianness(data, *outArraySize, 4);
+			*outInt32Array = (ViInt32 *)data; // Same data, do not free the data buffer
+			break;
+		default:
+			viCheckErrElab(VI_ERROR_NSUP_MODE,
+				"RsCore_QueryIntegerArray: Unsupported mode of conversion BinDataBlock -> Integer32Array[]");
+			break;
+		}
+	}
+	else
+	{
+		RsCore_TrimString((ViChar*)data, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+		checkErr(RsCore_Convert_String_To_ViInt32Array(instrSession, (ViChar*)data, outInt32Array, outArraySize));
+	}
+
+Error:
+	// Same data buffer, do not free it, it goes to the user
+	if (data && (ViInt32 *)data != *outInt32Array)
+		RsCore_Free(instrSession, data);
+
+	return error;
 }
 
-/*****************************************************************************************************/
-/*  RsCore_GetAttributeViBoolean
-    Exported type-safe function for reading an attribute ViBoolean value
-******************************************************************************************************/
-ViStatus RsCore_GetAttributeViBoolean(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViBoolean* value)
+/******************************************************************************************************/
+/*  RsCore_QueryIntegerArrayWithOpc
+    Queries with OPC an array of integer numbers that can be returned in ASCII format or in binary format.
+    Set the parameter timeoutMs to 0 in order to use the session's OPC timeout.
+    Because of the order of commands, this function also calls the driver's CheckStatus callback.
+    If you use this function, do not call the CheckStatus anymore
+    The array is always returned as the most-universal ViInt32 array.
+    - For ASCII format, the array numbers are decoded as comma-separated values.
+    - For Binary Format, the numbers are decoded based on the property binaryIntegerNumbersFormat, usually integer 32-bit (FORM INT,32)
+    WARNING!!! - Deallocate the outInt32Array after use. */
+/******************************************************************************************************/
+ViStatus RsCore_QueryIntegerArrayWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs,
+                                                      ViInt32** outInt32Array, ViInt32* outArraySize)
 {
-	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_BOOLEAN, (ViInt32)sizeof(ViBoolean), value);
+	ViStatus error = VI_SUCCESS;
+	ViByte* data = NULL;
+	ViBoolean isBinDataBlock = VI_FALSE;
+	ViInt32 byteCount;
+	ViInt64 byteCount64;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (RsCore_Simulating(instrSession))
+	{
+		*outArraySize = 1;
+		checkAlloc(*outInt32Array = (ViInt32 *)RsCore_Calloc(instrSession, 1, sizeof(ViInt32)));
+		(*outInt32Array)[0] = 0;
+
+		goto Error;
+	}
+
+	checkErr(RsCoreInt_QueryBinaryDataBlockWithOpc(instrSession, query, VI_FALSE, &isBinDataBlock, VI_TRUE, timeoutMs, &data, &byteCount64));
+	byteCount = (ViInt32)byteCount64;
+	if (isBinDataBlock)
+	{
+		switch (rsSession->binaryIntegerNumbersFormat)
+		{
+		case RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES:
+			*outArraySize = byteCount / 4;
+			*outInt32Array = (ViInt32 *)data; // Same data, do not free the data buffer
+			break;
+		case RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES_SWAPPED:
+			*outArraySize = byteCount / 4;
+			RsCore_SwapEndianness(data, *outArraySize, 4);
+			*outInt32Array = (ViInt32 *)data; // Same data, do not free the data buffer
+			break;
+		default:
+			viCheckErrElab(VI_ERROR_NSUP_MODE,
+				"RsCore_QueryIntegerArray: Unsupported mode of conversion BinDataBlock -> Integer32Array[]");
+			break;
+		}
+	}
+	else
+	{
+		RsCore_TrimString((ViChar*)data, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+		checkErr(RsCore_Convert_String_To_ViInt32Array(instrSession, (ViChar*)data, outInt32Array, outArraySize));
+	}
+
+Error:
+	// Same data buffer, do not free it, it goes to the user
+	if (data && (ViInt32 *)data != *outInt32Array)
+		RsCore_Free(instrSession, data);
+
+	return error;
 }
 
-/*****************************************************************************************************/
-/*  RsCore_GetAttributeViSession
-    Exported type-safe function for reading an attribute ViSession value
-******************************************************************************************************/
-ViStatus RsCore_GetAttributeViSession(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViSession* value)
+/******************************************************************************************************/
+/*  RsCore_QueryFloatArrayToUserBuffer
+	The function sends the query to the instrument, reads the array response and copies it to the provided user buffer
+	Before sending the command, it sends the bin format setting: ':FORM REAL,32'
+	Even if the instrument returns the data in ASCII format, the function parses it properly
+	(it uses RsCore_QueryFloatArray)
+	If the userBufferLength is smaller than read-out dataCount, the function only copies
+	the maximum provided count of the data and returns positive error number that equals the dataCount.
+	actualPointsCount can be set to NULL
+/******************************************************************************************************/
+ViStatus RsCore_QueryFloatArrayToUserBuffer(ViSession instrSession,
+										ViConstString query,
+										ViInt32 userBufferLength,
+										ViReal64 *userBuffer,
+										ViInt32* actualPointsCount)
 {
-	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_SESSION, (ViInt32)sizeof(ViSession), value);
+	ViStatus error = VI_SUCCESS;
+	ViReal64* data = NULL;
+	ViInt32 dataCount = 0;
+
+	checkErr(RsCore_Write(instrSession, ":FORM REAL,32"));
+	checkErr(RsCore_QueryFloatArray(instrSession, query, &data, &dataCount));
+	
+	if (dataCount <= userBufferLength)
+	{
+		// Copy the whole data
+		memcpy(userBuffer, data, dataCount * sizeof(ViReal64));
+	}
+	else
+	{
+		// Copy the userBufferLength data
+		memcpy(userBuffer, data, userBufferLength * sizeof(ViReal64));
+		error = dataCount;
+	}
+
+	if (actualPointsCount)
+		*actualPointsCount = dataCount;
+
+Error:
+	if (data)
+		RsCore_Free(instrSession, data);
+
+	return error;
 }
 
-/*****************************************************************************************************/
-/*  RsCore_GetAttributeViAddress
-    Exported type-safe function for reading an attribute ViAddr value
-******************************************************************************************************/
-ViStatus RsCore_GetAttributeViAddress(ViSession instrSession, ViString repCap, ViUInt32 attributeId, ViInt32 optionFlag, ViAddr* value)
+/******************************************************************************************************/
+/*  RsCore_QueryFloatArrayToUserBufferWithOpc
+	Same as RsCore_QueryFloatArrayWithOpc, but the query is sent with OPC-sync
+	Set the parameter timeoutMs to 0 in order to use the session's OPC timeout
+/******************************************************************************************************/
+ViStatus RsCore_QueryFloatArrayToUserBufferWithOpc(ViSession instrSession,
+										ViConstString query,
+										ViInt32 timeoutMs,
+										ViInt32 userBufferLength,
+										ViReal64 *userBuffer,
+										ViInt32* actualPointsCount)
 {
-	return RsCoreInt_GetAttribute(instrSession, repCap, attributeId, optionFlag, RS_VAL_ADDR, (ViInt32)sizeof(ViAddr), value);
+	ViStatus error = VI_SUCCESS;
+	ViReal64* data = NULL;
+	ViInt32 dataCount = 0;
+
+	checkErr(RsCore_Write(instrSession, ":FORM REAL,32"));
+	checkErr(RsCore_QueryFloatArrayWithOpc(instrSession, query, timeoutMs, &data, &dataCount));
+
+	if (dataCount <= userBufferLength)
+	{
+		// Copy the whole data
+		memcpy(userBuffer, data, dataCount * sizeof(ViReal64));
+	}
+	else
+	{
+		// Copy the userBufferLength data
+		memcpy(userBuffer, data, userBufferLength * sizeof(ViReal64));
+		error = dataCount;
+	}
+
+	if (actualPointsCount)
+		*actualPointsCount = dataCount;
+
+Error:
+	if (data)
+		RsCore_Free(instrSession, data);
+
+	return error;
 }
 
-/*****************************************************************************************************/
-/*  RsCore_CheckAttributeViReal64
-    Exported type-safe function for checking a ViReal64 attribute
-******************************************************************************************************/
-ViStatus RsCore_CheckAttributeViReal64(ViSession instrSession,
-                                       ViString repCap,
-                                       ViUInt32 attributeId,
-                                       ViInt32 optionFlag,
-                                       ViReal64 value)
+/******************************************************************************************************/
+/*  RsCore_QueryIntegerArrayToUserBuffer
+	The function uses RsCore_QueryIntegerArray to send the query to the instrument,
+	read the array response and copies it to the provided user buffer.
+	The function parses correctly ASCII or BINARY response (it uses RsCore_QueryIntegerArray)
+	If the userBufferLength is smaller than read-out dataCount, the function only copies
+	the maximum provided count of the data and returns positive error number that equals the dataCount.
+	actualPointsCount is allowed to be NULL
+/******************************************************************************************************/
+ViStatus RsCore_QueryIntegerArrayToUserBuffer(ViSession instrSession,
+	ViConstString query,
+	ViInt32 userBufferLength,
+	ViInt32 *userBuffer,
+	ViInt32* actualPointsCount)
 {
-	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
+	ViStatus error = VI_SUCCESS;
+	ViInt32* data = NULL;
+	ViInt32 dataCount = 0;
+
+	checkErr(RsCore_QueryIntegerArray(instrSession, query, &data, &dataCount));
+
+	if (dataCount <= userBufferLength)
+	{
+		// Copy the whole data
+		memcpy(userBuffer, data, dataCount * sizeof(ViInt32));
+	}
+	else
+	{
+		// Copy the userBufferLength data
+		memcpy(userBuffer, data, userBufferLength * sizeof(ViInt32));
+		error = dataCount;
+	}
+
+	if (actualPointsCount)
+		*actualPointsCount = dataCount;
+
+Error:
+	if (data)
+		RsCore_Free(instrSession, data);
+
+	return error;
 }
 
-/*****************************************************************************************************/
-/*  RsCore_CheckAttributeViInt32
-    Exported type-safe function for checking a ViInt32 attribute
-******************************************************************************************************/
-ViStatus RsCore_CheckAttributeViInt32(ViSession instrSession,
-                                      ViString repCap,
-                                      ViUInt32 attributeId,
-                                      ViInt32 optionFlag,
-                                      ViInt32 value)
-{
-	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
-}
+/******************************************************************************************************/
+/*  RsCore_QueryIntegerArrayToUserBufferWithOpc
+	Same as RsCore_QueryIntegerArrayToUserBuffer, but the query is sent with OPC-sync
+	Set the parameter timeoutMs to 0 in order to use the session's OPC timeout
+/******************************************************************************************************/
+ViStatus RsCore_QueryIntegerArrayToUserBufferWithOpc(ViSession instrSession,
+	ViConstString query,
+	ViInt32 timeoutMs,
+	ViInt32 userBufferLength,
+	ViReal64 *userBuffer,
+	ViInt32* actualPointsCount)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32* data = NULL;
+	ViInt32 dataCount = 0;
+
+	checkErr(RsCore_QueryIntegerArrayWithOpc(instrSession, query, timeoutMs, &data, &dataCount));
+
+	if (dataCount <= userBufferLength)
+	{
+		// Copy the whole data
+		memcpy(userBuffer, data, dataCount * sizeof(ViInt32));
+	}
+	else
+	{
+		// Copy the userBufferLength data
+		memcpy(userBuffer, data, userBufferLength * sizeof(ViInt32));
+		error = dataCount;
+	}
+
+	if (actualPointsCount)
+		*actualPointsCount = dataCount;
 
-/*****************************************************************************************************/
-/*  RsCore_CheckAttributeViInt64
-    Exported type-safe function for checking a ViInt64 attribute
-******************************************************************************************************/
-ViStatus RsCore_CheckAttributeViInt64(ViSession instrSession,
-                                      ViString repCap,
-                                      ViUInt32 attributeId,
-                                      ViInt32 optionFlag,
-                                      ViInt64 value)
-{
-	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
-}
+Error:
+	if (data)
+		RsCore_Free(instrSession, data);
 
-/*****************************************************************************************************/
-/*  RsCore_CheckAttributeViString
-    Exported type-safe function for checking a ViString attribute
-******************************************************************************************************/
-#pragma warning( disable : 4090 )
-ViStatus RsCore_CheckAttributeViString(ViSession instrSession,
-                                       ViString repCap,
-                                       ViUInt32 attributeId,
-                                       ViInt32 optionFlag,
-                                       ViConstString value)
-{
-	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, (void*)value);
+	return error;
 }
-#pragma warning( default : 4090 )
 
-/*****************************************************************************************************/
-/*  RsCore_CheckAttributeViBoolean
-    Exported type-safe function for checking a ViBoolean attribute
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Asynchronous OPC-synchronized IO ----------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
-ViStatus RsCore_CheckAttributeViBoolean(ViSession instrSession,
-                                        ViString repCap,
-                                        ViUInt32 attributeId,
-                                        ViInt32 optionFlag,
-                                        ViBoolean value)
-{
-	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
-}
 
 /*****************************************************************************************************/
-/*  RsCore_CheckAttributeViSession
-    Exported type-safe function for checking a ViSession attribute
+/*  RsCore_WriteWithOpcAsync
+    Sends the command with appended *OPC and returns without waiting for the operation to complete.
+    The state of the operation is stored in the caller-allocated handle.
+    Use RsCore_PollOpcHandle or RsCore_WaitForOpcHandles to find out when the operation completes.
+    Set the parameter timeoutMs to 0 in order to use the session's OPC timeout.
+    The opcWaitMode RS_VAL_OPCWAIT_OPCQUERY would block the session, the handle uses STB polling instead.
+    If a custom OPC callback is set (RS_ATTR_OPC_CALLBACK), it can only wait synchronously:
+    the callback is called here and the handle is already completed when the function returns.
+    Do not send any other command to the session until the handle completes.
+    On failure, the handle is completed with the error status.
 ******************************************************************************************************/
-ViStatus RsCore_CheckAttributeViSession(ViSession instrSession,
-                                        ViString repCap,
-                                        ViUInt32 attributeId,
-                                        ViInt32 optionFlag,
-                                        ViSession value)
+ViStatus RsCore_WriteWithOpcAsync(ViSession instrSession, ViConstString command, ViInt32 timeoutMs, RsCoreOpcHandlePtr handle)
 {
-	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
-}
+	ViStatus error = VI_SUCCESS;
+	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE] = "";
+	ViChar* dynBuffer = NULL;
+	ViChar* p2SendBuffer;
+	RsCoreOpcAttrCallback p2opcFunction;
+	void* value = NULL;
+	ViBoolean srqEnabled = VI_FALSE;
+	RsCoreSessionPtr rsSession = NULL;
 
-/*****************************************************************************************************/
-/*  RsCore_CheckAttributeViAddress
-    Exported type-safe function for checking a ViAddress attribute
-******************************************************************************************************/
-ViStatus RsCore_CheckAttributeViAddress(ViSession instrSession,
-                                        ViString repCap,
-                                        ViUInt32 attributeId,
-                                        ViInt32 optionFlag,
-                                        ViAddr value)
-{
-	return RsCoreInt_CheckAttr(instrSession, repCap, attributeId, optionFlag, &value);
+	if (handle == NULL)
+	{
+		viCheckErrElab(RS_ERROR_NULL_POINTER, "RsCore_WriteWithOpcAsync: input parameter handle is NULL");
+	}
+
+	memset(handle, 0, sizeof(RsCoreOpcHandle));
+	handle->instrSession = instrSession;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (isNullOrEmpty(command))
+	{
+		viCheckErrElab(RS_ERROR_INVALID_VALUE, "RsCore_WriteWithOpcAsync: input parameter command is NULL or empty");
+	}
+
+	checkErr(RsCoreInt_ResolveOpcTimeout(instrSession, &timeoutMs));
+	handle->opcTimeoutMs = timeoutMs;
+	handle->opcWaitMode = rsSession->opcWaitMode;
+	if (handle->opcWaitMode == RS_VAL_OPCWAIT_OPCQUERY)
+		handle->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLING;
+
+	checkErr(RsCoreInt_GetAttrP2Value(rsSession->attrOpcCallbackPtr, &value, 0));
+	checkErr(RsCoreInt_BuildOpcCommand(instrSession, command, buffer, &dynBuffer, &p2SendBuffer));
+	checkErr(RsCoreInt_ClearBeforeRead(instrSession));
+
+	// For Service request, clear and allow the SRQ event
+	if (handle->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST)
+	{
+		checkErr(viDiscardEvents(instrSession, VI_EVENT_SERVICE_REQ, VI_QUEUE | VI_SUSPEND_HNDLR));
+		srqEnabled = VI_TRUE;
+		checkErr(viEnableEvent(instrSession, VI_EVENT_SERVICE_REQ, VI_QUEUE, VI_NULL));
+	}
+
+	checkErr(RsCore_Write(instrSession, p2SendBuffer));
+
+	handle->startTimeMs = RsCoreInt_GetTickCountMs();
+	if (RsCore_Simulating(instrSession) == VI_TRUE)
+		goto Error;
+
+	// From now on, the handle completion disables the SRQ event
+	srqEnabled = VI_FALSE;
+	handle->pending = VI_TRUE;
+	if (value != NULL)
+	{
+		// Custom OPC callback, wait for it synchronously
+		p2opcFunction = (RsCoreOpcAttrCallback)(ViAddr *)value;
+		RsCoreInt_LatencyOpcWaitBegin(rsSession);
+		error = p2opcFunction(instrSession, handle->opcTimeoutMs);
+		RsCoreInt_LatencyOpcWaitEnd(rsSession);
+		error = RsCoreInt_CompleteOpcHandle(handle, error);
+	}
+
+Error:
+	if (srqEnabled == VI_TRUE)
+	{
+		(void)viDisableEvent(instrSession, VI_EVENT_SERVICE_REQ, VI_QUEUE); // No error handling
+	}
+
+	if (dynBuffer)
+		RsCore_Free(instrSession, dynBuffer);
+
+	if (handle)
+	{
+		if (error < 0)
+			handle->pending = VI_FALSE;
+
+		handle->status = error;
+	}
+
+	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_GetAttributeFlags
-    Obtains the current values of the flags for the attribute you specify.
+/*  RsCore_SetAttributeEventAsync
+    Asynchronous counterpart of setting an event attribute, e.g. the measurement initiation.
+    Sends the attribute's command for the entered repCapName with RsCore_WriteWithOpcAsync.
+    Set the parameter timeoutMs to 0 in order to use the session's OPC timeout.
 ******************************************************************************************************/
-ViStatus RsCore_GetAttributeFlags(ViSession instrSession,
-                                  ViAttr attributeId,
-                                  RsCoreAttrFlags* flags)
+ViStatus RsCore_SetAttributeEventAsync(ViSession instrSession, ViConstString repCapName, ViAttr attributeId, ViInt32 timeoutMs,
+                                       RsCoreOpcHandlePtr handle)
 {
 	ViStatus error = VI_SUCCESS;
-	RsCoreAttributePtr attr;
+	ViChar* cmd = NULL;
+	RsCoreAttributePtr attr = NULL;
 
 	checkErr(RsCoreInt_GetAttributePtr(instrSession, attributeId, &attr));
 
-	*flags = attr->flags;
+	if (attr->access == RS_VAL_READ_ONLY)
+	{
+		viCheckErr(RS_ERROR_RS_ATTR_NOT_WRITABLE);
+	}
+
+	checkErr(RsCoreInt_CheckAttrInstrModelAndOptions(instrSession, attr));
+	checkErr(RsCore_BuildAttrCommandString(instrSession, attr, repCapName, &cmd));
+	checkErr(RsCore_WriteWithOpcAsync(instrSession, cmd, timeoutMs, handle));
 
 Error:
+	if (cmd)
+		RsCore_Free(instrSession, cmd);
+
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_SetAttributeFlags
-    Sets the flags of an attribute to new values. It always sets all of the flags.
-    If you want to change one flag, use RsCore_GetAttributeFlags to obtain the current values of all
-    the flags, modify the bit for the flag you want to change, and then call RsCore_SetAttributeFlags.
-    You cannot modify the value of the RS_VAL_MULTI_CHANNEL flag.
-******************************************************************************************************/
-ViStatus RsCore_SetAttributeFlags(ViSession instrSession,
-                                  ViAttr attributeId,
-                                  RsCoreAttrFlags flags)
+/*  RsCore_PollOpcHandle
+    Checks once, without blocking, whether the asynchronous OPC operation has completed.
+    If the operation completes with this call, the OPC timeout, CheckStatus and ESR clearing is performed
+    and the operation status is returned. Already completed handle returns its stored status.
+    If the operation's OPC timeout elapses, the handle completes with VI_ERROR_TMO.
+    The parameter completed can be NULL
+******************************************************************************************************/
+ViStatus RsCore_PollOpcHandle(RsCoreOpcHandlePtr handle, ViBoolean* completed)
 {
 	ViStatus error = VI_SUCCESS;
-	RsCoreAttributePtr attr;
+	ViSession instrSession;
+	ViInt32 stb = 0;
+	ViBoolean opcDone = VI_FALSE;
 
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, attributeId, &attr));
+	if (completed)
+		*completed = VI_FALSE;
 
-	attr->flags &= RS_VAL_MULTI_CHANNEL;
-	attr->flags |= (flags & (~RS_VAL_MULTI_CHANNEL));
+	if (handle == NULL)
+		return RS_ERROR_NULL_POINTER;
+
+	instrSession = handle->instrSession;
+	if (handle->pending == VI_FALSE)
+	{
+		if (completed)
+			*completed = VI_TRUE;
+
+		return handle->status;
+	}
+
+	checkErr(RsCore_LockSession(instrSession));
+
+	if (handle->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST)
+	{
+		// Zero timeout only checks the event queue
+		error = viWaitOnEvent(instrSession, VI_EVENT_SERVICE_REQ, 0, VI_NULL, VI_NULL);
+		if (error == VI_SUCCESS)
+		{
+			opcDone = VI_TRUE;
+			error = RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE);
+		}
+		else if (error == VI_ERROR_TMO)
+		{
+			error = VI_SUCCESS;
+		}
+	}
+	else
+	{
+		error = RsCoreInt_GetStatusByte(instrSession, &stb, VI_FALSE);
+		opcDone = ((stb & IEEE_488_2_STB_ESB_MASK) != 0);
+	}
+
+	if (error < VI_SUCCESS)
+	{
+		// IO error ends the operation
+		opcDone = VI_TRUE;
+	}
+	else if ((stb & IEEE_488_2_STB_ERR_QUEUE_MASK) > 0)
+	{
+		opcDone = VI_TRUE;
+		error = RS_ERROR_INSTRUMENT_STATUS;
+	}
+	else if (opcDone == VI_FALSE && RsCoreInt_GetTickCountMs() - handle->startTimeMs > (ViReal64)handle->opcTimeoutMs)
+	{
+		opcDone = VI_TRUE;
+		error = VI_ERROR_TMO;
+	}
+	else
+	{
+		error = VI_SUCCESS;
+	}
+
+	if (opcDone)
+	{
+		error = RsCoreInt_CompleteOpcHandle(handle, error);
+		if (completed)
+			*completed = VI_TRUE;
+	}
+
+	(void)RsCore_UnlockSession(instrSession);
 
 Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_SetAttributeP2Value
-    Internal function that sets the cache value of the entered attribute
-******************************************************************************************************/
-ViStatus RsCore_SetAttributeP2Value(ViSession instrSession, RsCoreAttributePtr attr, void* value)
+/*  RsCore_WaitForOpcHandles
+    Waits for asynchronous OPC operations started on one or more sessions.
+    waitMode RS_VAL_OPC_HANDLE_WAIT_ANY:
+        Returns as soon as one of the pending handles completes, completedIndex is its index
+        and the return value is its status. Handles completed before the call are skipped.
+        If none of the handles is pending, the function returns immediately with completedIndex = -1
+    waitMode RS_VAL_OPC_HANDLE_WAIT_ALL:
+        Returns when all the handles completed. The return value is the first error of the handles,
+        completedIndex is the index of that handle, or -1 if all completed successfully.
+    Set the parameter timeoutMs to 0 to wait until the handles complete or their OPC timeouts elapse.
+    If the timeoutMs elapses first, the function returns VI_ERROR_TMO and the remaining handles stay pending.
+    The parameter completedIndex can be NULL
+******************************************************************************************************/
+ViStatus RsCore_WaitForOpcHandles(RsCoreOpcHandle handles[], ViInt32 handlesCount, ViInt32 waitMode, ViInt32 timeoutMs,
+                                  ViInt32* completedIndex)
 {
 	ViStatus error = VI_SUCCESS;
+	ViStatus opcStatus;
+	ViSession instrSession = 0;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViBoolean completed, anyPending;
+	ViInt32 i, pollingMode, handleMode, pendingCount;
+	ViReal64 elapsedTimeMs;
+	ViReal64 startTimeMs = RsCoreInt_GetTickCountMs();
 
-	switch (attr->dataType)
+	if (completedIndex)
+		*completedIndex = -1;
+
+	if (handles == NULL)
+		return RS_ERROR_NULL_POINTER;
+
+	if (waitMode != RS_VAL_OPC_HANDLE_WAIT_ANY && waitMode != RS_VAL_OPC_HANDLE_WAIT_ALL)
+		return RS_ERROR_INVALID_VALUE;
+
+	do
 	{
-	case RS_VAL_INT32:
-		*(ViInt32 *)attr->p2value = (value) ? *(ViInt32 *)value : 0;
-		break;
-	case RS_VAL_INT64:
-		*(ViInt64 *)attr->p2value = (value) ? *(ViInt64 *)value : 0;
-		break;
-	case RS_VAL_REAL64:
-		*(ViReal64 *)attr->p2value = (value) ? *(ViReal64 *)value : 0;
-		break;
-	case RS_VAL_STRING:
+		anyPending = VI_FALSE;
+		pendingCount = 0;
+		pollingMode = RS_VAL_OPCWAIT_STBPOLLINGSUPERSLOW;
+		for (i = 0; i < handlesCount; i++)
 		{
-			ViChar* newString = (ViString)value;
-			ViInt32 reqBuffer = (ViInt32)strlen(newString) + 1;
-			// If the currently allocated buffer is too small, reallocate it
-			if (reqBuffer > attr->integerDefault)
+			if (handles[i].pending == VI_FALSE)
+				continue;
+
+			opcStatus = RsCore_PollOpcHandle(&handles[i], &completed);
+			if (completed == VI_FALSE)
 			{
-				ViChar* oldP2value = (ViChar *)attr->p2value;
-				if ((attr->p2value = realloc(attr->p2value, reqBuffer)) == NULL)
-				{
-					free(oldP2value);
-					return RS_ERROR_ALLOC;
-				}
+				// Still running, the fastest polling mode of all the pending handles wins
+				anyPending = VI_TRUE;
+				pendingCount++;
+				instrSession = handles[i].instrSession;
+				handleMode = handles[i].opcWaitMode;
+				if (handleMode == RS_VAL_OPCWAIT_SERVICEREQUEST)
+					handleMode = RS_VAL_OPCWAIT_STBPOLLING;
+
+				if (handleMode < pollingMode)
+					pollingMode = handleMode;
+
+				continue;
+			}
 
-				attr->integerDefault = reqBuffer;
+			if (waitMode == RS_VAL_OPC_HANDLE_WAIT_ANY)
+			{
+				if (completedIndex)
+					*completedIndex = i;
+
+				error = opcStatus;
+				goto Error;
 			}
 
-			RsCoreInt_StrcpyMaxLen((ViChar *)attr->p2value, attr->integerDefault, newString);
+			if (opcStatus < VI_SUCCESS && error >= VI_SUCCESS)
+			{
+				error = opcStatus;
+				if (completedIndex)
+					*completedIndex = i;
+			}
+		}
+
+		if (anyPending == VI_FALSE)
 			break;
+
+		elapsedTimeMs = RsCoreInt_GetTickCountMs() - startTimeMs;
+		if (timeoutMs > 0 && elapsedTimeMs > (ViReal64)timeoutMs)
+		{
+			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "RsCore_WaitForOpcHandles: Waiting resulted in timeout. Entered timeout: " _PERCD " ms, "
+			         _PERCD " operation(s) still pending.", timeoutMs, pendingCount);
+			viCheckErrElab(VI_ERROR_TMO, errElab);
 		}
-	case RS_VAL_ADDR:
-		*(ViAddr *)attr->p2value = (value) ? *(ViAddr *)value : 0;
-		break;
-	case RS_VAL_SESSION:
-		*(ViSession *)attr->p2value = (value) ? *(ViSession *)value : 0;
-		break;
-	case RS_VAL_BOOLEAN:
-		*(ViBoolean *)attr->p2value = (value) ? *(ViBoolean *)value : 0;
-		break;
-	case RS_VAL_EVENT:
-		break;
-	case RS_VAL_UNKNOWN_TYPE:
-	default:
-		error = RsCore_GenerateInvalidDataTypeError(instrSession, attr->dataType, "RsCore_SetAttributeP2Value");
+
+		RsCoreInt_PollingDelay(elapsedTimeMs, pollingMode);
 	}
+	while (anyPending == VI_TRUE);
 
+Error:
 	return error;
 }
 
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Instrument Helper IO Functions ------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
 /*****************************************************************************************************/
-/*  RsCore_ApplyAttributeDefaults
-    Applies default attribute values. Optionally exclude inherent attributes from update.
+/*  RsCore_ResetRegistersEseSre
+    Correctly sets the ESE and SRE registers for the current session OPC wait mode
+    Also coerces the session's OPC mode if necessary
 ******************************************************************************************************/
-ViStatus RsCore_ApplyAttributeDefaults(ViSession instrSession, ViBoolean updateInherentAttr)
+ViStatus RsCore_ResetRegistersEseSre(ViSession instrSession)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt32 idx = 0;
-	size_t offset;
-	size_t dataSize = 0;
-	RsCoreAttributePtr attr;
-	void *p2value, *p2default;
 	RsCoreSessionPtr rsSession = NULL;
 
 	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	for (idx = 0; idx < rsSession->attributesCount; idx++)
+	if ((rsSession->vxiCapable == VI_FALSE || rsSession->transport != NULL) && rsSession->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST)
 	{
-		attr = &rsSession->attributes[idx];
-
-		/* Update inherent attributes? */
-		if ((updateInherentAttr == VI_FALSE) && (attr->constant < RS_SPECIFIC_PRIVATE_ATTR_BASE))
-		{
-			/* Inherent attributes are not updated */
-		}
-		else
-		{
-			offset = 0;
-			p2value = attr->p2value;
-			switch (attr->dataType)
-			{
-			case RS_VAL_INT32:
-				dataSize = sizeof(ViInt32);
-				p2default = &attr->integerDefault;
-				break;
-			case RS_VAL_INT64:
-				dataSize = sizeof(ViInt32);
-				p2default = &attr->integerDefault;
-				offset = sizeof(ViInt64) - dataSize;
-				break;
-			case RS_VAL_REAL64:
-				dataSize = sizeof(ViReal64);
-				p2default = &attr->doubleDefault;
-				break;
-			case RS_VAL_STRING:
-				if (attr->stringDefault)
-					dataSize = strlen(attr->stringDefault);
-				else
-					dataSize = 0;
-				p2default = attr->stringDefault;
-				break;
-			case RS_VAL_ADDR:
-				dataSize = sizeof(ViAddr);
-				p2default = &attr->integerDefault;
-				break;
-			case RS_VAL_SESSION:
-				dataSize = sizeof(ViSession);
-				p2default = &attr->sessionDefault;
-				break;
-			case RS_VAL_BOOLEAN:
-				dataSize = sizeof(ViBoolean);
-				p2default = &attr->booleanDefault;
-				break;
-			default:
-				dataSize = sizeof(void *);
-				p2default = &attr->p2value;
-			}
+		// fall back to the StbPolling in case of non-VXI session or a session with a transport
+		rsSession->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLINGSLOW;
+	}
 
-			if (attr->dataType == RS_VAL_STRING)
-			{
-				if (p2default)
-					RsCoreInt_StrcpyMaxLen((ViChar*)p2value, attr->integerDefault, (ViConstString)p2default);
-				else
-					RsCoreInt_StrcpyMaxLen((ViChar*)p2value, attr->integerDefault, "");
-			}
-			else
-			{
-				memset(p2value, 0, dataSize + offset);
-				memcpy(((char*)p2value) + offset, p2default, dataSize);
-			}
-		}
+	// Set the SRE and ESE registers accordingly
+	if (rsSession->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST)
+	{
+		checkErr(RsCore_Write(instrSession, "*ESE 1"));
+		checkErr(RsCore_Write(instrSession, "*SRE 32"));
+	}
+	else
+	{
+		checkErr(RsCore_Write(instrSession, "*ESE 1"));
+		checkErr(RsCore_Write(instrSession, "*SRE 0"));
 	}
 
 Error:
@@ -6319,2321 +12484,3264 @@ Error:
 }
 
 /*****************************************************************************************************/
-/*  RsCore_BuildAttrCommandString
-    Build the attribute's command - replaces its RepCapID parts with the corresponding command values
-	The cmd is always at least RS_MAX_MESSAGE_BUF_SIZE big
-    WARNING!!!: cmd is allocated dynamically in the function. Deallocate it afterwards!
+/*  RsCore_ErrorQuery
+    Queries ONE error from the instrument error queue
+    You have to provide the errMessage with at least 256 bytes buffer
+    The variable 'errorFlag' is set to TRUE, if an error was read out.
+    In case of 'No error', errorFlag is FALSE
 ******************************************************************************************************/
-ViStatus RsCore_BuildAttrCommandString(ViSession instrSession, RsCoreAttributePtr attr, ViConstString repCapsInputString, ViChar** cmd)
+ViStatus RsCore_ErrorQuery(ViSession instrSession, ViInt32* errCode, ViChar* errMessage, ViBoolean* errorFlag)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar repCapCmd[RS_MAX_MESSAGE_LEN];
-	ViChar singleInputRepCap[RS_MAX_MESSAGE_LEN];
-	ViChar singleRepCapNameId[RS_MAX_MESSAGE_BUF_SIZE] = "";
-	ViInt32 index, i, inputRepCapsCount;
-	ViInt32 foundIdx = 0;
-	ViInt32 cmdActualLen = (ViInt32)strlen(attr->command);
-	ViInt32 cmdBufferSize;
-	ViInt32 restLen, repCapIdLen, cmdValueLen, startOffset, resizeOffset;
-	ViChar *p2SearchStart, *p2LeftBracket, *p2RightBracket, *target, *source;
-	RsCoreRepCapPtr repCap;
+	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 code;
+	ViChar* p2message = NULL;
 
-	if (isNullOrEmpty(repCapsInputString))
+	*errorFlag = VI_TRUE;
+	if (RsCore_Simulating(instrSession))
 	{
-		inputRepCapsCount = 0;
+		RsCoreInt_StrcpyMaxLen(buffer, RS_MAX_MESSAGE_BUF_SIZE, "0,\"No error.\"");
 	}
 	else
 	{
-		inputRepCapsCount = RsCore_GetElementsCount(repCapsInputString, ',');
+		checkErr(RsCore_QueryViString(instrSession, "SYST:ERR?", buffer));
 	}
 
-	cmdBufferSize = cmdActualLen + 1;
-	if (cmdBufferSize < RS_MAX_SHORT_MESSAGE_BUF_SIZE)
-		cmdBufferSize = RS_MAX_SHORT_MESSAGE_BUF_SIZE;
+	//Find and split code from the message
+	p2message = strstr(buffer, ",\"");
+	if (p2message == NULL)
+	{
+		code = -1;
+		p2message = buffer;
+	}
+	else
+	{
+		code = atoi(buffer);
+		p2message[0] = 0;
+		p2message ++;
+	}
 
-	viCheckAllocElab(*cmd = (ViChar*)malloc(cmdBufferSize), "Rs_BuildAttrCommandString command malloc");
+	RsCore_TrimString(p2message, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+	RsCoreInt_StrcpyMaxLen(errMessage, 255, p2message);
 
-	RsCoreInt_StrcpyMaxLen(*cmd, cmdBufferSize, attr->command);
-	cmdActualLen = (ViInt32)strlen(*cmd);
-	if (attr->usercaps == VI_TRUE)
+	RsCoreInt_ToLowerCase(p2message);
+	if (code == 0 || (strstr(p2message, "no error") == p2message))
 	{
-		/* Repeated Capabilities */
-		for (index = 0; index < RSCORE_MAX_ATTR_RCAPS; index++)
-		{
-			// Scan repCap from command e.g. 'CAL{Channel}:ZERO{Sensor}:AUTO',
-			// we need the 'Channel' part, in the second iteration then 'Sensor' part
-			p2SearchStart = *cmd;
-			restLen = cmdActualLen;
-			if ((p2LeftBracket = (ViChar *)memchr(p2SearchStart, '{', restLen)) == NULL) break;
-			startOffset = (ViInt32)(p2LeftBracket - p2SearchStart);
-			restLen -= startOffset;
-			if ((p2RightBracket = (ViChar *)memchr(p2LeftBracket, '}', restLen)) == NULL) break;
-			repCapIdLen = (ViInt32)(p2RightBracket - p2LeftBracket) - 1;
-			restLen -= repCapIdLen + 2;
-			memcpy(singleRepCapNameId, p2LeftBracket + 1, repCapIdLen);
-			singleRepCapNameId[repCapIdLen] = 0;
+		*errorFlag = VI_FALSE;
+	}
 
-			// singleRepCapNameId now contains 'Channel', repCapNames is a string 'CH0,CH1,CH2,CH3,CH4'
-			checkErr(RsCoreInt_FindRepCap(instrSession, NULL, singleRepCapNameId, &repCap));
+	if (errCode)
+		*errCode = code;
 
-			// Go through the repCapNames string items and search them in the entered repCapsInputString
-			if (inputRepCapsCount == 0)
-			{
-				// If the repCapsInputString is empty, take the 1st one
-				checkErr(RsCoreInt_GetRepCapCmdAtIndex(instrSession, repCap, 0, RS_MAX_MESSAGE_LEN, repCapCmd, NULL));
-			}
-			else
-			{
-				// inputRepCapsCount are not empty, go through its tokens
-				for (i = 0; i < inputRepCapsCount; i++)
-				{
-					checkErr(RsCore_GetTokenAtIndex(repCapsInputString, ',', i, singleInputRepCap, RS_MAX_MESSAGE_LEN, NULL));
-					checkErr(RsCoreInt_FindRepCapName(instrSession, repCap, singleInputRepCap, VI_FALSE, &foundIdx, NULL));
-					if (foundIdx >= 0)
-					{
-						break;
-					}
-				}
+Error:
+	return error;
+}
 
-				if (foundIdx < 0)
-					foundIdx = 0; // If none of the repCapsInputString tokens contains the singleInputRepCap, take the 1st one
+/*****************************************************************************************************/
+/*  RsCore_ErrorQueryAll
+    Queries ALL errors from the instrument error queue. Returned errCode is from the last error.
+    Returned errors variable contains LF-separated list of error starting with the last one
+******************************************************************************************************/
+ViStatus RsCore_ErrorQueryAll(ViSession instrSession, ViInt32* errCode, ViInt32 bufferSize, ViChar* errors)
+{
+	ViStatus error = VI_SUCCESS;
+	ViBoolean errorFlag;
+	ViInt32 code;
+	ViChar oneEntry[256] = "";
+	ViInt32 i = 0;
 
-				checkErr(RsCoreInt_GetRepCapCmdAtIndex(instrSession, repCap, foundIdx, RS_MAX_MESSAGE_LEN, repCapCmd, NULL));
-			}
+	if (errCode)
+		*errCode = 0;
 
-			// Here, we have the valid command value in repCapCmd
-			cmdValueLen = (ViInt32)strlen(repCapCmd);
-			resizeOffset = cmdValueLen - (repCapIdLen + 2); // negative resizeOffset means the *cmd length shrinks
+	if (bufferSize > 0)
+		RsCoreInt_StrcpyMaxLen(errors, bufferSize, "");
 
-			if (resizeOffset > 0)
-			{
-				if ((cmdActualLen + resizeOffset) >= cmdBufferSize)
-				{
-					// need to reallocate the *cmd to a bigger buffer
-					cmdBufferSize += resizeOffset + 10;
-					viCheckReallocElab(*cmd, (ViChar*)realloc(*cmd, cmdBufferSize), "Memory reallocation for attribute command");
-				}
-			}
+	for (i = 0; i < 50; i++) // 50 is a safety limit
+	{
+		checkErr(RsCore_ErrorQuery(instrSession, &code, oneEntry, &errorFlag));
+		if (errorFlag == VI_FALSE)
+		{
+			break;
+		}
 
-			if (restLen > 0)
-			{
-				// Part after the right bracket is non-empty, move it
-				target = p2LeftBracket + cmdValueLen;
-				source = p2RightBracket + 1;
-				memmove(target, source, restLen + 1); // including '\0'
-				memcpy(p2LeftBracket, repCapCmd, cmdValueLen);
-			}
-			else
-			{
-				// No other characters in the command
-				// Copy the command value, terminate the string and break
-				memcpy(p2LeftBracket, repCapCmd, cmdValueLen + 1); // including '\0'
-				break;
-			}
+		// Error code from the last error
+		if (errCode && *errCode == 0)
+			*errCode = code;
 
-			cmdActualLen = (ViInt32)strlen(*cmd);
-		} /* EOF RepCaps for loop */
+		RsCore_AppendToCsvString(errors, "\n", bufferSize, oneEntry);
+	}
+
+	RsCore_TrimString(errors, RS_VAL_TRIM_WHITESPACES);
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SelfTest
+    Performs standard self-test routine using OPC-synchronized query '*TST?'
+    - selfTestMessage is set to 'Self-Test Passed' if the selfTestResult was 0
+    - selfTestMessage is set to 'Self-Test Failed' if the selfTestResult was not equal 0
+******************************************************************************************************/
+ViStatus RsCore_SelfTest(ViSession instrSession, ViInt16* selfTestResult, ViInt32 bufferSize, ViChar* selfTestMessage)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar buffer[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (RsCore_Simulating(instrSession) == VI_TRUE)
+	{
+		*selfTestResult = 0;
 	}
 	else
 	{
-		RsCoreInt_StrcpyMaxLen(*cmd, cmdActualLen + 1, attr->command);
+		checkErr(RsCore_QueryViStringWithOpc(instrSession, "*TST?", rsSession->selfTestTimeout, RS_MAX_SHORT_MESSAGE_BUF_SIZE, buffer));
+		sscanf(buffer, "%hd", selfTestResult);
 	}
 
+	if (*selfTestResult == 0)
+		RsCoreInt_StrcpyMaxLen(selfTestMessage, bufferSize, "Self-Test Passed.");
+	else
+		RsCoreInt_StrcpyMaxLen(selfTestMessage, bufferSize, "Self-Test Failed.");
+
 Error:
+	(void)RsCore_UnlockSession(instrSession);
+
 	return error;
 }
 
-/****************************************************************************/
-/*  RsCore_WriteAttributeCommand
-    Writes attribute command to instrument. Takes into account the following attribute flags:
-    RS_VAL_WAIT_FOR_OPC_AFTER_WRITES
-    RS_VAL_WAIT_TO_CONTINUE
-  *****************************************************************************/
-ViStatus RsCore_WriteAttributeCommand(ViSession instrSession, RsCoreAttributePtr attr, ViConstString command)
+/*****************************************************************************************************/
+/*  RsCore_CheckStatus
+    Default function to use in the instrument driver to call the session's default CheckStatusCallback
+    If the attribute RS_ATTR_CHECK_STATUS_CALLBACK value is NULL, the core's default RsCore_CheckStatusCallback is used
+******************************************************************************************************/
+ViStatus RsCore_CheckStatus(ViSession instrSession, ViStatus errorBefore)
 {
 	ViStatus error = VI_SUCCESS;
+	RsCoreCheckStatusCallback p2checkStatusFunction;
+	void* value;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	if (attrHasFlag(RS_VAL_WAIT_FOR_OPC_AFTER_WRITES))
-	{
-		return RsCoreInt_WriteWithOpc(instrSession, command, VI_FALSE, 0);
-	}
-	else if (attrHasFlag(RS_VAL_WAIT_TO_CONTINUE))
+	if (rsSession->roundTrip.enabled == VI_TRUE)
+		RsCoreInt_RoundTripStatusCheck(rsSession);
+
+	checkErr(RsCoreInt_GetAttrP2Value(rsSession->attrCheckStatusCallbackPtr, &value, 0));
+	p2checkStatusFunction = (RsCoreCheckStatusCallback)((ViAddr *)value);
+	if (p2checkStatusFunction == NULL)
 	{
-		checkErr(RsCore_Write(instrSession, command));
-		checkErr(RsCore_Write(instrSession, "*WAI"));
+		checkErr(RsCore_CheckStatusCallback(instrSession, errorBefore));
 	}
 	else
 	{
-		// Standard write
-		return RsCore_Write(instrSession, command);
+		checkErr(p2checkStatusFunction(instrSession, errorBefore));
 	}
 
 Error:
-	return error;
-}
-
-/*****************************************************************************************************/
-/*  RsCore_QueryAttributeCommand
-    Queries attribute command from the instrument.
-    The response length is limited to RS_MAX_MESSAGE_BUF_SIZE
-    The response is trimmed for the trailing LF
-    The function takes into account RS_VAL_WAIT_FOR_OPC_AFTER_WRITES and adds the question-mark "?" to the query
-    if not already present. For unlimited response lengths use the RsCore_QueryAttributeCommandUnknownLength()
- *****************************************************************************/
-ViStatus RsCore_QueryAttributeCommand(ViSession instrSession, RsCoreAttributePtr attr, ViConstString query, ViChar* response)
-{
-	return RsCoreInt_QueryAttrCommandUni(instrSession, attr, query, VI_FALSE, &response, NULL);
-}
-
-/*****************************************************************************************************/
-/*  RsCore_QueryAttributeCommandUnknownLength
-    Queries attribute command from the instrument.
-    The response length is unlimited.
-    The response is trimmed for the trailing LF
-    The function takes into account RS_VAL_WAIT_FOR_OPC_AFTER_WRITES and adds the question-mark "?" to the query
-    if not already present.
-    WARNING!!! De-allocated the response buffer afterwards
-******************************************************************************************************/
+	// The writes of the check itself do not count as the writes between the checks
+	if (rsSession != NULL)
+		rsSession->roundTrip.statusChecked = VI_TRUE;
 
-ViStatus RsCore_QueryAttributeCommandUnknownLength(ViSession instrSession, RsCoreAttributePtr attr,
-                                                   ViConstString query, ViChar** response, ViInt32* byteCount)
-{
-	return RsCoreInt_QueryAttrCommandUni(instrSession, attr, query, VI_TRUE, response, byteCount);
+	return error;
 }
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
----- Repeated Capabilities ---------------------------------------------------------------------------*
+---- IO trace ----------------------------------------------------------------------------------------*
 ------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
 
-
 /*****************************************************************************************************/
-/*  RsCore_BuildRepCapTable
-    Creates a unique repeated capability table for the session. A repeated capability table
-    consists of a name that identifies the repeated capability, the identifier strings and command
-    values that are valid for the instrument session.Calling  this function more than once
-    for the same repeated capability will return the RS_ERROR_REPEATED_CAPABILITY_ALREADY_EXISTS error.
-    The RS Library maintains the repeated capability table for the session.
-******************************************************************************************************/
-ViStatus RsCore_BuildRepCapTable(ViSession instrSession, RsCoreRepCapPtr repCapTable)
+/*  RsCore_GetIoTrace
+    Copies up to maxEntries of the most recent IO trace entries of the session, the oldest first
+    The entriesCount returns the number of copied entries
+    The trace is recorded without locking, the function can be called at any time from any thread.
+    Entries being written at the time of the call are skipped
+******************************************************************************************************/
+ViStatus RsCore_GetIoTrace(ViSession instrSession,
+                           ViInt32 maxEntries,
+                           RsCoreIoTraceEntry entries[],
+                           ViInt32* entriesCount)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt32 numberOfRepCaps = 0;
-	size_t table_size = 0;
-	ViInt32 i = 0;
-	ViInt32 bufferSize;
-	RsCoreAttributePtr attr;
 	RsCoreSessionPtr rsSession = NULL;
+	const RsCoreIoTraceEntry* entry;
+	ViUInt32 head;
+	ViUInt32 count;
+	ViUInt32 sequence;
+	ViUInt32 idx;
 
 	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	checkErr(RsCore_InvalidNullPointer(instrSession, entries));
+	checkErr(RsCore_InvalidNullPointer(instrSession, entriesCount));
 
-	if (rsSession->repCapTables)
-	{
-		/* If the session is not being reused (new session created regardless if the same one already exists),
-		the rsSession->repCapTable field shall not be initialized */
-		if (rsSession->reuseSession == VI_FALSE)
-		{
-			viCheckErr(RS_ERROR_REPEATED_CAPABILITY_ALREADY_EXISTS);
-		}
-
-		/* If the session is not being duplicated (already existing session is being reused)
-		the rsSession->repCapTable field may already be initialized
-		In that case, dispose of it in order to reset the RepCap Table */
-		checkErr(RsCoreInt_DisposeRepCapTable(instrSession));
-	}
-
-	/* Determine number of repeated capabilities */
-	for (numberOfRepCaps = 0; repCapTable[numberOfRepCaps].repCapNameId; numberOfRepCaps++);
+	*entriesCount = 0;
+	head = rsSession->ioTrace.head;
+	RsCoreInt_ReadBarrier();
 
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, RS_ATTR_CHANNEL_COUNT, &attr));
-	rsSession->repCapsCount = numberOfRepCaps;
-	*(ViInt32*)attr->p2value = numberOfRepCaps;
+	count = head < RS_IO_TRACE_ENTRIES ? head : RS_IO_TRACE_ENTRIES;
+	if (maxEntries < 0)
+		count = 0;
+	else if ((ViUInt32)maxEntries < count)
+		count = (ViUInt32)maxEntries;
 
-	/* Allocate memory for session based repeated capabilities */
-	table_size = (size_t)(numberOfRepCaps * sizeof(repCapTable[0]));
-	checkAlloc(rsSession->repCapTables = (RsCoreRepCapPtr)malloc(table_size));
-	for (i = 0; i < numberOfRepCaps; i++)
+	for (idx = head - count; idx != head; idx++)
 	{
-		bufferSize = (ViInt32)strlen(repCapTable[i].repCapNameId) + 1;
-		checkAlloc(rsSession->repCapTables[i].repCapNameId = (ViChar*)malloc(bufferSize));
-		RsCoreInt_StrcpyMaxLen(rsSession->repCapTables[i].repCapNameId, bufferSize, repCapTable[i].repCapNameId);
+		entry = &rsSession->ioTrace.entries[idx & (RS_IO_TRACE_ENTRIES - 1)];
+		sequence = entry->sequence;
+		if (sequence != idx + 1)
+			continue;
 
-		bufferSize = (ViInt32)strlen(repCapTable[i].repCapNames) + 1;
-		checkAlloc(rsSession->repCapTables[i].repCapNames = (ViChar*)malloc(bufferSize));
-		RsCoreInt_StrcpyMaxLen(rsSession->repCapTables[i].repCapNames, bufferSize, repCapTable[i].repCapNames);
+		RsCoreInt_ReadBarrier();
+		memcpy((void*)&entries[*entriesCount], (const void*)entry, sizeof(RsCoreIoTraceEntry));
+		RsCoreInt_ReadBarrier();
 
-		bufferSize = (ViInt32)strlen(repCapTable[i].cmdValues) + 1;
-		checkAlloc(rsSession->repCapTables[i].cmdValues = (ViChar*)malloc(bufferSize));
-		RsCoreInt_StrcpyMaxLen(rsSession->repCapTables[i].cmdValues, bufferSize, repCapTable[i].cmdValues);
+		if (entry->sequence == sequence)
+			(*entriesCount)++;
 	}
 
 Error:
 	return error;
 }
 
-/******************************************************************************************************
-* Function: RsCore_ResetRepCapTable
-* Purpose:  This function removes all existing repeated capabilities and
-*           creates the table again with default values
-*
+/*****************************************************************************************************/
+/*  RsCore_DumpIoTrace
+    Writes the IO trace of the session as text to the file. If the fileName is NULL or empty,
+    the trace is written to the standard output. Times are in microseconds relative to the first entry
 ******************************************************************************************************/
-ViStatus RsCore_ResetRepCapTable(ViSession instrSession, RsCoreRepCapPtr repCapTable)
+ViStatus RsCore_DumpIoTrace(ViSession instrSession, ViConstString fileName)
 {
 	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+	RsCoreIoTraceEntry* entries = NULL;
+	ViInt32 entriesCount = 0;
+	ViInt32 idx;
+	FILE* file = stdout;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar data[RS_IO_TRACE_DATA_LEN * 4 + 8];
+	ViChar duration[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViUInt64 baseNs;
 
-	checkErr(RsCoreInt_DisposeRepCapTable(instrSession));
-	checkErr(RsCore_BuildRepCapTable(instrSession, repCapTable));
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	viCheckAllocElab(entries = (RsCoreIoTraceEntry*)RsCore_Malloc(instrSession, RS_IO_TRACE_ENTRIES * sizeof(RsCoreIoTraceEntry)),
+		"RsCore_DumpIoTrace: Allocation of the IO trace copy");
+	checkErr(RsCore_GetIoTrace(instrSession, RS_IO_TRACE_ENTRIES, entries, &entriesCount));
+
+	if (fileName != NULL && strlen(fileName) > 0 && (file = fopen(fileName, "w")) == NULL)
+	{
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "RsCore_DumpIoTrace: File '%s' cannot be opened for writing", fileName);
+		viCheckErrElab(RS_ERROR_CANNOT_OPEN_FILE, errElab);
+	}
+
+	baseNs = entriesCount > 0 ? entries[0].startNs : 0;
+	fprintf(file, "IO trace of '%s', " _PERCD " entries\n", rsSession->resourceName, entriesCount);
+	fprintf(file, "%10s %2s %14s %12s %11s %10s %10s  %s\n", "Sequence", "Op", "Start[us]", "Duration[us]", "Status", "Requested",
+	        "Transfer", "Data");
+
+	for (idx = 0; idx < entriesCount; idx++)
+	{
+		if (entries[idx].endNs == 0)
+			RsCoreInt_StrcpyMaxLen(duration, RS_MAX_SHORT_MESSAGE_BUF_SIZE, "pending");
+		else
+			snprintf(duration, RS_MAX_SHORT_MESSAGE_BUF_SIZE, "%.3f", (ViReal64)(entries[idx].endNs - entries[idx].startNs) / 1000.0);
+
+		RsCoreInt_IoTraceFormatData(&entries[idx], (ViInt32)sizeof(data), data);
+		fprintf(file, "%10lu %2c %14.3f %12s 0x%08lX %10lu %10lu  %s\n", (unsigned long)entries[idx].sequence, (char)entries[idx].operation,
+		        (ViReal64)(entries[idx].startNs - baseNs) / 1000.0, duration, (unsigned long)(ViUInt32)entries[idx].status,
+		        (unsigned long)entries[idx].requestedCount, (unsigned long)entries[idx].transferredCount, data);
+	}
+
+	if (fflush(file) != 0)
+	{
+		viCheckErrElab(RS_ERROR_WRITING_FILE, "RsCore_DumpIoTrace: Writing the IO trace failed");
+	}
 
 Error:
+	if (file != NULL && file != stdout)
+		(void)fclose(file);
+
+	if (entries)
+		RsCore_Free(instrSession, entries);
 
 	return error;
 }
 
-/*****************************************************************************************************/
-/*  RsCore_GetAttributeRepCapName
-    Function used by Hi-level functions to obtain a repCap name from:
-    - attributeID
-    - repCapNameID
-    - 0-based index in the repCapNames
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Driver function latency -------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
-ViStatus RsCore_GetAttributeRepCapName(ViSession instrSession,
-                                       ViUInt32 attributeId,
-                                       ViString repCapNameId,
-                                       ViInt32 index,
-                                       ViInt32 bufferSize,
-                                       ViChar* repCapName)
+
+/*****************************************************************************************************/
+/*  RsCore_GetFunctionLatency
+    Returns the latency summary of the driver function for the component:
+    RS_VAL_LATENCY_TOTAL | RS_VAL_LATENCY_HOST_CPU | RS_VAL_LATENCY_IO_WAIT | RS_VAL_LATENCY_OPC_WAIT
+    Functions that were not called yet return the stats with the count 0
+******************************************************************************************************/
+ViStatus RsCore_GetFunctionLatency(ViSession instrSession,
+                                   ViConstString functionName,
+                                   ViInt32 component,
+                                   RsCoreLatencyStats* stats)
 {
 	ViStatus error = VI_SUCCESS;
-	RsCoreAttributePtr attr;
-	RsCoreRepCapPtr repCap;
+	RsCoreSessionPtr rsSession = NULL;
+	RsCoreFunctionLatencyPtr latency;
 	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
 
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, attributeId, &attr));
-	checkErr(RsCoreInt_FindRepCap(instrSession, NULL, repCapNameId, &repCap));
-	checkErr(RsCoreInt_ValidateAttrForRepCap(instrSession, repCap, attr));
-	checkErr(RsCoreInt_GetRepCapNameAtIndex(instrSession, repCap, index, bufferSize, repCapName, NULL));
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	checkErr(RsCore_InvalidNullPointer(instrSession, (void*)functionName));
+	checkErr(RsCore_InvalidNullPointer(instrSession, stats));
 
-Error:
-	switch (error)
+	if (component < RS_VAL_LATENCY_TOTAL || component >= RS_LATENCY_COMPONENTS)
 	{
-	case RS_ERROR_INVALID_ATTRIBUTE:
-		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Attribute ID " _PERCU " is invalid", attributeId);
-		(void)RsCore_SetErrorInfo(instrSession, VI_FALSE, error, VI_FALSE, errElab);
-		break;
-	case RS_ERROR_ATTRIBUTE_NOT_SUPPORTED:
-		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Attribute ID " _PERCU " is not supported", attributeId);
-		(void)RsCore_SetErrorInfo(instrSession, VI_FALSE, error, VI_FALSE, errElab);
-		break;
-	default:
-		break;
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "RsCore_GetFunctionLatency: Invalid latency component " _PERCD, component);
+		viCheckErrElab(RS_ERROR_INVALID_VALUE, errElab);
 	}
 
-	return error;
-}
+	memset(stats, 0, sizeof(RsCoreLatencyStats));
 
-/*****************************************************************************************************/
-/*  RsCore_GetAttributeRepCapNameIds
-	Returns the repeated capability IDs that belongs to the attribute you specify.
-	More then one id is listed in comma separated string.
-	Example: Attr command: 'SENS{Channel}:TGAT{Timegate}:TIME'
-	Returned repCapNameIds:  'Channel,Timegate'
-******************************************************************************************************/
-ViStatus RsCore_GetAttributeRepCapNameIds(ViSession instrSession, ViUInt32 attributeId, ViInt32 bufferSize, ViChar* repCapNameIds)
-{
-	ViStatus error = VI_SUCCESS;
-	RsCoreAttributePtr attr = NULL;
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	latency = RsCoreInt_FindFunctionLatency(rsSession, functionName, VI_FALSE);
+	if (latency != NULL)
+		RsCoreInt_LatencyHistogramStats(&latency->histograms[component], stats);
 
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, attributeId, &attr));
-	checkErr(RsCoreInt_GetAttrRepCapNameIds(instrSession, attr, bufferSize, repCapNameIds));
+	RsCoreInt_MutexUnlock(gMutex);
 
 Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_GetAttributeRepCapNamesAll
-	Returns all the repCapNames defined for the entered repCapNameId
-	More then one name is listed in comma separated string.
-	Example: Attr command: 'SENS{Channel}:TGAT{Timegate}:TIME'
-	Entered repCapNameId = 'Channel'
-	Returned repCapNames:  'CH0,CH1,CH2,CH3,CH4'
+/*  RsCore_GetFunctionLatencyNames
+    Returns comma-separated names of the driver functions with the latency histograms, in the order of their first call
 ******************************************************************************************************/
-ViStatus RsCore_GetAttributeRepCapNamesAll(ViSession instrSession, ViUInt32 attributeId, ViConstString repCapNameId, ViInt32 bufferSize,
-                                           ViChar* repCapNames)
+ViStatus RsCore_GetFunctionLatencyNames(ViSession instrSession, ViInt32 bufferSize, ViChar* functionNames)
 {
 	ViStatus error = VI_SUCCESS;
-	RsCoreAttributePtr attr = NULL;
-	RsCoreRepCapPtr repCap;
+	RsCoreSessionPtr rsSession = NULL;
+	ViInt32 idx;
 
-	checkErr(RsCoreInt_GetAttributePtr(instrSession, attributeId, &attr));
-	checkErr(RsCoreInt_FindRepCap(instrSession, NULL, repCapNameId, &repCap));
-	checkErr(RsCoreInt_ValidateAttrForRepCap(instrSession, repCap, attr));
-	RsCoreInt_StrcpyMaxLen(repCapNames, bufferSize, repCap->repCapNames);
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	checkErr(RsCore_InvalidNullPointer(instrSession, functionNames));
+
+	if (bufferSize < 1)
+	{
+		viCheckErrElab(RS_ERROR_INVALID_VALUE, "RsCore_GetFunctionLatencyNames: The bufferSize must be at least 1");
+	}
+
+	functionNames[0] = '\0';
+
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	for (idx = 0; idx < rsSession->functionLatenciesCount; idx++)
+	{
+		RsCore_StrcatMaxLen(functionNames, bufferSize, idx > 0 ? "," : "", rsSession->functionLatencies[idx].functionName, NULL);
+	}
+
+	RsCoreInt_MutexUnlock(gMutex);
 
 Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_AddRepCap
-    Adds a new dynamic repCapName to the specified repCapNameId.
-    If the repCapName already exists, the function ends with no changes and no error
+/*  RsCore_DumpFunctionLatency
+    Writes the latency summary of all the called driver functions as text to the file.
+    If the fileName is NULL or empty, the summary is written to the standard output. Times are in microseconds
 ******************************************************************************************************/
-ViStatus RsCore_AddRepCap(ViSession instrSession,
-                          ViString repCapNameId,
-                          ViString repCapName,
-                          ViString cmdValue)
+ViStatus RsCore_DumpFunctionLatency(ViSession instrSession, ViConstString fileName)
 {
+	static ViConstString componentNames[RS_LATENCY_COMPONENTS] = {"total", "host_cpu", "io_wait", "opc_wait"};
 	ViStatus error = VI_SUCCESS;
-	ViInt32 namesBufferSize, cmdsBufferSize;
-	RsCoreRepCapPtr repCap;
-	ViInt32 foundIdx;
+	RsCoreSessionPtr rsSession = NULL;
+	RsCoreFunctionLatencyPtr snapshot = NULL;
+	RsCoreLatencyStats stats;
+	ViInt32 count = 0;
+	ViInt32 idx;
+	ViInt32 component;
+	FILE* file = stdout;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
 
-	if (isNullOrEmpty(repCapName))
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	// Copy the histograms, the file is written without holding the global mutex
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	count = rsSession->functionLatenciesCount;
+	if (count > 0 && (snapshot = (RsCoreFunctionLatencyPtr)RsCore_Malloc(instrSession, count * sizeof(RsCoreFunctionLatency))) != NULL)
+		memcpy(snapshot, rsSession->functionLatencies, count * sizeof(RsCoreFunctionLatency));
+
+	RsCoreInt_MutexUnlock(gMutex);
+
+	if (count > 0)
 	{
-		viCheckErrElab(RS_ERROR_NULL_POINTER, "Rs_AddRepCap: repCapName is NULL or empty");
+		viCheckAllocElab(snapshot, "RsCore_DumpFunctionLatency: Allocation of the latency histograms copy");
 	}
 
-	if (cmdValue == NULL)
+	if (fileName != NULL && strlen(fileName) > 0 && (file = fopen(fileName, "w")) == NULL)
 	{
-		viCheckErrElab(RS_ERROR_NULL_POINTER, "Rs_AddRepCap: cmdValue is NULL");
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "RsCore_DumpFunctionLatency: File '%s' cannot be opened for writing", fileName);
+		viCheckErrElab(RS_ERROR_CANNOT_OPEN_FILE, errElab);
 	}
 
-	checkErr(RsCoreInt_FindRepCap(instrSession, NULL, repCapNameId, &repCap));
-	checkErr(RsCoreInt_FindRepCapName(instrSession, repCap, repCapName, VI_FALSE, &foundIdx, NULL));
+	fprintf(file, "Function latency of '%s', " _PERCD " functions, times in us\n", rsSession->resourceName, count);
+	fprintf(file, "%-48s %-9s %10s %12s %12s %12s %12s %12s %12s %12s\n", "Function", "Component", "Count", "Min", "Mean", "P50", "P90",
+	        "P99", "P99.9", "Max");
 
-	if (foundIdx >= 0)
+	for (idx = 0; idx < count; idx++)
 	{
-		// RepCapName already exists, end the function
-		goto Error;
+		for (component = 0; component < RS_LATENCY_COMPONENTS; component++)
+		{
+			RsCoreInt_LatencyHistogramStats(&snapshot[idx].histograms[component], &stats);
+			fprintf(file, "%-48s %-9s %10lu %12.3f %12.3f %12.3f %12.3f %12.3f %12.3f %12.3f\n", snapshot[idx].functionName,
+			        componentNames[component], (unsigned long)stats.count, stats.minUs, stats.meanUs, stats.p50Us, stats.p90Us, stats.p99Us,
+			        stats.p999Us, stats.maxUs);
+		}
 	}
 
-	// RepCapNames expansion
-	namesBufferSize = (ViInt32)strlen(repCap->repCapNames) + (ViInt32)strlen(repCapName) + 2;
-	viCheckReallocElab(repCap->repCapNames, (ViChar*)realloc(repCap->repCapNames, namesBufferSize), "Rs_AddRepCap: allocated space for repCapName");
+	if (fflush(file) != 0)
+	{
+		viCheckErrElab(RS_ERROR_WRITING_FILE, "RsCore_DumpFunctionLatency: Writing the function latency failed");
+	}
 
-	// RepCapCmdValues expansion
-	cmdsBufferSize = (ViInt32)strlen(repCap->cmdValues) + (ViInt32)strlen(cmdValue) + 2;
-	viCheckReallocElab(repCap->cmdValues, (ViChar*)realloc(repCap->cmdValues, cmdsBufferSize), "Rs_AddRepCap: allocated space for cmdValues");
+Error:
+	if (file != NULL && file != stdout)
+		(void)fclose(file);
 
-	RsCore_AppendToCsvString(repCap->repCapNames, ",", namesBufferSize, repCapName);
-	RsCore_AppendToCsvString(repCap->cmdValues, ",", cmdsBufferSize, cmdValue);
+	if (snapshot)
+		RsCore_Free(instrSession, snapshot);
+
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ResetFunctionLatency
+    Clears the latency histograms of all the driver functions
+******************************************************************************************************/
+ViStatus RsCore_ResetFunctionLatency(ViSession instrSession)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	rsSession->functionLatenciesCount = 0;
+	RsCoreInt_MutexUnlock(gMutex);
 
 Error:
 	return error;
 }
 
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Round-trip diagnostics --------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
 /*****************************************************************************************************/
-/*  RsCore_RemoveRepCap
-    Removes existing dynamic repeated capability.
+/*  RsCore_SetRoundTripDiagnostics
+    Switches the round-trip diagnostics ON or OFF. Same as the option string token 'RoundTripDiagnostics'
+    When ON, the IO operations of each driver function are counted and the redundant patterns are flagged:
+    identical consecutive writes, repeated FORM commands, status checks with no write in between
+    and OPC timeout changes without any OPC-synchronized operation
 ******************************************************************************************************/
-ViStatus RsCore_RemoveRepCap(ViSession instrSession,
-                             ViString repCapNameId,
-                             ViString repCapName)
+ViStatus RsCore_SetRoundTripDiagnostics(ViSession instrSession, ViBoolean enabled)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt32 repCapNameLen, repCapCmdLen;
-	ViInt32 foundIdx;
-	ViInt32 startOffsetName, startOffsetCmd;
-	ViChar *target = NULL, *source = NULL;
-	ViInt32 rcCount;
-	ViChar cmdValue[RS_MAX_MESSAGE_LEN] = "";
-	RsCoreRepCapPtr repCap;
-
-	if (isNullOrEmpty(repCapName))
-	{
-		viCheckErrElab(RS_ERROR_NULL_POINTER, "RemoveRepCap: repCapName is NULL or empty");
-	}
-
-	checkErr(RsCoreInt_FindRepCap(instrSession, NULL, repCapNameId, &repCap));
-	checkErr(RsCoreInt_FindRepCapName(instrSession, repCap, repCapName, VI_TRUE, &foundIdx, &startOffsetName));
-	checkErr(RsCoreInt_GetRepCapCmdAtIndex(instrSession, repCap, foundIdx, RS_MAX_MESSAGE_LEN, cmdValue, &startOffsetCmd));
-	checkErr(RsCoreInt_GetRepCapCount(instrSession, repCap, &rcCount));
+	RsCoreSessionPtr rsSession = NULL;
 
-	repCapNameLen = (ViInt32)strlen(repCapName);
-	repCapCmdLen = (ViInt32)strlen(cmdValue);
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	if (rcCount == 1)
-	{
-		// Remove the last remaining repCap
-		repCap->repCapNames[0] = 0;
-		repCap->cmdValues[0] = 0;
-	}
-	else if (foundIdx == (ViInt32)rcCount - 1)
+	if (enabled == VI_TRUE && rsSession->roundTrip.enabled == VI_FALSE)
 	{
-		// RepCapName is at the last position, fill startOffset with zeroes
-		memset(repCap->repCapNames + startOffsetName - 1, 0, (size_t)(repCapNameLen + 2));
-		memset(repCap->cmdValues + startOffsetCmd - 1, 0, (size_t)(repCapCmdLen + 2));
+		// Start without the history, the FORM commands and the writes sent before are not known
+		memset(&rsSession->roundTrip, 0, sizeof(RsCoreRoundTripState));
 	}
-	else
-	{
-		// Somewhere 0..n-1, but not the last one. Move the rest after it to its place.
-		target = repCap->repCapNames + startOffsetName;
-		source = target + repCapNameLen + 1;
-		memmove(target, source, strlen(source) + 1);
 
-		target = repCap->cmdValues + startOffsetCmd;
-		source = target + repCapCmdLen + 1;
-		memmove(target, source, strlen(source) + 1);
-	}
+	rsSession->roundTrip.enabled = enabled ? VI_TRUE : VI_FALSE;
 
 Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_ResetRepCapID
-    Sets selected repeated capability to it default value
-    You have to provide the complete list of the default Repeated Capabilities Table
+/*  RsCore_GetRoundTripStats
+    Returns the round-trip statistics of the driver function
+    Functions that were not called with the round-trip diagnostics ON return the stats with the calls 0
 ******************************************************************************************************/
-ViStatus RsCore_ResetRepCapID(ViSession instrSession,
-                              ViString repCapNameId, RsCoreRepCapPtr repCapTable)
+ViStatus RsCore_GetRoundTripStats(ViSession instrSession, ViConstString functionName, RsCoreRoundTripStats* stats)
 {
 	ViStatus error = VI_SUCCESS;
-	RsCoreRepCapPtr defaultRepCap = NULL;
-	RsCoreRepCapPtr repCap = NULL;
-	ViInt32 bufferSize;
-
-	checkErr(RsCoreInt_FindRepCap(instrSession, repCapTable, repCapNameId, &defaultRepCap));
-	checkErr(RsCoreInt_FindRepCap(instrSession, NULL, repCapNameId, &repCap));
+	RsCoreSessionPtr rsSession = NULL;
+	RsCoreFunctionLatencyPtr latency;
 
-	if (repCap->repCapNames)
-		free(repCap->repCapNames);
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	checkErr(RsCore_InvalidNullPointer(instrSession, (void*)functionName));
+	checkErr(RsCore_InvalidNullPointer(instrSession, stats));
 
-	if (repCap->cmdValues)
-		free(repCap->cmdValues);
+	memset(stats, 0, sizeof(RsCoreRoundTripStats));
 
-	bufferSize = (ViInt32)strlen(defaultRepCap->repCapNames) + 1;
-	viCheckAllocElab(repCap->repCapNames = (ViChar*)malloc(bufferSize), "Allocation of buffer for default RepCapNames");
-	RsCoreInt_StrcpyMaxLen(repCap->repCapNames, bufferSize, defaultRepCap->repCapNames);
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	latency = RsCoreInt_FindFunctionLatency(rsSession, functionName, VI_FALSE);
+	if (latency != NULL)
+		memcpy(stats, &latency->roundTrips, sizeof(RsCoreRoundTripStats));
 
-	bufferSize = (ViInt32)strlen(defaultRepCap->cmdValues) + 1;
-	viCheckAllocElab(repCap->cmdValues = (ViChar*)malloc(bufferSize), "Allocation of buffer for default RepCapCmdValues");
-	RsCoreInt_StrcpyMaxLen(repCap->cmdValues, bufferSize, defaultRepCap->cmdValues);
+	RsCoreInt_MutexUnlock(gMutex);
 
 Error:
 	return error;
 }
 
-/******************************************************************************************************
-------------------------------------------------------------------------------------------------------*
----- Range Tables ------------------------------------------------------------------------------------*
-------------------------------------------------------------------------------------------------------*
-******************************************************************************************************/
-
 /*****************************************************************************************************/
-/*  RsCore_FindDiscreteRangeTableNumericValue
-    Finds the entered cmdString in the discrete range table and returns the corresponding numericValue
-    If the cmdString is not found, the function returns RS_ERROR_INVALID_VALUE
-    Based on if rsSession->recogniseLongResponses:
-    If FALSE, the cmdString must be exactly equal to the rangeTable value, e.g. cmdString = 'ENABLED', rangeTable.cmdString = 'ENABLED'
-    If TRUE, the cmdString can be a longer version of the rangeTable value, e.g. cmdString = 'ENABLED', rangeTable.cmdString = 'ENAB'
+/*  RsCore_DumpRoundTripReport
+    Writes the round-trip report of the driver functions called with the round-trip diagnostics ON.
+    For each function: number of calls, round trips per call, IO operations and the redundant patterns
+    with the first example. Functions with the most round trips are listed first.
+    If the fileName is NULL or empty, the report is written to the standard output
 ******************************************************************************************************/
-ViStatus RsCore_FindDiscreteRangeTableNumericValue(ViSession instrSession, RsCoreRangeTablePtr rangeTable,
-                                                   ViConstString cmdString, ViReal64* numericValue)
+ViStatus RsCore_DumpRoundTripReport(ViSession instrSession, ViConstString fileName)
 {
+	static ViConstString patternNames[RS_REDUNDANT_PATTERNS] = {"identical write", "repeated FORM", "status check", "OPC timeout"};
 	ViStatus error = VI_SUCCESS;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	ViInt32 i = 0;
-	ViInt32 foundIdx = -1;
 	RsCoreSessionPtr rsSession = NULL;
+	RsCoreFunctionLatencyPtr snapshot = NULL;
+	RsCoreFunctionLatency swap;
+	RsCoreRoundTripStats* stats;
+	ViUInt64 roundTrips;
+	ViUInt64 otherRoundTrips;
+	ViInt32 count = 0;
+	ViInt32 idx;
+	ViInt32 other;
+	ViInt32 pattern;
+	FILE* file = stdout;
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
 
 	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	// Go over range table values and check if the command string is present
-	while (rangeTable->rangeValues[i].cmdValue != RS_RANGE_TABLE_END_VALUE && i < 99999)
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	count = rsSession->functionLatenciesCount;
+	if (count > 0 && (snapshot = (RsCoreFunctionLatencyPtr)RsCore_Malloc(instrSession, count * sizeof(RsCoreFunctionLatency))) != NULL)
+		memcpy(snapshot, rsSession->functionLatencies, count * sizeof(RsCoreFunctionLatency));
+
+	RsCoreInt_MutexUnlock(gMutex);
+
+	if (count > 0)
 	{
-		if (rsSession->recogniseLongResponses)
-		{
-			if (strncmp(rangeTable->rangeValues[i].cmdString, cmdString, strlen(rangeTable->rangeValues[i].cmdString)) == 0)
-			{
-				foundIdx = i;
-				break;
-			}
-		}
-		else
+		viCheckAllocElab(snapshot, "RsCore_DumpRoundTripReport: Allocation of the function statistics copy");
+	}
+
+	// Sort by the total round trips, the list is short
+	for (idx = 0; idx < count; idx++)
+	{
+		for (other = idx + 1; other < count; other++)
 		{
-			if (strcmp(rangeTable->rangeValues[i].cmdString, cmdString) == 0)
+			stats = &snapshot[idx].roundTrips;
+			roundTrips = stats->writes + stats->reads + stats->statusByteReads + stats->clears;
+			stats = &snapshot[other].roundTrips;
+			otherRoundTrips = stats->writes + stats->reads + stats->statusByteReads + stats->clears;
+			if (otherRoundTrips > roundTrips)
 			{
-				foundIdx = i;
-				break;
+				swap = snapshot[idx];
+				snapshot[idx] = snapshot[other];
+				snapshot[other] = swap;
 			}
 		}
-
-		i++;
 	}
-	if (i >= 99999)
+
+	if (fileName != NULL && strlen(fileName) > 0 && (file = fopen(fileName, "w")) == NULL)
 	{
-		viCheckErrElab(RS_ERROR_INVALID_RANGE_TABLE, "RsCore_FindDiscreteRangeTableNumericValue: The Range table has improper ending");
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "RsCore_DumpRoundTripReport: File '%s' cannot be opened for writing", fileName);
+		viCheckErrElab(RS_ERROR_CANNOT_OPEN_FILE, errElab);
 	}
 
-	if (foundIdx == -1)
+	fprintf(file, "Round-trip report of '%s'\n", rsSession->resourceName);
+	fprintf(file, "%-48s %10s %10s %8s %10s %10s %10s %10s\n", "Function", "Calls", "RT/call", "Max RT", "Writes", "Reads", "STB reads",
+	        "Clears");
+
+	for (idx = 0; idx < count; idx++)
 	{
-		*numericValue = INFINITY;
-		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Cannot find the instrument response '%s' in the list of recognized values: ", cmdString);
-		// Compose list of the range table cmd Values
-		RsCoreInt_AppendDiscreteRangeTableList(rangeTable, RS_VAL_STRING, RS_MAX_MESSAGE_BUF_SIZE, errElab);
-		viCheckErrElab(RS_ERROR_INVALID_VALUE, errElab);
+		stats = &snapshot[idx].roundTrips;
+		if (stats->calls == 0)
+			continue;
+
+		roundTrips = stats->writes + stats->reads + stats->statusByteReads + stats->clears;
+		fprintf(file, "%-48s %10lu %10.2f %8lu %10lu %10lu %10lu %10lu\n", snapshot[idx].functionName, (unsigned long)stats->calls,
+		        (ViReal64)roundTrips / (ViReal64)stats->calls, (unsigned long)stats->maxRoundTrips, (unsigned long)stats->writes,
+		        (unsigned long)stats->reads, (unsigned long)stats->statusByteReads, (unsigned long)stats->clears);
+
+		for (pattern = 0; pattern < RS_REDUNDANT_PATTERNS; pattern++)
+		{
+			if (stats->redundant[pattern] > 0)
+				fprintf(file, "    redundant %-15s %10lu  e.g. '%s'\n", patternNames[pattern], (unsigned long)stats->redundant[pattern],
+				        stats->examples[pattern]);
+		}
 	}
-	else
+
+	if (fflush(file) != 0)
 	{
-		*numericValue = rangeTable->rangeValues[foundIdx].discreteOrMinValue;
+		viCheckErrElab(RS_ERROR_WRITING_FILE, "RsCore_DumpRoundTripReport: Writing the round-trip report failed");
 	}
 
 Error:
-	return error;
-}
+	if (file != NULL && file != stdout)
+		(void)fclose(file);
 
-/*****************************************************************************************************/
-/*  RsCore_FindRangeTableCmdStringViReal64
-	Finds the numericValue in the range table and returns the corresponding command string
-	If the value is not found, the function returns RS_ERROR_INVALID_VALUE
-	Precision for dataType RS_VAL_INT32 is coerced to DBL_MIN
-	Warning!!! The function returns the pointer to the actual cmd value in the range table,
-	do not modify the value
-******************************************************************************************************/
-ViStatus RsCore_FindRangeTableCmdStringViReal64(ViSession instrSession, RsCoreRangeTablePtr rangeTable, ViReal64 rangeTableValue,
-                                                ViReal64 precision, ViChar** p2cmdString)
-{
-	return RsCoreInt_FindDiscreteRangeTableCmdString(instrSession, rangeTable, RS_VAL_REAL64, rangeTableValue, precision, p2cmdString);
-}
+	if (snapshot)
+		RsCore_Free(instrSession, snapshot);
 
-/*****************************************************************************************************/
-/*  RsCore_FindRangeTableCmdString
-	Finds the numericValue in the range table and returns the corresponding command string
-	If the value is not found, the function returns RS_ERROR_INVALID_VALUE
-	Warning!!! The function returns the pointer to the actual cmd value in the range table,
-	do not modify the value
-******************************************************************************************************/
-ViStatus RsCore_FindRangeTableCmdString(ViSession instrSession, RsCoreRangeTablePtr rangeTable, ViInt32 rangeTableValue, ViChar** p2cmdString)
-{
-	return RsCoreInt_FindDiscreteRangeTableCmdString(instrSession, rangeTable, RS_VAL_INT32, rangeTableValue, DBL_MIN, p2cmdString);
+	return error;
 }
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
----- Instrument ASCII IO -----------------------------------------------------------------------------*
+---- Memory allocation -------------------------------------------------------------------------------*
 ------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
 
 /*****************************************************************************************************/
-/*  RsCore_Write
-    Writes command string to the instrument. The command length is unlimited.
-    For non-VXI-11 sessions, it assures that the command is terminated with LF (rsSession->assureWriteWithLF)
-    Note! Do not use for writing binary data blocks. For that purpose use RsCore_WriteBinaryDataBlock... functions
+/*  RsCore_SetAllocator
+    Sets the process allocator used by the sessions opened afterwards. NULL sets back the C runtime.
+    The allocator can only be changed when no session is open, because the buffers of a session
+    must be freed by the allocator that allocated them.
+    The allocator structure must stay valid until the allocator is changed again.
 ******************************************************************************************************/
-ViStatus RsCore_Write(ViSession instrSession, ViConstString writeBuffer)
+ViStatus RsCore_SetAllocator(const RsCoreAllocator* allocator)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt32 cmdLen;
-	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE];
-	const ViInt32 cmdMaxLen = RS_MAX_SHORT_MESSAGE_BUF_SIZE - 4;
-	RsCoreSessionPtr rsSession = NULL;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (allocator != NULL && (allocator->allocate == NULL || allocator->reallocate == NULL || allocator->deallocate == NULL))
+	{
+		(void)RsCoreInt_SetGlobalErrorInfo(RS_ERROR_NULL_POINTER, VI_SUCCESS, "RsCore_SetAllocator: All the allocator functions must be defined");
+		return RS_ERROR_NULL_POINTER;
+	}
 
-	if (RsCore_Simulating(instrSession))
-		goto Error;
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	if (gSessionsCount > 0)
+	{
+		(void)RsCoreInt_SetGlobalErrorInfo(RS_ERROR_INVALID_CONFIGURATION, VI_SUCCESS,
+		                                   "RsCore_SetAllocator: The allocator cannot be changed while sessions are open");
+		error = RS_ERROR_INVALID_CONFIGURATION;
+	}
+	else
+	{
+		gAllocator = allocator;
+	}
 
-	if (writeBuffer == NULL)
-		return RS_ERROR_INVALID_VALUE;
+	RsCoreInt_MutexUnlock(gMutex);
 
-	cmdLen = (ViInt32)strlen(writeBuffer);
-	if (cmdLen == 0)
-		return RS_ERROR_INVALID_VALUE;
+	return error;
+}
 
-	if (rsSession->writeDelay)
-		Sleep(rsSession->writeDelay);
+/*****************************************************************************************************/
+/*  RsCore_RegisterAllocator
+    Registers the allocator for the option string token 'Allocator'. The session opened with
+    'Allocator=<name>' uses it for all its buffers, e.g. a huge-page pool for the IQ data sessions.
+    Registering an allocator with an already registered name replaces it for the sessions opened afterwards.
+    The allocator structure must stay valid until the end of the process.
+******************************************************************************************************/
+ViStatus RsCore_RegisterAllocator(const RsCoreAllocator* allocator)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 idx;
 
-	if (rsSession->assureWriteWithLF && writeBuffer[cmdLen - 1] != '\n')
+	if (allocator == NULL || allocator->name == NULL || allocator->allocate == NULL || allocator->reallocate == NULL ||
+		allocator->deallocate == NULL)
 	{
-		// For commands, up to 4092 bytes - RS_MAX_SHORT_MESSAGE_BUF_SIZE
-		if (cmdLen < cmdMaxLen)
-		{
-			RsCoreInt_StrcpyMaxLen(buffer, cmdMaxLen, writeBuffer);
-			buffer[cmdLen] = '\n';
-			buffer[cmdLen + 1] = 0;
-			return viWrite(instrSession, (ViBuf)buffer, cmdLen + 1, NULL);
-		}
-		else
+		(void)RsCoreInt_SetGlobalErrorInfo(RS_ERROR_NULL_POINTER, VI_SUCCESS,
+		                                   "RsCore_RegisterAllocator: The allocator name and all the functions must be defined");
+		return RS_ERROR_NULL_POINTER;
+	}
+
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	for (idx = 0; idx < RS_MAX_ALLOCATORS; idx++)
+	{
+		if (gAllocators[idx] == NULL || strcmp(gAllocators[idx]->name, allocator->name) == 0)
 		{
-			// Long commands, send the LF in the 2nd write
-			checkErr(viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_FALSE));
-			checkErr(viWrite(instrSession, (ViBuf)writeBuffer, cmdLen, NULL));
-			checkErr(viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE));
-			checkErr(viWrite(instrSession, (ViBuf)"\n", 1, NULL));
+			gAllocators[idx] = allocator;
+			break;
 		}
 	}
-	else
+
+	if (idx == RS_MAX_ALLOCATORS)
 	{
-		// Write the string as is
-		return viWrite(instrSession, (ViBuf)writeBuffer, cmdLen, NULL);
+		(void)RsCoreInt_SetGlobalErrorInfo(RS_ERROR_INVALID_CONFIGURATION, VI_SUCCESS,
+		                                   "RsCore_RegisterAllocator: Maximum number of registered allocators reached");
+		error = RS_ERROR_INVALID_CONFIGURATION;
 	}
-Error:
+
+	RsCoreInt_MutexUnlock(gMutex);
+
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_WriteWithOpc
-    Writes an OPC-synchronized command to the instrument.
-    Set the parameter timeoutMs to 0 in order to use the session's OPC timeout.
-    Because of the order of commands, this function also calls the driver's CheckStatus callback.
-    If you use this function, do not call the CheckStatus function anymore
-    Note! Do not use for writing binary data blocks. For that purpose use RsCore_WriteBinaryDataBlock...WithOpc functions
+/*  RsCore_Malloc
+    Allocates the memory with the allocator of the session
+    Buffers returned by the core functions (responses, arrays, commands) are allocated the same way
+    and must be freed with RsCore_Free
 ******************************************************************************************************/
-ViStatus RsCore_WriteWithOpc(ViSession instrSession, ViConstString writeBuffer, ViInt32 timeoutMs)
+void* RsCore_Malloc(ViSession instrSession, size_t size)
 {
-	return RsCoreInt_WriteWithOpc(instrSession, writeBuffer, VI_TRUE, timeoutMs);
+	return RsCoreInt_Malloc(RsCoreInt_GetAllocator(instrSession), size);
 }
 
 /*****************************************************************************************************/
-/*  RsCore_WriteAsciiViInt32Array
-    Writes to the instrument command string followed by ViInt32 array formatted as comma-separated values
+/*  RsCore_Calloc
+    Allocates the zero-initialized memory for count elements with the allocator of the session
 ******************************************************************************************************/
-ViStatus RsCore_WriteAsciiViInt32Array(ViSession instrSession, ViConstString command, ViInt32* intArray, ViInt32 arraySize)
+void* RsCore_Calloc(ViSession instrSession, size_t count, size_t size)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar* completeCmd = NULL;
+	return RsCoreInt_Calloc(RsCoreInt_GetAllocator(instrSession), count, size);
+}
 
-	checkErr(RsCore_Convert_ViInt32array_To_String(instrSession, intArray, arraySize, command, &completeCmd));
-	checkErr(RsCore_Write(instrSession, completeCmd));
+/*****************************************************************************************************/
+/*  RsCore_Realloc
+    Reallocates the memory allocated with the allocator of the session. On failure, the ptr stays allocated
+******************************************************************************************************/
+void* RsCore_Realloc(ViSession instrSession, void* ptr, size_t size)
+{
+	return RsCoreInt_Realloc(RsCoreInt_GetAllocator(instrSession), ptr, size);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_Free
+    Frees the memory allocated with the allocator of the session. NULL ptr is ignored
+******************************************************************************************************/
+void RsCore_Free(ViSession instrSession, void* ptr)
+{
+	RsCoreInt_Free(RsCoreInt_GetAllocator(instrSession), ptr);
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Warm session pool -------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+/*****************************************************************************************************/
+/*  RsCore_ReleaseToSessionPool
+    Parks the session in the warm session pool, if it was opened with the option string token 'SessionPool=1'.
+    The IO session stays open and the session keeps its attributes, repCaps and identity.
+    The next init of the same resource with 'SessionPool=1' takes the session over.
+    Returns VI_TRUE if the session was parked, then do not call RsCore_ViClose and RsCore_Dispose for it.
+    Use in the driver close function instead of the RsCore_ViClose
+******************************************************************************************************/
+ViBoolean RsCore_ReleaseToSessionPool(ViSession instrSession)
+{
+	RsCoreSessionPtr rsSession = NULL;
+
+	if (RsCore_GetRsSession(instrSession, &rsSession) < VI_SUCCESS || rsSession->sessionPool == VI_FALSE)
+		return VI_FALSE;
 
-Error:
-	if (completeCmd)
-		free(completeCmd);
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	rsSession->parked = VI_TRUE;
+	rsSession->warmStart = VI_FALSE;
+	rsSession->settingsGeneration++; // The next user of the session starts without the cached traces
+	RsCoreInt_MutexUnlock(gMutex);
 
-	return error;
+	return VI_TRUE;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_WriteAsciiViReal64Array
-    Writes to the instrument command string followed by ViReal64 array formatted as comma-separated values
-    Used formatting string: %.12lG
-******************************************************************************************************/
-ViStatus RsCore_WriteAsciiViReal64Array(ViSession instrSession, ViConstString command, ViReal64* dblArray, ViInt32 arraySize)
+/*  RsCore_CheckWarmSession
+    Call in the driver init function after the RsCore_NewSpecificDriver.
+    Returns warmSession VI_TRUE, if the session was taken from the warm session pool and it still
+    talks to the same instrument. The check is one *IDN? query compared with the session identity snapshot.
+    The driver init then skips the instrument setup and identification, the session keeps its state.
+    If the instrument is different, the function disposes the repCap table and returns warmSession VI_FALSE
+    to perform the complete init.
+******************************************************************************************************/
+ViStatus RsCore_CheckWarmSession(ViSession instrSession, ViBoolean* warmSession)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar* completeCmd = NULL;
+	ViChar idnString[RS_MAX_MESSAGE_BUF_SIZE];
+	RsCoreSessionPtr rsSession = NULL;
 
-	checkErr(RsCore_Convert_ViReal64array_To_String(instrSession, dblArray, arraySize, command, &completeCmd));
-	checkErr(RsCore_Write(instrSession, completeCmd));
+	*warmSession = VI_FALSE;
 
-Error:
-	if (completeCmd)
-		free(completeCmd);
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (rsSession->warmStart == VI_FALSE)
+		goto Error;
+
+	rsSession->warmStart = VI_FALSE;
+	*warmSession = VI_TRUE;
+	if (!RsCore_Simulating(instrSession))
+	{
+		checkErr(RsCore_QueryViString(instrSession, "*IDN?", idnString));
+		*warmSession = (strcmp(rsSession->identity.idn, idnString) == 0) ? VI_TRUE : VI_FALSE;
+	}
+
+	// The *IDN? attributes keep the values of the previous init
+	if (*warmSession == VI_FALSE)
+	{
+		// Another instrument, the complete init builds the repCap table again
+		checkErr(RsCoreInt_DisposeRepCapTable(instrSession));
+	}
 
+Error:
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_WriteAsciiViBooleanArray
-    Writes to the instrument command string followed by ViBoolean array formatted as comma-separated values
-    Boolean representation to string: VI_TRUE = 'ON', VI_FALSE = 'OFF'
+/*  RsCore_ClearSessionPool
+    Closes and disposes all the sessions parked in the warm session pool
 ******************************************************************************************************/
-ViStatus RsCore_WriteAsciiViBooleanArray(ViSession instrSession, ViConstString command, ViBoolean* boolArray, ViInt32 arraySize)
+ViStatus RsCore_ClearSessionPool(void)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar* completeCmd = NULL;
+	ViSession parkedSessions[MAX_NUMBER_OF_SESSIONS];
+	ViInt32 count = 0;
+	ViInt32 idx;
 
-	checkErr(RsCore_Convert_ViBooleanArray_To_String(instrSession, boolArray, arraySize, command, &completeCmd));
-	checkErr(RsCore_Write(instrSession, completeCmd));
+	gMutex = RsCoreInt_MutexLock(gMutex);
+	for (idx = 0; idx < MAX_NUMBER_OF_SESSIONS; idx++)
+	{
+		if (gSessionsList[idx] != NULL && gSessionsList[idx]->parked == VI_TRUE)
+		{
+			gSessionsList[idx]->parked = VI_FALSE;
+			gSessionsList[idx]->sessionPool = VI_FALSE;
+			parkedSessions[count++] = gSessionsList[idx]->io;
+		}
+	}
+	RsCoreInt_MutexUnlock(gMutex);
 
-Error:
-	if (completeCmd)
-		free(completeCmd);
+	for (idx = 0; idx < count; idx++)
+	{
+		(void)RsCore_ViClose(parkedSessions[idx]);
+		(void)RsCore_Dispose(parkedSessions[idx]);
+	}
 
-	return error;
+	return VI_SUCCESS;
 }
 
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Parallel session open ---------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
 /*****************************************************************************************************/
-/*  RsCore_ReadViStringUnknownLength
-    Reads data from the instrument and returns the allocated buffer with the read data
-    The response is trimmed for trailing LF-characters and always null-terminated.
-    WARNING!!! - Deallocate the outputBuffer after use.
-    Note! Do not use for reading binary data, for that purpose use the RsCore_ReadBinaryDataBlock... functions
+/*  RsCoreInt_OpenSessionThread
+    Thread routine of RsCore_OpenSessionsParallel, opens one resource
 ******************************************************************************************************/
-ViStatus RsCore_ReadViStringUnknownLength(ViSession instrSession, ViChar** responseString)
+#if defined (__linux__)
+static void* RsCoreInt_OpenSessionThread(void* parameter)
+#else
+static DWORD WINAPI RsCoreInt_OpenSessionThread(LPVOID parameter)
+#endif
 {
-	ViStatus error = VI_SUCCESS;
-	ViInt64 byteCount;
+	RsCoreParallelOpenJob* job = (RsCoreParallelOpenJob*)parameter;
+	ViStatus primaryError;
 
-	checkErr(RsCoreInt_ReadDataUnknownLength(instrSession, (ViByte**)responseString, &byteCount));
-	// Cut one LF at the end if present
-	if (byteCount > 0 && (*responseString)[byteCount - 1] == '\n')
-	{
-		(*responseString)[byteCount - 1] = 0;
-	}
+	*job->instrSession = 0;
+	*job->status = job->openSession(job->resourceName, job->context, job->instrSession);
 
-Error:
-	return error;
+	// A failed open has no session, its error info is in the global error info of this thread
+	if (*job->status < VI_SUCCESS)
+		(void)RsCoreInt_GetGlobalErrorInfo(&primaryError, &job->secondaryError, job->errorElab);
+
+	return 0;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_ReadUpToCharacter
-	Reads data byte-by-byte until it encounters the stopChar, or the bufferSize limit, or the MSG_END
-	If the required stop character is not successfully read,  the function generates RS_ERROR_UNEXPECTED_RESPONSE
-	Returns the buffer including the stopChar, retCnt includes the stopChar. The rest of the buffer is filled with zeroes
-******************************************************************************************************/
-ViStatus RsCore_ReadUpToCharacter(ViSession instrSession, ViChar stopChar, ViInt32 bufferSize, ViBuf buffer, ViInt32* retCnt)
+/*  RsCore_OpenSessionsParallel
+    Opens the list of resources in parallel, each one in its own thread, by calling the openSession for each of them.
+    The openSession is usually an adapter to the driver's PREFIX_InitWithOptions.
+    instrSessions and statuses must have the count elements. The instrSessions of the failed resources are 0.
+    Returns the first negative status in the order of the list, VI_SUCCESS if all the resources were opened.
+    The error info of that resource is set as the global error info of the calling thread.
+    If a thread can not be created, the resource is opened in the calling thread.
+******************************************************************************************************/
+ViStatus RsCore_OpenSessionsParallel(ViInt32 count, ViRsrc resourceNames[], RsCoreOpenSessionCallback openSession, void* context,
+                                     ViSession instrSessions[], ViStatus statuses[])
 {
 	ViStatus error = VI_SUCCESS;
-	RsCoreSessionPtr rsSession = NULL;
-	ViInt32 i;
-	ViBoolean success = VI_FALSE;
-	ViUInt32 readCount;
+	RsCoreParallelOpenJob* jobs = NULL;
+	ViBoolean* started = NULL;
+	const RsCoreAllocator* allocator = gAllocator;
+	ViInt32 idx;
+#if defined (__linux__)
+	pthread_t* threads = NULL;
+#else
+	HANDLE* threads = NULL;
+#endif
 
-	*retCnt = 0;
-	buffer[0] = 0;
-	
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (count <= 0)
+		return VI_SUCCESS;
 
-	// Only apply the read delay once at the beginning
-	if (rsSession->readDelay)
-		Sleep(rsSession->readDelay);
+	if (resourceNames == NULL || openSession == NULL || instrSessions == NULL || statuses == NULL)
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS,
+		                          "RsCore_OpenSessionsParallel: resourceNames, openSession, instrSessions and statuses must not be NULL");
+		return RS_ERROR_NULL_POINTER;
+	}
 
-	for (i = 0; i < bufferSize; i++)
+	jobs = (RsCoreParallelOpenJob*)RsCoreInt_Calloc(allocator, (size_t)count, sizeof(RsCoreParallelOpenJob));
+	started = (ViBoolean*)RsCoreInt_Calloc(allocator, (size_t)count, sizeof(ViBoolean));
+	threads = RsCoreInt_Calloc(allocator, (size_t)count, sizeof(*threads));
+	if (jobs == NULL || started == NULL || threads == NULL)
 	{
-		checkErr(viRead(instrSession, buffer + i, 1, &readCount));
-		if (buffer[i] == stopChar)
-		{
-			error = VI_SUCCESS;
-			success = VI_TRUE;
-			break;
-		}
-		if (error != VI_SUCCESS_MAX_CNT)
-			break;
+		error = RS_ERROR_ALLOC;
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, error, VI_SUCCESS, "RsCore_OpenSessionsParallel: Allocation of the thread list");
+		goto Error;
 	}
 
-	if (!success)
+	for (idx = 0; idx < count; idx++)
 	{
-		viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, "RsCore_ReadUpToCharacter: The required stop character was not read");
+		jobs[idx].resourceName = resourceNames[idx];
+		jobs[idx].openSession = openSession;
+		jobs[idx].context = context;
+		jobs[idx].instrSession = &instrSessions[idx];
+		jobs[idx].status = &statuses[idx];
+
+#if defined (__linux__)
+		started[idx] = (pthread_create(&threads[idx], NULL, RsCoreInt_OpenSessionThread, &jobs[idx]) == 0) ? VI_TRUE : VI_FALSE;
+#else
+		threads[idx] = CreateThread(NULL, 0, RsCoreInt_OpenSessionThread, &jobs[idx], 0, NULL);
+		started[idx] = (threads[idx] != NULL) ? VI_TRUE : VI_FALSE;
+#endif
+		if (started[idx] == VI_FALSE)
+			(void)RsCoreInt_OpenSessionThread(&jobs[idx]);
 	}
 
-	if (i < bufferSize - 1)
+	for (idx = 0; idx < count; idx++)
 	{
-		// Fill up with nulls
-		memset(buffer + i + 1, 0, bufferSize - i - 1);
+		if (started[idx] == VI_FALSE)
+			continue;
+
+#if defined (__linux__)
+		(void)pthread_join(threads[idx], NULL);
+#else
+		(void)WaitForSingleObject(threads[idx], INFINITE);
+		(void)CloseHandle(threads[idx]);
+#endif
+	}
+
+	for (idx = 0; idx < count; idx++)
+	{
+		if (statuses[idx] < VI_SUCCESS)
+		{
+			instrSessions[idx] = 0;
+			if (error == VI_SUCCESS)
+			{
+				error = statuses[idx];
+				(void)RsCoreInt_SetGlobalErrorInfo(error, jobs[idx].secondaryError, jobs[idx].errorElab);
+			}
+		}
 	}
-	
-	*retCnt = i + 1;
 
 Error:
+	RsCoreInt_Free(allocator, jobs);
+	RsCoreInt_Free(allocator, started);
+	RsCoreInt_Free(allocator, threads);
 	return error;
 }
 
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Trace accumulator -------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+// ln(10) / 20 and ln(10) / 10: 10^(x/20) = exp(x * RS_LN10_BY_20)
+#define RS_LN10_BY_20		0.11512925464970228420
+#define RS_LN10_BY_10		0.23025850929940456840
+
 /*****************************************************************************************************/
-/*  RsCore_QueryViString
-    Queries string from the instrument. The response length is limited.
-    The response is trimmed for trailing LF-characters and always null-terminated.
-    You have to provide a response buffer with minimum size of RS_MAX_MESSAGE_BUF_SIZE (4096 bytes)
-    You can set the responseString to NULL if you do not need the response
-    Note! Do not use for reading binary data blocks. For that purpose use RsCore_QueryBinaryDataBlock... functions
+/*  RsCoreInt_TraceAccumulateLog
+    Kernels of RsCore_TraceAccumulatorAdd. Each one is a single pass over contiguous arrays without branches
+    in the loop body, so that the compiler vectorizes them
 ******************************************************************************************************/
-ViStatus RsCore_QueryViString(ViSession instrSession, ViConstString query, ViChar* responseString)
+static void RsCoreInt_TraceAccumulateLog(const ViReal64* trace, ViInt32 points, ViReal64* logSum)
 {
-	ViStatus error = VI_SUCCESS;
-	ViInt32 returnedCount = 0;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	ViChar auxResponse[RS_MAX_MESSAGE_BUF_SIZE];
-	ViChar* p2response = (responseString == NULL ? auxResponse : responseString);
+	ViInt32 i;
 
-	if (RsCore_Simulating(instrSession))
-	{
-		if (responseString != VI_NULL)
-			responseString[0] = 0;
+	for (i = 0; i < points; i++)
+		logSum[i] += trace[i];
+}
 
-		goto Error;
-	}
+static void RsCoreInt_TraceAccumulateLinear(const ViReal64* trace, ViInt32 points, ViReal64* linearSum)
+{
+	ViInt32 i;
 
-	checkErr(RsCore_Write(instrSession, query));
-	checkErr(RsCoreInt_Read(instrSession, RS_MAX_MESSAGE_BUF_SIZE, (ViByte *)p2response, &returnedCount));
-	if (returnedCount >= RS_MAX_MESSAGE_BUF_SIZE)
-	{
-		// Truncate the message, it is too long
-		p2response[RS_MAX_MESSAGE_BUF_SIZE - 1] = '\0';
-		if (p2response[RS_MAX_MESSAGE_BUF_SIZE - 2] != '\n')
-		{
-			// Report an error, the response is not complete
-			p2response[64] = 0;
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Unexpected response on query '%s', longer than maximum %d bytes: '%64s...' "
-			         "The response probably comes from a previous not completely read-out response",
-			         query, RS_MAX_MESSAGE_BUF_SIZE, p2response);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-		}
-	}
-	else
-	{
-		p2response[returnedCount] = '\0';
-	}
+	for (i = 0; i < points; i++)
+		linearSum[i] += exp(trace[i] * RS_LN10_BY_20);
+}
 
-	RsCore_TrimString(p2response, RS_VAL_TRIM_WHITESPACES);
+static void RsCoreInt_TraceAccumulatePower(const ViReal64* trace, ViInt32 points, ViReal64* powerSum)
+{
+	ViInt32 i;
 
-Error:
-	if (error < 0)
-		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCore_QueryViString", query);
+	for (i = 0; i < points; i++)
+		powerSum[i] += exp(trace[i] * RS_LN10_BY_10);
+}
 
-	return error;
+static void RsCoreInt_TraceAccumulateMax(const ViReal64* trace, ViInt32 points, ViReal64* maxHold)
+{
+	ViInt32 i;
+
+	for (i = 0; i < points; i++)
+		maxHold[i] = (trace[i] > maxHold[i]) ? trace[i] : maxHold[i];
+}
+
+static void RsCoreInt_TraceAccumulateMin(const ViReal64* trace, ViInt32 points, ViReal64* minHold)
+{
+	ViInt32 i;
+
+	for (i = 0; i < points; i++)
+		minHold[i] = (trace[i] < minHold[i]) ? trace[i] : minHold[i];
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryViStringShort
-    Queries string from the instrument. The response length is limited to RS_MAX_SHORT_MESSAGE_BUF_SIZE (64 bytes)
-    The response is trimmed for trailing LF-characters and always null-terminated.
-    You have to provide a response buffer with minimum size of RS_MAX_SHORT_MESSAGE_BUF_SIZE
-    You can set the response buffer to NULL if you do not need the response
-    The function returns
-    Note! Use this function instead of RsCore_QueryViString when you expect a short response e.g. an integer number
+/*  RsCore_TraceAccumulatorInit
+    Allocates the state for the statistics (RS_VAL_TRACE_STAT_* mask) over traces with the entered number of points.
+    All memory is allocated here, adding the traces does not allocate. Dispose with RsCore_TraceAccumulatorDispose
 ******************************************************************************************************/
-ViStatus RsCore_QueryViStringShort(ViSession instrSession, ViConstString query, ViChar* responseString)
+ViStatus RsCore_TraceAccumulatorInit(RsCoreTraceAccumulatorPtr accumulator, ViInt32 points, ViInt32 statistics)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt32 returnedCount = 0;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	ViChar auxResponse[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
-	ViChar* p2response = (responseString == NULL ? auxResponse : responseString);
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViReal64* block;
+	ViInt32 arraysCount = 1;
+	ViInt32 bit;
 
-	if (RsCore_Simulating(instrSession))
+	if (accumulator == NULL)
 	{
-		if (responseString != VI_NULL)
-			responseString[0] = 0;
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS, "Trace accumulator: the accumulator is NULL");
+		return RS_ERROR_NULL_POINTER;
+	}
 
+	memset(accumulator, 0, sizeof(RsCoreTraceAccumulator));
+
+	if (points <= 0 || statistics <= 0 || (statistics & ~RS_VAL_TRACE_STAT_ALL) != 0)
+	{
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace accumulator: invalid number of points " _PERCD " or statistics mask 0x" _PERCX, points, statistics);
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, errorElab);
+		return RS_ERROR_INVALID_PARAMETER;
+	}
+
+	for (bit = RS_VAL_TRACE_STAT_LOG_AVERAGE; bit <= RS_VAL_TRACE_STAT_MIN_HOLD; bit <<= 1)
+		if (statistics & bit)
+			arraysCount++;
+
+	accumulator->allocator = gAllocator;
+	block = (ViReal64*)RsCoreInt_Malloc(accumulator->allocator, (size_t)arraysCount * (size_t)points * sizeof(ViReal64));
+	if (block == NULL)
+	{
+		error = RS_ERROR_ALLOC;
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, error, VI_SUCCESS, "Trace accumulator: allocation of the state arrays");
 		goto Error;
 	}
 
-	checkErr(RsCore_Write(instrSession, query));
-	checkErr(RsCoreInt_Read(instrSession, RS_MAX_SHORT_MESSAGE_BUF_SIZE, (ViByte *)p2response, &returnedCount));
-	if (returnedCount >= RS_MAX_SHORT_MESSAGE_BUF_SIZE)
+	accumulator->memory = block;
+	accumulator->points = points;
+	accumulator->statistics = statistics;
+	accumulator->trace = block;
+	block += points;
+
+	if (statistics & RS_VAL_TRACE_STAT_LOG_AVERAGE)
 	{
-		// Truncate the message, it is too long
-		p2response[RS_MAX_SHORT_MESSAGE_BUF_SIZE - 1] = '\0';
-		if (p2response[RS_MAX_SHORT_MESSAGE_BUF_SIZE - 2] != '\n')
-		{
-			// Report an error, the response is not complete
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Unexpected response on query '%s', longer than maximum %d bytes: '%32s...' "
-			         "The response probably comes from a previous not completely read-out response",
-			         query, RS_MAX_SHORT_MESSAGE_BUF_SIZE, p2response);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-		}
+		accumulator->logSum = block;
+		block += points;
 	}
-	else
+
+	if (statistics & RS_VAL_TRACE_STAT_LINEAR_AVERAGE)
 	{
-		p2response[returnedCount] = '\0';
+		accumulator->linearSum = block;
+		block += points;
+	}
+
+	if (statistics & RS_VAL_TRACE_STAT_RMS)
+	{
+		accumulator->powerSum = block;
+		block += points;
 	}
 
-	RsCore_TrimString(p2response, RS_VAL_TRIM_WHITESPACES);
+	if (statistics & RS_VAL_TRACE_STAT_MAX_HOLD)
+	{
+		accumulator->maxHold = block;
+		block += points;
+	}
+
+	if (statistics & RS_VAL_TRACE_STAT_MIN_HOLD)
+		accumulator->minHold = block;
+
+	RsCore_TraceAccumulatorReset(accumulator);
 
 Error:
-	if (error < 0)
-		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCore_QueryViStringShort", query);
-
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryViStringUnknownLength
-    Queries string response from the instrument. The response length is unlimited.
-    The response is trimmed for trailing LF-characters and always null-terminated.
-    WARNING!!! - Deallocate the outputBuffer after use.
-    Note! Do not use for querying binary data, for that purpose use the RsCore_QueryBinaryDataBlock... functions
+/*  RsCore_TraceAccumulatorReset
+    Starts the statistics again, keeps the allocated state
 ******************************************************************************************************/
-ViStatus RsCore_QueryViStringUnknownLength(ViSession instrSession, ViConstString query, ViChar** responseString)
+void RsCore_TraceAccumulatorReset(RsCoreTraceAccumulatorPtr accumulator)
 {
-	ViStatus error = VI_SUCCESS;
+	ViInt32 i;
+	ViInt32 points;
 
-	checkErr(RsCore_Write(instrSession, query));
-	checkErr(RsCore_ReadViStringUnknownLength(instrSession, responseString));
+	if (accumulator == NULL)
+		return;
 
-Error:
+	points = accumulator->points;
+	accumulator->count = 0;
 
-	if (error == VI_ERROR_TMO)
-		RsCoreInt_SpecifyVisaError(instrSession, error, "RsCore_QueryViStringUnknownLength", query);
+	if (accumulator->logSum != NULL)
+		memset(accumulator->logSum, 0, points * sizeof(ViReal64));
 
-	return error;
+	if (accumulator->linearSum != NULL)
+		memset(accumulator->linearSum, 0, points * sizeof(ViReal64));
+
+	if (accumulator->powerSum != NULL)
+		memset(accumulator->powerSum, 0, points * sizeof(ViReal64));
+
+	if (accumulator->maxHold != NULL)
+		for (i = 0; i < points; i++)
+			accumulator->maxHold[i] = -DBL_MAX;
+
+	if (accumulator->minHold != NULL)
+		for (i = 0; i < points; i++)
+			accumulator->minHold[i] = DBL_MAX;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryCatalog
-	Queries string response in a form of catalog from the instrument. The response length is unlimited.
-	The function uses RsCore_ParseCatalog to return a catalog to the user buffer.
-	- elementsCount can be set to NULL. If not it returns comma-separated number of elements
+/*  RsCore_TraceAccumulatorAdd
+    Adds one trace to all the maintained statistics. The tracePoints must be equal to the accumulator points
 ******************************************************************************************************/
-ViStatus RsCore_QueryCatalog(ViSession instrSession, ViConstString query, ViInt32 bufferSize, ViChar* catalogOut, ViInt32* elementsCount)
+ViStatus RsCore_TraceAccumulatorAdd(RsCoreTraceAccumulatorPtr accumulator, const ViReal64 trace[], ViInt32 tracePoints)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar *data = NULL;
-	ViInt32* count;
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 points;
 
-	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &data));
-	checkErr(RsCore_ParseCatalog(data, bufferSize, catalogOut, &count));
+	if (accumulator == NULL || trace == NULL)
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS, "Trace accumulator: the accumulator or the trace is NULL");
+		return RS_ERROR_NULL_POINTER;
+	}
 
-	if (elementsCount)
-		*elementsCount = count;
+	if (accumulator->memory == NULL)
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NOT_INITIALIZED, VI_SUCCESS, "Trace accumulator is not initialized");
+		return RS_ERROR_NOT_INITIALIZED;
+	}
 
-Error:
-	if (data) free(data);
-	return error;
-}
+	points = accumulator->points;
 
+	if (tracePoints != points)
+	{
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace accumulator: the trace has " _PERCD " points, the accumulator " _PERCD " points", tracePoints, points);
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, errorElab);
+		return RS_ERROR_INVALID_PARAMETER;
+	}
 
+	if (accumulator->logSum != NULL)
+		RsCoreInt_TraceAccumulateLog(trace, points, accumulator->logSum);
 
-/*****************************************************************************************************/
-/*  RsCore_QueryViStringUnknownLengthToUserBuffer
-	Queries string response from the instrument. The response length is unlimited,
-	but maximum of bufferSize length is copied to the provided responseString.
-	The response is trimmed for trailing LF-characters and always null-terminated.
-	- responseLength returns the true length of the response and can be set to NULL
-	Note! Do not use for querying binary data, for that purpose use the RsCore_QueryBinaryDataBlock... functions
-******************************************************************************************************/
-ViStatus RsCore_QueryViStringUnknownLengthToUserBuffer(ViSession instrSession, ViConstString query, ViInt32 bufferSize, ViChar* responseString, ViInt32 *responseLength)
-{
-	ViStatus error = VI_SUCCESS;
-	ViChar *data = NULL;
+	if (accumulator->linearSum != NULL)
+		RsCoreInt_TraceAccumulateLinear(trace, points, accumulator->linearSum);
 
-	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &data));
-	checkErr(RsCore_CopyToUserBufferAsciiData(instrSession, responseString, bufferSize, data));
+	if (accumulator->powerSum != NULL)
+		RsCoreInt_TraceAccumulatePower(trace, points, accumulator->powerSum);
 
-	if (responseLength)
-		*responseLength = (ViInt32)strlen(data);
+	if (accumulator->maxHold != NULL)
+		RsCoreInt_TraceAccumulateMax(trace, points, accumulator->maxHold);
 
-Error:
-	if (data) free(data);
-	return error;
-}
+	if (accumulator->minHold != NULL)
+		RsCoreInt_TraceAccumulateMin(trace, points, accumulator->minHold);
 
-/*****************************************************************************************************/
-/*  RsCore_QueryViStringWithOpc
-	Sends an OPC-synchronized query to the instrument. The response length is limited.
-	The response is trimmed for any leading LF characters and terminated with null-character
-	Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
-	Because of the order of commands, this function also calls the driver's CheckStatus callback.
-	If you use this function, do not call the CheckStatus anymore
-	Note! Do not use for querying binary data, for that purpose use the RsCore_QueryBinaryDataBlock...withOpc functions
-******************************************************************************************************/
-ViStatus RsCore_QueryViStringWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs, ViInt32 bufferSize, ViChar* responseString)
-{
-	return RsCoreInt_QueryViStringWithOpc(instrSession, query, VI_TRUE, timeoutMs, bufferSize, responseString);
+	accumulator->count++;
+
+	return VI_SUCCESS;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryViStringUnknownLengthWithOpc
-    Sends an OPC-synchronized query to the instrument. The response length is unlimited.
-    The returned string is trimmed for LF and allocated buffer always at least one byte bigger than the returned byteCount, and has always
-    minimum of one null at the end. This allows you to use the outputBuffer as a properly null-terminated string.
-    Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
-    Because of the order of commands, this function also calls the driver's CheckStatus callback.
-    If you use this function, do not call the CheckStatus anymore
-    WARNING!!! - Deallocate the responseString after use.
-    Note! Do not use for querying binary data, for that purpose use the RsCore_QueryBinaryDataBlock...WithOpc functions
+/*  RsCore_TraceAccumulatorGet
+    Returns one statistic (single RS_VAL_TRACE_STAT_* value) of the traces added so far, in dB.
+    The result must have at least the accumulator points
 ******************************************************************************************************/
-ViStatus RsCore_QueryViStringUnknownLengthWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs, ViChar** responseString)
+ViStatus RsCore_TraceAccumulatorGet(RsCoreTraceAccumulatorPtr accumulator, ViInt32 statistic, ViInt32 arraySize, ViReal64 result[])
 {
-	ViStatus error = VI_SUCCESS;
-	ViInt64 byteCount;
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 i;
+	ViInt32 points;
+	ViReal64 scale;
 
-	checkErr(RsCoreInt_QueryUnknownLengthWithOpc(instrSession, query, VI_TRUE, timeoutMs, (ViByte **)responseString, &byteCount));
-	RsCore_TrimString(*responseString, RS_VAL_TRIM_WHITESPACES);
+	if (accumulator == NULL || result == NULL)
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS, "Trace accumulator: the accumulator or the result is NULL");
+		return RS_ERROR_NULL_POINTER;
+	}
 
-Error:
-	return error;
-}
+	if (accumulator->memory == NULL)
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NOT_INITIALIZED, VI_SUCCESS, "Trace accumulator is not initialized");
+		return RS_ERROR_NOT_INITIALIZED;
+	}
 
-/*****************************************************************************************************/
-/*  RsCore_QueryViStringUnknownLengthToUserBufferWithOpc
-	Sends an OPC-synchronized query to the instrument. The response length is limited.
-	The response is trimmed for any leading LF characters and terminated with null-character
-	Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
-	Because of the order of commands, this function also calls the driver's CheckStatus callback.
-	If you use this function, do not call the CheckStatus anymore
-	- responseLength returns the true length of the response and can be set to NULL
-	- Do not use for querying binary data, for that purpose use the RsCore_QueryBinaryDataBlock...withOpc functions
-******************************************************************************************************/
-ViStatus RsCore_QueryViStringUnknownLengthToUserBufferWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs,
-	ViInt32 bufferSize, ViChar* responseString, ViInt32 *responseLength)
-{
-	ViStatus error = VI_SUCCESS;
-	ViChar *data = NULL;
+	points = accumulator->points;
+	if ((accumulator->statistics & statistic) == 0 || (statistic & (statistic - 1)) != 0)
+	{
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace accumulator: the statistic 0x" _PERCX " is not maintained, the accumulator statistics are 0x" _PERCX,
+		         statistic, accumulator->statistics);
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, errorElab);
+		return RS_ERROR_INVALID_PARAMETER;
+	}
 
-	checkErr(RsCore_QueryViStringUnknownLengthWithOpc(instrSession, query, timeoutMs, &data));
-	checkErr(RsCore_CopyToUserBufferAsciiData(instrSession, responseString, bufferSize, data));
+	if (arraySize < points)
+	{
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace accumulator: the result array size " _PERCD " is smaller than the " _PERCD " points", arraySize, points);
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, errorElab);
+		return RS_ERROR_INVALID_PARAMETER;
+	}
 
-	if (responseLength)
-		*responseLength = (ViInt32)strlen(data);
+	if (accumulator->count == 0)
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_VALUE_NOT_AVAILABLE, VI_SUCCESS, "Trace accumulator: no trace was added");
+		return RS_ERROR_VALUE_NOT_AVAILABLE;
+	}
 
-Error:
-	if (data) free(data);
-	return error;
+	scale = 1.0 / (ViReal64)accumulator->count;
+	switch (statistic)
+	{
+	case RS_VAL_TRACE_STAT_LOG_AVERAGE:
+		for (i = 0; i < points; i++)
+			result[i] = accumulator->logSum[i] * scale;
+		break;
+	case RS_VAL_TRACE_STAT_LINEAR_AVERAGE:
+		for (i = 0; i < points; i++)
+			result[i] = 20.0 * log10(accumulator->linearSum[i] * scale);
+		break;
+	case RS_VAL_TRACE_STAT_RMS:
+		for (i = 0; i < points; i++)
+			result[i] = 10.0 * log10(accumulator->powerSum[i] * scale);
+		break;
+	case RS_VAL_TRACE_STAT_MAX_HOLD:
+		memcpy(result, accumulator->maxHold, points * sizeof(ViReal64));
+		break;
+	case RS_VAL_TRACE_STAT_MIN_HOLD:
+		memcpy(result, accumulator->minHold, points * sizeof(ViReal64));
+		break;
+	}
+
+	return VI_SUCCESS;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryViInt32
-    Uses RsCore_QueryInstrShortString to query the instrument data and returns it as ViInt32 value
-    If you do not need the response, set the value to NULL
+/*  RsCore_TraceAccumulatorDispose
+    Frees the state allocated by RsCore_TraceAccumulatorInit
 ******************************************************************************************************/
-ViStatus RsCore_QueryViInt32(ViSession instrSession, ViConstString query, ViPInt32 value)
+void RsCore_TraceAccumulatorDispose(RsCoreTraceAccumulatorPtr accumulator)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "0";
-
-	if (RsCore_Simulating(instrSession))
-	{
-		if (value)
-			*value = 1;
-
-		goto Error;
-	}
-
-	checkErr(RsCore_QueryViStringShort(instrSession, query, response));
+	if (accumulator == NULL)
+		return;
 
-	if (value)
-		*value = RsCore_Convert_String_To_ViInt32(response);
+	if (accumulator->memory != NULL)
+		RsCoreInt_Free(accumulator->allocator, accumulator->memory);
 
-Error:
-	return error;
+	memset(accumulator, 0, sizeof(RsCoreTraceAccumulator));
 }
 
-/*****************************************************************************************************/
-/*  RsCore_QueryViInt32WithOpc
-	Sends an OPC-synchronized query to the instrument and returns it as ViInt32 value
-	The response read is limited to RS_MAX_SHORT_MESSAGE_BUF_SIZE (64 bytes)
-	Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
-	Because of the order of commands, this function also calls the driver's CheckStatus callback.
-	If you use this function, do not call the CheckStatus anymore
-	If you do not need the response, set the value to NULL
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Trace analysis ----------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
-ViStatus RsCore_QueryViInt32WithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs, ViPInt32 value)
+
+// Peak candidate of RsCore_TraceFindPeaks
+typedef struct RsCoreTracePeak
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "0";
+	ViInt32 index;
+	ViReal64 level;
+} RsCoreTracePeak;
 
-	if (RsCore_Simulating(instrSession))
-	{
-		if (value)
-			*value = 1;
+static int RsCoreInt_ComparePeakLevel(const void* a, const void* b)
+{
+	const RsCoreTracePeak* peakA = (const RsCoreTracePeak*)a;
+	const RsCoreTracePeak* peakB = (const RsCoreTracePeak*)b;
 
-		goto Error;
-	}
+	if (peakA->level != peakB->level)
+		return (peakA->level < peakB->level) ? 1 : -1;
 
-	checkErr(RsCoreInt_QueryViStringWithOpc(instrSession, query, VI_TRUE, timeoutMs, RS_MAX_SHORT_MESSAGE_BUF_SIZE, response));
+	return (peakA->index > peakB->index) - (peakA->index < peakB->index);
+}
 
-	if (value)
-		*value = RsCore_Convert_String_To_ViInt32(response);
+static int RsCoreInt_ComparePeakIndex(const void* a, const void* b)
+{
+	const RsCoreTracePeak* peakA = (const RsCoreTracePeak*)a;
+	const RsCoreTracePeak* peakB = (const RsCoreTracePeak*)b;
 
-Error:
-	return error;
+	return (peakA->index > peakB->index) - (peakA->index < peakB->index);
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryViReal64
-    Uses RsCore_QueryInstrShortString to query the instrument data and returns it as ViReal64 value
-    If you do not need the response, set the value to NULL
+/*  RsCoreInt_TraceSideMinimum
+    For each point, returns the minimum of y between the point and the nearest strictly higher point
+    in the direction step (+1 / -1), or the trace end if there is none. One pass with a monotonic stack
 ******************************************************************************************************/
-ViStatus RsCore_QueryViReal64(ViSession instrSession, ViConstString query, ViPReal64 value)
+static void RsCoreInt_TraceSideMinimum(const ViReal64 y[], ViInt32 points, ViInt32 step,
+                                       ViInt32 stackIndex[], ViReal64 stackMinimum[], ViReal64 sideMinimum[])
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "0.0";
+	ViInt32 i, n;
+	ViInt32 top = 0;
+	ViReal64 minimum;
 
-	if (RsCore_Simulating(instrSession))
+	for (n = 0; n < points; n++)
 	{
-		if (value)
-			*value = 1.0;
+		i = (step > 0) ? n : points - 1 - n;
+		minimum = y[i];
+		while (top > 0 && y[stackIndex[top - 1]] <= y[i])
+		{
+			top--;
+			if (stackMinimum[top] < minimum)
+				minimum = stackMinimum[top];
+		}
 
-		goto Error;
+		sideMinimum[i] = minimum;
+		stackIndex[top] = i;
+		stackMinimum[top] = minimum;
+		top++;
 	}
+}
 
-	checkErr(RsCore_QueryViStringShort(instrSession, query, response));
+/*****************************************************************************************************/
+/*  RsCoreInt_TraceX
+    Returns the x value of the trace point. Without the x axis (NULL), the x value is the point index
+******************************************************************************************************/
+static ViReal64 RsCoreInt_TraceX(const ViReal64 x[], ViInt32 index)
+{
+	return (x != NULL) ? x[index] : (ViReal64)index;
+}
 
-	if (value)
-		*value = RsCore_Convert_String_To_ViReal64(response);
+/*****************************************************************************************************/
+/*  RsCore_TraceLinearXAxis
+    Fills the x axis of a trace with linear spacing, e.g. the frequencies from the start and stop frequency
+******************************************************************************************************/
+void RsCore_TraceLinearXAxis(ViReal64 start, ViReal64 stop, ViInt32 points, ViReal64 x[])
+{
+	ViInt32 i;
+	ViReal64 step = (points > 1) ? (stop - start) / (ViReal64)(points - 1) : 0.0;
 
-Error:
-	return error;
+	for (i = 0; i < points; i++)
+		x[i] = start + step * (ViReal64)i;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryViReal64WithOpc
-	Sends an OPC-synchronized query to the instrument and returns it as ViReal64 value
-	The response read is limited to RS_MAX_SHORT_MESSAGE_BUF_SIZE (64 bytes)
-	Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
-	Because of the order of commands, this function also calls the driver's CheckStatus callback.
-	If you use this function, do not call the CheckStatus anymore
-	If you do not need the response, set the value to NULL
-******************************************************************************************************/
-ViStatus RsCore_QueryViReal64WithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs, ViPReal64 value)
+/*  RsCore_TraceFindPeaks
+    Searches the peaks of a trace in the memory, without any instrument IO.
+    A peak is a local maximum at or above the threshold that falls by at least the excursion on both sides
+    before the trace rises above the peak level again (or the trace ends).
+    The trace edges are open: the first and the last point only need the excursion on their inner side.
+    Returns up to maxPeaks peaks in the sortOrder (RS_VAL_PEAK_SORT_*), peaksFound is the number of the returned peaks.
+    x can be NULL, the peakX are then the point indexes. peakIndexes, peakX and peakY can be NULL if not needed
+******************************************************************************************************/
+ViStatus RsCore_TraceFindPeaks(const ViReal64 x[], const ViReal64 y[], ViInt32 points, ViReal64 threshold, ViReal64 excursion,
+                               ViInt32 sortOrder, ViInt32 maxPeaks, ViInt32* peaksFound,
+                               ViInt32 peakIndexes[], ViReal64 peakX[], ViReal64 peakY[])
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "0.0";
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	void* memory = NULL;
+	ViReal64* leftMinimum;
+	ViReal64* rightMinimum;
+	ViReal64* stackMinimum;
+	ViInt32* stackIndex;
+	RsCoreTracePeak* peaks;
+	ViInt32 peaksCount = 0;
+	ViInt32 i;
 
-	if (RsCore_Simulating(instrSession))
+	if (y == NULL || peaksFound == NULL)
 	{
-		if (value)
-			*value = 1.0;
-
-		goto Error;
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS, "Trace peak search: y or peaksFound is NULL");
+		return RS_ERROR_NULL_POINTER;
 	}
 
-	checkErr(RsCoreInt_QueryViStringWithOpc(instrSession, query, VI_TRUE, timeoutMs, RS_MAX_SHORT_MESSAGE_BUF_SIZE, response));
+	*peaksFound = 0;
 
-	if (value)
-		*value = RsCore_Convert_String_To_ViReal64(response);
+	if (points <= 0 || maxPeaks < 0 || (sortOrder != RS_VAL_PEAK_SORT_LEVEL && sortOrder != RS_VAL_PEAK_SORT_X))
+	{
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace peak search: invalid points " _PERCD ", maxPeaks " _PERCD " or sortOrder " _PERCD, points, maxPeaks, sortOrder);
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, errorElab);
+		return RS_ERROR_INVALID_PARAMETER;
+	}
 
-Error:
-	return error;
-}
+	memory = RsCoreInt_Malloc(gAllocator, (size_t)points * (3 * sizeof(ViReal64) + sizeof(ViInt32) + sizeof(RsCoreTracePeak)));
+	if (memory == NULL)
+	{
+		error = RS_ERROR_ALLOC;
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, error, VI_SUCCESS, "Trace peak search: allocation of the work arrays");
+		goto Error;
+	}
 
-/*****************************************************************************************************/
-/*  RsCore_QueryViBoolean
-    Uses RsCore_QueryInstrShortString to query the instrument data and returns it as ViBoolean value
-    If you do not need the response, set the value to NULL
-******************************************************************************************************/
-ViStatus RsCore_QueryViBoolean(ViSession instrSession, ViConstString query, ViPBoolean value)
-{
-	ViStatus error = VI_SUCCESS;
-	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "OFF";
+	leftMinimum = (ViReal64*)memory;
+	rightMinimum = leftMinimum + points;
+	stackMinimum = rightMinimum + points;
+	peaks = (RsCoreTracePeak*)(stackMinimum + points);
+	stackIndex = (ViInt32*)(peaks + points);
 
-	if (RsCore_Simulating(instrSession))
+	RsCoreInt_TraceSideMinimum(y, points, 1, stackIndex, stackMinimum, leftMinimum);
+	RsCoreInt_TraceSideMinimum(y, points, -1, stackIndex, stackMinimum, rightMinimum);
+
+	for (i = 0; i < points; i++)
 	{
-		if (value)
-			*value = VI_FALSE;
+		// The first point of a plateau represents it
+		if (y[i] < threshold || (i > 0 && y[i - 1] >= y[i]) || (i < points - 1 && y[i + 1] > y[i]))
+			continue;
 
-		goto Error;
+		// The trace edges are open, there is nothing to fall on their outer side
+		if ((i > 0 && y[i] - leftMinimum[i] < excursion) || (i < points - 1 && y[i] - rightMinimum[i] < excursion))
+			continue;
+
+		peaks[peaksCount].index = i;
+		peaks[peaksCount].level = y[i];
+		peaksCount++;
 	}
 
-	checkErr(RsCore_QueryViStringShort(instrSession, query, response));
+	qsort(peaks, peaksCount, sizeof(RsCoreTracePeak), RsCoreInt_ComparePeakLevel);
+	if (peaksCount > maxPeaks)
+		peaksCount = maxPeaks;
 
-	if (value)
-		*value = RsCore_Convert_String_To_Boolean(response);
+	if (sortOrder == RS_VAL_PEAK_SORT_X)
+		qsort(peaks, peaksCount, sizeof(RsCoreTracePeak), RsCoreInt_ComparePeakIndex);
+
+	for (i = 0; i < peaksCount; i++)
+	{
+		if (peakIndexes != NULL)
+			peakIndexes[i] = peaks[i].index;
+
+		if (peakX != NULL)
+			peakX[i] = RsCoreInt_TraceX(x, peaks[i].index);
+
+		if (peakY != NULL)
+			peakY[i] = peaks[i].level;
+	}
+
+	*peaksFound = peaksCount;
 
 Error:
+	if (memory != NULL)
+		RsCoreInt_Free(gAllocator, memory);
+
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryViBooleanWithOpc
-	Sends an OPC-synchronized query to the instrument and returns it as ViBoolean value
-	The response read is limited to RS_MAX_SHORT_MESSAGE_BUF_SIZE (64 bytes)
-	Set the parameter timeoutMs to 0 in order to use the session OPC timeout.
-	Because of the order of commands, this function also calls the driver's CheckStatus callback.
-	If you use this function, do not call the CheckStatus anymore
-	If you do not need the response, set the value to NULL
+/*  RsCore_TraceNdBBandwidth
+    Returns the N dB bandwidth around the peak at peakIndex: the x positions left and right of the peak,
+    where the trace first falls ndB below the peak level. The positions are linearly interpolated between the points.
+    x can be NULL, the positions are then fractional point indexes. bandwidth can be NULL if not needed
 ******************************************************************************************************/
-ViStatus RsCore_QueryViBooleanWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs, ViPBoolean value)
+ViStatus RsCore_TraceNdBBandwidth(const ViReal64 x[], const ViReal64 y[], ViInt32 points, ViInt32 peakIndex, ViReal64 ndB,
+                                  ViReal64* lowerX, ViReal64* upperX, ViReal64* bandwidth)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE] = "OFF";
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViReal64 level;
+	ViInt32 lower, upper;
 
-	if (RsCore_Simulating(instrSession))
+	if (y == NULL || lowerX == NULL || upperX == NULL)
 	{
-		if (value)
-			*value = VI_FALSE;
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS, "Trace N dB bandwidth: y, lowerX or upperX is NULL");
+		return RS_ERROR_NULL_POINTER;
+	}
 
-		goto Error;
+	if (peakIndex < 0 || peakIndex >= points || ndB <= 0.0)
+	{
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace N dB bandwidth: invalid peakIndex " _PERCD " (points " _PERCD ") or N dB %.12g", peakIndex, points, ndB);
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, errorElab);
+		return RS_ERROR_INVALID_PARAMETER;
 	}
 
-	checkErr(RsCoreInt_QueryViStringWithOpc(instrSession, query, VI_TRUE, timeoutMs, RS_MAX_SHORT_MESSAGE_BUF_SIZE, response));
+	level = y[peakIndex] - ndB;
+	for (lower = peakIndex; lower > 0 && y[lower] > level; lower--);
+	for (upper = peakIndex; upper < points - 1 && y[upper] > level; upper++);
 
-	if (value)
-		*value = RsCore_Convert_String_To_Boolean(response);
+	if (y[lower] > level || y[upper] > level)
+	{
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace N dB bandwidth: the trace does not fall %.12g dB below the peak on the %s side", ndB,
+		         (y[lower] > level) ? "lower" : "upper");
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_VALUE_NOT_AVAILABLE, VI_SUCCESS, errorElab);
+		return RS_ERROR_VALUE_NOT_AVAILABLE;
+	}
 
-Error:
-	return error;
+	// Interpolate between the crossing point and its neighbour towards the peak
+	*lowerX = RsCoreInt_TraceX(x, lower) +
+		(RsCoreInt_TraceX(x, lower + 1) - RsCoreInt_TraceX(x, lower)) * (level - y[lower]) / (y[lower + 1] - y[lower]);
+	*upperX = RsCoreInt_TraceX(x, upper) +
+		(RsCoreInt_TraceX(x, upper - 1) - RsCoreInt_TraceX(x, upper)) * (level - y[upper]) / (y[upper - 1] - y[upper]);
+	if (bandwidth != NULL)
+		*bandwidth = *upperX - *lowerX;
+
+	return VI_SUCCESS;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryStringIndex
-	Queries string response from the instrument, trims it for LF, and searches for it in the provided patternsArray.
-	The last element of the patternsArray must be NULL
-	Returned patternIdx is the index of the response in the patternsArray
-	If the response is not found, the patternIdx = -1
-	The response length is limited to the maximum of RS_MAX_MESSAGE_BUF_SIZE (4096 bytes)
+/*  RsCore_TraceMarkersAt
+    Returns the trace levels at any number of x positions (markers), linearly interpolated between the points.
+    The x axis must be ascending, the marker positions can be in any order. Positions outside of the axis are an error.
+    x can be NULL, the marker positions are then (fractional) point indexes
 ******************************************************************************************************/
-ViStatus RsCore_QueryStringIndex(ViSession instrSession, ViConstString query, ViString patternsArray[], ViInt32* patternIdx)
+ViStatus RsCore_TraceMarkersAt(const ViReal64 x[], const ViReal64 y[], ViInt32 points,
+                               ViInt32 markersCount, const ViReal64 markerX[], ViReal64 markerY[])
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar response[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 marker;
+	ViInt32 low, high, middle;
+	ViReal64 position, first, last;
 
-	*patternIdx = -1;
+	if (y == NULL || (markersCount > 0 && (markerX == NULL || markerY == NULL)))
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS, "Trace markers: y, markerX or markerY is NULL");
+		return RS_ERROR_NULL_POINTER;
+	}
 
-	if (RsCore_Simulating(instrSession))
+	if (points <= 0)
 	{
-		*patternIdx = 0;
-		goto Error;
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, "Trace markers: the trace has no points");
+		return RS_ERROR_INVALID_PARAMETER;
 	}
 
-	checkErr(RsCore_QueryViString(instrSession, query, response));
-	*patternIdx = RsCore_FindStringIndex(patternsArray, response);
+	first = RsCoreInt_TraceX(x, 0);
+	last = RsCoreInt_TraceX(x, points - 1);
+	for (marker = 0; marker < markersCount; marker++)
+	{
+		position = markerX[marker];
+		if (position < first || position > last)
+		{
+			snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Trace markers: marker " _PERCD " position %.12g is outside of the trace x range %.12g .. %.12g",
+			         marker + 1, position, first, last);
+			(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, errorElab);
+			return RS_ERROR_INVALID_PARAMETER;
+		}
 
-Error:
-	return error;
+		// Last point with x <= position
+		low = 0;
+		high = points - 1;
+		while (low < high)
+		{
+			middle = low + (high - low + 1) / 2;
+			if (RsCoreInt_TraceX(x, middle) <= position)
+				low = middle;
+			else
+				high = middle - 1;
+		}
+
+		if (low == points - 1 || RsCoreInt_TraceX(x, low + 1) == RsCoreInt_TraceX(x, low))
+			markerY[marker] = y[low];
+		else
+			markerY[marker] = y[low] + (y[low + 1] - y[low]) * (position - RsCoreInt_TraceX(x, low)) /
+				(RsCoreInt_TraceX(x, low + 1) - RsCoreInt_TraceX(x, low));
+	}
+
+	return VI_SUCCESS;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryAsciiViReal64Array
-    Queries the instrument for an ASCII-format comma-separated float values
-    and returns them as ViReal64 array
-    WARNING!!! - Deallocate the dblArray after use.
+/*  RsCoreInt_LimitInterpolate
+    Interpolates between two limit points with the spacings of the limit line.
+    The logarithmic x spacing falls back to the linear one for non-positive values.
+    The y values are levels in dB, the logarithmic y spacing interpolates them in the linear power domain
 ******************************************************************************************************/
-ViStatus RsCore_QueryAsciiViReal64Array(ViSession instrSession, ViConstString query, ViReal64** dblArray, ViInt32* arraySize)
+static ViReal64 RsCoreInt_LimitInterpolate(const RsCoreLimitLine* line, ViReal64 x0, ViReal64 y0, ViReal64 x1, ViReal64 y1, ViReal64 x)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar* auxString = NULL;
+	ViReal64 ratio, p0, p1;
 
-	if (RsCore_Simulating(instrSession))
-	{
-		*arraySize = 1;
-		checkAlloc(*dblArray = (ViReal64 *)calloc(1, sizeof(ViReal64)));
-		(*dblArray)[0] = 0.0;
+	if (line->xSpacing == RS_VAL_LIMIT_SPACING_LOG && x0 > 0.0 && x > 0.0)
+		ratio = log(x / x0) / log(x1 / x0);
+	else
+		ratio = (x - x0) / (x1 - x0);
 
-		goto Error;
+	if (line->ySpacing == RS_VAL_LIMIT_SPACING_LOG)
+	{
+		p0 = pow(10.0, y0 / 10.0);
+		p1 = pow(10.0, y1 / 10.0);
+		return 10.0 * log10(p0 + (p1 - p0) * ratio);
 	}
 
-	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &auxString));
-	checkErr(RsCore_Convert_String_To_ViReal64Array(instrSession, auxString, dblArray, arraySize));
-
-Error:
-	if (auxString)
-		free(auxString);
-
-	return error;
+	return y0 + (y1 - y0) * ratio;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryAsciiViInt32Array
-    Queries the instrument for an ASCII-format comma-separated integer values
-    and returns them as ViInt32 array
-    WARNING!!! - Deallocate the intArray after use.
+/*  RsCoreInt_TraceLimitCheckLine
+    Checks the trace against one limit line in one pass, the trace and the limit x values are both ascending
 ******************************************************************************************************/
-ViStatus RsCore_QueryAsciiViInt32Array(ViSession instrSession, ViConstString query, ViInt32** intArray, ViInt32* arraySize)
+static void RsCoreInt_TraceLimitCheckLine(const ViReal64 x[], const ViReal64 y[], ViInt32 points, ViReal64 xReference,
+                                          ViReal64 yReference, const RsCoreLimitLine* line, RsCoreLimitResult* result)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar* auxString = NULL;
+	ViReal64 xShift = line->xOffset + ((line->xScaling == RS_VAL_LIMIT_SCALING_REL) ? xReference : 0.0);
+	ViReal64 yShift = line->yOffset + ((line->yScaling == RS_VAL_LIMIT_SCALING_REL) ? yReference : 0.0);
+	ViBoolean upper = (ViBoolean)(line->type == RS_VAL_LIMIT_LINE_UPPER);
+	ViReal64 first = line->x[0] + xShift;
+	ViReal64 last = line->x[line->count - 1] + xShift;
+	ViReal64 x0, x1, limit, margin;
+	ViInt32 i, k = 0, j;
+
+	memset(result, 0, sizeof(RsCoreLimitResult));
+	result->passed = VI_TRUE;
+	result->worstMargin = DBL_MAX;
+	result->worstIndex = -1;
+
+	for (i = 0; i < points; i++)
+	{
+		if (x[i] < first || x[i] > last)
+			continue;
 
-	if (RsCore_Simulating(instrSession))
-	{
-		*arraySize = 1;
-		checkAlloc(*intArray = (ViInt32 *)calloc(1, sizeof(ViInt32)));
-		(*intArray)[0] = 0;
+		while (k < line->count - 2 && line->x[k + 1] + xShift < x[i])
+			k++;
 
-		goto Error;
-	}
+		x0 = line->x[k] + xShift;
+		x1 = line->x[k + 1] + xShift;
+		if (x[i] > x0 && x[i] < x1)
+		{
+			limit = RsCoreInt_LimitInterpolate(line, x0, line->y[k] + yShift, x1, line->y[k + 1] + yShift, x[i]);
+		}
+		else
+		{
+			// The point is on limit point(s), at vertical steps the stricter value applies
+			limit = upper ? DBL_MAX : -DBL_MAX;
+			for (j = k; j < line->count && line->x[j] + xShift <= x[i]; j++)
+			{
+				if (line->x[j] + xShift < x[i])
+					continue;
 
-	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &auxString));
-	checkErr(RsCore_Convert_String_To_ViInt32Array(instrSession, auxString, intArray, arraySize));
+				if (upper ? (line->y[j] + yShift < limit) : (line->y[j] + yShift > limit))
+					limit = line->y[j] + yShift;
+			}
+		}
 
-Error:
-	if (auxString)
-		free(auxString);
+		if (line->yScaling == RS_VAL_LIMIT_SCALING_REL && limit < line->threshold)
+			limit = line->threshold;
 
-	return error;
+		margin = upper ? limit - y[i] : y[i] - limit;
+		result->checkedPoints++;
+		if (margin < 0.0)
+			result->failedPoints++;
+		else if (margin < line->margin)
+			result->marginPoints++;
+
+		if (margin < result->worstMargin)
+		{
+			result->worstMargin = margin;
+			result->worstX = x[i];
+			result->worstIndex = i;
+		}
+	}
+
+	result->passed = (ViBoolean)(result->failedPoints == 0);
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryAsciiViBooleanArray
-    Queries the instrument for an ASCII-format comma-separated boolean values
-    and returns them as ViBoolean array
-    WARNING!!! - Deallocate the boolArray after use.
-******************************************************************************************************/
-ViStatus RsCore_QueryAsciiViBooleanArray(ViSession instrSession, ViConstString query, ViBoolean** boolArray, ViInt32* arraySize)
+/*  RsCore_TraceLimitCheck
+    Checks a fetched trace against any number of in-memory limit lines, without any instrument IO.
+    The trace x values are ascending. The xReference (center frequency) and yReference (reference level)
+    apply to the limit lines with the relative scaling.
+    Returns the result of each line, and optionally the line, margin and x of the worst margin over all lines.
+    worstLine is -1 and worstMargin DBL_MAX if no trace point is within any of the limit lines
+******************************************************************************************************/
+ViStatus RsCore_TraceLimitCheck(const ViReal64 x[], const ViReal64 y[], ViInt32 points, ViReal64 xReference, ViReal64 yReference,
+                                ViInt32 linesCount, const RsCoreLimitLine lines[], RsCoreLimitResult results[],
+                                ViInt32* worstLine, ViReal64* worstMargin, ViReal64* worstX)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar* auxString = NULL;
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 line, worst = -1;
 
-	if (RsCore_Simulating(instrSession))
+	for (line = 0; line < linesCount; line++)
 	{
-		*arraySize = 1;
-		checkAlloc(*boolArray = (ViBoolean *)calloc(1, sizeof(ViBoolean)));
-		(*boolArray)[0] = VI_FALSE;
+		if (lines[line].count < 2 || lines[line].x == NULL || lines[line].y == NULL ||
+			(lines[line].type != RS_VAL_LIMIT_LINE_LOWER && lines[line].type != RS_VAL_LIMIT_LINE_UPPER))
+		{
+			snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+			         "Trace limit check: limit line " _PERCD " has an invalid type " _PERCD " or less than 2 points",
+			         line + 1, lines[line].type);
+			(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, errorElab);
+			return RS_ERROR_INVALID_PARAMETER;
+		}
+	}
 
-		goto Error;
+	for (line = 0; line < linesCount; line++)
+	{
+		RsCoreInt_TraceLimitCheckLine(x, y, points, xReference, yReference, &lines[line], &results[line]);
+		if (results[line].worstIndex >= 0 && (worst < 0 || results[line].worstMargin < results[worst].worstMargin))
+			worst = line;
 	}
 
-	checkErr(RsCore_QueryViStringUnknownLength(instrSession, query, &auxString));
-	checkErr(RsCore_Convert_String_To_ViBooleanArray(instrSession, auxString, boolArray, arraySize));
+	if (worstLine != NULL)
+		*worstLine = worst;
 
-Error:
-	if (auxString)
-		free(auxString);
+	if (worstMargin != NULL)
+		*worstMargin = (worst >= 0) ? results[worst].worstMargin : DBL_MAX;
 
-	return error;
+	if (worstX != NULL)
+		*worstX = (worst >= 0) ? results[worst].worstX : 0.0;
+
+	return VI_SUCCESS;
 }
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
----- Instrument Binary Data IO -----------------------------------------------------------------------*
+---- Trace cache -------------------------------------------------------------------------------------*
 ------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
 
 /*****************************************************************************************************/
-/*  RsCore_WriteBinaryDataBlock
-    Writes binary data block to the instrument including binary data header.
-    You just need to provide the command, payload data and the payload length
+/*  RsCoreInt_TraceCacheClear
+    Releases all the trace cache entries of the session
 ******************************************************************************************************/
-ViStatus RsCore_WriteBinaryDataBlock(ViSession instrSession, ViConstString command, ViByte* data, ViInt64 dataSize)
+void RsCoreInt_TraceCacheClear(RsCoreSessionPtr rsSession)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	ViByte* p2data = data;
-	ViInt64 remainingBytes;
-	ViInt32 chunkSize;
-	ViUInt32 retCnt;
-	RsCoreSessionPtr rsSession = NULL;
+	ViInt32 idx;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	for (idx = 0; idx < rsSession->traceCacheCount; idx++)
+		RsCoreInt_Free(rsSession->allocator, rsSession->traceCache[idx].data);
 
-	chunkSize = rsSession->ioSegmentSize;
-	if (dataSize < chunkSize)
-	{
-		// Can be written in one segment
-		checkErr(RsCoreInt_SendBinDataHeader(instrSession, command, dataSize));
-		if (rsSession->addTermCharToWriteBinBlock)
-		{
-			checkErr(viWrite(instrSession, data, (ViUInt32)dataSize, &retCnt));
-			errElab[0] = '\n';
-			(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
-			checkErr(viWrite(instrSession, (ViBuf)errElab, 1, NULL));
-		}
-		else
-		{
-			(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
-			checkErr(viWrite(instrSession, data, (ViUInt32)dataSize, &retCnt));
-		}
+	RsCoreInt_Free(rsSession->allocator, rsSession->traceCache);
+	rsSession->traceCache = NULL;
+	rsSession->traceCacheCount = 0;
+	rsSession->traceCacheAllocated = 0;
+}
 
-		if (dataSize != (ViInt64)retCnt)
-		{
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "Rs_WriteBinaryData: Written data length " _PERCU " bytes is different than the indicated dataSize size " _PERCLD " bytes",
-			         retCnt, dataSize);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-		}
-	}
-	else
+/*****************************************************************************************************/
+/*  RsCoreInt_TraceCacheEntry
+    Returns the trace cache entry of the dataQuery. If create is VI_TRUE, a missing entry is added (invalid),
+    otherwise the function returns NULL for a missing entry
+******************************************************************************************************/
+static RsCoreTraceCacheEntryPtr RsCoreInt_TraceCacheEntry(RsCoreSessionPtr rsSession, ViConstString dataQuery, ViBoolean create)
+{
+	ViInt32 idx, newAllocated;
+	RsCoreTraceCacheEntryPtr newList, entry;
+
+	for (idx = 0; idx < rsSession->traceCacheCount; idx++)
 	{
-		// Write in more segments
-		remainingBytes = dataSize;
-		checkErr(RsCoreInt_SendBinDataHeader(instrSession, command, dataSize));
-		while (remainingBytes > 0)
-		{
-			if (remainingBytes > chunkSize)
-			{
-				checkErr(viWrite(instrSession, p2data, chunkSize, &retCnt));
-				remainingBytes -= retCnt;
-				p2data += retCnt;
+		if (strcmp(rsSession->traceCache[idx].query, dataQuery) == 0)
+			return &rsSession->traceCache[idx];
+	}
 
-				if (chunkSize != (ViInt32)retCnt)
-				{
-					snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-					         "Rs_WriteBinaryData: Written data chunk " _PERCU " bytes is different than the indicated written data size " _PERCU " bytes",
-					         chunkSize, retCnt);
-					viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-				}
-			}
-			else
-			{
-				// Last chunk write
-				if (rsSession->addTermCharToWriteBinBlock)
-				{
-					checkErr(viWrite(instrSession, p2data, (ViUInt32)remainingBytes, &retCnt));
-					errElab[0] = '\n';
-					(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
-					checkErr(viWrite(instrSession, (ViBuf)errElab, 1, NULL));
-				}
-				else
-				{
-					(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
-					checkErr(viWrite(instrSession, p2data, (ViUInt32)remainingBytes, &retCnt));
-				}
+	if (create == VI_FALSE)
+		return NULL;
 
-				if (remainingBytes != retCnt)
-				{
-					snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-					         "Rs_WriteBinaryData: Written data last chunk " _PERCLD " bytes is different than the indicated written data size " _PERCU
-					         " bytes",
-					         remainingBytes, retCnt);
-					viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-				}
-				remainingBytes -= retCnt;
-				break;
-			}
-		}
+	if (rsSession->traceCacheCount == rsSession->traceCacheAllocated)
+	{
+		newAllocated = rsSession->traceCacheAllocated > 0 ? rsSession->traceCacheAllocated * 2 : 8;
+		newList = (RsCoreTraceCacheEntryPtr)RsCoreInt_Realloc(rsSession->allocator, rsSession->traceCache, newAllocated * sizeof(RsCoreTraceCacheEntry));
+		if (newList == NULL)
+			return NULL;
 
-		if (remainingBytes != 0)
-		{
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "RsCore_WriteBinaryDataBlock: Written data length " _PERCLD " bytes is different than the indicated data size " _PERCLD " bytes",
-			         dataSize - remainingBytes, dataSize);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-		}
+		rsSession->traceCache = newList;
+		rsSession->traceCacheAllocated = newAllocated;
 	}
 
+	entry = &rsSession->traceCache[rsSession->traceCacheCount++];
+	memset(entry, 0, sizeof(RsCoreTraceCacheEntry));
+	RsCoreInt_StrcpyMaxLen(entry->query, RS_MAX_MESSAGE_LEN, dataQuery);
+	entry->settingsGeneration = rsSession->settingsGeneration - 1;
+
+	return entry;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_SetTraceCacheEnabled
+    Switches the trace cache of the session ON or OFF (default). Switching it OFF releases the cached traces.
+    The same as the option string token 'TraceCache=1'
+******************************************************************************************************/
+ViStatus RsCore_SetTraceCacheEnabled(ViSession instrSession, ViBoolean enabled)
+{
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	rsSession->traceCacheEnabled = enabled;
+	if (enabled == VI_FALSE)
+		RsCoreInt_TraceCacheClear(rsSession);
+
 Error:
-	(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
-
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryBinaryDataBlock
-    Queries binary data of from the instrument.
-    If errorIfNotBinDataBlock == TRUE, the function generates error in case the
-    data is not binary block (not starting with '#')
-    If errorIfNotBinDataBlock == FALSE, the function returns read data and indicates isBinDataBlock = FALSE.
-    If you do not need the isBinDataBlock info, set the pointer to NULL
-    WARNING!!! Deallocate the buffer after use
+/*  RsCore_TraceCacheEnabled
+    Returns VI_TRUE if the trace cache of the session is ON
 ******************************************************************************************************/
-ViStatus RsCore_QueryBinaryDataBlock(ViSession instrSession,
-                                     ViConstString query,
-                                     ViBoolean errorIfNotBinDataBlock,
-                                     ViBoolean* isBinDataBlock,
-                                     ViByte** outputBuffer,
-                                     ViInt64* byteCount)
+ViBoolean RsCore_TraceCacheEnabled(ViSession instrSession)
 {
-	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
 
-	checkErr(RsCore_Write(instrSession, query));
-	checkErr(RsCoreInt_ReadBinaryDataBlock(instrSession, errorIfNotBinDataBlock, isBinDataBlock, outputBuffer, byteCount));
+	if (RsCore_GetRsSession(instrSession, &rsSession) < VI_SUCCESS)
+		return VI_FALSE;
 
-Error:
-	return error;
+	return rsSession->traceCacheEnabled;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryBinaryDataBlockWithOpc
-    Queries binary data from the instrument with OPC-synchronization
-    If errorIfNotBinDataBlock == TRUE, the function generates error in case the
-    data is not binary block (not starting with '#')
-    If errorIfNotBinDataBlock == FALSE, the function returns read data and indicates isBinDataBlock = FALSE.
-    If you do not need the isBinDataBlock info, set the pointer to NULL
-    Because of the order of commands, this function also calls the driver's CheckStatus callback.
-    If you use this function, do not call the CheckStatus anymore
-    WARNING!!! Deallocate the buffer after use
+/*  RsCore_InvalidateTraceCache
+    Invalidates all the cached traces of the session. Every write of a setting command does it automatically,
+    call it if the trace data changes without any command, e.g. after a manual operation on the instrument
 ******************************************************************************************************/
-ViStatus RsCore_QueryBinaryDataBlockWithOpc(ViSession instrSession,
-                                            ViConstString query,
-                                            ViBoolean errorIfNotBinDataBlock,
-                                            ViInt32 timeoutMs,
-                                            ViBoolean* isBinDataBlock,
-                                            ViByte** outputBuffer,
-                                            ViInt64* byteCount)
+ViStatus RsCore_InvalidateTraceCache(ViSession instrSession)
 {
-	return RsCoreInt_QueryBinaryDataBlockWithOpc(instrSession, query, errorIfNotBinDataBlock, isBinDataBlock, VI_TRUE, timeoutMs, outputBuffer,
-	                                             byteCount);
+	ViStatus error = VI_SUCCESS;
+	RsCoreSessionPtr rsSession = NULL;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	rsSession->settingsGeneration++;
+
+Error:
+	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_QueryBinaryDataBlockToFile
-    This function queries instrument for binary data and writes the response to the provided file.
-    The file is opened in binary mode.
-******************************************************************************************************/
-ViStatus RsCore_QueryBinaryDataBlockToFile(ViSession instrSession,
-                                           ViConstString query,
-                                           ViConstString filename,
-                                           ViInt32 fileAction)
+/*  RsCore_QueryFloatArraySweepCached
+    Queries a trace like RsCore_QueryFloatArrayToUserBuffer, and with the trace cache ON, serves repeated reads
+    of the same sweep from the memory.
+    The sweepQuery returns the instrument sweep number, e.g. 'SENS1:SWE:COUN:CURR?'.
+    A cached trace is valid if no setting command was written since its read and the sweep number is unchanged.
+    Use it only if the sweep number changes with each new trace, e.g. in single sweep with a sweep count.
+    In continuous sweep the trace changes while the sweep number can stay the same.
+    Then the trace read costs only the sweep number query. Otherwise the sweep number and the trace are read
+    in one transaction '<sweepQuery>;<dataQuery>', so the cached trace always belongs to its sweep number.
+    fromCache returns VI_TRUE if the trace came from the cache, set it to NULL if not needed.
+    The outArraySize returns the number of points of the trace. If it is bigger than the arraySize,
+    the function copies arraySize points and returns the number of points as a positive warning
+******************************************************************************************************/
+ViStatus RsCore_QueryFloatArraySweepCached(ViSession instrSession, ViConstString sweepQuery, ViConstString dataQuery,
+                                           ViInt32 arraySize, ViReal64 outDblArray[], ViInt32* outArraySize, ViBoolean* fromCache)
 {
 	ViStatus error = VI_SUCCESS;
-	FILE* file = NULL;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	ViInt64 length = 0;
+	ViChar query[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViReal64* data = NULL;
+	ViInt32 points = 0;
+	ViInt32 sweepNumber = 0;
+	ViInt32 count;
+	ViUInt32 settingsGeneration;
+	RsCoreTraceCacheEntryPtr entry = NULL;
+	RsCoreSessionPtr rsSession = NULL;
 
-	if ((file = fopen(filename, (fileAction == RS_VAL_APPEND) ? "ab" : "wb")) == NULL)
+	if (fromCache)
+		*fromCache = VI_FALSE;
+
+	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+
+	if (rsSession->traceCacheEnabled == VI_FALSE || RsCore_Simulating(instrSession))
 	{
-		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "Rs_QueryBinaryDataBlockToFile: File '%s' cannot be opened for writing", filename);
-		viCheckErrElab(RS_ERROR_CANNOT_OPEN_FILE, errElab);
+		checkErr(RsCore_QueryFloatArrayToUserBuffer(instrSession, dataQuery, arraySize, outDblArray, outArraySize));
+		goto Error;
+	}
+
+	entry = RsCoreInt_TraceCacheEntry(rsSession, dataQuery, VI_FALSE);
+	if (entry != NULL && entry->settingsGeneration == rsSession->settingsGeneration)
+	{
+		checkErr(RsCore_QueryViInt32(instrSession, sweepQuery, &sweepNumber));
+		if (sweepNumber == entry->sweepNumber)
+		{
+			if (fromCache)
+				*fromCache = VI_TRUE;
+
+			*outArraySize = entry->points;
+			error = RsCore_CopyToUserBufferViReal64Array(instrSession, outDblArray, arraySize, entry->data, entry->points);
+			goto Error;
+		}
 	}
 
+	// Setting commands in the dataQuery (e.g. FORM REAL,32) do not change the trace data, they do not invalidate the cache
+	settingsGeneration = rsSession->settingsGeneration;
+	snprintf(query, RS_MAX_MESSAGE_BUF_SIZE, "%s;%s", sweepQuery, dataQuery);
 	checkErr(RsCore_Write(instrSession, query));
-	checkErr(RsCoreInt_ParseBinaryDataHeader(instrSession, VI_TRUE, NULL, &length, NULL));
-	checkErr(RsCoreInt_ReadDataKnownLengthToFile(instrSession, length, file, NULL));
+	rsSession->settingsGeneration = settingsGeneration;
+
+	checkErr(RsCore_ReadUpToCharacter(instrSession, ';', RS_MAX_SHORT_MESSAGE_BUF_SIZE - 1, (ViBuf)response, &count));
+	response[count > 0 ? count - 1 : 0] = '\0';
+	sweepNumber = (ViInt32)atol(response);
+	checkErr(RsCoreInt_ReadFloatArray(instrSession, &data, &points));
+
+	// No memory for the cache is not an error, the trace just stays uncached
+	entry = RsCoreInt_TraceCacheEntry(rsSession, dataQuery, VI_TRUE);
+	if (entry != NULL && points > entry->allocated)
+	{
+		RsCoreInt_Free(rsSession->allocator, entry->data);
+		entry->allocated = 0;
+		entry->data = (ViReal64*)RsCoreInt_Malloc(rsSession->allocator, (size_t)points * sizeof(ViReal64));
+		if (entry->data != NULL)
+			entry->allocated = points;
+	}
+
+	if (entry != NULL && entry->data != NULL)
+	{
+		memcpy(entry->data, data, (size_t)points * sizeof(ViReal64));
+		entry->points = points;
+		entry->sweepNumber = sweepNumber;
+		entry->settingsGeneration = rsSession->settingsGeneration;
+	}
+
+	*outArraySize = points;
+	error = RsCore_CopyToUserBufferViReal64Array(instrSession, outDblArray, arraySize, data, points);
 
 Error:
-	if (file)
-		(void)fclose(file);
+	if (data)
+		RsCore_Free(instrSession, data);
 
 	return error;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_WriteBinaryDataFromFile
-Writes binary data from a file you specify and writes it to instrument using VISA I/O.
-This function composes and sends the required binary data header.
-******************************************************************************************************/
-ViStatus RsCore_WriteBinaryDataFromFile(ViSession instrSession, ViConstString command, ViConstString sourceFile)
+/*  RsCore_QueryViReal64MultipleSettingsCached
+    Queries several numbers like RsCore_QueryViReal64Multiple. With the trace cache ON, the numbers are kept
+    in the trace cache until the next write of a setting command. Use it for the states that change only
+    with the settings, e.g. the marker states. Queries longer than RS_MAX_MESSAGE_LEN - 1 are never cached.
+    fromCache returns VI_TRUE if the numbers came from the cache, set it to NULL if not needed
+******************************************************************************************************/
+ViStatus RsCore_QueryViReal64MultipleSettingsCached(ViSession instrSession, ViConstString query, ViInt32 valuesCount,
+                                                    ViReal64 values[], ViBoolean* fromCache)
 {
 	ViStatus error = VI_SUCCESS;
-	ViByte* buffer = NULL;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
-	FILE* file = NULL;
-	ViInt64 fileSize = 0, remainingBytes;
-	ViInt32 chunkSize;
-	ViInt64 bytesRead;
+	RsCoreTraceCacheEntryPtr entry = NULL;
 	RsCoreSessionPtr rsSession = NULL;
 
+	if (fromCache)
+		*fromCache = VI_FALSE;
+
 	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	if ((file = fopen(sourceFile, "rb")) == NULL)
+	if (rsSession->traceCacheEnabled == VI_FALSE || RsCore_Simulating(instrSession) || strlen(query) >= RS_MAX_MESSAGE_LEN)
 	{
-		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "RsCore_WriteBinaryDataFromFile: File '%s' cannot be opened for reading", sourceFile);
-		viCheckErrElab(RS_ERROR_CANNOT_OPEN_FILE, errElab);
+		checkErr(RsCore_QueryViReal64Multiple(instrSession, query, valuesCount, values));
+		goto Error;
 	}
 
-#if defined (_CVI_)
+	entry = RsCoreInt_TraceCacheEntry(rsSession, query, VI_FALSE);
+	if (entry != NULL && entry->settingsGeneration == rsSession->settingsGeneration && entry->points == valuesCount)
+	{
+		if (fromCache)
+			*fromCache = VI_TRUE;
 
-    ViUInt32 fileSize32;
-    (void)fseek(file, 0, SEEK_END);
-    fileSize32 = ftell(file);
-    (void)fseek(file, 0, SEEK_SET);
-    fileSize = (ViInt64)fileSize32;
+		memcpy(values, entry->data, (size_t)valuesCount * sizeof(ViReal64));
+		goto Error;
+	}
 
-#elif defined(_MSC_VER)
+	checkErr(RsCore_QueryViReal64Multiple(instrSession, query, valuesCount, values));
 
-	(void)fseek(file, 0, SEEK_END);
-	fileSize = (ViInt64)_ftelli64(file);
-	(void)fseek(file, 0, SEEK_SET);
+	// No memory for the cache is not an error, the numbers just stay uncached
+	entry = RsCoreInt_TraceCacheEntry(rsSession, query, VI_TRUE);
+	if (entry != NULL && valuesCount > entry->allocated)
+	{
+		RsCoreInt_Free(rsSession->allocator, entry->data);
+		entry->allocated = 0;
+		entry->data = (ViReal64*)RsCoreInt_Malloc(rsSession->allocator, (size_t)valuesCount * sizeof(ViReal64));
+		if (entry->data != NULL)
+			entry->allocated = valuesCount;
+	}
 
-#else
+	if (entry != NULL && entry->data != NULL)
+	{
+		memcpy(entry->data, values, (size_t)valuesCount * sizeof(ViReal64));
+		entry->points = valuesCount;
+		entry->sweepNumber = 0;
+		entry->settingsGeneration = rsSession->settingsGeneration;
+	}
 
-	(void)fseek(file, 0, SEEK_END);
-	fileSize = (ViInt64)ftell(file);
-	(void)fseek(file, 0, SEEK_SET);
+Error:
+	return error;
+}
 
-#endif
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Multi-column results ----------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
 
-	if (fileSize < 1)
-		fileSize = 1;
+/*****************************************************************************************************/
+/*  RsCoreInt_ScatterFloat32
+    Scatters rows of columnsCount float32 numbers to the column arrays. NULL columns are skipped
+******************************************************************************************************/
+static void RsCoreInt_ScatterFloat32(const ViReal32* source, ViInt32 rows, ViInt32 columnsCount, ViReal64* columns[])
+{
+	ViInt32 first = 0;
+	ViInt32 row, column;
+	ViReal64* destination;
 
-	chunkSize = rsSession->ioSegmentSize;
-	if (fileSize < chunkSize)
+#ifdef RSCORE_SSE2
+	if (columnsCount == 2 && columns[0] != NULL && columns[1] != NULL)
 	{
-		// Can be written in one segment
-		viCheckAllocElab(buffer = (ViByte*)calloc(sizeof(ViByte*), (size_t)fileSize),
-			"RsCore_WriteBinaryDataFromFile: Allocation of the fileSize memory");
-		bytesRead = (ViInt64)fread(buffer, sizeof(ViByte), (size_t)fileSize, file);
-		checkErr(RsCoreInt_SendBinDataHeader(instrSession, command, fileSize));
-		if (rsSession->addTermCharToWriteBinBlock)
-		{
-			checkErr(viWrite(instrSession, buffer, (ViInt32)fileSize, NULL));
-			buffer[0] = '\n';
-			(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
-			checkErr(viWrite(instrSession, buffer, 1, NULL));
-		}
-		else
-		{
-			(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
-			checkErr(viWrite(instrSession, buffer, (ViUInt32)fileSize, NULL));
-		}
+		// I/Q pairs, 4 rows per step
+		__m128 low, high, even, odd;
 
-		if (bytesRead != fileSize)
+		for (; first + 4 <= rows; first += 4)
 		{
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "RsCore_WriteBinaryDataFromFile: Length of data read from the file " _PERCLD " bytes does not match the file length " _PERCLD " bytes",
-			         bytesRead, fileSize);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+			low = _mm_loadu_ps(source + 2 * first);
+			high = _mm_loadu_ps(source + 2 * first + 4);
+			even = _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+			odd = _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+			_mm_storeu_pd(columns[0] + first, _mm_cvtps_pd(even));
+			_mm_storeu_pd(columns[0] + first + 2, _mm_cvtps_pd(_mm_movehl_ps(even, even)));
+			_mm_storeu_pd(columns[1] + first, _mm_cvtps_pd(odd));
+			_mm_storeu_pd(columns[1] + first + 2, _mm_cvtps_pd(_mm_movehl_ps(odd, odd)));
 		}
 	}
-	else
+#endif
+
+	for (column = 0; column < columnsCount; column++)
 	{
-		// Write in more segments
-		remainingBytes = fileSize;
-		viCheckAllocElab(buffer = (ViByte*)calloc(sizeof(ViByte*), chunkSize), "RsCore_WriteBinaryDataFromFile: Allocation of the chunkSize memory");
-		checkErr(RsCoreInt_SendBinDataHeader(instrSession, command, fileSize));
-		while (feof(file) == 0)
-		{
-			if (remainingBytes > chunkSize)
-			{
-				bytesRead = (ViUInt32)fread(buffer, sizeof(ViByte), chunkSize, file);
-				checkErr(viWrite(instrSession, buffer, (ViUInt32)bytesRead, NULL));
-				remainingBytes -= bytesRead;
+		destination = columns[column];
+		if (destination == NULL)
+			continue;
 
-				if (bytesRead != chunkSize)
-				{
-					snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-					         "RsCore_WriteBinaryDataFromFile: Length of data read from the file " _PERCLD " bytes does not match the chunk size " _PERCU
-					         " bytes",
-					         bytesRead, chunkSize);
-					viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
-				}
-			}
-			else
-			{
-				// Last chunk write
-				bytesRead = (ViInt64)fread(buffer, sizeof(ViByte), (ViUInt32)remainingBytes, file);
-				if (rsSession->addTermCharToWriteBinBlock)
-				{
-					checkErr(viWrite(instrSession, buffer, (ViUInt32)bytesRead, NULL));
-					buffer[0] = '\n';
-					(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
-					checkErr(viWrite(instrSession, buffer, 1, NULL));
-				}
-				else
-				{
-					(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
-					checkErr(viWrite(instrSession, buffer, (ViUInt32)bytesRead, NULL));
-				}
-				remainingBytes -= bytesRead;
-				break;
-			}
-		}
+		for (row = first; row < rows; row++)
+			destination[row] = (ViReal64)source[(size_t)row * columnsCount + column];
+	}
+}
 
-		if (remainingBytes != 0)
+/*****************************************************************************************************/
+/*  RsCoreInt_ScatterFloat64
+    Scatters rows of columnsCount float64 numbers to the column arrays. NULL columns are skipped
+******************************************************************************************************/
+static void RsCoreInt_ScatterFloat64(const ViReal64* source, ViInt32 rows, ViInt32 columnsCount, ViReal64* columns[])
+{
+	ViInt32 first = 0;
+	ViInt32 row, column;
+	ViReal64* destination;
+
+#ifdef RSCORE_SSE2
+	if (columnsCount == 2 && columns[0] != NULL && columns[1] != NULL)
+	{
+		// I/Q pairs, 2 rows per step
+		__m128d low, high;
+
+		for (; first + 2 <= rows; first += 2)
 		{
-			snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-			         "RsCore_WriteBinaryDataFromFile: Written data length " _PERCLD " bytes is smaller than the indicated file size " _PERCLD " bytes",
-			         fileSize - remainingBytes, fileSize);
-			viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
+			low = _mm_loadu_pd(source + 2 * first);
+			high = _mm_loadu_pd(source + 2 * first + 2);
+			_mm_storeu_pd(columns[0] + first, _mm_unpacklo_pd(low, high));
+			_mm_storeu_pd(columns[1] + first, _mm_unpackhi_pd(low, high));
 		}
 	}
+#endif
 
-Error:
-	(void)viSetAttribute(instrSession, VI_ATTR_SEND_END_EN, VI_TRUE);
+	for (column = 0; column < columnsCount; column++)
+	{
+		destination = columns[column];
+		if (destination == NULL)
+			continue;
 
-	if (file)
-		(void)fclose(file);
+		for (row = first; row < rows; row++)
+			destination[row] = source[(size_t)row * columnsCount + column];
+	}
+}
 
-	if (buffer)
-		free(buffer);
+/*****************************************************************************************************/
+/*  RsCoreInt_ScatterInt32
+    Scatters rows of columnsCount int32 numbers to the column arrays. NULL columns are skipped
+******************************************************************************************************/
+static void RsCoreInt_ScatterInt32(const ViInt32* source, ViInt32 rows, ViInt32 columnsCount, ViInt32* columns[])
+{
+	ViInt32 row, column;
+	ViInt32* destination;
 
-	return error;
+	for (column = 0; column < columnsCount; column++)
+	{
+		destination = columns[column];
+		if (destination == NULL)
+			continue;
+
+		for (row = 0; row < rows; row++)
+			destination[row] = source[(size_t)row * columnsCount + column];
+	}
 }
 
-/******************************************************************************************************/
-/*  RsCore_QueryFloatArray
-    Queries an array of floating-point numbers that can be returned in ASCII format or in binary format.
-    The array is always returned as the most-universal ViReal64 array.
-    - For ASCII format, the array numbers are decoded as comma-separated values.
-    - For Binary Format, the numbers are decoded based on the property binaryFloatNumbersFormat, usually float 32-bit (FORM REAL,32)
-    WARNING!!! - Deallocate the outDblArray after use. */
-/******************************************************************************************************/
-ViStatus RsCore_QueryFloatArray(ViSession instrSession, ViConstString query, ViReal64** outDblArray, ViInt32* outArraySize)
+/*****************************************************************************************************/
+/*  RsCoreInt_ScatterAscii
+    Parses the comma-separated numbers and scatters them row by row to the column arrays in one pass,
+    either to the floating-point columns or, if they are NULL, to the integer intColumns.
+    The text is modified. Returns the count of all the numbers, also of the ones beyond the columnSize rows
+******************************************************************************************************/
+static ViInt32 RsCoreInt_ScatterAscii(ViChar* text, ViInt32 columnsCount, ViReal64* columns[], ViInt32* intColumns[], ViInt32 columnSize)
+{
+	ViInt32 count = 0;
+	ViInt32 row = 0, column = 0;
+	ViChar* token = text;
+	ViChar* separator;
+
+	if (*text == '\0')
+		return 0;
+
+	do
+	{
+		separator = strchr(token, ',');
+		if (separator != NULL)
+			*separator = '\0';
+
+		if (row < columnSize && columns != NULL && columns[column] != NULL)
+			columns[column][row] = RsCore_Convert_String_To_ViReal64(token);
+		else if (row < columnSize && intColumns != NULL && intColumns[column] != NULL)
+			intColumns[column][row] = RsCore_Convert_String_To_ViInt32(token);
+
+		count++;
+		if (++column == columnsCount)
+		{
+			column = 0;
+			row++;
+		}
+
+		token = separator + 1;
+	} while (separator != NULL);
+
+	return count;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_QueryArrayColumns
+    Common part of RsCore_QueryFloatArrayColumns and RsCore_QueryIntegerArrayColumns.
+    Exactly one of the columns and intColumns is not NULL, it selects the element type
+******************************************************************************************************/
+static ViStatus RsCoreInt_QueryArrayColumns(ViSession instrSession, ViConstString query, ViInt32 columnsCount,
+                                            ViReal64* columns[], ViInt32* intColumns[], ViInt32 columnSize, ViInt32* rowsCount)
 {
 	ViStatus error = VI_SUCCESS;
+	ViConstString functionName = columns != NULL ? "RsCore_QueryFloatArrayColumns" : "RsCore_QueryIntegerArrayColumns";
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
 	ViByte* data = NULL;
 	ViBoolean isBinDataBlock;
-	ViInt64 byteCount64;
-	ViInt32 byteCount;
+	ViInt64 byteCount;
+	ViInt32 count = 0;
+	ViInt32 rows;
 	RsCoreSessionPtr rsSession = NULL;
 
+	if (rowsCount)
+		*rowsCount = 0;
+
 	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	if (RsCore_Simulating(instrSession))
+	if (columnsCount < 1)
 	{
-		*outArraySize = 1;
-		checkAlloc(*outDblArray = (ViReal64 *)calloc(1, sizeof(ViReal64)));
-		(*outDblArray)[0] = 0.0;
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE, "%s: columnsCount must be at least 1", functionName);
+		viCheckErrElab(RS_ERROR_INVALID_PARAMETER, errElab);
+	}
 
+	if (RsCore_Simulating(instrSession))
 		goto Error;
-	}
 
 	checkErr(RsCore_Write(instrSession, query));
-	checkErr(RsCoreInt_ReadBinaryDataBlock(instrSession, VI_FALSE, &isBinDataBlock, &data, &byteCount64));
-	byteCount = (ViInt32)byteCount64;
-	if (isBinDataBlock)
+	checkErr(RsCoreInt_ReadBinaryDataBlock(instrSession, VI_FALSE, &isBinDataBlock, &data, &byteCount));
+	if (isBinDataBlock && intColumns != NULL)
 	{
-		switch (rsSession->binaryFloatNumbersFormat)
+		switch (rsSession->binaryIntegerNumbersFormat)
 		{
-		case RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES:
-			checkErr(RsCore_Convert_BinaryDataBlock_To_Float32Array(instrSession, data, byteCount, outDblArray, outArraySize, VI_FALSE));
+		case RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES_SWAPPED:
+		case RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES:
+			count = (ViInt32)(byteCount / 4);
+			rows = count / columnsCount;
+			if (rsSession->binaryIntegerNumbersFormat == RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES_SWAPPED)
+				RsCore_SwapEndianness(data, (rows < columnSize ? rows : columnSize) * columnsCount, 4);
+
+			RsCoreInt_ScatterInt32((const ViInt32*)data, rows < columnSize ? rows : columnSize, columnsCount, intColumns);
 			break;
-		case RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES_SWAPPED:
-			checkErr(RsCore_Convert_BinaryDataBlock_To_Float32Array(instrSession, data, byteCount, outDblArray, outArraySize, VI_TRUE));
+		default:
+			viCheckErrElab(VI_ERROR_NSUP_MODE,
+				"RsCore_QueryIntegerArrayColumns: Unsupported mode of conversion BinDataBlock -> Integer32Array[]");
 			break;
-		case RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES:
-			*outArraySize = byteCount / 8;
-			*outDblArray = (ViReal64 *)data; // Same data, do not free the data buffer
+		}
+	}
+	else if (isBinDataBlock)
+	{
+		switch (rsSession->binaryFloatNumbersFormat)
+		{
+		case RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES_SWAPPED:
+		case RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES:
+			count = (ViInt32)(byteCount / 4);
+			rows = count / columnsCount;
+			if (rsSession->binaryFloatNumbersFormat == RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES_SWAPPED)
+				RsCore_SwapEndianness(data, (rows < columnSize ? rows : columnSize) * columnsCount, 4);
+
+			RsCoreInt_ScatterFloat32((const ViReal32*)data, rows < columnSize ? rows : columnSize, columnsCount, columns);
 			break;
 		case RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES_SWAPPED:
-			*outArraySize = byteCount / 8;
-			RsCore_SwapEndianness(data, *outArraySize, 8);
-			*outDblArray = (ViReal64 *)data; // Same data, do not free the data buffer
+		case RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES:
+			count = (ViInt32)(byteCount / 8);
+			rows = count / columnsCount;
+			if (rsSession->binaryFloatNumbersFormat == RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES_SWAPPED)
+				RsCore_SwapEndianness(data, (rows < columnSize ? rows : columnSize) * columnsCount, 8);
+
+			RsCoreInt_ScatterFloat64((const ViReal64*)data, rows < columnSize ? rows : columnSize, columnsCount, columns);
 			break;
 		default:
 			viCheckErrElab(VI_ERROR_NSUP_MODE,
-				"RsCore_QueryFloatArray: Unsupported mode of conversion BinDataBlock -> FloatArray[]");
+				"RsCore_QueryFloatArrayColumns: Unsupported mode of conversion BinDataBlock -> FloatArray[]");
 			break;
 		}
 	}
 	else
 	{
 		RsCore_TrimString((ViChar*)data, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
-		checkErr(RsCore_Convert_String_To_ViReal64Array(instrSession, (ViChar*)data, outDblArray, outArraySize));
+		count = RsCoreInt_ScatterAscii((ViChar*)data, columnsCount, columns, intColumns, columnSize);
 	}
 
+	if (rowsCount)
+		*rowsCount = count / columnsCount;
+
 Error:
-	// Same data buffer, do not free it, it goes to the user
-	if (data && (ViReal64 *)data != *outDblArray)
-		free(data);
+	if (data)
+		RsCore_Free(instrSession, data);
 
 	return error;
 }
 
-/******************************************************************************************************/
-/*  RsCore_QueryFloatArrayWithOpc
-    Queries with OPC an array of floating-point numbers that can be returned in ASCII format or in binary format.
-    Set the parameter timeoutMs to 0 in order to use the session's OPC timeout.
-    Because of the order of commands, this function also calls the driver's CheckStatus callback.
-    If you use this function, do not call the CheckStatus anymore
-    The array is always returned as the most-universal ViReal64 array.
-    - For ASCII format, the array numbers are decoded as comma-separated values.
-    - For Binary Format, the numbers are decoded based on the property binaryFloatNumbersFormat, usually float 32-bit (FORM REAL,32)
-    WARNING!!! - Deallocate the outDblArray after use. */
-/******************************************************************************************************/
-ViStatus RsCore_QueryFloatArrayWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs,
-                                                    ViReal64** outDblArray, ViInt32* outArraySize)
+/*****************************************************************************************************/
+/*  RsCore_QueryFloatArrayColumns
+    Queries an array of floating-point numbers ordered in rows of columnsCount values (e.g. X1,Y1,Z1,X2,Y2,Z2,...)
+    and returns each column in its own array, without the intermediate ViReal64 array of RsCore_QueryFloatArray.
+    The response can be in ASCII format or in binary format (binaryFloatNumbersFormat), it is converted and
+    scattered to the columns in one pass. I/Q pairs (2 columns) use SSE2 where available.
+    columns: columnsCount arrays with columnSize elements each. A NULL column is skipped.
+    rowsCount: returns the count of complete rows in the response, also if it is bigger than the columnSize.
+    Only the first columnSize rows are returned, incomplete last row is ignored
+******************************************************************************************************/
+ViStatus RsCore_QueryFloatArrayColumns(ViSession instrSession, ViConstString query, ViInt32 columnsCount,
+                                       ViReal64* columns[], ViInt32 columnSize, ViInt32* rowsCount)
 {
 	ViStatus error = VI_SUCCESS;
-	ViByte* data = NULL;
-	ViBoolean isBinDataBlock;
-	ViInt32 byteCount;
-	ViInt64 byteCount64;
-	RsCoreSessionPtr rsSession = NULL;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (columns == NULL)
+	{
+		viCheckErrElab(RS_ERROR_NULL_POINTER, "RsCore_QueryFloatArrayColumns: columns must not be NULL");
+	}
 
-	if (RsCore_Simulating(instrSession))
+	checkErr(RsCoreInt_QueryArrayColumns(instrSession, query, columnsCount, columns, NULL, columnSize, rowsCount));
+
+Error:
+	return error;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryIntegerArrayColumns
+    Queries an array of integer numbers ordered in rows of columnsCount values like RsCore_QueryFloatArrayColumns
+    and returns each column in its own ViInt32 array, without the intermediate array of RsCore_QueryIntegerArray.
+    The response can be in ASCII format or in binary format (binaryIntegerNumbersFormat, integer 32-bit).
+    columns: columnsCount arrays with columnSize elements each. A NULL column is skipped.
+    rowsCount: returns the count of complete rows in the response, also if it is bigger than the columnSize.
+    Only the first columnSize rows are returned, incomplete last row is ignored
+******************************************************************************************************/
+ViStatus RsCore_QueryIntegerArrayColumns(ViSession instrSession, ViConstString query, ViInt32 columnsCount,
+                                         ViInt32* columns[], ViInt32 columnSize, ViInt32* rowsCount)
+{
+	ViStatus error = VI_SUCCESS;
+
+	if (columns == NULL)
 	{
-		*outArraySize = 1;
-		checkAlloc(*outDblArray = (ViReal64 *)calloc(1, sizeof(ViReal64)));
-		(*outDblArray)[0] = 0.0;
+		viCheckErrElab(RS_ERROR_NULL_POINTER, "RsCore_QueryIntegerArrayColumns: columns must not be NULL");
+	}
+
+	checkErr(RsCoreInt_QueryArrayColumns(instrSession, query, columnsCount, NULL, columns, columnSize, rowsCount));
+
+Error:
+	return error;
+}
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Trace archive -----------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
+#define RS_TRACE_ARCHIVE_MAGIC "RSTRARC"
+
+/*****************************************************************************************************/
+/*  RsCoreInt_TraceArchiveRowData
+    Returns the mapped values of the row with the entered sequence number
+******************************************************************************************************/
+static ViReal32* RsCoreInt_TraceArchiveRowData(RsCoreTraceArchivePtr archive, ViInt64 sequence)
+{
+	return archive->rows + (size_t)(sequence % archive->capacity) * (size_t)archive->points;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_TraceArchiveBegin
+    Checks that the archive is opened and returns the mapped row for the next appended values.
+    A timestamp older than the newest row, e.g. after the system clock was set back, is raised
+    to the newest row timestamp, so that the index stays sorted.
+    Call RsCoreInt_TraceArchiveRetire before writing to the row
+******************************************************************************************************/
+static ViStatus RsCoreInt_TraceArchiveBegin(RsCoreTraceArchivePtr archive, ViReal64* timestamp, ViReal32** row)
+{
+	ViInt64 appended;
+	ViReal64 lastTimestamp;
+
+	if (archive == NULL)
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS, "Trace archive: the archive is NULL");
+		return RS_ERROR_NULL_POINTER;
+	}
+
+	if (archive->header == NULL)
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NOT_INITIALIZED, VI_SUCCESS, "Trace archive is not opened");
+		return RS_ERROR_NOT_INITIALIZED;
+	}
+
+	appended = archive->header->appended;
+	if (appended > 0)
+	{
+		lastTimestamp = archive->index[(appended - 1) % archive->capacity].timestamp;
+		if (*timestamp < lastTimestamp)
+			*timestamp = lastTimestamp;
+	}
+
+	*row = RsCoreInt_TraceArchiveRowData(archive, appended);
+	return VI_SUCCESS;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_TraceArchiveRetire
+    If the ring is full, retires the oldest row, whose slot the next appended row reuses. Call it after
+    the appended values are validated, right before the row is written, so that a rejected append keeps
+    all the rows and a failed or not yet finished write never shows up as a retained row
+******************************************************************************************************/
+static void RsCoreInt_TraceArchiveRetire(RsCoreTraceArchivePtr archive)
+{
+	ViInt64 appended = archive->header->appended;
+
+	if (archive->header->retired < appended - archive->capacity + 1)
+		archive->header->retired = appended - archive->capacity + 1;
+}
+
+/*****************************************************************************************************/
+/*  RsCoreInt_TraceArchiveCommit
+    Writes the index entry of the already filled next row and publishes the row by appending it.
+    The unused rest of a shorter row is set to zero
+******************************************************************************************************/
+static void RsCoreInt_TraceArchiveCommit(RsCoreTraceArchivePtr archive, ViReal64 timestamp, ViInt32 sweepNumber, ViInt32 points)
+{
+	ViInt64 appended = archive->header->appended;
+	RsCoreTraceArchiveIndexEntry* entry = &archive->index[appended % archive->capacity];
+
+	if (points < archive->points)
+		memset(RsCoreInt_TraceArchiveRowData(archive, appended) + points, 0, (size_t)(archive->points - points) * sizeof(ViReal32));
+
+	entry->timestamp = timestamp;
+	entry->sweepNumber = sweepNumber;
+	entry->points = points;
+	archive->header->appended = appended + 1;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_TraceArchiveOpen
+    Opens the append-only trace archive file, or creates it if it does not exist or is empty.
+    The archive retains the newest capacity rows of points float 32-bit values with their timestamp
+    and sweep number. The whole file is mapped to the memory, the file size is fixed by the points and capacity.
+    An existing archive must have the same points and capacity, the appending continues after its newest row.
+    Close the archive with RsCore_TraceArchiveClose
+******************************************************************************************************/
+ViStatus RsCore_TraceArchiveOpen(ViConstString fileName, ViInt32 points, ViInt32 capacity, RsCoreTraceArchivePtr archive)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt64 indexOffset = (ViInt64)sizeof(RsCoreTraceArchiveHeader);
+	ViInt64 rowsOffset, fileSize, existingSize;
+	RsCoreTraceArchiveHeader* header = NULL;
+#if defined(ANSI)
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = NULL;
+	LARGE_INTEGER size;
+#else
+	int fd = -1;
+	struct stat fileStat;
+#endif
+
+	if (fileName == NULL || archive == NULL)
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS, "Trace archive: the file name or the archive is NULL");
+		return RS_ERROR_NULL_POINTER;
+	}
+
+	memset(archive, 0, sizeof(RsCoreTraceArchive));
+	errorElab[0] = '\0';
 
+	// The rows start at 64-byte boundary
+	rowsOffset = (indexOffset + (ViInt64)capacity * (ViInt64)sizeof(RsCoreTraceArchiveIndexEntry) + 63) / 64 * 64;
+	fileSize = rowsOffset + (ViInt64)capacity * (ViInt64)points * (ViInt64)sizeof(ViReal32);
+
+	if (points <= 0 || capacity <= 0)
+	{
+		error = RS_ERROR_INVALID_PARAMETER;
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace archive: invalid number of points " _PERCD " or capacity " _PERCD, points, capacity);
 		goto Error;
 	}
 
-	checkErr(RsCoreInt_QueryBinaryDataBlockWithOpc(instrSession, query, VI_FALSE, &isBinDataBlock, VI_TRUE, timeoutMs, &data, &byteCount64));
-	byteCount = (ViInt32)byteCount64;
-	if (isBinDataBlock)
+	if ((ViUInt64)fileSize > (ViUInt64)(size_t)-1)
 	{
-		switch (rsSession->binaryFloatNumbersFormat)
-		{
-		case RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES:
-			checkErr(RsCore_Convert_BinaryDataBlock_To_Float32Array(instrSession, data, byteCount, outDblArray, outArraySize, VI_FALSE));
-			break;
-		case RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES_SWAPPED:
-			checkErr(RsCore_Convert_BinaryDataBlock_To_Float32Array(instrSession, data, byteCount, outDblArray, outArraySize, VI_TRUE));
-			break;
-		case RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES:
-			*outArraySize = byteCount / 8;
-			*outDblArray = (ViReal64 *)data; // Same data, do not free the data buffer
-			break;
-		case RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES_SWAPPED:
-			*outArraySize = byteCount / 8;
-			RsCore_SwapEndianness(data, *outArraySize, 8);
-			*outDblArray = (ViReal64 *)data; // Same data, do not free the data buffer
-			break;
-		default:
-			viCheckErrElab(VI_ERROR_NSUP_MODE,
-				"RsCore_QueryFloatArrayWithOpc: Unsupported mode of conversion BinDataBlock -> FloatArray[]");
-			break;
-		}
+		error = RS_ERROR_DATA_TOO_LONG;
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace archive: the file size " _PERCLD " bytes exceeds the address space", fileSize);
+		goto Error;
 	}
-	else
+
+#if defined(ANSI)
+	file = CreateFileA(fileName, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
 	{
-		RsCore_TrimString((ViChar*)data, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
-		checkErr(RsCore_Convert_String_To_ViReal64Array(instrSession, (ViChar*)data, outDblArray, outArraySize));
+		error = RS_ERROR_CANNOT_OPEN_FILE;
+		goto Error;
+	}
+
+	if (!GetFileSizeEx(file, &size))
+	{
+		error = RS_ERROR_READING_FILE;
+		goto Error;
+	}
+
+	existingSize = (ViInt64)size.QuadPart;
+#else
+	fd = open(fileName, O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+	{
+		error = RS_ERROR_CANNOT_OPEN_FILE;
+		goto Error;
+	}
+
+	if (fstat(fd, &fileStat) != 0)
+	{
+		error = RS_ERROR_READING_FILE;
+		goto Error;
+	}
+
+	existingSize = (ViInt64)fileStat.st_size;
+#endif
+
+	if (existingSize != 0 && existingSize != fileSize)
+	{
+		error = RS_ERROR_INVALID_FILE_FORMAT;
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace archive '%s': the file size " _PERCLD " bytes does not match " _PERCD " points and capacity " _PERCD,
+		         fileName, existingSize, points, capacity);
+		goto Error;
+	}
+
+#if defined(ANSI)
+	// The mapping extends a new file to the full size
+	mapping = CreateFileMappingA(file, NULL, PAGE_READWRITE, (DWORD)((ViUInt64)fileSize >> 32), (DWORD)((ViUInt64)fileSize & 0xFFFFFFFF), NULL);
+	if (mapping != NULL)
+		header = (RsCoreTraceArchiveHeader*)MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+#else
+	if (existingSize == 0 && ftruncate(fd, (off_t)fileSize) != 0)
+	{
+		error = RS_ERROR_WRITING_FILE;
+		goto Error;
+	}
+
+	header = (RsCoreTraceArchiveHeader*)mmap(NULL, (size_t)fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (header == (RsCoreTraceArchiveHeader*)MAP_FAILED)
+		header = NULL;
+#endif
+
+	if (header == NULL)
+	{
+		error = RS_ERROR_WRITING_FILE;
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "Trace archive '%s': mapping of " _PERCLD " bytes to the memory failed", fileName, fileSize);
+		goto Error;
+	}
+
+	if (existingSize == 0)
+	{
+		memcpy(header->magic, RS_TRACE_ARCHIVE_MAGIC, sizeof(header->magic));
+		header->version = RS_VAL_TRACE_ARCHIVE_VERSION;
+		header->points = points;
+		header->capacity = capacity;
+		header->appended = 0;
+		header->retired = 0;
 	}
+	else if (memcmp(header->magic, RS_TRACE_ARCHIVE_MAGIC, sizeof(header->magic)) != 0 || header->version != RS_VAL_TRACE_ARCHIVE_VERSION ||
+	         header->points != points || header->capacity != capacity || header->appended < 0 || header->retired < 0 || header->retired > header->appended)
+	{
+		error = RS_ERROR_INVALID_FILE_FORMAT;
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace archive '%s': the file is not a trace archive with " _PERCD " points and capacity " _PERCD, fileName, points, capacity);
+		goto Error;
+	}
+
+	archive->header = header;
+	archive->index = (RsCoreTraceArchiveIndexEntry*)((ViByte*)header + indexOffset);
+	archive->rows = (ViReal32*)((ViByte*)header + rowsOffset);
+	archive->points = points;
+	archive->capacity = capacity;
+	archive->fileSize = fileSize;
+#if defined(ANSI)
+	archive->fileHandle = (void*)file;
+	archive->mappingHandle = (void*)mapping;
+#else
+	archive->fileDescriptor = (ViInt32)fd;
+#endif
+
+	return VI_SUCCESS;
 
 Error:
-	// Same data buffer, do not free it, it goes to the user
-	if (data && (ViReal64 *)data != *outDblArray)
-		free(data);
+#if defined(ANSI)
+	if (header != NULL)
+		(void)UnmapViewOfFile(header);
+
+	if (mapping != NULL)
+		(void)CloseHandle(mapping);
+
+	if (file != INVALID_HANDLE_VALUE)
+		(void)CloseHandle(file);
+#else
+	if (header != NULL)
+		(void)munmap(header, (size_t)fileSize);
+
+	if (fd >= 0)
+		(void)close(fd);
+#endif
+
+	if (errorElab[0] == '\0')
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "Trace archive '%s'", fileName);
 
+	(void)RsCore_SetErrorInfo(0, VI_TRUE, error, VI_SUCCESS, errorElab);
 	return error;
 }
 
-/******************************************************************************************************/
-/*  RsCore_QueryIntegerArray
-    Queries an array of integer numbers that can be returned in ASCII format or in binary format.
-    The array is always returned as the most-universal ViInt32 array.
-    - For ASCII format, the array numbers are decoded as comma-separated values.
-    - For Binary Format, the numbers are decoded based on the property binaryIntegerNumbersFormat, usually integer 32-bit (FORM INT,32)
-    WARNING!!! - Deallocate the outInt32Array after use. */
-/******************************************************************************************************/
-ViStatus RsCore_QueryIntegerArray(ViSession instrSession, ViConstString query, ViInt32** outInt32Array, ViInt32* outArraySize)
+/*****************************************************************************************************/
+/*  RsCore_TraceArchiveClose
+    Writes the mapped rows to the file and closes the archive. Closing a not opened archive does nothing
+******************************************************************************************************/
+void RsCore_TraceArchiveClose(RsCoreTraceArchivePtr archive)
+{
+	if (archive == NULL)
+		return;
+
+	if (archive->header != NULL)
+	{
+#if defined(ANSI)
+		(void)FlushViewOfFile(archive->header, 0);
+		(void)UnmapViewOfFile(archive->header);
+		(void)CloseHandle((HANDLE)archive->mappingHandle);
+		(void)CloseHandle((HANDLE)archive->fileHandle);
+#else
+		(void)msync(archive->header, (size_t)archive->fileSize, MS_SYNC);
+		(void)munmap(archive->header, (size_t)archive->fileSize);
+		(void)close((int)archive->fileDescriptor);
+#endif
+	}
+
+	memset(archive, 0, sizeof(RsCoreTraceArchive));
+}
+
+/*****************************************************************************************************/
+/*  RsCore_TraceArchiveTimeNow
+    Returns the current UTC time in seconds since 1970-01-01, the timestamp of the archive rows
+******************************************************************************************************/
+ViReal64 RsCore_TraceArchiveTimeNow(void)
+{
+#if defined(ANSI)
+	FILETIME fileTime;
+	ULARGE_INTEGER ticks;
+
+	// 100 ns ticks since 1601-01-01
+	GetSystemTimeAsFileTime(&fileTime);
+	ticks.LowPart = fileTime.dwLowDateTime;
+	ticks.HighPart = fileTime.dwHighDateTime;
+	return (ViReal64)(ticks.QuadPart - 116444736000000000ULL) / 1.0e7;
+#else
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_REALTIME, &ts);
+	return (ViReal64)ts.tv_sec + (ViReal64)ts.tv_nsec / 1.0e9;
+#endif
+}
+
+/*****************************************************************************************************/
+/*  RsCore_TraceArchiveAppend
+    Appends a trace available on the host, the values are stored as float 32-bit.
+    The points can be less than the archive points. A timestamp older than the newest row is stored as the newest one
+******************************************************************************************************/
+ViStatus RsCore_TraceArchiveAppend(RsCoreTraceArchivePtr archive, ViReal64 timestamp, ViInt32 sweepNumber,
+                                   ViInt32 points, const ViReal64 data[])
 {
 	ViStatus error = VI_SUCCESS;
-	ViByte* data = NULL;
-	ViBoolean isBinDataBlock = VI_FALSE;
-	ViInt32 byteCount;
-	ViInt64 byteCount64;
-	RsCoreSessionPtr rsSession = NULL;
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViReal32* row = NULL;
+	ViInt32 i;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	checkErr(RsCoreInt_TraceArchiveBegin(archive, &timestamp, &row));
 
-	if (RsCore_Simulating(instrSession))
+	if (points < 0 || points > archive->points)
 	{
-		*outArraySize = 1;
-		checkAlloc(*outInt32Array = (ViInt32 *)calloc(1, sizeof(ViInt32)));
-		(*outInt32Array)[0] = 0;
-
-		goto Error;
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "Trace archive: the trace has " _PERCD " points, the archive rows " _PERCD " points", points, archive->points);
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, errorElab);
+		return RS_ERROR_INVALID_PARAMETER;
 	}
 
-	checkErr(RsCore_Write(instrSession, query));
-	checkErr(RsCoreInt_ReadBinaryDataBlock(instrSession, VI_FALSE, &isBinDataBlock, &data, &byteCount64));
-	byteCount = (ViInt32)byteCount64;
-	if (isBinDataBlock)
-	{
-		switch (rsSession->binaryIntegerNumbersFormat)
-		{
-		case RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES:
-			*outArraySize = byteCount / 4;
-			*outInt32Array = (ViInt32 *)data; // Same data, do not free the data buffer
-			break;
-		case RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES_SWAPPED:
-			*outArraySize = byteCount / 4;
-			RsCore_SwapEndianness(data, *outArraySize, 4);
-			*outInt32Array = (ViInt32 *)data; // Same data, do not free the data buffer
-			break;
-		default:
-			viCheckErrElab(VI_ERROR_NSUP_MODE,
-				"RsCore_QueryIntegerArray: Unsupported mode of conversion BinDataBlock -> Integer32Array[]");
-			break;
-		}
-	}
-	else
+	if (data == NULL && points > 0)
 	{
-		RsCore_TrimString((ViChar*)data, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
-		checkErr(RsCore_Convert_String_To_ViInt32Array(instrSession, (ViChar*)data, outInt32Array, outArraySize));
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS, "Trace archive: the trace data is NULL");
+		return RS_ERROR_NULL_POINTER;
 	}
 
-Error:
-	// Same data buffer, do not free it, it goes to the user
-	if (data && (ViInt32 *)data != *outInt32Array)
-		free(data);
+	RsCoreInt_TraceArchiveRetire(archive);
+	for (i = 0; i < points; i++)
+		row[i] = (ViReal32)data[i];
 
+	RsCoreInt_TraceArchiveCommit(archive, timestamp, sweepNumber, points);
+
+Error:
 	return error;
 }
 
-/******************************************************************************************************/
-/*  RsCore_QueryIntegerArrayWithOpc
-    Queries with OPC an array of integer numbers that can be returned in ASCII format or in binary format.
-    Set the parameter timeoutMs to 0 in order to use the session's OPC timeout.
-    Because of the order of commands, this function also calls the driver's CheckStatus callback.
-    If you use this function, do not call the CheckStatus anymore
-    The array is always returned as the most-universal ViInt32 array.
-    - For ASCII format, the array numbers are decoded as comma-separated values.
-    - For Binary Format, the numbers are decoded based on the property binaryIntegerNumbersFormat, usually integer 32-bit (FORM INT,32)
-    WARNING!!! - Deallocate the outInt32Array after use. */
-/******************************************************************************************************/
-ViStatus RsCore_QueryIntegerArrayWithOpc(ViSession instrSession, ViConstString query, ViInt32 timeoutMs,
-                                                      ViInt32** outInt32Array, ViInt32* outArraySize)
+/*****************************************************************************************************/
+/*  RsCore_QueryTraceToArchive
+    Queries a trace in the float 32-bit binary format (FORM REAL,32) and appends it to the archive.
+    The binary data block is read directly into the mapped file row, without any intermediate buffer.
+    If the sweepQuery is not NULL, the sweep number is read in one transaction '<sweepQuery>;<dataQuery>'
+    like RsCore_QueryFloatArraySweepCached, otherwise the row sweep number is 0.
+    Use RsCore_TraceArchiveTimeNow for the timestamp of the current time
+******************************************************************************************************/
+ViStatus RsCore_QueryTraceToArchive(ViSession instrSession, ViConstString sweepQuery, ViConstString dataQuery,
+                                    RsCoreTraceArchivePtr archive, ViReal64 timestamp)
 {
 	ViStatus error = VI_SUCCESS;
-	ViByte* data = NULL;
-	ViBoolean isBinDataBlock = VI_FALSE;
-	ViInt32 byteCount;
-	ViInt64 byteCount64;
+	ViChar query[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar response[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViReal32* row = NULL;
+	ViInt64 length = 0;
+	ViInt32 sweepNumber = 0;
+	ViInt32 count;
+	ViBoolean termCharDisabled = VI_FALSE;
 	RsCoreSessionPtr rsSession = NULL;
 
 	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	checkErr(RsCoreInt_TraceArchiveBegin(archive, &timestamp, &row));
 
 	if (RsCore_Simulating(instrSession))
 	{
-		*outArraySize = 1;
-		checkAlloc(*outInt32Array = (ViInt32 *)calloc(1, sizeof(ViInt32)));
-		(*outInt32Array)[0] = 0;
-
+		RsCoreInt_TraceArchiveRetire(archive);
+		RsCoreInt_TraceArchiveCommit(archive, timestamp, 0, 0);
 		goto Error;
 	}
 
-	checkErr(RsCoreInt_QueryBinaryDataBlockWithOpc(instrSession, query, VI_FALSE, &isBinDataBlock, VI_TRUE, timeoutMs, &data, &byteCount64));
-	byteCount = (ViInt32)byteCount64;
-	if (isBinDataBlock)
+	if (rsSession->binaryFloatNumbersFormat != RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES &&
+		rsSession->binaryFloatNumbersFormat != RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES_SWAPPED)
 	{
-		switch (rsSession->binaryIntegerNumbersFormat)
-		{
-		case RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES:
-			*outArraySize = byteCount / 4;
-			*outInt32Array = (ViInt32 *)data; // Same data, do not free the data buffer
-			break;
-		case RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES_SWAPPED:
-			*outArraySize = byteCount / 4;
-			RsCore_SwapEndianness(data, *outArraySize, 4);
-			*outInt32Array = (ViInt32 *)data; // Same data, do not free the data buffer
-			break;
-		default:
-			viCheckErrElab(VI_ERROR_NSUP_MODE,
-				"RsCore_QueryIntegerArray: Unsupported mode of conversion BinDataBlock -> Integer32Array[]");
-			break;
-		}
+		viCheckErrElab(VI_ERROR_NSUP_MODE, "RsCore_QueryTraceToArchive: The archive supports only the float 32-bit binary format");
+	}
+
+	if (sweepQuery != NULL)
+	{
+		snprintf(query, RS_MAX_MESSAGE_BUF_SIZE, "%s;%s", sweepQuery, dataQuery);
+		checkErr(RsCore_Write(instrSession, query));
+		checkErr(RsCore_ReadUpToCharacter(instrSession, ';', RS_MAX_SHORT_MESSAGE_BUF_SIZE - 1, (ViBuf)response, &count));
+		response[count > 0 ? count - 1 : 0] = '\0';
+		sweepNumber = (ViInt32)atol(response);
 	}
 	else
 	{
-		RsCore_TrimString((ViChar*)data, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
-		checkErr(RsCore_Convert_String_To_ViInt32Array(instrSession, (ViChar*)data, outInt32Array, outArraySize));
+		checkErr(RsCore_Write(instrSession, dataQuery));
 	}
 
-Error:
-	// Same data buffer, do not free it, it goes to the user
-	if (data && (ViInt32 *)data != *outInt32Array)
-		free(data);
-
-	return error;
-}
-
-/******************************************************************************************************/
-/*  RsCore_QueryFloatArrayToUserBuffer
-	The function sends the query to the instrument, reads the array response and copies it to the provided user buffer
-	Before sending the command, it sends the bin format setting: ':FORM REAL,32'
-	Even if the instrument returns the data in ASCII format, the function parses it properly
-	(it uses RsCore_QueryFloatArray)
-	If the userBufferLength is smaller than read-out dataCount, the function only copies
-	the maximum provided count of the data and returns positive error number that equals the dataCount.
-	actualPointsCount can be set to NULL
-/******************************************************************************************************/
-ViStatus RsCore_QueryFloatArrayToUserBuffer(ViSession instrSession,
-										ViConstString query,
-										ViInt32 userBufferLength,
-										ViReal64 *userBuffer,
-										ViInt32* actualPointsCount)
-{
-	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 dataCount = 0;
-
-	checkErr(RsCore_Write(instrSession, ":FORM REAL,32"));
-	checkErr(RsCore_QueryFloatArray(instrSession, query, &data, &dataCount));
-	
-	if (dataCount <= userBufferLength)
+	checkErr(RsCoreInt_ParseBinaryDataHeader(instrSession, VI_TRUE, NULL, &length, NULL));
+	if (length < 0 || length % sizeof(ViReal32) != 0 || length > (ViInt64)archive->points * (ViInt64)sizeof(ViReal32))
 	{
-		// Copy the whole data
-		memcpy(userBuffer, data, dataCount * sizeof(ViReal64));
+		checkErr(RsCoreInt_FlushData(instrSession, VI_TRUE));
+		snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
+		         "RsCore_QueryTraceToArchive: Binary data of " _PERCLD " bytes does not fit the archive rows of " _PERCD " float 32-bit values",
+		         length, archive->points);
+		viCheckErrElab(RS_ERROR_UNEXPECTED_RESPONSE, errElab);
 	}
-	else
+
+	if (rsSession->vxiCapable != VI_TRUE)
 	{
-		// Copy the userBufferLength data
-		memcpy(userBuffer, data, userBufferLength * sizeof(ViReal64));
-		error = dataCount;
+		// Confirmed binary transfer, switch the read termination character OFF
+		checkErr(RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_FALSE));
+		termCharDisabled = VI_TRUE;
 	}
 
-	if (actualPointsCount)
-		*actualPointsCount = dataCount;
+	RsCoreInt_TraceArchiveRetire(archive);
+	checkErr(RsCoreInt_ReadDataKnownLength(instrSession, length, (ViByte*)row));
+	count = (ViInt32)(length / sizeof(ViReal32));
+	if (rsSession->binaryFloatNumbersFormat == RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES_SWAPPED)
+		RsCore_SwapEndianness(row, count, sizeof(ViReal32));
+
+	RsCoreInt_TraceArchiveCommit(archive, timestamp, sweepNumber, count);
 
 Error:
-	if (data)
-		free(data);
+	if (termCharDisabled)
+		(void)RsCoreInt_IoSetAttribute(instrSession, VI_ATTR_TERMCHAR_EN, VI_TRUE);
 
 	return error;
 }
 
-/******************************************************************************************************/
-/*  RsCore_QueryFloatArrayToUserBufferWithOpc
-	Same as RsCore_QueryFloatArrayWithOpc, but the query is sent with OPC-sync
-	Set the parameter timeoutMs to 0 in order to use the session's OPC timeout
-/******************************************************************************************************/
-ViStatus RsCore_QueryFloatArrayToUserBufferWithOpc(ViSession instrSession,
-										ViConstString query,
-										ViInt32 timeoutMs,
-										ViInt32 userBufferLength,
-										ViReal64 *userBuffer,
-										ViInt32* actualPointsCount)
+/*****************************************************************************************************/
+/*  RsCore_TraceArchiveRange
+    Returns the sequence number of the oldest retained row and the number of the retained rows.
+    The sequence numbers of the rows increase by one from the archive creation.
+    A NULL or not opened archive has no rows
+******************************************************************************************************/
+void RsCore_TraceArchiveRange(RsCoreTraceArchivePtr archive, ViInt64* firstSequence, ViInt64* rowsCount)
 {
-	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 dataCount = 0;
-
-	checkErr(RsCore_Write(instrSession, ":FORM REAL,32"));
-	checkErr(RsCore_QueryFloatArrayWithOpc(instrSession, query, timeoutMs, &data, &dataCount));
+	ViInt64 appended = 0;
+	ViInt64 first = 0;
 
-	if (dataCount <= userBufferLength)
-	{
-		// Copy the whole data
-		memcpy(userBuffer, data, dataCount * sizeof(ViReal64));
-	}
-	else
+	if (archive != NULL && archive->header != NULL)
 	{
-		// Copy the userBufferLength data
-		memcpy(userBuffer, data, userBufferLength * sizeof(ViReal64));
-		error = dataCount;
+		appended = archive->header->appended;
+		first = appended - archive->capacity;
+		if (first < archive->header->retired)
+			first = archive->header->retired;
 	}
 
-	if (actualPointsCount)
-		*actualPointsCount = dataCount;
-
-Error:
-	if (data)
-		free(data);
+	if (firstSequence)
+		*firstSequence = first;
 
-	return error;
+	if (rowsCount)
+		*rowsCount = appended - first;
 }
 
-/******************************************************************************************************/
-/*  RsCore_QueryIntegerArrayToUserBuffer
-	The function uses RsCore_QueryIntegerArray to send the query to the instrument,
-	read the array response and copies it to the provided user buffer.
-	The function parses correctly ASCII or BINARY response (it uses RsCore_QueryIntegerArray)
-	If the userBufferLength is smaller than read-out dataCount, the function only copies
-	the maximum provided count of the data and returns positive error number that equals the dataCount.
-	actualPointsCount is allowed to be NULL
-/******************************************************************************************************/
-ViStatus RsCore_QueryIntegerArrayToUserBuffer(ViSession instrSession,
-	ViConstString query,
-	ViInt32 userBufferLength,
-	ViInt32 *userBuffer,
-	ViInt32* actualPointsCount)
+/*****************************************************************************************************/
+/*  RsCore_TraceArchiveFind
+    Binary search of the timestamp index. Returns the sequence number of the oldest retained row
+    with the timestamp at or after the entered one. If all the rows are older, returns the sequence number
+    of the next appended row
+******************************************************************************************************/
+ViInt64 RsCore_TraceArchiveFind(RsCoreTraceArchivePtr archive, ViReal64 timestamp)
 {
-	ViStatus error = VI_SUCCESS;
-	ViInt32* data = NULL;
-	ViInt32 dataCount = 0;
-
-	checkErr(RsCore_QueryIntegerArray(instrSession, query, &data, &dataCount));
+	ViInt64 low, high, middle, retained;
 
-	if (dataCount <= userBufferLength)
-	{
-		// Copy the whole data
-		memcpy(userBuffer, data, dataCount * sizeof(ViInt32));
-	}
-	else
+	RsCore_TraceArchiveRange(archive, &low, &retained);
+	high = low + retained;
+	while (low < high)
 	{
-		// Copy the userBufferLength data
-		memcpy(userBuffer, data, userBufferLength * sizeof(ViInt32));
-		error = dataCount;
+		middle = low + (high - low) / 2;
+		if (archive->index[middle % archive->capacity].timestamp < timestamp)
+			low = middle + 1;
+		else
+			high = middle;
 	}
 
-	if (actualPointsCount)
-		*actualPointsCount = dataCount;
+	return low;
+}
 
-Error:
-	if (data)
-		free(data);
+/*****************************************************************************************************/
+/*  RsCore_TraceArchiveRow
+    Returns the row values directly in the mapped file, or NULL if the row is not retained.
+    The slot of the oldest row is reused when the next row is appended to a full archive. A reader that
+    can overlap with appending checks with RsCore_TraceArchiveRange after reading that the row is still retained.
+    The timestamp, sweepNumber and points can be NULL if not needed
+******************************************************************************************************/
+const ViReal32* RsCore_TraceArchiveRow(RsCoreTraceArchivePtr archive, ViInt64 sequence, ViReal64* timestamp,
+                                       ViInt32* sweepNumber, ViInt32* points)
+{
+	ViInt64 firstSequence, rowsCount;
+	RsCoreTraceArchiveIndexEntry* entry;
 
-	return error;
+	RsCore_TraceArchiveRange(archive, &firstSequence, &rowsCount);
+	if (sequence < firstSequence || sequence >= firstSequence + rowsCount)
+		return NULL;
+
+	entry = &archive->index[sequence % archive->capacity];
+	if (timestamp)
+		*timestamp = entry->timestamp;
+
+	if (sweepNumber)
+		*sweepNumber = entry->sweepNumber;
+
+	if (points)
+		*points = entry->points;
+
+	return RsCoreInt_TraceArchiveRowData(archive, sequence);
 }
 
-/******************************************************************************************************/
-/*  RsCore_QueryIntegerArrayToUserBufferWithOpc
-	Same as RsCore_QueryIntegerArrayToUserBuffer, but the query is sent with OPC-sync
-	Set the parameter timeoutMs to 0 in order to use the session's OPC timeout
-/******************************************************************************************************/
-ViStatus RsCore_QueryIntegerArrayToUserBufferWithOpc(ViSession instrSession,
-	ViConstString query,
-	ViInt32 timeoutMs,
-	ViInt32 userBufferLength,
-	ViReal64 *userBuffer,
-	ViInt32* actualPointsCount)
+/*****************************************************************************************************/
+/*  RsCore_TraceArchiveRead
+    Copies the row values to the ViReal64 data array. The points returns the number of the row values.
+    If it is bigger than the arraySize, the function copies arraySize values and returns the number of values
+    as a positive warning. The points, timestamp and sweepNumber can be NULL if not needed
+******************************************************************************************************/
+ViStatus RsCore_TraceArchiveRead(RsCoreTraceArchivePtr archive, ViInt64 sequence, ViInt32 arraySize, ViReal64 data[],
+                                 ViInt32* points, ViReal64* timestamp, ViInt32* sweepNumber)
 {
-	ViStatus error = VI_SUCCESS;
-	ViInt32* data = NULL;
-	ViInt32 dataCount = 0;
-
-	checkErr(RsCore_QueryIntegerArrayWithOpc(instrSession, query, timeoutMs, &data, &dataCount));
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	const ViReal32* row;
+	ViInt32 i, copyCount, rowPoints = 0;
 
-	if (dataCount <= userBufferLength)
+	if (archive == NULL || (data == NULL && arraySize > 0))
 	{
-		// Copy the whole data
-		memcpy(userBuffer, data, dataCount * sizeof(ViInt32));
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS, "Trace archive: the archive or the data is NULL");
+		return RS_ERROR_NULL_POINTER;
 	}
-	else
+
+	row = RsCore_TraceArchiveRow(archive, sequence, timestamp, sweepNumber, &rowPoints);
+	if (row == NULL)
 	{
-		// Copy the userBufferLength data
-		memcpy(userBuffer, data, userBufferLength * sizeof(ViInt32));
-		error = dataCount;
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "Trace archive: the row " _PERCLD " is not retained", sequence);
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_VALUE_NOT_AVAILABLE, VI_SUCCESS, errorElab);
+		return RS_ERROR_VALUE_NOT_AVAILABLE;
 	}
 
-	if (actualPointsCount)
-		*actualPointsCount = dataCount;
+	if (points)
+		*points = rowPoints;
 
-Error:
-	if (data)
-		free(data);
+	copyCount = rowPoints < arraySize ? rowPoints : arraySize;
+	for (i = 0; i < copyCount; i++)
+		data[i] = (ViReal64)row[i];
 
-	return error;
+	return rowPoints > arraySize ? rowPoints : VI_SUCCESS;
 }
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
----- Instrument Helper IO Functions ------------------------------------------------------------------*
+---- Trace decimation --------------------------------------------------------------------------------*
 ------------------------------------------------------------------------------------------------------*
 ******************************************************************************************************/
 
+// Trace values of the decimation, either the float 32-bit binary data block as read, or ViReal64 values.
+// If the copy is not NULL, each value is also stored there when converted for the first time
+typedef struct RsCoreDecimationSource
+{
+	const ViByte* float32;
+	ViBoolean swapped;
+	const ViReal64* float64;
+	ViReal64* copy;
+	ViInt32 copySize;
+} RsCoreDecimationSource;
+
 /*****************************************************************************************************/
-/*  RsCore_ResetRegistersEseSre
-    Correctly sets the ESE and SRE registers for the current session OPC wait mode
-    Also coerces the session's OPC mode if necessary
+/*  RsCoreInt_DecimationLoad
+    Returns the trace value with the entered index
 ******************************************************************************************************/
-ViStatus RsCore_ResetRegistersEseSre(ViSession instrSession)
+static ViReal64 RsCoreInt_DecimationLoad(const RsCoreDecimationSource* source, ViInt32 index)
 {
-	ViStatus error = VI_SUCCESS;
-	RsCoreSessionPtr rsSession = NULL;
-
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	ViUInt32 bits;
+	ViReal32 value;
 
-	if (rsSession->vxiCapable == VI_FALSE && rsSession->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST)
-	{
-		// fall back to the StbPolling in case of non-VXI session
-		rsSession->opcWaitMode = RS_VAL_OPCWAIT_STBPOLLINGSLOW;
-	}
+	if (source->float64 != NULL)
+		return source->float64[index];
 
-	// Set the SRE and ESE registers accordingly
-	if (rsSession->opcWaitMode == RS_VAL_OPCWAIT_SERVICEREQUEST)
-	{
-		checkErr(RsCore_Write(instrSession, "*ESE 1"));
-		checkErr(RsCore_Write(instrSession, "*SRE 32"));
-	}
-	else
-	{
-		checkErr(RsCore_Write(instrSession, "*ESE 1"));
-		checkErr(RsCore_Write(instrSession, "*SRE 0"));
-	}
+	memcpy(&bits, source->float32 + (size_t)index * sizeof(ViReal32), sizeof(bits));
+	if (source->swapped)
+		bits = (bits >> 24) | ((bits >> 8) & 0xFF00) | ((bits << 8) & 0xFF0000) | (bits << 24);
 
-Error:
-	return error;
+	memcpy(&value, &bits, sizeof(value));
+	return (ViReal64)value;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_ErrorQuery
-    Queries ONE error from the instrument error queue
-    You have to provide the errMessage with at least 256 bytes buffer
-    The variable 'errorFlag' is set to TRUE, if an error was read out.
-    In case of 'No error', errorFlag is FALSE
+/*  RsCoreInt_DecimationConvert
+    Returns the trace value with the entered index, and stores it to the full data copy
 ******************************************************************************************************/
-ViStatus RsCore_ErrorQuery(ViSession instrSession, ViInt32* errCode, ViChar* errMessage, ViBoolean* errorFlag)
+static ViReal64 RsCoreInt_DecimationConvert(const RsCoreDecimationSource* source, ViInt32 index)
 {
-	ViStatus error = VI_SUCCESS;
-	ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE];
-	ViInt32 code;
-	ViChar* p2message = NULL;
+	ViReal64 value = RsCoreInt_DecimationLoad(source, index);
 
-	*errorFlag = VI_TRUE;
-	if (RsCore_Simulating(instrSession))
-	{
-		RsCoreInt_StrcpyMaxLen(buffer, RS_MAX_MESSAGE_BUF_SIZE, "0,\"No error.\"");
-	}
-	else
-	{
-		checkErr(RsCore_QueryViString(instrSession, "SYST:ERR?", buffer));
-	}
+	if (index < source->copySize)
+		source->copy[index] = value;
 
-	//Find and split code from the message
-	p2message = strstr(buffer, ",\"");
-	if (p2message == NULL)
-	{
-		code = -1;
-		p2message = buffer;
-	}
-	else
-	{
-		code = atoi(buffer);
-		p2message[0] = 0;
-		p2message ++;
-	}
+	return value;
+}
 
-	RsCore_TrimString(p2message, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
-	RsCoreInt_StrcpyMaxLen(errMessage, 255, p2message);
+/*****************************************************************************************************/
+/*  RsCoreInt_DecimationOutput
+    Writes one output point of the decimation
+******************************************************************************************************/
+static void RsCoreInt_DecimationOutput(RsCoreDecimationPtr decimation, ViInt32 index, ViReal64 minValue, ViReal64 maxValue)
+{
+	if (decimation->indexes)
+		decimation->indexes[decimation->count] = index;
 
-	RsCoreInt_ToLowerCase(p2message);
-	if (code == 0 || (strstr(p2message, "no error") == p2message))
-	{
-		*errorFlag = VI_FALSE;
-	}
+	if (decimation->minValues)
+		decimation->minValues[decimation->count] = minValue;
 
-	if (errCode)
-		*errCode = code;
+	if (decimation->maxValues)
+		decimation->maxValues[decimation->count] = maxValue;
 
-Error:
-	return error;
+	decimation->count++;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_ErrorQueryAll
-    Queries ALL errors from the instrument error queue. Returned errCode is from the last error.
-    Returned errors variable contains LF-separated list of error starting with the last one
+/*  RsCoreInt_DecimateEnvelope
+    Minimum and maximum of the width buckets in one pass over the trace points (points > width)
 ******************************************************************************************************/
-ViStatus RsCore_ErrorQueryAll(ViSession instrSession, ViInt32* errCode, ViInt32 bufferSize, ViChar* errors)
+static void RsCoreInt_DecimateEnvelope(const RsCoreDecimationSource* source, ViInt32 points, RsCoreDecimationPtr decimation)
 {
-	ViStatus error = VI_SUCCESS;
-	ViBoolean errorFlag;
-	ViInt32 code;
-	ViChar oneEntry[256] = "";
+	ViInt32 bucket, first, end;
 	ViInt32 i = 0;
+	ViReal64 value, minValue, maxValue;
 
-	if (errCode)
-		*errCode = 0;
+	for (bucket = 0; bucket < decimation->width; bucket++)
+	{
+		end = (ViInt32)((ViInt64)(bucket + 1) * points / decimation->width);
+		first = i;
+		minValue = maxValue = RsCoreInt_DecimationConvert(source, i++);
+		for (; i < end; i++)
+		{
+			value = RsCoreInt_DecimationConvert(source, i);
+			if (value < minValue)
+				minValue = value;
+			else if (value > maxValue)
+				maxValue = value;
+		}
 
-	if (bufferSize > 0)
-		RsCoreInt_StrcpyMaxLen(errors, bufferSize, "");
+		RsCoreInt_DecimationOutput(decimation, first, minValue, maxValue);
+	}
+}
 
-	for (i = 0; i < 50; i++) // 50 is a safety limit
-	{
-		checkErr(RsCore_ErrorQuery(instrSession, &code, oneEntry, &errorFlag));
-		if (errorFlag == VI_FALSE)
+/*****************************************************************************************************/
+/*  RsCoreInt_DecimateLttb
+    Largest-triangle-three-buckets (points > width >= 3). The first and the last point are kept,
+    the inner points are split into width - 2 buckets. From each bucket, the point forming the largest
+    triangle with the previously selected point and the average of the next bucket is selected.
+    The points are converted in order while averaging the next bucket, the selection reads them again
+******************************************************************************************************/
+static void RsCoreInt_DecimateLttb(const RsCoreDecimationSource* source, ViInt32 points, RsCoreDecimationPtr decimation)
+{
+	ViInt32 buckets = decimation->width - 2;
+	ViInt32 bucket, start, end, nextEnd, i, selected;
+	ViReal64 value, sum, averageX, averageY, area, maxArea;
+	ViReal64 selectedValue = RsCoreInt_DecimationConvert(source, 0);
+	ViInt32 previous = 0;
+	ViReal64 previousValue = selectedValue;
+
+	RsCoreInt_DecimationOutput(decimation, 0, selectedValue, selectedValue);
+	end = 1;
+	for (bucket = 0; bucket < buckets; bucket++)
+	{
+		start = end;
+		end = 1 + (ViInt32)((ViInt64)(bucket + 1) * (points - 2) / buckets);
+		nextEnd = bucket + 1 < buckets ? 1 + (ViInt32)((ViInt64)(bucket + 2) * (points - 2) / buckets) : points;
+
+		// The points of the first bucket are not converted by the previous bucket
+		if (bucket == 0)
 		{
-			break;
+			for (i = start; i < end; i++)
+				(void)RsCoreInt_DecimationConvert(source, i);
 		}
 
-		// Error code from the last error
-		if (errCode && *errCode == 0)
-			*errCode = code;
+		sum = 0.0;
+		for (i = end; i < nextEnd; i++)
+			sum += RsCoreInt_DecimationConvert(source, i);
 
-		RsCore_AppendToCsvString(errors, "\n", bufferSize, oneEntry);
+		averageX = 0.5 * (ViReal64)(end + nextEnd - 1);
+		averageY = sum / (ViReal64)(nextEnd - end);
+
+		selected = start;
+		selectedValue = RsCoreInt_DecimationLoad(source, start);
+		maxArea = -1.0;
+		for (i = start; i < end; i++)
+		{
+			value = RsCoreInt_DecimationLoad(source, i);
+			area = fabs(((ViReal64)previous - averageX) * (value - previousValue) - ((ViReal64)previous - (ViReal64)i) * (averageY - previousValue));
+			if (area > maxArea)
+			{
+				maxArea = area;
+				selected = i;
+				selectedValue = value;
+			}
+		}
+
+		RsCoreInt_DecimationOutput(decimation, selected, selectedValue, selectedValue);
+		previous = selected;
+		previousValue = selectedValue;
 	}
 
-	RsCore_TrimString(errors, RS_VAL_TRIM_WHITESPACES);
+	value = RsCoreInt_DecimationLoad(source, points - 1);
+	RsCoreInt_DecimationOutput(decimation, points - 1, value, value);
+}
 
-Error:
-	return error;
+/*****************************************************************************************************/
+/*  RsCoreInt_Decimate
+    Checks the decimation settings and decimates the trace values of the source
+******************************************************************************************************/
+static ViStatus RsCoreInt_Decimate(const RsCoreDecimationSource* source, ViInt32 points, RsCoreDecimationPtr decimation)
+{
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 i;
+	ViReal64 value;
+
+	decimation->count = 0;
+	if ((decimation->mode != RS_VAL_DECIMATION_ENVELOPE && decimation->mode != RS_VAL_DECIMATION_LTTB) || decimation->width < 1 ||
+		(decimation->mode == RS_VAL_DECIMATION_LTTB && decimation->width < 3) || points < 0)
+	{
+		snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "Trace decimation: invalid mode " _PERCD ", width " _PERCD " or number of points " _PERCD,
+		         decimation->mode, decimation->width, points);
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_INVALID_PARAMETER, VI_SUCCESS, errorElab);
+		return RS_ERROR_INVALID_PARAMETER;
+	}
+
+	if (points <= decimation->width)
+	{
+		for (i = 0; i < points; i++)
+		{
+			value = RsCoreInt_DecimationConvert(source, i);
+			RsCoreInt_DecimationOutput(decimation, i, value, value);
+		}
+	}
+	else if (decimation->mode == RS_VAL_DECIMATION_ENVELOPE)
+		RsCoreInt_DecimateEnvelope(source, points, decimation);
+	else
+		RsCoreInt_DecimateLttb(source, points, decimation);
+
+	return VI_SUCCESS;
 }
 
 /*****************************************************************************************************/
-/*  RsCore_SelfTest
-    Performs standard self-test routine using OPC-synchronized query '*TST?'
-    - selfTestMessage is set to 'Self-Test Passed' if the selfTestResult was 0
-    - selfTestMessage is set to 'Self-Test Failed' if the selfTestResult was not equal 0
+/*  RsCore_TraceDecimate
+    Decimates a trace available on the host to the decimation width points
 ******************************************************************************************************/
-ViStatus RsCore_SelfTest(ViSession instrSession, ViInt16* selfTestResult, ViInt32 bufferSize, ViChar* selfTestMessage)
+ViStatus RsCore_TraceDecimate(const ViReal64 y[], ViInt32 points, RsCoreDecimationPtr decimation)
+{
+	RsCoreDecimationSource source;
+
+	memset(&source, 0, sizeof(source));
+	source.float64 = y;
+	return RsCoreInt_Decimate(&source, points, decimation);
+}
+
+/*****************************************************************************************************/
+/*  RsCore_QueryFloatArrayDecimated
+    Queries a trace like RsCore_QueryFloatArrayToUserBuffer and decimates it to the decimation width points.
+    A float 32-bit binary response (FORM REAL,32) is decimated directly from the read data block in one pass,
+    which also converts the full trace to the outDblArray. Set the outDblArray to NULL if only the decimated
+    trace is needed. Other formats are converted first and then decimated.
+    The outArraySize returns the number of points of the trace. If it is bigger than the arraySize and the outDblArray
+    is not NULL, the function copies arraySize points and returns the number of points as a positive warning
+******************************************************************************************************/
+ViStatus RsCore_QueryFloatArrayDecimated(ViSession instrSession, ViConstString query, RsCoreDecimationPtr decimation,
+                                         ViInt32 arraySize, ViReal64 outDblArray[], ViInt32* outArraySize)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar buffer[RS_MAX_SHORT_MESSAGE_BUF_SIZE];
+	ViByte* data = NULL;
+	ViReal64* values = NULL;
+	ViInt64 byteCount = 0;
+	ViInt32 points = 0;
+	ViBoolean isBinDataBlock = VI_FALSE;
+	RsCoreDecimationSource source;
 	RsCoreSessionPtr rsSession = NULL;
 
 	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
-	if (RsCore_Simulating(instrSession) == VI_TRUE)
+	memset(&source, 0, sizeof(source));
+	if (outDblArray != NULL)
 	{
-		*selfTestResult = 0;
+		source.copy = outDblArray;
+		source.copySize = arraySize;
 	}
-	else
+
+	if (RsCore_Simulating(instrSession))
 	{
-		checkErr(RsCore_QueryViStringWithOpc(instrSession, "*TST?", rsSession->selfTestTimeout, RS_MAX_SHORT_MESSAGE_BUF_SIZE, buffer));
-		sscanf(buffer, "%hd", selfTestResult);
+		*outArraySize = 0;
+		decimation->count = 0;
+		goto Error;
 	}
 
-	if (*selfTestResult == 0)
-		RsCoreInt_StrcpyMaxLen(selfTestMessage, bufferSize, "Self-Test Passed.");
+	checkErr(RsCore_Write(instrSession, query));
+
+	if (rsSession->binaryFloatNumbersFormat == RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES ||
+		rsSession->binaryFloatNumbersFormat == RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES_SWAPPED)
+	{
+		checkErr(RsCoreInt_ReadBinaryDataBlock(instrSession, VI_FALSE, &isBinDataBlock, &data, &byteCount));
+		if (isBinDataBlock)
+		{
+			source.float32 = data;
+			source.swapped = (ViBoolean)(rsSession->binaryFloatNumbersFormat == RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES_SWAPPED);
+			points = (ViInt32)(byteCount / sizeof(ViReal32));
+		}
+		else
+		{
+			RsCore_TrimString((ViChar*)data, RS_VAL_TRIM_WHITESPACES_AND_ALL_QUOTES);
+			checkErr(RsCore_Convert_String_To_ViReal64Array(instrSession, (ViChar*)data, &values, &points));
+			source.float64 = values;
+		}
+	}
 	else
-		RsCoreInt_StrcpyMaxLen(selfTestMessage, bufferSize, "Self-Test Failed.");
+	{
+		checkErr(RsCoreInt_ReadFloatArray(instrSession, &values, &points));
+		source.float64 = values;
+	}
+
+	checkErr(RsCoreInt_Decimate(&source, points, decimation));
+
+	*outArraySize = points;
+	if (outDblArray != NULL && points > arraySize)
+		error = points;
 
 Error:
-	(void)RsCore_UnlockSession(instrSession);
+	if (data)
+		RsCore_Free(instrSession, data);
+
+	if (values)
+		RsCore_Free(instrSession, values);
 
 	return error;
 }
 
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Job scheduling ----------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+
 /*****************************************************************************************************/
-/*  RsCore_CheckStatus
-    Default function to use in the instrument driver to call the session's default CheckStatusCallback
-    If the attribute RS_ATTR_CHECK_STATUS_CALLBACK value is NULL, the core's default RsCore_CheckStatusCallback is used
+/*  RsCoreInt_JobGroupReadyBefore
+    Returns VI_TRUE if a ready job before the job index has the same group, so that each group is rated once
 ******************************************************************************************************/
-ViStatus RsCore_CheckStatus(ViSession instrSession, ViStatus errorBefore)
+static ViBoolean RsCoreInt_JobGroupReadyBefore(const ViInt32 jobGroups[], const ViInt32 pending[], ViInt32 index)
+{
+	ViInt32 i;
+
+	for (i = 0; i < index; i++)
+		if (pending[i] == 0 && jobGroups[i] == jobGroups[index])
+			return VI_TRUE;
+
+	return VI_FALSE;
+}
+
+/*****************************************************************************************************/
+/*  RsCore_ScheduleGroupedJobs
+    Orders the jobs so that the jobs of one group run back to back, which keeps the group switches low,
+    e.g. the measurement channel or application changes of an instrument.
+    jobGroups[i] is the group of the job i, any value. The dependency i requires the job prerequisiteJobs[i]
+    to run before the job dependentJobs[i].
+    The order is greedy: the jobs of the current group run as long as any of them is ready, then the ready group
+    with the fewest jobs still waiting for prerequisites follows. Otherwise the order of the list is kept.
+    currentGroup is the group active before the first job, switching to it is not counted.
+    order receives the jobsCount job indexes in the execution order, switchesCount the number of group switches.
+    Returns RS_ERROR_INVALID_VALUE if a dependency is out of range or the dependencies form a cycle.
+******************************************************************************************************/
+ViStatus RsCore_ScheduleGroupedJobs(ViInt32 jobsCount, ViInt32 jobGroups[], ViInt32 dependenciesCount,
+                                    ViInt32 prerequisiteJobs[], ViInt32 dependentJobs[], ViInt32 currentGroup,
+                                    ViInt32 order[], ViInt32* switchesCount)
 {
 	ViStatus error = VI_SUCCESS;
-	RsCoreCheckStatusCallback p2checkStatusFunction;
-	void* value;
-	RsCoreSessionPtr rsSession = NULL;
+	ViChar errorElab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32* pending = NULL;
+	ViInt32* dependentsStart = NULL;
+	ViInt32* dependents = NULL;
+	const RsCoreAllocator* allocator = gAllocator;
+	ViInt32 group = currentGroup;
+	ViInt32 switches = 0;
+	ViInt32 scheduled;
+	ViInt32 job;
+	ViInt32 blocked;
+	ViInt32 blockedMin;
+	ViInt32 i, k;
+
+	if (switchesCount)
+		*switchesCount = 0;
+
+	if (jobsCount <= 0)
+		return VI_SUCCESS;
 
-	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
+	if (jobGroups == NULL || order == NULL || (dependenciesCount > 0 && (prerequisiteJobs == NULL || dependentJobs == NULL)))
+	{
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, RS_ERROR_NULL_POINTER, VI_SUCCESS,
+		                          "RsCore_ScheduleGroupedJobs: jobGroups, order and the dependency lists must not be NULL");
+		return RS_ERROR_NULL_POINTER;
+	}
 
-	checkErr(RsCoreInt_GetAttrP2Value(rsSession->attrCheckStatusCallbackPtr, &value, 0));
-	p2checkStatusFunction = (RsCoreCheckStatusCallback)((ViAddr *)value);
-	if (p2checkStatusFunction == NULL)
+	if (dependenciesCount < 0)
+		dependenciesCount = 0;
+
+	// pending: prerequisites not run yet, -1 after the job is scheduled
+	// dependents: jobs waiting for the job i are dependents[dependentsStart[i] .. dependentsStart[i + 1] - 1]
+	pending = (ViInt32*)RsCoreInt_Calloc(allocator, (size_t)jobsCount, sizeof(ViInt32));
+	dependentsStart = (ViInt32*)RsCoreInt_Calloc(allocator, (size_t)jobsCount + 1, sizeof(ViInt32));
+	dependents = (ViInt32*)RsCoreInt_Calloc(allocator, dependenciesCount > 0 ? (size_t)dependenciesCount : 1, sizeof(ViInt32));
+	if (pending == NULL || dependentsStart == NULL || dependents == NULL)
 	{
-		checkErr(RsCore_CheckStatusCallback(instrSession, errorBefore));
+		error = RS_ERROR_ALLOC;
+		(void)RsCore_SetErrorInfo(0, VI_TRUE, error, VI_SUCCESS, "RsCore_ScheduleGroupedJobs: Allocation of the job lists");
+		goto Error;
 	}
-	else
+
+	for (i = 0; i < dependenciesCount; i++)
 	{
-		checkErr(p2checkStatusFunction(instrSession, errorBefore));
+		if (prerequisiteJobs[i] < 0 || prerequisiteJobs[i] >= jobsCount || dependentJobs[i] < 0 || dependentJobs[i] >= jobsCount)
+		{
+			error = RS_ERROR_INVALID_VALUE;
+			snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "RsCore_ScheduleGroupedJobs: dependency " _PERCD " refers to a job out of the range 0 .. " _PERCD,
+			         i, jobsCount - 1);
+			(void)RsCore_SetErrorInfo(0, VI_TRUE, error, VI_SUCCESS, errorElab);
+			goto Error;
+		}
+
+		pending[dependentJobs[i]]++;
+		dependentsStart[prerequisiteJobs[i] + 1]++;
+	}
+
+	for (i = 0; i < jobsCount; i++)
+		dependentsStart[i + 1] += dependentsStart[i];
+
+	// order is the fill position of each job's dependents here, it is overwritten by the schedule below
+	for (i = 0; i < jobsCount; i++)
+		order[i] = dependentsStart[i];
+
+	for (i = 0; i < dependenciesCount; i++)
+		dependents[order[prerequisiteJobs[i]]++] = dependentJobs[i];
+
+	for (scheduled = 0; scheduled < jobsCount; scheduled++)
+	{
+		job = -1;
+		for (i = 0; i < jobsCount; i++)
+		{
+			if (pending[i] == 0 && jobGroups[i] == group)
+			{
+				job = i;
+				break;
+			}
+		}
+
+		if (job < 0)
+		{
+			// Next group: the one with the fewest blocked jobs left, those would need another switch to it later
+			blockedMin = jobsCount;
+			for (i = 0; i < jobsCount; i++)
+			{
+				if (pending[i] != 0 || RsCoreInt_JobGroupReadyBefore(jobGroups, pending, i))
+					continue;
+
+				blocked = 0;
+				for (k = 0; k < jobsCount; k++)
+					if (pending[k] > 0 && jobGroups[k] == jobGroups[i])
+						blocked++;
+
+				if (blocked < blockedMin || job < 0)
+				{
+					blockedMin = blocked;
+					job = i;
+				}
+			}
+
+			if (job < 0)
+			{
+				error = RS_ERROR_INVALID_VALUE;
+				snprintf(errorElab, RS_MAX_MESSAGE_BUF_SIZE, "RsCore_ScheduleGroupedJobs: the dependencies of " _PERCD " jobs form a cycle",
+				         jobsCount - scheduled);
+				(void)RsCore_SetErrorInfo(0, VI_TRUE, error, VI_SUCCESS, errorElab);
+				goto Error;
+			}
+
+			group = jobGroups[job];
+			switches++;
+		}
+
+		order[scheduled] = job;
+		pending[job] = -1;
+		for (i = dependentsStart[job]; i < dependentsStart[job + 1]; i++)
+			pending[dependents[i]]--;
 	}
 
+	if (switchesCount)
+		*switchesCount = switches;
+
 Error:
+	RsCoreInt_Free(allocator, pending);
+	RsCoreInt_Free(allocator, dependentsStart);
+	RsCoreInt_Free(allocator, dependents);
 	return error;
 }
 
@@ -8740,10 +15848,10 @@ ViStatus RsCore_ReadCallback(ViSession instrSession, ViConstString repCapName, R
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	if (responseUnknownLen)
-		free(responseUnknownLen);
+		RsCore_Free(instrSession, responseUnknownLen);
 
 	return error;
 }
@@ -8831,7 +15939,7 @@ ViStatus RsCore_WriteCallback(ViSession instrSession,
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	return error;
 }
@@ -8939,7 +16047,7 @@ ViStatus RsCore_CheckCallback(ViSession instrSession, ViConstString repCapName,
 		case RS_VAL_COERCED:
 			if (attrHasNotFlag(RS_VAL_COERCEABLE_ONLY_BY_INSTR))
 			{
-				checkAlloc(coercedValue = malloc(sizeof(ViReal64)));
+				checkAlloc(coercedValue = RsCore_Malloc(instrSession, sizeof(ViReal64)));
 				checkErr(RsCore_CoerceCallback(instrSession, repCapName, attr, value));
 			}
 			break;
@@ -8952,7 +16060,7 @@ ViStatus RsCore_CheckCallback(ViSession instrSession, ViConstString repCapName,
 
 Error:
 	if (coercedValue)
-		free(coercedValue);
+		RsCore_Free(instrSession, coercedValue);
 
 	return error;
 }
@@ -9239,7 +16347,7 @@ ViStatus RsCore_CheckStatusCallback(ViSession instrSession, ViStatus errorBefore
 
 Error:
 	if (unexpResponse)
-		free(unexpResponse);
+		RsCore_Free(instrSession, unexpResponse);
 
 	if (errorBefore >= VI_SUCCESS)
 		errorBefore = error;
@@ -9262,15 +16370,13 @@ Error:
 ViStatus RsCore_InvalidViInt32Range(ViSession instrSession, ViInt32 val, ViInt32 min, ViInt32 max)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar errElab[RS_MAX_MESSAGE_LEN];
 
 	if (RsCore_RangeChecking(instrSession) == VI_FALSE)
 		goto Error;
 
 	if (val < min || val > max)
 	{
-		snprintf(errElab, RS_MAX_MESSAGE_LEN, "InvalidViInt32Range: value " _PERCD " is out of allowed range " _PERCD ".." _PERCD, val, min, max);
-		viCheckErrElab(RS_ERROR_INVALID_PARAMETER, errElab);
+		viCheckErrCtx(RS_ERROR_INVALID_PARAMETER, "InvalidViInt32Range: value " _PERCD " is out of allowed range " _PERCD ".." _PERCD, val, min, max);
 	}
 
 Error:
@@ -9285,10 +16391,8 @@ Error:
 ViStatus RsCore_InvalidViInt32Value(ViSession instrSession, ViInt32 value)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar errElab[RS_MAX_MESSAGE_LEN];
 
-	snprintf(errElab, RS_MAX_MESSAGE_LEN, "InvalidViInt32Value: value " _PERCD " is invalid", value);
-	viCheckErrElab(RS_ERROR_INVALID_PARAMETER, errElab);
+	viCheckErrCtx(RS_ERROR_INVALID_PARAMETER, "InvalidViInt32Value: value " _PERCD " is invalid", value, 0, 0);
 
 Error:
 	return error;
@@ -9303,15 +16407,13 @@ Error:
 ViStatus RsCore_InvalidViUInt32Range(ViSession instrSession, ViUInt32 val, ViUInt32 min, ViUInt32 max)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar errElab[RS_MAX_MESSAGE_LEN];
 
 	if (RsCore_RangeChecking(instrSession) == VI_FALSE)
 		goto Error;
 
 	if (val < min || val > max)
 	{
-		snprintf(errElab, RS_MAX_MESSAGE_LEN, "InvalidViUInt32Range: value " _PERCU " is out of allowed range " _PERCU ".." _PERCU, val, min, max);
-		viCheckErrElab(RS_ERROR_INVALID_PARAMETER, errElab);
+		viCheckErrCtx(RS_ERROR_INVALID_PARAMETER, "InvalidViUInt32Range: value " _PERCU " is out of allowed range " _PERCU ".." _PERCU, val, min, max);
 	}
 
 Error:
@@ -9351,15 +16453,13 @@ Error:
 ViStatus RsCore_InvalidViBooleanRange(ViSession instrSession, ViBoolean val)
 {
 	ViStatus error = VI_SUCCESS;
-	ViChar errElab[RS_MAX_MESSAGE_LEN];
 
 	if (RsCore_RangeChecking(instrSession) == VI_FALSE)
 		goto Error;
 
 	if (val != VI_TRUE && val != VI_FALSE)
 	{
-		snprintf(errElab, RS_MAX_MESSAGE_LEN, "InvalidViBooleanRange: value " _PERCD " is out of allowed range VI_TRUE(1) / VI_FALSE(0)", (ViInt32)val);
-		viCheckErrElab(RS_ERROR_INVALID_PARAMETER, errElab);
+		viCheckErrCtx(RS_ERROR_INVALID_PARAMETER, "InvalidViBooleanRange: value " _PERCD " is out of allowed range VI_TRUE(1) / VI_FALSE(0)", val, 0, 0);
 	}
 
 Error:
@@ -9572,9 +16672,8 @@ ViStatus RsCore_Convert_String_To_ViReal64Array(ViSession instrSession, ViConstS
 	}
 
 	inputStringLen = (ViInt32)strlen(inputString);
-	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-	         "Rs_ConvertCsvStringToViReal64Array: Allocation of the inputString copy, length " _PERCU " bytes", inputStringLen);
-	viCheckAllocElab(inputStringCopy = (ViChar*)malloc(inputStringLen + 1), errElab);
+	viCheckAllocCtx(inputStringCopy = (ViChar*)RsCore_Malloc(instrSession, inputStringLen + 1),
+	                "Rs_ConvertCsvStringToViReal64Array: Allocation of the inputString copy, length " _PERCU " bytes", inputStringLen, 0);
 	memcpy(inputStringCopy, inputString, inputStringLen + 1);
 
 	RsCore_TrimString(inputStringCopy, RS_VAL_TRIM_WHITESPACES);
@@ -9584,7 +16683,7 @@ ViStatus RsCore_Convert_String_To_ViReal64Array(ViSession instrSession, ViConstS
 	{
 		// For empty string allocate one element with 0.0 value and return array size 0
 		*arraySize = 0;
-		viCheckAllocElab(*dblArray = (ViReal64*)malloc(sizeof(ViReal64)), errElab);
+		viCheckAllocElab(*dblArray = (ViReal64*)RsCore_Malloc(instrSession, sizeof(ViReal64)), errElab);
 		(*dblArray)[0] = 0.0;
 		goto Error;
 	}
@@ -9592,9 +16691,8 @@ ViStatus RsCore_Convert_String_To_ViReal64Array(ViSession instrSession, ViConstS
 	elementsCount = RsCore_GetElementsCount(inputStringCopy, ',');
 
 	*arraySize = elementsCount;
-	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-	         "Rs_ConvertCsvStringToViReal64Array: Allocation of the result ViReal64 array " _PERCD " elements", elementsCount);
-	viCheckAllocElab(*dblArray = (ViReal64*)malloc(elementsCount * sizeof(ViReal64)), errElab);
+	viCheckAllocCtx(*dblArray = (ViReal64*)RsCore_Malloc(instrSession, elementsCount * sizeof(ViReal64)),
+	                "Rs_ConvertCsvStringToViReal64Array: Allocation of the result ViReal64 array " _PERCD " elements", elementsCount, 0);
 
 	ptr = strtok(inputStringCopy, ",");
 	if (ptr == NULL)
@@ -9612,7 +16710,7 @@ ViStatus RsCore_Convert_String_To_ViReal64Array(ViSession instrSession, ViConstS
 
 Error:
 	if (inputStringCopy)
-		free(inputStringCopy);
+		RsCore_Free(instrSession, inputStringCopy);
 
 	return error;
 }
@@ -9634,7 +16732,6 @@ ViStatus RsCore_Convert_ViReal64array_To_String(ViSession instrSession, ViReal64
 	ViInt32 beforeStringLen = 0;
 	ViInt32 idx;
 	ViInt32 elementLen;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
 
 	if (!isNullOrEmpty(beforeString))
 	{
@@ -9645,10 +16742,8 @@ ViStatus RsCore_Convert_ViReal64array_To_String(ViSession instrSession, ViReal64
 	if (allocSize < RS_MAX_MESSAGE_BUF_SIZE)
 	    allocSize = RS_MAX_MESSAGE_BUF_SIZE;
 
-	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-	         "Rs_Convert_ViReal64array_To_String: Allocation of the resultString buffer for " _PERCU " ViReal64 elements, size " _PERCU " bytes",
-	         arraySize, allocSize);
-	viCheckAllocElab(buffer = (ViChar*)malloc(allocSize), errElab);
+	viCheckAllocCtx(buffer = (ViChar*)RsCore_Malloc(instrSession, allocSize),
+	                "Rs_Convert_ViReal64array_To_String: Allocation of the resultString buffer for " _PERCU " ViReal64 elements, size " _PERCU " bytes", arraySize, allocSize);
 
 	ptr = buffer;
 	if (!isNullOrEmpty(beforeString))
@@ -9697,9 +16792,8 @@ ViStatus RsCore_Convert_String_To_ViInt32Array(ViSession instrSession, ViConstSt
 	}
 
 	inputStringLen = (ViInt32)strlen(inputString);
-	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-	         "Rs_ConvertCsvStringToViInt32Array: Allocation of the inputString copy, length " _PERCU " bytes", inputStringLen);
-	viCheckAllocElab(inputStringCopy = (ViChar*)malloc(inputStringLen + 1), errElab);
+	viCheckAllocCtx(inputStringCopy = (ViChar*)RsCore_Malloc(instrSession, inputStringLen + 1),
+	                "Rs_ConvertCsvStringToViInt32Array: Allocation of the inputString copy, length " _PERCU " bytes", inputStringLen, 0);
 	memcpy(inputStringCopy, inputString, inputStringLen + 1);
 
 	RsCore_TrimString(inputStringCopy, RS_VAL_TRIM_WHITESPACES);
@@ -9709,7 +16803,7 @@ ViStatus RsCore_Convert_String_To_ViInt32Array(ViSession instrSession, ViConstSt
 	{
 		// For empty string allocate one element with 0 value and return array size 0
 		*arraySize = 0;
-		viCheckAllocElab(*intArray = (ViInt32*)malloc(sizeof(ViInt32)), errElab);
+		viCheckAllocElab(*intArray = (ViInt32*)RsCore_Malloc(instrSession, sizeof(ViInt32)), errElab);
 		(*intArray)[0] = 0;
 		goto Error;
 	}
@@ -9720,7 +16814,7 @@ ViStatus RsCore_Convert_String_To_ViInt32Array(ViSession instrSession, ViConstSt
 	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
 	         "RsCore_Convert_String_To_ViInt32Array: Allocation of the result RsCore_Convert_String_To_ViInt32Array array " _PERCD " elements",
 	         elementsCount);
-	viCheckAllocElab(*intArray = (ViInt32*)malloc(elementsCount * sizeof(ViInt32)), errElab);
+	viCheckAllocElab(*intArray = (ViInt32*)RsCore_Malloc(instrSession, elementsCount * sizeof(ViInt32)), errElab);
 
 	ptr = strtok(inputStringCopy, ",");
 	if (ptr == NULL)
@@ -9739,7 +16833,7 @@ ViStatus RsCore_Convert_String_To_ViInt32Array(ViSession instrSession, ViConstSt
 
 Error:
 	if (inputStringCopy)
-		free(inputStringCopy);
+		RsCore_Free(instrSession, inputStringCopy);
 
 	return error;
 }
@@ -9761,7 +16855,6 @@ ViStatus RsCore_Convert_ViInt32array_To_String(ViSession instrSession, ViInt32*
 	ViInt32 beforeStringLen = 0;
 	ViInt32 idx;
 	ViInt32 elementLen;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
 
 	if (!isNullOrEmpty(beforeString))
 	{
@@ -9772,10 +16865,8 @@ ViStatus RsCore_Convert_ViInt32array_To_String(ViSession instrSession, ViInt32*
     if (allocSize < RS_MAX_MESSAGE_BUF_SIZE)
         allocSize = RS_MAX_MESSAGE_BUF_SIZE;
 
-	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-	         "RsCore_Convert_ViInt32array_To_String: Allocation of the resultString buffer for " _PERCU " ViInt32 elements, size " _PERCU " bytes",
-	         arraySize, allocSize);
-	viCheckAllocElab(buffer = (ViChar*)malloc(allocSize), errElab);
+	viCheckAllocCtx(buffer = (ViChar*)RsCore_Malloc(instrSession, allocSize),
+	                "RsCore_Convert_ViInt32array_To_String: Allocation of the resultString buffer for " _PERCU " ViInt32 elements, size " _PERCU " bytes", arraySize, allocSize);
 
 	ptr = buffer;
 	if (!isNullOrEmpty(beforeString))
@@ -9823,9 +16914,8 @@ ViStatus RsCore_Convert_String_To_ViBooleanArray(ViSession instrSession, ViConst
 	}
 
 	inputStringLen = (ViInt32)strlen(inputString);
-	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-	         "RsCore_Convert_String_To_ViBooleanArray: Allocation of the inputString copy, length " _PERCU " bytes", inputStringLen);
-	viCheckAllocElab(inputStringCopy = (ViChar*)malloc(inputStringLen + 1), errElab);
+	viCheckAllocCtx(inputStringCopy = (ViChar*)RsCore_Malloc(instrSession, inputStringLen + 1),
+	                "RsCore_Convert_String_To_ViBooleanArray: Allocation of the inputString copy, length " _PERCU " bytes", inputStringLen, 0);
 	memcpy(inputStringCopy, inputString, inputStringLen + 1);
 
 	RsCore_TrimString(inputStringCopy, RS_VAL_TRIM_WHITESPACES);
@@ -9835,7 +16925,7 @@ ViStatus RsCore_Convert_String_To_ViBooleanArray(ViSession instrSession, ViConst
 	{
 		// For empty string allocate one element with VI_FALSE value and return array size 0
 		*arraySize = 0;
-		viCheckAllocElab(*booleanArray = (ViBoolean*)malloc(sizeof(ViBoolean)), errElab);
+		viCheckAllocElab(*booleanArray = (ViBoolean*)RsCore_Malloc(instrSession, sizeof(ViBoolean)), errElab);
 		(*booleanArray)[0] = VI_FALSE;
 		goto Error;
 	}
@@ -9843,9 +16933,8 @@ ViStatus RsCore_Convert_String_To_ViBooleanArray(ViSession instrSession, ViConst
 	elementsCount = RsCore_GetElementsCount(inputStringCopy, ',');
 
 	*arraySize = elementsCount;
-	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-	         "RsCore_Convert_String_To_ViBooleanArray: Allocation of the result ViBoolean array " _PERCD " elements", elementsCount);
-	viCheckAllocElab(*booleanArray = (ViBoolean*)malloc(elementsCount * sizeof(ViBoolean)), errElab);
+	viCheckAllocCtx(*booleanArray = (ViBoolean*)RsCore_Malloc(instrSession, elementsCount * sizeof(ViBoolean)),
+	                "RsCore_Convert_String_To_ViBooleanArray: Allocation of the result ViBoolean array " _PERCD " elements", elementsCount, 0);
 
 	ptr = strtok(inputStringCopy, ",");
 	if (ptr == NULL)
@@ -9864,7 +16953,7 @@ ViStatus RsCore_Convert_String_To_ViBooleanArray(ViSession instrSession, ViConst
 
 Error:
 	if (inputStringCopy)
-		free(inputStringCopy);
+		RsCore_Free(instrSession, inputStringCopy);
 
 	return error;
 }
@@ -9887,7 +16976,6 @@ ViStatus RsCore_Convert_ViBooleanArray_To_String(ViSession instrSession, ViBoole
 	ViInt32 beforeStringLen = 0;
 	ViInt32 idx;
 	ViInt32 elementLen;
-	ViChar errElab[RS_MAX_MESSAGE_BUF_SIZE];
 
 	if (!isNullOrEmpty(beforeString))
 	{
@@ -9898,10 +16986,8 @@ ViStatus RsCore_Convert_ViBooleanArray_To_String(ViSession instrSession, ViBoole
     if (allocSize < RS_MAX_MESSAGE_BUF_SIZE)
         allocSize = RS_MAX_MESSAGE_BUF_SIZE;
 
-	snprintf(errElab, RS_MAX_MESSAGE_BUF_SIZE,
-	         "RsCore_Convert_ViBooleanArray_To_String: Allocation of the resultString buffer for " _PERCU " ViBoolean elements, size " _PERCU " bytes",
-	         arraySize, allocSize);
-	viCheckAllocElab(buffer = (ViChar*)malloc(allocSize), errElab);
+	viCheckAllocCtx(buffer = (ViChar*)RsCore_Malloc(instrSession, allocSize),
+	                "RsCore_Convert_ViBooleanArray_To_String: Allocation of the resultString buffer for " _PERCU " ViBoolean elements, size " _PERCU " bytes", arraySize, allocSize);
 
 	ptr = buffer;
 	if (!isNullOrEmpty(beforeString))
@@ -9946,7 +17032,7 @@ ViStatus RsCore_Convert_BinaryDataBlock_To_Float32Array(ViSession instrSession,
 	ViReal32* aux = NULL;
 
 	count = (ViInt32)(inputBinDataSize / 4);
-	viCheckAllocElab(*outputArray = (ViReal64*)malloc(count * sizeof(ViReal64)),
+	viCheckAllocElab(*outputArray = (ViReal64*)RsCore_Malloc(instrSession, count * sizeof(ViReal64)),
 		"Allocation of ViReal64 buffer for conversion BinDataBlock -> Float[]");
 
 	if (swapEndianness == VI_TRUE)
@@ -9982,7 +17068,7 @@ ViStatus RsCore_Convert_Float32Array_To_BinaryDataBlock(ViSession instrSession,
 	ViReal32 value;
 
 	*outputDataSize = inputArraySize * sizeof(ViReal32);
-	viCheckAllocElab(*outputBinData = (ViByte*)malloc(*outputDataSize), "Allocation of ViByte buffer for conversion Float[] -> BinDataBlock");
+	viCheckAllocElab(*outputBinData = (ViByte*)RsCore_Malloc(instrSession, *outputDataSize), "Allocation of ViByte buffer for conversion Float[] -> BinDataBlock");
 	ptr = *outputBinData;
 
 	for (idx = 0; idx < inputArraySize; idx++)
@@ -10469,13 +17555,13 @@ ViStatus RsCore_StrCatDynamicString(ViSession instrSession, ViChar** target, ViC
 
 	if (*target == NULL)
 	{
-		viCheckAllocElab(*target = (ViChar *)malloc(len1 + len2 + len3 + 1), "RsCore_StrCatDynamicString: Allocation of a new buffer buffer");
+		viCheckAllocElab(*target = (ViChar *)RsCore_Malloc(instrSession, len1 + len2 + len3 + 1), "RsCore_StrCatDynamicString: Allocation of a new buffer buffer");
 		ptr = *target;
 	}
 	else
 	{
 		targetLen = strlen(*target);
-		viCheckReallocElab(*target, (ViChar *)realloc(*target, targetLen + len1 + len2 + len3 + 1), "RsCore_StrCatDynamicString: Reallocation of the buffer");
+		viCheckReallocElab(*target, (ViChar *)RsCore_Realloc(instrSession, *target, targetLen + len1 + len2 + len3 + 1), "RsCore_StrCatDynamicString: Reallocation of the buffer");
 		ptr = *target + targetLen;
 	}
 
@@ -10592,9 +17678,11 @@ ViChar* RsCore_AppendToCsvString(ViChar* target, ViChar* delimiter, ViInt32 targ
 ******************************************************************************************************/
 void RsCore_Delay(ViReal64 numberOfSeconds)
 {
-	clock_t StartTime = clock();
+	ViReal64 endTimeMs = RsCoreInt_GetTickCountMs() + numberOfSeconds * 1000.0;
+	ViReal64 remainingMs;
 
-	while ((((double)(clock() - StartTime)) / (double)CLOCKS_PER_SEC) < (numberOfSeconds)) Sleep(0);
+	while ((remainingMs = endTimeMs - RsCoreInt_GetTickCountMs()) > 0.0)
+		RsCoreInt_DelayMicroseconds((ViUInt64)(remainingMs * 1000.0) + 1);
 
 	return;
 }
@@ -10801,7 +17889,7 @@ ViStatus RsCore_SpecialCallback_SurroundParamWrite(ViSession instrSession,
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	return error;
 }
@@ -10901,10 +17989,10 @@ ViStatus RsCore_SpecialCallback_AnyQuotedParamRead(ViSession instrSession, ViCon
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	if (responseUnknownLen)
-		free(responseUnknownLen);
+		RsCore_Free(instrSession, responseUnknownLen);
 
 	return error;
 }
@@ -10941,7 +18029,7 @@ ViStatus RsCore_SpecialCallback_HexPatternWrite(ViSession instrSession, ViConstS
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	return error;
 }
@@ -10977,7 +18065,7 @@ ViStatus RsCore_SpecialCallback_HexPatternRead(ViSession instrSession, ViConstSt
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	return error;
 }
@@ -11059,7 +18147,7 @@ ViStatus RsCore_SpecialCallback_BinPatternRead(ViSession instrSession, ViConstSt
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	return error;
 }
@@ -11128,7 +18216,7 @@ ViStatus RsCore_SpecialCallback_BinPatternWrite(ViSession instrSession, ViConstS
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	return error;
 }
@@ -11175,7 +18263,7 @@ ViStatus RsCore_SpecialCallback_HexNumberRead(ViSession instrSession, ViConstStr
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	return error;
 }
@@ -11215,7 +18303,7 @@ ViStatus RsCore_SpecialCallback_HexNumberWrite(ViSession instrSession, ViConstSt
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	return error;
 }
\ No newline at end of file
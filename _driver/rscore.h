@@ -7,6 +7,7 @@
 #define __RSCORE_HEADER
 
 #include <visatype.h>
+#include <stddef.h>
 
 #if defined(__cplusplus) || defined(__cplusplus__)
 extern "C" {
@@ -462,16 +463,34 @@ extern "C" {
 #endif
 
 // viCheckReallocElab(pointer, fReallocCall, elab)
-// If pointer is NULL, free the old pointer, assign RS_ERROR_ALLOC to the error variable,
+// If pointer is NULL, free the old pointer with RsCore_Free, assign RS_ERROR_ALLOC to the error variable,
 // call Rs_SetErrorInfo with RS_ERROR_ALLOC as the primary error code,
 // plus elabString and jump to the Error label.
 #ifndef viCheckReallocElab
 #define viCheckReallocElab(ptr, fReallocCall, elab)  { void *oldptr = ptr; \
 											  	if (((ptr) = (fReallocCall)) == 0) \
-												{free(oldptr); error = RS_ERROR_ALLOC;\
+												{RsCore_Free(instrSession, oldptr); error = RS_ERROR_ALLOC;\
 												RsCore_SetErrorInfo(instrSession, VI_TRUE, error, 0, elab); goto Error;}}
 #endif
 
+// viCheckErrCtx(status, format, arg1, arg2, arg3)
+// Same as viCheckErrElab, but the elaboration is the static format with up to three ViInt32 arguments
+// (_PERCD / _PERCU conversions). The elaboration string is formatted only when the error info is read.
+#ifndef viCheckErrCtx
+#define viCheckErrCtx(fCall, format, arg1, arg2, arg3) error = (fCall); \
+								 if (error < 0) { (void)RsCore_SetErrorContext(instrSession, VI_TRUE, error, 0, 0, format, \
+								 (ViInt32)(arg1), (ViInt32)(arg2), (ViInt32)(arg3)); goto Error;}
+#endif
+
+// viCheckAllocCtx(pointer, format, arg1, arg2)
+// Same as viCheckAllocElab, but the elaboration is the static format with up to two ViInt32 arguments
+// formatted only when the error info is read.
+#ifndef viCheckAllocCtx
+#define viCheckAllocCtx(fCall, format, arg1, arg2)  {if ((fCall) == 0) \
+											{error = RS_ERROR_ALLOC; (void)RsCore_SetErrorContext(instrSession, VI_TRUE, error, 0, 0, format, \
+											(ViInt32)(arg1), (ViInt32)(arg2), 0); goto Error;}}
+#endif
+
 // viCheckParm(status, parameterPosition, parameterName) -*/
 // Assign status to the error variable. If status is positive,
 // coerce the error variable to zero. If status is negative, do the following:
@@ -660,6 +679,9 @@ typedef ViStatus (*RsCoreCheckStatusCallback)(ViSession instrSession, ViStatus e
 // Function pointer typedef for the PREFIX_error_message function
 typedef ViStatus (_VI_FUNC *RsCoreErrorMessage)(ViSession, ViStatus, ViChar*);
 
+// Opens one resource for RsCore_OpenSessionsParallel, usually an adapter to the PREFIX_InitWithOptions
+typedef ViStatus (*RsCoreOpenSessionCallback)(ViRsrc resourceName, void* context, ViSession* instrSession);
+
 /******************************************************************************************************
 ---- Repeated Capability data structure --------------------------------------------------------------*
 ******************************************************************************************************/
@@ -700,10 +722,18 @@ typedef struct RsCoreAttribute
 	RsCoreAttrFlags flags;
 	ViString supportedModels;
 	ViString instrumentOptions;
-	void* p2value;
+	void* p2value; // Current value. NULL until the first access of the attribute allocates it with the default value
 	ViBoolean usercaps; /* Use repeated capability? */
 } RsCoreAttribute;
 
+// Attribute value stored by RsCore_ApplyAttributeSettings. Arrays of settings end with the attributeId 0
+typedef struct RsCoreAttributeSetting
+{
+	ViAttr attributeId;
+	ViInt32 integerValue; // Value of the RS_VAL_INT32, RS_VAL_INT64 and RS_VAL_BOOLEAN attributes
+	ViConstString stringValue; // Value of the RS_VAL_STRING attributes
+} RsCoreAttributeSetting;
+
 /******************************************************************************************************
 ---- Used Attributes cache table ---------------------------------------------------------------------*
 ******************************************************************************************************/
@@ -715,6 +745,228 @@ typedef struct RsCoreUsedAttributesCache
 	ViInt32 allocatedSize;
 } RsCoreUsedAttributesCache, *RsCoreUsedAttributesCachePtr;
 
+/******************************************************************************************************
+---- IO Transport interface --------------------------------------------------------------------------*
+******************************************************************************************************/
+
+// Same as ViAttrState from visa.h, which the driver headers do not include
+#if defined(_VI_INT64_UINT64_DEFINED) && defined(_VISA_ENV_IS_64_BIT)
+typedef ViUInt64 RsCoreIoAttrState;
+#else
+typedef ViUInt32 RsCoreIoAttrState;
+#endif
+
+// One part of a scatter/gather write
+typedef struct RsCoreIoSegment
+{
+	ViConstBuf data;
+	ViUInt32 count;
+} RsCoreIoSegment;
+
+// IO backend of a session. Sessions without a transport use VISA directly.
+// The functions follow the semantics and return codes of the corresponding VISA functions.
+typedef struct RsCoreTransport
+{
+	ViConstString name; // Name used in the option string token 'Transport'
+	ViStatus (*open)(ViRsrc resourceName, ViConstString optionsString, void** context);
+	void (*close)(void* context);
+	ViStatus (*write)(void* context, const RsCoreIoSegment segments[], ViUInt32 segmentsCount, ViPUInt32 retCount);
+	ViStatus (*read)(void* context, ViPBuf buffer, ViUInt32 count, ViPUInt32 retCount);
+	ViStatus (*readStb)(void* context, ViPUInt16 stb);
+	ViStatus (*clear)(void* context);
+	ViStatus (*setAttribute)(void* context, ViAttr attributeName, RsCoreIoAttrState attributeValue);
+	ViStatus (*getAttribute)(void* context, ViAttr attributeName, void* attributeValue);
+} RsCoreTransport, *RsCoreTransportPtr;
+
+/******************************************************************************************************
+---- Memory allocator interface ----------------------------------------------------------------------*
+******************************************************************************************************/
+#define RS_MAX_ALLOCATORS			8 // Maximum number of allocators registered with RsCore_RegisterAllocator
+
+// Memory allocator of the core buffers. Sessions without an allocator use the C runtime malloc / realloc / free.
+// The functions follow the semantics of the C runtime ones, the context is passed to each of them.
+typedef struct RsCoreAllocator
+{
+	ViConstString name; // Name used in the option string token 'Allocator'
+	void* (*allocate)(void* context, size_t size);
+	void* (*reallocate)(void* context, void* ptr, size_t size);
+	void (*deallocate)(void* context, void* ptr);
+	void* context;
+} RsCoreAllocator, *RsCoreAllocatorPtr;
+
+/******************************************************************************************************
+---- IO trace ring buffer ----------------------------------------------------------------------------*
+******************************************************************************************************/
+#define RS_IO_TRACE_ENTRIES			256 // Number of entries in the session IO trace, must be a power of 2
+#define RS_IO_TRACE_DATA_LEN		48 // Number of leading data bytes stored in one IO trace entry
+
+#define RS_VAL_IO_TRACE_WRITE		'W'
+#define RS_VAL_IO_TRACE_READ		'R'
+#define RS_VAL_IO_TRACE_READ_STB	'S'
+#define RS_VAL_IO_TRACE_CLEAR		'C'
+
+// One IO operation recorded in the session IO trace
+typedef struct RsCoreIoTraceEntry
+{
+	volatile ViUInt32 sequence; // Sequence number of the operation starting with 1. 0 while the entry is being written
+	ViInt32 operation; // RS_VAL_IO_TRACE_WRITE | RS_VAL_IO_TRACE_READ | RS_VAL_IO_TRACE_READ_STB | RS_VAL_IO_TRACE_CLEAR
+	ViStatus status; // Status returned by the IO
+	ViUInt32 requestedCount; // Bytes to write or the read buffer size
+	ViUInt32 transferredCount; // Bytes written or read. For RS_VAL_IO_TRACE_READ_STB the status byte
+	ViUInt32 dataLength; // Number of valid bytes in the data
+	ViUInt64 startNs; // Start of the operation, monotonic time in nanoseconds
+	ViUInt64 endNs; // End of the operation, monotonic time in nanoseconds
+	ViByte data[RS_IO_TRACE_DATA_LEN]; // Leading bytes of the written command or the read response
+} RsCoreIoTraceEntry, *RsCoreIoTraceEntryPtr;
+
+// Lock-free ring buffer of the last RS_IO_TRACE_ENTRIES IO operations of a session
+typedef struct RsCoreIoTrace
+{
+	volatile ViUInt32 head; // Number of the entries claimed so far. Entry n is stored at entries[n % RS_IO_TRACE_ENTRIES]
+	RsCoreIoTraceEntry entries[RS_IO_TRACE_ENTRIES];
+} RsCoreIoTrace;
+
+/******************************************************************************************************
+---- Round-trip diagnostics --------------------------------------------------------------------------*
+******************************************************************************************************/
+#define RS_VAL_REDUNDANT_IDENTICAL_WRITE	0 // The same command written twice in a row
+#define RS_VAL_REDUNDANT_FORMAT				1 // FORM command setting the format that is already set
+#define RS_VAL_REDUNDANT_STATUS_CHECK		2 // Instrument status check with no write since the previous check
+#define RS_VAL_REDUNDANT_OPC_TIMEOUT		3 // OPC timeout set to its value, or set back with no OPC-synchronized operation
+#define RS_REDUNDANT_PATTERNS				4
+
+#define RS_ROUND_TRIP_COMPARE_LEN			128 // Writes up to this length are compared for the identical writes
+#define RS_ROUND_TRIP_FORMATS				4 // Number of the tracked FORM command headers
+#define RS_ROUND_TRIP_EXAMPLE_LEN			48 // Length of the stored examples of the redundant patterns
+
+// Bus round trips and redundant patterns of a driver function
+typedef struct RsCoreRoundTripStats
+{
+	ViUInt64 calls; // Number of the diagnosed calls
+	ViUInt64 writes;
+	ViUInt64 reads;
+	ViUInt64 statusByteReads;
+	ViUInt64 clears;
+	ViUInt32 maxRoundTrips; // Most round trips (all the IO operations) of one call
+	ViUInt64 redundant[RS_REDUNDANT_PATTERNS]; // Occurrences of the redundant patterns RS_VAL_REDUNDANT_*
+	ViChar examples[RS_REDUNDANT_PATTERNS][RS_ROUND_TRIP_EXAMPLE_LEN]; // First occurrence of each pattern
+} RsCoreRoundTripStats;
+
+// Round-trip diagnostics state of a session
+typedef struct RsCoreRoundTripState
+{
+	ViBoolean enabled; // Diagnostics ON, option string token 'RoundTripDiagnostics'
+	RsCoreRoundTripStats call; // Counters of the driver function in progress
+	ViInt32 lastOperation; // RS_VAL_IO_TRACE_* of the last IO, 0 for none
+	ViUInt32 lastWriteLength; // Length of the last written data
+	ViByte lastWrite[RS_ROUND_TRIP_COMPARE_LEN]; // Leading bytes of the last written data
+	ViChar formats[RS_ROUND_TRIP_FORMATS][RS_MAX_SHORT_MESSAGE_BUF_SIZE]; // Last sent FORM program units, normalized
+	ViBoolean statusChecked; // The instrument status was checked and nothing was written since
+	ViBoolean opcTimeoutUnused; // The OPC timeout was changed and no OPC-synchronized operation followed
+	ViInt32 opcTimeoutPrevious; // OPC timeout before its last change
+} RsCoreRoundTripState;
+
+/******************************************************************************************************
+---- Driver function latency histograms --------------------------------------------------------------*
+******************************************************************************************************/
+#define RS_VAL_LATENCY_TOTAL		0 // Complete duration of the driver function
+#define RS_VAL_LATENCY_HOST_CPU		1 // Time spent in the driver code and libraries, without IO and OPC wait
+#define RS_VAL_LATENCY_IO_WAIT		2 // Time spent in the instrument IO - write, read, status byte read, clear
+#define RS_VAL_LATENCY_OPC_WAIT		3 // Time spent waiting for the operation complete, including the IO of the waiting
+#define RS_LATENCY_COMPONENTS		4
+
+#define RS_LATENCY_SUB_BUCKETS		16 // Histogram buckets per power of 2, relative resolution 1/16
+#define RS_LATENCY_BUCKETS			624 // Covers 0 ns ... 2^42 ns (73 minutes), longer values fall to the last bucket
+
+// Log-linear (HDR) histogram of durations in nanoseconds
+typedef struct RsCoreLatencyHistogram
+{
+	ViUInt64 count;
+	ViUInt64 sumNs;
+	ViUInt64 minNs;
+	ViUInt64 maxNs;
+	ViUInt32 buckets[RS_LATENCY_BUCKETS];
+} RsCoreLatencyHistogram;
+
+// Latency histograms and round-trip statistics of one driver function
+typedef struct RsCoreFunctionLatency
+{
+	ViConstString functionName; // Static name of the function, the __func__ of the driver function
+	RsCoreLatencyHistogram histograms[RS_LATENCY_COMPONENTS];
+	RsCoreRoundTripStats roundTrips; // Collected only with the round-trip diagnostics ON
+} RsCoreFunctionLatency, *RsCoreFunctionLatencyPtr;
+
+// Driver function in progress on a session
+typedef struct RsCoreLatencyCall
+{
+	ViConstString functionName; // Outermost function locking the session, NULL if not known
+	ViInt32 depth; // Nesting level of RsCore_LockSession calls
+	ViInt32 opcWaitDepth; // Nesting level of the OPC waiting
+	ViUInt64 startNs;
+	ViUInt64 opcWaitStartNs;
+	ViUInt64 ioNs; // Accumulated IO time outside of the OPC waiting
+	ViUInt64 opcWaitNs; // Accumulated OPC waiting time
+} RsCoreLatencyCall;
+
+// Summary of one latency histogram, returned by RsCore_GetFunctionLatency
+typedef struct RsCoreLatencyStats
+{
+	ViUInt64 count;
+	ViReal64 minUs;
+	ViReal64 meanUs;
+	ViReal64 p50Us;
+	ViReal64 p90Us;
+	ViReal64 p99Us;
+	ViReal64 p999Us;
+	ViReal64 maxUs;
+} RsCoreLatencyStats;
+
+/******************************************************************************************************
+---- Error context -----------------------------------------------------------------------------------*
+******************************************************************************************************/
+#define RS_ERROR_CONTEXT_ARGS		3 // Number of numeric arguments of the error context format
+
+// Error elaboration captured by RsCore_SetErrorContext without formatting.
+// It is formatted to the errorElaboration only when the error info is read.
+typedef struct RsCoreErrorContext
+{
+	ViBoolean pending; // VI_TRUE if the errorElaboration is not formatted yet
+	ViConstString format; // Static text with _PERCD / _PERCU conversions. NULL: the errorElaboration holds the text
+	ViAttr attributeId; // Attribute related to the error, its info is added at the beginning. 0 if none
+	ViInt32 args[RS_ERROR_CONTEXT_ARGS];
+} RsCoreErrorContext;
+
+/******************************************************************************************************
+---- Identity snapshot -------------------------------------------------------------------------------*
+******************************************************************************************************/
+// Last known *IDN? and *OPT? responses of the instrument.
+// If the *IDN? response at the init matches the snapshot, the *OPT? query is skipped and the snapshot options are used.
+// With the option string token 'IdentitySnapshot=<file>', the snapshots are persisted per resource name in the file.
+// The options are taken from the snapshot as long as the *IDN? response is unchanged: options installed without
+// a firmware update are not seen until the snapshot file (or the line of the resource in it) is deleted.
+typedef struct RsCoreIdentitySnapshot
+{
+	ViBoolean valid; // The idn and options hold the identity of the last initialized instrument
+	ViBoolean validated; // The *IDN? response of the current init matches the idn
+	ViChar fileName[RS_MAX_MESSAGE_LEN]; // File with the persisted snapshots, empty for no persistence
+	ViChar idn[RS_MAX_MESSAGE_BUF_SIZE]; // *IDN? response
+	ViChar options[RS_MAX_MESSAGE_BUF_SIZE]; // Raw *OPT? response
+} RsCoreIdentitySnapshot;
+
+/******************************************************************************************************
+---- Trace cache -------------------------------------------------------------------------------------*
+******************************************************************************************************/
+// Trace data of one trace query, valid as long as the instrument sweep number and the session settings generation stay the same
+typedef struct RsCoreTraceCacheEntry
+{
+	ViChar query[RS_MAX_MESSAGE_LEN]; // Trace data query, the key of the entry
+	ViInt32 sweepNumber; // Sweep number returned together with the trace data
+	ViUInt32 settingsGeneration; // Session settings generation at the time of the trace read
+	ViReal64* data;
+	ViInt32 points;
+	ViInt32 allocated; // Allocated size of the data in points
+} RsCoreTraceCacheEntry, *RsCoreTraceCacheEntryPtr;
+
 /******************************************************************************************************
 ---- Session Property structure ----------------------------------------------------------------------*
 ******************************************************************************************************/
@@ -722,6 +974,9 @@ typedef struct RsCoreSession
 {
 	ViSession io; // Instrument IO session (also stored in RS_ATTR_IO_SESSION value)
 	ViSession rmSession; // Resource Manager session
+	const RsCoreTransport* transport; // IO backend, NULL for VISA
+	void* transportContext; // IO backend instance data
+	const RsCoreAllocator* allocator; // Allocator of the session buffers, NULL for the C runtime
 	void* mutex; // Session locking mutual exclusion handle
 	ViBoolean multiThreadLocking; // If TRUE (default is FALSE), the session multi-thread locking mechanism is ON
 	ViChar resourceName[RS_MAX_SHORT_MESSAGE_BUF_SIZE]; // ResourceName
@@ -729,6 +984,12 @@ typedef struct RsCoreSession
 	ViInt32 sessionsListIndex; // Index in the global sessions list
 	ViBoolean allowViClear; // Allow performing viClear, default = True
 	ViBoolean reuseSession; // If FALSE (default), the init opens a new session. If TRUE, it reuses a session if it exists
+	ViBoolean sessionPool; // If TRUE (default is FALSE), the close parks the session in the warm session pool instead of closing it
+	ViBoolean parked; // The session waits in the warm session pool for the next init of the same resource
+	ViBoolean warmStart; // The session was taken from the warm session pool by the init in progress
+	RsCoreIdentitySnapshot identity; // Last known instrument identity
+	ViBoolean specificDefaultsApplied; // Attributes materialized later start with their default values, otherwise with zeros
+	ViBoolean inherentDefaultsApplied; // The same for the inherent attributes
 	RsCoreSessionType sessionType; // session type: TCPIP | GPIB | USB | SOCKET | SERIAL
 	ViBoolean vxiCapable; // False for SOCKET and ASRL
 	ViInt32 opcWaitMode; // Defines OPC wait mode - STB polling, service request, OPC Query
@@ -742,6 +1003,7 @@ typedef struct RsCoreSession
 	ViStatus primaryError; // Status code describing the primary error condition
 	ViStatus secondaryError; // Status code that further describes the error or warning condition
 	ViChar errorElaboration[RS_MAX_MESSAGE_BUF_SIZE]; // Elaboration string that further describes the error or warning condition.
+	RsCoreErrorContext errorContext; // Not yet formatted part of the errorElaboration
 	ViInt32 fastSweepInstrument;
 	ViInt32 selfTestTimeout;
 	ViInt32 readDelay; // Delay before each read. For segmented reads it applies only to the the very first read
@@ -763,8 +1025,167 @@ typedef struct RsCoreSession
 	RsCoreAttributePtr attrRangeCheckPtr; // Pointer to the attribute RS_ATTR_RANGE_CHECK
 	RsCoreAttributePtr attrCheckStatusCallbackPtr; // Pointer to the attribute RS_ATTR_CHECK_STATUS_CALLBACK
 	RsCoreAttributePtr attrSimulatePtr; // Pointer to the attribute RS_ATTR_SIMULATE
+	RsCoreIoTrace ioTrace; // Always-on trace of the last IO operations
+	RsCoreLatencyCall latencyCall; // Latency accounting of the driver function in progress
+	RsCoreFunctionLatencyPtr functionLatencies; // Latency histograms of the called driver functions
+	ViInt32 functionLatenciesCount; // Number of functions in the functionLatencies
+	ViInt32 functionLatenciesAllocated; // Allocated size of the functionLatencies
+	RsCoreRoundTripState roundTrip; // Round-trip diagnostics
+	ViUInt32 settingsGeneration; // Incremented by each write with a command that is not a query
+	ViBoolean traceCacheEnabled; // If TRUE (default is FALSE), trace reads of the same sweep are served from the traceCache
+	RsCoreTraceCacheEntryPtr traceCache; // Cached trace data, one entry per trace query
+	ViInt32 traceCacheCount; // Number of entries in the traceCache
+	ViInt32 traceCacheAllocated; // Allocated size of the traceCache
 } RsCoreSession, *RsCoreSessionPtr;
 
+/******************************************************************************************************
+---- Asynchronous OPC operation handle ---------------------------------------------------------------*
+******************************************************************************************************/
+#define RS_VAL_OPC_HANDLE_WAIT_ANY		0 // Wait until one of the pending handles completes
+#define RS_VAL_OPC_HANDLE_WAIT_ALL		1 // Wait until all the handles complete
+
+// Caller-allocated state of one operation started by RsCore_WriteWithOpcAsync
+typedef struct RsCoreOpcHandle
+{
+	ViSession instrSession; // Session the operation runs on
+	ViInt32 opcWaitMode; // OPC wait mode used for the operation. RS_VAL_OPCWAIT_OPCQUERY is replaced by STB polling
+	ViInt32 opcTimeoutMs; // OPC timeout of the operation
+	ViReal64 startTimeMs; // Time the operation was started
+	ViBoolean pending; // TRUE until the operation completes, fails or times out
+	ViStatus status; // Completion status, valid when pending is FALSE
+} RsCoreOpcHandle, *RsCoreOpcHandlePtr;
+
+/******************************************************************************************************
+---- Trace accumulator -------------------------------------------------------------------------------*
+******************************************************************************************************/
+// Statistics maintained by the trace accumulator, combine them with OR
+#define RS_VAL_TRACE_STAT_LOG_AVERAGE		0x01 // Average of the dB values
+#define RS_VAL_TRACE_STAT_LINEAR_AVERAGE	0x02 // Average of the linear voltages, returned in dB
+#define RS_VAL_TRACE_STAT_RMS				0x04 // RMS of the voltages (power average), returned in dB
+#define RS_VAL_TRACE_STAT_MAX_HOLD			0x08
+#define RS_VAL_TRACE_STAT_MIN_HOLD			0x10
+#define RS_VAL_TRACE_STAT_ALL				0x1F
+
+// Caller-owned running statistics over any number of traces with the same number of points.
+// The traces are in logarithmic units (dBm, dBuV ...). All arrays are allocated by RsCore_TraceAccumulatorInit,
+// the arrays of the statistics not maintained are NULL
+typedef struct RsCoreTraceAccumulator
+{
+	ViInt32 points; // Number of points of each trace
+	ViInt32 statistics; // RS_VAL_TRACE_STAT_* mask of the maintained statistics
+	ViInt32 count; // Number of the traces added since the init or reset
+	ViReal64* logSum; // Sum of the dB values
+	ViReal64* linearSum; // Sum of the voltages 10^(dB/20)
+	ViReal64* powerSum; // Sum of the powers 10^(dB/10)
+	ViReal64* maxHold;
+	ViReal64* minHold;
+	ViReal64* trace; // Buffer for reading a trace from the instrument before adding it
+	void* memory; // One block with all the arrays
+	const RsCoreAllocator* allocator; // Allocator of the memory
+} RsCoreTraceAccumulator, *RsCoreTraceAccumulatorPtr;
+
+// Order of the peaks returned by RsCore_TraceFindPeaks
+#define RS_VAL_PEAK_SORT_LEVEL				0 // Highest peak first
+#define RS_VAL_PEAK_SORT_X					1 // Ascending x (frequency / time), of the highest maxPeaks peaks
+
+// Limit line settings, the values are the same as of the instrument driver constants
+#define RS_VAL_LIMIT_LINE_LOWER				0
+#define RS_VAL_LIMIT_LINE_UPPER				1
+#define RS_VAL_LIMIT_SPACING_LIN			0 // Linear interpolation between the limit points
+#define RS_VAL_LIMIT_SPACING_LOG			1 // x: interpolation on the logarithmic axis (positive values only), y: dB levels interpolated as linear power
+#define RS_VAL_LIMIT_SCALING_ABS			0
+#define RS_VAL_LIMIT_SCALING_REL			1 // x relative to the x reference (center frequency), y relative to the y reference (reference level)
+
+// In-memory limit line definition for RsCore_TraceLimitCheck, the equivalent of the CALC:LIM settings.
+// The arrays are owned by the caller, the x values are ascending. Equal neighbour x values define a vertical step
+typedef struct RsCoreLimitLine
+{
+	ViInt32 type; // RS_VAL_LIMIT_LINE_LOWER or RS_VAL_LIMIT_LINE_UPPER
+	ViInt32 count; // Number of the limit points, at least 2
+	const ViReal64* x;
+	const ViReal64* y;
+	ViInt32 xScaling; // RS_VAL_LIMIT_SCALING_*
+	ViInt32 xSpacing; // RS_VAL_LIMIT_SPACING_*
+	ViInt32 yScaling; // RS_VAL_LIMIT_SCALING_*
+	ViInt32 ySpacing; // RS_VAL_LIMIT_SPACING_*
+	ViReal64 xOffset; // Added to all x values (CALC:LIM:CONT:OFFS)
+	ViReal64 yOffset; // Added to all y values (CALC:LIM:UPP:OFFS / CALC:LIM:LOW:OFFS)
+	ViReal64 margin; // Points closer to the limit than the margin are counted in marginPoints
+	ViReal64 threshold; // Relative y scaling only: the limit never goes below the threshold, like the instrument (default -200 dBm)
+} RsCoreLimitLine;
+
+// Result of RsCore_TraceLimitCheck for one limit line
+typedef struct RsCoreLimitResult
+{
+	ViBoolean passed; // VI_TRUE if no checked point violates the limit
+	ViInt32 checkedPoints; // Trace points within the x range of the limit line
+	ViInt32 failedPoints;
+	ViInt32 marginPoints; // Points passing the limit, but within the margin
+	ViReal64 worstMargin; // Smallest distance of the trace to the limit, negative for a violation
+	ViReal64 worstX; // x of the worst margin
+	ViInt32 worstIndex; // Trace point index of the worst margin, -1 if no point was checked
+} RsCoreLimitResult;
+
+/******************************************************************************************************
+---- Trace archive -----------------------------------------------------------------------------------*
+******************************************************************************************************/
+#define RS_VAL_TRACE_ARCHIVE_VERSION		1
+
+// First 64 bytes of the trace archive file. The file continues with the index of capacity entries
+// and the capacity rows of points float 32-bit values. The rows are a ring, the oldest rows are overwritten
+typedef struct RsCoreTraceArchiveHeader
+{
+	ViChar magic[8]; // "RSTRARC"
+	ViInt32 version; // RS_VAL_TRACE_ARCHIVE_VERSION
+	ViInt32 points; // Width of the rows
+	ViInt32 capacity; // Maximum number of the retained rows
+	ViInt32 reserved0;
+	ViInt64 appended; // Rows appended since the file creation, the sequence number of the next row
+	ViInt64 retired; // Rows before this sequence number are not retained, the oldest slot is retired before it is overwritten
+	ViByte reserved[24];
+} RsCoreTraceArchiveHeader;
+
+// Index entry of one archive row, the timestamps of the rows never decrease
+typedef struct RsCoreTraceArchiveIndexEntry
+{
+	ViReal64 timestamp; // Seconds since 1970-01-01 UTC
+	ViInt32 sweepNumber;
+	ViInt32 points; // Valid values of the row, at most the archive points
+} RsCoreTraceArchiveIndexEntry;
+
+// Caller-owned state of an opened trace archive, all pointers point into the mapped file
+typedef struct RsCoreTraceArchive
+{
+	RsCoreTraceArchiveHeader* header; // Start of the mapping, NULL if the archive is not opened
+	RsCoreTraceArchiveIndexEntry* index;
+	ViReal32* rows;
+	ViInt32 points;
+	ViInt32 capacity;
+	ViInt64 fileSize;
+	void* fileHandle; // Windows only
+	void* mappingHandle; // Windows only
+	ViInt32 fileDescriptor; // POSIX only
+} RsCoreTraceArchive, *RsCoreTraceArchivePtr;
+
+/******************************************************************************************************
+---- Trace decimation --------------------------------------------------------------------------------*
+******************************************************************************************************/
+#define RS_VAL_DECIMATION_ENVELOPE			0 // Minimum and maximum of each bucket of the trace points
+#define RS_VAL_DECIMATION_LTTB				1 // Largest-triangle-three-buckets, the most significant point of each bucket
+
+// Caller-owned decimation of a trace to the width points, e.g. for a display.
+// The output arrays have at least width elements, set the arrays not needed to NULL.
+// The trace point positions are the indexes, map them to x with RsCore_TraceLinearXAxis
+typedef struct RsCoreDecimation
+{
+	ViInt32 mode; // RS_VAL_DECIMATION_*
+	ViInt32 width; // Maximum number of the output points, LTTB needs at least 3
+	ViInt32* indexes; // Envelope: first trace point of the bucket. LTTB: the selected trace point
+	ViReal64* minValues; // Envelope: minimum of the bucket. LTTB: value of the selected point
+	ViReal64* maxValues; // Envelope: maximum of the bucket. LTTB: value of the selected point
+	ViInt32 count; // Returns the number of the output points. A trace of at most width points is returned unchanged
+} RsCoreDecimation, *RsCoreDecimationPtr;
+
 
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
@@ -811,8 +1232,17 @@ ViStatus RsCore_ClearStatus(ViSession instrSession);
 
 ViStatus RsCore_LockSession(ViSession instrSession);
 
+ViStatus RsCore_LockSessionForFunction(ViSession instrSession, ViConstString functionName);
+
 ViStatus RsCore_UnlockSession(ViSession instrSession);
 
+// Driver functions lock the session with their own name, which the core uses for the function latency histograms
+#if defined(_MSC_VER)
+#define RsCore_LockSession(instrSession) RsCore_LockSessionForFunction((instrSession), __FUNCTION__)
+#else
+#define RsCore_LockSession(instrSession) RsCore_LockSessionForFunction((instrSession), __func__)
+#endif
+
 ViBoolean RsCore_Simulating(ViSession instrSession);
 
 ViBoolean RsCore_RangeChecking(ViSession instrSession);
@@ -836,6 +1266,16 @@ ViStatus RsCore_SetErrorInfo(ViSession instrSession,
                              ViStatus secondaryError,
                              ViConstString errorElab);
 
+ViStatus RsCore_SetErrorContext(ViSession instrSession,
+                                ViBoolean overWrite,
+                                ViStatus primaryError,
+                                ViStatus secondaryError,
+                                ViAttr attributeId,
+                                ViConstString format,
+                                ViInt32 arg1,
+                                ViInt32 arg2,
+                                ViInt32 arg3);
+
 ViStatus RsCore_GetErrorInfo(ViSession instrSession,
                              ViStatus* primaryError,
                              ViStatus* secondaryError,
@@ -1040,6 +1480,9 @@ ViStatus RsCore_SetAttributeP2Value(ViSession instrSession,
 ViStatus RsCore_ApplyAttributeDefaults(ViSession instrSession,
                                        ViBoolean updateInherentAttr);
 
+ViStatus RsCore_ApplyAttributeSettings(ViSession instrSession,
+                                       const RsCoreAttributeSetting settings[]);
+
 ViStatus RsCore_BuildAttrCommandString(ViSession instrSession,
                                        RsCoreAttributePtr attr,
                                        ViConstString repCapsInputString,
@@ -1186,6 +1629,8 @@ ViStatus RsCore_QueryStringIndex(ViSession instrSession, ViConstString query, Vi
 
 ViStatus RsCore_QueryAsciiViReal64Array(ViSession instrSession, ViConstString query, ViReal64** dblArray, ViInt32* arraySize);
 
+ViStatus RsCore_QueryViReal64Multiple(ViSession instrSession, ViConstString query, ViInt32 valuesCount, ViReal64 values[]);
+
 ViStatus RsCore_QueryAsciiViInt32Array(ViSession instrSession, ViConstString query, ViInt32** intArray, ViInt32* arraySize);
 
 ViStatus RsCore_QueryAsciiViBooleanArray(ViSession instrSession, ViConstString query, ViBoolean** boolArray, ViInt32* arraySize);
@@ -1273,6 +1718,30 @@ ViStatus RsCore_QueryIntegerArrayToUserBufferWithOpc(ViSession instrSession,
 											ViReal64 *userBuffer,
 											ViInt32* actualPointsCount);
 
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Asynchronous OPC-synchronized IO ----------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_WriteWithOpcAsync(ViSession instrSession,
+                                  ViConstString command,
+                                  ViInt32 timeoutMs,
+                                  RsCoreOpcHandlePtr handle);
+
+ViStatus RsCore_SetAttributeEventAsync(ViSession instrSession,
+                                       ViConstString repCapName,
+                                       ViAttr attributeId,
+                                       ViInt32 timeoutMs,
+                                       RsCoreOpcHandlePtr handle);
+
+ViStatus RsCore_PollOpcHandle(RsCoreOpcHandlePtr handle, ViBoolean* completed);
+
+ViStatus RsCore_WaitForOpcHandles(RsCoreOpcHandle handles[],
+                                  ViInt32 handlesCount,
+                                  ViInt32 waitMode,
+                                  ViInt32 timeoutMs,
+                                  ViInt32* completedIndex);
+
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
 ---- Instrument Helper IO Functions ------------------------------------------------------------------*
@@ -1294,6 +1763,181 @@ ViStatus RsCore_SelfTest(ViSession instrSession, ViInt16* selfTestResult, ViInt3
 
 ViStatus RsCore_CheckStatus(ViSession instrSession, ViStatus errorBefore);
 
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- IO trace ----------------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_GetIoTrace(ViSession instrSession,
+                           ViInt32 maxEntries,
+                           RsCoreIoTraceEntry entries[],
+                           ViInt32* entriesCount);
+
+ViStatus RsCore_DumpIoTrace(ViSession instrSession, ViConstString fileName);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Driver function latency -------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_GetFunctionLatency(ViSession instrSession,
+                                   ViConstString functionName,
+                                   ViInt32 component,
+                                   RsCoreLatencyStats* stats);
+
+ViStatus RsCore_GetFunctionLatencyNames(ViSession instrSession, ViInt32 bufferSize, ViChar* functionNames);
+
+ViStatus RsCore_DumpFunctionLatency(ViSession instrSession, ViConstString fileName);
+
+ViStatus RsCore_ResetFunctionLatency(ViSession instrSession);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Round-trip diagnostics --------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_SetRoundTripDiagnostics(ViSession instrSession, ViBoolean enabled);
+
+ViStatus RsCore_GetRoundTripStats(ViSession instrSession, ViConstString functionName, RsCoreRoundTripStats* stats);
+
+ViStatus RsCore_DumpRoundTripReport(ViSession instrSession, ViConstString fileName);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Memory allocation -------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_SetAllocator(const RsCoreAllocator* allocator);
+
+ViStatus RsCore_RegisterAllocator(const RsCoreAllocator* allocator);
+
+void* RsCore_Malloc(ViSession instrSession, size_t size);
+
+void* RsCore_Calloc(ViSession instrSession, size_t count, size_t size);
+
+void* RsCore_Realloc(ViSession instrSession, void* ptr, size_t size);
+
+void RsCore_Free(ViSession instrSession, void* ptr);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Warm session pool -------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViBoolean RsCore_ReleaseToSessionPool(ViSession instrSession);
+
+ViStatus RsCore_CheckWarmSession(ViSession instrSession, ViBoolean* warmSession);
+
+ViStatus RsCore_ClearSessionPool(void);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Parallel session open ---------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_OpenSessionsParallel(ViInt32 count, ViRsrc resourceNames[], RsCoreOpenSessionCallback openSession, void* context,
+                                     ViSession instrSessions[], ViStatus statuses[]);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Trace accumulator -------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_TraceAccumulatorInit(RsCoreTraceAccumulatorPtr accumulator, ViInt32 points, ViInt32 statistics);
+
+void RsCore_TraceAccumulatorReset(RsCoreTraceAccumulatorPtr accumulator);
+
+ViStatus RsCore_TraceAccumulatorAdd(RsCoreTraceAccumulatorPtr accumulator, const ViReal64 trace[], ViInt32 tracePoints);
+
+ViStatus RsCore_TraceAccumulatorGet(RsCoreTraceAccumulatorPtr accumulator, ViInt32 statistic, ViInt32 arraySize, ViReal64 result[]);
+
+void RsCore_TraceAccumulatorDispose(RsCoreTraceAccumulatorPtr accumulator);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Trace analysis ----------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+void RsCore_TraceLinearXAxis(ViReal64 start, ViReal64 stop, ViInt32 points, ViReal64 x[]);
+
+ViStatus RsCore_TraceFindPeaks(const ViReal64 x[], const ViReal64 y[], ViInt32 points, ViReal64 threshold, ViReal64 excursion,
+                               ViInt32 sortOrder, ViInt32 maxPeaks, ViInt32* peaksFound,
+                               ViInt32 peakIndexes[], ViReal64 peakX[], ViReal64 peakY[]);
+
+ViStatus RsCore_TraceNdBBandwidth(const ViReal64 x[], const ViReal64 y[], ViInt32 points, ViInt32 peakIndex, ViReal64 ndB,
+                                  ViReal64* lowerX, ViReal64* upperX, ViReal64* bandwidth);
+
+ViStatus RsCore_TraceMarkersAt(const ViReal64 x[], const ViReal64 y[], ViInt32 points,
+                               ViInt32 markersCount, const ViReal64 markerX[], ViReal64 markerY[]);
+
+ViStatus RsCore_TraceLimitCheck(const ViReal64 x[], const ViReal64 y[], ViInt32 points, ViReal64 xReference, ViReal64 yReference,
+                                ViInt32 linesCount, const RsCoreLimitLine lines[], RsCoreLimitResult results[],
+                                ViInt32* worstLine, ViReal64* worstMargin, ViReal64* worstX);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Trace cache -------------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_SetTraceCacheEnabled(ViSession instrSession, ViBoolean enabled);
+
+ViBoolean RsCore_TraceCacheEnabled(ViSession instrSession);
+
+ViStatus RsCore_InvalidateTraceCache(ViSession instrSession);
+
+ViStatus RsCore_QueryFloatArraySweepCached(ViSession instrSession, ViConstString sweepQuery, ViConstString dataQuery,
+                                           ViInt32 arraySize, ViReal64 outDblArray[], ViInt32* outArraySize, ViBoolean* fromCache);
+ViStatus RsCore_QueryViReal64MultipleSettingsCached(ViSession instrSession, ViConstString query, ViInt32 valuesCount,
+                                                    ViReal64 values[], ViBoolean* fromCache);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Multi-column results ----------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_QueryFloatArrayColumns(ViSession instrSession, ViConstString query, ViInt32 columnsCount,
+                                       ViReal64* columns[], ViInt32 columnSize, ViInt32* rowsCount);
+
+ViStatus RsCore_QueryIntegerArrayColumns(ViSession instrSession, ViConstString query, ViInt32 columnsCount,
+                                         ViInt32* columns[], ViInt32 columnSize, ViInt32* rowsCount);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Trace archive -----------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_TraceArchiveOpen(ViConstString fileName, ViInt32 points, ViInt32 capacity, RsCoreTraceArchivePtr archive);
+void RsCore_TraceArchiveClose(RsCoreTraceArchivePtr archive);
+ViReal64 RsCore_TraceArchiveTimeNow(void);
+ViStatus RsCore_TraceArchiveAppend(RsCoreTraceArchivePtr archive, ViReal64 timestamp, ViInt32 sweepNumber,
+                                   ViInt32 points, const ViReal64 data[]);
+ViStatus RsCore_QueryTraceToArchive(ViSession instrSession, ViConstString sweepQuery, ViConstString dataQuery,
+                                    RsCoreTraceArchivePtr archive, ViReal64 timestamp);
+void RsCore_TraceArchiveRange(RsCoreTraceArchivePtr archive, ViInt64* firstSequence, ViInt64* rowsCount);
+ViInt64 RsCore_TraceArchiveFind(RsCoreTraceArchivePtr archive, ViReal64 timestamp);
+const ViReal32* RsCore_TraceArchiveRow(RsCoreTraceArchivePtr archive, ViInt64 sequence, ViReal64* timestamp,
+                                       ViInt32* sweepNumber, ViInt32* points);
+ViStatus RsCore_TraceArchiveRead(RsCoreTraceArchivePtr archive, ViInt64 sequence, ViInt32 arraySize, ViReal64 data[],
+                                 ViInt32* points, ViReal64* timestamp, ViInt32* sweepNumber);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Trace decimation --------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_TraceDecimate(const ViReal64 y[], ViInt32 points, RsCoreDecimationPtr decimation);
+ViStatus RsCore_QueryFloatArrayDecimated(ViSession instrSession, ViConstString query, RsCoreDecimationPtr decimation,
+                                         ViInt32 arraySize, ViReal64 outDblArray[], ViInt32* outArraySize);
+
+/******************************************************************************************************
+------------------------------------------------------------------------------------------------------*
+---- Job scheduling ----------------------------------------------------------------------------------*
+------------------------------------------------------------------------------------------------------*
+******************************************************************************************************/
+ViStatus RsCore_ScheduleGroupedJobs(ViInt32 jobsCount, ViInt32 jobGroups[], ViInt32 dependenciesCount,
+                                    ViInt32 prerequisiteJobs[], ViInt32 dependentJobs[], ViInt32 currentGroup,
+                                    ViInt32 order[], ViInt32* switchesCount);
+
 /******************************************************************************************************
 ------------------------------------------------------------------------------------------------------*
 ---- Default Core Callback Routines ------------------------------------------------------------------*
@@ -135,6 +135,7 @@ ViStatus _VI_FUNC rsspecan_InitWithOptions(
 	ViStatus error = VI_SUCCESS;
 	ViSession instrSession = 0;
 	RsCoreSessionPtr rsSession = NULL;
+	ViBoolean warmSession = VI_FALSE;
 
 	if (newInstrSession == NULL)
 	{
@@ -163,9 +164,16 @@ ViStatus _VI_FUNC rsspecan_InitWithOptions(
 
 	checkErr(RsCore_GetRsSession(instrSession, &rsSession));
 
+	// Session from the warm session pool (option 'SessionPool=1') of the same instrument:
+	// the *IDN? check is its only round trip, it keeps the repCaps, attributes and instrument setup
+	checkErr(RsCore_CheckWarmSession(instrSession, &warmSession));
+
 	// No SCPI command has been sent yet.
 	// Call viClear before sending any SCPI command
-	checkErr(RsCore_ViClear(instrSession));
+	if (warmSession == VI_FALSE)
+	{
+		checkErr(RsCore_ViClear(instrSession));
+	}
 
 	/* --- Here perform settings that are default for this driver,
 	but can be overwritten by the optionsString settings */
@@ -174,14 +182,17 @@ ViStatus _VI_FUNC rsspecan_InitWithOptions(
 
 	// Parse option string and optionally sets the initial state of the following session attributes
 	checkErr(RsCore_ApplyOptionString(instrSession, optionString));
-	checkErr(RsCore_BuildRepCapTable(instrSession, rsspecan_RsCoreRepCapTable));
+	if (warmSession == VI_FALSE)
+	{
+		checkErr(RsCore_BuildRepCapTable(instrSession, rsspecan_RsCoreRepCapTable));
+	}
 
 	// Default Instrument Setup + optional *RST
 	if (resetDevice == VI_TRUE)
 	{
 		checkErr(rsspecan_reset(instrSession));
 	}
-	else
+	else if (warmSession == VI_FALSE)
 	{
 		checkErr(rsspecan_DefaultInstrSetup(instrSession));
 	}
@@ -191,7 +202,10 @@ ViStatus _VI_FUNC rsspecan_InitWithOptions(
 		checkErr(RsCore_FitsIDNpattern(instrSession, RSSPECAN_ATTR_ID_QUERY_RESPONSE, RSSPECAN_VALID_ID_RESPONSE_STRING, NULL));
 	}
 
-	checkErr(rsspecan_CheckStatus(instrSession));
+	if (warmSession == VI_FALSE)
+	{
+		checkErr(rsspecan_CheckStatus(instrSession));
+	}
 
 Error:
 	if (error < VI_SUCCESS)
@@ -1554,7 +1568,9 @@ ViStatus _VI_FUNC rsspecan_QueryAllMeasurementChannels(ViSession instrSession,
 
 		cnt++;
 	}
-	*--p2buf = '\0';
+	if (p2buf != channelName)
+		p2buf--; // Remove remaining comma
+	*p2buf = '\0';
 
 	if (returnedValues != NULL)
 		*returnedValues = cnt;
@@ -1562,7 +1578,186 @@ ViStatus _VI_FUNC rsspecan_QueryAllMeasurementChannels(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
+	(void)RsCore_UnlockSession(instrSession);
+	return error;
+}
+
+// Max. number of channels read by rsspecan_RunMeasurementJobs
+#define RSSPECAN_MAX_MEASUREMENT_CHANNELS 32
+
+// INST? returns the type of the active channel. The active channel is the expected channel if its type matches,
+// otherwise the only channel of that type, or -1 if several channels have that type.
+static ViStatus rsspecan_QueryActiveMeasurementChannel(ViSession instrSession,
+                                                       ViInt32 channelsCount,
+                                                       ViInt32 channelType[],
+                                                       ViInt32 expectedChannel,
+                                                       ViInt32* activeChannel)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar instr_mode[RS_MAX_MESSAGE_BUF_SIZE] = "";
+	ViInt32 i;
+
+	*activeChannel = -1;
+	checkErr(rsspecan_GetAttributeViString(instrSession, "", RSSPECAN_ATTR_GET_INSTR_MODE, RS_MAX_MESSAGE_BUF_SIZE, instr_mode));
+	if (instr_mode[0] == '\0')
+		return error;
+
+	if (expectedChannel >= 0 && expectedChannel < channelsCount && channelType[expectedChannel] >= 0 &&
+		strncmp(ChannelTypeArr[channelType[expectedChannel]], instr_mode, strlen(instr_mode)) == 0)
+	{
+		*activeChannel = expectedChannel;
+		return error;
+	}
+
+	for (i = 0; i < channelsCount; i++)
+	{
+		if (channelType[i] < 0 || strncmp(ChannelTypeArr[channelType[i]], instr_mode, strlen(instr_mode)) != 0)
+			continue;
+
+		if (*activeChannel >= 0)
+		{
+			*activeChannel = -1;
+			break;
+		}
+		*activeChannel = i;
+	}
+
+Error:
+	return error;
+}
+
+/// HIFN This function runs a list of measurement jobs, each one in its measurement
+/// HIFN channel. The jobs are reordered within the dependencies so that the jobs of
+/// HIFN one channel run back to back, and a channel is only selected if it is not
+/// HIFN the active one already. The channels must exist, see
+/// HIFN rsspecan_QueryAllMeasurementChannels. The active channel is recognized when
+/// HIFN it is the only channel of its type.
+/// HIFN The active channel is read again after each job, so a job callback may select
+/// HIFN another channel. A switch to another channel of the same type as the job's
+/// HIFN channel is not recognized, the callback has to select the job's channel again
+/// HIFN before it returns in that case.
+/// HIRET Returns the status code of this operation, or the first error of a job.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.  The handle identifies a particular
+/// HIPAR instrSession/instrument session.
+/// HIPAR jobsCount/Number of the jobs.
+/// HIPAR jobChannels/Name of the measurement channel of each job.
+/// HIPAR dependenciesCount/Number of the dependencies, 0 if the jobs may run in any order.
+/// HIPAR prerequisiteJobs/Index of the job that must run before the job in Dependent Jobs.
+/// HIPAR dependentJobs/Index of the job that must run after the job in Prerequisite Jobs.
+/// HIPAR jobCallback/Function called with the instrument session, the job index and the
+/// HIPAR jobCallback/context for each job after its channel is selected.
+/// HIPAR context/User data passed to the Job Callback.
+/// HIPAR executionOrder/Returns the job indexes in the execution order. May be VI_NULL.
+/// HIPAR channelSwitches/Returns the number of the channel selections. May be VI_NULL.
+ViStatus _VI_FUNC rsspecan_RunMeasurementJobs(ViSession instrSession,
+                                              ViInt32 jobsCount,
+                                              ViString jobChannels[],
+                                              ViInt32 dependenciesCount,
+                                              ViInt32 prerequisiteJobs[],
+                                              ViInt32 dependentJobs[],
+                                              rsspecan_MeasurementJobCallback jobCallback,
+                                              void* context,
+                                              ViInt32 executionOrder[],
+                                              ViInt32* channelSwitches)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar error_elab[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 channel_type[RSSPECAN_MAX_MEASUREMENT_CHANNELS];
+	ViChar* channel_names[RSSPECAN_MAX_MEASUREMENT_CHANNELS];
+	ViChar* names_buffer = NULL;
+	ViInt32* groups = NULL;
+	ViInt32* order = NULL;
+	ViChar* pname;
+	ViInt32 channels_count = 0;
+	ViInt32 active_channel = -1;
+	ViInt32 switches = 0;
+	ViInt32 i, j, job;
+
+	checkErr(RsCore_LockSession(instrSession));
+
+	if (channelSwitches)
+		*channelSwitches = 0;
+
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, jobsCount, 1, INT_MAX),
+			2, "Jobs Count");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, jobChannels), 3, "Job Channels");
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, dependenciesCount, 0, INT_MAX),
+			4, "Dependencies Count");
+	if (dependenciesCount > 0)
+	{
+		viCheckParm(RsCore_InvalidNullPointer(instrSession, prerequisiteJobs), 5, "Prerequisite Jobs");
+		viCheckParm(RsCore_InvalidNullPointer(instrSession, dependentJobs), 6, "Dependent Jobs");
+	}
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, jobCallback), 7, "Job Callback");
+
+	// Existing channels, the jobs refer to them by their index
+	viCheckAlloc(names_buffer = (ViChar*)RsCore_Malloc(instrSession, RSSPECAN_MAX_MEASUREMENT_CHANNELS * RS_MAX_MESSAGE_BUF_SIZE));
+	checkErr(rsspecan_QueryAllMeasurementChannels(instrSession, RSSPECAN_MAX_MEASUREMENT_CHANNELS, channel_type, names_buffer, &channels_count));
+
+	pname = strtok(names_buffer, ",");
+	for (i = 0; i < channels_count && pname != NULL; i++)
+	{
+		channel_names[i] = pname;
+		pname = strtok(NULL, ",");
+	}
+	channels_count = i;
+
+	checkErr(rsspecan_QueryActiveMeasurementChannel(instrSession, channels_count, channel_type, -1, &active_channel));
+
+	viCheckAlloc(groups = (ViInt32*)RsCore_Malloc(instrSession, (size_t)jobsCount * sizeof(ViInt32)));
+	viCheckAlloc(order = (ViInt32*)RsCore_Malloc(instrSession, (size_t)jobsCount * sizeof(ViInt32)));
+
+	for (job = 0; job < jobsCount; job++)
+	{
+		groups[job] = -1;
+		for (j = 0; j < channels_count && jobChannels[job] != NULL; j++)
+		{
+			if (strcmp(channel_names[j], jobChannels[job]) == 0)
+			{
+				groups[job] = j;
+				break;
+			}
+		}
+
+		if (groups[job] < 0)
+		{
+			snprintf(error_elab, RS_MAX_MESSAGE_BUF_SIZE, "Job " _PERCD ": measurement channel '%s' does not exist",
+			         job, jobChannels[job] ? jobChannels[job] : "");
+			viCheckErrElab(RS_ERROR_INVALID_VALUE, error_elab);
+		}
+	}
+
+	checkErr(RsCore_ScheduleGroupedJobs(jobsCount, groups, dependenciesCount, prerequisiteJobs, dependentJobs,
+		active_channel, order, NULL));
+
+	for (i = 0; i < jobsCount; i++)
+	{
+		job = order[i];
+		if (executionOrder)
+			executionOrder[i] = job;
+
+		if (groups[job] != active_channel)
+		{
+			checkErr(rsspecan_SelectMeasurementChannel(instrSession, jobChannels[job]));
+			active_channel = groups[job];
+			switches++;
+			if (channelSwitches)
+				*channelSwitches = switches;
+		}
+
+		checkErr(jobCallback(instrSession, job, context));
+
+		// The callback may have selected another channel
+		if (i < jobsCount - 1)
+			checkErr(rsspecan_QueryActiveMeasurementChannel(instrSession, channels_count, channel_type, active_channel, &active_channel));
+	}
+
+Error:
+	if (order) RsCore_Free(instrSession, order);
+	if (groups) RsCore_Free(instrSession, groups);
+	if (names_buffer) RsCore_Free(instrSession, names_buffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -2259,7 +2454,7 @@ ViStatus _VI_FUNC rsspecan_ConfigureListPowerSequence(ViSession instrSession,
 	 * Alloc buffer. Size is calclulated as:
 	 * size of header + size required for one entry * number of entries
 	 */
-	viCheckAlloc(pwrite_buffer = (ViChar*) malloc((size_t)(20 + 240 * noofListItems)));
+	viCheckAlloc(pwrite_buffer = (ViChar*) RsCore_Malloc(instrSession, (size_t)(20 + 240 * noofListItems)));
 
 	pbuffer = pwrite_buffer;
 
@@ -2304,7 +2499,7 @@ ViStatus _VI_FUNC rsspecan_ConfigureListPowerSequence(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pwrite_buffer) free(pwrite_buffer);
+	if (pwrite_buffer) RsCore_Free(instrSession, pwrite_buffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -2353,7 +2548,7 @@ ViStatus _VI_FUNC rsspecan_QueryListPowerSequence(ViSession instrSession,
 	viCheckParm(RsCore_InvalidNullPointer(instrSession, triggerLevel), 12, "Trigger Level");
 	viCheckParm(RsCore_InvalidNullPointer(instrSession, listPowerResults), 13, "List Power Results");
 
-	viCheckAlloc(pwrite_buffer = (ViChar*)malloc((size_t)(20 + 240 * noofListItems)));
+	viCheckAlloc(pwrite_buffer = (ViChar*)RsCore_Malloc(instrSession, (size_t)(20 + 240 * noofListItems)));
 	pbuffer = pwrite_buffer;
 
 	pbuffer += sprintf(pbuffer, ":SENS%ld:LIST:POW:SEQ? ", window);
@@ -2379,7 +2574,7 @@ ViStatus _VI_FUNC rsspecan_QueryListPowerSequence(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pwrite_buffer) free(pwrite_buffer);
+	if (pwrite_buffer) RsCore_Free(instrSession, pwrite_buffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -2455,6 +2650,252 @@ Error:
 	return error;
 }
 
+// List power sequence limits of the NORM filter type
+#define RSSPECAN_LIST_POWER_MAX_ITEMS 100
+#define RSSPECAN_LIST_POWER_MIN_RBW   10.0
+#define RSSPECAN_LIST_POWER_MAX_RBW   10.0e6
+#define RSSPECAN_LIST_POWER_MAX_VBW   10.0e6
+
+typedef struct rsspecan_ListPowerPlanEntry
+{
+	ViBoolean listItem;
+	ViReal64 attenuation;
+	ViReal64 frequency;
+	ViInt32 request;
+} rsspecan_ListPowerPlanEntry;
+
+// Sequence items first, then ascending attenuation and frequency
+static int rsspecan_CompareListPowerPlanEntries(const void* a, const void* b)
+{
+	const rsspecan_ListPowerPlanEntry* entryA = (const rsspecan_ListPowerPlanEntry*)a;
+	const rsspecan_ListPowerPlanEntry* entryB = (const rsspecan_ListPowerPlanEntry*)b;
+
+	if (entryA->listItem != entryB->listItem)
+		return entryA->listItem ? -1 : 1;
+
+	if (entryA->attenuation != entryB->attenuation)
+		return entryA->attenuation < entryB->attenuation ? -1 : 1;
+
+	if (entryA->frequency != entryB->frequency)
+		return entryA->frequency < entryB->frequency ? -1 : 1;
+
+	// Stable for equal settings
+	return entryA->request < entryB->request ? -1 : (entryA->request > entryB->request);
+}
+
+/*****************************************************************************
+ * Function:    Measure List Power Planned
+ * Purpose:     This function measures the power of many single frequency
+ *              requests. The requests with a resolution bandwidth of the list
+ *              filter range are grouped into list power sequences of max. 100
+ *              entries, ordered by RF attenuation and frequency to keep the
+ *              attenuator switching low. The remaining requests are measured
+ *              with individual zero span sweeps. The results are returned in
+ *              the order of the requests.
+ *              The list power measurement is switched off at the end. After
+ *              zero span sweeps, their settings stay active: single sweep,
+ *              zero span with the measTime sweep time, manual RF attenuation
+ *              and RBW, the center frequency, reference level and settings of
+ *              the last swept request, and the time domain power measurement.
+ *****************************************************************************/
+ViStatus _VI_FUNC rsspecan_MeasureListPowerPlanned(ViSession instrSession,
+                                                   ViInt32 window,
+                                                   ViInt32 requestsCount,
+                                                   ViReal64 frequency[],
+                                                   ViReal64 resolutionBandwidth[],
+                                                   ViReal64 referenceLevel[],
+                                                   ViReal64 RFInputAttenuation[],
+                                                   ViInt32 detector,
+                                                   ViReal64 measTime,
+                                                   ViUInt32 timeout,
+                                                   ViReal64 results[],
+                                                   ViInt32* sequencesCount,
+                                                   ViInt32* sweepsCount)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar repCap[RS_REPCAP_BUF_SIZE];
+	rsspecan_ListPowerPlanEntry* plan = NULL;
+	ViReal64* items = NULL;
+	ViReal64 *item_freq, *item_ref, *item_att, *item_eatt, *item_rbw, *item_vbw, *item_time, *item_trig, *item_results;
+	ViInt32 filter_type[RSSPECAN_LIST_POWER_MAX_ITEMS];
+	ViInt32 list_items = 0;
+	ViInt32 sequences = 0;
+	ViInt32 sweeps = 0;
+	ViInt32 items_count;
+	ViInt32 request;
+	ViInt32 i, j;
+	ViUInt32 old_timeout = 0;
+	ViBoolean restore_timeout = VI_FALSE;
+	ViBoolean list_power_on = VI_FALSE;
+	ViAttr tdom_attribute;
+
+	checkErr(RsCore_LockSession(instrSession));
+
+	if (sequencesCount)
+		*sequencesCount = 0;
+	if (sweepsCount)
+		*sweepsCount = 0;
+
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, requestsCount, 1, INT_MAX),
+			3, "Requests Count");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, frequency), 4, "Frequency");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, resolutionBandwidth), 5, "Resolution Bandwidth");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, referenceLevel), 6, "Reference Level");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, RFInputAttenuation), 7, "RF Input Attenuation");
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, detector, RSSPECAN_VAL_TDOM_PEAK, RSSPECAN_VAL_TDOM_MEAN),
+			8, "Detector");
+	viCheckParm(RsCore_InvalidViReal64Range(instrSession, measTime, 1.0e-6, 16000.0), 9, "Meas Time");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, results), 11, "Results");
+
+	viCheckAlloc(plan = (rsspecan_ListPowerPlanEntry*)RsCore_Malloc(instrSession,
+		(size_t)requestsCount * sizeof(rsspecan_ListPowerPlanEntry)));
+
+	for (i = 0; i < requestsCount; i++)
+	{
+		plan[i].listItem = (ViBoolean)(resolutionBandwidth[i] >= RSSPECAN_LIST_POWER_MIN_RBW
+			&& resolutionBandwidth[i] <= RSSPECAN_LIST_POWER_MAX_RBW);
+		plan[i].attenuation = RFInputAttenuation[i];
+		plan[i].frequency = frequency[i];
+		plan[i].request = i;
+		if (plan[i].listItem)
+			list_items++;
+	}
+
+	qsort(plan, (size_t)requestsCount, sizeof(rsspecan_ListPowerPlanEntry), rsspecan_CompareListPowerPlanEntries);
+
+	if (list_items > 0)
+	{
+		viCheckAlloc(items = (ViReal64*)RsCore_Malloc(instrSession, 9 * RSSPECAN_LIST_POWER_MAX_ITEMS * sizeof(ViReal64)));
+		item_freq = items;
+		item_ref = item_freq + RSSPECAN_LIST_POWER_MAX_ITEMS;
+		item_att = item_ref + RSSPECAN_LIST_POWER_MAX_ITEMS;
+		item_eatt = item_att + RSSPECAN_LIST_POWER_MAX_ITEMS;
+		item_rbw = item_eatt + RSSPECAN_LIST_POWER_MAX_ITEMS;
+		item_vbw = item_rbw + RSSPECAN_LIST_POWER_MAX_ITEMS;
+		item_time = item_vbw + RSSPECAN_LIST_POWER_MAX_ITEMS;
+		item_trig = item_time + RSSPECAN_LIST_POWER_MAX_ITEMS;
+		item_results = item_trig + RSSPECAN_LIST_POWER_MAX_ITEMS;
+
+		for (j = 0; j < RSSPECAN_LIST_POWER_MAX_ITEMS; j++)
+		{
+			filter_type[j] = RSSPECAN_VAL_LIST_FTYPE_NORM;
+			item_eatt[j] = -1.0; // Electronic attenuator off
+			item_time[j] = measTime;
+			item_trig[j] = 0.0;
+		}
+
+		checkErr(rsspecan_ConfigureListPowerSet(instrSession, window,
+			(ViBoolean)(detector == RSSPECAN_VAL_TDOM_PEAK),
+			(ViBoolean)(detector == RSSPECAN_VAL_TDOM_RMS),
+			(ViBoolean)(detector == RSSPECAN_VAL_TDOM_MEAN),
+			RSSPECAN_VAL_TRG_IMM, 0, 0.0, 0.0));
+		list_power_on = VI_TRUE;
+
+		// One sequence query runs all its items, extend the VISA timeout for it
+		checkErr(RsCore_GetVisaTimeout(instrSession, &old_timeout));
+		if (timeout > old_timeout)
+		{
+			checkErr(RsCore_SetVisaTimeout(instrSession, timeout));
+			restore_timeout = VI_TRUE;
+		}
+
+		for (i = 0; i < list_items; i += items_count)
+		{
+			items_count = list_items - i;
+			if (items_count > RSSPECAN_LIST_POWER_MAX_ITEMS)
+				items_count = RSSPECAN_LIST_POWER_MAX_ITEMS;
+
+			for (j = 0; j < items_count; j++)
+			{
+				request = plan[i + j].request;
+				item_freq[j] = frequency[request];
+				item_ref[j] = referenceLevel[request];
+				item_att[j] = RFInputAttenuation[request];
+				item_rbw[j] = resolutionBandwidth[request];
+				item_vbw[j] = 10.0 * resolutionBandwidth[request];
+				if (item_vbw[j] > RSSPECAN_LIST_POWER_MAX_VBW)
+					item_vbw[j] = RSSPECAN_LIST_POWER_MAX_VBW;
+			}
+
+			checkErr(rsspecan_QueryListPowerSequence(instrSession, window, items_count, item_freq, item_ref, item_att,
+				item_eatt, filter_type, item_rbw, item_vbw, item_time, item_trig, item_results));
+
+			for (j = 0; j < items_count; j++)
+				results[plan[i + j].request] = item_results[j];
+
+			sequences++;
+			if (sequencesCount)
+				*sequencesCount = sequences;
+		}
+
+		if (restore_timeout)
+		{
+			restore_timeout = VI_FALSE;
+			checkErr(RsCore_SetVisaTimeout(instrSession, old_timeout));
+		}
+
+		list_power_on = VI_FALSE;
+		checkErr(rsspecan_ListPowerMeasurementOff(instrSession, window));
+	}
+
+	if (list_items < requestsCount)
+	{
+		// Individual zero span sweeps for the requests the list filters can not measure
+		snprintf(repCap, RS_REPCAP_BUF_SIZE, "Win" _PERCD, window);
+
+		switch (detector)
+		{
+		case RSSPECAN_VAL_TDOM_PEAK:
+			tdom_attribute = RSSPECAN_ATTR_MEAS_TDOM_PEAK;
+			break;
+		case RSSPECAN_VAL_TDOM_RMS:
+			tdom_attribute = RSSPECAN_ATTR_MEAS_TDOM_RMS;
+			break;
+		default:
+			tdom_attribute = RSSPECAN_ATTR_MEAS_TDOM_MEAN;
+			break;
+		}
+
+		checkErr(rsspecan_SetAttributeViBoolean(instrSession, repCap, RSSPECAN_ATTR_SWEEP_MODE_CONTINUOUS, VI_FALSE));
+		checkErr(rsspecan_SetAttributeViReal64(instrSession, repCap, RSSPECAN_ATTR_FREQUENCY_SPAN, 0.0));
+		checkErr(rsspecan_SetAttributeViBoolean(instrSession, repCap, RSSPECAN_ATTR_SWEEP_TIME_AUTO, VI_FALSE));
+		checkErr(rsspecan_SetAttributeViReal64(instrSession, repCap, RSSPECAN_ATTR_SWEEP_TIME, measTime));
+		checkErr(rsspecan_SetAttributeViBoolean(instrSession, repCap, RSSPECAN_ATTR_ATTENUATION_AUTO, VI_FALSE));
+		checkErr(rsspecan_SetAttributeViBoolean(instrSession, repCap, RSSPECAN_ATTR_RESOLUTION_BANDWIDTH_AUTO, VI_FALSE));
+		checkErr(rsspecan_SetAttributeViBoolean(instrSession, repCap, RSSPECAN_ATTR_VIDEO_BANDWIDTH_AUTO, VI_TRUE));
+		checkErr(rsspecan_SetAttributeViBoolean(instrSession, repCap, tdom_attribute, VI_TRUE));
+		checkErr(rsspecan_SetAttributeViBoolean(instrSession, repCap, RSSPECAN_ATTR_MEAS_TDOM_STATE, VI_TRUE));
+
+		// Unchanged settings between the sweeps are skipped by the attribute cache
+		for (i = list_items; i < requestsCount; i++)
+		{
+			request = plan[i].request;
+
+			checkErr(rsspecan_SetAttributeViReal64(instrSession, repCap, RSSPECAN_ATTR_FREQUENCY_CENTER, frequency[request]));
+			checkErr(rsspecan_SetAttributeViReal64(instrSession, repCap, RSSPECAN_ATTR_ATTENUATION, RFInputAttenuation[request]));
+			checkErr(rsspecan_SetAttributeViReal64(instrSession, repCap, RSSPECAN_ATTR_REFERENCE_LEVEL, referenceLevel[request]));
+			checkErr(rsspecan_SetAttributeViReal64(instrSession, repCap, RSSPECAN_ATTR_RESOLUTION_BANDWIDTH, resolutionBandwidth[request]));
+
+			checkErr(rsspecan_Initiate(instrSession, window, timeout));
+			checkErr(rsspecan_QueryTDomPowerResult(instrSession, window, detector, RSSPECAN_VAL_TDOM_RESULT, &results[request]));
+
+			sweeps++;
+			if (sweepsCount)
+				*sweepsCount = sweeps;
+		}
+	}
+
+Error:
+	if (restore_timeout)
+		(void)RsCore_SetVisaTimeout(instrSession, old_timeout);
+	if (list_power_on)
+		(void)rsspecan_ListPowerMeasurementOff(instrSession, window);
+	if (items) RsCore_Free(instrSession, items);
+	if (plan) RsCore_Free(instrSession, plan);
+	(void)RsCore_UnlockSession(instrSession);
+	return error;
+}
+
 /*****************************************************************************
  * Function:    Copy Trace
  * Purpose:     This function copies one trace array to another trace array.
@@ -3207,6 +3648,92 @@ Error:
 	return error;
 }
 
+/*****************************************************************************
+ * Function:    Query All Markers
+ * Purpose:     This function returns the horizontal position and the
+ *              amplitude level of all enabled markers and delta markers of
+ *              the window. The states of all markers are read in one
+ *              transaction, with the trace cache ON they are reused until
+ *              the next setting command. The positions and amplitudes of the
+ *              enabled markers are read in one further transaction, the
+ *              instrument status is checked once.
+ *              The markers come first, then the delta markers.
+ *              The markerNumbers and deltaMarkers arrays can be VI_NULL.
+ *              At most arraySize markers are returned, markersCount is the
+ *              number of all enabled markers.
+ *****************************************************************************/
+ViStatus _VI_FUNC rsspecan_QueryAllMarkers(ViSession instrSession,
+                                           ViInt32 window,
+                                           ViInt32 arraySize,
+                                           ViInt32 markerNumbers[],
+                                           ViBoolean deltaMarkers[],
+                                           ViReal64 markerPositions[],
+                                           ViReal64 markerAmplitudes[],
+                                           ViInt32* markersCount)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar query[RS_MAX_MESSAGE_BUF_SIZE];
+	ViReal64 states[32];
+	ViReal64 values[64];
+	ViInt32 enabled[32];
+	ViInt32 max_marker = 4;
+	ViInt32 i, length;
+	ViInt32 enabledCount = 0;
+
+	checkErr(RsCore_LockSession(instrSession));
+
+	if (rsspecan_IsFSV(instrSession))
+		max_marker = 16;
+
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, arraySize, 0, INT_MAX), 3, "Array Size");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, markerPositions), 6, "Marker Positions");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, markerAmplitudes), 7, "Marker Amplitudes");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, markersCount), 8, "Markers Count");
+
+	// States of the markers followed by the delta markers: 'CALC1:MARK1?;MARK2?;...;DELT1?;DELT2?;...'
+	length = snprintf(query, RS_MAX_MESSAGE_BUF_SIZE, "CALC" _PERCD ":MARK1?", window);
+	for (i = 2; i <= max_marker; i++)
+		length += snprintf(query + length, RS_MAX_MESSAGE_BUF_SIZE - length, ";MARK" _PERCD "?", i);
+
+	for (i = 1; i <= max_marker; i++)
+		length += snprintf(query + length, RS_MAX_MESSAGE_BUF_SIZE - length, ";DELT" _PERCD "?", i);
+
+	checkErr(RsCore_QueryViReal64MultipleSettingsCached(instrSession, query, 2 * max_marker, states, NULL));
+
+	length = 0;
+	for (i = 0; i < 2 * max_marker; i++)
+	{
+		if (states[i] == 0.0)
+			continue;
+
+		length += snprintf(query + length, RS_MAX_MESSAGE_BUF_SIZE - length, "%s:CALC" _PERCD ":%s" _PERCD ":X?;Y?",
+		                   enabledCount > 0 ? ";" : "", window, i < max_marker ? "MARK" : "DELT", i % max_marker + 1);
+		enabled[enabledCount++] = i;
+	}
+
+	if (enabledCount > 0)
+		checkErr(RsCore_QueryViReal64Multiple(instrSession, query, 2 * enabledCount, values));
+
+	*markersCount = enabledCount;
+	for (i = 0; i < enabledCount && i < arraySize; i++)
+	{
+		if (markerNumbers)
+			markerNumbers[i] = enabled[i] % max_marker + 1;
+
+		if (deltaMarkers)
+			deltaMarkers[i] = (ViBoolean)(enabled[i] >= max_marker);
+
+		markerPositions[i] = values[2 * i];
+		markerAmplitudes[i] = values[2 * i + 1];
+	}
+
+	checkErr(rsspecan_CheckStatus(instrSession));
+
+Error:
+	(void)RsCore_UnlockSession(instrSession);
+	return error;
+}
+
 /*****************************************************************************
  * Function:    Set Instrument From Marker
  * Purpose:     This function makes the selected marker frequency to be
@@ -3955,29 +4482,16 @@ ViStatus _VI_FUNC rsspecan_ReadMarkerPeakList(ViSession instrSession,
                                               ViInt32* returnedValues)
 {
 	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 i, dataSize;
+	ViReal64* columns[3];
 
 	checkErr(RsCore_LockSession(instrSession));
 
-	checkErr(rsspecan_dataReadTraceDynSize(instrSession, 1, "FPE", &data, &dataSize));
-
-	dataSize /= 3;
-
-	if (returnedValues)
-		*returnedValues = dataSize; // Three result arrays
-
-	for (i = 0; i < dataSize; i++)
-	{
-		frequency[i] = data[i * 3];
-		level[i] = data[i * 3 + 1];
-		deltaLimit[i] = data[i * 3 + 2];
-	}
-
-	checkErr(rsspecan_CheckStatus(instrSession));
+	columns[0] = frequency;
+	columns[1] = level;
+	columns[2] = deltaLimit;
+	checkErr(rsspecan_dataReadTraceColumns(instrSession, 1, "FPE", 3, columns, noOfValues, returnedValues));
 
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -6062,7 +6576,7 @@ ViStatus _VI_FUNC rsspecan_ExternalMixerConversionLossTableCatalog(ViSession ins
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (buf) free(buf);
+	if (buf) RsCore_Free(instrSession, buf);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -6716,7 +7230,7 @@ ViStatus _VI_FUNC rsspecan_GetActiveLimitLines(ViSession instrSession,
 		*returnedStringLength = strlen(pbuffer);
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -6748,7 +7262,7 @@ ViStatus _VI_FUNC rsspecan_GetLimitLineCatalog(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (buf) free(buf);
+	if (buf) RsCore_Free(instrSession, buf);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -7577,7 +8091,7 @@ ViStatus _VI_FUNC rsspecan_AddWindow(ViSession instrSession, ViInt32 stringSize,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer != NULL) free(pbuffer);
+	if (pbuffer != NULL) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -7829,7 +8343,7 @@ ViStatus _VI_FUNC rsspecan_ConfigureTransducerFactor(ViSession instrSession,
 	viCheckParm(RsCore_InvalidViInt32Range(instrSession, noofTestPoints, 0, INT_MAX),
 			7, "No Of Test Points");
 
-	viCheckAlloc(pbuf = (ViChar*) malloc((size_t)(23 + 2 * noofTestPoints * 15 + 300)));
+	viCheckAlloc(pbuf = (ViChar*) RsCore_Malloc(instrSession, (size_t)(23 + 2 * noofTestPoints * 15 + 300)));
 
 	p2buf = pbuf;
 
@@ -7847,7 +8361,7 @@ ViStatus _VI_FUNC rsspecan_ConfigureTransducerFactor(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (p2buf) free(p2buf);
+	if (p2buf) RsCore_Free(instrSession, p2buf);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -10157,6 +10671,433 @@ Error:
 	return error;
 }
 
+/// HIFN This function prepares the accumulator for the host-side statistics
+/// HIFN over many sweeps: log and linear average, RMS (power average), max hold
+/// HIFN and min hold. Several statistics are maintained from one stream of
+/// HIFN traces, the instrument trace mode stays unchanged. All memory is
+/// HIFN allocated here, release it with rsspecan_TraceAccumulatorDispose.
+/// HIRET Returns the status code of this operation.
+/// HIPAR accumulator/The caller-owned accumulator state.
+/// HIPAR points/Number of points of each trace, usually the sweep points.
+/// HIPAR statistics/RS_VAL_TRACE_STAT_* values combined with OR.
+ViStatus _VI_FUNC rsspecan_TraceAccumulatorInit(RsCoreTraceAccumulator* accumulator,
+                                                ViInt32 points,
+                                                ViInt32 statistics)
+{
+	return RsCore_TraceAccumulatorInit(accumulator, points, statistics);
+}
+
+/// HIFN This function fetches the trace of the previously initiated acquisition
+/// HIFN like rsspecan_FetchYTrace and adds it to the accumulator.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR window/This control selects the measurement window.
+/// HIPAR trace/This control selects the trace.
+/// HIPAR accumulator/The accumulator initialized by rsspecan_TraceAccumulatorInit.
+ViStatus _VI_FUNC rsspecan_FetchYTraceAccumulate(ViSession instrSession,
+                                                 ViInt32 window,
+                                                 ViInt32 trace,
+                                                 RsCoreTraceAccumulator* accumulator)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 actualPoints = 0;
+
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, accumulator), 4, "Accumulator");
+	if (accumulator->trace == NULL)
+	{
+		viCheckErrElab(RS_ERROR_NOT_INITIALIZED, "The trace accumulator is not initialized, call rsspecan_TraceAccumulatorInit first");
+	}
+
+	checkErr(rsspecan_FetchYTrace(instrSession, window, trace, accumulator->points, &actualPoints, accumulator->trace));
+	checkErr(RsCore_TraceAccumulatorAdd(accumulator, accumulator->trace, actualPoints));
+
+Error:
+	return error;
+}
+
+/// HIFN This function starts a new acquisition, reads the trace like
+/// HIFN rsspecan_ReadYTrace and adds it to the accumulator.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR window/This control selects the measurement window.
+/// HIPAR trace/This control selects the trace.
+/// HIPAR maximumTime/Maximum time of the acquisition in milliseconds.
+/// HIPAR accumulator/The accumulator initialized by rsspecan_TraceAccumulatorInit.
+ViStatus _VI_FUNC rsspecan_ReadYTraceAccumulate(ViSession instrSession,
+                                                ViInt32 window,
+                                                ViInt32 trace,
+                                                ViUInt32 maximumTime,
+                                                RsCoreTraceAccumulator* accumulator)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 actualPoints = 0;
+
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, accumulator), 5, "Accumulator");
+	if (accumulator->trace == NULL)
+	{
+		viCheckErrElab(RS_ERROR_NOT_INITIALIZED, "The trace accumulator is not initialized, call rsspecan_TraceAccumulatorInit first");
+	}
+
+	checkErr(rsspecan_ReadYTrace(instrSession, window, trace, maximumTime, accumulator->points, &actualPoints, accumulator->trace));
+	checkErr(RsCore_TraceAccumulatorAdd(accumulator, accumulator->trace, actualPoints));
+
+Error:
+	return error;
+}
+
+/// HIFN This function returns one statistic of the traces accumulated so far.
+/// HIRET Returns the status code of this operation.
+/// HIPAR accumulator/The accumulator initialized by rsspecan_TraceAccumulatorInit.
+/// HIPAR statistic/One RS_VAL_TRACE_STAT_* value maintained by the accumulator.
+/// HIPAR arraySize/Size of the result array, at least the accumulator points.
+/// HIPAR result/Returns the statistic in the units of the traces.
+ViStatus _VI_FUNC rsspecan_TraceAccumulatorGet(RsCoreTraceAccumulator* accumulator,
+                                               ViInt32 statistic,
+                                               ViInt32 arraySize,
+                                               ViReal64 result[])
+{
+	return RsCore_TraceAccumulatorGet(accumulator, statistic, arraySize, result);
+}
+
+/// HIFN This function starts the statistics of the accumulator again.
+/// HIRET Returns the status code of this operation.
+/// HIPAR accumulator/The accumulator initialized by rsspecan_TraceAccumulatorInit.
+ViStatus _VI_FUNC rsspecan_TraceAccumulatorReset(RsCoreTraceAccumulator* accumulator)
+{
+	RsCore_TraceAccumulatorReset(accumulator);
+	return VI_SUCCESS;
+}
+
+/// HIFN This function releases the memory of the accumulator.
+/// HIRET Returns the status code of this operation.
+/// HIPAR accumulator/The accumulator initialized by rsspecan_TraceAccumulatorInit.
+ViStatus _VI_FUNC rsspecan_TraceAccumulatorDispose(RsCoreTraceAccumulator* accumulator)
+{
+	RsCore_TraceAccumulatorDispose(accumulator);
+	return VI_SUCCESS;
+}
+
+/// HIFN This function searches the peaks of a fetched trace on the host, the
+/// HIFN instrument is not accessed. A peak is a local maximum at or above the
+/// HIFN threshold, which falls by at least the excursion on both sides before
+/// HIFN the trace rises above the peak again. The first and the last trace
+/// HIFN point only need the excursion on their inner side.
+/// HIRET Returns the status code of this operation.
+/// HIPAR x/Trace x values (e.g. from rsspecan_FetchXTrace) or VI_NULL for point indexes.
+/// HIPAR y/Trace y values (e.g. from rsspecan_FetchYTrace).
+/// HIPAR points/Number of trace points.
+/// HIPAR threshold/Minimum level of a peak.
+/// HIPAR excursion/Minimum level difference between a peak and the trace on both sides.
+/// HIPAR sortOrder/RS_VAL_PEAK_SORT_LEVEL or RS_VAL_PEAK_SORT_X.
+/// HIPAR maxPeaks/Maximum number of the returned peaks, size of the peak arrays.
+/// HIPAR peaksFound/Returns the number of the returned peaks.
+/// HIPAR peakIndexes/Returns the trace point indexes of the peaks, can be VI_NULL.
+/// HIPAR peakX/Returns the x values of the peaks, can be VI_NULL.
+/// HIPAR peakY/Returns the levels of the peaks, can be VI_NULL.
+ViStatus _VI_FUNC rsspecan_TraceFindPeaks(ViReal64 x[],
+                                          ViReal64 y[],
+                                          ViInt32 points,
+                                          ViReal64 threshold,
+                                          ViReal64 excursion,
+                                          ViInt32 sortOrder,
+                                          ViInt32 maxPeaks,
+                                          ViInt32* peaksFound,
+                                          ViInt32 peakIndexes[],
+                                          ViReal64 peakX[],
+                                          ViReal64 peakY[])
+{
+	return RsCore_TraceFindPeaks(x, y, points, threshold, excursion, sortOrder, maxPeaks, peaksFound, peakIndexes, peakX, peakY);
+}
+
+/// HIFN This function returns the N dB bandwidth around a peak of a fetched
+/// HIFN trace on the host, the instrument is not accessed. The edges are
+/// HIFN linearly interpolated between the trace points.
+/// HIRET Returns the status code of this operation.
+/// HIPAR x/Trace x values or VI_NULL for point indexes.
+/// HIPAR y/Trace y values.
+/// HIPAR points/Number of trace points.
+/// HIPAR peakIndex/Trace point index of the peak, e.g. from rsspecan_TraceFindPeaks.
+/// HIPAR ndB/Level difference to the peak in dB.
+/// HIPAR lowerX/Returns the x value of the lower edge.
+/// HIPAR upperX/Returns the x value of the upper edge.
+/// HIPAR bandwidth/Returns the difference of the edges, can be VI_NULL.
+ViStatus _VI_FUNC rsspecan_TraceNdBBandwidth(ViReal64 x[],
+                                             ViReal64 y[],
+                                             ViInt32 points,
+                                             ViInt32 peakIndex,
+                                             ViReal64 ndB,
+                                             ViReal64* lowerX,
+                                             ViReal64* upperX,
+                                             ViReal64* bandwidth)
+{
+	return RsCore_TraceNdBBandwidth(x, y, points, peakIndex, ndB, lowerX, upperX, bandwidth);
+}
+
+/// HIFN This function returns the levels of a fetched trace at any number of
+/// HIFN marker positions on the host, the instrument is not accessed. The
+/// HIFN levels are linearly interpolated between the trace points.
+/// HIRET Returns the status code of this operation.
+/// HIPAR x/Trace x values, ascending, or VI_NULL for point indexes.
+/// HIPAR y/Trace y values.
+/// HIPAR points/Number of trace points.
+/// HIPAR markersCount/Number of the markers.
+/// HIPAR markerX/Marker positions within the trace x range.
+/// HIPAR markerY/Returns the trace levels at the marker positions.
+ViStatus _VI_FUNC rsspecan_TraceMarkersAt(ViReal64 x[],
+                                          ViReal64 y[],
+                                          ViInt32 points,
+                                          ViInt32 markersCount,
+                                          ViReal64 markerX[],
+                                          ViReal64 markerY[])
+{
+	return RsCore_TraceMarkersAt(x, y, points, markersCount, markerX, markerY);
+}
+
+/// HIFN This function checks a fetched trace against any number of limit
+/// HIFN lines defined in the memory, the instrument is not accessed. The limit
+/// HIFN lines support the same upper/lower, relative scaling and interpolation
+/// HIFN settings as rsspecan_ConfigureLimitLine, so many alternative masks can
+/// HIFN be evaluated on one sweep without uploading them.
+/// HIRET Returns the status code of this operation.
+/// HIPAR x/Trace x values, ascending (e.g. from rsspecan_FetchXTrace).
+/// HIPAR y/Trace y values (e.g. from rsspecan_FetchYTrace).
+/// HIPAR points/Number of trace points.
+/// HIPAR xReference/Center frequency for the limit lines with relative x scaling.
+/// HIPAR yReference/Reference level for the limit lines with relative y scaling.
+/// HIPAR linesCount/Number of the limit lines.
+/// HIPAR lines/The limit line definitions.
+/// HIPAR results/Returns the check result of each limit line.
+/// HIPAR worstLine/Returns the index of the line with the worst margin, can be VI_NULL.
+/// HIPAR worstMargin/Returns the worst margin over all lines, negative for a violation, can be VI_NULL.
+/// HIPAR worstX/Returns the x value of the worst margin, can be VI_NULL.
+ViStatus _VI_FUNC rsspecan_TraceLimitCheck(ViReal64 x[],
+                                           ViReal64 y[],
+                                           ViInt32 points,
+                                           ViReal64 xReference,
+                                           ViReal64 yReference,
+                                           ViInt32 linesCount,
+                                           RsCoreLimitLine lines[],
+                                           RsCoreLimitResult results[],
+                                           ViInt32* worstLine,
+                                           ViReal64* worstMargin,
+                                           ViReal64* worstX)
+{
+	return RsCore_TraceLimitCheck(x, y, points, xReference, yReference, linesCount, lines, results, worstLine, worstMargin, worstX);
+}
+
+/// HIFN This function opens the memory-mapped trace archive file, or creates it.
+/// HIFN The archive keeps the newest traces of fixed width as float 32-bit rows
+/// HIFN with their time and sweep number, older rows are overwritten. The file
+/// HIFN size is fixed by the points and capacity. An existing archive must have
+/// HIFN the same points and capacity, the new traces are appended after its
+/// HIFN newest row. Close the archive with rsspecan_TraceArchiveClose.
+/// HIRET Returns the status code of this operation.
+/// HIPAR fileName/Path of the archive file.
+/// HIPAR points/Maximum number of points of each trace, usually the sweep points.
+/// HIPAR capacity/Number of the newest traces retained in the file.
+/// HIPAR archive/The caller-owned archive state.
+ViStatus _VI_FUNC rsspecan_TraceArchiveOpen(ViString fileName,
+                                            ViInt32 points,
+                                            ViInt32 capacity,
+                                            RsCoreTraceArchive* archive)
+{
+	ViStatus error = VI_SUCCESS;
+	ViSession instrSession = VI_NULL; // The archive does not belong to a session, the errors go to the global error info
+
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, fileName), 1, "File Name");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, archive), 4, "Archive");
+
+	checkErr(RsCore_TraceArchiveOpen(fileName, points, capacity, archive));
+
+Error:
+	return error;
+}
+
+/// HIFN This function fetches the trace of the previously initiated acquisition
+/// HIFN like rsspecan_FetchYTrace and appends it to the archive with the current
+/// HIFN time and the sweep number read in the same transaction. The binary trace
+/// HIFN data is read directly into the mapped archive file.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR window/This control selects the measurement window.
+/// HIPAR trace/This control selects the trace.
+/// HIPAR archive/The archive opened by rsspecan_TraceArchiveOpen.
+ViStatus _VI_FUNC rsspecan_FetchYTraceToArchive(ViSession instrSession,
+                                                ViInt32 window,
+                                                ViInt32 trace,
+                                                RsCoreTraceArchive* archive)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar traceName[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 trace_range = 3;
+
+	checkErr(RsCore_LockSession(instrSession));
+
+	if (RsCore_IsInstrumentModel(instrSession, "FSL") || rsspecan_IsFSV(instrSession))
+		trace_range = 6;
+
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, trace, 1, trace_range),
+			3, "Trace");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, archive), 4, "Archive");
+
+	snprintf(traceName, RS_MAX_MESSAGE_BUF_SIZE, "TRACE" _PERCD, trace);
+
+	checkErr(rsspecan_dataReadTraceToArchive(instrSession, window, traceName, archive));
+
+Error:
+	(void)RsCore_UnlockSession(instrSession);
+	return error;
+}
+
+/// HIFN This function returns the sequence numbers of the traces retained in the
+/// HIFN archive. The sequence numbers increase by one from the archive creation.
+/// HIRET Returns the status code of this operation.
+/// HIPAR archive/The archive opened by rsspecan_TraceArchiveOpen.
+/// HIPAR firstSequence/Returns the sequence number of the oldest retained trace.
+/// HIPAR tracesCount/Returns the number of the retained traces.
+ViStatus _VI_FUNC rsspecan_TraceArchiveRange(RsCoreTraceArchive* archive,
+                                             ViInt64* firstSequence,
+                                             ViInt64* tracesCount)
+{
+	ViStatus error = VI_SUCCESS;
+	ViSession instrSession = VI_NULL;
+
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, archive), 1, "Archive");
+
+	RsCore_TraceArchiveRange(archive, firstSequence, tracesCount);
+
+Error:
+	return error;
+}
+
+/// HIFN This function searches the archive index for the oldest retained trace
+/// HIFN taken at or after the entered time.
+/// HIRET Returns the status code of this operation.
+/// HIPAR archive/The archive opened by rsspecan_TraceArchiveOpen.
+/// HIPAR timestamp/Time in seconds since 1970-01-01 UTC.
+/// HIPAR sequence/Returns the sequence number of the found trace. If all the
+/// HIPAR sequence/traces are older, returns the sequence number of the next trace.
+ViStatus _VI_FUNC rsspecan_TraceArchiveFind(RsCoreTraceArchive* archive,
+                                            ViReal64 timestamp,
+                                            ViInt64* sequence)
+{
+	ViStatus error = VI_SUCCESS;
+	ViSession instrSession = VI_NULL;
+
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, archive), 1, "Archive");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, sequence), 3, "Sequence");
+
+	*sequence = RsCore_TraceArchiveFind(archive, timestamp);
+
+Error:
+	return error;
+}
+
+/// HIFN This function reads one retained trace of the archive.
+/// HIRET Returns the status code of this operation.
+/// HIPAR archive/The archive opened by rsspecan_TraceArchiveOpen.
+/// HIPAR sequence/Sequence number of the trace.
+/// HIPAR arrayLength/Number of array points requested.
+/// HIPAR amplitude/A user allocated buffer into which the trace amplitudes is stored.
+/// HIPAR actualPoints/Number of points of the trace.
+/// HIPAR timestamp/Returns the time of the trace in seconds since 1970-01-01 UTC.
+/// HIPAR sweepNumber/Returns the sweep number of the trace.
+ViStatus _VI_FUNC rsspecan_TraceArchiveRead(RsCoreTraceArchive* archive,
+                                            ViInt64 sequence,
+                                            ViInt32 arrayLength,
+                                            ViReal64 amplitude[],
+                                            ViInt32* actualPoints,
+                                            ViReal64* timestamp,
+                                            ViInt32* sweepNumber)
+{
+	ViStatus error = VI_SUCCESS;
+	ViSession instrSession = VI_NULL;
+
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, archive), 1, "Archive");
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, arrayLength, 0, INT_MAX), 3, "Array Length");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, amplitude), 4, "Amplitude");
+
+	checkErr(RsCore_TraceArchiveRead(archive, sequence, arrayLength, amplitude, actualPoints, timestamp, sweepNumber));
+
+Error:
+	return error;
+}
+
+/// HIFN This function writes the archive to the file and closes it.
+/// HIRET Returns the status code of this operation.
+/// HIPAR archive/The archive opened by rsspecan_TraceArchiveOpen.
+ViStatus _VI_FUNC rsspecan_TraceArchiveClose(RsCoreTraceArchive* archive)
+{
+	ViStatus error = VI_SUCCESS;
+	ViSession instrSession = VI_NULL;
+
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, archive), 1, "Archive");
+
+	RsCore_TraceArchiveClose(archive);
+
+Error:
+	return error;
+}
+
+/// HIFN This function fetches the trace of the previously initiated acquisition
+/// HIFN like rsspecan_FetchYTrace and decimates it for a display or a log:
+/// HIFN minimum / maximum envelope or largest-triangle-three-buckets. The
+/// HIFN decimation runs in one pass while converting the binary trace data.
+/// HIFN The full trace is returned only if the amplitude array is not NULL.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR window/This control selects the measurement window.
+/// HIPAR trace/This control selects the trace.
+/// HIPAR decimation/Mode, width and output arrays of the decimation.
+/// HIPAR arrayLength/Number of array points requested.
+/// HIPAR actualPoints/Number of points of the full trace.
+/// HIPAR amplitude/A user allocated buffer into which the full trace is stored, or NULL.
+ViStatus _VI_FUNC rsspecan_FetchYTraceDecimated(ViSession instrSession,
+                                                ViInt32 window,
+                                                ViInt32 trace,
+                                                RsCoreDecimation* decimation,
+                                                ViInt32 arrayLength,
+                                                ViInt32* actualPoints,
+                                                ViReal64 amplitude[])
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar traceName[RS_MAX_MESSAGE_BUF_SIZE];
+	ViInt32 trace_range = 3;
+
+	checkErr(RsCore_LockSession(instrSession));
+
+	if (RsCore_IsInstrumentModel(instrSession, "FSL") || rsspecan_IsFSV(instrSession))
+		trace_range = 6;
+
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, trace, 1, trace_range),
+			3, "Trace");
+
+	snprintf(traceName, RS_MAX_MESSAGE_BUF_SIZE, "TRACE" _PERCD, trace);
+
+	checkErr(rsspecan_dataReadTraceDecimated(instrSession, window, traceName, decimation, arrayLength, amplitude, actualPoints));
+
+Error:
+	(void)RsCore_UnlockSession(instrSession);
+	return error;
+}
+
+/// HIFN This function decimates a trace available on the host, the instrument
+/// HIFN is not accessed.
+/// HIRET Returns the status code of this operation.
+/// HIPAR y/Trace y values (e.g. from rsspecan_FetchYTrace).
+/// HIPAR points/Number of trace points.
+/// HIPAR decimation/Mode, width and output arrays of the decimation.
+ViStatus _VI_FUNC rsspecan_TraceDecimate(ViReal64 y[],
+                                         ViInt32 points,
+                                         RsCoreDecimation* decimation)
+{
+	return RsCore_TraceDecimate(y, points, decimation);
+}
+
 /// HIFN This function queries the previously acquired trace data for the specified trace from the memory.
 /// HIRET Returns the status code of this operation.
 /// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init
@@ -10303,9 +11244,7 @@ ViStatus _VI_FUNC rsspecan_ReadTraceIQData(ViSession instrSession,
                                            ViReal64 imaginaryPartsQ[])
 {
 	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 dataSize = 0, i;
-	ViInt32 j = 0;
+	ViReal64* columns[2];
 	ViChar cmd[RS_MAX_MESSAGE_BUF_SIZE];
 
 	checkErr(RsCore_LockSession(instrSession));
@@ -10330,26 +11269,13 @@ ViStatus _VI_FUNC rsspecan_ReadTraceIQData(ViSession instrSession,
 		snprintf(cmd, RS_MAX_MESSAGE_BUF_SIZE, "TRAC%ld:IQ:DATA?", window);
 	}
 
-	checkErr(RsCore_QueryFloatArray(instrSession, cmd, &data, &dataSize));
-
-	dataSize /= 2;
-
-	if (noofPoints)
-		*noofPoints = dataSize;
-
-	if (dataSize > bufferSize)
-		dataSize = bufferSize;
-
-	for (i = 0; i < dataSize; i++)
-	{
-		realPartsI[i] = data[j++];
-		imaginaryPartsQ[i] = data[j++];
-	}
+	columns[0] = realPartsI;
+	columns[1] = imaginaryPartsQ;
+	checkErr(RsCore_QueryFloatArrayColumns(instrSession, cmd, 2, columns, bufferSize, noofPoints));
 
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -10373,9 +11299,7 @@ ViStatus _VI_FUNC rsspecan_FetchTraceIQData(ViSession instrSession,
                                             ViReal64 imaginaryPartsQ[])
 {
 	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 dataSize = 0, i;
-	ViInt32 j = 0;
+	ViReal64* columns[2];
 	ViChar cmd[RS_MAX_MESSAGE_BUF_SIZE];
 
 	checkErr(RsCore_LockSession(instrSession));
@@ -10390,24 +11314,11 @@ ViStatus _VI_FUNC rsspecan_FetchTraceIQData(ViSession instrSession,
 	}
 
 	snprintf(cmd, RS_MAX_MESSAGE_BUF_SIZE, "TRAC:IQ:DATA:MEM? %ld,%ld", offsetSamples, noofSamples);
-	checkErr(RsCore_QueryFloatArray(instrSession, cmd, &data, &dataSize));
-
-	dataSize /= 2;
-
-	if (noofPoints)
-		*noofPoints = dataSize;
-
-	if (dataSize > bufferSize)
-		dataSize = bufferSize;
-
-	for (i = 0; i < dataSize; i++)
-	{
-		realPartsI[i] = data[j++];
-		imaginaryPartsQ[i] = data[j++];
-	}
+	columns[0] = realPartsI;
+	columns[1] = imaginaryPartsQ;
+	checkErr(RsCore_QueryFloatArrayColumns(instrSession, cmd, 2, columns, bufferSize, noofPoints));
 
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -10486,6 +11397,74 @@ Error:
 	return error;
 }
 
+/*****************************************************************************
+ * Function:    Initiate Asynchronous
+ * Purpose:     This function initiates an acquisition like rsspecan_Initiate,
+ *              but it does not wait for the acquisition to complete. The
+ *              state of the acquisition is stored in the measHandle.
+ *
+ *              Use rsspecan_WaitForMeasurements to wait for one or more
+ *              acquisitions, also on different instrument sessions. Do not
+ *              send other commands to the session until the acquisition
+ *              completes. The timeout is the OPC timeout of the acquisition
+ *              in milliseconds, 0 to 2147483647, 0 uses the session's OPC
+ *              timeout.
+ *****************************************************************************/
+ViStatus _VI_FUNC rsspecan_InitiateAsync(ViSession instrSession,
+                                         ViInt32 window,
+                                         ViUInt32 timeout,
+                                         RsCoreOpcHandle* measHandle)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar repCap[RS_REPCAP_BUF_SIZE];
+
+	checkErr(RsCore_LockSession(instrSession));
+
+	viCheckParm(RsCore_InvalidViUInt32Range(instrSession, timeout, 0, INT_MAX), 3, "Timeout");
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, measHandle), 4, "Measurement Handle");
+
+	snprintf(repCap, RS_REPCAP_BUF_SIZE, "Win%ld", window);
+
+	checkErr(RsCore_SetAttributeEventAsync(instrSession, repCap, RSSPECAN_ATTR_INIT, (ViInt32)timeout, measHandle));
+
+Error:
+	(void)RsCore_UnlockSession(instrSession);
+	return error;
+}
+
+/*****************************************************************************
+ * Function:    Wait For Measurements
+ * Purpose:     This function waits for acquisitions started with
+ *              rsspecan_InitiateAsync. The handles can belong to different
+ *              instrument sessions.
+ *
+ *              RSSPECAN_VAL_WAIT_ANY returns as soon as one acquisition
+ *              completes, its index is returned in completedIndex.
+ *              RSSPECAN_VAL_WAIT_ALL returns when all acquisitions complete,
+ *              completedIndex is the index of the first failed one or -1.
+ *              The timeout 0 waits until the acquisitions complete or their
+ *              own timeouts elapse.
+ *****************************************************************************/
+ViStatus _VI_FUNC rsspecan_WaitForMeasurements(RsCoreOpcHandle measHandles[],
+                                               ViInt32 handlesCount,
+                                               ViInt32 waitMode,
+                                               ViUInt32 timeout,
+                                               ViInt32* completedIndex)
+{
+	ViStatus error = VI_SUCCESS;
+	ViSession instrSession = VI_NULL; // The handles can belong to different sessions, the errors go to the global error info
+
+	viCheckParm(RsCore_InvalidNullPointer(instrSession, measHandles), 1, "Measurement Handles");
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, handlesCount, 1, INT_MAX), 2, "Handles Count");
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, waitMode, RSSPECAN_VAL_WAIT_ANY, RSSPECAN_VAL_WAIT_ALL), 3, "Wait Mode");
+	viCheckParm(RsCore_InvalidViUInt32Range(instrSession, timeout, 0, INT_MAX), 4, "Timeout");
+
+	checkErr(RsCore_WaitForOpcHandles(measHandles, handlesCount, waitMode, (ViInt32)timeout, completedIndex));
+
+Error:
+	return error;
+}
+
 /*****************************************************************************
  * Function:    Initiate Spurious
  * Purpose:     This function starts a new spurious measurement.
@@ -13459,14 +14438,21 @@ Error:
 ViStatus _VI_FUNC rsspecan_close(ViSession instrSession)
 {
 	ViStatus error = VI_SUCCESS;
+	ViBoolean parked = VI_FALSE;
 
 	checkErr(RsCore_LockSession(instrSession));
 
-	checkErr(RsCore_ViClose(instrSession));
+	// With the option 'SessionPool=1' the session stays open for the next init of the same resource
+	parked = RsCore_ReleaseToSessionPool(instrSession);
+	if (parked == VI_FALSE)
+	{
+		checkErr(RsCore_ViClose(instrSession));
+	}
 
 Error:
 	(void)RsCore_UnlockSession(instrSession);
-	(void)RsCore_Dispose(instrSession);
+	if (parked == VI_FALSE)
+		(void)RsCore_Dispose(instrSession);
 
 	return error;
 }
@@ -14067,29 +15053,18 @@ ViStatus _VI_FUNC rsspecan_ReadSEPeakList(ViSession instrSession,
                                           ViInt32* returnedValues)
 {
 	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 dataSize = 0;
-	ViInt32 i;
+	ViReal64* columns[3];
 
 	checkErr(RsCore_LockSession(instrSession));
 
 	checkErr(RsCore_CheckInstrumentModel(instrSession, "!FMU"));
-	checkErr(rsspecan_dataReadTraceDynSize(instrSession, 1, "SPUR", &data, &dataSize));
-	dataSize /= 3;
-	if (returnedValues)
-		*returnedValues = dataSize;
 
-	for (i = 0; i < dataSize; i++)
-	{
-		frequency[i] = data[i * 3];
-		level[i] = data[i * 3 + 1];
-		deltaLimit[i] = data[i * 3 + 2];
-	}
-
-	checkErr(rsspecan_CheckStatus(instrSession));
+	columns[0] = frequency;
+	columns[1] = level;
+	columns[2] = deltaLimit;
+	checkErr(rsspecan_dataReadTraceColumns(instrSession, 1, "SPUR", 3, columns, noOfValues, returnedValues));
 
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -14135,9 +15110,7 @@ ViStatus _VI_FUNC rsspecan_ReadSEListEvaluation(ViSession instrSession,
                                                 ViInt32* returnedValues)
 {
 	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 dataSize = 0;
-	ViInt32 i, j = 0;
+	ViReal64* columns[11];
 
 	checkErr(RsCore_LockSession(instrSession));
 
@@ -14155,34 +15128,22 @@ ViStatus _VI_FUNC rsspecan_ReadSEListEvaluation(ViSession instrSession,
 	viCheckParm(RsCore_InvalidNullPointer(instrSession, reserved1), 11, "Reserved 1");
 	viCheckParm(RsCore_InvalidNullPointer(instrSession, reserved2), 12, "Reserved 2");
 
-	checkErr(RsCore_QueryFloatArray(instrSession, "TRAC:DATA? LIST", &data, &dataSize));
-
-	dataSize /= 11;
-	if (returnedValues)
-		*returnedValues = dataSize;
-
-	if (dataSize > noOfValues)
-		dataSize = noOfValues;
-
-	for (i = 0; i < dataSize; i++)
-	{
-		rangeNumber[i] = data[j++];
-		startFrequency[i] = data[j++];
-		stopFrequency[i] = data[j++];
-		resolutionBandwidth[i] = data[j++];
-		frequency[i] = data[j++];
-		levelAbs[i] = data[j++];
-		levelRel[i] = data[j++];
-		delta[i] = data[j++];
-		limitCheck[i] = data[j++];
-		reserved1[i] = data[j++];
-		reserved2[i] = data[j++];
-	}
+	columns[0] = rangeNumber;
+	columns[1] = startFrequency;
+	columns[2] = stopFrequency;
+	columns[3] = resolutionBandwidth;
+	columns[4] = frequency;
+	columns[5] = levelAbs;
+	columns[6] = levelRel;
+	columns[7] = delta;
+	columns[8] = limitCheck;
+	columns[9] = reserved1;
+	columns[10] = reserved2;
+	checkErr(RsCore_QueryFloatArrayColumns(instrSession, "TRAC:DATA? LIST", 11, columns, noOfValues, returnedValues));
 
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -14337,41 +15298,21 @@ ViStatus _VI_FUNC rsspecan_ReadSEMPeakList(ViSession instrSession,
                                            ViInt32* returnedValues)
 {
 	ViStatus error = VI_SUCCESS;
-	ViInt32 arrayLength;
-	ViReal64* data = NULL;
-	ViInt32 retVal;
-	ViInt32 i;
+	ViReal64* columns[3];
 	ViChar traceName[RS_MAX_MESSAGE_BUF_SIZE] = "";
 
 	checkErr(RsCore_LockSession(instrSession));
 
 	checkErr(RsCore_CheckInstrumentModel(instrSession, "!FMU"));
 
-	arrayLength = 3 * noOfValues;
-	data = malloc(sizeof(ViReal64) * arrayLength);
-
 	sprintf(traceName, "FINal%ld", finalMeasurement);
 
-	checkErr(rsspecan_dataReadTrace(instrSession, window, traceName, arrayLength, data, &retVal));
-
-	if (returnedValues)
-		*returnedValues = retVal / 3; // Three result arrays
-
-	retVal = (retVal > arrayLength) ? arrayLength : retVal;
-
-	retVal /= 3;
-
-	for (i = 0; i < retVal; i++)
-	{
-		frequency[i] = data[i * 3];
-		level[i] = data[i * 3 + 1];
-		deltaLevel[i] = data[i * 3 + 2];
-	}
-
-	checkErr(rsspecan_CheckStatus(instrSession));
+	columns[0] = frequency;
+	columns[1] = level;
+	columns[2] = deltaLevel;
+	checkErr(rsspecan_dataReadTraceColumns(instrSession, window, traceName, 3, columns, noOfValues, returnedValues));
 
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -14451,9 +15392,7 @@ ViStatus _VI_FUNC rsspecan_ReadSEMListEvaluationResults(ViSession instrSession,
                                                         ViInt32* returnedValues)
 {
 	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 dataSize;
-	ViInt32 i, j = 0;
+	ViReal64* columns[11];
 
 	checkErr(RsCore_LockSession(instrSession));
 
@@ -14471,35 +15410,22 @@ ViStatus _VI_FUNC rsspecan_ReadSEMListEvaluationResults(ViSession instrSession,
 	viCheckParm(RsCore_InvalidNullPointer(instrSession, reserved1), 11, "Reserved 1");
 	viCheckParm(RsCore_InvalidNullPointer(instrSession, reserved2), 12, "Reserved 2");
 
-	checkErr(RsCore_QueryFloatArray(instrSession, "TRAC:DATA? LIST", &data, &dataSize));
-
-	dataSize /= 11;
-
-	if (returnedValues)
-		*returnedValues = dataSize;
-
-	if (dataSize > noOfValues)
-		dataSize = noOfValues;
-
-	for (i = 0; i < dataSize; i++)
-	{
-		rangeNumber[i] = data[j++];
-		startFrequency[i] = data[j++];
-		stopFrequency[i] = data[j++];
-		resolutionBandwidth[i] = data[j++];
-		frequency[i] = data[j++];
-		powerAbs[i] = data[j++];
-		powerRel[i] = data[j++];
-		delta[i] = data[j++];
-		limitCheck[i] = data[j++];
-		reserved1[i] = data[j++];
-		reserved2[i] = data[j++];
-	}
+	columns[0] = rangeNumber;
+	columns[1] = startFrequency;
+	columns[2] = stopFrequency;
+	columns[3] = resolutionBandwidth;
+	columns[4] = frequency;
+	columns[5] = powerAbs;
+	columns[6] = powerRel;
+	columns[7] = delta;
+	columns[8] = limitCheck;
+	columns[9] = reserved1;
+	columns[10] = reserved2;
+	checkErr(RsCore_QueryFloatArrayColumns(instrSession, "TRAC:DATA? LIST", 11, columns, noOfValues, returnedValues));
 
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -15350,7 +16276,7 @@ ViStatus _VI_FUNC rsspecan_ConfigureSEMPowerClassAllLimits(ViSession instrSessio
 	if (!rsspecan_IsFSV(instrSession) || (!RsCore_IsInstrumentModel(instrSession, "FSL")))
 		checkErr(RS_ERROR_INSTRUMENT_MODEL);
 
-	pbuffer = (ViChar*)malloc(150 * numberOfLimits + 30);
+	pbuffer = (ViChar*)RsCore_Malloc(instrSession, 150 * numberOfLimits + 30);
 
 	p2buf = pbuffer + sprintf(pbuffer, "CALC:LIM:ESP:LIM ");
 
@@ -15361,7 +16287,7 @@ ViStatus _VI_FUNC rsspecan_ConfigureSEMPowerClassAllLimits(ViSession instrSessio
 
 	checkErr(RsCore_Write(instrSession, pbuffer));
 
-	free(pbuffer);
+	RsCore_Free(instrSession, pbuffer);
 
 	checkErr(rsspecan_CheckStatus(instrSession));
 
@@ -15479,28 +16405,16 @@ ViStatus _VI_FUNC rsspecan_QueryMSRAAllAnalysisInterval(ViSession instrSession,
 {
 	ViStatus error = VI_SUCCESS;
 	ViChar cmd[RS_MAX_MESSAGE_BUF_SIZE];
-	ViReal64* data = NULL;
-	ViInt32 dataSize = 0, i;
-	ViInt32 j = 0;
+	ViReal64* columns[2];
 
 	checkErr(RsCore_LockSession(instrSession));
 
 	snprintf(cmd, RS_MAX_MESSAGE_BUF_SIZE, "CALC:MSRA:WIND%ld:MIV?", window);
-	checkErr(RsCore_QueryFloatArray(instrSession, cmd, &data, &dataSize));
-
-	dataSize /= 2;
-
-	if (dataSize > arraySize)
-		dataSize = arraySize;
-
-	for (i = 0; i < dataSize; i++)
-	{
-		intervalStart[i] = data[j++];
-		intervalStop[i] = data[j++];
-	}
+	columns[0] = intervalStart;
+	columns[1] = intervalStop;
+	checkErr(RsCore_QueryFloatArrayColumns(instrSession, cmd, 2, columns, arraySize, NULL));
 
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -15961,7 +16875,7 @@ ViStatus _VI_FUNC rsspecan_NetworkMapDrive(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (p2buf) free(p2buf);
+	if (p2buf) RsCore_Free(instrSession, p2buf);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -16536,6 +17450,204 @@ ViStatus _VI_FUNC rsspecan_GetVISATimeout(ViSession instrSession,
 	return RsCore_GetVisaTimeout(instrSession, VISATimeout);
 }
 
+/// HIFN This function writes the IO trace of the session to a text file.
+/// HIFN The driver records every write, read, status byte read and device
+/// HIFN clear of the session in a ring buffer of the last 256 operations:
+/// HIFN the sequence number, the operation, start time, duration, status,
+/// HIFN byte counts and the leading bytes of the command or the response.
+/// HIFN The trace is always active and the function can be called at any
+/// HIFN time, also from another thread while the session is busy.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR fileName/Path of the file to write. If empty, the trace is written to the
+/// HIPAR fileName/standard output.
+ViStatus _VI_FUNC rsspecan_DumpIoTrace(ViSession instrSession,
+                                       ViString fileName)
+{
+	return RsCore_DumpIoTrace(instrSession, fileName);
+}
+
+/// HIFN This function returns the latency statistics of a driver function
+/// HIFN called on the session. The driver keeps a histogram of the durations
+/// HIFN of every called function, with the time split to the host CPU time,
+/// HIFN the instrument IO wait and the OPC wait. When a driver function calls
+/// HIFN other driver functions, their time is accounted to the calling one.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR functionName/Name of the driver function, e.g. "rsspecan_ReadYTrace".
+/// HIPAR component/Selects the time component: RSSPECAN_VAL_LATENCY_TOTAL,
+/// HIPAR component/RSSPECAN_VAL_LATENCY_HOST_CPU, RSSPECAN_VAL_LATENCY_IO_WAIT
+/// HIPAR component/or RSSPECAN_VAL_LATENCY_OPC_WAIT.
+/// HIPAR stats/Returns the number of calls, min, mean, percentiles and max in
+/// HIPAR stats/microseconds. The count is 0 if the function was not called yet.
+ViStatus _VI_FUNC rsspecan_GetFunctionLatency(ViSession instrSession,
+                                              ViString functionName,
+                                              ViInt32 component,
+                                              RsCoreLatencyStats* stats)
+{
+	return RsCore_GetFunctionLatency(instrSession, functionName, component, stats);
+}
+
+/// HIFN This function writes the latency statistics of all the driver
+/// HIFN functions called on the session to a text file.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR fileName/Path of the file to write. If empty, the statistics are written
+/// HIPAR fileName/to the standard output.
+ViStatus _VI_FUNC rsspecan_DumpFunctionLatency(ViSession instrSession,
+                                               ViString fileName)
+{
+	return RsCore_DumpFunctionLatency(instrSession, fileName);
+}
+
+/// HIFN This function clears the latency statistics of all the driver
+/// HIFN functions called on the session.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+ViStatus _VI_FUNC rsspecan_ResetFunctionLatency(ViSession instrSession)
+{
+	return RsCore_ResetFunctionLatency(instrSession);
+}
+
+/// HIFN This function switches the round-trip diagnostics ON or OFF. When ON,
+/// HIFN the driver counts the instrument IO operations (writes, reads, status
+/// HIFN byte reads and device clears) of every called driver function and
+/// HIFN flags the redundant ones: identical consecutive writes, repeated FORM
+/// HIFN commands, status checks with no write in between and OPC timeout
+/// HIFN changes not used by any OPC-synchronized operation.
+/// HIFN The diagnostics can also be switched ON with the option string token
+/// HIFN "RoundTripDiagnostics=1".
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR state/VI_TRUE switches the diagnostics ON, VI_FALSE OFF.
+ViStatus _VI_FUNC rsspecan_ConfigureRoundTripDiagnostics(ViSession instrSession,
+                                                         ViBoolean state)
+{
+	return RsCore_SetRoundTripDiagnostics(instrSession, state);
+}
+
+/// HIFN This function returns the round-trip statistics of a driver function
+/// HIFN called with the round-trip diagnostics ON.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR functionName/Name of the driver function, e.g. "rsspecan_ReadYTrace".
+/// HIPAR stats/Returns the number of calls, IO operations and redundant patterns.
+/// HIPAR stats/The calls are 0 if the function was not called yet.
+ViStatus _VI_FUNC rsspecan_GetRoundTripStats(ViSession instrSession,
+                                             ViString functionName,
+                                             RsCoreRoundTripStats* stats)
+{
+	return RsCore_GetRoundTripStats(instrSession, functionName, stats);
+}
+
+/// HIFN This function writes the round-trip report of the driver functions
+/// HIFN called with the round-trip diagnostics ON to a text file: the round
+/// HIFN trips per call and the redundant patterns with an example.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR fileName/Path of the file to write. If empty, the report is written
+/// HIPAR fileName/to the standard output.
+ViStatus _VI_FUNC rsspecan_DumpRoundTripReport(ViSession instrSession,
+                                               ViString fileName)
+{
+	return RsCore_DumpRoundTripReport(instrSession, fileName);
+}
+
+/// HIFN This function closes all the sessions kept open in the warm session
+/// HIFN pool. The sessions initialized with the option string token
+/// HIFN "SessionPool=1" are not closed by rsspecan_close, they wait for the
+/// HIFN next rsspecan_InitWithOptions of the same resource.
+/// HIRET Returns the status code of this operation.
+ViStatus _VI_FUNC rsspecan_ClearSessionPool(void)
+{
+	return RsCore_ClearSessionPool();
+}
+
+// rsspecan_InitWithOptions parameters shared by all the resources of rsspecan_InitMultiple
+typedef struct rsspecan_InitMultipleSettings
+{
+	ViBoolean IDQuery;
+	ViBoolean resetDevice;
+	ViString optionString;
+} rsspecan_InitMultipleSettings;
+
+static ViStatus rsspecan_InitMultipleOpen(ViRsrc resourceName, void* context, ViSession* instrSession)
+{
+	rsspecan_InitMultipleSettings* settings = (rsspecan_InitMultipleSettings*)context;
+
+	return rsspecan_InitWithOptions(resourceName, settings->IDQuery, settings->resetDevice, settings->optionString, instrSession);
+}
+
+/// HIFN This function opens several instruments in parallel. Each resource is
+/// HIFN initialized by rsspecan_InitWithOptions in its own thread with the same
+/// HIFN IDQuery, resetDevice and optionString, so the start-up of a station
+/// HIFN takes about as long as the slowest instrument.
+/// HIRET Returns the first error status in the order of the resourceNames,
+/// HIRET VI_SUCCESS if all the instruments were opened. The description of
+/// HIRET that error is available with rsspecan_GetError(VI_NULL, ...).
+/// HIPAR count/Number of the resources.
+/// HIPAR resourceNames/Array of count resource names.
+/// HIPAR IDQuery/Passed to rsspecan_InitWithOptions.
+/// HIPAR resetDevice/Passed to rsspecan_InitWithOptions.
+/// HIPAR optionString/Passed to rsspecan_InitWithOptions.
+/// HIPAR instrSessions/Array of count elements, returns the session handles.
+/// HIPAR instrSessions/The handle of a failed resource is 0.
+/// HIPAR statuses/Array of count elements, returns the status of each resource.
+ViStatus _VI_FUNC rsspecan_InitMultiple(ViInt32 count,
+                                        ViRsrc resourceNames[],
+                                        ViBoolean IDQuery,
+                                        ViBoolean resetDevice,
+                                        ViString optionString,
+                                        ViSession instrSessions[],
+                                        ViStatus statuses[])
+{
+	rsspecan_InitMultipleSettings settings;
+
+	settings.IDQuery = IDQuery;
+	settings.resetDevice = resetDevice;
+	settings.optionString = optionString;
+
+	return RsCore_OpenSessionsParallel(count, resourceNames, rsspecan_InitMultipleOpen, &settings, instrSessions, statuses);
+}
+
+/// HIFN This function switches the trace cache ON or OFF. When ON, the trace
+/// HIFN reads (e.g. rsspecan_FetchYTrace) get the sweep number together with
+/// HIFN the trace. Repeated reads of the same trace within the same sweep only
+/// HIFN query the sweep number and return the trace from the memory. Any
+/// HIFN setting command sent by the driver invalidates the cached traces.
+/// HIFN The cache can also be switched ON with the option string token
+/// HIFN "TraceCache=1".
+/// HIFN Note: The cache is used only in the single sweep with a sweep count,
+/// HIFN where the sweep number changes with each sweep. Traces of the continuous
+/// HIFN sweep are always read from the instrument.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+/// HIPAR state/VI_TRUE switches the cache ON, VI_FALSE OFF and releases the cached traces.
+ViStatus _VI_FUNC rsspecan_ConfigureTraceCache(ViSession instrSession,
+                                               ViBoolean state)
+{
+	return RsCore_SetTraceCacheEnabled(instrSession, state);
+}
+
+/// HIFN This function invalidates all the cached traces. Call it if the trace
+/// HIFN data can change without a new sweep and without any driver command,
+/// HIFN e.g. after a manual operation on the instrument.
+/// HIRET Returns the status code of this operation.
+/// HIPAR instrSession/The ViSession handle that you obtain from the rsspecan_init or
+/// HIPAR instrSession/rsspecan_InitWithOptions function.
+ViStatus _VI_FUNC rsspecan_InvalidateTraceCache(ViSession instrSession)
+{
+	return RsCore_InvalidateTraceCache(instrSession);
+}
+
 /*****************************************************************************
  * Function: Lock Local Key
  * Purpose:  This function is used to activate the LLO (local lockout) or to
@@ -16744,7 +17856,7 @@ ViStatus _VI_FUNC rsspecan_ReadInstrData(ViSession instrSession, ViInt32 numByte
 
 Error:
 	if (responseString)
-		free(responseString);
+		RsCore_Free(instrSession, responseString);
 
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
@@ -5688,6 +5688,18 @@ extern "C" {
 #define RSSPECAN_VAL_ACQUISITION_STATUS_CLASS_EXT_BASE              (500L)
 #define RSSPECAN_VAL_ACQUISITION_STATUS_SPECIFIC_EXT_BASE           (1000L)
 
+    /*- Defined values for rsspecan_WaitForMeasurements ----------------------*/
+
+#define RSSPECAN_VAL_WAIT_ANY                                       RS_VAL_OPC_HANDLE_WAIT_ANY
+#define RSSPECAN_VAL_WAIT_ALL                                       RS_VAL_OPC_HANDLE_WAIT_ALL
+
+    /*- Defined values for rsspecan_GetFunctionLatency -----------------------*/
+
+#define RSSPECAN_VAL_LATENCY_TOTAL                                  RS_VAL_LATENCY_TOTAL
+#define RSSPECAN_VAL_LATENCY_HOST_CPU                               RS_VAL_LATENCY_HOST_CPU
+#define RSSPECAN_VAL_LATENCY_IO_WAIT                                RS_VAL_LATENCY_IO_WAIT
+#define RSSPECAN_VAL_LATENCY_OPC_WAIT                               RS_VAL_LATENCY_OPC_WAIT
+
 
     /*- Defined values for rsspecan_MarkerSearch -----------------------------*/
 
@@ -7576,6 +7588,19 @@ ViStatus _VI_FUNC rsspecan_QueryAllMeasurementChannels (ViSession instrumentHand
                                                         ViInt32 _VI_FAR channelType[],
                                                         ViChar _VI_FAR channelName[],
                                                         ViInt32* returnedValues);
+/* One job of rsspecan_RunMeasurementJobs, called in the job's measurement channel */
+typedef ViStatus (_VI_FUNCH *rsspecan_MeasurementJobCallback) (ViSession instrumentHandle,
+                                                               ViInt32 job, void* context);
+ViStatus _VI_FUNC rsspecan_RunMeasurementJobs (ViSession instrumentHandle,
+                                               ViInt32 jobsCount,
+                                               ViString _VI_FAR jobChannels[],
+                                               ViInt32 dependenciesCount,
+                                               ViInt32 _VI_FAR prerequisiteJobs[],
+                                               ViInt32 _VI_FAR dependentJobs[],
+                                               rsspecan_MeasurementJobCallback jobCallback,
+                                               void* context,
+                                               ViInt32 _VI_FAR executionOrder[],
+                                               ViInt32* channelSwitches);
 ViStatus _VI_FUNC rsspecan_ConfigureTrace (ViSession instrumentHandle,
                                            ViInt32 window, ViInt32 trace,
                                            ViInt32 traceType);
@@ -7689,6 +7714,12 @@ ViStatus _VI_FUNC rsspecan_LinkAllMarkers (ViSession instrumentHandle,
 ViStatus _VI_FUNC rsspecan_QueryMarker (ViSession instrumentHandle, ViInt32 window,
                                         ViInt32 marker, ViReal64* markerPosition,
                                         ViReal64* markerAmplitude);
+ViStatus _VI_FUNC rsspecan_QueryAllMarkers (ViSession instrumentHandle, ViInt32 window,
+                                            ViInt32 arraySize, ViInt32 markerNumbers[],
+                                            ViBoolean deltaMarkers[],
+                                            ViReal64 markerPositions[],
+                                            ViReal64 markerAmplitudes[],
+                                            ViInt32* markersCount);
 ViStatus _VI_FUNC rsspecan_ConfigureMarkerStepSize (ViSession instrumentHandle,
                                                     ViInt32 window,
                                                     ViInt32 stepSize);
@@ -8356,6 +8387,64 @@ ViStatus _VI_FUNC rsspecan_FetchYTrace (ViSession instrumentHandle, ViInt32 wind
                                         ViInt32 trace, ViInt32 arrayLength,
                                         ViInt32* actualPoints,
                                         ViReal64 _VI_FAR amplitude[]);
+ViStatus _VI_FUNC rsspecan_TraceAccumulatorInit (RsCoreTraceAccumulator* accumulator,
+                                                 ViInt32 points, ViInt32 statistics);
+ViStatus _VI_FUNC rsspecan_FetchYTraceAccumulate (ViSession instrumentHandle,
+                                                  ViInt32 window, ViInt32 trace,
+                                                  RsCoreTraceAccumulator* accumulator);
+ViStatus _VI_FUNC rsspecan_ReadYTraceAccumulate (ViSession instrumentHandle,
+                                                 ViInt32 window, ViInt32 trace,
+                                                 ViUInt32 maximumTime_ms,
+                                                 RsCoreTraceAccumulator* accumulator);
+ViStatus _VI_FUNC rsspecan_TraceAccumulatorGet (RsCoreTraceAccumulator* accumulator,
+                                                ViInt32 statistic, ViInt32 arraySize,
+                                                ViReal64 _VI_FAR result[]);
+ViStatus _VI_FUNC rsspecan_TraceAccumulatorReset (RsCoreTraceAccumulator* accumulator);
+ViStatus _VI_FUNC rsspecan_TraceAccumulatorDispose (RsCoreTraceAccumulator* accumulator);
+ViStatus _VI_FUNC rsspecan_TraceFindPeaks (ViReal64 x[], ViReal64 y[],
+                                           ViInt32 points, ViReal64 threshold,
+                                           ViReal64 excursion, ViInt32 sortOrder,
+                                           ViInt32 maxPeaks, ViInt32* peaksFound,
+                                           ViInt32 peakIndexes[], ViReal64 peakX[],
+                                           ViReal64 peakY[]);
+ViStatus _VI_FUNC rsspecan_TraceNdBBandwidth (ViReal64 x[], ViReal64 y[],
+                                              ViInt32 points, ViInt32 peakIndex,
+                                              ViReal64 ndB, ViReal64* lowerX,
+                                              ViReal64* upperX, ViReal64* bandwidth);
+ViStatus _VI_FUNC rsspecan_TraceMarkersAt (ViReal64 x[], ViReal64 y[],
+                                           ViInt32 points, ViInt32 markersCount,
+                                           ViReal64 markerX[], ViReal64 markerY[]);
+ViStatus _VI_FUNC rsspecan_TraceLimitCheck (ViReal64 x[], ViReal64 y[],
+                                            ViInt32 points, ViReal64 xReference,
+                                            ViReal64 yReference, ViInt32 linesCount,
+                                            RsCoreLimitLine lines[],
+                                            RsCoreLimitResult results[],
+                                            ViInt32* worstLine, ViReal64* worstMargin,
+                                            ViReal64* worstX);
+ViStatus _VI_FUNC rsspecan_TraceArchiveOpen (ViString fileName, ViInt32 points,
+                                             ViInt32 capacity,
+                                             RsCoreTraceArchive* archive);
+ViStatus _VI_FUNC rsspecan_FetchYTraceToArchive (ViSession instrumentHandle,
+                                                 ViInt32 window, ViInt32 trace,
+                                                 RsCoreTraceArchive* archive);
+ViStatus _VI_FUNC rsspecan_TraceArchiveRange (RsCoreTraceArchive* archive,
+                                              ViInt64* firstSequence,
+                                              ViInt64* tracesCount);
+ViStatus _VI_FUNC rsspecan_TraceArchiveFind (RsCoreTraceArchive* archive,
+                                             ViReal64 timestamp, ViInt64* sequence);
+ViStatus _VI_FUNC rsspecan_TraceArchiveRead (RsCoreTraceArchive* archive,
+                                             ViInt64 sequence, ViInt32 arrayLength,
+                                             ViReal64 _VI_FAR amplitude[],
+                                             ViInt32* actualPoints, ViReal64* timestamp,
+                                             ViInt32* sweepNumber);
+ViStatus _VI_FUNC rsspecan_TraceArchiveClose (RsCoreTraceArchive* archive);
+ViStatus _VI_FUNC rsspecan_FetchYTraceDecimated (ViSession instrumentHandle,
+                                                 ViInt32 window, ViInt32 trace,
+                                                 RsCoreDecimation* decimation,
+                                                 ViInt32 arrayLength, ViInt32* actualPoints,
+                                                 ViReal64 _VI_FAR amplitude[]);
+ViStatus _VI_FUNC rsspecan_TraceDecimate (ViReal64 y[], ViInt32 points,
+                                          RsCoreDecimation* decimation);
 ViStatus _VI_FUNC rsspecan_ReadYTracePrevious (ViSession instrumentHandle,
                                                ViInt32 window, ViInt32 trace,
                                                ViInt32 offsetSweepPoint,
@@ -8396,6 +8485,14 @@ ViStatus _VI_FUNC rsspecan_GetLimitCheckResult (ViSession instrumentHandle,
                                                 ViInt32* state);
 ViStatus _VI_FUNC rsspecan_Initiate (ViSession instrumentHandle, ViInt32 window,
                                      ViUInt32 timeout);
+ViStatus _VI_FUNC rsspecan_InitiateAsync (ViSession instrumentHandle,
+                                          ViInt32 window, ViUInt32 timeout,
+                                          RsCoreOpcHandle* measHandle);
+ViStatus _VI_FUNC rsspecan_WaitForMeasurements (RsCoreOpcHandle measHandles[],
+                                                ViInt32 handlesCount,
+                                                ViInt32 waitMode,
+                                                ViUInt32 timeout,
+                                                ViInt32* completedIndex);
 ViStatus _VI_FUNC rsspecan_InitiateSpurious (ViSession instrumentHandle,
                                              ViInt32 window, ViUInt32 timeout);
 ViStatus _VI_FUNC rsspecan_InitiateSEMMeasurement (ViSession instrumentHandle,
@@ -8497,6 +8594,19 @@ ViStatus _VI_FUNC rsspecan_QueryListPowerResult (ViSession instrumentHandle,
                                                  ViInt32 noOfResults,
                                                  ViReal64 _VI_FAR listPowerResults[],
                                                  ViInt32* returnedValues);
+ViStatus _VI_FUNC rsspecan_MeasureListPowerPlanned (ViSession instrumentHandle,
+                                                    ViInt32 window,
+                                                    ViInt32 requestsCount,
+                                                    ViReal64 _VI_FAR frequency[],
+                                                    ViReal64 _VI_FAR resolutionBandwidth[],
+                                                    ViReal64 _VI_FAR referenceLevel[],
+                                                    ViReal64 _VI_FAR RFInputAttenuation[],
+                                                    ViInt32 detector,
+                                                    ViReal64 measTime,
+                                                    ViUInt32 timeout,
+                                                    ViReal64 _VI_FAR results[],
+                                                    ViInt32* sequencesCount,
+                                                    ViInt32* sweepsCount);
 ViStatus _VI_FUNC rsspecan_ConfigureTimeDomainPowerMeasurementState
              (ViSession instrumentHandle, ViInt32 window, ViBoolean state);
 ViStatus _VI_FUNC rsspecan_ConfigureTimeDomainPowerMeasurement
@@ -13313,6 +13423,18 @@ ViStatus _VI_FUNC rsspecan_ClearStatus (ViSession Instrument_Handle);
 ViStatus _VI_FUNC rsspecan_ConfigureAutoSystemErrQuery(ViSession instrSession, ViBoolean autoSystErrQuery);
 ViStatus _VI_FUNC rsspecan_GetVISATimeout(ViSession instrSession, ViUInt32* VISATimeout);
 ViStatus _VI_FUNC rsspecan_SetVISATimeout(ViSession instrSession, ViUInt32 VISATimeout);
+ViStatus _VI_FUNC rsspecan_DumpIoTrace(ViSession instrSession, ViString fileName);
+ViStatus _VI_FUNC rsspecan_GetFunctionLatency(ViSession instrSession, ViString functionName, ViInt32 component, RsCoreLatencyStats* stats);
+ViStatus _VI_FUNC rsspecan_DumpFunctionLatency(ViSession instrSession, ViString fileName);
+ViStatus _VI_FUNC rsspecan_ResetFunctionLatency(ViSession instrSession);
+ViStatus _VI_FUNC rsspecan_ConfigureRoundTripDiagnostics(ViSession instrSession, ViBoolean state);
+ViStatus _VI_FUNC rsspecan_GetRoundTripStats(ViSession instrSession, ViString functionName, RsCoreRoundTripStats* stats);
+ViStatus _VI_FUNC rsspecan_DumpRoundTripReport(ViSession instrSession, ViString fileName);
+ViStatus _VI_FUNC rsspecan_ClearSessionPool(void);
+ViStatus _VI_FUNC rsspecan_InitMultiple(ViInt32 count, ViRsrc resourceNames[], ViBoolean IDQuery, ViBoolean resetDevice,
+                                        ViString optionString, ViSession instrSessions[], ViStatus statuses[]);
+ViStatus _VI_FUNC rsspecan_ConfigureTraceCache(ViSession instrSession, ViBoolean state);
+ViStatus _VI_FUNC rsspecan_InvalidateTraceCache(ViSession instrSession);
 /****************************************************************************
  *---------------------------- End Include File ----------------------------*
  ****************************************************************************/
@@ -0,0 +1,2657 @@
+/****************************************************************************
+ *
+ *  Rohde & Schwarz Spectrum Analyzer instrument driver C++17 facade
+ *
+ *  Header-only. The attribute IDs are bound to their C types at compile
+ *  time, each access calls the matching rsspecan_Set/GetAttributeVi<type>
+ *  directly, so the core never converts the value to the declared type.
+ *  Errors are reported as rsspecan::Error exceptions.
+ *
+ ****************************************************************************/
+
+#ifndef __RSSPECAN_HPP_HEADER
+#define __RSSPECAN_HPP_HEADER
+
+#include "rsspecan.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rsspecan
+{
+
+/*****************************************************************************
+ *- Errors ------------------------------------------------------------------*
+ *****************************************************************************/
+
+// Failed driver call. what() is the error description of the session
+class Error : public std::runtime_error
+{
+public:
+	Error(ViStatus status, const std::string& description)
+		: std::runtime_error(description), status_(status)
+	{
+	}
+
+	ViStatus status() const noexcept { return status_; }
+
+private:
+	ViStatus status_;
+};
+
+namespace detail
+{
+	inline void check(ViSession instrSession, ViStatus status)
+	{
+		if (status >= VI_SUCCESS)
+			return;
+
+		ViStatus code = status;
+		ViChar description[RS_MAX_MESSAGE_BUF_SIZE] = "";
+		(void)rsspecan_GetError(instrSession, &code, RS_MAX_MESSAGE_BUF_SIZE, description);
+		throw Error(status, description);
+	}
+
+	// The C API takes the input strings as ViString
+	inline ViString cstr(const char* string) noexcept
+	{
+		return const_cast<ViString>(string);
+	}
+}
+
+/*****************************************************************************
+ *- Span --------------------------------------------------------------------*
+ *****************************************************************************/
+
+// Non-owning view of a caller's buffer, the arrays are read directly into it
+template <typename T>
+class Span
+{
+public:
+	constexpr Span() noexcept : data_(nullptr), size_(0) {}
+	constexpr Span(T* data, std::size_t size) noexcept : data_(data), size_(size) {}
+	template <std::size_t N>
+	constexpr Span(T (&array)[N]) noexcept : data_(array), size_(N) {}
+	Span(std::vector<typename std::remove_const<T>::type>& vector) noexcept : data_(vector.data()), size_(vector.size()) {}
+
+	constexpr T* data() const noexcept { return data_; }
+	constexpr std::size_t size() const noexcept { return size_; }
+	constexpr bool empty() const noexcept { return size_ == 0; }
+	constexpr T* begin() const noexcept { return data_; }
+	constexpr T* end() const noexcept { return data_ + size_; }
+	constexpr T& operator[](std::size_t index) const noexcept { return data_[index]; }
+	constexpr Span first(std::size_t count) const noexcept { return Span(data_, count < size_ ? count : size_); }
+
+private:
+	T* data_;
+	std::size_t size_;
+};
+
+/*****************************************************************************
+ *- Attribute types ---------------------------------------------------------*
+ *****************************************************************************/
+
+// C type of each attribute. Attributes without the binding do not compile
+template <ViAttr Id>
+struct AttributeType;
+
+/*****************************************************************************
+ *- Attribute type bindings -------------------------------------------------*
+ *****************************************************************************/
+
+#define RSSPECAN_BIND_ATTRIBUTE(attributeId, cType) \
+	template <> struct AttributeType<(attributeId)> { using type = cType; };
+
+/* BEGIN GENERATE */
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_RANGE_CHECK, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_INSTRUMENT_STATUS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CACHE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SIMULATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_RECORD_COERCIONS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INTERCHANGE_CHECK, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPY, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_USE_SPECIFIC_SIMULATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CLASS_DRIVER_DESCRIPTION, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CLASS_DRIVER_PREFIX, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CLASS_DRIVER_VENDOR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CLASS_DRIVER_REVISION, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CLASS_DRIVER_CLASS_SPEC_MAJOR_VERSION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CLASS_DRIVER_CLASS_SPEC_MINOR_VERSION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPECIFIC_DRIVER_DESCRIPTION, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPECIFIC_DRIVER_PREFIX, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPECIFIC_DRIVER_LOCATOR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPECIFIC_DRIVER_VENDOR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPECIFIC_DRIVER_REVISION, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPECIFIC_DRIVER_CLASS_SPEC_MAJOR_VERSION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPECIFIC_DRIVER_CLASS_SPEC_MINOR_VERSION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SUPPORTED_INSTRUMENT_MODELS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GROUP_CAPABILITIES, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FUNCTION_CAPABILITIES, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CHANNEL_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DRIVER_SETUP, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INSTRUMENT_MANUFACTURER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INSTRUMENT_MODEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INSTRUMENT_FIRMWARE_REVISION, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IO_RESOURCE_DESCRIPTOR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPLITUDE_UNITS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ATTENUATION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ATTENUATION_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ATTENUATION_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_STOP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_CENTER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_CENTER_STEP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_STEP_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_CENTER_LINK, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_CENTER_LINK_FACTOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_SPAN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_SPAN_FULL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INPUT_IMPEDANCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NUMBER_OF_SWEEPS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_LEVEL_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_RESOLUTION_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_RESOLUTION_BANDWIDTH_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_RESOLUTION_BANDWIDTH_RATIO, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SWEEP_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SWEEP_MODE_CONTINUOUS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SWEEP_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SWEEP_TIME_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SWEEP_POINTS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SWEEP_OPTIMIZATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SWEEP_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SWEEP_COUNT_CURRENT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VERTICAL_SCALE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_FILTER_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PARAMETER_COUPLING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CORR_YIG, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_Y_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HORIZONTAL_SCALE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IF_OUTPUT_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IF_OUTPUT_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_SOURCE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SAN_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GET_INSTR_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PRESET_MEASUREMENT_CHANNEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SELECT_MEASUREMENT_CHANNEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DUPLICATE_MEASUREMENT_CHANNEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DELETE_MEASUREMENT_CHANNEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_ABORT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INIT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INIT_CONMEAS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INIT_SW_TRIGGER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INIT_SPURIOUS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INIT_SEM_MEAS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_UPDATE_IQ_RESULTS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INIT_SEQUENCER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ABORT_SEQUENCER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFRESH_SEQUENCER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEQUENCER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEQUENCER_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVG_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVG_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVG_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_RESOLUTION_BANDWIDTH_FILTER_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VIDEO_BANDWIDTH_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PLL_BANDWIDTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TFAC_GEN_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TFAC_SEL_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TFAC_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TFAC_SCALING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TFAC_COMMENT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TFAC_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TFAC_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TFAC_DISPLAY, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TFAC_ADJ_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TFAC_ACT_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TSET_SELECT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TSET_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TSET_COMMENT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TSET_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TSET_BREAK, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TSET_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TSET_ACTIVE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CVL_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CVL_MIXER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CVL_MIXER_SNUM, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CVL_BAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CVL_HARM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CVL_PORT_MIXER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CVL_BIAS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CVL_COMMENT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CVL_CLEAR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRACE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRACE_RESET_BEHAVIOR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRACE_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRACE_MATH_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRACE_MATH_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRACE_MATH_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DETECTOR_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DETECTOR_TYPE_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISPLAY_TRACE_CLEAR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRACE_EXPORT_ALL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CALIBRATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CALIBRATION_ABORT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CALIBRATION_RESULT_QUERY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CALIBRATION_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_DATA_SELECT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_DC_VOLTAGE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_PULSE_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_ADJUST_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_CHECK, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_MAN_COMPENSATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_FREQ_RESP_COMPENSATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_GAIN_ERROR_COMPENSATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CAL_PROBE_START, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PROBE_ACTIVATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PROBE_CONNECTOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PROBE_MICRO_BUTTON_ACTION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PROBE_CONNECTION_STATE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PROBE_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PROBE_NUMBER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PROBE_TYPE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INP_UPORT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_INP_UPORT_VALUE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_OUT_UPORT_VALUE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AUTO_ADJUST_ALL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AUTO_ADJUST_FREQ, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AUTO_ADJUST_LEVEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AUTO_ADJUST_LEVEL_MEAS_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AUTO_ADJUST_LEVEL_MEAS_TIME_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AUTO_ADJUST_HYSTERSIS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AUTO_ADJUST_TRIGGER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AUTO_SCALE_SINGLE_SCREEN, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AUTO_SCALE_ALL_SCREENS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_AMPLITUDE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_ENABLED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_TRACE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ASSIGN_MARKER_TO_TRACE_RAISING_FALLING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_AOFF, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_LOEX, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SIGNAL_TRACK_ENABLED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SIGNAL_TRACK_BWID, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SIGNAL_TRACK_THRESHOLD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SIGNAL_TRACK_TRACE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_STEP_SIZE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PROBABILITY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_MIN_RIGHT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_MIN_LEFT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_PEAK, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_PEAK_NEXT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_PEAK_RIGHT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_PEAK_LEFT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_MIN, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_MIN_NEXT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_PEAK_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_MIN_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_THRESHOLD_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_THRESHOLD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PEAK_EXCURSION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_LIMITS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_LIMITS_LEFT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_LIMITS_RIGHT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_LIMITS_ZOOM, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_FOUND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_SORT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_SIZE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_ZOOM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_DEMOD_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_DEMOD_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_DEMOD_HOLDOFF, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_DEMOD_CONT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_DEMOD_SQUELCH_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_DEMOD_SQUELCH_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_ANNOTATION_LABEL, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_ANNOTATION_MARKER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_ANNOTATION_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_TO_CENTER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_TO_STEP, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_TO_REFERENCE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_LINK, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_LINK_TO_MARKER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_LINK_ALL_MARKERS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_REF_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_REF_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_REF_LEVEL_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_REF_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_REF_PEAK, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_STORE_PEAK_LIST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_FILE_EXPORT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_PEAK_LABELS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_PEAK_LIST_MAXIMUM_PEAKS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_BAND_POWER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_BAND_POWER_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_BAND_POWER_SPAN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_MARKER_BAND_POWER_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DELTA_MARKER_BAND_POWER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DELTA_MARKER_BAND_POWER_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DELTA_MARKER_BAND_POWER_SPAN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_DELTA_MARKER_BAND_POWER_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_REL_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_AMPLITUDE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_TRACE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DELTA_MARKER_REFERENCE_MARKER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DELTA_MARKER_LINK_TO_MARKER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_AOFF, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_PEAK, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_PEAK_NEXT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_PEAK_NEXT_RIGHT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_PEAK_NEXT_LEFT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_MIN, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_MIN_NEXT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_MIN_NEXT_RIGHT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_MIN_NEXT_LEFT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_Y_TRIGGER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SYST_ERR_LIST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SYST_ERR_CLEAR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SYST_PRESET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PRESET_OPERATING_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SYST_SPEAKER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SYST_VERSION, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_APPLICATIONS_VERSIONS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SYST_ID_FACTORY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SYST_ID_FACTORY_QUERY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_APPL_SETUP_REC, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IF_SHIFT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IF_SHIFT_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REMOTE_LOGGING_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SYSTEM_SHUTDOWN, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LOCK_LOCAL_KEY, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FRONTEND_TEMPERATURE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ROSC_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ROSC_SOURCE_EAUTO, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ROSC_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ROSC_PLL_BWID, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_DELAY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_SLOPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_IQP_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_RFP_HOLDOFF, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_DIRECTION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_OUTPUT_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_PULSE_GENERATE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_TRIGGER_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_TRIGGER_DELAY_COMPENSATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE_HOLD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE_TRIGGER_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE_POLARITY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE_LENGTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE_SIGNAL_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE_TRACE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE_TRACE_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE_TRACE_STOP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE_TRACE_PERIOD_LENGTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_GATE_TRACE_COMMENT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VIDEO_TRIGGER_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_IFP_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_IFP_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_IFP_HYSTERESIS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_TIME_INTERVAL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_WINDOW, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_TRIGGER_SOURCE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_TRIGGER_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_TRIGGER_COMMENT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_TRIGGER_DIRECTORY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_TRIGGER_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_TRIGG_CONDITION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_TRIGGER_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_UPP_AUTO, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_LOWER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_UPPER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_SHIFT_LOW_X, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_SHIFT_LOW_Y, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_SHIFT_UPP_X, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_SHIFT_UPP_Y, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FREQUENCY_MASK_SPAN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_SIGNAL_ID_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_CONVERSION_LOSS_LOW, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_LO_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_ENABLED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_HARMONIC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_NUMBER_OF_PORTS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_HARMONIC_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_HARMONIC_BAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_CONVERSION_LOSS_HIGH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_CONVERSION_LOSS_TABLE_HIGH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_CONVERSION_LOSS_TABLE_LOW, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_BIAS_LOW, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_BIAS_HIGH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_THRESHOLD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GET_EXTERNAL_MIXER_RF_FREQUENCY_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GET_EXTERNAL_MIXER_RF_FREQUENCY_STOP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_HANDOVER_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_RF_OVERRANGE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_PRESET_BAND, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_HIGH_HARMONIC_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXTERNAL_MIXER_HIGH_HARMONIC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPL_RF_COUPLING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPL_EATT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPL_EATT_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPL_EATT_VALUE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPL_MIXER_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPL_MIXER_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_INP_PRES_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPL_PREAMPLIFIER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPL_PREAMPLIFIER_LEVEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPL_PROTECTION_RESET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AMPL_YIG_FILTER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LIMIT_LINE_ACTIVE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_THRLINE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_THRLINE_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DLINE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DLINE_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FLINE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FLINE_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TLINE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TLINE_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_REF_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_REF_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_FP_KEYS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SELECT_WINDOW, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_FREQ_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_LOGO_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_TIME_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_COMMENT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_COMMENT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_PWR_SAVE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_PWR_SAVE_HOLDOFF, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_WINDOW_SIZE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_COL_PRESET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_COL_PREDEFINED, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_LOG_RANGE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_AMPLITUDE_GRID_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_SINGLE_SWEEP, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_UPDATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_ACTIVE_WINDOW, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_SELECT_SUBWINDOW, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISPLAY_FOCUS_AREA, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_UNIT_POWER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_REF_VALUE_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_TRACE_Y_AUTO, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_Y_AXIS_SCALING, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_STATUS_BAR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_SOFTKEY_BAR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_TOOL_BAR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_TOUCHSCREEN_STATE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_SELECT_THEME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_MARKER_TABLE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISPLAY_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISPLAY_ZOOM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DISP_MEAS_WINDOW_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LAYOUT_WINDOW_REMOVE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LAYOUT_WINDOW_LIST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LAYOUT_QUERY_WINDOW_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_ACTIVE_MEASUREMENT_WINDOW, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_ABORT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_COLOR_DEF, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_COLOR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_PRINT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_PRINT_NEXT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_DEVICE_DESTINATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_COLOR_PREDEFINED, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_DEVICE_LANG_OUT_FORM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_PRINT_SCREEN, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_PRINT_TAB, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_COMM_SCR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_PRINT_TRACE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_DEVICE_ORIENTATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_FILE_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_PRINTER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_PRINTER_NEXT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_PRINTER_FIRST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_HCOPY_TIME_DATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_RECALL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_STARTUP_RECALL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_SAVE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_SAVE_NEXT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_DATA_CLEAR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_DATA_CLEAR_ALL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_EDIT_COMM, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_DEC_SEPARATOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_MANAGER_EDIT_PATH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_MANAGER_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_MANAGER_FORMAT_DISK, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_MANAGER_MAKE_DIR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_MANAGER_EDIT_PATH_DEVICE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_MANAGER_DELETE_DIR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_MANAGER_DELETE_IMMEDIATE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_SEL_SOURCE_CAL_DATA, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_SEL_TRAN, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_SEL_HWSETTINGS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_SEL_TRAC, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_SEL_LINE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_ALL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_NONE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_DEFAULT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_INCLUDE_IQ_DATA, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_CHANNEL_NONE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_CHANNEL_DEFAULT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_CHANNEL_ALL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_CHANNEL_SEL_HWSETTINGS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_CHANNEL_SEL_TRAC, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_CHANNEL_SEL_LINE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_CHANNEL_SEL_TRAN, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_CHANNEL_SPEM, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DATA_SET_LOAD_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DATA_SET_STORE_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NETWORK_DISCONNECT_DRIVE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_UNUSED_NETWORK_DRIVES, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_USED_NETWORK_DRIVES, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SHOW_NETWORK_FOLDER_INFO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_INPUT_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_INPUT_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_INPUT_PULSED_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_INPUT_PULSED_RATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_INPUT_RECTANGLE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_INPUT_RECTANGLE_RATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_INPUT_COMB_FREQUENCY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_BASEBAND_SIGNAL_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_NOISE_SOURCE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_DC_CAL_VOLTAGE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_PULSE_CAL_DESTINATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_PULSE_CAL_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_PULSE_CAL_FREQ_FSV, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SERVICE_HW_INFO, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_NOISE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_NOISE_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_PNO_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_PNO_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REFERENCE_MARKER_PNO_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_FREQUENCY_COUNTER_ENABLED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_FREQUENCY_COUNTER_RESOLUTION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_COUNT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_NDB_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_NDB_VAL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_NDB_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_NDB_Q_FACTOR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LIST_POW_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LIST_POW_STATE_OFF, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_PEAK, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_RMS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_MEAN, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_SDEV, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_AVG, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_MAX_HOLD, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_AOFF, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_SET_REFERENCE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_PEAK_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_RMS_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_MEAN_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_SDEV_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_AVG_PEAK_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_AVG_RMS_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_AVG_MEAN_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_AVG_SDEV_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_PEAK_HOLD_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_PEAK_HOLD_RMS_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_PEAK_HOLD_MEAN_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TDOM_PEAK_HOLD_SDEV_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_SELECT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_OFF, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_ADJ_NUM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_ADJ_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_RESULT_MODE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_CHANNEL_SPACING, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_ADJ_CHANNEL_SPACING, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_ALT_CHANNEL_SPACING, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_CHANNEL_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_ADJ_CHANNEL_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_ALT_CHANNEL_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_NOISE_CORR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_NOISE_CORR_AUTO, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_TRACE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_STANDARD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_REF_VALUE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_ADJ_PRESET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_ACP_HSP, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_ACP_PRESET_REF_LEVEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_ACP_PRESET_REF_LEVEL_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_ACP_PRESET_REF_LEVEL_ADJ, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_ACP_LIMIT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_ACP_LIMIT_REL_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_ACP_LIMIT_ABS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_ACP_ALT_LIMIT_REL_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_ACP_ALT_LIMIT_ABS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_CARR_SIG_NUM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_REF_CHAN_SEL_AUTO, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_ADJ_REF_TXCHANNEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_POW_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_NUMBER_OF_SUBBLOCKS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_SUBBLOCK_CENTER_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_SUBBLOCK_RF_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_SUBBLOCK_TX_CHANNEL_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_TX_CENTER_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_TX_TECHNOLOGY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_TX_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_TX_WEIGHTING_FILTER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_TX_WEIGHTING_FILTER_ROLL_OFF_FACTOR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_TX_CHANNEL_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_GAP_CHANNEL_SPACING, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_GAP_CHANNEL_BANDWIDTHS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_GAP_WEIGHTING_FILTER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_GAP_WEIGHTING_FILTER_ROLL_OFF_FACTOR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_GAP_LIMIT_RELATIVE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSR_GAP_LIMIT_ABSOLUTE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_APD_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_CCDF_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_SAMPLES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_X_REF, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_X_RANGE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_Y_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_Y_MIN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_Y_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_MEAN_POWER_POS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_ADJ, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_REF_LEVEL_ADJUST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_STAT_PRESET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_STAT_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_MDEPTH_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_MDEPTH_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_MDEPTH_SEARCH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TOI_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TOI_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TOI_SEARCH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_TOI_POSITIONING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_HDIST_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_HDIST_NOOFHARM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_HDIST_RBWAUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MEAS_HDIST_PRESET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MPOW_MIN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MPOW_FTYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_PEAK_SEARCH_MARGIN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_PEAK_SEARCH_PEAKS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_STOP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_FILT_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_BAND, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_BAND_VID, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_SWE_TIME_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_SWE_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_DET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_RLEV, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_INP_ATT_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_INP_ATT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_POINTS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_BREAK, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_TRAN, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_INP_GAIN_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_INP_GAIN_LEVEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_DEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_PEAK_SEARCH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_STORE_FILE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_LIMIT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_LIMIT_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_LIMIT_STOP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_RANG_LIMIT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_LIST_EVAL_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_STANDARD_SAVE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_STANDARD_LOAD, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SE_STANDARD_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_ANALYZER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_SAMPLE_RATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_MAX_BANDWIDTH_EXTENSION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_RECORD_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_EXT_BAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_START_SYNCHRONIZATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_WBAND_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_AVER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_AVER_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_GATE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_GATE_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_GATE_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_GATE_GAP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_GATE_NUMBER_OF_PERIODS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_DISPLAY_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_FILTER_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LOAD_IQ_DATA, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SAVE_IQ_DATA, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IQ_DATA_EXPORT_FILE_DESCRIPTION, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_TPIS_TIME_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ESP_RESTORE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ESP_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ESP_PEAK_SEARCH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ESP_MAN_VAL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ESP_QUERY_X, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ESP_TRAN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LIM_STORE_FILE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_PEAK_SEARCH_MARGIN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_PEAK_SEARCH_PEAKS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_LIST_EVAL_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_MARK_ALL_PEAKS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_POWER_REF_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RRC_FILTER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RRC_FILTER_ALPHA_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_REF_RANGE_POSITION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_MSR_BAND_CATEGORY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_MSR_RF_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_MSR_GSM_PRESENT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_MSR_LTE_PRESENT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_MSR_APPLY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_FAST_SEM, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_PRESET_STANDARD, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_PRESET_STANDARD_SAVE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_PRESET_STANDARD_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RESTORE_STANDARD, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_STORE_PRESET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_LIST_FILE_EXPORT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_VBW, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_FREQ_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_FREQ_STOP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_START_FREQ_ABS_LIMIT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_STOP_FREQ_ABS_LIMIT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_START_FREQ_REL_LIMIT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_STOP_FREQ_REL_LIMIT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_START_FREQ_REL_LIMIT_FUNCTION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_START_FREQ_REL_LIMIT_MAXIMUM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_STOP_FREQ_REL_LIMIT_FUNCTION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_STOP_FREQ_REL_LIMIT_MAXIMUM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_LIMIT_CHECK_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_FILTER_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_INPUT_ATTENUATION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_INPUT_ATTENUATION_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_PREAMPLIFIER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_PREAMPLIFIER_LEVEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_REF_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_SWEEP_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_SWEEP_TIME_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_TRANSDUCER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_RANGE_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_INSERT_NEW_RANGE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_DELETE_RANGE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_POWER_CLASS_USED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_POWER_CLASS_LOWER_LEVEL_LIMIT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_POWER_CLASS_UPPER_LEVEL_LIMIT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_POWER_CLASS_LIMIT_STATE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SEM_POWER_CLASS_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_RFP_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_SOURCE_TVRF, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_TV_VID_CONT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_TV_VERTICAL_SIGNAL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_TV_LINE_SYSTEM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_TV_HORIZONTAL_SIGNAL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_TV_VIDEO_POLARITY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TRIGGER_POSITION_IN_SAMPLE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSRA_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSRA_REFRESH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSRA_CAPTURE_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSRA_SHOW_ANALYSIS_LINE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSRA_ANALYSIS_LINE_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MSRA_DATA_EVALUATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_NORMALIZATION_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_METHOD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_ACQUIRE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_RECALL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_POW_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_INTF_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_POW_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_POW_STOP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_OUTPUT_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_OUTPUT_FREQUENCY_COUPLING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_DENOMINATOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_NUMERATOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_FREQ_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_FREQ_SWEEP_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_OUTPUT_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_ROSC_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_TYPE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EXT_GEN_IEEE_ADDR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CORR_EGA_INP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_DM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_FM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_FM_DEVIATION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_FREQUENCY_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_OUTPUT_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_LEVEL_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TGEN_AM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FM_LPAS_MAN, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FM_SPAN_MAN, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FM_LPAS_FILTER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FM_HPAS_FILTER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FM_SPAN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_INPUT_SELECTION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_SIGNAL_CALIBRATION_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_SIGNAL_CALIBRATION_OUTPUT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_INPUT_BALANCED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_INPUT_IMPEDANCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_INPUT_SIGNAL_PATH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_INPUT_IQ_DITH, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_INPUT_IQ_LPAS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_INPUT_MEAS_RANGE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_INPUT_TRIGGER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_INPUT_TRIGGER_I_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_INPUT_TRIGGER_Q_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_FULLSCALE_MODE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_FULLSCALE_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BB_SWAP_IQ, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_BAND_STEP_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_FORM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_PLINE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_PLINE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_CAPT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_CAPT_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_CAPT_CALC, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_PRESET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_WIN_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_CAL_SIG, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_CAL_DC, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_CAL_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_CAL_SIG_SOUR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_OFFS_PHAS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FFT_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DIGITAL_INPUT_RANGE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DIGITAL_INPUT_RANGE_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DIGITAL_INPUT_SRATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DIGITAL_INPUT_SAMPLE_RATE_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DIGITAL_BASEBAND_OUTPUT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DIGITAL_BASEBAND_FULL_SCALE_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DIGITAL_BASEBAND_INPUT_TRIGGER_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DIGITAL_BASEBAND_INPUT_TRIGGER_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DIGITAL_BASEBAND_INPUT_TRIGGER_HOLDOFF, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_DIGITAL_INPUT_COUPLING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_MTYP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_REST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_PRAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_SLOT_MULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_CHAN_TSC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_TSC_USER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_SSE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_BSE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_BSTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_BURS_PTEM_TMHR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_BURS_PTEM_FRZ, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_BURS_PTEM_FILT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_MCAR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_BURS_PTEM_SEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_SYNC_ADJ_EXT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_SYNC_ADJ_IFP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_SYNC_ADJ_RFP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_SYNC_ADJ_IMM, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_SYNC_IQPOWER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_SWIT_LIM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_MODULATION_SPECTRUM_LIST_AVER_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_LONG_SLOT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_TRIG_REFERENCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_MIDAMBLE_REFERENCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_STANDARD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_OFRAME, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_MODULATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_RLEV_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_RLEV_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_LIMIT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_ABS_LIMIT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_ABS_LIMIT_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_EXTENDED_SLOT_LIMIT_CLEV, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_PERR_RMS_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_PERR_RMS_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_PERR_PEAK_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_PERR_PEAK_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_FERR_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_FERR_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_IQOF_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_IQOF_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_IQIM_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_IQIM_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_RMS_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_RMS_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_PEAK_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_PEAK_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_OSUP_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_OSUP_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_PERC_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_PERC_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_FREQ_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_FREQ_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_IQOF_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_IQOF_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_IQIM_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_MACC_IQIM_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_PERR_RMS_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_PERR_RMS_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_PERR_PEAK_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_PERR_PEAK_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_FERR_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_FERR_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_IQOF_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_IQOF_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_IQIM_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_IQIM_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_RMS_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_RMS_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_PEAK_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_PEAK_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_OSUP_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_OSUP_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_PERC_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_PERC_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_FREQ_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_FREQ_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_IQOF_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_IQOF_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_IQIM_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_MACC_IQIM_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_PTEM_TRGS_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_FETC_BURST_PTEM_TRGS_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_PTEM_TRGS_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_READ_BURST_PTEM_TRGS_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SIGNAL_PERIOD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SIGNAL_DROOP_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SIGNAL_MODULATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SIGNAL_TIMING_AUTO_MODE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SIGNAL_TIMING_WIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SIGNAL_TIMING_OFF_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SIGNAL_OFFSET_AUTO_MODE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SIGNAL_OFFSET_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SIGNAL_CHIRP_RATE_AUTO_MODE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SIGNAL_CHIRP_RATE_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_INPUT_SIGNAL_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SELECT_IQ_DATA_FILE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_ACQUISITION_FILTER_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_ACQUISITION_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_DETECTION_REF_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_DETECTION_THRESHOLD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_DETECTION_HYSTERESIS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_DETECTION_LIMIT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_DETECTION_PULSE_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_REFERENCE_POINT_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_REFERENCE_POINT_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_REFERENCE_POINT_AVERAGING_WINDOW, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_REFERENCE_RANGE_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_REFERENCE_RANGE_LENGTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_REFERENCE_RANGE_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_TOP_LEVEL_POSITION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_TOP_LEVEL_ALGORITHM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_TOP_LEVEL_RIPPLE_PORTION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_REFERENCE_LEVEL_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_REFERENCE_LEVEL_THRESHOLD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_REFERENCE_LEVEL_BOUNDARY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_SELECTION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_AUTOMATIC_RANGE_SCALING_ONCE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_AUTOMATIC_RANGE_SCALING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_RANGE_REFERENCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_RANGE_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_RANGE_ALIGNMENT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_RANGE_LENGTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_PHASE_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_PARAMETER_DISTRIBUTION_BINS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_PARAMETER_TREND_POWER_Y_AXIS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_PARAMETER_TREND_POWER_X_AXIS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_PARAMETER_TREND_TIMING_Y_AXIS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_PARAMETER_TREND_TIMING_X_AXIS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_PARAMETER_TREND_FREQUENCY_Y_AXIS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_PARAMETER_TREND_FREQUENCY_X_AXIS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_PARAMETER_TREND_PHASE_Y_AXIS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_PARAMETER_TREND_PHASE_X_AXIS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_TABLE_PHASE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_RESULT_TABLE_POWER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_AUTO_GRID_SCALING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_ABSOLUTE_SCALING, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_REFERENCE_VALUE_MIN_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_PARAMETER_SPECTRUM_FREQUENCY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_PARAMETER_SPECTRUM_PHASE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_PARAMETER_SPECTRUM_POWER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PULSE_PARAMETER_SPECTRUM_TIMING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_TRIGGER_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_TRIGGER_AM_LEVEL_ABS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_TRIGGER_AM_LEVEL_REL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_TRIGGER_FM_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_TRIGGER_PM_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_SIGNAL_SEARCH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_AF_COUP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_MTIM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_BAND_DEM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_RLEN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_SRATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_ZOOM, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_ZOOM_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_ZOOM_LENGTH_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_ZOOM_LENGTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_SQUELCH, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_SQUELCH_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_PHASE_WRAP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_UNIT_ANGLE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_PM_RPO_X, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ANALOG_DEMOD_OUTPUT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ANALOG_DEMOD_OUTPUT_SELECTION, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ANALOG_DEMOD_OUTPUT_CUTOFF_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ANALOG_DEMOD_PHONE_OUTPUT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_UNIT_THD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_SELECT_TRACE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_PRESET_LOAD, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_PRESET_STORE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_PRESET_RESTORE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_AF_CENTER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_AF_SPAN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_AF_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_AF_STOP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_AF_FULL_SPAN, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_BAND_RES, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_SPEC_SPAN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_SPEC_ZOOM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_FILT_HPAS_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_FILT_HPAS_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_FILT_LPAS_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_FILT_LPAS_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_FILT_LPAS_FREQ_REL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_FILT_FREQ_MANUAL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_FILT_DEMP_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMDEM_FILT_DEMP_TCON, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_FILT_CCITT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_FILT_CCIR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ANALOG_DEMOD_FILTER_A_WEIGHTED_ENABLED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_SUMM_RES, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_ADEM_FM_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_TRIGGER_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_TRIGGER_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_PHASE_NOISE_MARKER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_DIFFERENCE_FREQUENCY_DISTORTION_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_DIFFERENCE_FREQUENCY_DISTORTION_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_INTERMODULATION_DISTORTION_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_INTERMODULATION_DISTORTION_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_SQUELCH_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_SQUELCH, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_AUTO_SCALE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_DISPLAY_CONFIG, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_REFERENCE_DEVIATION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_RESULT_SUMMARY_DETECTOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_RESULT_SUMMARY_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_RESULT_SUMMARY_COUPLED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_MEAS_TO_REF, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_HIGH_PASS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_HIGH_PASS_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_LOW_PASS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_LOW_PASS_FREQUENCY_ABSOLUTE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_LOW_PASS_FREQUENCY_RELATIVE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_CCITT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_CCIR_UNWEIGHTED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_CCIR_WEIGHTED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_A_WEIGHTED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_DEEMPHASIS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_DEEMPHASIS_TIME_CONSTANT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_FILTER_COUPLED, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_ALL_AF_FILTERS_OFF, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_RANGE_DEV_UNIT_ABSOLUTE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_AF_RANGE_DEV_UNIT_RELATIVE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_DIFFERENCE_FREQUENCY_DISTORTION_SEARCH_SIGNAL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FMS_INTERMODULATION_DISTORTION_SEARCH_SIGNAL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_FMS_CARRIER_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_FMS_PHASE_NOISE_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_FMS_CHANNEL_TYPE_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_PTYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_PRAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_PCL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_POW_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_FILT_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_TRAC_MOD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_TRAC, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_TRAC_DET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_SWE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_LAP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_CHANNEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_ACLR_ACP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_GEOG, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_EGA_INP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_PULS_OFFS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_SEARCH_PULS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_SYNC_OFFS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_SEARCH_SYNC, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_SEARCH_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_SEARCH_TIME_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_CFST_BLOCK_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_IBS_ACP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_IBS_GATE_AUTO, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_PBSC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_RTP_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_PDIV, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_ZOOM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_ZOOM_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_OPOW_PEAK, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_OPOW_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_STAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_ACLR_EXC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_MCH_DF_AVER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_MCH_DF_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_MCH_RAT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_MCH_DF2_PERC, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_ICFT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_CFDR_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_CFDR_RATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_PLEN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_PTYP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_CFST_DEVM_RMS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_CFST_DEVM_PEAK, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_CFST_DEVM_99PCT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_CFST_FERR_TOTAL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_CFST_FERR_BLOCK, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_CFST_FERR_INITIAL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_DPEN_PACKETS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_DPEN_PACKETS_PASSED, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_DPEN_BER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_IBS_EXC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_IBS_HADJ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_IBS_TXCHANNEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_RTP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BTO_RTP_RATIO, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_SELECT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_REL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_REL_AUTO, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PWM_RELATIVE_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_MEAS_TIME, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_COUPLING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_ZERO, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_UNIT_ABS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_UNIT_REL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_AVERAGE_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_AVERAGE_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_REF_LEVEL_OFFSET_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PWM_EXTERNAL_POWER_TRIGGER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PWR_EXTERNAL_POWER_TRIGGER_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PWM_EXTERNAL_POWER_TRIGGER_HYSTERESIS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PWM_EXTERNAL_POWER_TRIGGER_DROPOUT_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PWM_EXTERNAL_POWER_TRIGGER_HOLDOFF_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PWM_EXTERNAL_POWER_TRIGGER_SLOPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_DUTY_CYCLE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_DUTY_CYCLE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_AUTOMATIC_ASSIGNMENT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_NUMBER_OF_SENSORS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_BARGRAPH_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_RELATIVE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_READ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PMET_FETCH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MODE_FSV, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_DUT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_SIG_CHAR_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_SIG_CHAR_BAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_SIG_CHAR_BAND_ARFC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_AUTO_PWR_LEV, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_AUTO_PWR_LEV_ONCE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_LEVEL_SETTINGS_PWR_CLASS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_LEVEL_SETTINGS_POW_STAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_STATISTIC_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_TRIGGER_TO_SYNC_ACQUISITIONS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_CORRELATION_THRESHOLD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_SYNCHRONIZATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MEASURE_ONLY_ON_SYNC, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_CAP_SET_TRACK_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_IQ_SWAP, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MARKER_ZOOM_FACTOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_RESULT_DISPLAY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_AUTO_SET_LEVEL, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_AUTO_SET_LEVEL_ONCE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_AUTO_SET_FRAME, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_AUTO_SET_FRAME_ONCE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_AUTO_SET_TRIGGER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_AUTO_SET_TRIGGER_ONCE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_DEMOD_SINGLE_SLOT_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_DEM_MULTI_SLOT_MEAS_SLOT_NUM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_DEM_MULTI_SLOT_MEAS_FIRST_SLOT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_DEMODULATION_EQUAL_TIMESLOT_LENGTH, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_SLOT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_TYPE_BURST, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_PCL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_MOD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_FILTER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_TSC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_TSC_USER_VALUE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_TIMING_ADVANCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_SYNC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_SCPIR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_SUBCH_TSC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_BURST_SUBCH_TSC_USER_VALUE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_TRACE_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MEAS_BURST_TYPE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MEAS_SPECT_TYPE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MEASUREMENT_WIDE_SPECTRUM, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_WIDE_SPECTRUM_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MEASUREMENT_TRIGGER_TO_SYNC, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_TRIGGER_TO_SYNC_BINS_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_TRIGGER_TO_SYNC_ADAPTIVE_DATA_SIZE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_PWR_VS_TIME_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_POWER_VS_TIME_FILTER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_POWER_VS_TIME_ALIGNMENT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MODULATION_TRANSIENT_SPECTRUM_ENABLE_LEFT_LIMIT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MODULATION_TRANSIENT_SPECTRUM_ENABLE_RIGHT_LIMIT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MODULATION_TRANSIENT_SPECTRUM_FILTER_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MODULATION_TRANSIENT_SPECTRUM_REF_POWER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MODULATION_TRANSIENT_SPECTRUM_HIGH_DYNAMIC, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MODULATION_TRANSIENT_SPECTRUM_FREQUENCY_LIST, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_DEMODULATION_SYMBOL_DECISION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_DEMODULATION_TAIL_TSC_BITS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MULTI_MEAS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MULTI_MEAS_POWER_VS_TIME, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MULTI_MEAS_DEMODULATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MULTI_MEAS_CONSTELLATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MULTI_MEAS_MODULATION_SPECTRUM, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MULTI_MEAS_TRANSIENT_SPECTRUM, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MULTI_CARRIER_BTS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MULTI_CARRIER_NUMBER_OF_ACTIVE_CHANNELS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MULTI_CARRIER_BTS_CLASS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_MULTI_CARRIER_FILTER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_GSM_K10_REFRESH_CAPTURED_DATA, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_READ_GSM_K10_MEAS_RES, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_READ_GSM_K10_MEAS_RES_95_PERC, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FETCH_GSM_K10_MEAS_RES, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FETCH_GSM_K10_MEAS_RES_95_PERC, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_READ_GSM_K10_TRIGGER_TO_SYNC_RESULTS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FETCH_GSM_K10_TRIGGER_TO_SYNC_RESULTS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_READ_GSM_K10_BURST_SLOT_RES, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FETCH_GSM_K10_BURST_SLOT_RES, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_READ_GSM_K10_BURST_SLOT_DELTA_TO_SYNC, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FETCH_GSM_K10_BURST_SLOT_DELTA_TO_SYNC, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REALTIME_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_WINDOW, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_REALTIME_MEASUREMENT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_COLOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_SIZE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_SHAPE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_COLOR_STYLE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_COLOR_LOW, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_COLOR_UPPER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_COLOR_DEFAULT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_HDEP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_TIME_STAMP_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_FRAME_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_FRAME_SELECT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_CONTINUOUS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_CLEAR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_FFT_WINDOW, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_FILE_ITEMS_SAVE_RECAL_SPEM, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_CONTINUOUS_TRIGGER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_MARK_FRAME_NUMBER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_MARKER_SEARCH_AREA, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_MARKER_SEARCH_XY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_MARKER_SEARCH_Y, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_DELT_FRAME_NUMBER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_DELT_SEARCH_AREA, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_DELT_SEARCH_XY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_DELT_SEARCH_Y, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MARKER_SEARCH_Y_TRIGGER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_DURATION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_GRAN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_SHAPE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_TRUN, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_COLOR_STYLE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_COLOR_DEFAULT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_COLOR_LOWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_COLOR_UPPER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_TRACE_STYLE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_MAXH_TRACE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_MAXH_INTENS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_MAXH_RESET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_MARKER_POSITION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_PSPEM_MARKER_Z_AXIS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PSPEM_DELTA_MARKER_POSITION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_QUERY_PSPEM_DELTA_Z_AXIS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_RESULT_DISPLAY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_STORE_TO_FILE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_TIME_DOMAIN_TRIGGER, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_SPEM_TIME_DOMAIN_TRIGGER_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_DEMOD_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_DISTORTION_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_DDM_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_INPUT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_DEMOD_BWID_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_DEMOD_BWID, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_HARM_DIST_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_HARM_DIST_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_THD_FUND_FREQ, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_THD_MAX_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_RF_FREQ_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_CARR_OFFS_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_RF_LEVEL_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_DDM_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_FM_DEVIATION_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_FM_FREQ_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_PHASE_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_INPUT_LEVEL_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_SDM_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_AVI_SHD_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_VERTICAL_SCALE_MAX_MIN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_RESULT_PHASE_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_CARRIER_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_CARRIER_SPACING, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_MEASUREMENT_TIME_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_MEASUREMENT_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_MODE_ABS_REL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_CARRIER_OFFSET_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_CARRIER_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_INITIATE_CALIBRATION, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_CALIBRATION_STATUS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_STORE_CALIBRATION_DATA, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_LOAD_CALIBRATION_DATA, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_STORE_MEASUREMENT_RESULTS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_TRACE_POINTS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_RECORD_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MCGD_SAMPLE_RATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_Y_SCALE_AUTO, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_EPAT_ZOOM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_EPAT_ZOOM_FACTOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_MERR_ZOOM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_OVER_ZOOM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_QUAD_ZOOM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_CHANNEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_RF_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_RF_FREQUENCY_STEP_SIZE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_SWEEP_SPACING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_SIDE_BAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_MODUL_STANDARD, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_MODUL_STANDARD_GDELAY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_MODUL_STANDARD_SIG_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_MEAS_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_BWID, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_FREQ_NEXT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_NOISE_FLOOR_CORRECTION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_REF_CHANNEL_MANUAL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_REF_POWER_MANUAL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_REF_POWER_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_HUM_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_VCP_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_STANDARD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_SOUND_SYSTEM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_COLOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_TRIGGER_BAR_FIELD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_TRIGGER_BAR_LINE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_TRIGGER_BAR_LINE_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_TRIGGER_VIDEO_SCOPE_FIELD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_TRIGGER_VIDEO_SCOPE_LINE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_TRIGGER_QLINE_FIELD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_TRIGGER_QUIET_LINE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_LIM_FREQ_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_LIM_REL_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_LIM_VCF, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_LIM_VCP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_CN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_CSO, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_CTB, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_HUM_LOW, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_HUM_UPP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_VMOD_MDEP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_VMOD_RPC, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_VMOD_VCP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_LIM_FREQ_OFFSET_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_LIM_REL_POWER_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_LIM_VCF_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_LIM_VCP_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_CN_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_CSO_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_CTB_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_HUM_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_LIM_VMOD_MDEP_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_VCPA, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_VCF_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_REL_POWER_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CARR_FREQ_OFFSET_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CN_CN_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CSO_CSO_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_CTB_CTB_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_HUM_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_ATV_VMOD_RESULT_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_SATT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_EPAT_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_EPAT_RVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_ERROR_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_EQUALIZER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_EQUALIZER_FREEZE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_EQUALIZER_RESET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_FILTER_ALPHA, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_SRATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_STANDARD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_CARR_LIM_FREQ_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_CHANNEL_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_SUPP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_ERR_LOW, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_ERR_UPP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_IMB, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_PJIT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_QERR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_SYMB_RATE_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_CARR_LIM_FREQ_OFFSET_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_CHANNEL_POWER_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_CARR_LIM_CARR_SUPP_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_ERROR_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_IMB_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_PJIT_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_QERR_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_LIM_SYMB_RATE_OFFSET_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_SPEC, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_ERROR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_OVER_CARR_FREQ_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_OVER_SRATE_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_MERR_IMB, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_MERR_QERR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_MERR_CSUP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_MERR_PJIT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_DTV_CHANNEL_POWER_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_TV_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_TV_CHANNEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_TV_MOD_STANDARD_TILT_ACTIVATE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_CATV_TV_MOD_STANDARD_TILT_DEACTIVATE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CALC_LIM_TRAC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_SINGLE_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_SINGLE_FREQUENCY_COUPLING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_INP_GAIN_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_ENR_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_ENR_SPOT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_TEMP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_ENR_TABLE_SELECT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_ENR_TABLE_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_ENR_COMMON_MODE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_ENR_CALIBRATION_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_ENR_CALIBRATION_SPOT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_ENR_CALIBRATION_TABLE_SELECT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_LOSS_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_LOSS_SPOT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_LOSS_INPUT_TABLE_SELECT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_LOSS_INPUT_TABLE_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_LOSS_OUTPUT_TABLE_SELECT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_LOSS_OUTPUT_TABLE_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_EREJ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CORR_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_FREQ_STEP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_FREQ_FIXED, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CONF_SYST_LOSC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CONF_SYST_LOSC_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CONF_SYST_INT_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CONF_MODE_DUT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_EXT_FREQ_OFFS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_EXT_FREQ_NUM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_EXT_FREQ_DEN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_EXT_POW, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_GPIB_GEN_ADDR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_GEN_TYPE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CONF_GEN_CONT_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CONF_GEN_INIT_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CONF_GEN_AUTO_SWITCH_OFF, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CONF_DUT_GAIN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CONF_DUT_SETT_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_ARRAY_MEMORY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_INIT_GENERATOR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_ASSIGN_MARKER_TO_TRACE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_CALC_LIMIT_RESULT_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_MARKER_AMPLITUDE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_COMMON_SOURCE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_SOURCE_VSWR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_SOURCE_RETURN_LOSS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_ERN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_CALIBRATION_SOURCE_VSWR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_CALIBRATION_SOURCE_RETURN_LOSS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_CALIBRATION_ERN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_NOISE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_GAIN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_PREAMPLIFIER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_PREAMPLIFIER_NOISE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_PREAMPLIFIER_GAIN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_PREAMPLIFIER_VSWR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_PREAMPLIFIER_RETURN_LOSS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_UNCERTAINTY_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_WINDOW_SELECT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISP_DATA_TRAC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISP_TRAC_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISP_SYMB, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISP_AUTO_SCAL, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISP_TRAC_BOTTOM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISP_TRAC_TOP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISP_TRAC_REF_LEV_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISP_TABLE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISP_TRACE_MEM, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISPL_CURR_RESULTS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_NOISE_DISP_X_AXIS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_SWEEP_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_BAND_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_BAND_RAT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_CONF_POW_EXP_RF, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_SWEEP_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_SWE_FORW, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_SIGNAL_VERIFICATION_FAILED, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_LIST_RANG_BAND, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_LIST_RANG_FILT_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_LIST_RANG_SWE_COUN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_AM_REJECTION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_TRACKING_BANDWIDTH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DIGITAL_PLL, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DECIMATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_FREQ_VER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_FREQ_VER_TOL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_FREQ_VER_TOL_ABS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_FREQ_TRACK, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_POW_RLEV_VER_TOL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_POW_TRACK, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_CALC_EVAL, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_CALC_EVAL_STAR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_CALC_EVAL_STOP, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_USER_TRACE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_USER_EVALUATE_FROM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_USER_EVALUATE_TO, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_CALC_SNO_X, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_SPOT_NOISE_CALCULATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_CALC_SNO_Y, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_CALC_SNO_AOFF, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_CALC_SNO_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_CONF_REFM, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_IQ_WINDOW_FUNCTION_PARTICULAR_DECADE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_IQ_WINDOW_FUNCTION_ALL_DECADE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_SPUR_SUPPRESSION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_SPUR_THRESHOLD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_NOISE_LIMIT_CORNER_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_NOISE_LIMIT_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_NOISE_LIMIT_SHAPE_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_NOISE_LIMIT_SLOPE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_COPY_TO_USER_LIMIT_LINE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_NOISE_LIMIT_CHECK_STATE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DISP_TRACE_Y, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DISP_TRACE_Y_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DISP_TRACE_Y_AUTO_ONCE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DISP_TRACE_Y_RLEV, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_Y_AXIS_MANUAL_SCALING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DISP_TRACE_Y_BOTTOM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DISP_TRACE_Y_RLEV_OFFS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DISP_TRACE_SMO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DISP_TRACE_SMO_APER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_DISP_TRACE_SMO_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_X_AXIS_SCOPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_X_AXIS_START_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_X_AXIS_STOP_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_X_AXIS_HALF_DECADE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_MEASURED_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_MEASURED_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_MEASURED_INTEGRATED_PHASE_NOISE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_MEASURED_USER_INTEGRATED_PHASE_NOISE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_MEASURED_DISCRETE_JITTER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_PHASE_MEASURED_RANDOM_JITTER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_MARKER_DETECTOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_MARKER_PEAK_SEARCH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_DWELL_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_MARKER_LIMIT_CONDITION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_MARKER_LIMIT_VERTICAL_DISTANCE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_MARKER_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_DELTA_MARKER_DETECTOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_DELTA_MARKER_PEAK_SEARCH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_DELTA_MARKER_LIMIT_CONDITION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_DELTA_MARKER_LIMIT_VERTICAL_DISTANCE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_FMEAS_DELTA_MARKER_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_LISN_V_NETWORK_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_LISN_V_NETWORK_HIGH_PASS_FILTER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_LISN_V_NETWORK_PHASE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_EMI_RESOLUTION_BANDWIDTH_FILTER_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FACTORY_DEFAULTS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_REF_LEVEL_ADJUST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SCREEN_COUPLING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MARKER_SEARCH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MARKER_PEAK_SEARCH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_ADJUST_REFERENCE_LEVEL_TO_FULL_SCALE_LEVEL, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FULL_SCALE_LEVEL_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_PRESET_SCREENS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_RESULT_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DIGITAL_STANDARD, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FREQUENCY_STEP_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DIGITAL_STANDARD_SAVE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DIGITAL_STANDARD_GROUP, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DIGITAL_STANDARD_COMMENT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DIGITAL_STANDARD_PREFIX, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DIGITAL_STANDARD_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DIGITAL_STANDARD_DEFAULTS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_AUTO, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_THRESHOLD_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_THRESHOLD_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_THRESHOLD_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_HYSTERESIS_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_LENGTH_MIN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_LENGTH_MAX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_SKIP_RISE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_SKIP_FALL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BURST_SEARCH_GLEN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SEARCH_BURST_AUTO_CONFIGURATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SEARCH_BURST_TOLERANCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_SEARCH_AUTO, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_SEARCH_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_SEARCH_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_TEXT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_COMMENT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_NSTAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_PATT_ADD, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_PATT_REMOVE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_PATT_REMOVE_ALL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_COPY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_SEARCH_PATTERN_AUTO_CONFIGURATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SYNC_SEARCH_IQ_CORRELATION_THRESHOLD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_USE_PATTERN_FOR_SYNC_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_USE_PATTERN_FOR_SYNC_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FINE_SYNC_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FINE_SYNC_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FINE_SYNC_SER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FINE_SYNC_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_KNOWN_DATA_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_KNOWN_DATA_FILE_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_EQUALIZER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_EQUALIZER_LEARNING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_EQUALIZER_SPEED_CONVERSION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_EQUALIZER_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_EQUALIZER_LOAD, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_EQUALIZER_SAVE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_EQUALIZER_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_EQUALIZER_RESET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SIGNAL_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_PATTERN_SIGNAL_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_PATTERN_OFFSET_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_SRATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_QPSK_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_PSK_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_MSK_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_QAM_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_PSK_NSTAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_QAM_NSTAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_FSK_NSTAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_VSB_NSTAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_UQAM_NSTAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_ASK_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_APSK_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_MAPPING, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_UQAM_MAPPING, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LOAD_USER_MODULATION, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_FILTER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_ALPHABT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_PRATE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_FSK_DEV_COMP, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_FSK_DEV, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_FSK_DEV_REL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_EVM_CALCULATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_OPTIMIZATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATION_EVM_OFFSET, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_TX_FILTER_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_TX_FILTER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_TX_FILTER_ALPHA, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_TX_FILTER_USER_FILE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DEMODULATION_REC_LENGTH_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DEMODULATION_REC_LENGTH_SYM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DEMODULATION_REC_LENGTH_S, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DEMODULATION_RESULT_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DEMODULATION_MULTIBURST_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DEMODULATION_SIDE_BAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DEMODULATION_NORMALIZE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_EVAL_LINE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_EVAL_LINE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DEMODULATION_WBAN_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_COMPENSATE_IQ_OFFSET, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_COMPENSATE_IQ_IMBALANCE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_COMPENSATE_AMPLITUDE_DROOP, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_COMPENSATE_CARRIER_FREQUENCY_DRIFT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_COMPENSATE_FSK_DEVIATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_COMPENSATE_CHANNEL, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_COMPENSATE_SYMBOL_RATE_ERROR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_AUTO_MEASUREMENT_FILTER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MEASUREMENT_FILTER_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MEASUREMENT_FILTER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MEASUREMENT_FILTER_ALPHA, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MEASUREMENT_FILTER_USER_FILE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_AUTOMATIC_ESTIMATION_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_ESTIMATION_VALUE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_UNIT_TIME, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_UNIT_ANGLE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FIT_REF_POINT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FIT_ALIGN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FIT_ALIGN_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FIT_ALIGN_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FIT_SYMBOL_NUMBER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FIT_SYNC_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_DISPLAY_TRACE_SYMBOL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_CONFIGURE_DISPLAY_TRACE_SYMBOL_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_TRACE_DISPLAY_SPACING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SCALE_X_BAR_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SCALE_X_PDIV, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SCALE_X_RVAL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SCALE_X_RPOS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SCALE_Y_PDIV, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_CONFIGURE_DISPLAY_POINTS_PER_SYMBOL_AUTO, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_CONFIGURE_DISPLAY_POINTS_PER_SYMBOL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_CAPTURE_OVERSAMPLING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_TRACE_EVALUATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_STATISTIC_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_RESULT_RANGE_NUMBER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_CURRENT_STATISTICS_COUNTER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MBURST_START, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MBURST_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MBURST_CAPTURE_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MBURST_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MBURST_SEARCH_FIRST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MBURST_SEARCH_NEXT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MBURST_SEARCH_START, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FILE_EXP_HEADER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FILE_DATA_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_FILE_DATA_RAW_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LIMIT_MODULATION_ACCURACY_DEFAULTS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LIMIT_MOD_ACC_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LIMIT_MOD_ACC_EVM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LIMIT_MOD_ACC_PHASE_ERROR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LIMIT_MOD_ACC_MAGNITUDE_ERROR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LIMIT_MOD_ACC_CARRIER_FREQUENCY_ERROR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LIMIT_MOD_ACC_RHO, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LIMIT_MOD_ACC_IQ_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LIMIT_MOD_ACC_FREQUENCY_ERROR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_LIMIT_MOD_ACC_FREQUENCY_DEVIATION_ERROR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_QUERY_MOD_ACC_LIMIT_CHECK_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_SPECTRUM_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_CPOINT_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_CPOINT_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_CPOINT_PHASE_SHIFT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_CPOINT_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_X_FIRST_VALUE_QUERY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_X_MARKER_POSITION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_REFRESH_CAPTURED_DATA, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BER_BIT_ERROR_RATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BER_NUMBER_OF_ERRORS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_BER_NUMBER_OF_BITS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BWCD_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_HSDPAUPA_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_SYNC_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_AUTO_SCALE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_MCACLR, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_MIMO_MODE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_NORMALIZE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_COMPARE_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_INVERT_Q, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_POW_REF, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_SIDE_BAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_INACT_CHAN_THR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_POW_DIFFERENCE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_CONST_B, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_MULTIFRAME_CAPTURE_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_MULTIFRAME_FRAME_ANALYZE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GPP_BS_STANDARD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_ANTENNA, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_MARKER_TO_CHANNEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_REFERENCE_MARKER_TO_CHANNEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_SCODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_TIMING_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GPP_PDIV, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GPP_ASEQ, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GPP_SCODE_SEARCH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_CTAB_HEAD_COMM, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_CTAB_DEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_CTAB_COPY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_CTAB_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_CTAB, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_WCDP_CTAB_SEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_RESULTS_SFAC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_RESULTS_SELECT_CHAN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_RESULTS_SELECT_CPICH_SLOT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GBS_RESULT_SUM_VIEW, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_RRC_FILTER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_BASE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_SIDEBAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_SEL_COMP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_CHAN_CODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_SCR_CODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_SCR_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_NORM, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_SFAC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_SLOT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_ELIMINATE_TAIL_CHIPS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_HSDPAUPA_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_MULTIFRAME_CAPTURE_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_MULTIFRAME_FRAME_ANALYZE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_CDP_EVM_MEAS_INTERVAL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_WCDP_CTAB_HSDP, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_WCDP_CTAB_COMMENT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_WCDP_CTAB_COPY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_WCDP_CTAB_DEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_WCDP_CTAB_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_WCDP_CTAB_SEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_3GUE_WCDP_CTAB, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_ADJ_RLEV_QUERY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CDP_LEV_ADJUST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_STANDARD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_SIDE_BAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_STS_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CPICH_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CPICH_CODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CPICH_PATTERN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_RESULT_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_MEAS_PVT_HDYN, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_ADAPT_SIGN_AUT_LEVEL_TIME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_ADAPT_SIGN_SLOT_START, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_ADAPT_SIGN_SLOT_STOP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_ADJ_RLEV_QUERY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CDP_LEV_ADJUST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_SEM_LIMITS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CAPTURE_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_SCODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CELL_SHIFTS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_INACT_CHAN_THR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_SIDE_BAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_INVERT_Q, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_NORMALIZE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_SYNC_TO_SLOT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CPICH_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CPICH_CODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CPICH_PATTERN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_RESULT_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_RESULT_SEL_CHAN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_RESULT_SEL_SLOT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_RESULT_SET_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_RESULT_SET_VALUE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CTAB_ORDER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CTAB_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CTAB_SEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CTAB_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CTAB_COMM, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CTAB_MSHIFT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CTAB_COPY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CTAB_DEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_CTAB_MMAX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_MEAS_PVT_SFRAMES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_MEAS_PVT_HDYN, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_INVERT_Q, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_RESULT_SET_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_RESULT_SET_VALUE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CAPTURE_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_RESULT_SEL_CHAN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_RESULT_SEL_SLOT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_ADAPT_SIGN_SLOT_START, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_ADAPT_SIGN_SLOT_STOP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_ADAPT_SIGN_AUT_LEVEL_TIME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_SCODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CELL_SHIFTS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_SYNC_TO_SLOT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_SYNC_TO_SLOT_ROTATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDUE_STS_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_INACT_CHAN_THR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_NORMALIZE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_POWER_DISPLAY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_VERTICAL_SCALE_MAX_MIN, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CTAB_ORDER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CTAB_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CTAB_SEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CTAB_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CTAB_COMM, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CTAB_MSHIFT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CTAB_COPY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CTAB_DEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_CTAB_MMAX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_MEAS_PVT_SWITCH_POINT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TDBS_MEAS_PVT_SFRAMES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MDO_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CTABLE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CTABLE_SELECT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CTABLE_NAME, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CTABLE_COMMENT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CTABLE_COPY, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CTABLE_DELETE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CTABLE_RESTORE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_NORMALIZE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_QINVERT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_SLOT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_SBAND, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_ICTHRES, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_LEVEL_ADJUST, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_TPMEAS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_DISPLAY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_ACH_PRES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_ADJUST_REF_LEVEL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_PDIV, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_LIM_TRANS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_SET_TO_ANALYZE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_PERCENT_MARKER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_LIM_RESTORE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_MEAS_SELECT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_BCLASS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_SET_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_RESULT_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_LIM_VAL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_LIM_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_LIM_STORE_FILE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_PNOFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_IQLENGTH_FSP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_MCARRIER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_MCARRIER_ENH_ALG, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_MCARRIER_FILTER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_MCARRIER_FILTER_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_MCARRIER_ROLL_OFF, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_MCARRIER_CUT_OFF_FREQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_MARKER_TDPICH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_MARKER_PICH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_SFACTOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_PREFERENCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_ORDER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_IQLENGTH_FSQ_FSU, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_CODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_CDP_ANTENNA, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_C2K_FORCE_DV, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_PVT_BURST_FIT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_PVT_FAIL_RESTART, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_LIM_PVT_REFERENCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_LIM_PVT_VALUE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_LIM_PVT_LIST, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_LIM_PVT_RESTORE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_RFSLOT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_CDP_MMODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_CDP_MAPPING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_CDP_CTYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_CDP_OVERVIEW, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_CDP_AVERAGE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_CDP_IQLENGTH_FSQ_FSU, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_CDP_CODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_BDO_REVISION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_LIM_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_MARKER_PICH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_CDP_MAPPING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_CDP_PREFERENCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_CDP_ORDER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_CDP_OVERVIEW, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_CDP_LCODE_MASK, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_CDP_LCODE_OFFSET, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_CDP_CODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_CDP_SFACTOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_CDP_IQLENGTH_FSQ_FSU, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_CDP_IQLENGTH_FSP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MC2K_LCODE_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MDO_CDP_LCODE_I, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MDO_CDP_LCODE_Q, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MDO_CDP_CODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MDO_CDP_IQLENGTH_FSQ_FSU, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MDO_CDP_IQLENGTH_FSP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MDO_CDP_OPERATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_MDO_CDP_AVERAGE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PVT_RPOW, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PVT_SEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PVT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SPEC_FLAT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_BTYP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PVT_AVER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_POW_EXP_IQ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_POW_EXP_RF, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_POW_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_POW_AUTO_ONCE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EVM_ECAR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EVM_ESYM, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SPEC_MASK_SEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SPEC_FFT, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_CONS_CSYM, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_CONS_CCAR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_CONS_CARR_SEL_NR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_STAT_BSTR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_STAT_SFI, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_BURS_COUN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_ACH_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_UNIT_PRE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PVR_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PEAK_ERROR_VECTOR_MEAS_RANGE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PRE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FLAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_POW_AUTO_SWE_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_CALC_BURS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PRE_SEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_NUMBER_OF_ANTENNAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MIMO_DUT_CONFIGURATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MIMO_ANT_SIGNAL_CAPTURE_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_ANTENNA_SIMULTANEOUS_CAPTURE_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MIMO_OSP_IP_ADDRESS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MIMO_OSP_SWITCH_MODULE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MIMO_PAYLOAD_LENGTH_SOURCE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_DISP_AUTO_Y, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_Y_PDIV, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TRIS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TFAL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EVM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TFAL_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TRIS_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EVM_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_ACP_ADJ, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_ACP_ALT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SPEC_MASK_X, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SPEC_MASK_Y, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MARK_SYMB, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MARK_CARR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MARK_Y, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_TRIS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_TFAL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_BERPILOT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_SYMB_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_BURST_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETCH_BURST_PAYLOAD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETCH_BURST_PEAK, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETCH_BURST_PREAMBLE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETCH_BURST_START, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EGAT_HOLD_SAMP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EGAT_HOLD_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EGAT_LENG_SAMP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EGAT_LENG_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EGAT_LINK, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EGAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TRIG_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TRIG_POW_LEV, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TRIG_POW_LEV_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_ANALYZER_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_ANALYZER_ADDRESS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_ANTENNA_CONFIGURATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SIGS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_BAN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_DBYT_EQU, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_DBYT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_DUR_EQU, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_DUR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EQUALIZER_FILTER_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_BURST_TYPE_TO_MEASURE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_CHANNEL_BANDWIDTH_TO_MEAS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_GUARD_INTERVAL_LEGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MIMO_SPATIAL_MAPPING_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MIMO_POWER_NORMALISE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MIMO_UDFSPATIAL_MAPPING_TIME_SHIFT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_BURST_SELECT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_BURST_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_IQ_COMPENSATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_BURST_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SEM_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SEM_CLASS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SEM_FILE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_STAN, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SRAT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SWAP_IQ, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_RBW_FILTER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_POWER_INTERVAL_SEARCH, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FFT_START_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_CEST, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TRAC_LEV, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TRAC_PHAS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TRAC_TIME, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_TRAC_PILOTS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_BCON_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MCS_INDEX_TO_USE_FBUR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_MCS_INDEX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_STBC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_GUARD_INTERVAL_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PPDU_FORMAT_TO_MEASURE_802_11N, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_CHANNEL_BANDWIDTH_TO_MEASURE_802_11N, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EXT_SPATIAL_STREAMS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PPDU_FORMAT_TO_MEASURE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_CHANNEL_BANDWIDTH_TO_MEASURE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PSDU_MODULATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PPDU_FORMAT_TO_MEASURE_802_11B_G, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PSDU_MODULATION_802_11B_G, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_PPDU_FORMAT_TO_MEASURE_802_11AC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_CHANNEL_BANDWIDTH_TO_MEASURE_802_11AC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_NSTS_INDEX_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_NSTS_INDEX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_BURS_COUN_STAT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_CONS_CARR_SEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SOURCE_OF_PAYLOAD_LENGTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SYM_EQU, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SYM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_UNIT_GIMB, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_UNIT_EVM, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_DISP_TABL, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FERR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SYMB, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_IQOF, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EVM_ALL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EVM_DATA, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EVM_PIL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SPEC_ACPR, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SPEC_MASK, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SPEC_OCCUPIED_BANDWIDTH, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_STAT_CCDF, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_PRE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_PAYL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_RMS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_PEAK, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_CRES, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_FERR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_SYMB, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_IQOF, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_GIMB, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_QUAD, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_EVM_ALL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_EVM_DATA, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_EVM_PILOT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_EVM_DIR, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_EVM, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_BURS_COUNT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FETC_BURST_COUNT_ALL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_FERR_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_SYMB_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_IQOF_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EVM_ALL_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EVM_DATA_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_EVM_PIL_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_ACP_ADJ_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_ACP_ALT_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_WLAN_LIM_FAIL_RES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_STORE_DEMODULATION_SETTINGS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_LOAD_DEMODULATION_SETTINGS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_MEASUREMENT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_DUPLEXING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CHANNEL_BANDWIDTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_NUMBER_OF_RESOURCE_BLOCKS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CYCLIC_PREFIX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_AUTO_REFERENCE_LEVEL, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_REFERENCE_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_REFERENCE_LEVEL_IN_BB_MODE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_MIMO_CONFIGURATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_MIMO_ANTENNA, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_IQ_SWAP, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_INPUT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CSI_RS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CSI_RS_ANTENA_PORTS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CSI_RS_CONFIGURATION_INDEX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CSI_RS_OVERWRITE_PDSCH, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CSI_RS_RELATIVE_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CSI_RS_SUBFRAME_CONFIGURATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CSI_RS_FRAME_NUMBER_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CHANNEL_ESTIMATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_EVM_CALCULATION_METHOD, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_SCRAMBLING_OF_CODED_BITS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_AUTO_DEMODULATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDSCH_SUBFRAME_DETECT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_BOOSTING_ESTIMATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDSCH_REFERENCE_DATA, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_MULTICARRIER_FILTER, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PHASE_TRACKING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_TIMING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_TDD_UL_DL_ALLOCATIONS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_TDD_SPECIAL_SUBFRAME, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CID_GROUP_AUTO, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CELL_IDENTITY_GROUP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CELL_IDENTITY_AUTO, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CELL_IDENTITY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDSCH_CONFIGURABLE_SUBFRAMES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDSCH_USED_ALLOCATIONS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDSCH_ALLOCATION_MODULATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDSCH_ALLOCATION_RESOURCE_BLOCKS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDSCH_ALLOCATION_RESOURCE_BLOCKS_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDSCH_ALLOCATION_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDSCH_ALLOCATION_START_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_REFERENCE_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PRB_SYMBOL_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PSYNC_RELATIVE_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_SSYNC_RELATIVE_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PBCH_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PBCH_RELATIVE_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PCFICH_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PCFICH_RELATIVE_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PHICH_NUMBER_OF_GROUPS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PHICH_DURATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PHICH_RELATIVE_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PHICH_NG_PARAMETER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PHICH_ENHANCED_TEST_MODELS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDCCH_NUMBER_OF_PDCCHS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDCCH_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDCCH_RELATIVE_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_PDSCH_POWER_RATIO, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_MEASUREMENT_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_SUBFRAME_SELECTION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_SUBFRAME_SELECTION_ALL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_EVM_UNITS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_BIT_STREAM_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_SEM_CHANNEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_ACP_ASSUMED_ADJ_CHANNEL_CARRIER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_ACP_NOISE_CORRECTION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CONSTELLATION_LOCATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_Y_AXIS_SCALING_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_Y_AXIS_SCALING_PER_DIVISION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_Y_AXIS_SCALING_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_EVM_PDSCH_QPSK_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_EVM_PDSCH_16QAM_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_EVM_PDSCH_64QAM_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_EVM_ALL_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_EVM_PHYSICAL_CHANNEL_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_EVM_PHYSICAL_SIGNAL_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_EVM_SDSF_AVERAGE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_FREQUENCY_ERROR_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_SAMPLING_ERROR_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_IQ_OFFSET_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_IQ_GAIN_IMBALANCE_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_IQ_QUADRATURE_ERROR_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_FRAME_POWER_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_CREST_FACTOR_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_TRIGGER_TO_FRAME_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_OSTP_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_RSTP_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_RSSI_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_DETECTED_CELL_IDENTITY_GROUP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_DETECTED_CELL_IDENTITY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_DOWNLINK_DETECTED_CYCLIC_PREFIX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_LINK_DIRECTION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_STORE_DEMODULATION_SETTINGS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_LOAD_DEMODULATION_SETTINGS, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_TRANSIENT_SLOTS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_DUPLEXING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_CHANNEL_BANDWIDTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_NUMBER_OF_RESOURCE_BLOCKS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_CYCLIC_PREFIX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_AUTO_REFERENCE_LEVEL, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_REFERENCE_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_REFERENCE_LEVEL_IN_BB_MODE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_IQ_SWAP, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_INPUT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_AUTO_LEVEL_TRACK_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_RF_ATTENUATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_CHANNEL_ESTIMATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_COMPENSATE_DC_OFFSET, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_AUTO_DEMODULATION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SCRAMBLING_OF_CODED_BITS, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SUPPRESSED_INTERFERENCE_SYNC, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PHASE_TRACKING, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_TIMING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_TDD_UL_DL_ALLOCATIONS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_TDD_SPECIAL_SUBFRAME, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_CELL_IDENTITY_GROUP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_CELL_IDENTITY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_CONFIGURABLE_SUBFRAMES, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SUBFRAME_ALLOCATION_ENABLE_PUCCH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SUBFRAME_ALLOCATION_MODULATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SUBFRAME_ALLOCATION_RESOURCE_BLOCKS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SUBFRAME_ALLOCATION_RESOURCE_BLOCKS_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SUBFRAME_ALLOCATION_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_POWER_PUSCH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_POWER_PUCCH, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_GROUP_HOPPING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SEQUENCE_HOPPING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_DELTA_SEQUENCE_SHIFT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_N_DMRS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_N_PRS_STATE, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_PRESENT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_POWER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_SYMBOL_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_SUBCARRIER_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_SUBCARRIERS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_N_RRC, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_AN_TX, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_ALPHA_PARAMETER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_U_PARAMETER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SOUNDING_REFERENCE_SIGNAL_Q_PARAMETER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUSCH_FREQUENCY_HOPPING_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUSCH_SUBBANDS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUSCH_HOPPING_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUSCH_INFO_IN_HOPPING_BITS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUCCH_RESOURCE_BLOCKS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUCCH_DELTA_SHIFT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUCCH_DELTA_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUCCH_CYCLIC_SHIFTS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUCCH_BANDWIDTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUCCH_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PUCCH_RESOURCE_INDEX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PRACH_CONFIGURATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PRACH_RESTRICTED_SET, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PRACH_FREQUENCY_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PRACH_NCS_CONFIGURATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PRACH_LOGICAL_ROOT_SEQ_INDEX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PRACH_SEQUENCE_INDEX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PRACH_SEQUENCE_INDEX_VALUE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PRACH_AUTOMATIC_PREAMBLE_MAPPING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PRACH_FREQUENCY_INDEX, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_PRACH_HALF_FRAME_INDICATOR, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_MEASUREMENT_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SUBFRAME_SELECTION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SUBFRAME_SELECTION_ALL, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SLOT_SELECTION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_EVM_UNITS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_BIT_STREAM_FORMAT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SEM_CHANNEL, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_ACLR_ASSUMED_ADJ_CHANNEL_CARRIER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_ACLR_NOISE_CORRECTION, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_Y_AXIS_SCALING_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_Y_AXIS_SCALING_PER_DIVISION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_Y_AXIS_SCALING_OFFSET, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_MIMO_ANTENNA, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_MIMO_PUCCH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_MIMO_PUSCH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_MIMO_SRS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_EVM_ALL_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_EVM_PHYSICAL_CHANNEL_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_EVM_PHYSICAL_SIGNAL_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_FREQUENCY_ERROR_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_SAMPLING_ERROR_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_IQ_OFFSET_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_IQ_GAIN_IMBALANCE_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_IQ_QUADRATURE_ERROR_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_FRAME_POWER_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_CREST_FACTOR_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_TRIGGER_TO_FRAME_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_DETECTED_CELL_IDENTITY_GROUP, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_LTE_UPLINK_DETECTED_CELL_IDENTITY, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_MODE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_BURST_TYPE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_CHANNEL_BANDWIDTH, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_REFERENCE_LEVEL_FOR_RF_MEASUREMENT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_REFERENCE_LEVEL_FOR_IQ_MEASUREMENT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_TEDS_SLOT_DURATION, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_NUMBER_OF_BURST, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_OVERALL_BURST_COUNT, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_TRIGGER_MODE, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_TRIGGER_POWER_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_TRIGGER_IQ_LEVEL, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_TRIGGER_TEDS_SLOT_DURATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_INPUT_SELECT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_IQ_SETTING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_IQ_CENTER_FREQUENCY, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_PAYLOAD_MODULATION, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_MAXIMUM_CARRIER_OFFSET, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_PILOT_TRACKING, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_COMPENSATE_AMPLITUDE_DROOP, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_COMPENSATE_IQ_OFFSET, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_MOVE_MARKER, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_MARKER_AMPLITUDE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_EVM_SUMMARY_LIMITS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_ACP_LIMITS, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_SUMMARY_TABLE_MEASUREMENT_RESULT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_FETCH_ACP_MEASUREMENT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_FETCH_ACP_MODULATION_RBW, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_PVT_MEASUREMENT, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_PVT_TRIGGER_TO_SYNC_TIME, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_SPECTRUM_FFT_MEASUREMENT_RBW, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_TRACE_X_AXIS_MIN_MAX, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_IQ_SAMPLE_RATE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_RESULT_SUMMARY_LIMIT_CHECK_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_ACP_LIMIT_CHECK_RESULT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_Y_AXIS_TRACE, ViReal64)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_Y_AXIS_TRACE_AUTO, ViBoolean)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_MEASUREMENT_TYPE, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_Y_AXIS_TRACE_UNIT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_CONSTELLATION_SYMBOL_SETTINGS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_CONSTELLATION_CARRIER_NUMBER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_EVM_RESULT_UNITS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_GAIN_IMBALANCE_RESULT_UNITS, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_TETRA_BURST_RECALC, ViString)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_VSA_MODULATON_QUESTIONABLE_REGISTER, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_OPC_TIMEOUT, ViInt32)
+RSSPECAN_BIND_ATTRIBUTE(RSSPECAN_ATTR_IO_SESSION, ViSession)
+/* END GENERATE */
+
+#undef RSSPECAN_BIND_ATTRIBUTE
+
+// Calls of the type-safe C API for each attribute C type
+template <typename T>
+struct AttributeAccess;
+
+template <>
+struct AttributeAccess<ViInt32>
+{
+	using ValueType = ViInt32;
+	using ArgumentType = ViInt32;
+	static ViStatus set(ViSession s, ViString repCap, ViAttr id, ViInt32 value) { return rsspecan_SetAttributeViInt32(s, repCap, id, value); }
+	static ViStatus get(ViSession s, ViString repCap, ViAttr id, ViInt32* value) { return rsspecan_GetAttributeViInt32(s, repCap, id, value); }
+};
+
+template <>
+struct AttributeAccess<ViReal64>
+{
+	using ValueType = ViReal64;
+	using ArgumentType = ViReal64;
+	static ViStatus set(ViSession s, ViString repCap, ViAttr id, ViReal64 value) { return rsspecan_SetAttributeViReal64(s, repCap, id, value); }
+	static ViStatus get(ViSession s, ViString repCap, ViAttr id, ViReal64* value) { return rsspecan_GetAttributeViReal64(s, repCap, id, value); }
+};
+
+template <>
+struct AttributeAccess<ViBoolean>
+{
+	using ValueType = bool;
+	using ArgumentType = bool;
+	static ViStatus set(ViSession s, ViString repCap, ViAttr id, bool value) { return rsspecan_SetAttributeViBoolean(s, repCap, id, value ? VI_TRUE : VI_FALSE); }
+	static ViStatus get(ViSession s, ViString repCap, ViAttr id, bool* value)
+	{
+		ViBoolean state = VI_FALSE;
+		ViStatus status = rsspecan_GetAttributeViBoolean(s, repCap, id, &state);
+		*value = (state != VI_FALSE);
+		return status;
+	}
+};
+
+template <>
+struct AttributeAccess<ViSession>
+{
+	using ValueType = ViSession;
+	using ArgumentType = ViSession;
+	static ViStatus set(ViSession s, ViString repCap, ViAttr id, ViSession value) { return rsspecan_SetAttributeViSession(s, repCap, id, value); }
+	static ViStatus get(ViSession s, ViString repCap, ViAttr id, ViSession* value) { return rsspecan_GetAttributeViSession(s, repCap, id, value); }
+};
+
+// String values longer than RS_MAX_MESSAGE_BUF_SIZE - 1 are truncated
+template <>
+struct AttributeAccess<ViString>
+{
+	using ValueType = std::string;
+	using ArgumentType = const char*;
+	static ViStatus set(ViSession s, ViString repCap, ViAttr id, const char* value) { return rsspecan_SetAttributeViString(s, repCap, id, detail::cstr(value)); }
+	static ViStatus get(ViSession s, ViString repCap, ViAttr id, std::string* value)
+	{
+		ViChar buffer[RS_MAX_MESSAGE_BUF_SIZE] = "";
+		ViStatus status = rsspecan_GetAttributeViString(s, repCap, id, RS_MAX_MESSAGE_BUF_SIZE, buffer);
+		value->assign(buffer);
+		return status;
+	}
+};
+
+template <ViAttr Id>
+using AttributeTraits = AttributeAccess<typename AttributeType<Id>::type>;
+
+/*****************************************************************************
+ *- Session -----------------------------------------------------------------*
+ *****************************************************************************/
+
+// Owns the session handle, rsspecan_close is called by the destructor. Move-only
+class Session
+{
+public:
+	Session(const char* resourceName, bool idQuery = true, bool resetDevice = false, const char* optionString = "")
+		: handle_(0)
+	{
+		detail::check(0, rsspecan_InitWithOptions(detail::cstr(resourceName), idQuery ? VI_TRUE : VI_FALSE,
+		                                          resetDevice ? VI_TRUE : VI_FALSE, detail::cstr(optionString), &handle_));
+	}
+
+	// Takes over the handle opened by the C API
+	explicit Session(ViSession instrSession) noexcept : handle_(instrSession) {}
+
+	Session(const Session&) = delete;
+	Session& operator=(const Session&) = delete;
+
+	Session(Session&& other) noexcept : handle_(other.release()) {}
+
+	Session& operator=(Session&& other) noexcept
+	{
+		if (this != &other)
+		{
+			close();
+			handle_ = other.release();
+		}
+
+		return *this;
+	}
+
+	~Session() { close(); }
+
+	ViSession handle() const noexcept { return handle_; }
+
+	// Gives up the ownership, the caller closes the handle
+	ViSession release() noexcept
+	{
+		ViSession instrSession = handle_;
+		handle_ = 0;
+		return instrSession;
+	}
+
+	void close() noexcept
+	{
+		if (handle_ != 0)
+			(void)rsspecan_close(handle_);
+
+		handle_ = 0;
+	}
+
+	template <ViAttr Id>
+	void set(typename AttributeTraits<Id>::ArgumentType value, const char* repCap = "")
+	{
+		detail::check(handle_, AttributeTraits<Id>::set(handle_, detail::cstr(repCap), Id, value));
+	}
+
+	template <ViAttr Id>
+	typename AttributeTraits<Id>::ValueType get(const char* repCap = "")
+	{
+		typename AttributeTraits<Id>::ValueType value{};
+		detail::check(handle_, AttributeTraits<Id>::get(handle_, detail::cstr(repCap), Id, &value));
+		return value;
+	}
+
+	// Trace reads return the part of the buffer filled with the points
+	Span<ViReal64> fetchYTrace(ViInt32 window, ViInt32 trace, Span<ViReal64> amplitude)
+	{
+		ViInt32 actualPoints = 0;
+		detail::check(handle_, rsspecan_FetchYTrace(handle_, window, trace, (ViInt32)amplitude.size(), &actualPoints, amplitude.data()));
+		return amplitude.first((std::size_t)actualPoints);
+	}
+
+	Span<ViReal64> readYTrace(ViInt32 window, ViInt32 trace, ViUInt32 maximumTime_ms, Span<ViReal64> amplitude)
+	{
+		ViInt32 actualPoints = 0;
+		detail::check(handle_, rsspecan_ReadYTrace(handle_, window, trace, maximumTime_ms, (ViInt32)amplitude.size(), &actualPoints, amplitude.data()));
+		return amplitude.first((std::size_t)actualPoints);
+	}
+
+	Span<ViReal64> fetchXTrace(ViInt32 trace, Span<ViReal64> x)
+	{
+		ViInt32 actualPoints = 0;
+		detail::check(handle_, rsspecan_FetchXTrace(handle_, trace, (ViInt32)x.size(), &actualPoints, x.data()));
+		return x.first((std::size_t)actualPoints);
+	}
+
+private:
+	ViSession handle_;
+};
+
+/*****************************************************************************
+ *- Batch scope -------------------------------------------------------------*
+ *****************************************************************************/
+
+// Groups several calls: the session stays locked for the other threads and the instrument
+// status is checked only once by commit() instead of after each call.
+// The destructor restores the status checking and unlocks the session, without the commit() the status is not checked.
+class BatchScope
+{
+public:
+	explicit BatchScope(Session& session)
+		: handle_(session.handle()), queryStatus_(false), restored_(false)
+	{
+		detail::check(handle_, RsCore_LockSession(handle_));
+		try
+		{
+			queryStatus_ = session.get<RSSPECAN_ATTR_QUERY_INSTRUMENT_STATUS>();
+			detail::check(handle_, rsspecan_setCheckStatus(handle_, VI_FALSE));
+		}
+		catch (...)
+		{
+			(void)RsCore_UnlockSession(handle_);
+			throw;
+		}
+	}
+
+	BatchScope(const BatchScope&) = delete;
+	BatchScope& operator=(const BatchScope&) = delete;
+
+	~BatchScope()
+	{
+		restore();
+		(void)RsCore_UnlockSession(handle_);
+	}
+
+	void commit()
+	{
+		restore();
+		if (queryStatus_)
+			detail::check(handle_, RsCore_CheckStatus(handle_, VI_SUCCESS));
+	}
+
+private:
+	void restore() noexcept
+	{
+		if (!restored_)
+			(void)rsspecan_setCheckStatus(handle_, queryStatus_ ? VI_TRUE : VI_FALSE);
+
+		restored_ = true;
+	}
+
+	ViSession handle_;
+	bool queryStatus_;
+	bool restored_;
+};
+
+} // namespace rsspecan
+
+#endif /* __RSSPECAN_HPP_HEADER */
@@ -1315,7 +1315,7 @@ ViStatus _VI_FUNC rsspecan_ReadWlanSEMResults(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -339,7 +339,7 @@ ViStatus rsspecan_DeltaMarkerReferenceMarker_WriteCallback(ViSession instrSessio
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	return error;
 }
@@ -809,7 +809,7 @@ ViStatus rsspecan_Attenuation_WriteCallback(ViSession instrSession, ViConstStrin
 
 Error:
 	if (cmd)
-		free(cmd);
+		RsCore_Free(instrSession, cmd);
 
 	return error;
 }
@@ -1662,7 +1662,7 @@ ViStatus _VI_FUNC rsspecan_ReadGSMK10ModulationSpectrumResults(ViSession instrSe
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
@@ -1726,7 +1726,7 @@ ViStatus _VI_FUNC rsspecan_FetchGSMK10ModulationSpectrumResults(ViSession instrS
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1792,7 +1792,7 @@ ViStatus _VI_FUNC rsspecan_ReadGSMK10TransientSpectrumResults(ViSession instrSes
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1855,7 +1855,7 @@ ViStatus _VI_FUNC rsspecan_FetchGSMK10TransientSpectrumResults(ViSession instrSe
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1928,7 +1928,7 @@ ViStatus _VI_FUNC rsspecan_ReadGSMK10WideSpectrumResults(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1999,7 +1999,7 @@ ViStatus _VI_FUNC rsspecan_FetchGSMK10WideSpectrumResults(ViSession instrSession
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -2038,7 +2038,7 @@ ViStatus _VI_FUNC rsspecan_ReadGSMK10WideSpectrumGating(ViSession instrSession,
 	*gateLength = atof(p2buf);
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -2106,7 +2106,7 @@ ViStatus _VI_FUNC rsspecan_FetchGSMK10MagnitudeCaptureResults(ViSession instrSes
 	}
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
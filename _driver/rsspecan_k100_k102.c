@@ -2209,31 +2209,16 @@ ViStatus _VI_FUNC rsspecan_ReadLTEDownlinkConstellationDiagram(ViSession instrSe
                                                                ViReal64 imaginaryParts_Q[])
 {
 	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 dataSize, i;
-	ViInt32 j = 0;
+	ViReal64* columns[2];
 
 	checkErr(RsCore_LockSession(instrSession));
 
-	checkErr(RsCore_QueryFloatArray(instrSession, ":TRAC?", &data, &dataSize));
+	columns[0] = realParts_I;
+	columns[1] = imaginaryParts_Q;
+	checkErr(RsCore_QueryFloatArrayColumns(instrSession, ":TRAC?", 2, columns, bufferSize, noofPoints));
 	checkErr(rsspecan_CheckStatus(instrSession));
 
-	dataSize /= 2;
-
-	if (noofPoints)
-		*noofPoints = dataSize;
-
-	if (dataSize > bufferSize)
-		dataSize = bufferSize;
-
-	for (i = 0; i < dataSize; i++)
-	{
-		realParts_I[i] = data[j++];
-		imaginaryParts_Q[i] = data[j++];
-	}
-
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -2325,7 +2310,7 @@ ViStatus _VI_FUNC rsspecan_ReadLTEDownlinkAllocationSummary(ViSession instrSessi
 	}
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -2424,7 +2409,7 @@ ViStatus _VI_FUNC rsspecan_ReadLTEDownlinkBitstream(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pBuffer) free(pBuffer);
+	if (pBuffer) RsCore_Free(instrSession, pBuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
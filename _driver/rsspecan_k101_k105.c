@@ -2620,33 +2620,18 @@ ViStatus _VI_FUNC rsspecan_ReadLTEUplinkConstellationDiagram(
 )
 {
 	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 dataSize, i;
-	ViInt32 j = 0;
+	ViReal64* columns[2];
 
 	checkErr(RsCore_LockSession(instrSession));
 
 	checkErr(RsCore_CheckInstrumentOptions(instrSession, "K101|K105"));
 
-	checkErr(RsCore_QueryFloatArray(instrSession, "TRAC? TRACE1", &data, &dataSize));
+	columns[0] = realParts_I;
+	columns[1] = imaginaryParts_Q;
+	checkErr(RsCore_QueryFloatArrayColumns(instrSession, "TRAC? TRACE1", 2, columns, bufferSize, noofPoints));
 	checkErr(rsspecan_CheckStatus(instrSession));
 
-	dataSize /= 2;
-
-	if (noofPoints)
-		*noofPoints = dataSize;
-
-	if (dataSize > bufferSize)
-		dataSize = bufferSize;
-
-	for (i = 0; i < dataSize; i++)
-	{
-		realParts_I[i] = data[j++];
-		imaginaryParts_Q[i] = data[j++];
-	}
-
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -2687,33 +2672,18 @@ ViStatus _VI_FUNC rsspecan_ReadLTEUplinkDFTPrecodedConstellation(
 )
 {
 	ViStatus error = VI_SUCCESS;
-	ViReal64* data = NULL;
-	ViInt32 dataSize, i;
-	ViInt32 j = 0;
+	ViReal64* columns[2];
 
 	checkErr(RsCore_LockSession(instrSession));
 
 	checkErr(RsCore_CheckInstrumentOptions(instrSession, "K101|K105"));
 
-	checkErr(RsCore_QueryFloatArray(instrSession, "TRAC? TRACE1", &data, &dataSize));
+	columns[0] = realParts_I;
+	columns[1] = imaginaryParts_Q;
+	checkErr(RsCore_QueryFloatArrayColumns(instrSession, "TRAC? TRACE1", 2, columns, bufferSize, noofPoints));
 	checkErr(rsspecan_CheckStatus(instrSession));
 
-	dataSize /= 2;
-
-	if (noofPoints)
-		*noofPoints = dataSize;
-
-	if (dataSize > bufferSize)
-		dataSize = bufferSize;
-
-	for (i = 0; i < dataSize; i++)
-	{
-		realParts_I[i] = data[j++];
-		imaginaryParts_Q[i] = data[j++];
-	}
-
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -2837,7 +2807,7 @@ ViStatus _VI_FUNC rsspecan_ReadLTEUplinkAllocationSummary(
 	}
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -2942,7 +2912,7 @@ ViStatus _VI_FUNC rsspecan_ReadLTEUplinkBitstream(
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pBuffer) free(pBuffer);
+	if (pBuffer) RsCore_Free(instrSession, pBuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
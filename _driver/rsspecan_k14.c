@@ -1001,8 +1001,8 @@ ViStatus _VI_FUNC rsspecan_GetSpectrogramTimeStamp(ViSession instrSession,
 {
 	ViStatus error = VI_SUCCESS;
 	ViChar cmd[RS_MAX_MESSAGE_BUF_SIZE];
-	ViInt32* data = NULL;
-	ViInt32 i, dataSize, j = 0;
+	ViInt32* columns[4] = {part1, part2, part3, part4};
+	ViInt32 rows = 0;
 
 	checkErr(RsCore_LockSession(instrSession));
 
@@ -1016,29 +1016,18 @@ ViStatus _VI_FUNC rsspecan_GetSpectrogramTimeStamp(ViSession instrSession,
 
 	viCheckParm(RsCore_InvalidViInt32Range(instrSession, frame, 0, 1),
 			2, "Frame");
+	viCheckParm(RsCore_InvalidViInt32Range(instrSession, arraySize, 0, INT_MAX),
+			3, "Array Size");
 
+	// Four values per frame, each one goes directly to its part array
 	snprintf(cmd, RS_MAX_MESSAGE_BUF_SIZE, ":CALC:SPEC:TST:DATA? %s", (frame == 0) ? "CURR" : "ALL");
-	checkErr(RsCore_QueryAsciiViInt32Array(instrSession, cmd, &data, &dataSize));
+	checkErr(RsCore_QueryIntegerArrayColumns(instrSession, cmd, 4, columns, arraySize, &rows));
 	checkErr(rsspecan_CheckStatus(instrSession));
 
-	dataSize /= 4;
-
 	if (returnedValues)
-		*returnedValues = dataSize;
-
-	if (dataSize > arraySize)
-		dataSize = arraySize;
-
-	for (i = 0; i < dataSize; i++)
-	{
-		part1[i] = data[j++];
-		part2[i] = data[j++];
-		part3[i] = data[j++];
-		part4[i] = data[j++];
-	}
+		*returnedValues = rows;
 
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1435,8 +1435,8 @@ ViStatus _VI_FUNC rsspecan_ReadPhaseTraceData(
 {
 	ViStatus error = VI_SUCCESS;
 	ViChar trace[RS_MAX_MESSAGE_BUF_SIZE];
-	ViReal64* data = NULL;
-	ViInt32 i, j = 0, retCnt;
+	ViReal64* columns[2];
+	ViInt32 retCnt = 0;
 	ViInt32 dataSize = 32001;
 
 	checkErr(RsCore_LockSession(instrSession));
@@ -1448,24 +1448,14 @@ ViStatus _VI_FUNC rsspecan_ReadPhaseTraceData(
 		dataSize = *noofPoints;
 
 	sprintf(trace, "TRACE%ld", sourceTrace + 1);
-	data = (ViReal64*)malloc(dataSize * sizeof(ViReal64) * 2);
-	checkErr(rsspecan_dataReadTrace(instrSession, 0, trace, dataSize * 2, data, &retCnt));
-
-	retCnt /= 2;
+	columns[0] = traceDataX;
+	columns[1] = traceDataY;
+	checkErr(rsspecan_dataReadTraceColumns(instrSession, 0, trace, 2, columns, dataSize, &retCnt));
 
 	if (noofPoints)
 		*noofPoints = retCnt;
 
-	for (i = 0; i < retCnt; i++)
-	{
-		traceDataX[i] = data[j++];
-		traceDataY[i] = data[j++];
-	}
-
-	checkErr(rsspecan_CheckStatus(instrSession));
-
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1550,35 +1540,26 @@ ViStatus _VI_FUNC rsspecan_FetchPhaseSpurs(
 {
 	ViStatus error = VI_SUCCESS;
 	ViInt32 retCnt = 0;
-	ViReal64* data = NULL;
-	ViInt32 i, j = 0, dataSize;
+	ViReal64* columns[2];
+	ViInt32 dataSize = INT_MAX;
 
 	checkErr(RsCore_LockSession(instrSession));
 
 	checkErr(RsCore_CheckInstrumentOptions(instrSession, "K40"));
 
-	checkErr(RsCore_QueryFloatArray(instrSession, "FETC:PNO:SPUR?", &data, &retCnt));
-	checkErr(rsspecan_CheckStatus(instrSession));
+	// noofPoints limits the returned spurs if entered, otherwise the arrays must hold all of them
+	if (noofPoints)
+		dataSize = *noofPoints;
 
-	retCnt /= 2;
-	dataSize = retCnt;
+	columns[0] = frequencyValues;
+	columns[1] = levelValues;
+	checkErr(RsCore_QueryFloatArrayColumns(instrSession, "FETC:PNO:SPUR?", 2, columns, dataSize, &retCnt));
+	checkErr(rsspecan_CheckStatus(instrSession));
 
 	if (noofPoints)
-	{
-		if (dataSize > *noofPoints)
-			dataSize = *noofPoints;
-
 		*noofPoints = retCnt;
-	}
-
-	for (i = 0; i < dataSize; i++)
-	{
-		frequencyValues[i] = data[j++];
-		levelValues[i] = data[j++];
-	}
 
 Error:
-	if (data) free(data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -995,7 +995,7 @@ ViStatus _VI_FUNC rsspecan_ReadGsmExtendedSlotPtempRef(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1110,7 +1110,7 @@ ViStatus _VI_FUNC rsspecan_FetchGsmExtendedSlotPtempRef(ViSession instrSession,
 	}
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1199,7 +1199,7 @@ ViStatus _VI_FUNC rsspecan_ReadGsmModSpectrum(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1284,7 +1284,7 @@ ViStatus _VI_FUNC rsspecan_FetchGsmModSpectrum(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1375,7 +1375,7 @@ ViStatus _VI_FUNC rsspecan_ReadGsmTransSpectrum(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1438,7 +1438,7 @@ ViStatus _VI_FUNC rsspecan_FetchGsmTransSpectrum(ViSession instrSession,
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (pbuffer) free(pbuffer);
+	if (pbuffer) RsCore_Free(instrSession, pbuffer);
 	(void)(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
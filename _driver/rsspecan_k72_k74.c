@@ -959,7 +959,7 @@ ViStatus _VI_FUNC rsspecan_Get3GPPBSCDPScramblingCodeResult(ViSession instrSessi
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1037,7 +1037,7 @@ ViStatus _VI_FUNC rsspecan_Get3GPPBSCDPListEvaluationResult(ViSession instrSessi
 	}
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -905,7 +905,7 @@ ViStatus _VI_FUNC rsspecan_QueryFMStereoMeasurementResults(
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -987,7 +987,7 @@ ViStatus _VI_FUNC rsspecan_ReadBC2KSEMPeakList(
 	checkErr(RsCore_LockSession(instrSession));
 
 	arrayLength = 3 * numberOfValues;
-	data = malloc(sizeof(ViReal64) * arrayLength);
+	data = RsCore_Malloc(instrSession, sizeof(ViReal64) * arrayLength);
 
 	checkErr(rsspecan_dataReadTrace(instrSession, window, "FINal1", arrayLength, data, &retVal));
 
@@ -1008,7 +1008,7 @@ ViStatus _VI_FUNC rsspecan_ReadBC2KSEMPeakList(
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1044,7 +1044,7 @@ ViStatus _VI_FUNC rsspecan_QueryBC2KCodeDomainAnalyzerResultSummary(
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (buf) free(buf);
+	if (buf) RsCore_Free(instrSession, buf);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1826,7 +1826,7 @@ ViStatus _VI_FUNC rsspecan_ReadBDOSEMPeakList(
 	checkErr(RsCore_LockSession(instrSession));
 
 	arrayLength = 3 * numberOfValues;
-	data = malloc(sizeof(ViReal64) * arrayLength);
+	data = RsCore_Malloc(instrSession, sizeof(ViReal64) * arrayLength);
 
 	checkErr(rsspecan_dataReadTrace(instrSession, window, "FINal1", arrayLength, data, &retVal));
 
@@ -1847,7 +1847,7 @@ ViStatus _VI_FUNC rsspecan_ReadBDOSEMPeakList(
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1921,7 +1921,7 @@ ViStatus _VI_FUNC rsspecan_ReadBDOPowerVsTimeListEvaluation(ViSession instrSessi
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (data) free(data);
+	if (data) RsCore_Free(instrSession, data);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
@@ -1957,7 +1957,7 @@ ViStatus _VI_FUNC rsspecan_QueryBDOCodeDomainAnalyzerGeneralResults(
 	checkErr(rsspecan_CheckStatus(instrSession));
 
 Error:
-	if (buf) free(buf);
+	if (buf) RsCore_Free(instrSession, buf);
 	(void)RsCore_UnlockSession(instrSession);
 	return error;
 }
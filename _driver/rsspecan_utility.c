@@ -17,6 +17,41 @@
  * Function: rsspecan_InitAttributes
  * Purpose:  This function inits attributes to the desired values if needed.
  *****************************************************************************/
+static const RsCoreAttributeSetting rsspecan_IdentificationSettings[] =
+{
+	// - Class Driver Identification
+	{RS_ATTR_CLASS_DRIVER_DESCRIPTION, 0, RSSPECAN_CLASS_DRIVER_DESCRIPTION},
+	{RS_ATTR_CLASS_DRIVER_PREFIX, 0, RSSPECAN_CLASS_DRIVER_PREFIX},
+	{RS_ATTR_CLASS_DRIVER_VENDOR, 0, RSSPECAN_CLASS_DRIVER_VENDOR},
+	{RS_ATTR_CLASS_DRIVER_REVISION, 0, RSSPECAN_CLASS_DRIVER_REVISION},
+	{RS_ATTR_CLASS_DRIVER_CLASS_SPEC_MAJOR_VERSION, RSSPECAN_CLASS_SPEC_MAJOR_VERSION, NULL},
+	{RS_ATTR_CLASS_DRIVER_CLASS_SPEC_MINOR_VERSION, RSSPECAN_CLASS_SPEC_MINOR_VERSION, NULL},
+
+	// - Driver Identification
+	{RS_ATTR_SPECIFIC_DRIVER_DESCRIPTION, 0, RSSPECAN_SPECIFIC_DRIVER_DESCRIPTION},
+	{RS_ATTR_SPECIFIC_DRIVER_PREFIX, 0, RSSPECAN_SPECIFIC_DRIVER_PREFIX},
+	{RS_ATTR_SPECIFIC_DRIVER_LOCATOR, 0, RSSPECAN_SPECIFIC_DRIVER_LOCATOR},
+	{RS_ATTR_SPECIFIC_DRIVER_VENDOR, 0, RSSPECAN_SPECIFIC_DRIVER_VENDOR},
+
+	{RS_ATTR_SPECIFIC_DRIVER_CLASS_SPEC_MAJOR_VERSION, RSSPECAN_CLASS_SPEC_MAJOR_VERSION, NULL},
+	{RS_ATTR_SPECIFIC_DRIVER_CLASS_SPEC_MINOR_VERSION, RSSPECAN_CLASS_SPEC_MINOR_VERSION, NULL},
+
+	// - Driver Capabilities
+	{RS_ATTR_SUPPORTED_INSTRUMENT_MODELS, 0, RSSPECAN_SUPPORTED_INSTRUMENT_MODELS},
+	{RS_ATTR_GROUP_CAPABILITIES, 0, RSSPECAN_GROUP_CAPABILITIES},
+	{RS_ATTR_FUNCTION_CAPABILITIES, 0, RSSPECAN_FUNCTION_CAPABILITIES},
+
+	// - Version Info
+	{RS_ATTR_SPECIFIC_DRIVER_MAJOR_VERSION, RSSPECAN_MAJOR_VERSION, NULL},
+	{RS_ATTR_SPECIFIC_DRIVER_MINOR_VERSION, RSSPECAN_MINOR_VERSION, NULL},
+	{RS_ATTR_SPECIFIC_DRIVER_MINOR_MINOR_VERSION, RSSPECAN_MINOR_MINOR_VERSION, NULL},
+
+	{RS_ATTR_CLASS_DRIVER_MAJOR_VERSION, RSSPECAN_CLASS_SPEC_MAJOR_VERSION, NULL},
+	{RS_ATTR_CLASS_DRIVER_MINOR_VERSION, RSSPECAN_CLASS_SPEC_MINOR_VERSION, NULL},
+
+	{0, 0, NULL}
+};
+
 ViStatus rsspecan_InitAttributes(ViSession instrSession)
 {
 	ViStatus error = VI_SUCCESS;
@@ -33,35 +68,8 @@ ViStatus rsspecan_InitAttributes(ViSession instrSession)
 	// This is important for CheckInstrumentOptions() function used in all attributes and some hi-level functions
 	checkErr(RsCore_QueryAndParseOPTstring(instrSession, RSSPECAN_SIMULATION_OPT_QUERY, RS_VAL_OPTIONS_PARSING_AUTO));
 
-	// - Class Driver Identification
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_CLASS_DRIVER_DESCRIPTION, 0, RSSPECAN_CLASS_DRIVER_DESCRIPTION));
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_CLASS_DRIVER_PREFIX, 0, RSSPECAN_CLASS_DRIVER_PREFIX));
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_CLASS_DRIVER_VENDOR, 0, RSSPECAN_CLASS_DRIVER_VENDOR));
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_CLASS_DRIVER_REVISION, 0, RSSPECAN_CLASS_DRIVER_REVISION));
-	checkErr(RsCore_SetAttributeViInt32(instrSession, "", RS_ATTR_CLASS_DRIVER_CLASS_SPEC_MAJOR_VERSION, 0, RSSPECAN_CLASS_SPEC_MAJOR_VERSION));
-	checkErr(RsCore_SetAttributeViInt32(instrSession, "", RS_ATTR_CLASS_DRIVER_CLASS_SPEC_MINOR_VERSION, 0, RSSPECAN_CLASS_SPEC_MINOR_VERSION));
-
-	// - Driver Identification
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_SPECIFIC_DRIVER_DESCRIPTION, 0, RSSPECAN_SPECIFIC_DRIVER_DESCRIPTION));
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_SPECIFIC_DRIVER_PREFIX, 0, RSSPECAN_SPECIFIC_DRIVER_PREFIX));
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_SPECIFIC_DRIVER_LOCATOR, 0, RSSPECAN_SPECIFIC_DRIVER_LOCATOR));
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_SPECIFIC_DRIVER_VENDOR, 0, RSSPECAN_SPECIFIC_DRIVER_VENDOR));
-
-	checkErr(RsCore_SetAttributeViInt32(instrSession, "", RS_ATTR_SPECIFIC_DRIVER_CLASS_SPEC_MAJOR_VERSION, 0, RSSPECAN_CLASS_SPEC_MAJOR_VERSION));
-	checkErr(RsCore_SetAttributeViInt32(instrSession, "", RS_ATTR_SPECIFIC_DRIVER_CLASS_SPEC_MINOR_VERSION, 0, RSSPECAN_CLASS_SPEC_MINOR_VERSION));
-
-	// - Driver Capabilities
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_SUPPORTED_INSTRUMENT_MODELS, 0, RSSPECAN_SUPPORTED_INSTRUMENT_MODELS));
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_GROUP_CAPABILITIES, 0, RSSPECAN_GROUP_CAPABILITIES));
-	checkErr(RsCore_SetAttributeViString(instrSession, "", RS_ATTR_FUNCTION_CAPABILITIES, 0, RSSPECAN_FUNCTION_CAPABILITIES));
-
-	// - Version Info
-	checkErr(RsCore_SetAttributeViInt32(instrSession, "", RS_ATTR_SPECIFIC_DRIVER_MAJOR_VERSION, 0, RSSPECAN_MAJOR_VERSION));
-	checkErr(RsCore_SetAttributeViInt32(instrSession, "", RS_ATTR_SPECIFIC_DRIVER_MINOR_VERSION, 0, RSSPECAN_MINOR_VERSION));
-	checkErr(RsCore_SetAttributeViInt32(instrSession, "", RS_ATTR_SPECIFIC_DRIVER_MINOR_MINOR_VERSION, 0, RSSPECAN_MINOR_MINOR_VERSION));
-
-	checkErr(RsCore_SetAttributeViInt32(instrSession, "", RS_ATTR_CLASS_DRIVER_MAJOR_VERSION, 0, RSSPECAN_CLASS_SPEC_MAJOR_VERSION));
-	checkErr(RsCore_SetAttributeViInt32(instrSession, "", RS_ATTR_CLASS_DRIVER_MINOR_VERSION, 0, RSSPECAN_CLASS_SPEC_MINOR_VERSION));
+	// Class driver identification, driver identification, capabilities and version info
+	checkErr(RsCore_ApplyAttributeSettings(instrSession, rsspecan_IdentificationSettings));
 
 	checkErr(RsCore_SetSpecificDriverRevision(instrSession, RS_ATTR_SPECIFIC_DRIVER_REVISION));
 
@@ -213,12 +221,49 @@ ViStatus rsspecan_dataReadTrace(ViSession instrSession, ViInt32 window, ViString
 {
 	ViStatus error = VI_SUCCESS;
 	ViReal64* responseArray = NULL;
+	ViChar sweepQuery[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar dataQuery[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar repCap[RS_REPCAP_BUF_SIZE];
+	ViStatus copyStatus;
+	ViBoolean continuous = VI_TRUE;
+	ViInt32 sweepCount = 0;
+
+	if (RsCore_TraceCacheEnabled(instrSession))
+	{
+		// The sweep number identifies the trace only in single sweep with a sweep count.
+		// A continuous sweep updates the trace without a new sweep number, its traces are never cached
+		snprintf(repCap, RS_REPCAP_BUF_SIZE, "Win" _PERCD, window > 0 ? window : 1);
+		checkErr(rsspecan_GetAttributeViBoolean(instrSession, repCap, RSSPECAN_ATTR_SWEEP_MODE_CONTINUOUS, &continuous));
+		if (continuous == VI_FALSE)
+			checkErr(rsspecan_GetAttributeViInt32(instrSession, repCap, RSSPECAN_ATTR_NUMBER_OF_SWEEPS, &sweepCount));
+	}
+
+	if (continuous == VI_FALSE && sweepCount > 0)
+	{
+		// The sweep number is read together with the trace, traces of the same sweep come from the cache
+		if (window == 0)
+		{
+			snprintf(sweepQuery, RS_MAX_MESSAGE_BUF_SIZE, ":SENS:SWE:COUN:CURR?");
+			snprintf(dataQuery, RS_MAX_MESSAGE_BUF_SIZE, ":FORM REAL,32;:TRAC? %s", trace);
+		}
+		else
+		{
+			snprintf(sweepQuery, RS_MAX_MESSAGE_BUF_SIZE, ":SENS%ld:SWE:COUN:CURR?", window);
+			snprintf(dataQuery, RS_MAX_MESSAGE_BUF_SIZE, ":FORM REAL,32;:TRAC%ld? %s", window, trace);
+		}
+
+		checkErr(RsCore_QueryFloatArraySweepCached(instrSession, sweepQuery, dataQuery, arrayLength, traceData, noofPoints, NULL));
+		copyStatus = error;
+		checkErr(rsspecan_CheckStatus(instrSession));
+		error = copyStatus;
+		goto Error;
+	}
 
 	checkErr(rsspecan_dataReadTraceDynSize(instrSession, window, trace, &responseArray, noofPoints));
 	checkErr(RsCore_CopyToUserBufferViReal64Array(instrSession, traceData, arrayLength, responseArray, *noofPoints));
 
 Error:
-	if (responseArray) free(responseArray);
+	if (responseArray) RsCore_Free(instrSession, responseArray);
 	return error;
 }
 
@@ -249,3 +294,96 @@ ViStatus rsspecan_dataReadTraceDynSize(ViSession instrSession, ViInt32 window, V
 Error:
 	return error;
 }
+
+/*===========================================================================*/
+/* Function: Read Trace Data Columns                                         */
+/* Purpose:  This function reads out trace data ordered in rows of           */
+/*           columnsCount values and returns each column in its own array.   */
+/*           It works with ASCII or binary float data                        */
+/*===========================================================================*/
+ViStatus rsspecan_dataReadTraceColumns(ViSession instrSession, ViInt32 window, ViString trace, ViInt32 columnsCount,
+                                       ViReal64* columns[], ViInt32 columnSize, ViInt32* rowsCount)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar cmd[RS_MAX_MESSAGE_BUF_SIZE];
+
+	checkErr(RsCore_Write(instrSession, ":FORM REAL,32"));
+
+	if (window == 0)
+	{
+		snprintf(cmd, RS_MAX_MESSAGE_BUF_SIZE, ":TRAC? %s", trace);
+	}
+	else
+	{
+		snprintf(cmd, RS_MAX_MESSAGE_BUF_SIZE, ":TRAC%ld? %s", window, trace);
+	}
+
+	checkErr(RsCore_QueryFloatArrayColumns(instrSession, cmd, columnsCount, columns, columnSize, rowsCount));
+	checkErr(rsspecan_CheckStatus(instrSession));
+
+Error:
+	return error;
+}
+
+/*===========================================================================*/
+/* Function: Read Trace Data To Archive                                      */
+/* Purpose:  This function reads out trace data in binary float format       */
+/*           directly into the next row of the trace archive, together with  */
+/*           the current sweep number and time                               */
+/*===========================================================================*/
+ViStatus rsspecan_dataReadTraceToArchive(ViSession instrSession, ViInt32 window, ViString trace, RsCoreTraceArchive* archive)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar sweepQuery[RS_MAX_MESSAGE_BUF_SIZE];
+	ViChar dataQuery[RS_MAX_MESSAGE_BUF_SIZE];
+
+	if (window == 0)
+	{
+		snprintf(sweepQuery, RS_MAX_MESSAGE_BUF_SIZE, ":SENS:SWE:COUN:CURR?");
+		snprintf(dataQuery, RS_MAX_MESSAGE_BUF_SIZE, ":FORM REAL,32;:TRAC? %s", trace);
+	}
+	else
+	{
+		snprintf(sweepQuery, RS_MAX_MESSAGE_BUF_SIZE, ":SENS" _PERCD ":SWE:COUN:CURR?", window);
+		snprintf(dataQuery, RS_MAX_MESSAGE_BUF_SIZE, ":FORM REAL,32;:TRAC" _PERCD "? %s", window, trace);
+	}
+
+	checkErr(RsCore_QueryTraceToArchive(instrSession, sweepQuery, dataQuery, archive, RsCore_TraceArchiveTimeNow()));
+	checkErr(rsspecan_CheckStatus(instrSession));
+
+Error:
+	return error;
+}
+
+/*===========================================================================*/
+/* Function: Read Trace Data Decimated                                       */
+/* Purpose:  This function reads out trace data and decimates it to the      */
+/*           decimation width in one pass over the binary float data.        */
+/*           The full trace is optional, set traceData to NULL if not needed */
+/*===========================================================================*/
+ViStatus rsspecan_dataReadTraceDecimated(ViSession instrSession, ViInt32 window, ViString trace, RsCoreDecimation* decimation,
+                                         ViInt32 arrayLength, ViReal64 traceData[], ViPInt32 noofPoints)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar cmd[RS_MAX_MESSAGE_BUF_SIZE];
+	ViStatus copyStatus;
+
+	checkErr(RsCore_Write(instrSession, ":FORM REAL,32"));
+
+	if (window == 0)
+	{
+		snprintf(cmd, RS_MAX_MESSAGE_BUF_SIZE, ":TRAC? %s", trace);
+	}
+	else
+	{
+		snprintf(cmd, RS_MAX_MESSAGE_BUF_SIZE, ":TRAC" _PERCD "? %s", window, trace);
+	}
+
+	checkErr(RsCore_QueryFloatArrayDecimated(instrSession, cmd, decimation, arrayLength, traceData, noofPoints));
+	copyStatus = error;
+	checkErr(rsspecan_CheckStatus(instrSession));
+	error = copyStatus;
+
+Error:
+	return error;
+}
@@ -12,4 +12,7 @@ ViStatus rsspecan_SetOPCTimeout(ViSession   instrSession, ViInt32 timeout);
 ViStatus rsspecan_GetOPCTimeout(ViSession   instrSession, ViInt32 *timeout);
 ViBoolean rsspecan_IsFSV (ViSession instrSession);
 ViStatus rsspecan_dataReadTrace(ViSession instrSession,	ViInt32 window, ViString trace, ViInt32 arrayLength, ViReal64 traceData[], ViPInt32 noofPoints);
-ViStatus rsspecan_dataReadTraceDynSize(ViSession instrSession, ViInt32 window, ViString trace, ViReal64** traceData, ViInt32* noofPoints);
\ No newline at end of file
+ViStatus rsspecan_dataReadTraceDynSize(ViSession instrSession, ViInt32 window, ViString trace, ViReal64** traceData, ViInt32* noofPoints);
+ViStatus rsspecan_dataReadTraceColumns(ViSession instrSession, ViInt32 window, ViString trace, ViInt32 columnsCount, ViReal64* columns[], ViInt32 columnSize, ViInt32* rowsCount);
+ViStatus rsspecan_dataReadTraceToArchive(ViSession instrSession, ViInt32 window, ViString trace, RsCoreTraceArchive* archive);
+ViStatus rsspecan_dataReadTraceDecimated(ViSession instrSession, ViInt32 window, ViString trace, RsCoreDecimation* decimation, ViInt32 arrayLength, ViReal64 traceData[], ViPInt32 noofPoints);
\ No newline at end of file
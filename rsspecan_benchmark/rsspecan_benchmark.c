@@ -0,0 +1,631 @@
+/*	rsspecan core microbenchmarks
+	Measures the host-side cost of the core operations with the mock VISA library (zero IO latency),
+	or against a real instrument / the rsspecan_emulator when the resource name is entered:
+	- attribute set/get, cached and uncached
+	- RsCore_BuildAttrCommandString with repeated capabilities
+	- binary data block and ASCII array conversion
+	- float array queries
+	- session open/close
+	- session lock contention with 1 to 8 threads
+	Results are printed as JSON (default) or CSV, one record per benchmark, to compare the runs and catch regressions.
+
+	Usage: rsspecan_benchmark [--format json|csv] [--output file] [--quick] [--filter text] [--resource name] [--options string]
+
+	Original Release: October 2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "rscore.h"
+
+/*****************************************************************************************************/
+/*  Attributes used by the benchmarks
+    Inherent attributes needed by the core, plus a few instrument attributes with commands
+******************************************************************************************************/
+#define BENCH_ATTR_FREQUENCY_CENTER         (RS_SPECIFIC_PUBLIC_ATTR_BASE + 1)
+#define BENCH_ATTR_FREQUENCY_SPAN           (RS_SPECIFIC_PUBLIC_ATTR_BASE + 2)
+#define BENCH_ATTR_SWEEP_POINTS             (RS_SPECIFIC_PUBLIC_ATTR_BASE + 3)
+#define BENCH_ATTR_MARKER_POSITION          (RS_SPECIFIC_PUBLIC_ATTR_BASE + 4)
+
+#define BENCH_INHERENT(id, type) \
+	static RsCoreAttribute g_BENCH_##id = { .constant = id, .access = RS_VAL_READ_WRITE, .dataType = type }
+
+#define BENCH_INSTRUMENT(id, type, cmd, attrFlags, repCaps) \
+	static RsCoreAttribute g_BENCH_##id = { .constant = id, .access = RS_VAL_READ_WRITE, .dataType = type, \
+		.command = cmd, .flags = attrFlags, .usercaps = repCaps }
+
+BENCH_INHERENT(RS_ATTR_RANGE_CHECK, RS_VAL_BOOLEAN);
+BENCH_INHERENT(RS_ATTR_QUERY_INSTRUMENT_STATUS, RS_VAL_BOOLEAN);
+BENCH_INHERENT(RS_ATTR_CACHE, RS_VAL_BOOLEAN);
+BENCH_INHERENT(RS_ATTR_SIMULATE, RS_VAL_BOOLEAN);
+BENCH_INHERENT(RS_ATTR_SPECIFIC_DRIVER_PREFIX, RS_VAL_STRING);
+BENCH_INHERENT(RS_ATTR_SPECIFIC_DRIVER_REVISION, RS_VAL_STRING);
+BENCH_INHERENT(RS_ATTR_SPECIFIC_DRIVER_MAJOR_VERSION, RS_VAL_INT32);
+BENCH_INHERENT(RS_ATTR_SPECIFIC_DRIVER_MINOR_VERSION, RS_VAL_INT32);
+BENCH_INHERENT(RS_ATTR_SPECIFIC_DRIVER_MINOR_MINOR_VERSION, RS_VAL_INT32);
+BENCH_INHERENT(RS_ATTR_ENGINE_MAJOR_VERSION, RS_VAL_INT32);
+BENCH_INHERENT(RS_ATTR_ENGINE_MINOR_VERSION, RS_VAL_INT32);
+BENCH_INHERENT(RS_ATTR_ENGINE_REVISION, RS_VAL_STRING);
+BENCH_INHERENT(RS_ATTR_CHANNEL_COUNT, RS_VAL_INT32);
+BENCH_INHERENT(RS_ATTR_DRIVER_SETUP, RS_VAL_STRING);
+BENCH_INHERENT(RS_ATTR_INSTRUMENT_MANUFACTURER, RS_VAL_STRING);
+BENCH_INHERENT(RS_ATTR_INSTRUMENT_MODEL, RS_VAL_STRING);
+BENCH_INHERENT(RS_ATTR_INSTRUMENT_FIRMWARE_REVISION, RS_VAL_STRING);
+BENCH_INHERENT(RS_ATTR_OPTIONS_LIST, RS_VAL_STRING);
+BENCH_INHERENT(RS_ATTR_IO_RESOURCE_DESCRIPTOR, RS_VAL_STRING);
+BENCH_INHERENT(RS_ATTR_PRIMARY_ERROR, RS_VAL_INT32);
+BENCH_INHERENT(RS_ATTR_SECONDARY_ERROR, RS_VAL_INT32);
+BENCH_INHERENT(RS_ATTR_ERROR_ELABORATION, RS_VAL_STRING);
+BENCH_INHERENT(RS_ATTR_VISA_RM_SESSION, RS_VAL_SESSION);
+BENCH_INHERENT(RS_ATTR_OPC_CALLBACK, RS_VAL_ADDR);
+BENCH_INHERENT(RS_ATTR_CHECK_STATUS_CALLBACK, RS_VAL_ADDR);
+BENCH_INHERENT(RS_ATTR_OPC_TIMEOUT, RS_VAL_INT32);
+
+BENCH_INSTRUMENT(BENCH_ATTR_FREQUENCY_CENTER, RS_VAL_REAL64, "SENS:FREQ:CENT", 0, VI_FALSE);
+BENCH_INSTRUMENT(BENCH_ATTR_FREQUENCY_SPAN, RS_VAL_REAL64, "SENS:FREQ:SPAN", RS_VAL_NEVER_CACHE, VI_FALSE);
+BENCH_INSTRUMENT(BENCH_ATTR_SWEEP_POINTS, RS_VAL_INT32, "SENS{Window}:SWE:POIN", 0, VI_TRUE);
+BENCH_INSTRUMENT(BENCH_ATTR_MARKER_POSITION, RS_VAL_REAL64, "CALC{Window}:MARK{Marker}:X", 0, VI_TRUE);
+
+static RsCoreAttributePtr gBenchAttributes[] = {
+	&g_BENCH_RS_ATTR_RANGE_CHECK,
+	&g_BENCH_RS_ATTR_QUERY_INSTRUMENT_STATUS,
+	&g_BENCH_RS_ATTR_CACHE,
+	&g_BENCH_RS_ATTR_SIMULATE,
+	&g_BENCH_RS_ATTR_SPECIFIC_DRIVER_PREFIX,
+	&g_BENCH_RS_ATTR_SPECIFIC_DRIVER_REVISION,
+	&g_BENCH_RS_ATTR_SPECIFIC_DRIVER_MAJOR_VERSION,
+	&g_BENCH_RS_ATTR_SPECIFIC_DRIVER_MINOR_VERSION,
+	&g_BENCH_RS_ATTR_SPECIFIC_DRIVER_MINOR_MINOR_VERSION,
+	&g_BENCH_RS_ATTR_ENGINE_MAJOR_VERSION,
+	&g_BENCH_RS_ATTR_ENGINE_MINOR_VERSION,
+	&g_BENCH_RS_ATTR_ENGINE_REVISION,
+	&g_BENCH_RS_ATTR_CHANNEL_COUNT,
+	&g_BENCH_RS_ATTR_DRIVER_SETUP,
+	&g_BENCH_RS_ATTR_INSTRUMENT_MANUFACTURER,
+	&g_BENCH_RS_ATTR_INSTRUMENT_MODEL,
+	&g_BENCH_RS_ATTR_INSTRUMENT_FIRMWARE_REVISION,
+	&g_BENCH_RS_ATTR_OPTIONS_LIST,
+	&g_BENCH_RS_ATTR_IO_RESOURCE_DESCRIPTOR,
+	&g_BENCH_RS_ATTR_PRIMARY_ERROR,
+	&g_BENCH_RS_ATTR_SECONDARY_ERROR,
+	&g_BENCH_RS_ATTR_ERROR_ELABORATION,
+	&g_BENCH_RS_ATTR_VISA_RM_SESSION,
+	&g_BENCH_RS_ATTR_OPC_CALLBACK,
+	&g_BENCH_RS_ATTR_CHECK_STATUS_CALLBACK,
+	&g_BENCH_RS_ATTR_OPC_TIMEOUT,
+	&g_BENCH_BENCH_ATTR_FREQUENCY_CENTER,
+	&g_BENCH_BENCH_ATTR_FREQUENCY_SPAN,
+	&g_BENCH_BENCH_ATTR_SWEEP_POINTS,
+	&g_BENCH_BENCH_ATTR_MARKER_POSITION,
+	NULL
+};
+
+static RsCoreRepCap gBenchRepCapTable[] = {
+	{"Window", "Win1,Win2,Win3,Win4,Win5,Win6,Win7,Win8,Win9,Win10,Win11,Win12,Win13,Win14,Win15,Win16", "1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16"},
+	{"Marker", "M1,M2,M3,M4,M5,M6,M7,M8,M9,M10,M11,M12,M13,M14,M15,M16", "1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16"},
+	{NULL, NULL, NULL}
+};
+
+/*****************************************************************************************************/
+/*  Benchmark framework
+******************************************************************************************************/
+#define BENCH_REPETITIONS   5
+#define BENCH_MAX_THREADS   8
+
+typedef ViStatus (*BenchFunction)(ViSession instrSession, ViInt32 iterations);
+
+typedef struct
+{
+	ViConstString name;
+	BenchFunction function;
+	ViInt32 iterations; // Iterations of one repetition, divided by 100 in the quick mode
+	ViInt32 threads; // Number of threads running the function in parallel, 0 = single-threaded
+} BenchDefinition;
+
+typedef struct
+{
+	ViSession instrSession;
+	BenchFunction function;
+	ViInt32 iterations;
+	ViStatus error;
+	pthread_barrier_t* barrier;
+} BenchThread;
+
+static struct
+{
+	ViConstString format;
+	ViConstString outputFile;
+	ViConstString filter;
+	ViConstString resource;
+	ViConstString options;
+	ViBoolean quick;
+} gBenchSettings = {"json", NULL, NULL, "TCPIP::mock::INSTR", "QueryInstrStatus=False,Cache=True", VI_FALSE};
+
+static ViByte* gBinaryBlock = NULL;
+static ViChar* gAsciiArray = NULL;
+static ViInt32 gArrayPoints = 0;
+
+static ViReal64 BenchTimeNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ViReal64)ts.tv_sec * 1.0e9 + (ViReal64)ts.tv_nsec;
+}
+
+static int BenchCompareReal64(const void* a, const void* b)
+{
+	ViReal64 x = *(const ViReal64*)a;
+	ViReal64 y = *(const ViReal64*)b;
+
+	return (x > y) - (x < y);
+}
+
+static ViStatus BenchOpenSession(ViConstString optionsString, ViSession* instrSession)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar options[RS_MAX_MESSAGE_BUF_SIZE];
+
+	snprintf(options, sizeof(options), "%s%s%s", gBenchSettings.options, optionsString[0] ? "," : "", optionsString);
+	checkErr(RsCore_NewSpecificDriver((ViRsrc)gBenchSettings.resource, "bench", options, gBenchAttributes,
+		0, 0, 1000000, RS_VAL_OPCWAIT_STBPOLLING, 10000, 5000, 600000,
+		RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES, RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES, instrSession));
+	checkErr(RsCore_ApplyOptionString(*instrSession, options));
+	checkErr(RsCore_BuildRepCapTable(*instrSession, gBenchRepCapTable));
+
+Error:
+	return error;
+}
+
+static void BenchCloseSession(ViSession instrSession)
+{
+	(void)RsCore_ViClose(instrSession);
+	(void)RsCore_Dispose(instrSession);
+}
+
+/*****************************************************************************************************/
+/*  Benchmarks
+******************************************************************************************************/
+static ViStatus BenchAttrSetReal64(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 i;
+
+	// Alternating values, each set goes to the instrument
+	for (i = 0; i < iterations; i++)
+		checkErr(RsCore_SetAttributeViReal64(instrSession, NULL, BENCH_ATTR_FREQUENCY_CENTER, 0, 1.0e9 + (ViReal64)(i & 1)));
+
+Error:
+	return error;
+}
+
+static ViStatus BenchAttrSetReal64CacheHit(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 i;
+
+	for (i = 0; i < iterations; i++)
+		checkErr(RsCore_SetAttributeViReal64(instrSession, NULL, BENCH_ATTR_FREQUENCY_CENTER, 0, 2.0e9));
+
+Error:
+	return error;
+}
+
+static ViStatus BenchAttrGetReal64Cached(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViReal64 value;
+	ViInt32 i;
+
+	checkErr(RsCore_SetAttributeViReal64(instrSession, NULL, BENCH_ATTR_FREQUENCY_CENTER, 0, 3.0e9));
+	for (i = 0; i < iterations; i++)
+		checkErr(RsCore_GetAttributeViReal64(instrSession, NULL, BENCH_ATTR_FREQUENCY_CENTER, 0, &value));
+
+Error:
+	return error;
+}
+
+static ViStatus BenchAttrGetReal64Uncached(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViReal64 value;
+	ViInt32 i;
+
+	for (i = 0; i < iterations; i++)
+		checkErr(RsCore_GetAttributeViReal64(instrSession, NULL, BENCH_ATTR_FREQUENCY_SPAN, 0, &value));
+
+Error:
+	return error;
+}
+
+static ViStatus BenchAttrSetInt32RepCap(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 i;
+
+	for (i = 0; i < iterations; i++)
+		checkErr(RsCore_SetAttributeViInt32(instrSession, "Win2", BENCH_ATTR_SWEEP_POINTS, 0, 1001 + (i & 1)));
+
+Error:
+	return error;
+}
+
+static ViStatus BenchBuildAttrCommandString(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViChar* cmd = NULL;
+	ViInt32 i;
+
+	for (i = 0; i < iterations; i++)
+	{
+		checkErr(RsCore_BuildAttrCommandString(instrSession, &g_BENCH_BENCH_ATTR_MARKER_POSITION, "Win3,M12", &cmd));
+		RsCore_Free(instrSession, cmd);
+		cmd = NULL;
+	}
+
+Error:
+	return error;
+}
+
+static ViStatus BenchBinaryBlockToFloat32(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViReal64* values = NULL;
+	ViInt32 count;
+	ViInt32 i;
+
+	for (i = 0; i < iterations; i++)
+	{
+		checkErr(RsCore_Convert_BinaryDataBlock_To_Float32Array(instrSession, gBinaryBlock, gArrayPoints * 4, &values, &count, VI_FALSE));
+		RsCore_Free(instrSession, values);
+		values = NULL;
+	}
+
+Error:
+	return error;
+}
+
+static ViStatus BenchAsciiToReal64Array(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViReal64* values = NULL;
+	ViInt32 count;
+	ViInt32 i;
+
+	for (i = 0; i < iterations; i++)
+	{
+		checkErr(RsCore_Convert_String_To_ViReal64Array(instrSession, gAsciiArray, &values, &count));
+		RsCore_Free(instrSession, values);
+		values = NULL;
+	}
+
+Error:
+	return error;
+}
+
+static ViStatus BenchQueryFloatArrayReal32(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViReal64* values = NULL;
+	ViInt32 count;
+	ViInt32 i;
+
+	for (i = 0; i < iterations; i++)
+	{
+		checkErr(RsCore_QueryFloatArray(instrSession, ":FORM REAL,32;:TRAC? TRACE1", &values, &count));
+		RsCore_Free(instrSession, values);
+		values = NULL;
+	}
+
+Error:
+	return error;
+}
+
+static ViStatus BenchQueryFloatArrayAscii(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViReal64* values = NULL;
+	ViInt32 count;
+	ViInt32 i;
+
+	for (i = 0; i < iterations; i++)
+	{
+		checkErr(RsCore_QueryFloatArray(instrSession, ":FORM ASC;:TRAC? TRACE1", &values, &count));
+		RsCore_Free(instrSession, values);
+		values = NULL;
+	}
+
+Error:
+	return error;
+}
+
+static ViStatus BenchIoTraceSnapshot(ViSession instrSession, ViInt32 iterations)
+{
+	static RsCoreIoTraceEntry entries[RS_IO_TRACE_ENTRIES];
+	ViStatus error = VI_SUCCESS;
+	ViInt32 count;
+	ViInt32 i;
+
+	for (i = 0; i < iterations; i++)
+	{
+		checkErr(RsCore_GetIoTrace(instrSession, RS_IO_TRACE_ENTRIES, entries, &count));
+	}
+
+Error:
+	return error;
+}
+
+static ViStatus BenchSessionOpenClose(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViSession newSession;
+	ViInt32 i;
+
+	(void)instrSession;
+	for (i = 0; i < iterations; i++)
+	{
+		checkErr(BenchOpenSession("", &newSession));
+		BenchCloseSession(newSession);
+	}
+
+Error:
+	return error;
+}
+
+static ViStatus BenchSessionOpenCloseSimulated(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViSession newSession;
+	ViInt32 i;
+
+	(void)instrSession;
+	for (i = 0; i < iterations; i++)
+	{
+		checkErr(BenchOpenSession("Simulate=True", &newSession));
+		BenchCloseSession(newSession);
+	}
+
+Error:
+	return error;
+}
+
+static ViStatus BenchLockUnlock(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 i;
+
+	for (i = 0; i < iterations; i++)
+	{
+		checkErr(RsCore_LockSession(instrSession));
+		checkErr(RsCore_UnlockSession(instrSession));
+	}
+
+Error:
+	return error;
+}
+
+static ViStatus BenchLockedAttrSet(ViSession instrSession, ViInt32 iterations)
+{
+	ViStatus error = VI_SUCCESS;
+	ViInt32 i;
+
+	// The pattern of every driver function: lock, set the attribute, unlock
+	for (i = 0; i < iterations; i++)
+	{
+		checkErr(RsCore_LockSession(instrSession));
+		error = RsCore_SetAttributeViReal64(instrSession, NULL, BENCH_ATTR_FREQUENCY_CENTER, 0, 1.0e9 + (ViReal64)(i & 1));
+		(void)RsCore_UnlockSession(instrSession);
+		checkErr(error);
+	}
+
+Error:
+	return error;
+}
+
+static const BenchDefinition gBenchmarks[] = {
+	{"attr_set_real64", BenchAttrSetReal64, 200000, 0},
+	{"attr_set_real64_cache_hit", BenchAttrSetReal64CacheHit, 500000, 0},
+	{"attr_get_real64_cached", BenchAttrGetReal64Cached, 500000, 0},
+	{"attr_get_real64_uncached", BenchAttrGetReal64Uncached, 200000, 0},
+	{"attr_set_int32_repcap", BenchAttrSetInt32RepCap, 200000, 0},
+	{"build_attr_command_string", BenchBuildAttrCommandString, 500000, 0},
+	{"binary_block_to_float32_1001", BenchBinaryBlockToFloat32, 100000, 0},
+	{"ascii_to_real64_array_1001", BenchAsciiToReal64Array, 5000, 0},
+	{"query_float_array_real32_1001", BenchQueryFloatArrayReal32, 20000, 0},
+	{"query_float_array_ascii_1001", BenchQueryFloatArrayAscii, 2000, 0},
+	{"io_trace_snapshot_256", BenchIoTraceSnapshot, 20000, 0},
+	{"session_open_close", BenchSessionOpenClose, 2000, 0},
+	{"session_open_close_simulated", BenchSessionOpenCloseSimulated, 2000, 0},
+	{"lock_unlock_1_thread", BenchLockUnlock, 1000000, 1},
+	{"lock_unlock_2_threads", BenchLockUnlock, 200000, 2},
+	{"lock_unlock_4_threads", BenchLockUnlock, 100000, 4},
+	{"lock_unlock_8_threads", BenchLockUnlock, 50000, 8},
+	{"locked_attr_set_4_threads", BenchLockedAttrSet, 20000, 4},
+	{NULL, NULL, 0, 0}
+};
+
+/*****************************************************************************************************/
+/*  Runner
+******************************************************************************************************/
+static void* BenchThreadFunction(void* argument)
+{
+	BenchThread* thread = (BenchThread*)argument;
+
+	pthread_barrier_wait(thread->barrier);
+	thread->error = thread->function(thread->instrSession, thread->iterations);
+
+	return NULL;
+}
+
+// Runs one repetition and returns its duration in ns. Multi-threaded runs measure the wall time of all threads
+static ViStatus BenchRunOnce(const BenchDefinition* bench, ViSession instrSession, ViInt32 iterations, ViReal64* durationNs)
+{
+	pthread_t handles[BENCH_MAX_THREADS];
+	BenchThread threads[BENCH_MAX_THREADS];
+	pthread_barrier_t barrier;
+	ViStatus error = VI_SUCCESS;
+	ViReal64 start;
+	ViInt32 i;
+
+	if (bench->threads == 0)
+	{
+		start = BenchTimeNs();
+		error = bench->function(instrSession, iterations);
+		*durationNs = BenchTimeNs() - start;
+		return error;
+	}
+
+	pthread_barrier_init(&barrier, NULL, (unsigned int)bench->threads + 1);
+	for (i = 0; i < bench->threads; i++)
+	{
+		threads[i].instrSession = instrSession;
+		threads[i].function = bench->function;
+		threads[i].iterations = iterations;
+		threads[i].error = VI_SUCCESS;
+		threads[i].barrier = &barrier;
+		pthread_create(&handles[i], NULL, BenchThreadFunction, &threads[i]);
+	}
+
+	start = BenchTimeNs();
+	pthread_barrier_wait(&barrier);
+	for (i = 0; i < bench->threads; i++)
+	{
+		pthread_join(handles[i], NULL);
+		if (threads[i].error < VI_SUCCESS)
+			error = threads[i].error;
+	}
+
+	*durationNs = BenchTimeNs() - start;
+	pthread_barrier_destroy(&barrier);
+
+	return error;
+}
+
+static void BenchPrepareArrays(void)
+{
+	ViInt32 i;
+	size_t length = 0;
+	ViReal32* floats;
+
+	gArrayPoints = 1001;
+	gBinaryBlock = (ViByte*)malloc((size_t)gArrayPoints * 4);
+	gAsciiArray = (ViChar*)malloc((size_t)gArrayPoints * 24);
+	floats = (ViReal32*)gBinaryBlock;
+	for (i = 0; i < gArrayPoints; i++)
+	{
+		floats[i] = -90.0f + (ViReal32)(i % 17) * 0.25f;
+		length += (size_t)sprintf(gAsciiArray + length, (i == 0) ? "%.6E" : ",%.6E", (double)floats[i]);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	ViStatus error = VI_SUCCESS;
+	ViSession instrSession = 0;
+	ViReal64 samples[BENCH_REPETITIONS];
+	ViChar errorMessage[RS_MAX_MESSAGE_BUF_SIZE];
+	const BenchDefinition* bench;
+	FILE* output = stdout;
+	ViInt32 iterations;
+	ViInt32 totalOps;
+	ViInt32 resultsCount = 0;
+	int i;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+			gBenchSettings.format = argv[++i];
+		else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+			gBenchSettings.outputFile = argv[++i];
+		else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+			gBenchSettings.filter = argv[++i];
+		else if (strcmp(argv[i], "--resource") == 0 && i + 1 < argc)
+			gBenchSettings.resource = argv[++i];
+		else if (strcmp(argv[i], "--options") == 0 && i + 1 < argc)
+			gBenchSettings.options = argv[++i];
+		else if (strcmp(argv[i], "--quick") == 0)
+			gBenchSettings.quick = VI_TRUE;
+		else
+		{
+			fprintf(stderr, "Usage: %s [--format json|csv] [--output file] [--quick] [--filter text] [--resource name] [--options string]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	if (strcmp(gBenchSettings.format, "json") != 0 && strcmp(gBenchSettings.format, "csv") != 0)
+	{
+		fprintf(stderr, "Unknown format '%s'\n", gBenchSettings.format);
+		return 2;
+	}
+
+	if (gBenchSettings.outputFile != NULL && (output = fopen(gBenchSettings.outputFile, "w")) == NULL)
+	{
+		fprintf(stderr, "Cannot open the output file '%s'\n", gBenchSettings.outputFile);
+		return 2;
+	}
+
+	BenchPrepareArrays();
+	checkErr(BenchOpenSession("MultiThreadLocking=True", &instrSession));
+
+	if (strcmp(gBenchSettings.format, "json") == 0)
+		fprintf(output, "{\n  \"resource\": \"%s\",\n  \"quick\": %s,\n  \"results\": [", gBenchSettings.resource, gBenchSettings.quick ? "true" : "false");
+	else
+		fprintf(output, "name,threads,iterations,ns_per_op_median,ns_per_op_min,ops_per_sec\n");
+
+	for (bench = gBenchmarks; bench->name != NULL; bench++)
+	{
+		if (gBenchSettings.filter != NULL && strstr(bench->name, gBenchSettings.filter) == NULL)
+			continue;
+
+		iterations = gBenchSettings.quick ? (bench->iterations / 100 > 0 ? bench->iterations / 100 : 1) : bench->iterations;
+		totalOps = iterations * (bench->threads > 0 ? bench->threads : 1);
+
+		// Warm-up, then the measured repetitions
+		checkErr(BenchRunOnce(bench, instrSession, iterations / 10 + 1, &samples[0]));
+		for (i = 0; i < BENCH_REPETITIONS; i++)
+		{
+			checkErr(BenchRunOnce(bench, instrSession, iterations, &samples[i]));
+			samples[i] /= (ViReal64)totalOps;
+		}
+
+		qsort(samples, BENCH_REPETITIONS, sizeof(ViReal64), BenchCompareReal64);
+		if (strcmp(gBenchSettings.format, "json") == 0)
+			fprintf(output, "%s\n    {\"name\": \"%s\", \"threads\": %ld, \"iterations\": %ld, \"ns_per_op_median\": %.1f, \"ns_per_op_min\": %.1f, \"ops_per_sec\": %.0f}",
+			        resultsCount > 0 ? "," : "", bench->name, (long)(bench->threads > 0 ? bench->threads : 1), (long)totalOps,
+			        samples[BENCH_REPETITIONS / 2], samples[0], 1.0e9 / samples[BENCH_REPETITIONS / 2]);
+		else
+			fprintf(output, "%s,%ld,%ld,%.1f,%.1f,%.0f\n", bench->name, (long)(bench->threads > 0 ? bench->threads : 1), (long)totalOps,
+			        samples[BENCH_REPETITIONS / 2], samples[0], 1.0e9 / samples[BENCH_REPETITIONS / 2]);
+
+		fflush(output);
+		resultsCount++;
+	}
+
+	if (strcmp(gBenchSettings.format, "json") == 0)
+		fprintf(output, "\n  ]\n}\n");
+
+Error:
+	if (error < VI_SUCCESS)
+	{
+		ViStatus primaryError = error;
+		ViStatus secondaryError = 0;
+
+		errorMessage[0] = 0;
+		(void)RsCore_GetErrorInfo(instrSession, &primaryError, &secondaryError, errorMessage);
+		fprintf(stderr, "Benchmark failed with error 0x%08X: %s\n", (unsigned int)error, errorMessage);
+	}
+
+	if (instrSession != 0)
+		BenchCloseSession(instrSession);
+
+	if (output != stdout)
+		fclose(output);
+
+	free(gBinaryBlock);
+	free(gAsciiArray);
+
+	return error < VI_SUCCESS ? 1 : 0;
+}
@@ -0,0 +1,615 @@
+/*	rsspecan core numeric algorithms test
+	Checks the host-side trace algorithms of the core against known inputs and results:
+	- trace accumulator statistics
+	- peak search, N dB bandwidth and markers
+	- limit line check
+	- multi-column (deinterleaved) float and integer array queries, with the mock VISA library
+	- trace archive appending and lookup
+	- trace decimation
+	- grouped job scheduling with dependencies
+	Prints one line per failed check and returns 1 if any check failed.
+
+	Usage: rsspecan_numeric_test
+
+	Original Release: October 2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "rscore.h"
+
+/*****************************************************************************************************/
+/*  Attributes needed by the core to open the mock session
+******************************************************************************************************/
+#define TEST_INHERENT(id, type) \
+	static RsCoreAttribute g_TEST_##id = { .constant = id, .access = RS_VAL_READ_WRITE, .dataType = type }
+
+TEST_INHERENT(RS_ATTR_RANGE_CHECK, RS_VAL_BOOLEAN);
+TEST_INHERENT(RS_ATTR_QUERY_INSTRUMENT_STATUS, RS_VAL_BOOLEAN);
+TEST_INHERENT(RS_ATTR_CACHE, RS_VAL_BOOLEAN);
+TEST_INHERENT(RS_ATTR_SIMULATE, RS_VAL_BOOLEAN);
+TEST_INHERENT(RS_ATTR_SPECIFIC_DRIVER_PREFIX, RS_VAL_STRING);
+TEST_INHERENT(RS_ATTR_SPECIFIC_DRIVER_REVISION, RS_VAL_STRING);
+TEST_INHERENT(RS_ATTR_SPECIFIC_DRIVER_MAJOR_VERSION, RS_VAL_INT32);
+TEST_INHERENT(RS_ATTR_SPECIFIC_DRIVER_MINOR_VERSION, RS_VAL_INT32);
+TEST_INHERENT(RS_ATTR_SPECIFIC_DRIVER_MINOR_MINOR_VERSION, RS_VAL_INT32);
+TEST_INHERENT(RS_ATTR_ENGINE_MAJOR_VERSION, RS_VAL_INT32);
+TEST_INHERENT(RS_ATTR_ENGINE_MINOR_VERSION, RS_VAL_INT32);
+TEST_INHERENT(RS_ATTR_ENGINE_REVISION, RS_VAL_STRING);
+TEST_INHERENT(RS_ATTR_CHANNEL_COUNT, RS_VAL_INT32);
+TEST_INHERENT(RS_ATTR_DRIVER_SETUP, RS_VAL_STRING);
+TEST_INHERENT(RS_ATTR_INSTRUMENT_MANUFACTURER, RS_VAL_STRING);
+TEST_INHERENT(RS_ATTR_INSTRUMENT_MODEL, RS_VAL_STRING);
+TEST_INHERENT(RS_ATTR_INSTRUMENT_FIRMWARE_REVISION, RS_VAL_STRING);
+TEST_INHERENT(RS_ATTR_OPTIONS_LIST, RS_VAL_STRING);
+TEST_INHERENT(RS_ATTR_IO_RESOURCE_DESCRIPTOR, RS_VAL_STRING);
+TEST_INHERENT(RS_ATTR_PRIMARY_ERROR, RS_VAL_INT32);
+TEST_INHERENT(RS_ATTR_SECONDARY_ERROR, RS_VAL_INT32);
+TEST_INHERENT(RS_ATTR_ERROR_ELABORATION, RS_VAL_STRING);
+TEST_INHERENT(RS_ATTR_VISA_RM_SESSION, RS_VAL_SESSION);
+TEST_INHERENT(RS_ATTR_OPC_CALLBACK, RS_VAL_ADDR);
+TEST_INHERENT(RS_ATTR_CHECK_STATUS_CALLBACK, RS_VAL_ADDR);
+TEST_INHERENT(RS_ATTR_OPC_TIMEOUT, RS_VAL_INT32);
+
+static RsCoreAttributePtr gTestAttributes[] = {
+	&g_TEST_RS_ATTR_RANGE_CHECK,
+	&g_TEST_RS_ATTR_QUERY_INSTRUMENT_STATUS,
+	&g_TEST_RS_ATTR_CACHE,
+	&g_TEST_RS_ATTR_SIMULATE,
+	&g_TEST_RS_ATTR_SPECIFIC_DRIVER_PREFIX,
+	&g_TEST_RS_ATTR_SPECIFIC_DRIVER_REVISION,
+	&g_TEST_RS_ATTR_SPECIFIC_DRIVER_MAJOR_VERSION,
+	&g_TEST_RS_ATTR_SPECIFIC_DRIVER_MINOR_VERSION,
+	&g_TEST_RS_ATTR_SPECIFIC_DRIVER_MINOR_MINOR_VERSION,
+	&g_TEST_RS_ATTR_ENGINE_MAJOR_VERSION,
+	&g_TEST_RS_ATTR_ENGINE_MINOR_VERSION,
+	&g_TEST_RS_ATTR_ENGINE_REVISION,
+	&g_TEST_RS_ATTR_CHANNEL_COUNT,
+	&g_TEST_RS_ATTR_DRIVER_SETUP,
+	&g_TEST_RS_ATTR_INSTRUMENT_MANUFACTURER,
+	&g_TEST_RS_ATTR_INSTRUMENT_MODEL,
+	&g_TEST_RS_ATTR_INSTRUMENT_FIRMWARE_REVISION,
+	&g_TEST_RS_ATTR_OPTIONS_LIST,
+	&g_TEST_RS_ATTR_IO_RESOURCE_DESCRIPTOR,
+	&g_TEST_RS_ATTR_PRIMARY_ERROR,
+	&g_TEST_RS_ATTR_SECONDARY_ERROR,
+	&g_TEST_RS_ATTR_ERROR_ELABORATION,
+	&g_TEST_RS_ATTR_VISA_RM_SESSION,
+	&g_TEST_RS_ATTR_OPC_CALLBACK,
+	&g_TEST_RS_ATTR_CHECK_STATUS_CALLBACK,
+	&g_TEST_RS_ATTR_OPC_TIMEOUT,
+	NULL
+};
+
+/*****************************************************************************************************/
+/*  Checks
+******************************************************************************************************/
+static ViInt32 gChecks = 0;
+static ViInt32 gFailures = 0;
+
+static void TestCheck(ViBoolean condition, ViConstString name)
+{
+	gChecks++;
+	if (condition)
+		return;
+
+	gFailures++;
+	printf("FAILED: %s\n", name);
+}
+
+static void TestCheckStatus(ViStatus status, ViStatus expected, ViConstString name)
+{
+	gChecks++;
+	if (status == expected)
+		return;
+
+	gFailures++;
+	printf("FAILED: %s, status 0x%08X, expected 0x%08X\n", name, (unsigned int)status, (unsigned int)expected);
+}
+
+static void TestCheckArray(const ViReal64 actual[], const ViReal64 expected[], ViInt32 count, ViReal64 tolerance, ViConstString name)
+{
+	ViInt32 i;
+
+	gChecks++;
+	for (i = 0; i < count; i++)
+	{
+		if (fabs(actual[i] - expected[i]) <= tolerance)
+			continue;
+
+		gFailures++;
+		printf("FAILED: %s, element %ld is %.12g, expected %.12g\n", name, (long)i, actual[i], expected[i]);
+		return;
+	}
+}
+
+static void TestCheckIntArray(const ViInt32 actual[], const ViInt32 expected[], ViInt32 count, ViConstString name)
+{
+	ViInt32 i;
+
+	gChecks++;
+	for (i = 0; i < count; i++)
+	{
+		if (actual[i] == expected[i])
+			continue;
+
+		gFailures++;
+		printf("FAILED: %s, element %ld is %ld, expected %ld\n", name, (long)i, (long)actual[i], (long)expected[i]);
+		return;
+	}
+}
+
+/*****************************************************************************************************/
+/*  Trace accumulator
+******************************************************************************************************/
+static void TestTraceAccumulator(void)
+{
+	RsCoreTraceAccumulator accumulator;
+	ViReal64 trace1[3] = {0.0, -10.0, 10.0};
+	ViReal64 trace2[3] = {-20.0, -10.0, 20.0};
+	ViReal64 result[3];
+	ViReal64 logAverage[3] = {-10.0, -10.0, 15.0};
+	ViReal64 linearAverage[3];
+	ViReal64 rms[3];
+	ViReal64 maxHold[3] = {0.0, -10.0, 20.0};
+	ViReal64 minHold[3] = {-20.0, -10.0, 10.0};
+	ViInt32 i;
+
+	for (i = 0; i < 3; i++)
+	{
+		linearAverage[i] = 20.0 * log10((pow(10.0, trace1[i] / 20.0) + pow(10.0, trace2[i] / 20.0)) / 2.0);
+		rms[i] = 10.0 * log10((pow(10.0, trace1[i] / 10.0) + pow(10.0, trace2[i] / 10.0)) / 2.0);
+	}
+
+	memset(&accumulator, 0, sizeof(accumulator));
+	TestCheckStatus(RsCore_TraceAccumulatorAdd(&accumulator, trace1, 3), RS_ERROR_NOT_INITIALIZED, "accumulator not initialized");
+
+	TestCheckStatus(RsCore_TraceAccumulatorInit(&accumulator, 3, RS_VAL_TRACE_STAT_ALL), VI_SUCCESS, "accumulator init");
+	TestCheckStatus(RsCore_TraceAccumulatorGet(&accumulator, RS_VAL_TRACE_STAT_MAX_HOLD, 3, result), RS_ERROR_VALUE_NOT_AVAILABLE,
+	                "accumulator without traces");
+	TestCheckStatus(RsCore_TraceAccumulatorAdd(&accumulator, trace1, 3), VI_SUCCESS, "accumulator add 1");
+	TestCheckStatus(RsCore_TraceAccumulatorAdd(&accumulator, trace2, 3), VI_SUCCESS, "accumulator add 2");
+	TestCheckStatus(RsCore_TraceAccumulatorAdd(&accumulator, trace1, 2), RS_ERROR_INVALID_PARAMETER, "accumulator points mismatch");
+
+	(void)RsCore_TraceAccumulatorGet(&accumulator, RS_VAL_TRACE_STAT_LOG_AVERAGE, 3, result);
+	TestCheckArray(result, logAverage, 3, 1e-12, "accumulator log average");
+	(void)RsCore_TraceAccumulatorGet(&accumulator, RS_VAL_TRACE_STAT_LINEAR_AVERAGE, 3, result);
+	TestCheckArray(result, linearAverage, 3, 1e-12, "accumulator linear average");
+	(void)RsCore_TraceAccumulatorGet(&accumulator, RS_VAL_TRACE_STAT_RMS, 3, result);
+	TestCheckArray(result, rms, 3, 1e-12, "accumulator RMS");
+	(void)RsCore_TraceAccumulatorGet(&accumulator, RS_VAL_TRACE_STAT_MAX_HOLD, 3, result);
+	TestCheckArray(result, maxHold, 3, 0.0, "accumulator max hold");
+	(void)RsCore_TraceAccumulatorGet(&accumulator, RS_VAL_TRACE_STAT_MIN_HOLD, 3, result);
+	TestCheckArray(result, minHold, 3, 0.0, "accumulator min hold");
+	TestCheckStatus(RsCore_TraceAccumulatorGet(&accumulator, RS_VAL_TRACE_STAT_MAX_HOLD, 2, result), RS_ERROR_INVALID_PARAMETER,
+	                "accumulator result too small");
+
+	RsCore_TraceAccumulatorReset(&accumulator);
+	TestCheckStatus(RsCore_TraceAccumulatorGet(&accumulator, RS_VAL_TRACE_STAT_MAX_HOLD, 3, result), RS_ERROR_VALUE_NOT_AVAILABLE,
+	                "accumulator reset");
+	RsCore_TraceAccumulatorDispose(&accumulator);
+
+	TestCheckStatus(RsCore_TraceAccumulatorInit(&accumulator, 3, RS_VAL_TRACE_STAT_MAX_HOLD), VI_SUCCESS, "accumulator init max hold");
+	(void)RsCore_TraceAccumulatorAdd(&accumulator, trace1, 3);
+	TestCheckStatus(RsCore_TraceAccumulatorGet(&accumulator, RS_VAL_TRACE_STAT_RMS, 3, result), RS_ERROR_INVALID_PARAMETER,
+	                "accumulator statistic not maintained");
+	RsCore_TraceAccumulatorDispose(&accumulator);
+}
+
+/*****************************************************************************************************/
+/*  Peak search, N dB bandwidth and markers
+******************************************************************************************************/
+static void TestTraceAnalysis(void)
+{
+	ViReal64 x[11];
+	ViReal64 y[11] = {0.0, 5.0, 1.0, 3.0, 2.0, 10.0, 2.0, 4.0, 3.5, 4.0, 0.0};
+	ViReal64 edges[6] = {10.0, 2.0, 0.0, 3.0, 1.0, 8.0};
+	ViReal64 triangle[5] = {0.0, 5.0, 10.0, 5.0, 0.0};
+	ViInt32 peakIndexes[5];
+	ViReal64 peakX[5], peakY[5];
+	ViInt32 peaksFound;
+	ViReal64 lowerX, upperX, bandwidth;
+	ViReal64 markerX[3] = {100.0, 155.0, 200.0};
+	ViReal64 markerY[3];
+	ViReal64 indexMarkerX[2] = {0.5, 3.5};
+	ViInt32 levelOrder[4] = {5, 1, 7, 9};
+	ViReal64 levelOrderX[4] = {150.0, 110.0, 170.0, 190.0};
+	ViReal64 levelOrderY[4] = {10.0, 5.0, 4.0, 4.0};
+	ViInt32 xOrder[3] = {1, 5, 7};
+	ViInt32 edgePeaks[2] = {0, 5};
+	ViReal64 expectedMarkers[3] = {0.0, 6.0, 0.0};
+	ViReal64 expectedIndexMarkers[2] = {2.5, 2.5};
+
+	RsCore_TraceLinearXAxis(100.0, 200.0, 11, x);
+
+	TestCheckStatus(RsCore_TraceFindPeaks(x, y, 11, -100.0, 1.5, RS_VAL_PEAK_SORT_LEVEL, 5, &peaksFound, peakIndexes, peakX, peakY),
+	                VI_SUCCESS, "peaks by level");
+	TestCheck(peaksFound == 4, "peaks by level count");
+	TestCheckIntArray(peakIndexes, levelOrder, 4, "peaks by level indexes");
+	TestCheckArray(peakX, levelOrderX, 4, 1e-9, "peaks by level x");
+	TestCheckArray(peakY, levelOrderY, 4, 0.0, "peaks by level y");
+
+	(void)RsCore_TraceFindPeaks(NULL, y, 11, -100.0, 0.0, RS_VAL_PEAK_SORT_X, 3, &peaksFound, peakIndexes, NULL, NULL);
+	TestCheck(peaksFound == 3, "highest peaks by x count");
+	TestCheckIntArray(peakIndexes, xOrder, 3, "highest peaks by x indexes");
+
+	(void)RsCore_TraceFindPeaks(x, y, 11, 4.5, 1.5, RS_VAL_PEAK_SORT_LEVEL, 5, &peaksFound, peakIndexes, NULL, NULL);
+	TestCheck(peaksFound == 2, "peaks above the threshold");
+
+	(void)RsCore_TraceFindPeaks(NULL, edges, 6, -100.0, 5.0, RS_VAL_PEAK_SORT_X, 5, &peaksFound, peakIndexes, NULL, NULL);
+	TestCheck(peaksFound == 2, "peaks at the open trace edges count");
+	TestCheckIntArray(peakIndexes, edgePeaks, 2, "peaks at the open trace edges");
+
+	TestCheckStatus(RsCore_TraceNdBBandwidth(x, y, 11, 5, 3.0, &lowerX, &upperX, &bandwidth), VI_SUCCESS, "N dB bandwidth");
+	TestCheck(fabs(lowerX - 146.25) < 1e-9 && fabs(upperX - 153.75) < 1e-9 && fabs(bandwidth - 7.5) < 1e-9, "N dB bandwidth edges");
+	TestCheckStatus(RsCore_TraceNdBBandwidth(x, y, 11, 1, 10.0, &lowerX, &upperX, NULL), RS_ERROR_VALUE_NOT_AVAILABLE,
+	                "N dB bandwidth not reached");
+	TestCheckStatus(RsCore_TraceNdBBandwidth(NULL, triangle, 5, 2, 5.0, &lowerX, &upperX, NULL), VI_SUCCESS, "N dB bandwidth on indexes");
+	TestCheck(fabs(lowerX - 1.0) < 1e-12 && fabs(upperX - 3.0) < 1e-12, "N dB bandwidth on indexes edges");
+
+	TestCheckStatus(RsCore_TraceMarkersAt(x, y, 11, 3, markerX, markerY), VI_SUCCESS, "markers");
+	TestCheckArray(markerY, expectedMarkers, 3, 1e-12, "markers levels");
+	markerX[0] = 99.0;
+	TestCheckStatus(RsCore_TraceMarkersAt(x, y, 11, 3, markerX, markerY), RS_ERROR_INVALID_PARAMETER, "marker outside of the trace");
+	TestCheckStatus(RsCore_TraceMarkersAt(NULL, triangle, 5, 2, indexMarkerX, markerY), VI_SUCCESS, "markers on indexes");
+	TestCheckArray(markerY, expectedIndexMarkers, 2, 1e-12, "markers on indexes levels");
+}
+
+/*****************************************************************************************************/
+/*  Limit line check
+******************************************************************************************************/
+static void TestLimitCheck(void)
+{
+	ViReal64 x[11];
+	ViReal64 y[11] = {-50.0, -50.0, -40.0, -20.0, -10.0, -5.0, -10.0, -20.0, -40.0, -50.0, -50.0};
+	ViReal64 upperLimitX[4] = {-5e6, -1e6, -1e6, 5e6};
+	ViReal64 upperLimitY[4] = {-30.0, -30.0, 0.0, 0.0};
+	ViReal64 lowerLimitX[2] = {-1e6, 1e6};
+	ViReal64 lowerLimitY[2] = {-15.0, -15.0};
+	ViReal64 logX[3] = {0.0, 1.0, 2.0};
+	ViReal64 logY[3] = {-100.0, 0.0, -100.0};
+	ViReal64 logLimitX[2] = {0.0, 2.0};
+	ViReal64 logLimitY[2] = {-10.0, -20.0};
+	RsCoreLimitLine lines[3] = {
+		{RS_VAL_LIMIT_LINE_UPPER, 4, upperLimitX, upperLimitY, 0, 0, 0, 0, 0.0, 0.0, 3.0, -200.0},
+		{RS_VAL_LIMIT_LINE_LOWER, 2, lowerLimitX, lowerLimitY, 0, 0, 0, 0, 0.0, 0.0, 3.0, -200.0},
+		{RS_VAL_LIMIT_LINE_UPPER, 2, lowerLimitX, lowerLimitY, RS_VAL_LIMIT_SCALING_REL, 0, RS_VAL_LIMIT_SCALING_REL, 0, 0.0, 0.0, 0.0, -12.0}
+	};
+	RsCoreLimitLine logLine = {RS_VAL_LIMIT_LINE_UPPER, 2, logLimitX, logLimitY, 0, 0, 0, RS_VAL_LIMIT_SPACING_LOG, 0.0, 0.0, 0.0, -200.0};
+	RsCoreLimitResult results[3];
+	ViInt32 worstLine;
+	ViReal64 worstMargin, worstX;
+
+	RsCore_TraceLinearXAxis(-5e6, 5e6, 11, x);
+
+	TestCheckStatus(RsCore_TraceLimitCheck(x, y, 11, 0.0, 0.0, 3, lines, results, &worstLine, &worstMargin, &worstX), VI_SUCCESS,
+	                "limit check");
+	TestCheck(worstLine == 0 && worstMargin == -20.0 && worstX == -1e6, "limit check worst line");
+	TestCheck(results[0].passed == VI_FALSE && results[0].checkedPoints == 11 && results[0].failedPoints == 2 &&
+	          results[0].worstIndex == 4, "limit check upper line with a vertical step");
+	TestCheck(results[1].passed == VI_TRUE && results[1].checkedPoints == 3 && results[1].worstMargin == 5.0,
+	          "limit check lower line");
+	TestCheck(results[2].passed == VI_FALSE && results[2].failedPoints == 3 && results[2].worstMargin == -7.0 &&
+	          results[2].worstIndex == 5, "limit check relative line with threshold");
+
+	// Logarithmic y spacing interpolates the dB levels as linear power: 10 * log10((0.1 + 0.01) / 2)
+	(void)RsCore_TraceLimitCheck(logX, logY, 3, 0.0, 0.0, 1, &logLine, results, NULL, &worstMargin, NULL);
+	TestCheck(fabs(worstMargin - 10.0 * log10(0.055)) < 1e-9, "limit check logarithmic y spacing");
+}
+
+/*****************************************************************************************************/
+/*  Multi-column array queries
+    The mock VISA returns the trace values -90 .. -86 from its seeded generator, and -20 in the middle point.
+    A stored setting is returned as it was sent, which gives the known ASCII arrays
+******************************************************************************************************/
+static ViReal64 TestMockTraceValue(ViInt32 sweep, ViInt32 points, ViInt32 index)
+{
+	unsigned int seed = (unsigned int)sweep * 7919u + 1;
+	ViInt32 i;
+
+	for (i = 0; i <= index; i++)
+		seed = seed * 1103515245u + 12345u;
+
+	return (index == points / 2) ? -20.0 : -90.0 + (double)((seed >> 8) & 0xFFFF) / 16384.0;
+}
+
+static ViStatus TestOpenMockSession(ViInt32 binaryFloatFormat, ViSession* instrSession)
+{
+	return RsCore_NewSpecificDriver((ViRsrc)"TCPIP::mock::INSTR", "test", "QueryInstrStatus=False", gTestAttributes,
+		0, 0, 1000000, RS_VAL_OPCWAIT_STBPOLLING, 10000, 5000, 600000,
+		binaryFloatFormat, RS_VAL_BIN_INTEGER_FORMAT_INT32_4BYTES, instrSession);
+}
+
+static void TestColumnsBinary(ViInt32 binaryFloatFormat, ViConstString formatCommand, ViConstString name)
+{
+	ViSession instrSession = 0;
+	ViReal64 column0[8], column1[8], column2[8];
+	ViReal64* columns[3] = {column0, column1, column2};
+	ViReal64 expected;
+	ViInt32 rows = 0;
+	ViInt32 sweep, columnsCount, row, column;
+	ViInt32 wrong;
+	ViChar checkName[128];
+
+	if (TestOpenMockSession(binaryFloatFormat, &instrSession) < VI_SUCCESS)
+	{
+		TestCheck(VI_FALSE, "open the mock session");
+		return;
+	}
+
+	(void)RsCore_Write(instrSession, formatCommand);
+	(void)RsCore_Write(instrSession, "SWE:POIN 12");
+	for (sweep = 0, columnsCount = 2; columnsCount <= 3; sweep++, columnsCount++)
+	{
+		snprintf(checkName, sizeof(checkName), "%s, %ld columns", name, (long)columnsCount);
+		wrong = 0;
+		TestCheckStatus(RsCore_QueryFloatArrayColumns(instrSession, "TRAC? TRACE1", columnsCount, columns, 8, &rows), VI_SUCCESS, checkName);
+		TestCheck(rows == 12 / columnsCount, checkName);
+		for (row = 0; row < rows; row++)
+		{
+			for (column = 0; column < columnsCount; column++)
+			{
+				expected = TestMockTraceValue(sweep, 12, row * columnsCount + column);
+				if (binaryFloatFormat == RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES)
+					expected = (ViReal32)expected;
+
+				if (columns[column][row] != expected)
+					wrong++;
+			}
+		}
+
+		TestCheck(wrong == 0, checkName);
+	}
+
+	(void)RsCore_ViClose(instrSession);
+	(void)RsCore_Dispose(instrSession);
+}
+
+static void TestColumns(void)
+{
+	ViSession instrSession = 0;
+	ViReal64 column0[4], column1[4], column2[4];
+	ViReal64* columns[3] = {column0, column1, column2};
+	ViReal64 expected0[4] = {1.0, 4.0, 7.0, 10.0};
+	ViReal64 expected1[4] = {2.0, 5.0, 8.0, 11.0};
+	ViReal64 expected2[4] = {3.0, 6.0, 9.0, 12.0};
+	ViReal64 pairs0[3] = {-1.5, 0.25, 1e3};
+	ViReal64 pairs1[3] = {2.5, -0.125, -1e-3};
+	ViInt32 intColumn0[3], intColumn1[3], intColumn3[3];
+	ViInt32* intColumns[4] = {intColumn0, intColumn1, NULL, intColumn3};
+	ViInt32 intExpected0[3] = {1, 5, 9};
+	ViInt32 intExpected1[3] = {2, 6, 10};
+	ViInt32 intExpected3[3] = {4, 8, 12};
+	ViInt32 rows = 0;
+
+	if (TestOpenMockSession(RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES, &instrSession) < VI_SUCCESS)
+	{
+		TestCheck(VI_FALSE, "open the mock session");
+		return;
+	}
+
+	(void)RsCore_Write(instrSession, "TEST:ROWS 1,2,3,4,5,6,7,8,9,10,11,12,13");
+	TestCheckStatus(RsCore_QueryFloatArrayColumns(instrSession, "TEST:ROWS?", 3, columns, 4, &rows), VI_SUCCESS, "ASCII 3 columns");
+	TestCheck(rows == 4, "ASCII 3 columns, incomplete last row ignored");
+	TestCheckArray(column0, expected0, 4, 0.0, "ASCII 3 columns, column 1");
+	TestCheckArray(column1, expected1, 4, 0.0, "ASCII 3 columns, column 2");
+	TestCheckArray(column2, expected2, 4, 0.0, "ASCII 3 columns, column 3");
+
+	(void)RsCore_Write(instrSession, "TEST:PAIRS -1.5,2.5,0.25,-0.125,1e3,-1e-3");
+	TestCheckStatus(RsCore_QueryFloatArrayColumns(instrSession, "TEST:PAIRS?", 2, columns, 4, &rows), VI_SUCCESS, "ASCII 2 columns");
+	TestCheck(rows == 3, "ASCII 2 columns rows");
+	TestCheckArray(column0, pairs0, 3, 0.0, "ASCII 2 columns, column 1");
+	TestCheckArray(column1, pairs1, 3, 0.0, "ASCII 2 columns, column 2");
+
+	// Only the columnSize rows are returned, the rowsCount reports all of them
+	columns[1] = NULL;
+	TestCheckStatus(RsCore_QueryFloatArrayColumns(instrSession, "TEST:ROWS?", 3, columns, 2, &rows), VI_SUCCESS, "ASCII small columns");
+	TestCheck(rows == 4 && column0[1] == 4.0 && column2[1] == 6.0, "ASCII small columns, NULL column skipped");
+
+	TestCheckStatus(RsCore_QueryIntegerArrayColumns(instrSession, "TEST:ROWS?", 4, intColumns, 3, &rows), VI_SUCCESS, "ASCII integer columns");
+	TestCheck(rows == 3, "ASCII integer columns rows");
+	TestCheckIntArray(intColumn0, intExpected0, 3, "ASCII integer columns, column 1");
+	TestCheckIntArray(intColumn1, intExpected1, 3, "ASCII integer columns, column 2");
+	TestCheckIntArray(intColumn3, intExpected3, 3, "ASCII integer columns, column 4");
+
+	(void)RsCore_ViClose(instrSession);
+	(void)RsCore_Dispose(instrSession);
+
+	TestColumnsBinary(RS_VAL_BIN_FLOAT_FORMAT_SINGLE_4BYTES, "FORM REAL,32", "REAL,32 columns");
+	TestColumnsBinary(RS_VAL_BIN_FLOAT_FORMAT_DOUBLE_8BYTES, "FORM REAL,64", "REAL,64 columns");
+}
+
+/*****************************************************************************************************/
+/*  Trace archive
+******************************************************************************************************/
+static void TestTraceArchive(void)
+{
+	RsCoreTraceArchive archive;
+	ViConstString fileName = "rsspecan_numeric_test.arc";
+	ViReal64 trace1[3] = {-10.0, -20.0, -30.0};
+	ViReal64 trace2[3] = {-40.0, -50.0, -60.0};
+	ViReal64 tooLong[4] = {0.0, 0.0, 0.0, 0.0};
+	ViReal64 data[3];
+	ViInt64 firstSequence = -1, rowsCount = -1;
+	ViInt32 points = 0, sweepNumber = 0;
+
+	(void)remove(fileName);
+	TestCheckStatus(RsCore_TraceArchiveOpen(fileName, 3, 2, &archive), VI_SUCCESS, "archive open");
+	TestCheckStatus(RsCore_TraceArchiveAppend(&archive, 10.0, 1, 3, trace1), VI_SUCCESS, "archive append 1");
+	TestCheckStatus(RsCore_TraceArchiveAppend(&archive, 20.0, 2, 3, trace2), VI_SUCCESS, "archive append 2");
+
+	// A rejected append to the full archive keeps the oldest row
+	TestCheckStatus(RsCore_TraceArchiveAppend(&archive, 30.0, 3, 4, tooLong), RS_ERROR_INVALID_PARAMETER, "archive append too long");
+	RsCore_TraceArchiveRange(&archive, &firstSequence, &rowsCount);
+	TestCheck(firstSequence == 0 && rowsCount == 2, "archive rows kept after a rejected append");
+
+	TestCheck(RsCore_TraceArchiveFind(&archive, 15.0) == 1, "archive find");
+	TestCheckStatus(RsCore_TraceArchiveRead(&archive, 0, 3, data, &points, NULL, &sweepNumber), VI_SUCCESS, "archive read");
+	TestCheck(points == 3 && sweepNumber == 1, "archive read points and sweep number");
+	TestCheckArray(data, trace1, 3, 0.0, "archive read values");
+
+	(void)RsCore_TraceArchiveAppend(&archive, 30.0, 3, 3, trace1);
+	RsCore_TraceArchiveRange(&archive, &firstSequence, &rowsCount);
+	TestCheck(firstSequence == 1 && rowsCount == 2, "archive oldest row overwritten");
+	TestCheckStatus(RsCore_TraceArchiveRead(&archive, 0, 3, data, NULL, NULL, NULL), RS_ERROR_VALUE_NOT_AVAILABLE, "archive row not retained");
+
+	TestCheckStatus(RsCore_TraceArchiveAppend(NULL, 40.0, 4, 3, trace1), RS_ERROR_NULL_POINTER, "archive append to NULL");
+	TestCheckStatus(RsCore_TraceArchiveAppend(&archive, 40.0, 4, 3, NULL), RS_ERROR_NULL_POINTER, "archive append NULL data");
+	TestCheckStatus(RsCore_TraceArchiveRead(&archive, 1, 3, NULL, NULL, NULL, NULL), RS_ERROR_NULL_POINTER, "archive read to NULL");
+	RsCore_TraceArchiveRange(&archive, &firstSequence, &rowsCount);
+	TestCheck(firstSequence == 1 && rowsCount == 2, "archive rows kept after NULL arguments");
+	TestCheck(RsCore_TraceArchiveFind(NULL, 15.0) == 0, "archive find in NULL");
+
+	RsCore_TraceArchiveClose(&archive);
+	RsCore_TraceArchiveClose(NULL);
+	(void)remove(fileName);
+	TestCheckStatus(RsCore_TraceArchiveOpen(NULL, 3, 2, &archive), RS_ERROR_NULL_POINTER, "archive open without a file name");
+}
+
+/*****************************************************************************************************/
+/*  Trace decimation
+******************************************************************************************************/
+static void TestDecimation(void)
+{
+	ViReal64 y[8] = {0.0, 5.0, 1.0, 9.0, 2.0, 2.0, 7.0, 3.0};
+	ViReal64 triangle[5] = {0.0, 1.0, 10.0, 2.0, 0.0};
+	ViInt32 indexes[8];
+	ViReal64 minValues[8], maxValues[8];
+	RsCoreDecimation decimation;
+	ViInt32 envelopeIndexes[4] = {0, 2, 4, 6};
+	ViReal64 envelopeMin[4] = {0.0, 1.0, 2.0, 3.0};
+	ViReal64 envelopeMax[4] = {5.0, 9.0, 2.0, 7.0};
+	ViInt32 lttbIndexes[3] = {0, 2, 4};
+	ViReal64 lttbValues[3] = {0.0, 10.0, 0.0};
+
+	memset(&decimation, 0, sizeof(decimation));
+	decimation.mode = RS_VAL_DECIMATION_ENVELOPE;
+	decimation.width = 4;
+	decimation.indexes = indexes;
+	decimation.minValues = minValues;
+	decimation.maxValues = maxValues;
+	TestCheckStatus(RsCore_TraceDecimate(y, 8, &decimation), VI_SUCCESS, "envelope decimation");
+	TestCheck(decimation.count == 4, "envelope decimation count");
+	TestCheckIntArray(indexes, envelopeIndexes, 4, "envelope decimation indexes");
+	TestCheckArray(minValues, envelopeMin, 4, 0.0, "envelope decimation minimum");
+	TestCheckArray(maxValues, envelopeMax, 4, 0.0, "envelope decimation maximum");
+
+	decimation.width = 10;
+	(void)RsCore_TraceDecimate(y, 8, &decimation);
+	TestCheck(decimation.count == 8 && indexes[7] == 7 && minValues[3] == 9.0 && maxValues[3] == 9.0, "short trace unchanged");
+
+	decimation.mode = RS_VAL_DECIMATION_LTTB;
+	decimation.width = 3;
+	TestCheckStatus(RsCore_TraceDecimate(triangle, 5, &decimation), VI_SUCCESS, "LTTB decimation");
+	TestCheck(decimation.count == 3, "LTTB decimation count");
+	TestCheckIntArray(indexes, lttbIndexes, 3, "LTTB decimation indexes");
+	TestCheckArray(minValues, lttbValues, 3, 0.0, "LTTB decimation values");
+
+	decimation.width = 2;
+	TestCheckStatus(RsCore_TraceDecimate(triangle, 5, &decimation), RS_ERROR_INVALID_PARAMETER, "LTTB decimation width below 3");
+}
+
+/*****************************************************************************************************/
+/*  Grouped job scheduling
+******************************************************************************************************/
+static ViInt32 gTestAllocations = 0; // Allocated and not freed blocks
+static ViInt32 gTestAllocateCalls = 0;
+
+static void* TestAllocate(void* context, size_t size)
+{
+	(void)context;
+	gTestAllocations++;
+	gTestAllocateCalls++;
+	return malloc(size);
+}
+
+static void* TestReallocate(void* context, void* ptr, size_t size)
+{
+	(void)context;
+	return realloc(ptr, size);
+}
+
+static void TestDeallocate(void* context, void* ptr)
+{
+	(void)context;
+	gTestAllocations--;
+	free(ptr);
+}
+
+static void TestJobScheduling(void)
+{
+	RsCoreAllocator allocator = {"test", TestAllocate, TestReallocate, TestDeallocate, NULL};
+	ViInt32 groups[5] = {0, 1, 0, 1, 2};
+	ViInt32 groupedOrder[5] = {0, 2, 1, 3, 4};
+	ViInt32 currentFirstOrder[5] = {1, 3, 0, 2, 4};
+	ViInt32 dependencyGroups[4] = {0, 1, 0, 1};
+	ViInt32 dependencyPrerequisites[1] = {1};
+	ViInt32 dependencyDependents[1] = {2};
+	ViInt32 dependencyOrder[4] = {0, 1, 3, 2};
+	ViInt32 blockedGroups[4] = {0, 1, 1, 2};
+	ViInt32 blockedPrerequisites[1] = {3};
+	ViInt32 blockedDependents[1] = {2};
+	ViInt32 blockedOrder[4] = {0, 3, 1, 2};
+	ViInt32 cyclePrerequisites[2] = {0, 1};
+	ViInt32 cycleDependents[2] = {1, 0};
+	ViInt32 rangePrerequisites[1] = {3};
+	ViInt32 rangeDependents[1] = {0};
+	ViInt32 order[5];
+	ViInt32 switches = -1;
+
+	TestCheckStatus(RsCore_ScheduleGroupedJobs(5, groups, 0, NULL, NULL, -1, order, &switches), VI_SUCCESS, "grouped jobs");
+	TestCheckIntArray(order, groupedOrder, 5, "grouped jobs order");
+	TestCheck(switches == 3, "grouped jobs switches");
+
+	(void)RsCore_ScheduleGroupedJobs(5, groups, 0, NULL, NULL, 1, order, &switches);
+	TestCheckIntArray(order, currentFirstOrder, 5, "current group first order");
+	TestCheck(switches == 2, "current group first switches");
+
+	// Job 2 needs job 1 of the other group
+	TestCheckStatus(RsCore_ScheduleGroupedJobs(4, dependencyGroups, 1, dependencyPrerequisites, dependencyDependents, 0, order, &switches),
+	                VI_SUCCESS, "dependent jobs");
+	TestCheckIntArray(order, dependencyOrder, 4, "dependent jobs order");
+	TestCheck(switches == 2, "dependent jobs switches");
+
+	// Group 2 goes before group 1, whose job 2 still waits for job 3
+	(void)RsCore_ScheduleGroupedJobs(4, blockedGroups, 1, blockedPrerequisites, blockedDependents, -1, order, &switches);
+	TestCheckIntArray(order, blockedOrder, 4, "blocked group order");
+	TestCheck(switches == 3, "blocked group switches");
+
+	TestCheckStatus(RsCore_ScheduleGroupedJobs(3, groups, 2, cyclePrerequisites, cycleDependents, 0, order, &switches),
+	                RS_ERROR_INVALID_VALUE, "dependency cycle");
+	TestCheckStatus(RsCore_ScheduleGroupedJobs(3, groups, 1, rangePrerequisites, rangeDependents, 0, order, &switches),
+	                RS_ERROR_INVALID_VALUE, "dependency out of range");
+	TestCheckStatus(RsCore_ScheduleGroupedJobs(3, groups, 1, NULL, rangeDependents, 0, order, &switches),
+	                RS_ERROR_NULL_POINTER, "missing dependency list");
+
+	switches = -1;
+	TestCheckStatus(RsCore_ScheduleGroupedJobs(0, NULL, 0, NULL, NULL, 0, NULL, &switches), VI_SUCCESS, "no jobs");
+	TestCheck(switches == 0, "no jobs switches");
+
+	// The job lists come from the process allocator
+	TestCheckStatus(RsCore_SetAllocator(&allocator), VI_SUCCESS, "set the process allocator");
+	(void)RsCore_ScheduleGroupedJobs(4, dependencyGroups, 1, dependencyPrerequisites, dependencyDependents, 0, order, &switches);
+	TestCheckIntArray(order, dependencyOrder, 4, "scheduling with the process allocator order");
+	TestCheck(gTestAllocateCalls == 3 && gTestAllocations == 0, "scheduling with the process allocator frees all the lists");
+	(void)RsCore_ScheduleGroupedJobs(3, groups, 2, cyclePrerequisites, cycleDependents, 0, order, &switches);
+	TestCheck(gTestAllocateCalls == 6 && gTestAllocations == 0, "scheduling with the process allocator frees the lists after a cycle");
+	(void)RsCore_SetAllocator(NULL);
+}
+
+int main(void)
+{
+	TestTraceAccumulator();
+	TestTraceAnalysis();
+	TestLimitCheck();
+	TestColumns();
+	TestTraceArchive();
+	TestDecimation();
+	TestJobScheduling();
+
+	printf("%ld checks, %ld failed\n", (long)gChecks, (long)gFailures);
+
+	return gFailures > 0 ? 1 : 0;
+}
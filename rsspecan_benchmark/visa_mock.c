@@ -0,0 +1,602 @@
+/*	Mock VISA library
+	In-process replacement of the VISA functions used by the rscore.c, for the Linux build without a VISA installation.
+	Every opened resource is a simulated R&S spectrum analyzer with zero IO latency,
+	so that the benchmarks measure only the driver overhead:
+	- *IDN?, *OPT?, *OPC?, *OPC, *ESR?, *CLS, *RST, *WAI
+	- SYST:ERR? always reports no error
+	- FORM ASC | REAL,32 | REAL,64 selects the trace data format
+	- SWE:POIN sets the number of trace points returned by TRAC? / TRAC:DATA?
+	- All other set commands are stored, their queries return the stored value or "0"
+	Resources ending with '::SOCKET' report the SOCKET resource class, all others INSTR.
+
+	Original Release: October 2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <pthread.h>
+#include <visa.h>
+
+/*****************************************************************************************************/
+/*  Constants
+******************************************************************************************************/
+#define MOCK_IDN_RESPONSE           "Rohde&Schwarz,FSW-26,1312.8000K26/100005,4.70"
+#define MOCK_OPT_RESPONSE           "B4,B10,B13,B25,B160,K7,K9,K10,K40,K70"
+#define MOCK_MAX_SESSIONS           1024
+#define MOCK_MAX_STORED_VALUES      256
+#define MOCK_MAX_HEADER_LEN         128
+#define MOCK_MAX_VALUE_LEN          256
+#define MOCK_RM_SESSION             1
+#define MOCK_SESSION_BASE           0x1000
+#define MOCK_DEFAULT_SWEEP_POINTS   1001
+
+typedef struct
+{
+	char header[MOCK_MAX_HEADER_LEN];
+	char value[MOCK_MAX_VALUE_LEN];
+} MockStoredValue;
+
+typedef struct
+{
+	ViBoolean used;
+	ViBoolean socketClass;
+	ViUInt32 timeout;
+	ViUInt8 termChar;
+	ViBoolean termCharEnabled;
+	ViBoolean sendEndEnabled;
+	ViAddr userData;
+
+	// Instrument state
+	ViBoolean esb;
+	ViInt32 format; // 0 = ASCII, 4 = REAL,32, 8 = REAL,64
+	ViInt32 sweepPoints;
+	ViUInt32 sweepCount;
+	MockStoredValue stored[MOCK_MAX_STORED_VALUES];
+	ViInt32 storedCount;
+
+	// Received program message, response waiting to be read
+	char* input;
+	size_t inputLen, inputSize;
+	char* output;
+	size_t outputLen, outputPos, outputSize;
+} MockSession;
+
+static MockSession gMockSessions[MOCK_MAX_SESSIONS];
+static pthread_mutex_t gMockMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*****************************************************************************************************/
+/*  Helpers
+******************************************************************************************************/
+static MockSession* MockGetSession(ViObject vi)
+{
+	ViObject idx = vi - MOCK_SESSION_BASE;
+
+	if (vi < MOCK_SESSION_BASE || idx >= MOCK_MAX_SESSIONS || !gMockSessions[idx].used)
+		return NULL;
+
+	return &gMockSessions[idx];
+}
+
+static ViBoolean MockAppend(char** buffer, size_t* length, size_t* size, const void* data, size_t dataLen)
+{
+	if (*length + dataLen + 1 > *size)
+	{
+		size_t newSize = (*length + dataLen + 1) * 2;
+		char* newBuffer = (char*)realloc(*buffer, newSize);
+
+		if (newBuffer == NULL)
+			return VI_FALSE;
+
+		*buffer = newBuffer;
+		*size = newSize;
+	}
+
+	memcpy(*buffer + *length, data, dataLen);
+	*length += dataLen;
+	(*buffer)[*length] = 0;
+
+	return VI_TRUE;
+}
+
+static void MockRespond(MockSession* session, const void* data, size_t dataLen)
+{
+	if (session->outputLen > session->outputPos)
+		(void)MockAppend(&session->output, &session->outputLen, &session->outputSize, ";", 1);
+
+	(void)MockAppend(&session->output, &session->outputLen, &session->outputSize, data, dataLen);
+}
+
+// Uppercase header without the leading colon and the trailing question mark
+static void MockNormalizeHeader(const char* header, size_t headerLen, char* key)
+{
+	size_t i = 0;
+
+	if (headerLen > 0 && *header == ':')
+	{
+		header++;
+		headerLen--;
+	}
+
+	if (headerLen > 0 && header[headerLen - 1] == '?')
+		headerLen--;
+
+	for (; i < headerLen && i < MOCK_MAX_HEADER_LEN - 1; i++)
+		key[i] = (char)toupper((unsigned char)header[i]);
+
+	key[i] = 0;
+}
+
+static MockStoredValue* MockFindStored(MockSession* session, const char* key)
+{
+	ViInt32 i;
+
+	for (i = 0; i < session->storedCount; i++)
+		if (strcmp(session->stored[i].header, key) == 0)
+			return &session->stored[i];
+
+	return NULL;
+}
+
+static void MockRespondTrace(MockSession* session)
+{
+	ViInt32 i;
+	char text[48];
+	char header[64];
+	size_t dataLen;
+	unsigned int seed = session->sweepCount++ * 7919u + 1;
+
+	if (session->outputLen > session->outputPos)
+		(void)MockAppend(&session->output, &session->outputLen, &session->outputSize, ";", 1);
+
+	if (session->format != 0)
+	{
+		dataLen = (size_t)session->sweepPoints * (size_t)session->format;
+		snprintf(text, sizeof(text), "%zu", dataLen);
+		snprintf(header, sizeof(header), "#%zu%s", strlen(text), text);
+		(void)MockAppend(&session->output, &session->outputLen, &session->outputSize, header, strlen(header));
+	}
+
+	for (i = 0; i < session->sweepPoints; i++)
+	{
+		double value;
+
+		seed = seed * 1103515245u + 12345u;
+		value = (i == session->sweepPoints / 2) ? -20.0 : -90.0 + (double)((seed >> 8) & 0xFFFF) / 16384.0;
+		if (session->format == 4)
+		{
+			float value32 = (float)value;
+			(void)MockAppend(&session->output, &session->outputLen, &session->outputSize, &value32, 4);
+		}
+		else if (session->format == 8)
+		{
+			(void)MockAppend(&session->output, &session->outputLen, &session->outputSize, &value, 8);
+		}
+		else
+		{
+			snprintf(text, sizeof(text), (i == 0) ? "%.6f" : ",%.6f", value);
+			(void)MockAppend(&session->output, &session->outputLen, &session->outputSize, text, strlen(text));
+		}
+	}
+}
+
+/*****************************************************************************************************/
+/*  Executes one program message unit
+******************************************************************************************************/
+static void MockExecuteUnit(MockSession* session, char* unit)
+{
+	char key[MOCK_MAX_HEADER_LEN];
+	char* parameters;
+	size_t headerLen;
+	ViBoolean isQuery;
+	MockStoredValue* stored;
+
+	while (isspace((unsigned char)*unit))
+		unit++;
+
+	if (*unit == 0)
+		return;
+
+	headerLen = strcspn(unit, " \t");
+	isQuery = (ViBoolean)(headerLen > 0 && unit[headerLen - 1] == '?');
+	parameters = unit + headerLen;
+	while (isspace((unsigned char)*parameters))
+		parameters++;
+
+	MockNormalizeHeader(unit, headerLen, key);
+
+	if (strcmp(key, "*IDN") == 0 && isQuery)
+		MockRespond(session, MOCK_IDN_RESPONSE, strlen(MOCK_IDN_RESPONSE));
+	else if (strcmp(key, "*OPT") == 0 && isQuery)
+		MockRespond(session, MOCK_OPT_RESPONSE, strlen(MOCK_OPT_RESPONSE));
+	else if (strcmp(key, "*OPC") == 0)
+	{
+		if (isQuery)
+			MockRespond(session, "1", 1);
+		else
+			session->esb = VI_TRUE;
+	}
+	else if (strcmp(key, "*ESR") == 0 && isQuery)
+	{
+		MockRespond(session, session->esb ? "1" : "0", 1);
+		session->esb = VI_FALSE;
+	}
+	else if (strcmp(key, "*CLS") == 0)
+		session->esb = VI_FALSE;
+	else if (strcmp(key, "*RST") == 0)
+	{
+		session->format = 0;
+		session->sweepPoints = MOCK_DEFAULT_SWEEP_POINTS;
+		session->storedCount = 0;
+	}
+	else if (strcmp(key, "*WAI") == 0)
+	{
+	}
+	else if (strncmp(key, "SYST", 4) == 0 && strstr(key, ":ERR") != NULL && isQuery)
+		MockRespond(session, "0,\"No error\"", 12);
+	else if ((strcmp(key, "FORM") == 0 || strcmp(key, "FORM:DATA") == 0 || strcmp(key, "FORMAT") == 0) && !isQuery)
+	{
+		if (strncmp(parameters, "REAL", 4) == 0 || strncmp(parameters, "real", 4) == 0)
+			session->format = (strstr(parameters, "64") != NULL) ? 8 : 4;
+		else
+			session->format = 0;
+	}
+	else if ((strcmp(key, "SWE:POIN") == 0 || strcmp(key, "SENS:SWE:POIN") == 0) && !isQuery && atoi(parameters) > 0)
+		session->sweepPoints = atoi(parameters);
+	else if (strncmp(key, "TRAC", 4) == 0 && isQuery && strstr(key, ":IQ") == NULL)
+		MockRespondTrace(session);
+	else if (isQuery)
+	{
+		stored = MockFindStored(session, key);
+		if (stored != NULL)
+			MockRespond(session, stored->value, strlen(stored->value));
+		else
+			MockRespond(session, "0", 1);
+	}
+	else
+	{
+		stored = MockFindStored(session, key);
+		if (stored == NULL && session->storedCount < MOCK_MAX_STORED_VALUES)
+		{
+			stored = &session->stored[session->storedCount++];
+			strcpy(stored->header, key);
+		}
+
+		if (stored != NULL)
+			snprintf(stored->value, MOCK_MAX_VALUE_LEN, "%s", parameters);
+	}
+}
+
+// Splits the program message to units, binary data blocks are skipped
+static void MockExecuteMessage(MockSession* session)
+{
+	char* message = session->input;
+	char* unitStart = message;
+	size_t length = session->inputLen;
+	size_t i;
+
+	while (length > 0 && (message[length - 1] == '\n' || message[length - 1] == '\r'))
+		message[--length] = 0;
+
+	for (i = 0; i <= length; i++)
+	{
+		if (i < length && message[i] == '#' && i + 1 < length && isdigit((unsigned char)message[i + 1]))
+		{
+			size_t digits = (size_t)(message[i + 1] - '0');
+			char lengthText[10] = "";
+
+			if (digits > 0 && i + 2 + digits <= length)
+			{
+				memcpy(lengthText, message + i + 2, digits);
+				i += 1 + digits + (size_t)atol(lengthText);
+			}
+
+			continue;
+		}
+
+		if (i < length && message[i] != ';')
+			continue;
+
+		message[i < length ? i : length] = 0;
+		MockExecuteUnit(session, unitStart);
+		unitStart = message + i + 1;
+	}
+
+	if (session->outputLen > session->outputPos)
+		(void)MockAppend(&session->output, &session->outputLen, &session->outputSize, "\n", 1);
+
+	session->inputLen = 0;
+}
+
+/*****************************************************************************************************/
+/*  VISA functions
+******************************************************************************************************/
+ViStatus _VI_FUNC viOpenDefaultRM(ViPSession vi)
+{
+	*vi = MOCK_RM_SESSION;
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viOpen(ViSession sesn, ViConstRsrc name, ViAccessMode mode, ViUInt32 timeout, ViPSession vi)
+{
+	ViInt32 idx;
+	size_t nameLen = strlen(name);
+
+	(void)mode;
+	(void)timeout;
+	*vi = VI_NULL;
+	if (sesn != MOCK_RM_SESSION)
+		return VI_ERROR_INV_OBJECT;
+
+	pthread_mutex_lock(&gMockMutex);
+	for (idx = 0; idx < MOCK_MAX_SESSIONS; idx++)
+		if (!gMockSessions[idx].used)
+			break;
+
+	if (idx == MOCK_MAX_SESSIONS)
+	{
+		pthread_mutex_unlock(&gMockMutex);
+		return VI_ERROR_ALLOC;
+	}
+
+	memset(&gMockSessions[idx], 0, sizeof(MockSession));
+	gMockSessions[idx].used = VI_TRUE;
+	gMockSessions[idx].socketClass = (ViBoolean)(nameLen >= 8 && strcmp(name + nameLen - 8, "::SOCKET") == 0);
+	gMockSessions[idx].timeout = 2000;
+	gMockSessions[idx].termChar = '\n';
+	gMockSessions[idx].sendEndEnabled = VI_TRUE;
+	gMockSessions[idx].sweepPoints = MOCK_DEFAULT_SWEEP_POINTS;
+	*vi = MOCK_SESSION_BASE + (ViSession)idx;
+	pthread_mutex_unlock(&gMockMutex);
+
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viClose(ViObject vi)
+{
+	MockSession* session;
+
+	if (vi == MOCK_RM_SESSION)
+		return VI_SUCCESS;
+
+	pthread_mutex_lock(&gMockMutex);
+	if ((session = MockGetSession(vi)) != NULL)
+	{
+		free(session->input);
+		free(session->output);
+		session->used = VI_FALSE;
+	}
+
+	pthread_mutex_unlock(&gMockMutex);
+
+	return session != NULL ? VI_SUCCESS : VI_ERROR_INV_OBJECT;
+}
+
+ViStatus _VI_FUNC viSetAttribute(ViObject vi, ViAttr attrName, ViAttrState attrValue)
+{
+	MockSession* session = MockGetSession(vi);
+
+	if (session == NULL)
+		return VI_ERROR_INV_OBJECT;
+
+	switch (attrName)
+	{
+	case VI_ATTR_TMO_VALUE:
+		session->timeout = (ViUInt32)attrValue;
+		break;
+	case VI_ATTR_TERMCHAR:
+		session->termChar = (ViUInt8)attrValue;
+		break;
+	case VI_ATTR_TERMCHAR_EN:
+		session->termCharEnabled = (ViBoolean)attrValue;
+		break;
+	case VI_ATTR_SEND_END_EN:
+		session->sendEndEnabled = (ViBoolean)attrValue;
+		break;
+	case VI_ATTR_USER_DATA:
+		session->userData = (ViAddr)attrValue;
+		break;
+	case VI_ATTR_WR_BUF_OPER_MODE:
+	case VI_ATTR_RD_BUF_OPER_MODE:
+	case VI_ATTR_ASRL_END_IN:
+	case VI_ATTR_ASRL_END_OUT:
+	case VI_ATTR_SUPPRESS_END_EN:
+		break;
+	default:
+		return VI_ERROR_NSUP_ATTR;
+	}
+
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viGetAttribute(ViObject vi, ViAttr attrName, void* attrValue)
+{
+	MockSession* session = MockGetSession(vi);
+
+	if (session == NULL)
+		return VI_ERROR_INV_OBJECT;
+
+	switch (attrName)
+	{
+	case VI_ATTR_TMO_VALUE:
+		*(ViUInt32*)attrValue = session->timeout;
+		break;
+	case VI_ATTR_TERMCHAR:
+		*(ViUInt8*)attrValue = session->termChar;
+		break;
+	case VI_ATTR_TERMCHAR_EN:
+		*(ViBoolean*)attrValue = session->termCharEnabled;
+		break;
+	case VI_ATTR_SEND_END_EN:
+		*(ViBoolean*)attrValue = session->sendEndEnabled;
+		break;
+	case VI_ATTR_USER_DATA:
+		*(ViAddr*)attrValue = session->userData;
+		break;
+	case VI_ATTR_INTF_TYPE:
+		*(ViUInt16*)attrValue = VI_INTF_TCPIP;
+		break;
+	case VI_ATTR_RSRC_CLASS:
+		strcpy((ViChar*)attrValue, session->socketClass ? "SOCKET" : "INSTR");
+		break;
+	case VI_ATTR_RSRC_MANF_NAME:
+		strcpy((ViChar*)attrValue, "Mock");
+		break;
+	case VI_ATTR_RSRC_IMPL_VERSION:
+		*(ViVersion*)attrValue = 0x00100000;
+		break;
+	default:
+		return VI_ERROR_NSUP_ATTR;
+	}
+
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viStatusDesc(ViObject vi, ViStatus status, ViChar desc[])
+{
+	(void)vi;
+	snprintf(desc, 256, "Mock VISA status 0x%08X", (unsigned int)status);
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viWrite(ViSession vi, ViConstBuf buf, ViUInt32 cnt, ViPUInt32 retCnt)
+{
+	MockSession* session = MockGetSession(vi);
+
+	if (retCnt != NULL)
+		*retCnt = 0;
+
+	if (session == NULL)
+		return VI_ERROR_INV_OBJECT;
+
+	if (!MockAppend(&session->input, &session->inputLen, &session->inputSize, buf, cnt))
+		return VI_ERROR_ALLOC;
+
+	// A new program message discards the unread response, like the instrument's Query Interrupted error
+	if (session->outputPos < session->outputLen)
+		session->outputPos = session->outputLen = 0;
+
+	if (session->sendEndEnabled || (cnt > 0 && buf[cnt - 1] == '\n'))
+		MockExecuteMessage(session);
+
+	if (retCnt != NULL)
+		*retCnt = cnt;
+
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viRead(ViSession vi, ViPBuf buf, ViUInt32 cnt, ViPUInt32 retCnt)
+{
+	MockSession* session = MockGetSession(vi);
+	size_t available;
+	size_t count;
+	const char* termChar;
+
+	if (retCnt != NULL)
+		*retCnt = 0;
+
+	if (session == NULL)
+		return VI_ERROR_INV_OBJECT;
+
+	available = session->outputLen - session->outputPos;
+	if (available == 0)
+		return VI_ERROR_TMO;
+
+	count = (available < cnt) ? available : cnt;
+	if (session->termCharEnabled)
+	{
+		termChar = (const char*)memchr(session->output + session->outputPos, session->termChar, count);
+		if (termChar != NULL)
+			count = (size_t)(termChar - (session->output + session->outputPos)) + 1;
+	}
+
+	memcpy(buf, session->output + session->outputPos, count);
+	session->outputPos += count;
+	if (retCnt != NULL)
+		*retCnt = (ViUInt32)count;
+
+	if (session->outputPos == session->outputLen)
+	{
+		session->outputPos = session->outputLen = 0;
+		return (session->termCharEnabled && buf[count - 1] == session->termChar) ? VI_SUCCESS_TERM_CHAR : VI_SUCCESS;
+	}
+
+	if (session->termCharEnabled && buf[count - 1] == session->termChar)
+		return VI_SUCCESS_TERM_CHAR;
+
+	return VI_SUCCESS_MAX_CNT;
+}
+
+ViStatus _VI_FUNC viReadSTB(ViSession vi, ViPUInt16 status)
+{
+	MockSession* session = MockGetSession(vi);
+
+	if (session == NULL)
+		return VI_ERROR_INV_OBJECT;
+
+	*status = (ViUInt16)((session->esb ? 0x20 : 0) | (session->outputPos < session->outputLen ? 0x10 : 0));
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viClear(ViSession vi)
+{
+	MockSession* session = MockGetSession(vi);
+
+	if (session == NULL)
+		return VI_ERROR_INV_OBJECT;
+
+	session->inputLen = 0;
+	session->outputPos = session->outputLen = 0;
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viSetBuf(ViSession vi, ViUInt16 mask, ViUInt32 size)
+{
+	(void)mask;
+	(void)size;
+	return MockGetSession(vi) != NULL ? VI_SUCCESS : VI_ERROR_INV_OBJECT;
+}
+
+ViStatus _VI_FUNC viEnableEvent(ViSession vi, ViEventType eventType, ViUInt16 mechanism, ViEventFilter context)
+{
+	(void)vi;
+	(void)eventType;
+	(void)mechanism;
+	(void)context;
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viDisableEvent(ViSession vi, ViEventType eventType, ViUInt16 mechanism)
+{
+	(void)vi;
+	(void)eventType;
+	(void)mechanism;
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viDiscardEvents(ViSession vi, ViEventType eventType, ViUInt16 mechanism)
+{
+	(void)vi;
+	(void)eventType;
+	(void)mechanism;
+	return VI_SUCCESS;
+}
+
+ViStatus _VI_FUNC viWaitOnEvent(ViSession vi, ViEventType inEventType, ViUInt32 timeout, ViPEventType outEventType, ViPEvent outContext)
+{
+	MockSession* session = MockGetSession(vi);
+
+	(void)timeout;
+	if (session == NULL)
+		return VI_ERROR_INV_OBJECT;
+
+	// The service request comes immediately, the operation completes with zero delay
+	if (outEventType != NULL)
+		*outEventType = inEventType;
+
+	if (outContext != NULL)
+		*outContext = VI_NULL;
+
+	return VI_SUCCESS;
+}
@@ -0,0 +1,1114 @@
+/*	Rohde&Schwarz Spectrum Analyzer SCPI emulator
+	Standalone local SCPI server for end-to-end tests of the rsspecan driver without an instrument.
+	It listens on the raw SCPI socket port and implements the command subset the driver needs
+	for the synchronization and data transfers, with a timing model of a real analyzer:
+	- *IDN?, *OPT?, *RST, *CLS, *ESE, *ESR?, *SRE, *STB?, *OPC, *OPC?, *WAI
+	- INIT[:IMM], INIT:CONT, SWE:TIME, SWE:POIN
+	- FORM[:DATA] ASCii | REAL,32 | REAL,64
+	- TRAC[:DATA]? TRACE1..6 | LIST - ASCII or binary data block
+	- TRAC:IQ:DATA?, TRAC:IQ:DATA:MEM? [offset,count], TRAC:IQ:RLEN, TRAC:IQ:SRAT, TRAC:IQ:DATA:FORM IQP | IQBL
+	- SYST:ERR?, SYST:ERR:ALL?
+	Other commands are stored, and the queries of the same header return the stored value.
+	A query of a never set header reports -113 "Undefined header" and returns no response, like the instrument.
+
+	Timing model:
+	- INIT starts a sweep lasting the sweep time. *OPC sets the ESR OPC bit, *OPC?, *WAI and the trace queries wait for its end
+	- TRAC:IQ:DATA? captures RLEN / SRAT seconds
+	- Every response is delayed by its length divided by the transfer rate
+
+	Each connection has its own instrument state. Linux / POSIX only.
+	Usage: rsspecan_emulator [-p port] [-t sweepTimeMs] [-n sweepPoints] [-r transferRateMBps] [-v]
+
+	Original Release: October 2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+/*****************************************************************************************************/
+/*  Constants
+******************************************************************************************************/
+#define EMU_IDN_RESPONSE            "Rohde&Schwarz,FSW-26,1312.8000K26/100005,4.70"
+#define EMU_OPT_RESPONSE            "B4,B10,B13,B25,B160,K7,K9,K10,K40,K70"
+#define EMU_DEFAULT_PORT            5025
+#define EMU_DEFAULT_SWEEP_TIME_MS   20.0
+#define EMU_DEFAULT_SWEEP_POINTS    1001
+#define EMU_DEFAULT_TRANSFER_MBPS   100.0
+#define EMU_DEFAULT_IQ_RLEN         1000
+#define EMU_DEFAULT_IQ_SRATE        32.0e6
+#define EMU_MAX_SWEEP_POINTS        100001
+#define EMU_MAX_IQ_SAMPLES          (100 * 1000 * 1000)
+#define EMU_ERROR_QUEUE_SIZE        100
+#define EMU_MAX_STORED_VALUES       1000
+#define EMU_MAX_HEADER_LEN          256
+#define EMU_RX_BUFFER_SIZE          65536
+
+// Status Byte and Event Status Register bits
+#define EMU_STB_ERR_QUEUE           0x04
+#define EMU_STB_MAV                 0x10
+#define EMU_STB_ESB                 0x20
+#define EMU_STB_MSS                 0x40
+#define EMU_ESR_OPC                 0x01
+#define EMU_ESR_QUERY_ERROR         0x04
+#define EMU_ESR_EXECUTION_ERROR     0x10
+#define EMU_ESR_COMMAND_ERROR       0x20
+
+typedef enum
+{
+	EMU_FORMAT_ASCII,
+	EMU_FORMAT_REAL32,
+	EMU_FORMAT_REAL64
+} EmuFormat;
+
+/*****************************************************************************************************/
+/*  Server settings, common for all connections
+******************************************************************************************************/
+typedef struct
+{
+	int port;
+	double sweepTimeMs;
+	int sweepPoints;
+	double transferRateBps;
+	int verbose;
+} EmuSettings;
+
+static EmuSettings gSettings = {
+	EMU_DEFAULT_PORT,
+	EMU_DEFAULT_SWEEP_TIME_MS,
+	EMU_DEFAULT_SWEEP_POINTS,
+	EMU_DEFAULT_TRANSFER_MBPS * 1.0e6,
+	0
+};
+
+/*****************************************************************************************************/
+/*  Instrument state of one connection
+******************************************************************************************************/
+typedef struct
+{
+	char header[EMU_MAX_HEADER_LEN];
+	char* value;
+} EmuStoredValue;
+
+typedef struct
+{
+	int socket;
+
+	// Status registers
+	int esr;
+	int ese;
+	int sre;
+	int opcPending; // *OPC received, the ESR OPC bit is set at the end of the pending operation
+	int errors[EMU_ERROR_QUEUE_SIZE];
+	const char* errorTexts[EMU_ERROR_QUEUE_SIZE];
+	int errorsCount;
+
+	// Measurement
+	double operationEndMs; // End of the pending sweep or capture, 0 if none
+	int continuous;
+	double sweepTimeMs;
+	int sweepPoints;
+	unsigned int sweepCount;
+	EmuFormat format;
+	int iqRecordLength;
+	double iqSampleRate;
+	int iqBlockFormat; // 0 = IQP (pairs), 1 = IQBL (all I, then all Q)
+
+	// Generic command values
+	EmuStoredValue stored[EMU_MAX_STORED_VALUES];
+	int storedCount;
+
+	// Response of the current program message
+	char* response;
+	size_t responseLen;
+	size_t responseSize;
+} EmuInstrument;
+
+/*****************************************************************************************************/
+/*  Helpers
+******************************************************************************************************/
+static double EmuTimeMs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+static void EmuSleepMs(double delayMs)
+{
+	struct timespec delay;
+
+	if (delayMs <= 0.0)
+		return;
+
+	delay.tv_sec = (time_t)(delayMs / 1000.0);
+	delay.tv_nsec = (long)((delayMs - (double)delay.tv_sec * 1000.0) * 1.0e6);
+	while (nanosleep(&delay, &delay) != 0 && errno == EINTR);
+}
+
+static void EmuPushError(EmuInstrument* instr, int code, const char* text)
+{
+	if (instr->errorsCount < EMU_ERROR_QUEUE_SIZE)
+	{
+		instr->errors[instr->errorsCount] = code;
+		instr->errorTexts[instr->errorsCount] = text;
+		instr->errorsCount++;
+	}
+
+	if (code <= -100 && code > -200)
+		instr->esr |= EMU_ESR_COMMAND_ERROR;
+	else if (code <= -200 && code > -300)
+		instr->esr |= EMU_ESR_EXECUTION_ERROR;
+	else if (code <= -400 && code > -500)
+		instr->esr |= EMU_ESR_QUERY_ERROR;
+}
+
+// Completes the pending operation if its time is over
+static void EmuUpdateOperation(EmuInstrument* instr)
+{
+	if (instr->operationEndMs > 0.0 && EmuTimeMs() >= instr->operationEndMs)
+	{
+		instr->operationEndMs = 0.0;
+		instr->sweepCount++;
+	}
+
+	if (instr->opcPending && instr->operationEndMs == 0.0)
+	{
+		instr->opcPending = 0;
+		instr->esr |= EMU_ESR_OPC;
+	}
+}
+
+// Blocks until the pending operation ends, like the instrument's sequential command execution
+static void EmuWaitForOperation(EmuInstrument* instr)
+{
+	if (instr->operationEndMs > 0.0)
+		EmuSleepMs(instr->operationEndMs - EmuTimeMs());
+
+	EmuUpdateOperation(instr);
+}
+
+static void EmuStartOperation(EmuInstrument* instr, double durationMs)
+{
+	instr->operationEndMs = EmuTimeMs() + durationMs;
+}
+
+static int EmuStatusByte(EmuInstrument* instr)
+{
+	int stb = 0;
+
+	EmuUpdateOperation(instr);
+	if (instr->errorsCount > 0)
+		stb |= EMU_STB_ERR_QUEUE;
+
+	if ((instr->esr & instr->ese) != 0)
+		stb |= EMU_STB_ESB;
+
+	if ((stb & instr->sre) != 0)
+		stb |= EMU_STB_MSS;
+
+	return stb;
+}
+
+static void EmuAppendResponse(EmuInstrument* instr, const void* data, size_t length)
+{
+	if (instr->responseLen + length + 2 > instr->responseSize)
+	{
+		size_t newSize = (instr->responseLen + length + 2) * 2;
+		char* newResponse = (char*)realloc(instr->response, newSize);
+
+		if (newResponse == NULL)
+			return;
+
+		instr->response = newResponse;
+		instr->responseSize = newSize;
+	}
+
+	memcpy(instr->response + instr->responseLen, data, length);
+	instr->responseLen += length;
+}
+
+// Starts a new response unit. More queries in one program message are separated with ';'
+static void EmuBeginResponseUnit(EmuInstrument* instr)
+{
+	if (instr->responseLen > 0)
+		EmuAppendResponse(instr, ";", 1);
+}
+
+static void EmuAppendResponseString(EmuInstrument* instr, const char* string)
+{
+	EmuBeginResponseUnit(instr);
+	EmuAppendResponse(instr, string, strlen(string));
+}
+
+// Appends the values in the current format: comma-separated ASCII or a binary data block
+static void EmuAppendResponseValues(EmuInstrument* instr, const double* values, size_t count)
+{
+	char text[64];
+	char header[80];
+	size_t i;
+	int len;
+
+	EmuBeginResponseUnit(instr);
+	if (instr->format == EMU_FORMAT_ASCII)
+	{
+		for (i = 0; i < count; i++)
+		{
+			len = snprintf(text, sizeof(text), (i == 0) ? "%.9g" : ",%.9g", values[i]);
+			EmuAppendResponse(instr, text, (size_t)len);
+		}
+
+		return;
+	}
+
+	if (instr->format == EMU_FORMAT_REAL32)
+	{
+		size_t dataLen = count * sizeof(float);
+		float* data = (float*)malloc(dataLen + 1);
+
+		if (data == NULL)
+			return;
+
+		for (i = 0; i < count; i++)
+			data[i] = (float)values[i];
+
+		len = snprintf(text, sizeof(text), "%zu", dataLen);
+		snprintf(header, sizeof(header), "#%d%s", len, text);
+		EmuAppendResponse(instr, header, strlen(header));
+		EmuAppendResponse(instr, data, dataLen);
+		free(data);
+	}
+	else
+	{
+		size_t dataLen = count * sizeof(double);
+
+		len = snprintf(text, sizeof(text), "%zu", dataLen);
+		snprintf(header, sizeof(header), "#%d%s", len, text);
+		EmuAppendResponse(instr, header, strlen(header));
+		EmuAppendResponse(instr, values, dataLen);
+	}
+}
+
+// Deterministic pseudo-random numbers, the seed changes with each sweep
+static double EmuNoise(unsigned int* seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xFFFF) / 65536.0;
+}
+
+/*****************************************************************************************************/
+/*  SCPI header matching
+    Pattern mnemonics have the short form in upper case and the rest of the long form in lower case.
+    Optional nodes are in brackets, e.g. "TRACe[:DATA]". Numeric suffixes of the header mnemonics are ignored.
+******************************************************************************************************/
+static int EmuMatchMnemonic(const char* header, size_t headerLen, const char* pattern, size_t patternLen)
+{
+	char shortForm[64];
+	char longForm[64];
+	size_t shortLen = 0, longLen = 0, i;
+
+	for (i = 0; i < patternLen && longLen < sizeof(longForm) - 1; i++)
+	{
+		if (isupper((unsigned char)pattern[i]))
+			shortForm[shortLen++] = pattern[i];
+
+		longForm[longLen++] = (char)toupper((unsigned char)pattern[i]);
+	}
+
+	// Strip the numeric suffix
+	while (headerLen > 0 && isdigit((unsigned char)header[headerLen - 1]))
+		headerLen--;
+
+	if (headerLen == shortLen && strncasecmp(header, shortForm, shortLen) == 0)
+		return 1;
+
+	return headerLen == longLen && strncasecmp(header, longForm, longLen) == 0;
+}
+
+static int EmuMatchHeader(const char* header, const char* pattern)
+{
+	const char* headerEnd;
+	const char* patternEnd;
+
+	if (*header == ':')
+		header++;
+
+	if (*pattern == ':')
+		pattern++;
+
+	if (*pattern == 0)
+		return *header == 0;
+
+	if (*pattern == '[')
+	{
+		// Optional node: try with it, then without it
+		const char* close = strchr(pattern, ']');
+
+		if (close == NULL)
+			return 0;
+
+		char withNode[EMU_MAX_HEADER_LEN];
+		size_t nodeLen = (size_t)(close - pattern - 1);
+
+		snprintf(withNode, sizeof(withNode), "%.*s%s", (int)nodeLen, pattern + 1, close + 1);
+		return EmuMatchHeader(header, withNode) || EmuMatchHeader(header, close + 1);
+	}
+
+	if (*header == 0)
+		return 0;
+
+	headerEnd = header + strcspn(header, ":");
+	patternEnd = pattern + strcspn(pattern, ":[");
+	if (!EmuMatchMnemonic(header, (size_t)(headerEnd - header), pattern, (size_t)(patternEnd - pattern)))
+		return 0;
+
+	return EmuMatchHeader(headerEnd, patternEnd);
+}
+
+/*****************************************************************************************************/
+/*  Generic stored values
+    The key is the header in the short form: each mnemonic is cut to 4 characters (3 if the 4th is a vowel)
+    and keeps its numeric suffix. The optional leading SENSe node is removed.
+******************************************************************************************************/
+static void EmuNormalizeHeader(const char* header, char* key, size_t keySize)
+{
+	size_t i = 0;
+	size_t mnemonicLen;
+	size_t alphaLen;
+	size_t shortLen;
+	size_t k;
+
+	if (*header == ':')
+		header++;
+
+	if (EmuMatchMnemonic(header, strcspn(header, ":"), "SENSe", 5) && header[strcspn(header, ":")] == ':')
+		header += strcspn(header, ":") + 1;
+
+	while (*header && i < keySize - 1)
+	{
+		mnemonicLen = strcspn(header, ":");
+		alphaLen = mnemonicLen;
+		while (alphaLen > 0 && isdigit((unsigned char)header[alphaLen - 1]))
+			alphaLen--;
+
+		shortLen = alphaLen;
+		if (alphaLen > 4 && header[0] != '*')
+			shortLen = strchr("AEIOUaeiou", header[3]) ? 3 : 4;
+
+		for (k = 0; k < mnemonicLen && i < keySize - 1; k++)
+			if (k < shortLen || k >= alphaLen)
+				key[i++] = (char)toupper((unsigned char)header[k]);
+
+		header += mnemonicLen;
+		if (*header == ':' && i < keySize - 1)
+			key[i++] = *header++;
+	}
+
+	key[i] = 0;
+}
+
+static EmuStoredValue* EmuFindStored(EmuInstrument* instr, const char* header)
+{
+	char key[EMU_MAX_HEADER_LEN];
+	int i;
+
+	EmuNormalizeHeader(header, key, sizeof(key));
+	for (i = 0; i < instr->storedCount; i++)
+		if (strcmp(instr->stored[i].header, key) == 0)
+			return &instr->stored[i];
+
+	return NULL;
+}
+
+static void EmuStoreValue(EmuInstrument* instr, const char* header, const char* value)
+{
+	EmuStoredValue* stored = EmuFindStored(instr, header);
+
+	if (stored == NULL)
+	{
+		if (instr->storedCount >= EMU_MAX_STORED_VALUES)
+		{
+			EmuPushError(instr, -350, "Queue overflow");
+			return;
+		}
+
+		stored = &instr->stored[instr->storedCount++];
+		EmuNormalizeHeader(header, stored->header, sizeof(stored->header));
+		stored->value = NULL;
+	}
+
+	free(stored->value);
+	stored->value = strdup(value);
+}
+
+/*****************************************************************************************************/
+/*  Command handlers
+******************************************************************************************************/
+static void EmuReset(EmuInstrument* instr)
+{
+	int i;
+
+	instr->operationEndMs = 0.0;
+	instr->opcPending = 0;
+	instr->continuous = 0;
+	instr->sweepTimeMs = gSettings.sweepTimeMs;
+	instr->sweepPoints = gSettings.sweepPoints;
+	instr->format = EMU_FORMAT_ASCII;
+	instr->iqRecordLength = EMU_DEFAULT_IQ_RLEN;
+	instr->iqSampleRate = EMU_DEFAULT_IQ_SRATE;
+	instr->iqBlockFormat = 0;
+	for (i = 0; i < instr->storedCount; i++)
+		free(instr->stored[i].value);
+
+	instr->storedCount = 0;
+}
+
+static void EmuQueryTrace(EmuInstrument* instr, const char* parameters)
+{
+	double* values;
+	unsigned int seed;
+	int count = instr->sweepPoints;
+	int i;
+
+	EmuWaitForOperation(instr);
+	if (strncasecmp(parameters, "LIST", 4) == 0)
+		count = 1;
+
+	if ((values = (double*)malloc(sizeof(double) * (size_t)count)) == NULL)
+	{
+		EmuPushError(instr, -225, "Out of memory");
+		return;
+	}
+
+	// Noise floor with a carrier in the middle of the span
+	seed = instr->sweepCount * 7919u + (unsigned int)parameters[strlen(parameters) > 0 ? strlen(parameters) - 1 : 0];
+	for (i = 0; i < count; i++)
+		values[i] = -90.0 + 4.0 * EmuNoise(&seed);
+
+	values[count / 2] = -20.0 + EmuNoise(&seed);
+	EmuAppendResponseValues(instr, values, (size_t)count);
+	free(values);
+}
+
+static void EmuQueryIq(EmuInstrument* instr, long offset, long samples)
+{
+	double* values;
+	unsigned int seed = instr->sweepCount * 104729u;
+	long i;
+	double phase;
+
+	if (offset < 0 || samples < 1 || offset + samples > instr->iqRecordLength)
+	{
+		EmuPushError(instr, -222, "Data out of range");
+		return;
+	}
+
+	if ((values = (double*)malloc(sizeof(double) * 2 * (size_t)samples)) == NULL)
+	{
+		EmuPushError(instr, -225, "Out of memory");
+		return;
+	}
+
+	// Complex tone at 1/16 of the sample rate with a small noise
+	for (i = 0; i < samples; i++)
+	{
+		phase = 2.0 * 3.14159265358979323846 * (double)(offset + i) / 16.0;
+		if (instr->iqBlockFormat)
+		{
+			values[i] = 0.1 * cos(phase) + 0.001 * EmuNoise(&seed);
+			values[samples + i] = 0.1 * sin(phase) + 0.001 * EmuNoise(&seed);
+		}
+		else
+		{
+			values[2 * i] = 0.1 * cos(phase) + 0.001 * EmuNoise(&seed);
+			values[2 * i + 1] = 0.1 * sin(phase) + 0.001 * EmuNoise(&seed);
+		}
+	}
+
+	EmuAppendResponseValues(instr, values, 2 * (size_t)samples);
+	free(values);
+}
+
+// Executes one program message unit: header and parameters
+static void EmuExecute(EmuInstrument* instr, char* unit)
+{
+	char* header;
+	char* parameters;
+	char text[512];
+	int isQuery;
+	size_t len;
+
+	while (isspace((unsigned char)*unit))
+		unit++;
+
+	if (*unit == 0)
+		return;
+
+	header = unit;
+	len = strcspn(unit, " \t");
+	parameters = unit + len;
+	if (*parameters)
+		*parameters++ = 0;
+
+	while (isspace((unsigned char)*parameters))
+		parameters++;
+
+	len = strlen(parameters);
+	while (len > 0 && isspace((unsigned char)parameters[len - 1]))
+		parameters[--len] = 0;
+
+	len = strlen(header);
+	isQuery = (len > 0 && header[len - 1] == '?');
+	if (isQuery)
+		header[len - 1] = 0;
+
+	if (gSettings.verbose)
+		printf("[%d] %s%s %s\n", instr->socket, header, isQuery ? "?" : "", parameters);
+
+	// Common commands
+	if (strcasecmp(header, "*IDN") == 0 && isQuery)
+		EmuAppendResponseString(instr, EMU_IDN_RESPONSE);
+	else if (strcasecmp(header, "*OPT") == 0 && isQuery)
+		EmuAppendResponseString(instr, EMU_OPT_RESPONSE);
+	else if (strcasecmp(header, "*RST") == 0)
+		EmuReset(instr);
+	else if (strcasecmp(header, "*CLS") == 0)
+	{
+		EmuUpdateOperation(instr);
+		instr->esr = 0;
+		instr->errorsCount = 0;
+		instr->opcPending = 0;
+	}
+	else if (strcasecmp(header, "*ESE") == 0)
+	{
+		if (isQuery)
+		{
+			snprintf(text, sizeof(text), "%d", instr->ese);
+			EmuAppendResponseString(instr, text);
+		}
+		else
+			instr->ese = atoi(parameters) & 0xFF;
+	}
+	else if (strcasecmp(header, "*SRE") == 0)
+	{
+		if (isQuery)
+		{
+			snprintf(text, sizeof(text), "%d", instr->sre);
+			EmuAppendResponseString(instr, text);
+		}
+		else
+			instr->sre = atoi(parameters) & 0xBF;
+	}
+	else if (strcasecmp(header, "*ESR") == 0 && isQuery)
+	{
+		EmuUpdateOperation(instr);
+		snprintf(text, sizeof(text), "%d", instr->esr);
+		instr->esr = 0;
+		EmuAppendResponseString(instr, text);
+	}
+	else if (strcasecmp(header, "*STB") == 0 && isQuery)
+	{
+		snprintf(text, sizeof(text), "%d", EmuStatusByte(instr));
+		EmuAppendResponseString(instr, text);
+	}
+	else if (strcasecmp(header, "*OPC") == 0)
+	{
+		if (isQuery)
+		{
+			EmuWaitForOperation(instr);
+			EmuAppendResponseString(instr, "1");
+		}
+		else
+		{
+			instr->opcPending = 1;
+			EmuUpdateOperation(instr);
+		}
+	}
+	else if (strcasecmp(header, "*WAI") == 0)
+		EmuWaitForOperation(instr);
+	// Measurement control
+	else if (EmuMatchHeader(header, "INITiate[:IMMediate]") && !isQuery)
+	{
+		EmuWaitForOperation(instr);
+		EmuStartOperation(instr, instr->sweepTimeMs);
+	}
+	else if (EmuMatchHeader(header, "INITiate:CONTinuous"))
+	{
+		if (isQuery)
+			EmuAppendResponseString(instr, instr->continuous ? "1" : "0");
+		else
+			instr->continuous = (strcasecmp(parameters, "ON") == 0 || atoi(parameters) != 0);
+	}
+	else if (EmuMatchHeader(header, "[SENSe]:SWEep:TIME"))
+	{
+		if (isQuery)
+		{
+			snprintf(text, sizeof(text), "%.9g", instr->sweepTimeMs / 1000.0);
+			EmuAppendResponseString(instr, text);
+		}
+		else if (atof(parameters) <= 0.0)
+			EmuPushError(instr, -222, "Data out of range");
+		else
+			instr->sweepTimeMs = atof(parameters) * 1000.0;
+	}
+	else if (EmuMatchHeader(header, "[SENSe]:SWEep:POINts"))
+	{
+		if (isQuery)
+		{
+			snprintf(text, sizeof(text), "%d", instr->sweepPoints);
+			EmuAppendResponseString(instr, text);
+		}
+		else if (atoi(parameters) < 1 || atoi(parameters) > EMU_MAX_SWEEP_POINTS)
+			EmuPushError(instr, -222, "Data out of range");
+		else
+			instr->sweepPoints = atoi(parameters);
+	}
+	// Data format
+	else if (EmuMatchHeader(header, "FORMat[:DATA]"))
+	{
+		if (isQuery)
+			EmuAppendResponseString(instr, instr->format == EMU_FORMAT_ASCII ? "ASC,0" : (instr->format == EMU_FORMAT_REAL32 ? "REAL,32" : "REAL,64"));
+		else if (strncasecmp(parameters, "ASC", 3) == 0)
+			instr->format = EMU_FORMAT_ASCII;
+		else if (strncasecmp(parameters, "REAL", 4) == 0)
+			instr->format = (strstr(parameters, "64") != NULL) ? EMU_FORMAT_REAL64 : EMU_FORMAT_REAL32;
+		else
+			EmuPushError(instr, -224, "Illegal parameter value");
+	}
+	// Trace data
+	else if (EmuMatchHeader(header, "TRACe[:DATA]") && isQuery)
+		EmuQueryTrace(instr, parameters);
+	else if (EmuMatchHeader(header, "TRACe:IQ:DATA:MEMory") && isQuery)
+	{
+		long offset = 0;
+		long samples = instr->iqRecordLength;
+
+		EmuWaitForOperation(instr);
+		if (*parameters)
+			sscanf(parameters, "%ld , %ld", &offset, &samples);
+
+		EmuQueryIq(instr, offset, samples);
+	}
+	else if (EmuMatchHeader(header, "TRACe:IQ:DATA:FORMat"))
+	{
+		if (isQuery)
+			EmuAppendResponseString(instr, instr->iqBlockFormat ? "IQBL" : "IQP");
+		else
+			instr->iqBlockFormat = (strncasecmp(parameters, "IQBL", 4) == 0);
+	}
+	else if (EmuMatchHeader(header, "TRACe:IQ:DATA") && isQuery)
+	{
+		// Captures a new record, then returns it
+		EmuWaitForOperation(instr);
+		EmuStartOperation(instr, (double)instr->iqRecordLength / instr->iqSampleRate * 1000.0);
+		EmuWaitForOperation(instr);
+		EmuQueryIq(instr, 0, instr->iqRecordLength);
+	}
+	else if (EmuMatchHeader(header, "TRACe:IQ:RLENgth"))
+	{
+		if (isQuery)
+		{
+			snprintf(text, sizeof(text), "%d", instr->iqRecordLength);
+			EmuAppendResponseString(instr, text);
+		}
+		else if (atol(parameters) < 1 || atol(parameters) > EMU_MAX_IQ_SAMPLES)
+			EmuPushError(instr, -222, "Data out of range");
+		else
+			instr->iqRecordLength = atoi(parameters);
+	}
+	else if (EmuMatchHeader(header, "TRACe:IQ:SRATe"))
+	{
+		if (isQuery)
+		{
+			snprintf(text, sizeof(text), "%.12g", instr->iqSampleRate);
+			EmuAppendResponseString(instr, text);
+		}
+		else if (atof(parameters) <= 0.0)
+			EmuPushError(instr, -222, "Data out of range");
+		else
+			instr->iqSampleRate = atof(parameters);
+	}
+	// Error queue
+	else if (EmuMatchHeader(header, "SYSTem:ERRor[:NEXT]") && isQuery)
+	{
+		if (instr->errorsCount == 0)
+			EmuAppendResponseString(instr, "0,\"No error\"");
+		else
+		{
+			snprintf(text, sizeof(text), "%d,\"%s\"", instr->errors[0], instr->errorTexts[0]);
+			instr->errorsCount--;
+			memmove(instr->errors, instr->errors + 1, sizeof(int) * (size_t)instr->errorsCount);
+			memmove(instr->errorTexts, instr->errorTexts + 1, sizeof(char*) * (size_t)instr->errorsCount);
+			EmuAppendResponseString(instr, text);
+		}
+	}
+	else if (EmuMatchHeader(header, "SYSTem:ERRor:ALL") && isQuery)
+	{
+		int i;
+
+		EmuBeginResponseUnit(instr);
+		if (instr->errorsCount == 0)
+			EmuAppendResponse(instr, "0,\"No error\"", 12);
+
+		for (i = 0; i < instr->errorsCount; i++)
+		{
+			snprintf(text, sizeof(text), (i == 0) ? "%d,\"%s\"" : ",%d,\"%s\"", instr->errors[i], instr->errorTexts[i]);
+			EmuAppendResponse(instr, text, strlen(text));
+		}
+
+		instr->errorsCount = 0;
+	}
+	// Everything else
+	else if (isQuery)
+	{
+		EmuStoredValue* stored = EmuFindStored(instr, header);
+
+		if (stored == NULL)
+			EmuPushError(instr, -113, "Undefined header");
+		else
+			EmuAppendResponseString(instr, stored->value);
+	}
+	else
+	{
+		EmuStoreValue(instr, header, parameters);
+	}
+}
+
+/*****************************************************************************************************/
+/*  Executes one program message: units separated with ';' outside of strings and binary blocks
+    Units following a unit with a path keep the path of the previous unit, unless they start with ':' or '*'
+******************************************************************************************************/
+static void EmuExecuteMessage(EmuInstrument* instr, char* message, size_t length)
+{
+	char* unitStart = message;
+	char unit[EMU_RX_BUFFER_SIZE];
+	char path[EMU_MAX_HEADER_LEN] = "";
+	size_t i = 0;
+	char quote = 0;
+
+	instr->responseLen = 0;
+	for (i = 0; i <= length; i++)
+	{
+		char c = (i < length) ? message[i] : ';';
+
+		if (quote)
+		{
+			if (c == quote)
+				quote = 0;
+
+			continue;
+		}
+
+		if (c == '"' || c == '\'')
+		{
+			quote = c;
+			continue;
+		}
+
+		if (c == '#' && i + 1 < length && isdigit((unsigned char)message[i + 1]))
+		{
+			// Skip the binary data block
+			int digits = message[i + 1] - '0';
+			char lengthText[10] = "";
+
+			if (digits > 0 && i + 2 + (size_t)digits <= length)
+			{
+				memcpy(lengthText, message + i + 2, (size_t)digits);
+				i += 1 + (size_t)digits + (size_t)atol(lengthText);
+			}
+
+			continue;
+		}
+
+		if (c != ';')
+			continue;
+
+		// Compose the unit with the path of the previous unit
+		{
+			size_t unitLen = (size_t)(message + i - unitStart);
+			char* p2unit = unitStart;
+			size_t pathLen = 0;
+
+			while (unitLen > 0 && isspace((unsigned char)*p2unit))
+			{
+				p2unit++;
+				unitLen--;
+			}
+
+			if (unitLen > 0 && *p2unit != ':' && *p2unit != '*' && path[0])
+				pathLen = (size_t)snprintf(unit, sizeof(unit), "%s", path);
+
+			if (pathLen + unitLen >= sizeof(unit))
+				unitLen = sizeof(unit) - pathLen - 1;
+
+			memcpy(unit + pathLen, p2unit, unitLen);
+			unit[pathLen + unitLen] = 0;
+
+			if (unit[0] != '*')
+			{
+				// Path for the next unit: the header up to its last ':'
+				size_t headerLen = strcspn(unit, " \t");
+				char* lastColon = NULL;
+				size_t k;
+
+				for (k = 0; k < headerLen; k++)
+					if (unit[k] == ':')
+						lastColon = unit + k;
+
+				path[0] = 0;
+				if (lastColon != NULL && lastColon != unit && (size_t)(lastColon - unit + 1) < sizeof(path))
+				{
+					memcpy(path, unit, (size_t)(lastColon - unit + 1));
+					path[lastColon - unit + 1] = 0;
+				}
+			}
+
+			EmuExecute(instr, unit);
+		}
+
+		unitStart = message + i + 1;
+	}
+}
+
+/*****************************************************************************************************/
+/*  Sends the response of the program message, delayed by the transfer rate model
+******************************************************************************************************/
+static int EmuSendResponse(EmuInstrument* instr)
+{
+	size_t sent = 0;
+	ssize_t result;
+
+	if (instr->responseLen == 0)
+		return 0;
+
+	// The response is complete for the client after its transfer time
+	EmuAppendResponse(instr, "\n", 1);
+	EmuSleepMs((double)instr->responseLen / gSettings.transferRateBps * 1000.0);
+	while (sent < instr->responseLen)
+	{
+		result = send(instr->socket, instr->response + sent, instr->responseLen - sent, MSG_NOSIGNAL);
+		if (result < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			return -1;
+		}
+
+		sent += (size_t)result;
+	}
+
+	instr->responseLen = 0;
+
+	return 0;
+}
+
+/*****************************************************************************************************/
+/*  Connection thread: reads program messages terminated with LF.
+    Binary data blocks in the messages may contain LF characters, they are read by their declared length.
+******************************************************************************************************/
+static void* EmuConnectionThread(void* argument)
+{
+	EmuInstrument* instr = (EmuInstrument*)argument;
+	char* message = NULL;
+	size_t messageLen = 0, messageSize = 0;
+	size_t blockRemaining = 0; // Remaining bytes of a binary block in the message
+	char rxBuffer[EMU_RX_BUFFER_SIZE];
+	ssize_t received;
+	ssize_t i;
+
+	EmuReset(instr);
+	while ((received = recv(instr->socket, rxBuffer, sizeof(rxBuffer), 0)) > 0)
+	{
+		for (i = 0; i < received; i++)
+		{
+			char c = rxBuffer[i];
+
+			if (messageLen + 1 >= messageSize)
+			{
+				char* newMessage;
+
+				messageSize = messageSize ? messageSize * 2 : 4096;
+				if ((newMessage = (char*)realloc(message, messageSize)) == NULL)
+					goto Exit;
+
+				message = newMessage;
+			}
+
+			message[messageLen++] = c;
+			if (blockRemaining > 0)
+			{
+				blockRemaining--;
+				continue;
+			}
+
+			// Binary block header '#<digits><length>' complete?
+			if (messageLen >= 2 && message[messageLen - 1] != '#')
+			{
+				char* hash = NULL;
+				size_t k = messageLen;
+
+				while (k > 0 && messageLen - k < 12)
+				{
+					k--;
+					if (message[k] == '#')
+					{
+						hash = message + k;
+						break;
+					}
+
+					if (!isdigit((unsigned char)message[k]))
+						break;
+				}
+
+				if (hash != NULL && (size_t)(message + messageLen - hash) > 1)
+				{
+					int digits = hash[1] - '0';
+
+					if (digits > 0 && (size_t)(message + messageLen - hash) == (size_t)digits + 2)
+					{
+						char lengthText[10] = "";
+
+						memcpy(lengthText, hash + 2, (size_t)digits);
+						blockRemaining = (size_t)atol(lengthText);
+						continue;
+					}
+				}
+			}
+
+			if (c == '\n')
+			{
+				message[--messageLen] = 0;
+				EmuExecuteMessage(instr, message, messageLen);
+				if (EmuSendResponse(instr) != 0)
+					goto Exit;
+
+				messageLen = 0;
+			}
+		}
+	}
+
+Exit:
+	if (gSettings.verbose)
+		printf("[%d] connection closed\n", instr->socket);
+
+	close(instr->socket);
+	EmuReset(instr);
+	free(instr->response);
+	free(message);
+	free(instr);
+
+	return NULL;
+}
+
+/*****************************************************************************************************/
+/*  Main: parses the arguments and accepts the connections
+******************************************************************************************************/
+int main(int argc, char* argv[])
+{
+	struct sockaddr_in address;
+	int listener;
+	int option;
+	int i;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+			gSettings.port = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+			gSettings.sweepTimeMs = atof(argv[++i]);
+		else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+			gSettings.sweepPoints = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+			gSettings.transferRateBps = atof(argv[++i]) * 1.0e6;
+		else if (strcmp(argv[i], "-v") == 0)
+			gSettings.verbose = 1;
+		else
+		{
+			fprintf(stderr, "Usage: %s [-p port] [-t sweepTimeMs] [-n sweepPoints] [-r transferRateMBps] [-v]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	if (gSettings.sweepPoints < 1 || gSettings.sweepPoints > EMU_MAX_SWEEP_POINTS || gSettings.transferRateBps <= 0.0)
+	{
+		fprintf(stderr, "Invalid sweep points or transfer rate\n");
+		return 1;
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+	if ((listener = socket(AF_INET, SOCK_STREAM, 0)) < 0)
+	{
+		perror("socket");
+		return 1;
+	}
+
+	option = 1;
+	setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &option, sizeof(option));
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons((unsigned short)gSettings.port);
+	if (bind(listener, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 16) != 0)
+	{
+		perror("bind");
+		return 1;
+	}
+
+	printf("rsspecan emulator listening on 127.0.0.1:%d, sweep time %.3f ms, %d points, transfer rate %.1f MB/s\n",
+	       gSettings.port, gSettings.sweepTimeMs, gSettings.sweepPoints, gSettings.transferRateBps / 1.0e6);
+	fflush(stdout);
+
+	while (1)
+	{
+		pthread_t thread;
+		EmuInstrument* instr;
+		int client = accept(listener, NULL, NULL);
+
+		if (client < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			perror("accept");
+			break;
+		}
+
+		option = 1;
+		setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &option, sizeof(option));
+		if ((instr = (EmuInstrument*)calloc(1, sizeof(EmuInstrument))) == NULL)
+		{
+			close(client);
+			continue;
+		}
+
+		instr->socket = client;
+		if (gSettings.verbose)
+			printf("[%d] connection accepted\n", client);
+
+		if (pthread_create(&thread, NULL, EmuConnectionThread, instr) != 0)
+		{
+			close(client);
+			free(instr);
+			continue;
+		}
+
+		pthread_detach(thread);
+	}
+
+	close(listener);
+
+	return 0;
+}